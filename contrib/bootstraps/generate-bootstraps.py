@@ -0,0 +1,87 @@
+#!/usr/bin/env python3
+# Copyright (c) 2019-2020 Xenios SEZC
+# https://www.veriblock.org
+# Distributed under the MIT software license, see the accompanying
+# file COPYING or http://www.opensource.org/licenses/mit-license.php.
+'''
+Script to generate the embedded PoP bootstrap blocks for bootstraps.cpp.
+
+This script expects two text files in the directory that is passed as an
+argument:
+
+    testnet_btc.txt
+    testnet_vbk.txt
+
+These files must consist of one hex-encoded block header per line, ordered
+by height. Empty lines and lines starting with '#' are ignored. BTC headers
+must be 80 bytes long, VBK headers must be 65 bytes long.
+
+The output will be two byte arrays with the headers stored back to back:
+
+   static constexpr unsigned char testnetBTCblocksRaw[] = {
+   ...
+   };
+   static constexpr unsigned char testnetVBKblocksRaw[] = {
+   ...
+   };
+
+These should be written to `src/bootstrapsblocks.h`.
+'''
+
+from binascii import a2b_hex
+import os
+import sys
+
+BTC_HEADER_SIZE = 80
+VBK_HEADER_SIZE = 65
+
+
+def read_headers(path, size):
+    headers = []
+    with open(path, 'r', encoding="utf8") as f:
+        for lineno, line in enumerate(f, 1):
+            line = line.strip()
+            if not line or line.startswith('#'):
+                continue
+            header = a2b_hex(line)
+            if len(header) != size:
+                raise ValueError('%s:%d: expected %d bytes, got %d' % (path, lineno, size, len(header)))
+            headers.append(header)
+    return headers
+
+
+def process_headers(g, path, structname, size):
+    headers = read_headers(path, size)
+    g.write('static constexpr unsigned char %s[] = {\n' % structname)
+    for i, header in enumerate(headers):
+        g.write('    ' + ','.join('0x%02x' % b for b in header))
+        g.write(',\n' if i + 1 < len(headers) else '\n')
+    g.write('};\n')
+
+
+def main():
+    if len(sys.argv) < 2:
+        print(('Usage: %s <path_to_bootstraps_files>' % sys.argv[0]), file=sys.stderr)
+        sys.exit(1)
+    g = sys.stdout
+    indir = sys.argv[1]
+    g.write('#ifndef PLACEH_BOOTSTRAPSBLOCKS_H\n')
+    g.write('#define PLACEH_BOOTSTRAPSBLOCKS_H\n')
+    g.write('/**\n')
+    g.write(' * Serialized bootstrap block headers for the BTC and VBK testnets\n')
+    g.write(' * AUTOGENERATED by contrib/bootstraps/generate-bootstraps.py\n')
+    g.write(' *\n')
+    g.write(' * Each line contains one raw block header, headers are ordered by height.\n')
+    g.write(' * BTC headers are %d bytes and VBK headers are %d bytes long.\n' % (BTC_HEADER_SIZE, VBK_HEADER_SIZE))
+    g.write(' */\n')
+    g.write('#include <cstddef>\n\n')
+    g.write('static constexpr size_t BTC_BOOTSTRAP_HEADER_SIZE = %d;\n' % BTC_HEADER_SIZE)
+    g.write('static constexpr size_t VBK_BOOTSTRAP_HEADER_SIZE = %d;\n\n' % VBK_HEADER_SIZE)
+    process_headers(g, os.path.join(indir, 'testnet_btc.txt'), 'testnetBTCblocksRaw', BTC_HEADER_SIZE)
+    g.write('\n')
+    process_headers(g, os.path.join(indir, 'testnet_vbk.txt'), 'testnetVBKblocksRaw', VBK_HEADER_SIZE)
+    g.write('#endif // PLACEH_BOOTSTRAPSBLOCKS_H\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -5,7 +5,10 @@
 #include <bench/bench.h>
 #include <coins.h>
 #include <policy/policy.h>
+#include <random.h>
 #include <script/signingprovider.h>
+#include <txdb.h>
+#include <util/system.h>
 
 #include <vector>
 
@@ -85,4 +88,58 @@ static void CCoinsCaching(benchmark::State& state)
     }
 }
 
+//! Fills an in-memory coins database and picks the inputs of a block whose
+//! coins are all missing from the cache, as during IBD with a small dbcache.
+struct CoinsDBBenchSetup {
+    CCoinsViewDB db{GetDataDir() / "bench_coins", 8 << 20, true, false};
+    std::vector<COutPoint> inputs;
+
+    CoinsDBBenchSetup(size_t nCoins, size_t nInputs)
+    {
+        FastRandomContext rng(true);
+        std::vector<COutPoint> outpoints;
+        CCoinsViewCache cache(&db);
+        for (size_t i = 0; i < nCoins; i++) {
+            COutPoint outpoint(rng.rand256(), rng.randbits(2));
+            cache.AddCoin(outpoint, Coin(CTxOut(i + 1, CScript() << OP_DUP << OP_HASH160 << std::vector<unsigned char>(20, (unsigned char)i) << OP_EQUALVERIFY << OP_CHECKSIG), i, false), false);
+            outpoints.push_back(outpoint);
+        }
+        cache.SetBestBlock(rng.rand256());
+        bool flushed = cache.Flush();
+        assert(flushed);
+
+        for (size_t i = 0; i < nInputs; i++) {
+            inputs.push_back(outpoints[rng.randrange(outpoints.size())]);
+        }
+    }
+};
+
+static void CCoinsFetchBlockInputs(benchmark::State& state, bool prefetch)
+{
+    CoinsDBBenchSetup setup(100 * 1000, 2000);
+
+    while (state.KeepRunning()) {
+        CCoinsViewCache coins(&setup.db);
+        if (prefetch) {
+            coins.Prefetch(setup.inputs);
+        }
+        for (const COutPoint& input : setup.inputs) {
+            bool found = !coins.AccessCoin(input).IsSpent();
+            assert(found);
+        }
+    }
+}
+
+static void CCoinsLazyFetchBlockInputs(benchmark::State& state)
+{
+    CCoinsFetchBlockInputs(state, false);
+}
+
+static void CCoinsPrefetchBlockInputs(benchmark::State& state)
+{
+    CCoinsFetchBlockInputs(state, true);
+}
+
 BENCHMARK(CCoinsCaching, 170 * 1000);
+BENCHMARK(CCoinsLazyFetchBlockInputs, 20);
+BENCHMARK(CCoinsPrefetchBlockInputs, 20);
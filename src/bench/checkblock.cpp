@@ -9,6 +9,9 @@
 #include <validation.h>
 #include <streams.h>
 #include <consensus/validation.h>
+#include <util/system.h>
+
+#include <boost/thread/thread.hpp>
 
 // These are the two major time-sinks which happen after we have fully received
 // a block off the wire, but before we can relay the block on to peers using
@@ -28,12 +31,31 @@ static void DeserializeBlockTest(benchmark::State& state)
     }
 }
 
-static void DeserializeAndCheckBlockTest(benchmark::State& state)
+// The same, hashing one transaction after the other as they are read
+static void DeserializeBlockSerialHashTest(benchmark::State& state)
 {
     CDataStream stream(benchmark::data::block413567, SER_NETWORK, PROTOCOL_VERSION);
     char a = '\0';
     stream.write(&a, 1); // Prevent compaction
 
+    while (state.KeepRunning()) {
+        CBlockHeader header;
+        std::vector<CTransactionRef> vtx;
+        stream >> header >> vtx;
+        bool rewound = stream.Rewind(benchmark::data::block413567.size());
+        assert(rewound);
+    }
+}
+
+static void DeserializeAndCheckBlock(benchmark::State& state, bool parallel)
+{
+    const bool fParallelBlockChecks = g_parallel_block_checks;
+    g_parallel_block_checks = parallel;
+
+    CDataStream stream(benchmark::data::block413567, SER_NETWORK, PROTOCOL_VERSION);
+    char a = '\0';
+    stream.write(&a, 1); // Prevent compaction
+
     const auto chainParams = CreateChainParams(CBaseChainParams::MAIN);
 
     while (state.KeepRunning()) {
@@ -46,7 +68,31 @@ static void DeserializeAndCheckBlockTest(benchmark::State& state)
         bool checked = CheckBlock(block, validationState, chainParams->GetConsensus());
         assert(checked);
     }
+
+    g_parallel_block_checks = fParallelBlockChecks;
+}
+
+static void DeserializeAndCheckBlockTest(benchmark::State& state)
+{
+    DeserializeAndCheckBlock(state, false);
+}
+
+// The same with the transactions checked on the block check workers
+static void DeserializeAndCheckBlockParallelTest(benchmark::State& state)
+{
+    // the bench setup starts two workers, add one per remaining core
+    boost::thread_group threadGroup;
+    for (int i = 0; i < GetNumCores() - 3; ++i) {
+        threadGroup.create_thread([i]() { return ThreadBlockCheck(i + 2); });
+    }
+
+    DeserializeAndCheckBlock(state, true);
+
+    threadGroup.interrupt_all();
+    threadGroup.join_all();
 }
 
 BENCHMARK(DeserializeBlockTest, 130);
+BENCHMARK(DeserializeBlockSerialHashTest, 130);
 BENCHMARK(DeserializeAndCheckBlockTest, 160);
+BENCHMARK(DeserializeAndCheckBlockParallelTest, 160);
@@ -58,6 +58,23 @@ static void SHA256D64_1024(benchmark::State& state)
     }
 }
 
+// Double SHA256 of 1024 messages of typical transaction sizes
+static void SHA256DMany_1024(benchmark::State& state)
+{
+    std::vector<std::vector<uint8_t>> messages;
+    std::vector<const uint8_t*> inputs;
+    std::vector<size_t> lengths;
+    for (size_t i = 0; i < 1024; ++i) {
+        messages.emplace_back(150 + (i * 37) % 400, 0);
+        inputs.push_back(messages.back().data());
+        lengths.push_back(messages.back().size());
+    }
+    std::vector<uint8_t> out(32 * 1024);
+    while (state.KeepRunning()) {
+        SHA256DMany(out.data(), inputs.data(), lengths.data(), 1024);
+    }
+}
+
 static void SHA512(benchmark::State& state)
 {
     uint8_t hash[CSHA512::OUTPUT_SIZE];
@@ -99,5 +116,6 @@ BENCHMARK(SHA512, 330);
 BENCHMARK(SHA256_32b, 4700 * 1000);
 BENCHMARK(SipHash_32b, 40 * 1000 * 1000);
 BENCHMARK(SHA256D64_1024, 7400);
+BENCHMARK(SHA256DMany_1024, 1000);
 BENCHMARK(FastRandom_32bit, 110 * 1000 * 1000);
 BENCHMARK(FastRandom_1bit, 440 * 1000 * 1000);
@@ -0,0 +1,303 @@
+// Copyright (c) 2019-2020 Xenios SEZC
+// https://www.veriblock.org
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <bench/bench.h>
+
+#include <arith_uint256.h>
+#include <chainparams.h>
+#include <consensus/validation.h>
+#include <pow.h>
+#include <streams.h>
+#include <test/util/mining.h>
+#include <validation.h>
+#include <vbk/merkle.hpp>
+#include <vbk/pop_service.hpp>
+#include <vbk/test/util/endorsements.hpp>
+
+#include <algorithm>
+#include <deque>
+
+namespace {
+
+//! Deterministically mines ALT blocks with PoP payloads on top of the
+//! regtest chain created by the bench runner. Every block contains an ATV
+//! endorsing its parent and an optional number of VTBs.
+struct PopBenchSetup {
+    const CScript coinbase{CScript() << OP_TRUE};
+    const std::vector<uint8_t> payoutInfo{1, 2, 3, 4, 5};
+    altintegration::MockMiner popminer;
+
+    static CBlockIndex* tip()
+    {
+        LOCK(cs_main);
+        return ::ChainActive().Tip();
+    }
+
+    altintegration::PopData createPopData(const CBlockIndex& endorsed, size_t vtbs)
+    {
+        altintegration::PopData popData;
+        for (size_t i = 0; i < vtbs; ++i) {
+            altintegration::BtcBlock::hash_t lastBtc = VeriBlock::getLastKnownBTCBlocks(1)[0];
+            int vbktip = popminer.vbk().getBestChain().tip()->getHeight();
+            popData.vtbs.push_back(VeriBlock::endorseVbkBlock(popminer, vbktip, lastBtc));
+        }
+
+        altintegration::ValidationState state;
+        popData.atvs.push_back(VeriBlock::endorseAltBlock(popminer, endorsed, payoutInfo, state));
+        assert(state.IsValid());
+        return popData;
+    }
+
+    CBlockIndex* mine(size_t blocks, size_t vtbs)
+    {
+        for (size_t i = 0; i < blocks; ++i) {
+            auto popData = createPopData(*tip(), vtbs);
+            {
+                LOCK(cs_main);
+                VeriBlock::GetPop().mempool->submitAll(popData);
+            }
+            MineBlock(coinbase);
+        }
+        return tip();
+    }
+
+    //! Creates two competing forks of `depth` blocks each and returns their tips.
+    std::pair<CBlockIndex*, CBlockIndex*> mineForks(int depth, size_t vtbs)
+    {
+        CBlockIndex* forkPoint = mine(1, 0);
+        CBlockIndex* tipA = mine(depth, vtbs);
+        CBlockIndex* firstA = tipA->GetAncestor(forkPoint->nHeight + 1);
+
+        BlockValidationState state;
+        InvalidateBlock(state, Params(), firstA);
+        ActivateBestChain(state, Params());
+
+        CBlockIndex* tipB = mine(depth, vtbs);
+        {
+            LOCK(cs_main);
+            ResetBlockFailureFlags(firstA);
+        }
+        ActivateBestChain(state, Params());
+        return {tipA, tipB};
+    }
+
+    static CBlock readBlock(const CBlockIndex* index)
+    {
+        CBlock block;
+        bool read = ReadBlockFromDisk(block, index, Params().GetConsensus());
+        assert(read);
+        return block;
+    }
+};
+
+} // namespace
+
+static void PopCheckPopDataATVs(benchmark::State& state)
+{
+    PopBenchSetup setup;
+    altintegration::PopData popData;
+    for (int i = 0; i < 10; ++i) {
+        auto p = setup.createPopData(*setup.tip(), 0);
+        popData.atvs.insert(popData.atvs.end(), p.atvs.begin(), p.atvs.end());
+    }
+
+    while (state.KeepRunning()) {
+        altintegration::ValidationState vstate;
+        bool valid = VeriBlock::popdataStatelessValidation(popData, vstate);
+        assert(valid);
+    }
+}
+
+static void PopCheckPopDataVTBs(benchmark::State& state)
+{
+    PopBenchSetup setup;
+    altintegration::PopData popData = setup.createPopData(*setup.tip(), 10);
+    popData.atvs.clear();
+
+    while (state.KeepRunning()) {
+        altintegration::ValidationState vstate;
+        bool valid = VeriBlock::popdataStatelessValidation(popData, vstate);
+        assert(valid);
+    }
+}
+
+static void PopSetStateFork(benchmark::State& state, int depth)
+{
+    PopBenchSetup setup;
+    auto tips = setup.mineForks(depth, 1);
+    const uint256 hashA = tips.first->GetBlockHash();
+    const uint256 hashB = tips.second->GetBlockHash();
+
+    while (state.KeepRunning()) {
+        LOCK(cs_main);
+        altintegration::ValidationState vstate;
+        bool switched = VeriBlock::setState(hashA, vstate) && VeriBlock::setState(hashB, vstate);
+        assert(switched);
+    }
+}
+
+static void PopSetStateShallowFork(benchmark::State& state)
+{
+    PopSetStateFork(state, 2);
+}
+
+static void PopSetStateDeepFork(benchmark::State& state)
+{
+    PopSetStateFork(state, 20);
+}
+
+static void PopCompareForks(benchmark::State& state)
+{
+    PopBenchSetup setup;
+    auto tips = setup.mineForks(10, 1);
+
+    while (state.KeepRunning()) {
+        LOCK(cs_main);
+        (void)VeriBlock::compareForks(*tips.first, *tips.second);
+    }
+}
+
+static void PopGetPopRewards(benchmark::State& state)
+{
+    PopBenchSetup setup;
+    const auto& alt = *VeriBlock::GetPop().config->alt;
+    const int blocks = std::max<int>(alt.getEndorsementSettlementInterval(), alt.getPopPayoutDelay()) + 1;
+    CBlockIndex* tip = setup.mine(blocks, 0);
+    const auto& consensus = Params().GetConsensus();
+
+    while (state.KeepRunning()) {
+        LOCK(cs_main);
+        auto rewards = VeriBlock::getPopRewards(*tip, consensus);
+        assert(!rewards.empty());
+    }
+}
+
+static void PopTopLevelMerkleRoot(benchmark::State& state)
+{
+    PopBenchSetup setup;
+    CBlockIndex* tip = setup.mine(1, 10);
+    CBlock block = setup.readBlock(tip);
+    assert(!block.popData.empty());
+
+    while (state.KeepRunning()) {
+        LOCK(cs_main);
+        (void)VeriBlock::TopLevelMerkleRoot(tip->pprev, block);
+    }
+}
+
+static void PopDataSerialize(benchmark::State& state)
+{
+    PopBenchSetup setup;
+    altintegration::PopData popData = setup.createPopData(*setup.tip(), 10);
+
+    while (state.KeepRunning()) {
+        CDataStream stream(SER_NETWORK, PROTOCOL_VERSION);
+        stream << popData;
+    }
+}
+
+static void PopDataDeserialize(benchmark::State& state)
+{
+    PopBenchSetup setup;
+    altintegration::PopData popData = setup.createPopData(*setup.tip(), 10);
+    CDataStream stream(SER_NETWORK, PROTOCOL_VERSION);
+    stream << popData;
+    const size_t size = stream.size();
+    char a = '\0';
+    stream.write(&a, 1); // Prevent compaction
+
+    while (state.KeepRunning()) {
+        altintegration::PopData out;
+        stream >> out;
+        bool rewound = stream.Rewind(size);
+        assert(rewound);
+    }
+}
+
+static void PopPayloadsProviderRead(benchmark::State& state)
+{
+    PopBenchSetup setup;
+    CBlockIndex* tip = setup.mine(10, 1);
+
+    // payloads of connected blocks are no longer in the PoP mempool, so
+    // they are served from the database
+    std::vector<altintegration::ATV::id_t> atvids;
+    std::vector<altintegration::VTB::id_t> vtbids;
+    for (CBlockIndex* index = tip; index && atvids.size() < 10; index = index->pprev) {
+        CBlock block = setup.readBlock(index);
+        for (const auto& atv : block.popData.atvs) {
+            atvids.push_back(atv.getId());
+        }
+        for (const auto& vtb : block.popData.vtbs) {
+            vtbids.push_back(vtb.getId());
+        }
+    }
+    assert(!atvids.empty() && !vtbids.empty());
+
+    auto& provider = VeriBlock::GetPayloadsProvider();
+    while (state.KeepRunning()) {
+        altintegration::ValidationState vstate;
+        std::vector<altintegration::ATV> atvs;
+        std::vector<altintegration::VTB> vtbs;
+        bool read = provider.getATVs(atvids, atvs, vstate) && provider.getVTBs(vtbids, vtbs, vstate);
+        assert(read);
+    }
+}
+
+//! Each iteration accepts a run of 100 new headers extending the previous run,
+//! like one headers message during headers-first sync.
+static void PopAcceptBlockHeaders(benchmark::State& state)
+{
+    const size_t headersPerRun = 100;
+    PopBenchSetup setup;
+    const auto& consensus = Params().GetConsensus();
+    const CBlockIndex* tip = setup.tip();
+    const uint32_t nBits = UintToArith256(consensus.powLimit).GetCompact();
+
+    uint256 prevHash = tip->GetBlockHash();
+    // timestamps of the last 11 headers, new headers must be newer than their median
+    std::deque<int64_t> times;
+    for (const CBlockIndex* pindex = tip; pindex && times.size() < 11; pindex = pindex->pprev) {
+        times.push_front(pindex->GetBlockTime());
+    }
+
+    while (state.KeepRunning()) {
+        std::vector<CBlockHeader> headers(headersPerRun);
+        for (auto& header : headers) {
+            std::vector<int64_t> sorted(times.begin(), times.end());
+            std::sort(sorted.begin(), sorted.end());
+
+            header.nVersion = tip->nVersion;
+            header.hashPrevBlock = prevHash;
+            header.nTime = sorted[sorted.size() / 2] + 1;
+            header.nBits = nBits;
+            while (!CheckProofOfWork(header.GetHash(), header.nBits, consensus)) {
+                ++header.nNonce;
+            }
+
+            prevHash = header.GetHash();
+            times.push_back(header.nTime);
+            if (times.size() > 11) {
+                times.pop_front();
+            }
+        }
+
+        BlockValidationState vstate;
+        bool accepted = ProcessNewBlockHeaders(headers, vstate, Params());
+        assert(accepted);
+    }
+}
+
+BENCHMARK(PopCheckPopDataATVs, 50);
+BENCHMARK(PopCheckPopDataVTBs, 50);
+BENCHMARK(PopSetStateShallowFork, 50);
+BENCHMARK(PopSetStateDeepFork, 5);
+BENCHMARK(PopCompareForks, 20);
+BENCHMARK(PopGetPopRewards, 100);
+BENCHMARK(PopTopLevelMerkleRoot, 1000);
+BENCHMARK(PopDataSerialize, 500);
+BENCHMARK(PopDataDeserialize, 200);
+BENCHMARK(PopPayloadsProviderRead, 500);
+BENCHMARK(PopAcceptBlockHeaders, 20);
@@ -0,0 +1,42 @@
+// Copyright (c) 2019-2020 Xenios SEZC
+// https://www.veriblock.org
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <bench/bench.h>
+
+#include <arith_uint256.h>
+#include <chain.h>
+#include <chainparams.h>
+#include <pow.h>
+#include <random.h>
+
+#include <vector>
+
+// Difficulty retarget for every header of a 100k header chain, as done during
+// headers sync. Main net consensus rules, so DGW runs its full 180 block average.
+static void PowDarkGravityWave100kHeaders(benchmark::State& state)
+{
+    const auto chainParams = CreateChainParams(CBaseChainParams::MAIN);
+    const auto& consensus = chainParams->GetConsensus();
+    const arith_uint256 bnPowLimit = UintToArith256(consensus.powLimit);
+
+    FastRandomContext rng(true);
+    std::vector<CBlockIndex> blocks(100000);
+    for (size_t i = 0; i < blocks.size(); i++) {
+        blocks[i].pprev = i ? &blocks[i - 1] : nullptr;
+        blocks[i].nHeight = i;
+        blocks[i].nTime = i ? blocks[i - 1].nTime + rng.randrange(2 * consensus.nPowTargetSpacing) : 1269211443;
+        blocks[i].nBits = (bnPowLimit >> rng.randrange(16)).GetCompact();
+    }
+
+    CBlockHeader header;
+    while (state.KeepRunning()) {
+        for (const CBlockIndex& block : blocks) {
+            header.nTime = block.nTime + consensus.nPowTargetSpacing;
+            (void)DarkGravityWave(&block, &header, consensus);
+        }
+    }
+}
+
+BENCHMARK(PowDarkGravityWave100kHeaders, 1);
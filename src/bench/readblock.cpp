@@ -0,0 +1,114 @@
+// Copyright (c) 2019-2020 Xenios SEZC
+// https://www.veriblock.org
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <bench/bench.h>
+
+#include <blockfilemap.h>
+#include <blockreadahead.h>
+#include <chainparams.h>
+#include <consensus/validation.h>
+#include <random.h>
+#include <test/util/mining.h>
+#include <validation.h>
+
+#include <algorithm>
+
+//! Mines `blocks` blocks on top of the bench chain and returns their positions on disk
+static std::vector<FlatFilePos> MineBlocks(size_t blocks)
+{
+    const CScript coinbase{CScript() << OP_TRUE};
+    for (size_t i = 0; i < blocks; ++i) {
+        MineBlock(coinbase);
+    }
+
+    std::vector<FlatFilePos> positions;
+    LOCK(cs_main);
+    for (const CBlockIndex* pindex = ::ChainActive().Tip(); pindex && pindex->nHeight > 0; pindex = pindex->pprev) {
+        positions.push_back(pindex->GetBlockPos());
+    }
+    std::reverse(positions.begin(), positions.end());
+    return positions;
+}
+
+static void ReadBlocks(benchmark::State& state, size_t maxMappedFiles, bool random)
+{
+    std::vector<FlatFilePos> positions = MineBlocks(200);
+    if (random) {
+        FastRandomContext rng(true);
+        std::shuffle(positions.begin(), positions.end(), rng);
+    }
+
+    SetMaxMappedBlockFiles(maxMappedFiles);
+    const auto& consensus = Params().GetConsensus();
+    while (state.KeepRunning()) {
+        for (const FlatFilePos& pos : positions) {
+            CBlock block;
+            bool read = ReadBlockFromDisk(block, pos, consensus);
+            assert(read);
+        }
+    }
+    SetMaxMappedBlockFiles(DEFAULT_MAX_MAPPED_BLOCK_FILES);
+}
+
+static void ReadBlockSequentialMapped(benchmark::State& state)
+{
+    ReadBlocks(state, DEFAULT_MAX_MAPPED_BLOCK_FILES, false);
+}
+
+static void ReadBlockSequentialStdio(benchmark::State& state)
+{
+    ReadBlocks(state, 0, false);
+}
+
+static void ReadBlockRandomMapped(benchmark::State& state)
+{
+    ReadBlocks(state, DEFAULT_MAX_MAPPED_BLOCK_FILES, true);
+}
+
+static void ReadBlockRandomStdio(benchmark::State& state)
+{
+    ReadBlocks(state, 0, true);
+}
+
+//! Each iteration disconnects the last 50 blocks and connects them again
+//! from disk, like -reindex-chainstate or IBD from blocks that are on disk.
+static void ConnectBlocks(benchmark::State& state, int readAhead)
+{
+    const size_t blocks = 50;
+    MineBlocks(blocks);
+    CBlockIndex* tip = WITH_LOCK(cs_main, return ::ChainActive().Tip());
+    CBlockIndex* first = tip->GetAncestor(tip->nHeight - blocks + 1);
+
+    StartBlockReadAhead(readAhead);
+    while (state.KeepRunning()) {
+        BlockValidationState vstate;
+        bool invalidated = InvalidateBlock(vstate, Params(), first);
+        assert(invalidated);
+        {
+            LOCK(cs_main);
+            ResetBlockFailureFlags(first);
+        }
+        bool activated = ActivateBestChain(vstate, Params());
+        assert(activated && WITH_LOCK(cs_main, return ::ChainActive().Tip()) == tip);
+    }
+    StopBlockReadAhead();
+}
+
+static void ConnectBlocksReadAhead(benchmark::State& state)
+{
+    ConnectBlocks(state, DEFAULT_BLOCK_READAHEAD);
+}
+
+static void ConnectBlocksNoReadAhead(benchmark::State& state)
+{
+    ConnectBlocks(state, 0);
+}
+
+BENCHMARK(ReadBlockSequentialMapped, 20);
+BENCHMARK(ReadBlockSequentialStdio, 20);
+BENCHMARK(ReadBlockRandomMapped, 20);
+BENCHMARK(ReadBlockRandomStdio, 20);
+BENCHMARK(ConnectBlocksReadAhead, 5);
+BENCHMARK(ConnectBlocksNoReadAhead, 5);
@@ -0,0 +1,102 @@
+// Copyright (c) 2019-2020 Xenios SEZC
+// https://www.veriblock.org
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <blockfilemap.h>
+
+#include <logging.h>
+
+#ifndef WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+std::shared_ptr<const MappedBlockFile> MappedBlockFile::Open(const fs::path& path)
+{
+#ifdef WIN32
+    // Not implemented, block files are read through stdio
+    return nullptr;
+#else
+    int fd = open(path.string().c_str(), O_RDONLY);
+    if (fd == -1) {
+        return nullptr;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        close(fd);
+        return nullptr;
+    }
+    const size_t size = st.st_size;
+    void* addr = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    // the mapping stays valid after the descriptor is closed
+    close(fd);
+    if (addr == MAP_FAILED) {
+        LogPrintf("%s: failed to map %s, reading it through stdio\n", __func__, path.string());
+        return nullptr;
+    }
+    return std::shared_ptr<const MappedBlockFile>(new MappedBlockFile(static_cast<const unsigned char*>(addr), size));
+#endif
+}
+
+MappedBlockFile::~MappedBlockFile()
+{
+#ifndef WIN32
+    munmap(const_cast<unsigned char*>(m_data), m_size);
+#endif
+}
+
+std::shared_ptr<const MappedBlockFile> BlockFileMapCache::Get(const fs::path& path, size_t nMinSize)
+{
+    const std::string key = path.string();
+    LOCK(m_mutex);
+    if (m_max_files == 0) {
+        return nullptr;
+    }
+
+    auto it = m_files.begin();
+    while (it != m_files.end() && it->first != key) {
+        ++it;
+    }
+    if (it != m_files.end()) {
+        m_files.splice(m_files.begin(), m_files, it);
+        if (m_files.front().second->size() >= nMinSize) {
+            return m_files.front().second;
+        }
+        // appended to since it was mapped
+        m_files.pop_front();
+    }
+
+    std::shared_ptr<const MappedBlockFile> file = MappedBlockFile::Open(path);
+    if (!file) {
+        return nullptr;
+    }
+    m_files.emplace_front(key, file);
+    Trim();
+    return file->size() >= nMinSize ? file : nullptr;
+}
+
+void BlockFileMapCache::Invalidate(const fs::path& path)
+{
+    const std::string key = path.string();
+    LOCK(m_mutex);
+    m_files.remove_if([&key](const std::pair<std::string, std::shared_ptr<const MappedBlockFile>>& file) {
+        return file.first == key;
+    });
+}
+
+void BlockFileMapCache::SetMaxFiles(size_t nMaxFiles)
+{
+    LOCK(m_mutex);
+    m_max_files = nMaxFiles;
+    Trim();
+}
+
+void BlockFileMapCache::Trim()
+{
+    while (m_files.size() > m_max_files) {
+        m_files.pop_back();
+    }
+}
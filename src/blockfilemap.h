@@ -0,0 +1,75 @@
+// Copyright (c) 2019-2020 Xenios SEZC
+// https://www.veriblock.org
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef PLACEH_BLOCKFILEMAP_H
+#define PLACEH_BLOCKFILEMAP_H
+
+#include <fs.h>
+#include <span.h>
+#include <sync.h>
+
+#include <list>
+#include <memory>
+#include <string>
+#include <utility>
+
+//! -maxmappedblockfiles default, mapping is disabled where address space is scarce
+static const int DEFAULT_MAX_MAPPED_BLOCK_FILES = sizeof(void*) > 4 ? 16 : 0;
+
+/** Read-only memory mapping of a whole block file, unmapped when the last reference goes away. */
+class MappedBlockFile
+{
+public:
+    //! Map the file at its current size, nullptr if it is empty or cannot be mapped
+    static std::shared_ptr<const MappedBlockFile> Open(const fs::path& path);
+
+    ~MappedBlockFile();
+    MappedBlockFile(const MappedBlockFile&) = delete;
+    MappedBlockFile& operator=(const MappedBlockFile&) = delete;
+
+    Span<const unsigned char> data() const { return Span<const unsigned char>(m_data, m_size); }
+    size_t size() const { return m_size; }
+
+private:
+    MappedBlockFile(const unsigned char* data, size_t size) : m_data(data), m_size(size) {}
+
+    const unsigned char* m_data;
+    size_t m_size;
+};
+
+/**
+ * Keeps the most recently read block files memory-mapped, so that block reads
+ * are served from the page cache without opening, seeking and copying through
+ * stdio. Readers hold a reference to the mapping, evicting or invalidating a
+ * file never unmaps it under them.
+ */
+class BlockFileMapCache
+{
+public:
+    explicit BlockFileMapCache(size_t nMaxFiles) : m_max_files(nMaxFiles) {}
+
+    /**
+     * Mapping of the file at `path` covering at least nMinSize bytes. A file
+     * that has grown since it was mapped is mapped again. Returns nullptr if
+     * mapping is disabled or unsupported, or the file is shorter than nMinSize.
+     */
+    std::shared_ptr<const MappedBlockFile> Get(const fs::path& path, size_t nMinSize);
+
+    //! Drop the mapping of a file that is about to be truncated or removed
+    void Invalidate(const fs::path& path);
+
+    //! Change the number of files kept mapped, 0 disables mapping
+    void SetMaxFiles(size_t nMaxFiles);
+
+private:
+    void Trim() EXCLUSIVE_LOCKS_REQUIRED(m_mutex);
+
+    Mutex m_mutex;
+    size_t m_max_files GUARDED_BY(m_mutex);
+    //! most recently used first
+    std::list<std::pair<std::string, std::shared_ptr<const MappedBlockFile>>> m_files GUARDED_BY(m_mutex);
+};
+
+#endif // PLACEH_BLOCKFILEMAP_H
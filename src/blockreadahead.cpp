@@ -0,0 +1,240 @@
+// Copyright (c) 2019-2020 Xenios SEZC
+// https://www.veriblock.org
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <blockreadahead.h>
+
+#include <chain.h>
+#include <chainparams.h>
+#include <logging.h>
+#include <primitives/block.h>
+#include <sync.h>
+#include <util/system.h>
+#include <validation.h>
+#include <vbk/pop_prefetch.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <set>
+#include <thread>
+
+namespace {
+
+struct ReadAheadJob {
+    uint256 hash;
+    int height;
+    FlatFilePos pos;
+};
+
+struct ReadAheadBlock {
+    //! set while the thread reads the block outside of the lock
+    bool reading = false;
+    //! nullptr until read, or if the block could not be read
+    std::shared_ptr<const CBlock> block;
+};
+
+Mutex g_readahead_mutex;
+//! wakes up the read-ahead thread
+std::condition_variable g_readahead_cv;
+//! wakes up TakeReadAheadBlock when a block it waits for is done
+std::condition_variable g_readahead_done_cv;
+std::deque<ReadAheadJob> g_queue GUARDED_BY(g_readahead_mutex);
+//! blocks that are queued, being read or read
+std::map<uint256, ReadAheadBlock> g_blocks GUARDED_BY(g_readahead_mutex);
+bool g_interrupt GUARDED_BY(g_readahead_mutex) = false;
+
+std::thread g_readahead_thread;
+std::atomic<int> g_depth{0};
+std::atomic<uint64_t> g_read_blocks{0};
+std::atomic<uint64_t> g_hits{0};
+std::atomic<uint64_t> g_waits{0};
+std::atomic<uint64_t> g_misses{0};
+
+void ThreadBlockReadAhead()
+{
+    const auto& consensus = Params().GetConsensus();
+    while (true) {
+        ReadAheadJob job;
+        {
+            WAIT_LOCK(g_readahead_mutex, lock);
+            g_readahead_cv.wait(lock, [] { return g_interrupt || !g_queue.empty(); });
+            if (g_interrupt) {
+                return;
+            }
+            job = g_queue.front();
+            g_queue.pop_front();
+            auto it = g_blocks.find(job.hash);
+            if (it == g_blocks.end()) {
+                // connected, taken or dropped while queued
+                continue;
+            }
+            it->second.reading = true;
+        }
+
+        // read and deserialize outside of the lock, ConnectTip only waits for
+        // this block if it gets there before we are done
+        std::shared_ptr<CBlock> block = std::make_shared<CBlock>();
+        if (!ReadBlockFromDisk(*block, job.pos, consensus) || block->GetHash() != job.hash) {
+            LogPrint(BCLog::BENCH, "%s: failed to read block %s\n", __func__, job.hash.ToString());
+            block.reset();
+        }
+        ++g_read_blocks;
+
+        // VeriBlock: the PoP payload cache is fed from here, before ConnectTip
+        // can take the block, instead of reading the block a second time
+        if (block) {
+            VeriBlock::AddPrefetchedPayloads(job.hash, job.height, block->popData);
+        }
+
+        {
+            LOCK(g_readahead_mutex);
+            auto it = g_blocks.find(job.hash);
+            if (it != g_blocks.end()) {
+                it->second.reading = false;
+                it->second.block = std::move(block);
+            }
+        }
+        g_readahead_done_cv.notify_all();
+    }
+}
+
+} // namespace
+
+void StartBlockReadAhead(int depth)
+{
+    StopBlockReadAhead();
+    if (depth <= 0) {
+        return;
+    }
+
+    {
+        LOCK(g_readahead_mutex);
+        g_interrupt = false;
+    }
+    g_depth = std::min(depth, MAX_BLOCK_READAHEAD);
+    g_readahead_thread = std::thread(&TraceThread<std::function<void()>>, "readahead", std::function<void()>(ThreadBlockReadAhead));
+}
+
+void StopBlockReadAhead()
+{
+    g_depth = 0;
+    {
+        LOCK(g_readahead_mutex);
+        g_interrupt = true;
+        g_queue.clear();
+        g_blocks.clear();
+    }
+    g_readahead_cv.notify_all();
+    g_readahead_done_cv.notify_all();
+    if (g_readahead_thread.joinable()) {
+        g_readahead_thread.join();
+    }
+    VeriBlock::ClearPrefetchedPayloads();
+}
+
+int GetBlockReadAheadDepth()
+{
+    return g_depth;
+}
+
+void ScheduleBlockReadAhead(const CBlockIndex* pindexFork, const CBlockIndex* pindexMostWork) EXCLUSIVE_LOCKS_REQUIRED(cs_main)
+{
+    AssertLockHeld(cs_main);
+    const int depth = g_depth;
+    if (depth == 0 || pindexMostWork == nullptr) {
+        return;
+    }
+
+    const int forkHeight = pindexFork ? pindexFork->nHeight : -1;
+    const int targetHeight = std::min(forkHeight + depth, pindexMostWork->nHeight);
+
+    // collected from the top, queued from the bottom so that the next block is read first
+    std::vector<ReadAheadJob> jobs;
+    std::set<uint256> hashes;
+    for (const CBlockIndex* pindex = pindexMostWork->GetAncestor(targetHeight); pindex && pindex->nHeight > forkHeight; pindex = pindex->pprev) {
+        if (pindex->nStatus & BLOCK_HAVE_DATA) {
+            jobs.push_back({pindex->GetBlockHash(), pindex->nHeight, pindex->GetBlockPos()});
+            hashes.insert(jobs.back().hash);
+        }
+    }
+
+    // VeriBlock: payloads of blocks the active chain has passed are not looked up again
+    VeriBlock::EvictPrefetchedPayloads(forkHeight);
+
+    LOCK(g_readahead_mutex);
+    // blocks that are connected already or not on the way to pindexMostWork
+    // would only take up memory, a block the thread is reading is dropped once it is done
+    for (auto it = g_blocks.begin(); it != g_blocks.end();) {
+        it = hashes.count(it->first) ? std::next(it) : g_blocks.erase(it);
+    }
+    bool queued = false;
+    for (auto it = jobs.rbegin(); it != jobs.rend(); ++it) {
+        if (!g_blocks.emplace(it->hash, ReadAheadBlock()).second) {
+            continue;
+        }
+        g_queue.push_back(*it);
+        queued = true;
+    }
+    if (queued) {
+        g_readahead_cv.notify_one();
+    }
+}
+
+std::shared_ptr<const CBlock> TakeReadAheadBlock(const CBlockIndex* pindex)
+{
+    if (g_depth == 0) return nullptr;
+    const uint256 hash = pindex->GetBlockHash();
+
+    WAIT_LOCK(g_readahead_mutex, lock);
+    auto it = g_blocks.find(hash);
+    if (it != g_blocks.end() && it->second.reading) {
+        ++g_waits;
+        g_readahead_done_cv.wait(lock, [&] {
+            it = g_blocks.find(hash);
+            return it == g_blocks.end() || !it->second.reading;
+        });
+    }
+    if (it == g_blocks.end()) {
+        ++g_misses;
+        return nullptr;
+    }
+
+    // a block that is still queued is read by the caller, the thread skips it
+    std::shared_ptr<const CBlock> block = std::move(it->second.block);
+    g_blocks.erase(it);
+    if (block) {
+        ++g_hits;
+    } else {
+        ++g_misses;
+    }
+    return block;
+}
+
+BlockReadAheadStats GetBlockReadAheadStats()
+{
+    BlockReadAheadStats stats;
+    stats.blocks = g_read_blocks;
+    stats.hits = g_hits;
+    stats.waits = g_waits;
+    stats.misses = g_misses;
+
+    LOCK(g_readahead_mutex);
+    stats.cached_blocks = std::count_if(g_blocks.begin(), g_blocks.end(), [](const std::pair<const uint256, ReadAheadBlock>& b) {
+        return b.second.block != nullptr;
+    });
+    return stats;
+}
+
+void ResetBlockReadAheadStats()
+{
+    g_read_blocks = 0;
+    g_hits = 0;
+    g_waits = 0;
+    g_misses = 0;
+}
@@ -0,0 +1,61 @@
+// Copyright (c) 2019-2020 Xenios SEZC
+// https://www.veriblock.org
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef PLACEH_BLOCKREADAHEAD_H
+#define PLACEH_BLOCKREADAHEAD_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+class CBlock;
+class CBlockIndex;
+
+//! -blockreadahead default, number of blocks ahead of the active tip read in the background
+static const int DEFAULT_BLOCK_READAHEAD = 8;
+//! Upper bound for -blockreadahead, every block read ahead is held in memory until it is connected
+static const int MAX_BLOCK_READAHEAD = 128;
+
+struct BlockReadAheadStats {
+    //! blocks read and deserialized by the read-ahead thread
+    uint64_t blocks = 0;
+    //! blocks handed to ConnectTip from the read-ahead cache
+    uint64_t hits = 0;
+    //! of those, blocks ConnectTip had to wait for because they were still being read
+    uint64_t waits = 0;
+    //! blocks ConnectTip read itself
+    uint64_t misses = 0;
+    //! blocks currently read and waiting to be connected
+    size_t cached_blocks = 0;
+};
+
+/**
+ * Start the thread that reads and deserializes the blocks about to be
+ * connected, so that ConnectTip does not wait for the disk while the previous
+ * block is being validated. Does nothing if depth is 0.
+ */
+void StartBlockReadAhead(int depth);
+void StopBlockReadAhead();
+
+//! Read-ahead depth, 0 if the read-ahead thread is not running
+int GetBlockReadAheadDepth();
+
+/**
+ * Queue the next up to depth blocks of the chain from pindexFork to
+ * pindexMostWork that have data, and drop all other blocks read ahead.
+ */
+void ScheduleBlockReadAhead(const CBlockIndex* pindexFork, const CBlockIndex* pindexMostWork);
+
+/**
+ * Remove the block of pindex from the read-ahead cache. Waits for it if it is
+ * being read right now. Returns nullptr if the block was not read ahead, or
+ * could not be read; the caller then reads it itself.
+ */
+std::shared_ptr<const CBlock> TakeReadAheadBlock(const CBlockIndex* pindex);
+
+BlockReadAheadStats GetBlockReadAheadStats();
+void ResetBlockReadAheadStats();
+
+#endif // PLACEH_BLOCKREADAHEAD_H
@@ -5,6 +5,7 @@
 
 #include <boost/algorithm/string.hpp>
 #include <bootstraps.h>
+#include <bootstrapsblocks.h>
 #include <chainparams.h>
 #include <util/strencodings.h>
 #include <vbk/pop_common.hpp>
@@ -23,6 +24,40 @@ static std::vector<std::string> parseBlocks(const std::string& s)
     return strs;
 }
 
+const int testnetVBKstartHeight = 1133113;
+const int testnetBTCstartHeight = 1897492;
+
+/**
+ * Decode headers that are stored back to back in a compile-time generated array.
+ * Every header starts at a constant offset, so no hex decoding is needed.
+ */
+template <typename Block, size_t HeaderSize, size_t N>
+static std::vector<Block> decodeBootstrapBlocks(const unsigned char (&raw)[N])
+{
+    static_assert(N % HeaderSize == 0, "bootstrap blocks have unexpected size");
+    std::vector<Block> blocks;
+    blocks.reserve(N / HeaderSize);
+    for (size_t offset = 0; offset < N; offset += HeaderSize) {
+        altintegration::ReadStream stream(std::vector<uint8_t>(raw + offset, raw + offset + HeaderSize));
+        blocks.push_back(Block::fromRaw(stream));
+    }
+    return blocks;
+}
+
+const std::vector<altintegration::BtcBlock>& testnetBTCblocks()
+{
+    static const std::vector<altintegration::BtcBlock> blocks =
+        decodeBootstrapBlocks<altintegration::BtcBlock, BTC_BOOTSTRAP_HEADER_SIZE>(testnetBTCblocksRaw);
+    return blocks;
+}
+
+const std::vector<altintegration::VbkBlock>& testnetVBKblocks()
+{
+    static const std::vector<altintegration::VbkBlock> blocks =
+        decodeBootstrapBlocks<altintegration::VbkBlock, VBK_BOOTSTRAP_HEADER_SIZE>(testnetVBKblocksRaw);
+    return blocks;
+}
+
 void printConfig(const altintegration::Config& config)
 {
     std::string btclast = config.btc.blocks.empty() ? "<empty>" : config.btc.blocks.rbegin()->getHash().toHex();
@@ -77,7 +112,8 @@ void selectPopConfig(
     if (btcnet == "test") {
         auto param = std::make_shared<altintegration::BtcChainParamsTest>();
         if (popautoconfig) {
-            popconfig.setBTC(testnetBTCstartHeight, testnetBTCblocks, param);
+            popconfig.setBTC(testnetBTCstartHeight, {}, param);
+            popconfig.btc.blocks = testnetBTCblocks();
         } else {
             popconfig.setBTC(btcstart, parseBlocks(btcblocks), param);
         }
@@ -96,7 +132,8 @@ void selectPopConfig(
     if (vbknet == "test") {
         auto param = std::make_shared<altintegration::VbkChainParamsTest>();
         if (popautoconfig) {
-            popconfig.setVBK(testnetVBKstartHeight, testnetVBKblocks, param);
+            popconfig.setVBK(testnetVBKstartHeight, {}, param);
+            popconfig.vbk.blocks = testnetVBKblocks();
         } else {
             popconfig.setVBK(vbkstart, parseBlocks(vbkblocks), param);
         }
@@ -129,4053 +166,3 @@ void selectPopConfig(const ArgsManager& args)
 
     selectPopConfig(btcnet, vbknet, (bool)popautoconfig, btcstart, btcblocks, vbkstart, vbkblocks);
 }
-
-
-
-
-
-
-const int testnetVBKstartHeight=1133113;
-const int testnetBTCstartHeight=1897492;
-
-const std::vector<std::string> testnetBTCblocks = {
-
-"00000020A95B9BC374C5A20CA7F238A16714C0DC9AA656E59D1D77333A00000000000000076A611ABDE3ECD82428B3EAC4445EDA3306FE4E52D12ED4F0AA48E9CA5CD524857AD65F51D9461944EE2DA8",
-"00E0FF3FB7C15B5AE6EA0D0F430F3F827E8B0321B6567D5DC6D5699A1E00000000000000FC5F35CEB5535BB82E69FBB5906C4560684E0D60A0417BD80B7A0C9396810B9D417CD65F51D94619C1C3BCF8",
-"00000020FD521F59547C8DA3280A1B29D86DECAE5A28DAA2EBFE48121A00000000000000D39D4F751DAA8AD715DEF0CD83B32277ABBA69499235F532C647A16029264F3EFE80D65FFFFF001DAD07EB05",
-"0000FF3FC072DDFDD1F17804F83A637ADACCCF97032BE27441DFE3D6C66CDFBE000000002DED246FA0347EE3638F3DAC844530FEFD9DEF52634803339337D489FC31146DA881D65F51D94619C70CD355",
-"0000FF3F2BE57510075C8103F32DF424C749696AA97D4EBC76F814654300000000000000384106417480E379B7EDB228C578B4AC7F75CE4ECC0FA51C45CF4F9BDFA19CC1FD81D65F51D9461948194C35",
-"00E000204105DFBC7899EB8FFF2734D988A42F952FE38D93B5A097692200000000000000F28D7DE0F06CBC180B1741A3052514A5549548A4B917A51E888137D36C82815C8583D65F51D94619818BB706",
-"00E000209ED7CB1294C328886F31AA25FD6FB57DCD5E1C98CE83F2353200000000000000C96F4D8CEA394D2808518CD5B65069A37FB76C3A87CE062C94621BD6A300CA47D283D65F51D94619884B41FD",
-"00E0FF3FAD767FE77B535AFD9E85DD6BAE0C84B312DCA148EE00AC5C4400000000000000C2BE5FB97EE40C1FEB609CF4A2E55B85171F13AA8B50D10794CDA556E9A000530187D65F51D94619A3316B15",
-"0000FF3FE188AFA2A20C55BACE1888CDE3A6E2C85A6461321499101C2F00000000000000F54338400FB36D702531D4B1235C39CB3B8F1E4FB2ADD81F85B34828AA8EEBD0AA8AD65F51D946195F4C37B7",
-"00C0FF3F6A98337D195479106D9F16BF31264AE0ED2FC1C0EA72AA9D3400000000000000907C3C295DD86FBA49433BDE2536A044B2B05F66B8D7ED12EE624DB5431C7ABB5B8ED65F51D946197CC00031",
-"00E000203B3A1805E3F420D22B03F2262C36D30276C7C2424FB36A211F00000000000000C6ED5A81DC0BEE042FE9237091402554B2862E253CC588B1A3F9F994B5E64773118FD65F51D94619C0023C8D",
-"00E0FF3FDA2CABAD4DDE1EDD3CEDC9CFDF9F2815D1EB4A74E506C0FC030000000000000094A0ACA8A5E531837443B2ECCFA50DB9D4B56C27234DF70EEEDD335221313001F292D65F51D94619BF4194AC",
-"00E000200606903511C26C0F2E2E15397224C02C907F88073E26BADC0100000000000000E2D29B9707767D3F7DC2D1933B07642EF006041AD3637FAD5BA8332F78A2B99A3097D65F51D946191D252977",
-"00E00020F975A0F840834486A4B39BFC6649171A92278A52628F93FD1C000000000000000716CE4BC7CD7274ECCD822FEE0B9C40C2539398B445A50673AD64516AB73C54BA97D65F51D94619CE9A47F5",
-"0000FF3F42CE3297AFAA2B5142EB8FB607370B376699997F431EE1203500000000000000A4A011CB56AC9A6102F62573F1067DEF0C693A0844A5FB58B395BC91E1E2B8EE6699D65F51D94619671A7015",
-"000000201270BA7F907B04673DC2DCBB541334D8F9CA563C0F111F870A0000000000000053673EC1168AF3D72082CEEC4F0B0CEE326719E3AEBC474AA0A4A9ABAB34F488169BD65F51D94619DFC8B5BF",
-"00000020368D1AB6BC03DA3671EC21FAA178153582650234E6BAF9151900000000000000E71E78AFC10090D0379B81AB2489AD85C35C834B39017A9B21F7B372E1300A7FD79FD65FFFFF001D40D5EF38",
-"000000208ED5A7CFBB838F755636A3DEAC1AAE758B26DC6165AC1A673A2B1BEF000000004871A4FC6657DB832B7FFDA5D25D0AFDFC3C8CDD9BA7D019C145CDD3D53F8231FCA0D65F51D94619BA6317F0",
-"0000002045A9B978CF59D81C0C5F12AD8281A3ADAB411088E613D7CA090000000000000067382DBC2D0C6F71E13007EF819D187516AF831239E33C09B6BD3B8C01C45A628AA4D65F51D94619149BD82B",
-"000000206D28350EB501CEFF634B600D4A119D0138432705612EF0322B000000000000005E6CBE9067186DA8650A638E637B431E79FE2FBED356314FF5055BE8EC0771243DA9D65FFFFF001D22719BA9",
-"00000020623E6B795C174C510850C2AFDBC3628C0B575B8262D46B7DB366905C000000004DCD739F7221A66F75A9F3B34156177B2345C23DDD0D74EB56491811DF26C88EFFADD65FFFFF001D70789F02",
-"00E0FF3F0E103ECAB9452E3F93CFD27CDD7C90F74E231411ED4EBFD1ADF1B2B600000000AD83635F1EB0F4078E47345EF850909349FF065041811714C0A52AD66DEDAE0860AED65F51D94619B158671D",
-"0000002013FA56046F8650B6644D3E81FE060961B3564821E84F4D7B1400000000000000189405CF38CE758E9C6957E8E28D8C5793C2150F5C9B85B4925E59F768E4B1EE96AFD65F51D946194739F404",
-"00E00020464C257E6481FFEBC39FABFDD090754E577CD1E0D940E60F15000000000000005537420C4CA21101FB99797CB91CBC128D9C0E2368C1D690A3CF7CC7355D6D6BF4B1D65F51D94619F204F21F",
-"00E0FF3FF55111BC7071C31BA7D855058508C058C5A726615D5AECD0240000000000000049076DD913E1F7CC111E36383BA6CDBA5420A2285AC372FA8DDA603C9E0DF92F39B2D65F51D946192C31E83A",
-"000000201F0E5635609971BB4437A80DE881EC85E94E888CB36D22F63C00000000000000D5A6DCD037B29E70552B26D48CF889E4166CF7485C687AC5BC26BF8F7069DE96EBB6D65FFFFF001D29B981A3",
-"00000020A1672B92E1228D8A2031E2108A1F5C5AFFD2383DC8E6CBDA113970E60000000007740BB8809CBE8CD9937013322D7BC07C4AB61BDA4A3BCE62C201915434F5C69DBBD65FFFFF001D35677B70",
-"00E0FF3F54B9C556DC9D37852D63DE5FA3732B8B76F488B1448145E0859A2C2B00000000102B712ACB88F93B44FBAAA477DAB240D35F388B60D72151D94E0AA8383DA546F7BBD65F51D9461977DE4911",
-"000000203DE66592655073B242DA9578BBDB8D367482FA0BDDE8DE2A4100000000000000B95DFD6F4E7AC292CE2C7329BB3B34241D93FFE2F89BFB7887B537160FDCF8BC07BCD65F51D9461950C78E37",
-"000000208D2D611E3F4248E5463834B8AB2441351D5B5357E72AF922250000000000000087C96E03BE10D15FD5000B1DE405333DF52B5F4366F630F55D1804817464F935C9BCD65F51D946196C991747",
-"00E0FF3F21007D16F98C7B74512D96F9A205D0486BF525F0C3154B242100000000000000E22A9637DBC4F591A0556F95FBB5BA614467C6B73EF7663AEEF730B86DCB5741E2BED65F51D94619EF530E82",
-"0000002007EB056BDD6EB78EDE01DA1787C0A71F5636E6B926A01A2D1A0000000000000003E0D6ABD366095704F1106D11CA38B376DDA3B6760588C22CAC133050213C2B96C3D65FFFFF001D18659580",
-"00E0FF3FC870EBC4F94925D31800E6D881EFA17664847AFE9F0B01ECDE740F830000000018274527C4BA993F4F73FE03205A8DCCAA506B25256BFBA77519CF50A3C9B5E92FC6D65F51D94619F562B80A",
-"00000020E6B97DD47FC36040D4A0681DD9920AC2F3E7A36C221DC3FF22000000000000006E0CFA60EAFF69C3C688B1F3DD5686D2F85F881A65AE1401597519F5E8291678E1CAD65FFFFF001D9CA7E062",
-"00E000202712C97F6A400837D8278E73E3F2FC7310207EC62B15115D06F0209C00000000B96236F95654B484615649961446844530F63D6DC51E225CF3EF659D7ACF7C84AFCDD65F51D946195A52CC7A",
-"00E0FF3F8C2E34663A8BED171F02507F15F67045A42602EEAAAEE35D31000000000000009E6FBEAA7B21416D10944E49E0D4DEC2BD09CE2B3122D1428C4AF86732E707D4B0CFD65F51D94619E274E3A4",
-"0000002098A2E1F2ACCD3813C60F39468FB54D93EE75C835FC5D1EC32C00000000000000647F6A4836D28EDC4E02938A2183DEB6ECA242A7BC2A9DB00898C4BC12E70D99BFCFD65F51D946198270CF2B",
-"0000FF3FAEDC424C83BA4A7F7118D792257DD4BCA68AA00A383A1060330000000000000072F48B06B8AF58B1560668F63F352A007136FC6B4B77563B2EC6A6C071A7D71DBAD0D65F51D946191AE1301F",
-"00E0002023A3CF22179568F63152E7CFE093B61C368BD8CB9DC2D6F8190000000000000032FEA396CBBC77A06BB284C56942C50B336ED791BC96CAF913A8B4C19A4DB489E6D0D65F51D946196A22CCBF",
-"000000207EE051C8592970091774AB363D7B42A9EC719F69FBC2FD302D000000000000001E2F3B63545BEFF2C53CE06A34E2C872C288B59807A0B03F7611D09782D8B59FF8D3D65F51D94619B1F55A31",
-"0000FF3F23D9095F48EA85B93D104C16255E4690AAF16680A02406E40D000000000000005BE9DA5CD67126A2820336B9C3B4492057FDA3F8D6A4637222C1252B3D7370BD3AD6D65F51D9461988697B4F",
-"00E0FF3FD0FC9305EE873AEE314248F8E06784F57ED2659E202A23A63600000000000000CC41EBF841961630953069B5989B61077074DBD4CE474C6D67994FA185FBCEA175D7D65F51D9461958CF6D83",
-"00E0FF3F43F60097E3F314F5795FB344A9C4F6D46C21B3AFB1C6B0D701000000000000004D441D38734F40D1AC09AECD8D6A7032050E51E0BE682C4D57F2D35FDEB77CBC92D7D65F51D94619415593C0",
-"00E0FF3F586B4D1DF7318977788F0B66896783EFA3B55A63E933B6BB3F00000000000000668029725FB065E9214CAD00AACA4ED088A080CB2C4232D6DDE1D7168EF24FF319D8D65F51D94619E71AE2D2",
-"00E0FF3FAAC39D2E86453A64C2118235544451074FE16F9801A2A0DD3B00000000000000AF0659FC91783CB13FDC1EA4D5E4F169623ABA1426783801180B6232934B4EE92BD9D65F51D94619B0BB3213",
-"00000020CEFF62F982920951B5E82897C6808AA635739005447EB3D04200000000000000724B9FB1D0206F5B1265BC60E243E29422033545F6118E5B76761CF10561AFA807DED65FFFFF001DF6124516",
-"0000002035FB286288F5A1904DBBAE402B34FB02FDD48806267F8FFD1CC50F4F00000000340A6E8485E0A3A7F94C407EB8D522179C384D0A2D0E59FD0CC9902F474FE5D480E0D65F51D946195A77EF97",
-"00000020E6304B0BFE4D62D69105856DBAC8D65A438020F60A5CBC7F1000000000000000B65F4081825E43237B88D93E51C44F4D290B8769E59C15EA6330D0A6F4168A727DE3D65F51D9461972932991",
-"00E0FF3F882A3D95DF5696F164E29774E9A56D4954B8D86AE226C8563700000000000000CE86C13E1693BB230E12F3B09B51564E626571026F214E4583E76A8631E45855DBE3D65F51D9461999D40DA0",
-"00E000209B726D3A069C8B40A8FDF7598B15B4C295ACD12D2DFBB3172F000000000000008BE46DC2503896D286DBDC8750CA9F8E57276FF9DFFA342B8DA88FB0ECE7C623B9E7D65F51D94619266F4832",
-"00E0FF3FA9B6FB0A092E109356BEF9D92C2261505AEBD286C8D6DB080100000000000000067DEC099FA877D129884BA9FD4AE57256863BBC0D5D9BBA89218C96A01296A2CEE7D65F51D9461914FE8CFC",
-"00E000209BBA8B754D751BC9B339872B465794F3EB1DEC525EFE338F0B000000000000001DFD89B77CD0A65A79CE360C8BE5BE27BB9112F4D075E8ABA8F26AA10BDB76A2A0E8D65F51D94619C4D63577",
-"00000020EB05DC049447BCD0690F0EDE592020B8EEE5F91D1A5FB4722800000000000000064EE619AE90B08F1C382D3B795A203E6EFAC3DB178FEFFC8EF2CC9F728BA1036EEDD65FFFFF001DFEBEDAD6",
-"0000FF3F2204CE662C56F0A35A5D4365D795F142B2F0A7DD582B44E34972C0D20000000069B15A39AC959E706EE40D53DE5DA9E14371FB6853DAF7A3D671CD2AFBA95624DCEDD65F51D94619FF2E3C08",
-"0000FF3F6F83BE54DD8DE27890E62F7BA9C41F20BAEFF9D5285ED09F1B00000000000000E73D6447141EDF004F9D40277F907AA5264EDF8265EB7DF9E6D28A3F58A9035FD0F1D65F51D946196C935A03",
-"00C0FF3F1219764EC2400F9469AB774458711AD94763CCB99C491FE13D000000000000006F634CB4CEB93B9BC221B51AEA65803D76E48E13C6529C71695C6AF9A9FDE6C302F6D65F51D94619914060B0",
-"0000FF3F570216315923A02AB7AADFE7FB4DBA34F5122C7AEFA7D39A3600000000000000169D1B952BD966A794486CB34DAFF3CF5AEC5A3D8494B9F629B8C1978A98D55959F6D65F51D94619FFAF6A50",
-"00000020E31C518547171CB207F2011ED7E1D3BA8E2098C693A18B3B010000000000000016DED69A0DB51A35DC27580BF47ECD5375FB595206A0A6502B33938A59CF00B1D8F6D65F51D946193B4CF092",
-"00E0FF3F828E707E3C1D83430CEA9BCE8768206C29B79FBDB5D6C7C307000000000000006973FF90BB171B103ABF216662128BB23158C55DEF3F57B368B644E95C50324917F7D65F51D94619762EC282",
-"00E0FF3F3A0ECEC9B832D729AECFB3DAFDF347C7BB0C1CA7C1F1DBFA070000000000000091A65C96EFB9E6C1B3B321877BE6DFBE842B2D33F178C42FBC9574B54C03DC4F5BF9D65F51D946199E09518E",
-"00E000206E3E4A8410741DB582A992B3C8BB95B1B9CFBC4FC83230090200000000000000487A3C4FB917AB145D47E6A402D99E9D6A1B1941701D805DB657C019C29F0380CBF9D65F51D946196077976A",
-"000000204FF800EC5328B153B2654371C9E9D4055D1A194E33E110C908000000000000007BC102716DF0250F8D45108FA48B0202BCF8FD9E9B6B10F29F98CB9D152CBB3A52FAD65F51D94619813963DD",
-"000000202629E64FB1861D13DB1B535D8DF44D28E4DA4E71D934FA1C0600000000000000A3E6E66649941738078BF0038BFE4DC25EAB3722B3183FA52B305115AB120FF7E1FAD65F51D94619D5D22BDE",
-"00E0FF3F9F3CAB7BFC236DC6E71177F764A98EBBDE7F0F0809F078BF0900000000000000F43CE985879DF1A6BC30E6421D9BF3592FEE2B15C55D7C39A20A6916764BF98E94FED65F51D946194F36234B",
-"00000020CF7B5812390184B52EDE97AC0557BA54DF84BA52D99AE7E518000000000000008409A8BA9578795EC3913270620EB33919BA48D42644B7316F0300A954A4FDCB57FFD65F51D946196E239BDE",
-"00000020A710A87EEB648C0CF78DE747B58A3C1ECBDE74F91EF56CA81600000000000000D5BB158E67BEE5C249CDB6C46CD66E2FED43A02A548DBFF36A96D09224D11AE92404D75FFFFF001DF7EAD4A9",
-"0000FF3FB889FCB8BF5825883DEFB6E9A3B9A559DFF90C097CBC033FF9AC4F34000000000793D2DF4619716F2182149581FCBA5908310FA5AAAB9B8D37FEB25160288CE48708D75F51D94619E3C96865",
-"00E0FF3F5120FDDAB3BE7A0966DA41936B5D1D1FEB4A78AB8B275E640100000000000000382CFB5CA9E13BC3F1B75D97257DF0D98C5B8416B328097F583803BB4DAC0E21F10AD75F51D94619A99FB002",
-"00000020F13476283EFE886DB78A237D3AEFC467DE60B9889FF8EF674000000000000000CB1B210FB827C209F42349AE4C8BE671C48C3242FC84CEE62201D4AB89586DB2C10BD75F51D946197C628EC0",
-"00E0002047206E6F7F707F2AE426156E094749F3CC91039574072C842100000000000000D26A6AB2EF7FAF27BA98D4A16256F496374EE2EB24C6EFE6C4CE25BDED1FB6D0230DD75F51D94619AA8D0C88",
-"00E0FF3F8D637FFA7EEF42116CA444884989273C818D06C52FFC8A8907000000000000004BDCCF7A7FE2BB35571126576EA2C966704AC320D925361AC09D8B2C57A092CA740ED75F51D946194D99EF2E",
-"000000208C521E3E83C2767644FF49FEE2E9121158A7CD03C42AFFEB450000000000000020DCA890BF2CFD7B3E7156ED7E0D22B7EA954453C919212BCD4720DA78FDDDCC2513D75FFFFF001D9B2D1B5F",
-"000000202CB5D40408B0700D7CE69AD0D623F20AD907D7BD59BE600C6FBED3D700000000CD396250D1EBAA8A673D26273FFF11E7B6DBE5A76F46243AEB249EF2BB2D75E7B513D75F51D94619088F9ABF",
-"00E0FF3FA24CC68657BB807CCDFD8F6BD42AC52F5FFA8B198552E9042300000000000000CA7C4F32D0EE5A3E190680895485FC7BAED342ED7EE74891BFCC20558E10B5F3CD13D75F51D94619CD66586D",
-"00E000204F8CA2EEB1D071FB2DABA3EA1F785333CF8ABE1689C8DC5B410000000000000008E1B67D004F4879A141E9D20A46F1657BCABE623D738BEA52F414032C7D4F91E815D75F51D9461924170C59",
-"00E00020C94BD30BB4F26318D5719FED58AD5808981B7754B1CE965C0D00000000000000AC0DF71C05E345F23C7299EFAB0444C5CCD5595FF6C2C5113C9F2FB2F9A2242DF917D75F51D946198A8831CB",
-"00000020ECDD050DEF9D3B3849E270C4F14AE0975D18F482C0C43FC1230000000000000076B3878A5CE2311EAE517B037CDF0B0C1E22E40D224840F900ABB230ABC6F49C3019D75F51D94619594DF8E3",
-"00000020F451C06A1CEEC1B95CF715C170704EA4276AA4BC0D77F8072500000000000000777030DCFB2C2F02BD6813F77BAA137EA700425347D6DE8134507B34F9C9464B2E1BD75F51D94619F32C5E63",
-"00E0FF3F54A9AEDFC95B24A220EC062004F96D12D89FE41627B766CD17000000000000002CFCD0FD7F590C72273FD08100F453EC55B6405F14432A5A18E39A50635B701C1E1CD75F51D946191E3BB033",
-"0000FF3F12DBF3AEA9E4263B4A741F0B3074F2CD943FF0D98B9BE00D340000000000000074CFE684477D14AE06CCD139B529B83CB4504A9816DC73D764EB0AF3AC38437F9A1DD75F51D946199983B520",
-"000000206C5CEAB43B8AB74509C6BD7BB44E289057C86CA8272F19361A00000000000000C73E110897E82DD02805D3FEA50A5EE2BD7CE7DE0C18C674A0694AD5D29FFA307622D75FFFFF001D9C77F5B4",
-"00E00020231CF5163113961D7828DDC7DF3ABDAD43666ED11569006F1D71DABA0000000076B59FDDB3DEB537C99675EACD58918B4BB1135DE734563571777FF887F658F9DA22D75F51D94619576CE29A",
-"00000020FB229EA95259613F51B0C31D7C700481D2685D9A5ECC07272600000000000000972299FEE0FF2A1DDA887F2EAF59A2C7F0EDA3D5EE97E27DDEBE64EA102B1B618C27D75FFFFF001D2802F2B6",
-"0000FF3FF30369D44D104CADAE3248E5641BD7031ECBEBF443304755B473683D00000000999A147060DC88726C77187B74DFAE353CA7F729D6682490F6742B89068FC986842BD75F51D946192255D18C",
-"0000002037021F10CE9A3A95C766C596478B321B01DE18DBEBA335BE1F00000000000000F2338F2DFCB40C9C5B4D2343FC7569F1D73F6A59EAA8F421B0774A49B04B387C3630D75FFFFF001DB8B05951",
-"00E00020C1A37C6ADE61765A37E68CA101C3099D95228A9ED3471D9F3E038E560000000036DAA0D3CA6A137871645B2DBD50894E4E0DA3A86B10FE8EAC7C1BB1D2F662D8CB33D75F51D946199D83706F",
-"00E00020B43046C326D83B276DB94330519BB1771EB21E11E9B3291C43000000000000002F884DEB5A76020DA2E91708C568195648F5269FC3E2189D4C86877A8FB3C3948834D75F51D946191B1967F8",
-"00000020CD65B49B191E0BDAF80571C2BECACC9DCECF02EC53C948041D00000000000000AB24D7D6BA94CDA8F6971B8DBB217B31071764682056AF5B753BA72579C01C894239D75FFFFF001DB379DEA0",
-"0000FF3F08412BB90DA139E2E23DFB457573F7F8CBAE029881148455DA3ACCBA00000000FC2B3E03A75397E738314A2CADA1379F369845AB644A3D04AE0DBB4503F34CAB6B3AD75F51D94619C9C7AD1A",
-"0000FF3FF0B40118B37C36194CC0F7FDD7580192BA810858A3C56F431C000000000000000DE49F0E3057611324461A392795AECA41C03B6934A4D93D37E4EC716A909CB1B93ED75F51D9461900D07FB4",
-"00000020797A992E7405D5CA575E4179392256CE84C152ED2129A24513000000000000003A073A27978AFE04B671573C5D62901FBF25E77120B12525D866E775835AFD288343D75FFFFF001D66AE36D8",
-"000000202F932D4210D93FF491FCC977C329013AFDAA0160BBC39CCE0FEB0B5000000000EDB175B2161EA0C62F5EC2FE7E67105F1B00CAF0C3B5CBDB46AA15ADE29D602E4F48D75FFFFF001DA0B184D3",
-"00E00020390692888EC6010972EDB49D7BD5199F7089E51A03D9BE55CE77497300000000A83E28E40A5FD29105050476AA4932C7201818E023E1CA88470B2E3939F031CEFC48D75F51D94619A007B685",
-"00000020A0C781988AF199045AEA568647043C64CA7750685DC4BEA814000000000000006577952F2BB1ABEFE50E273100CD6D585DDEA1513569F5230FA076B8900AE240A44BD75F51D94619986EE08D",
-"0000002082A41FEB9BD370B34083C074FB6B96322C18D410A5BA750D4600000000000000F5EE0BA502BFB0A49F30EC0DB45CE09C178E17264F7A9766E4568F81EED4A259D24DD75F51D946195B9DE3D0",
-"00000020E1BDC9525A8FEAF25B5553C84B8D9664EFA83BD66AE0A3C74000000000000000563FBD77FDDB4CA1EB91F2EDBD4356C010754CB9BDD9F78C80E762F706515E53F44DD75F51D94619E1EF718F",
-"00000020F5C54246DC9214EAD11D771913ECA398554C488FF30BF3F14300000000000000BAB89375F62B1818D960F7FFD4EDBFDDF125FE2AF97D30CD7338470C3EC36A22AF4ED75F51D94619F1CE4A7D",
-"000000206A2F551B82FB89F191C029E81C6855D8FD94D6C5807307AA04000000000000005E4601EBE7C3746CCA90E7F481F0A4B7B2C1C0012F26D74ADA09BD44496551379B50D75F51D94619991051EA",
-"000000204001E1944EC23709C3C86F4804BCA96B162B87E3340709EE4400000000000000D2290D7A6E7B99A233B926AA11447F341CBE1D5908C7C4937D8FB2FC3F4F069F4C55D75FFFFF001D24C73E1A",
-"00C0FF3F86C3F09FB9B039C47FB86F442A9AD1FF0E2B4ED227103F446EA4DE4C000000002626AED3EC0C9C67E4B982AC27F9BAE7CE969E2119ACAD6186230E03B563C7C9F655D75F51D94619BE6776AB",
-"00000020256E8DEDF7B2A66C2854475DB752C6FAEDC611FEDC5288821D000000000000003E6B215B6DDF15A48D8E91F95D77A4B472E0E8EB219CB0CE22D185814138491CB05AD75FFFFF001DA7F88EBB",
-"000000204E9772CD779AEE022DEB783A7166D4FDC868CD01D4506C5B360F87B50000000008892E4D31E6EE2DD892EFBE22B69C6B1E8A6DA18B1CB4992DCAF8F553BB742D5B5AD75F51D94619B7A1A033",
-"00000020526630189616396DCBC191812FA83A84E0C8F595E26BDFEE0300000000000000F3EFD8E588A633283E412A493BDD282946D374B5124D325D5CC09034432CF5360D5FD75FFFFF001D1E778224",
-"00E0FF3FC33BD321FE83F21999025B93777EFDF0B211DA67D43B5B7EA0F530AC00000000FF78494F1C028B4C583CABB0E7B935144AECBF2183C2CDCF57A6240AEFB11CE41562D75F51D946191453D3F4",
-"000000206A93D6670D1E4990C99EF5EB4328E742FE993B1C6995DCBB2400000000000000AC0661E0028A959DC812D769BFA29A23F65FADDE8E777E3BA2E04EDC73DCBF57CC66D75FFFFF001DF0812864",
-"00200020D475C910AE9C468D359C0058E3F7F29333E023171C216168AD5C74A600000000FC72AA575E321E382BC4630D8B66562668FEF680059CFC1B25E89E9BF30F9B53A468D75F51D94619065AD804",
-"0000FF3F3E3E9A6CABEC68BC1762061E64C8C795A5BF98819875732C3E000000000000005B79AD6514023A8D52EA32C438540295FA81556F8687B6A8B703E6E59890E8CDCE69D75F51D9461927198537",
-"0000FF3F6E47E82C511954A2A66AD581EE4F5522DFFDD6450E8C43E406000000000000003078CCFC3B269F68BD2CCA67812982F41EBEBD3829414F25352D544F97FFC5EE456ED75F51D94619CB519B1A",
-"00000020FCAEC4482968A3213ED8BF32251C3118D547D1BB620051DD3D00000000000000A9A58A234E6753A7FC690B5FD44A3A181DD2BC7C2D19C7F4DF3AE0551FF7F4EF9F6ED75F51D946190F54C8A1",
-"00000020C1ECD6F646F1B4D3401CC408FACF56B525428D4ABB8C818D350000000000000076D6AA0DAD99375F3C52C560D2BE50FF2FD2D30AA8528C48EA39A95B8AC1D841FB6ED75F51D9461968C5AA42",
-"0000FF3FCA6E8D88F3381A03543021E97CAFAAA715C22471F2B9BA86140000000000000015670566ED2D45973BAB4ECA9490A8577AA4260209F8D09011ACAB8998E48E794270D75F51D94619827CCF30",
-"00000020A5CD5B8788E87E9D8497E87770F27905365CEB841F26E45A31000000000000004DA79E456075BEBC3E98C33C310F0CD206337CB2BC6B617474DAF05E8F914CD2F574D75FFFFF001D72713E14",
-"00E0002087596268BBA49152424836FDF0E39452D304CE4D86B77A457D5D7C49000000006BDA42C3F11CAF8B5D38FB31E8DFB5E8E2E4FEEA09B0D4E1C8B6213900568A3A8E76D75F51D946195289CDB2",
-"0000FF3FDDE0A65AB1A22821FFF1D0F4415D69510CC2DDDDCB0A56061400000000000000EB03EC0B52D1B60D096ADE90B58465554903F8244B988C7740A464A992ECCAE36A77D75F51D94619D2BF9D7F",
-"00E00020F8C74CCA144542B425570FB79A08DC0D9538614E7C1A36D72A0000000000000007F4CF6B51BCD639AD559AA546B4D0319EC9BB7A0D154F47F7C359B45917D6113879D75F51D94619608C50C4",
-"00E0FF3F9FD83ADFA21C2F2351743FAA30240DED69886859EB45DBDB31000000000000008F685D55413B53D608F24F61725A7615CB9CFAE3AF93CF2867E7822CC95D045C277CD75F51D946191799822A",
-"00E000205945CA34DB139758B84E13CC05EA86BB4B4CC35E7FC0B3DA2600000000000000032C54E1C6AD12D04AFDE527BC4A7632201B9FD1D33ABB524A4B01640BA93DEFC17DD75F51D9461919ABE769",
-"00E00020911DF9D6F1C8F0309FF47FC0800B60742A725848F4232C452600000000000000940957C19DDB5E88F34235944E1DE477F9FB5218B3773039ED84B78CCFCAF1468F80D75F51D94619892E208E",
-"0000002009F8F14D9646396A02E6555F828A491F2DA80E9BF4B097300200000000000000EFFCA2F8CE6DA5A54DBB424658B60492C2D208EB35DB69538A4143AFCB9F1B6E4285D75FFFFF001D9B0BEB43",
-"0000002053D76F10896349AA2CB27360E713968A115337BB3F09F29EAF805B7A000000007D156BF9342B4E6EC481E477463F5EE1EFB5451CCA794665CA962C8479A7DB2CF389D75FFFFF001D95679AA8",
-"000000207D8AAB9C07F0CE1FBEC584B04410ABA779830DEB4D2335F9FCA37C5E000000001FEBE72D73467A77712C3B5547FB91C94051206898BA6A7328A835EE16384A56A48ED75FFFFF001D93D54C8D",
-"00E0002082FB98B05148E3F6B750B2E88DE29282390DB29703A1EBE190961BE70000000067FC6B038426041E31F8A1D254373C4940CF5FDAAF326695B7911FF617C423376D8FD75F51D94619685955F3",
-"00000020EEC46DD61F7ED921F49DC8C4B1B747A5E4070769D7505F3B1B00000000000000E67F0DCA65D98F718D0E056D86AA776BB9CB302C1B5994A0EA7F3621987EE2689E91D75F51D94619011A9928",
-"000000205417A9CE3ED9413E492B9636CFAD501B9FFF861C7754FF643E0000000000000031AE29DF25EB9C79175EECF5BC73C9D573324998A51A76A794495B350DE1F841E394D75F51D946193D815712",
-"000000209925925E93DD264CED239172B54440D66D418D15C58BEFBA4200000000000000C5A066441A72E31C489D665621E4F667D64206839CF423BBE62FD6F2A601F8A69599D75FFFFF001D89A8E9A0",
-"0000FF3FF58BB738A08F662531628DB46A71D4A153FCD462FF6024A479AE242400000000DAC21A9E3C7C4DAA1443027B42EFB7AAEDDEDE8DB45614A4CC8DEBFD1F471F5E949DD75F51D94619BEB8C096",
-"00E00020671887FDFA06B5776493918E76BCC2AE01C3DDF319B5C0E926000000000000006D65E761D458E0D2B3241D03F03F2AAEC6522EE990ACE75BA8B5448A8ACFE3F7D79DD75F51D946197EFA1081",
-"0000002051CB59AEB69F19BD41A5A0F2061805B340BB9D6EE5598C8721000000000000005E28D6D420CA370A80170A7420F42C76ECFC44CEFB7C0A4D3FCCCC28EED2861789A2D75FFFFF001D3E05E8FE",
-"00E0FF3FC04E18AEB3234595CAF020D1D6BCE9DF548D82BA4ED901B7E1766991000000006C197667C01AC6D1BC3918AB28911D7FCCD939ED70C3F2F09313B1F6232F440DFAA5D75F51D94619D6A4C1AD",
-"00000020C914672127364EED63099C0DC6221A42E4E867E7502CE2650E00000000000000258366B0EE813F239347493106DFCB8BC9C08B1E411A86D7403BF6F73408CB0795A8D75F51D946199E27EB63",
-"00E000202C73CE17EA26E624D813044EA5BCA9B58FBEE2C668FEC0E60A00000000000000C992514CCD50F8DFE8AF5E419BC8D8DF3FA86ADD8AEA6B224B02C3DA78B95C6FA5A9D75F51D946192296A4C4",
-"0000FF3FBFF5307B12065EDC2CB1AC523280251734C7157CCC89BE053F0000000000000053D565AFDAC7D84D99A0603F3A24943A7D7766B9E4206CB8AFE935CA2E1F833039AAD75F51D94619E9C7E246",
-"00E0FF3FFDB2FA124B6ECC1212C171508BEEF81F2FD2B3D277806ACD1300000000000000A9C92EC97866DA59BB8A7CC1814EB79624AABB07068553DF427B6A5F0C93B006C7AAD75F51D94619593E74A2",
-"000000203318D9FE4D2DC7EA441051D93382A305682D5417BD0F886704000000000000009F31BDE5A37194811662D7ACF4E2E1A718631523641E41935E02D2F93C10495FCDABD75F51D94619721058A4",
-"00E00020C9D68470DD60B884AAE6CEAEAE6A1FDB262096E16ED49C2A080000000000000044D3191740B6D5315FE3BFA6DF223E7F345224C97DFEC4B39146DDCA47741D8FC1ACD75F51D94619CA6FF220",
-"00E0FF3F288475E8D8D334371E9AC60C0964B8605A98DE820521BB922D0000000000000023B2C4913341BB3A23D373ACA83F5C662843510E65F969122BB1C3912CA7294BD8ADD75F51D94619AB933E00",
-"000000201FB2C6B2463E8CF5E145AF076A34104F817996A763A304541600000000000000F0737E6126EF7EE2D94CADC21B91E8954C99769FFE4EB67A8C697E4C4B71C9EF89B2D75FFFFF001D03E1AFB0",
-"00000020B71ADDA7E8AADD3208AF0FE526CFE6258D0488FCAD977734663943B4000000002CD00A5AB4A384ABA4327431E56373D365E196B79D7CE7505B8788EF86DBB7BCC9B2D75F51D946197FB5FE58",
-"00E0FF3F6D75FBE8619297D041757D98C36B28597B0146EDBFC3661E4400000000000000209EC5D93E638BD3FA6BAE3157806B498588654393BB163B7A0D1730D4D88C0649B3D75F51D946191F833E08",
-"000000207294B183F45406BA2239F1AD88338F8B4F183010EC075FC91800000000000000F055E51D89CCBCF8ABE1AC249B43719EDFD5473DE872254A63B3E7382BB2E33F08B7D75F51D946193E55975B",
-"00E0002046CE8D4019C0CB9D4B067A2E9CF5D0982F4A3DFE83561B7324000000000000007C8901E6E7746E8839852E9A4FDA4DE909E8CD1DE8E803A84762CA01A043D52B6BB9D75F51D946194E56A9F0",
-"00E0002062D7968182EEFCA5C197A0639AA44D9D5F4E131C2B86820013000000000000007C7C5567E8C607D9093546B1FACE30476FC3792BA7F1097CBBD0CA2278A29246AFBBD75F51D9461955AE05AC",
-"00000020BD8AE9E08864F605CC4766F7F1F008AC2BF096573AE543B6010000000000000088935DB3645367E112D44FFD58FAD2A189E07ACE572E7BABDEDF6BB19D41A7B66EC0D75FFFFF001DCC7D0C86",
-"00E00020209630390D52F34021EA81813B71ADC7E69AD63BEE82AB5FAB37278F0000000091DD1B1BE91408CDCC3DC9E33DB270A2F53E3AA3E44C0B3FEC739F8EAB21794C8CC0D75F51D94619DFDF50B2",
-"00E00020820ADBC7B18F33F4D48B28E07B0FE37B05E7C7F206764B0834000000000000009C7B94F2C45AF28D43392576530DE75C85CD3524E76871802203019CD612F3B68BC2D75F51D9461901CBAA78",
-"00E0FF3FBB46B017188B6B563F9F1E7E1B0558F7035CA72E978616D71E0000000000000023A4818D4FBACC712D06B333B1816A9231E8B4078EB374DE6A6739FCDBF525229EC5D75F51D94619A5EEAA09",
-"00E0FF3F09D952E529E07239385C0B5ABB8785E3DD29AB23AD6A8D483A00000000000000CE5F42B0C3EC310AD1C1F22AC0D2EA4B554137AC58362CA886BBBDC6AF2E9A7889C6D75F51D94619E209FF26",
-"0000FF3F2E2ACFEF3EFCD676587D4FBB11AE5B914154FF32779F794B26000000000000008AD795969B6F1F5831DE8254D581D084A7D5F0245E90281D9492FCD487407A7181CAD75F51D946198A8CCEA0",
-"0000002019BAA9E59A6336B8369FCF40FB475B02D14E3ED76737DB3528000000000000005EE8B3462335170479D6BCC54433180CDE0F9312D91FE0BCB5B7A69FE67296C753CBD75F51D94619F0E468E7",
-"0000002014C20FBD8C24C8D2F1FBF1B782966D02300E285604C5AF5A1D00000000000000642F9189B44557924004D4A38521F66E485832D22F0CD6177102467CE2B16F846DCDD75F51D9461946D31DAD",
-"00000020666563CAD488E6ADDB8EE8ACE3E7A9D299C3BE8F35B268200400000000000000241B09095AF72EDEC63034E01F2264BB70616709E577E10B70E05F29D4C9086038D2D75FFFFF001D91545868",
-"00E0FF3F0F4BE0FC261A421E843FD4F253AACBBED3C51DAC1F8935A72CA7C5F7000000007BDE802A532ECD83E9B74C3EAC2D3EF85820F77E48BE8CBA6783C28CFFDAA331A8D5D75F51D94619BBA1C237",
-"000000206D6D2D415CEDE23AEA79DEA0866A334B72F89708D7C137B71D0000000000000058C00CA2412164BCCA59DA0092D1E08FE3B8FE6027D22B70670CC954661FCB2872DAD75FFFFF001D4E98ABF9",
-"0400800012BF2D6E4F3C770B5100240783B301B630591D551D1F4FCC41C998B3000000008B81CB909EE67188850AF5CB4BCB5C9FFC08D85B4AA4C24A07F888C0E7ECEA617DDAD75F51D94619216D7E64",
-"00E0FF3F7D7EB000128948D7617685D3380513125446D8E0D8F8F3790100000000000000DFCDB86A2839E29999A3844EEF5F05409829539FB0DB431FC3EAEB58035E235C75DCD75F51D946190A7ACC32",
-"000000201A3D5221CC91A3372C9A441C6B151FCBF26335373142CDE91D00000000000000AA76B4767CFFD354E4C16D67B6DE649C090FFAF9C27F68CABCA20A2F349BAB5E26E1D75FFFFF001D96D43D1E",
-"00E0FF3F94EB54D9BEA005D8486378158CFEAE36B86520FCAFB37327DEE2AC6400000000A03CE8E1370A3EE79E917C8114A33692DBAAF9167F13995EE14E56D194478EFD5DE1D75F51D9461974FD4862",
-"0000FF3F7D7C3473E1F470ED4AFBB9AEEE17EF747F6E2D5F4F6AA8C91A00000000000000D2DCE705B11857990F80620051BAED3A6A48D11C52E1E8FB591BC02D16E831A0F4E2D75F51D946194749F402",
-"00E0002099A3455EC8CC24B453E055DABE9E98BDB5D4D9882E99AD031100000000000000FA7CCE4B043BD2E08C39B26DF7A99EA7C860057ED9784E4040E87D499DBD2D3C91E3D75F51D9461918F004E0",
-"00000020EFBA194A1B8A7C9A21DAC0AD0DF195C1377F9C8EAFE9BF2A1E00000000000000C879958E43C0B304FDADB9AB02582818E2AD503B69863A264EFFBED0EF63899176E5D75F51D9461933E9940B",
-"04004000DC6FBD9ACF222C65338D4AD9981317EF1AE27E756C61A62D1F00000000000000D7E3FB5171BF2AE170B7E5FCC6456D4B80336618A7AF1A5739557FEE458A7E65B3E9D75F51D94619B7261D4F",
-"00000020FD6DE88C2700160FF40821EA2248611D7A1E4020356D98A52C000000000000003503C0E46F3943C3231E50C3ED0D574078D00274A43D94CEB4A274276A86A1F16FEED75FFFFF001D7798EB5C",
-"00E0FF3FF7B670102DBCAF39B54BA6B427C3E1349BCE8D296F54D535003D7B8E000000006989D8E0D65D799E284FA3A2D0954F41C9DC023A43C51806B73DA4A7E4A9072E60EFD75F51D94619D865EEEA",
-"00E0FF3F6D9A3E60A7DEEA870C3570009A82D22B02D20D11758C084310000000000000002F5F28172AD62E2E9DAB3DB113B816F2C1F22978106C9C818E78997A7038CA410BF1D75F51D946195EBE92C4",
-"0000002006444CDD75CB9E214744CC013F8BA508ECEA554EA89E8A252A0000000000000091590A13FE436F0BAFE290CAF0119DB47AC63FB9ACD9FF17469B0DA971DCD53BEEF5D75FFFFF001DEC156383",
-"0000FF3F228AC3C67A66CE8F4975E5AD767131B7E1E1A6F1B43F677BB67561F1000000002662A47159D3034840473CC91BF30CB4618ED52AAA3D8ABC4452EA31E62C6A950CF6D75F51D94619399BA0B0",
-"00E0002084500A66CFC04A685E548C0E9333D930A1B776DB0DA7E0822D00000000000000184E362DCAA40987FEA2A3CEC387984DE63B86C6576A4CE1D280534A36BF595780F9D75F51D94619403EF9E0",
-"00000020DF6117B80BC7B42DB644BF9D3B9BF4514C07C231CE2D10931B00000000000000AF5DF8CF0800B7D59FDFCCCC3FE8288284537EE05EA19B85A0F433F309066BC0BBF9D75F51D94619E9676C99",
-"00000020A220C2C7563DCDC9B354B65A7958EC77C6DBF29B8D51F5D03300000000000000AA57DA6C23B5BCDD99BD1D48D94446D54D101AABF64466FD95A36076F4FEA1488EFED75FFFFF001D259282C1",
-"0000FF3FBA0C281E45E6AB46BA060A4F1735E291F9DCEDC83C75F986DCA4E05C00000000AC45153FAD9412C2E3C9432539A303777CC742043C7958FA655F4D2B96B3D54297FED75F51D9461973BDCF7A",
-"00000020E588B660CA533CD89F995D8EDB902A292171665CC9CC87660E00000000000000EBE4D197381382E203B03CEB0C5F41D7EFAC903BDB48CBCACEE02C063D9B631774FFD75F51D94619E64B1FB0",
-"00E0FF3F2BE79FEA9274342A3D83C64257E89BD4AD489BF03EF01E001C00000000000000AB8F12584424FA8675A5DEF7AB8550DB092756D0BF955F5FD41B0E98BA56E1A7FD02D85F51D9461983DFB7C3",
-"04000000E20BAD734FEC51D8C5D29BBE81DE4ED33CF50C61050B0D3B1600000000000000594F8CB6E861C44E5AEABA7ED2FF9E9E76781654E165507FC761F7079627A31D0E07D85F51D9461953AD0766",
-"00E0002082379D57B1342DF7804ED96DC3097331BDB01E41E28511C7310000000000000012C189FACBA9D7229A3298446217F9728E2C599E952732B744C439B2E2EBCE23D607D85F51D94619A7F701A0",
-"00E0FF3F7A4EADFF7A48925A93138A20646521A8F50BC4DDF19532E50E000000000000002A0039280EF6CBF2402BE5CED73DAB9AA32833EC5D094780FB1442F960CCFD1E7E08D85F51D94619C7AA0448",
-"000000201BD6916EE7C98F001FF5D97CFD9867A610B6033F441A47782D00000000000000773594EC5FBC7D43A3C95C5791A8ED3B4BCAAE2AF4A08E08C5A38F9C1109B6C42E09D85F51D9461970655265",
-"00E000209D58E158F98FA791122DBB56C32E255D2E7F4E2EC697F7611200000000000000D80B0C306E93E67C602D7E59CE6BFC89CBDF8CA9C4DA5453DA30042CF89CF4426C09D85F51D94619D9FED23A",
-"00000020958A50766D4E8B06995F90AD131C1E58FFF6B5A1905D28CA39000000000000009AE059CEE3819B791DE21D46BBFA02509B8840748A8DA922E8F0AEDDC8855EE1170DD85F51D946197550EE31",
-"00000020DC41619436A8E9AAA6F1357606A1C9ED46E88F7F4E5FD79D100000000000000052716E191D942D61C57A79E01A228FC6C76B56E6394F71FDFB08E93E735848FCDD11D85FFFFF001DFA27D4ED",
-"0000002072264120C1A9B9DD1353363F33932570A821779B5AAB86F2CA33E23E0000000065E6D7B994F90F12E8B34349A39BC502BD62BE7646EE9E5175298234C6F1713E9F16D85FFFFF001DF2D240E4",
-"00E000209D06ABB925ACFA4A92F2AC5AD00C9397EBD8DADA53F648A7167FD23100000000E896601C9A98C461D36B8EF38D38A9C3778BD49B6BF77836B06BA95BE3256809CB18D85F51D94619C0E4FCA3",
-"0000FF3F40244279A5D3109D395C07C17E5F3BDFC7EFF49A640B8DD42A00000000000000D7EAFAD45E54AC5A2CEFE9A1A61A5919F801B0CAC919E5DBC7DE6E8D2EFBFDC6EE1AD85F51D94619B1C4867B",
-"00000020CB757BEB4BCA1E434522B1CA20F51AFA6DE5E7DDC5F56AD53E000000000000001907FF3BA56528037892789321236119B530A8309A073629F599FB61E23695C0961BD85F51D94619C08B2FDD",
-"0000002011B3BFE731FE8F417F66D16C89BD40FFCDA99286EC32041145000000000000002587A8F793B971B53A0C02CFD917AFA524AC7440CF09A7EA9E1D1157D7EC23808F1CD85F51D94619B425858E",
-"00000020001B1A07DA446D35D683CE490D009542C453AD0200367C7C2200000000000000486DEFEA9916F6A16F111AA8F07F69275932D32F4EF703115775C2B3DFADEC457421D85FFFFF001DF763152F",
-"00000020CD60AAF5DB797917FEB0A57C40BE44B83AA95EBA3167F529D3B40C9500000000299F9C0728E5763BD2A64659DA42B818DE8A193C8F2CDD01FC73BA83A68477A3AC24D85F51D946190AD6A3DF",
-"000000202C9CEF2C9C95BD56C7ABCB0EE45D6C47C03FD92CDC153B1827000000000000001898EEE6048474DFBF4F5E20A023334F7A3CFFF765F4C9D71219F0EFB0AEACCF5E29D85FFFFF001D16422F74",
-"00E00020904B64CBDFADAD580CF505BCBAB524E5D8204CA1ECD225B53A7B6BF800000000A975FEEFAF33F5A2FD5EE6C92B6342C6FCD99290A5981354639B211A5A9384F0E429D85F51D946192BA4971B",
-"0000002001192A46505D1B1D41D1D0CA8EBBAEE4B757E291B26B4D9A3D00000000000000C0AB0EC4E8EB82000C53F181ACA091106A70C7588DD87DB779D3032CC67BAB4D602AD85F51D946190906EB64",
-"00E000208B45DFDFEB5C0C454D1209EEC348E319401AD60F6D72BC400A00000000000000AE17DA97301FA4ADA5D7279C7548196EB8E881E295CC6BDFD4F896371F9ACCFC772DD85F51D9461952CF8F05",
-"00200020FA22EA3A32672B2A1F9AD88CA18AAE8DDCDEC3D705577C372E00000000000000CD582CEF5DEC61FD0885A9957D042D935C5C2160CD706CDB67CF865AA75E26C04A2ED85F51D94619D2B22237",
-"00000020B95BA9D4957D9FC149130BCC12BD2C68B0A2BEBF1E677BFF3A000000000000000FDEB9DB5C952AF7F47468515E1A821DA6CEA7DCAC3B44C37FD716BBE3C8D974FE32D85FFFFF001DD705ED54",
-"00000020EBC89D985F8C7B4026E40656E648B824AF9AB0C54527F1F285E1E36A00000000D2E81DAD89294F41CB18DB6E6550BF54A980197ED620474179EDBED72C8554C41033D85F51D9461997C40237",
-"000000201E454A91E3961B58E6AA3F23CD263E013796C27AAC6DF8D92C000000000000000A814965D00F3DE9E83F9C6D67F63630CAF6762F6540984E456991E7233C6EA2D737D85FFFFF001D26731F04",
-"00000020DEE692AAB452EE7A0A42021B02B78575B424786009A310FDDC68FE7500000000E9D02E3190D773566245BD9E9C1FCC36E55F38E8C3D6B8B4363AD6A428F42FBB893CD85FFFFF001D8E039425",
-"0400C000493A3115098D6FD5C5CFF3E973D5580A577A18C45E747C43ADC4471400000000287772E9B67DFCA01FF40B909AE85DBC0679C54B8C71DB3F17A4F1CDB8CF57294C3FD85F51D94619BBC71268",
-"00000020E229F3CA0EC1D4D31057A224AA2401A31893AA935E7F85A72A000000000000009F8621EAFB98E9C366DE775B64AABBA7DAD08E5BCC05A6CED87046F73806A1FD4843D85F51D946193ED25025",
-"00000020BACBEAFDD4B4DE935D34F99B75A26C7701C8643589BB40A01C000000000000008B90D18FBB4F4C3FB088A81691837C051263BE31AF055546729C144142E352AFF947D85FFFFF001D1B6A55E6",
-"000000207AF8DB4D02631458B90A9F0E0EF37DB9DD3CDF5EE83DD0C0A3D5D76000000000D9370E8ACEDEBE36B89E4D7D5915A5C17E19C70B484AC0C9D8F17E7FC78594115C48D85F51D94619BF357006",
-"0000002023970465BFA960175371B1E8DD245D7D886A2D6A9331E9B22100000000000000742864968C352FA2264E6E5AFA90EAB56CE532ECAAD8914E8B7932C053BF1526134DD85FFFFF001D5F4AC5AF",
-"00000020470D88F8F3FABFACA4E2C0236A04153FD0DCE33F230E6F656208CB2D0000000073D1EDE5A8A28FD48F8B130BD332FB3385AA242F6F5D2B2D01440972728C3F45AB4DD85F51D94619D37E7840",
-"040080000DF7912269CB10B3B2F168BF2B3753BEDE56DA07EAC3646241000000000000008580B46650AA0F53FB0B47DCCD2BA1B0F1B228318E8FDE3BE630F27049681D2EA54FD85F51D94619B2377960",
-"00E000209656FFC93D68DAA3921B92594EDF96ADC37A07E60596F9C041000000000000009469F8383A2438A565387ACB8C72E73EAE81FF9CA67DF4232A929F357683A8E92B51D85F51D9461983B91C79",
-"0000002005B96216A051EDE09E81F3C226A12411BA8A31FD2E25C0340F00000000000000AB348E4D23D6E325ABF8757E7903D93CC5CEE04E8FEF10BAA18DAE5AD4EAD2BBBC51D85F51D94619F60EEAA7",
-"0020002061DF20198855C7CE523F5EFA1256474289A42789B612CA921300000000000000978270C860936A67A8CF96C444E36FABF8B3495E709E132C4D02A303CD64D9C5F452D85F51D9461935495F76",
-"0000FF3F966644755EA12AF81E82D304BCEA0A897263D6D3891498354400000000000000D52B797C5AF5EA11E0FF42BB6B297D6E4E0E7F062B1915324D5F742C6F4EA64D2855D85F51D94619FD675C58",
-"00E0FF3F0C9CEA6E957C91AE42453975623BBD2A4B9A2CFD20A0848738000000000000001C1CACD85647A521EF440F3C2A15BB6850E3E1C1E4DDC796ECE0B7D3D5A93AA75056D85F51D94619C0AB1A7C",
-"00E000201F61FFC6958C9B0CF690817883A0813BED11425286317D503F00000000000000A2CC92E4F3CBDCC01D590BB67E8ECDDF919F8DD9A41BCA196D0C47B212E6F9537156D85F51D94619CF778739",
-"00E0FF3FDEE4C87779CDBA4CC6DF8823FC55F5E17F8D46F3237A88134300000000000000CD2C2C3C1CDA489D1000850BBC9911B4B9D27AB69E68ED41DD7AC154B5D21D239A58D85F51D94619919C60E5",
-"0000002065018A2B94F37F698AC08F1AF8F113DB18F0615B27BFFA6B1300000000000000C42C3A8C084413D0E1EACB2642EA9BFD95DC41E63A2FEDF388EB175C55214DCC475AD85F51D9461918B9A8B7",
-"00000020E291B440A1FB3D9C39CC5B4E54B971F33D1AB0A3C7A41EF94100000000000000B0EE852A1478638DFA54D371EBBDF7B5C311CC07A4A9F8A0E1676851B7F4B6C9AB5AD85F51D94619D0136918",
-"00E0FF3F17FC46192587947B799866ACCFCFFC50EAD678FE21BDCF5A4500000000000000B1B55070C44DD73F898CA58AD5AF9C31E89E8E748B363BC66D732060F9215FC4D15AD85F51D94619E5DF7731",
-"00E0FF3FA19F152D2DBB06802303C4515E6EF9402711BE455F7DD49F3D00000000000000EFF87B70BE27A32A3FF5DC916931DF10E7C664206C8045B12D4A5F6EC024E21A785BD85F51D94619C127E803",
-"00E0FF3F5FD24323D481C181B4A479C8ABF8F748EB996AFC73020CA02A00000000000000D273C5CA8D06610B120D342627E5D159506337E05EE13F5CD5EFC055C64CE748205CD85F51D94619DE87E43F",
-"00E00020A9B374C4720F939A2E2724D52694D686AF1C0B8471DA7F0F3C000000000000005B17663AFFA88AA7573D688353F43AB432AE95BE5F15BE699177391D792878675A5CD85F51D946194DF09AEF",
-"0000FF3F598D2394D58A82947B005240B7CD2ECF72A86E28B73F1A24040000000000000002D68A9BC9D924EAD21117BCF1B1FC89B3219C9036D0CB7A87480F6B2B0C1B8DA85ED85F51D9461977B96E3C",
-"0000002092CBFA93B9A2994DB29DC276D52E6EBF68889858812085402B0000000000000002C0FF068FE6F50B8F55CBE70385947317C606C1E3A466DB68E1132D87FA285AC460D85F51D9461905BC0191",
-"000000203C5ADECF5C18373C6E9229135F1FCB87353DB8633C04A0202900000000000000F7F5C6FABB5DFA9A22445E35AC6A8D244E1186771FF3443BA57161F5BFB1D150B763D85F51D946192C063EB0",
-"0400400031ED84E169F4DAFD08AC38DA1DBE8605CCFF17646E28C1C3170000000000000099DF84616A469C205F7E6AEE0F1B52CCB5B0C5B3D67C8504176EEDF3D5A0ED967B65D85F51D9461916A4D2B5",
-"000000206A0F9E0DD6B36B9FBA12DE7348BB5314CE450ED1BA9BFC2B190000000000000009F3B6D2FAFDD6763C2A2F922321DB0754507280AA16E2F6FFF5C7C27B417437546AD85FFFFF001D93A906F5",
-"040000005F10EF1A65E576615847EF16B16C8AC5C8DA5C43EB2D2F2FBB3CAFBF000000002398FB01E92B4960A88E37E9576B32FB5E88C98E2A61BA4D23A3862FC825B19B316ED85F51D94619C68DE66D",
-"00000020CF74C577D4481CAC9D05E3261DB733C962567CD13CA96BF61600000000000000C226D44973528133429F9B374EB9854A41CB78DC532D21B5FFF17A43F676B6AEEA72D85FFFFF001DA1369B8D",
-"0000002027E8EDE347C219CF9A3211A22DDE14E5D3A8E132CDBAAAF012C4EF57000000001AD4564E74DEAC1804853C216A8C1ECB2122023CA5A1C2C87DA6C338DB5A6D478674D85F51D9461926046D53",
-"00000020602610B8B2A29511FF4BB2840D07E53F5464B83A8A38DCE434000000000000004F54B8E89533FDF103E32C6DDE8A4DB65CC61C3D9873935E68523989019CBCB94B75D85F51D946190E58B4C2",
-"000000202D1F1B710A5F67A12B646997A2DBAAEC92FC28B6E325C94C180000000000000021ADCA97566792C8EAF5AD00EF363D59EE555834B316661213995FF81031B2BB107AD85FFFFF001D86A5334C",
-"0000002093EADDD2A0B6932A18CA26616A232D0DFDB0A4DF82E8ACB06EC5640B00000000FE8BBB3AD4E7E10E5A61AC8FE1DDF0A8383DA99A7B1E1A8FFA261FAF647D7C81C47ED85FFFFF001D8B1A0EAD",
-"00E00020ABA01BAB87416248827B60CE19B14A7ABB9B6D02207424569A1600FA00000000D9708EFCD4107431E20662ED7DEBCBDF9F3BBB9A54943C48BE5127D6ACED340B8280D85F51D946190A7DC128",
-"000000202320A0A25004F11C2D58ABD3DB60A7209048621A3CEAD4FD0E000000000000008C6F8836F3CF4D666756A6DC678D29E1F70EBC86C7821E9A252F4DC74FA6032A4385D85FFFFF001D85A2821D",
-"04008000987ED70505260A1AE5602E96B9F66A1405F80E588EC2F940F82411FD0000000052AAE0CDAC02E3CAACA5C9F24493E4814B2F31D27B77CF281F7E1BFF69A9259C5785D85F51D94619A9A0051F",
-"000000204B86020A6D30654CE01AB81A0BD6179FFEE8702AD531FFF83D00000000000000597BC019559A74E7D2A29BCA86B7EB73410A198BA84182C7676F09206A26449AE786D85F51D94619ED9A3430",
-"0000002088D4CC3141CCC23CE141D9FF11BB977223375EBBDDE9C0472200000000000000087061C5AB2622D187B3147ECB308EAECBA5102E5435E8614388A7670D1E1128A88BD85FFFFF001D31A48148",
-"00000020C5D321C63D6D897DA03A56F443C6078B15E3A4218FB36621EA730B1B000000001C6095986E62F1DD7B0C4F3721DBC78C55B063E6FA344DE89FB00363B9EC9B045C90D85FFFFF001DE2937D58",
-"000000204849927F8076C9650AAD6FD197F5A0701B9E1141F562548FBEBDBB160000000061961C8E5778A68693A82066674FB5D1146870CCD2C24C0982CB25E5B76BC84F6694D85F51D94619CB7C0881",
-"0000FF3F16140BB88776DE80832FF50A787924733C8C272AE023359D13000000000000004DF5C95D797C744DB34C59257CD527133B7D93C69CA14E0DD0A5E4884744E9D18995D85F51D94619196DC762",
-"00000020A8A5A3610CA6DBE6CF94EF88687C0E787B77E0367BD0D2DE2800000000000000360E9293DB5F7D5F07E3813EFC5F7F9F8C02B609CEC2ABA3216FDF520E1FA9244E9AD85FFFFF001D7062EF6B",
-"00000020D488E74CA328258209832DD92923958C4ABBB835EBFA04F8CFBE7EF900000000F0BBFF61FAA730E56980B50FB38407CA866BBE7758F579E396B135E84F8C6B09149FD85FFFFF001D85CC53A2",
-"00000020C3446E6482512DB26A0F4F46FD3D997CBE573AC6C8833C1604D1450B0000000004B6FAF1E082C829200500EEC9E00B0DB446E10B710FDCE340691A461D4C2189B59FD85F51D946198CA890E8",
-"04008000E03DEEE2F6B91504E9BAC817E4672F19D4A70579E375B0343500000000000000D553CC1EAC0702A93B0CC7E87D77E8E56FC4ABFED94CF07E74ADCA3D5E3E433DF2A0D85F51D946198FF1267D",
-"000000205DE9D18A73FE3E5C0BFA9469475C56A41A4DD1E9462E308943000000000000004901F646613FF80189400D7BB72035BC088E97D5C12CDF37C6CF4546F433C22759A2D85F51D94619FA5B2594",
-"00E0FF3F3480C564DC585179AB1F0D7DB5341C2DFE6D191F3ABABA252900000000000000C6FD664070D3039414A1D4A592FFD029BBA0BD160AF37E48DD2B2D48E9195F1515A4D85F51D94619C8DB0C11",
-"00E0002036307BD5C03B40C3358ED399D21581083CCC3485435C33523F000000000000006D656169A67B985B6A4DDBC976FD012686A07A0F2648AAA28C626FAF24E552869CA4D85F51D94619A29669D3",
-"0000FF3F890B2141926B7347EF46A43E7CDD4FCBD1729DEC839AB5D943000000000000003199CDB99E6EE92875363CF7E685E24E1909D0BD98FF3B0711B2547C011503CB68A6D85F51D9461911548B5F",
-"0000FF3F0A8273024583757FE5A2299A811DEF727C50B397B90DE82139000000000000000E0D4BC4A23DE13A0D2A16FC865D20DC186D80FE54ACBA8040F69B53ADE4A4CC51A8D85F51D9461932F2A7E1",
-"00E0FF3F0DFA841A53BE22026CAFF7BFB40A89AA26304BB08AAD770207000000000000008CA7D03406A314DB60B44921F010B86CE680129CCC6C9BE1BE460FC0A3FBDC9A7BA8D85F51D94619659B7F7B",
-"00000020C324743C7E4509747CD11CFDCD1F2853AFAF80D58A82AC903900000000000000769E44B43EECA23560A1DFF9C5929C7DA778175C58988D0D7709B70F13DBD38557A9D85F51D94619A8852EDD",
-"00000020FE1B87F1A9F2D310D87FEF3E119545F6F4FAE8F199C594E62B0000000000000041A4B727B3A39A1B45323A2E5058CF2E901863BDEFA1949326F65EB22D751C99D6ACD85F51D94619044A8517",
-"00E0002000CD7AE4D93E182E6DF3E456CDEB4079E4312804F170AEF61B00000000000000CA37772F045311C1DE2C676986E0B6E7EF33CA859D71E432DDC1B9694139C94DF5ACD85F51D946197195FA73",
-"000000208FB1D87FCF4738F646143FB560FBC8E6925E5EF9A3B4B2CB1D00000000000000602A0DAE456CC70508006D6918F4E8FF2618A23655FF52510DFEF7616D32AF8EA9B1D85FFFFF001D1DD990D7",
-"00000020E67D1D9020F7F8BB2A873F94B9A6D413068DA5A924C71EE6AC09CA6400000000C25E568DA0E1AC8E9D4F2BE74F207AA3ABD61557F6410D5727DD5C1404DD626C20B4D85F51D94619C7544234",
-"0000FF3F3542E80202EC38937E34D0B0F6D10F5ADA960FAB573898F504000000000000002500DB376E6B9E3969D6AD413FF90F4B04E86756A09BC5C292D1C096E6D3DDCA3AB8D85F51D94619739B6AEB",
-"0000FF3F08128A45AE9E5944A807FDCA693981F3C61CDFEA1DAB0EC83000000000000000C88CC06F1148149DD217CBD5880F86E4BAC979506BC3C3B3F3462AAFE3BAB03D2CB9D85F51D9461973AC3FE4",
-"0000002049B2247410C8FF8DB58CD08A6352C9AA523363ECBE10BA2212000000000000001C81E8008E61592F6E538DB247872750E9FABB955E213F30081ECF875B3AFE00F9BDD85FFFFF001D3ABDDF59",
-"0400C00022741C511CD94FBC02320A406EA45AE3F97E2C846E0B221CA25F03910000000025DB2781E9534CC970D704AB1E00EFAB4B03A72AD10F86F88C1BBBB05D49B53B48BED85F51D94619B35B4E97",
-"0000002054D9ABFA14AF98433F6A732F6C8D51DD90A3BFADBA8FDB263B000000000000005741C4BD2180F2CC9568E97391F081D8F7A205639BF5570F69D1D052411B334454C2D85F51D94619AB99DC05",
-"000000207283CEEDC0B5D51EEAC010CC928B76996191FABFBBF2F7401600000000000000E02B61FF16B14C3B9F17D2F908F87053EF92DE83AF7EB41BB648D5702245D81F92C3D85F51D9461904713E03",
-"00000020BEC4F4B2EBFD9820A1DC7B2F58C1D1361996216C31F15B53160000000000000077AFB4BCA632C461830EE2FF249093698369B8AC27713B978A361B3D40127A8050C6D85F51D946190A34FD87",
-"0000002013785ED0625D40A0CC74B0072419C932E5B4A18E01833D0A140000000000000078EABE4D2F31033BB5A35FC502BF7E9C4605FF2483715DCEF8608EC03FADE5E973C8D85F51D94619A78384CC",
-"0000FF3FED4E782023D3A2C7EEA431BA54E29CFA69604ED28B496CF83B000000000000008684821A54F0812271A831A96535A5557C88F830A00EDF72CB39DB2EA61F63F523CAD85F51D9461951749D93",
-"0400000084A699760BCE4F809D1578A63292C4CE00184A5E0C8052613C000000000000008F00422EA133D8A0B67A0B3E0B8743EF71E74CC386024B51B0135485D0098E1917CDD85F51D9461908637A21",
-"00000020053E1F0AB50DF3EB99E6DCCC5DAA0B2BBF06AD1B55C2993E0E000000000000001220C8BC07023EBF9BF392E9DE5E940A3A8FD175A5D7FE5B189174E9CA782FB0C8D1D85FFFFF001DA3E69E19",
-"0000002081EFF0CDB348CD9CDEBE1F9D966096FB9279436A39DB9DE13FF581B0000000000564C81EDC2811E6AFC41EDF3ED82692D59592A060AC37E52F67D44237868D6118D4D85F51D9461994454007",
-"00E0FF3FBF0B93B1DC0583D6EC68CCFA193FB927EDF8F8B38997A5F0100000000000000046D0DEF2FE8088BB29CAB97F6CDA3036C8B0364B08D87F3BA3B65A4B35F17C7969D4D85F51D94619D12BAA99",
-"00000020E9429F56EA2D3EB1B6A0B9C07F8346C645293136EDFBD5604400000000000000D56D4EC9BFB450C034BAF46374DCB916C6623374B076F17E97D23F26F43DC2A83FD9D85FFFFF001D9D1C9D99",
-"040000005BCA9D7DC57EE9DE9D5F38DA30E1D18BD0ED942EE6009165CBB0A82E000000004243EACC3E2324926D242C023F384ACE426F952A74063772795D4444F1F5424C1ADCD85F51D94619B411C742",
-"0000FF3FC73C329E29C5DEF6F0AD02F3AE0EB1D54A164848D83F828E3300000000000000ECFD97B9A2B6B565569278108A773C421CCF9BB1521CBBFF9E9BD1171FEDCBBBF7DCD85F51D946196F3D61EB",
-"00000020E399185EBEA5B5DBD41C2D5B9C46D0D78DFBE338F6E7AB0540000000000000009CAA65B7D0BE010A7091B2EE1E0996C205030671089294CB60ACF61497DAF2FAA8E1D85FFFFF001D38D31085",
-"0000FF3FB2B7E6A764B786DC88A2F5C2DCAF8AF472A1FA6812F5F5C784FA8487000000005744B20600AF259B58E9792BB6DF1C002B8AD86855C15109251577219AA3B06F2AE3D85F51D94619A8015BAD",
-"00000020ABB97A495A9B4C89452C1792EC2248D98BD241C762D36D3706000000000000007CAF8F02BB42857F68CE1A45A6E47B4A343C40DE42020D782C8369DC48B4300203E8D85FFFFF001D39D064B3",
-"000000202E99DFC9E366151399380CAE58440785CCADC0B86FE0F945740F63D1000000002ED5075EA350ECBD99066EF9CC26A762AC925E7D6941AA2CF50905CF0E6A8CF9B4ECD85FFFFF001D5282E2E4",
-"000000203E76E9EBB2C1C27A635F312DA296B419E79FBF48631BD81C6E477FBF00000000D1A184F77DA68B3207228BBA42F4B01978FCEF4C5CFD22496C04C9B98DACD0FB66F1D85FFFFF001D46C1F6FF",
-"00000020DA655F95FE609843D0A2E2A5E17BC515AC9A714939E2995BE436CE500000000005DEEEB156F185BBBCF0F4606E550D4F723A3B5412ADA3A372DA9207DCF772A72EF2D85F51D94619D2377727",
-"04008000C9DC4B482CDDFC0C20C0F6BD8FC912157DB51C9F29A5CE6615000000000000003DEB09EFDCCC7E9470A2177C7D3A278CBC1C19E9DFE7C7CAEFBB53A794BE406558F4D85F51D946198542B70B",
-"00000020A3DCD4B637D6E7B823C1CE12D7D93078FA13A46443D6CA2A190000000000000031BC06D5D2CF7A1DC84355077790F3BC9795CF55821B33BF9F60DD88AACAB6AA9DF5D85F51D94619AF2F5265",
-"000000202BC061E55F777256EE86CE8A958D480152E26CD42E69DE1F43000000000000002E786982687005C28B78E8FBE2FF0A99B02AD3971381299CAC0626FDC9A11575D0F8D85F51D94619CD34E5D7",
-"00E00020FB0EC32FD1B4173096009D3B7DB4EF9C077D4B0B1D8D3DE81F00000000000000E4E6837F1C0601669C5E3AF8E2BA143D6055B57EA5E7CE7C686C0CDD2C02F52AC9F9D85F51D9461919E1E7C8",
-"00E0FF3FFEE68A9A385F5E1BCB1AFA087735831B9EA899A2EC1FB2C74400000000000000BAA743A4EF611D9E8A0122DBCA40FA3EDB66D7A1256766CFF5DD5F3C282A24E06FFBD85F51D9461965D8E0FB",
-"00000020917ED1507C5BA3CFB3AD9DF29D18E8AF637CA541BC4EC69A2C00000000000000A92B432900FBD9BAA7289532B551A652041562690F229CCFE6E7C461E50FCCE44900D95FFFFF001DE0B43D21",
-"0000002014F6A226545A3DE2AEA46FFF83B556C568DF53004BF8C6DA8C7511D700000000975D891A0E0324D7B3AF031FA0E0F2F26C46631B33FEA520527BE02CA300BF61D300D95F51D94619997809C0",
-"000000201791678FF5F3DF33A372B7EA9CD0C307554D30CBFC1D863A2400000000000000F92A036CBF57FE020A07A1AB05899BFF008F49E3A269A3A349C4EADCC95EAFDC1D01D95F51D94619953CE86E",
-"000000202AF8ACBB08380CD8BAC3487EC9F9120DDDEAE8F95BD9C6C50000000000000000080890F4BD5C880227B3A84910D6F71758BC3E98AA50C3E8CFE5233DB0A21C526102D95F51D9461966B6E9AE",
-"00000020DE24D502A0ED7F9D4D911ADD0811B5878340C249404EF0190C0000000000000062655E768ED720C1C5EBFE6C9F243C231107AFD48ECD404CB29073DD55D837B02407D95FFFFF001D49C02DB7",
-"00E0FF3FF5D20CD68D52AA8A6E001280FF1FE36E96121A15E9F6EDF3DC0F3D6F0000000057234FF3AEB4D6813B2205DF140E2E7119A7C889A42BB171CB99DFA8DAFAC8E60C08D95F51D94619779B5453",
-"00000020ACACF6945F95859807005A725D9ADA3BCCFAB8BB1B3ED4333A00000000000000A3593C9E37C7DC1BAC411D15183AADD6E10C339B89033DE80A8901E8A53A6C825909D95F51D946199994F043",
-"00E0FF3FDF47B20FB02A7D731B3C9024B105F09E13AF1E4C94F4E51B3E000000000000001EED3444ACD2BC1DAF36A0C79AE6D4AD10DD81E142C63CCBA3738D4D29A9B9600F0AD95F51D94619B25D23E5",
-"000000208279B5FA8ED0CE56E0EB0AB9E7A6B9F5186E41FBDB1BC21D3D000000000000003A35DB1C8A318C789CB8488397859EAEB3E70EE4212DDB341DF13708A10BDF6D470AD95F51D94619DB2EF130",
-"000000200800E8EFF2106C0F5CCCD3E85F7D8F7B15026336CD5577722F00000000000000B2F366CB99808098BE9EC37EDF3EFE88A318CD552F95F37C829282AD7D7C0B91F80ED95FFFFF001D48DFE215",
-"0000FF3FA6F394B9160B7B43F158B47192B0CCA0710803E86C4B40758FC4AC96000000009A394234B08FB670A380AD8FC063F51E1392CA2EDA9BA80752A6659820497B167E12D95F51D94619CFCE3B7F",
-"00000020CEBE14D00CC4978B9819341AC7ECA9D9E4248B72886DDDBE1C000000000000001D2ED471A6E635CA405C928C36C9ADF2C418BF042054756BD50E165CD1C5315E3C17D95FFFFF001D4F14CC69",
-"0000FF3F494D95E56DE2B247B4CD8E4C4548EFA11A6417B1928DC41E0A06535600000000346ED9511C8C0B9DA0FA2CDD59BE74F8FAD92483876901731E00C46E9930AA843B17D95F51D946194365A9C6",
-"000000205BA75B21E8B7682FCF28C2F00B9C67967655E9F4E27451F72700000000000000D30C408399068E218315AC6BDD49BD09F525094F7AA5D42D4B1F7705FA3F0EFDEE1BD95FFFFF001DBC13936B",
-"00000020D3548DB3572099D9270259EFECC4F779C341CD6E27D08D4B14E76F61000000009697C1F2AD1338EFF964D9B6A68E6DC9C4E88E1CF0BC563C061DC1E62B54FD3CA520D95FFFFF001D8D1CBBDF",
-"00E0FF3F948E7B4565CCB9934CA78B24B3912C9FB34BF6252C00509CCF74ED5A000000009DE84C4F1020942A9E8809F4FBF409D4982480EE74E39205081C38AC2A8603565C21D95F51D9461959392536",
-"000000202AC4FF138F077FBDBFAA820AEB5F3B14F153840E618C20E73800000000000000306EB806EF71C41D15B9236A79260F1954E298B1D1B70AD5227EA94081C25152DE21D95F51D946190A465A93",
-"00E0002079BD5EB40F7E09C1EF1A0EB0377165F1AE0606AE78280EAD080000000000000045B70418FD9CCF43FBFCBC8167A34812E77A4D756FADFB01C24AE8757E8B3A0C8C24D95F51D9461981864203",
-"00E0FF3F3C62A4B4FD9328C0DC99BFA853C0BFE2852F2CB24053DC371400000000000000BFFE889A4FADCC0B297F0EC17EA6A84D31CFE839EEC5D1B274D747AB341EFCABD325D95F51D946195E5170A0",
-"00E0FF3F1A4B77D3487DA591215FC59108B538388C3FBCB7B5B7CEE125000000000000009ADD22087601F173A333DB3FC0A672A393A17A4B656E313BC40592F127E7DF977527D95F51D9461904F27A94",
-"0000FF3F37EF46C182EF574ED0421D0A0259D5050741B368E25565D342000000000000003C3AA7489F9E81294E7E0CBE1CBA9C05C00376E280CB99740DAC994424E0232B9828D95F51D94619C138CA1C",
-"0000FF3FBD60D6756FD84EFE2611945AE951502D2814467D1F38EF6C0900000000000000D58847E32CDA421BF5EC5047080268ABD09D1E90830DD232AD8FECEFD9387F60412AD95F51D946198411B4DE",
-"00E00020982CCF62FA703A900B8BBFBCCE875FC8DDC3059D6CA201410100000000000000E9DC9AC1A5DD718EF64022E3CC945A9DC49652F1AD39996604CF0F6CC26F4A051F2CD95F51D94619ABF06491",
-"000000200D0C0164C2ECE3321C062BEF9EE354DE3A868B9B02E58BE73600000000000000A1A951C10B39405A18837BE59599F5F7D900B0FC9805A1250936842F05574E6EC42DD95F51D9461935C7CAA7",
-"0400C000AFCD70B44ACB84B8F80FCCB58B14B9F78306364862D2E0C12200000000000000F3DCD713F20920F309BEB1E7CF40DF327ED6A0B228332F3C90A85DBAC342F7BED02FD95F51D94619B41E648B",
-"0000FF3FE64BEB85FCDBC4C73DF6F8E4E5BE1672BAC69F60019A29BB1500000000000000152D0A1715B3898B167B538DC4DCF0BB81F281F7E03A64AD8A6FC82F048C10EF8832D95F51D94619431945A9",
-"00000020D8633676E04E487CCE2CDD3C07495FAA1E0B7AAE13F0B72F2200000000000000534384DB19CBAB6CDF720E53C1B1F02D65E798F66A21661D12EE1502ACF2375E4333D95F51D946196F37D55B",
-"00000020B5C575E7D8D47DEC575BCEAA2AA87390D772C00D4D9B527E3A00000000000000CDBBA0542A6C9372367558A06B9F3CAA798311D651AFCFFFE81E97D2E34643048236D95F51D94619EEDC3589",
-"00000020FD9FEA40DBAFE294C4B8B10D84D9B39532F65759D0B0B58710000000000000003FD4B69788434D8A3D6A27760061777060EA83F3BA8246ED65B48555D931609C0137D95F51D94619CCF1E267",
-"0400C000E833B2545E71F393790DFA66CDB6452134542031F1908B461A000000000000000E710DF6C6EE27E41CC8287BAF5B0580497190A2864499B4B752FE3E1B2DEF4A6537D95F51D94619CBD442D8",
-"00E00020818EC6E3FCD5BAB52986FF581A22A910241A9177114FF3B4100000000000000073A898202ADE1EA2F087F294DDCF7BC24E29B5A8EDF45ED1BC11C9929C9876FCA038D95F51D9461982268994",
-"00E0002017CE42FA36E228271E122878E7F57D5EB45B9B11DEF953451300000000000000C6C7C7511AE574D5EF044074E4F93706A405722F16D6829A5D03EAD20A2EFF93EB3AD95F51D94619F24129C0",
-"00E00020F1130F6B852C5558AB1BDC5251FEE2534565532342CA90441800000000000000BDE7D3B01DBF76416C1E040660D5593AA05D1BD9E2F1BAABC102B7E023402CEBAC3CD95F51D946198D1CF6FD",
-"00E0FF3F3C4EC1D40EBD530F6D7B7F109B6ECEC7B8399F245B0475FD1500000000000000468202DE813893A5A8AF58F6A708E9CDB9FD64FE5C77752260AD766159E61C0A653DD95F51D94619CD52F64A",
-"00E000204C562EDBA579A6D18F43D811392308288AFF2564310CF22D46000000000000006779F604311E83E4D0E9836234E455539AFA4A6DBB1452A2D295FBC332E08177283ED95F51D94619D2BB4E20",
-"04008000B3640B7C490469D2BAFDCC77C93700F7003C70E0DCACD56D3E000000000000006FCE4D22FC3E6EF8FC38B877F50ADCACDEC7AA2D8BA8F5520F1A71D98D8E62741540D95F51D9461911D81145",
-"00E0FF3F9886510774FA6D63AACA377B4849620FE676A1A521922D2F4400000000000000387F175607E85CC1CDF21406D2AE6365A983EC6C88ACADE60D98E1F62A307F5DFD40D95F51D94619454CADC0",
-"0000FF3FC1F36E3CDEE6C984375732AD1B45B363CBBB385828E8F7491D000000000000005FAEFF4A45F96AC385C5DDD61A450C0FF9088EEEB90BDB51D80BEACA35744AC99943D95F51D9461931717C26",
-"0000FF3FC0377DBE78CF64579AA2E62701C4244728D48DD0E37A46683500000000000000A28341E3CAB423527346083AB20817A06548457EA6A7DB6FBBFF18E56E336A6BA245D95F51D946191A0D05BB",
-"0000002051C00B749A40B1A213B273BA6A1DF85A6F60EAB33740FEC91C00000000000000A51B285014D172D8DD9EE23F32BA0B5C77C273CBA0F46687105E0A9441BDF7083447D95F51D946192E49F643",
-"00000020328E37F0D1835867D0626D5B8BD312125E86473D9C9A5331290000000000000012104265A69EDC4333A6148E97B7B64CAF0E8CCA9EE5DCB5449E2F38DEE886EDE64BD95FFFFF001D8CBFF0EE",
-"00000020815C4BD295AD5625B020B996BCED9E639E4DBFCB6C2FE505914A59B200000000247625D89A5A7FF688CE73B674F629F791C269CBBD20D7378BFF30EE0169D30C484CD95F51D94619AEE52DA6",
-"00000020E869D75A3EAF9F21BCFC4313AF7FA04355EEAD2772A11B3B30000000000000006408992DFD0A241998C016708EA9D6E886F07C7EE22D299F3F2B831120C25E69CE4ED95F51D9461927261471",
-"00E00020900FC0BA87416B60C692B2F467EF93EE245CF537262B6C253C00000000000000713BCF9DC10EB5FE4A69E95FEB15D3DCAD90B4D89B30E11FBE857DD3711B45527250D95F51D9461956F7425C",
-"00000020AC5959DFCDF11868DE8B1385032C13B3CF6D9AABA11EA1CA0400000000000000E2365065630D26A76AFB1AD530601A5808450F5FEB2E1A2D54C1FE4D2B26C75AEE53D95F51D94619B344565D",
-"0000002062D5810EE2F5646CE7D5936F84B16CFA5CBE6657E0914B8A1700000000000000D5C3E04932EF2193F049A01E48078023E992402FBEB5D68D21612AE2FDEF78BEA558D95FFFFF001D10C4ADB1",
-"0400C000497FF092AF4ADA47DFAB8CEEFB3D962BA7537B9463BF8AADE2C68F1600000000C98DA59BDFCA3FA4AF062614E2580689AFEBFEDCEF6BFD70A0AC182A9100415D3D58D95F51D94619B70D5687",
-"000000203904549C84F2FC475E998BD871F7188F3074B81A16B87F7B43000000000000006EA6D458E74587F87A8038D30CB2D91F8254E092F295AE8CB3A60681A9A2A71CFE5CD95FFFFF001D0FE282F3",
-"000000205D280D1F8AC4194150054B69D2692B17CB8C0F9EDFBB0BCE87937B2300000000ED83CF3289CB4F7E04B5C21AA082E17547E0A1E82224F266376FCEA342D6798CCA61D95FFFFF001DA361C1E9",
-"00E000203D5D2D9AFDF8059CA6F7D0A8FDA19B4CAA53ADF6D89EC4F08EB052E400000000A5BEEAE46F64CB471A1EED496C7B768C5411873C093A2B9DA2B5EE563F7563DEC063D95F51D94619979A86FC",
-"000000202D5178B8C68E58689CEF045F86FCE977D1BDB8754A742B404400000000000000D2D379ADA296FE6D27B076D49BB66D0DE7F6BB673F5A10B63DC2434FCAF170C08668D95FFFFF001D2935B4AB",
-"000000201F7C91EC52F483EDC7206B75805C9D7DE0C93FCB47CFF77E7189BC2D00000000E23DF707AC627CF882CAC6D68A7DAA0B3059B0A7C0040CC3AC45EF8C7D09C62F386DD95FFFFF001D7A4088E5",
-"0000FF3FABB6681E0EF3DBD7E192EFCD985BECC109245E4AA7E7E2885F09EA0300000000047136551C4DB1C42ECC99ABE9A837261D00F859A77171A6FDE2593D19F81821516DD95F51D94619A987A9E6",
-"00E0FF3F2083750E1D05705005B5F247813F1F87328C185CE24B95B13D000000000000008BC1418C062B97760ED319E03BF11AAAC6339529064E2CE9F28EF48B8FF0B612236FD95F51D946196EFADE13",
-"0000002092C9E8407E8721CD0F620CD128F22EE8C80D15EB24A1318C1900000000000000A2F2A7BFDC0FDA917F17FA922F8CE936F41FB5ACA6EDADC788BE33168A3190BAAA70D95F51D94619E1A2C431",
-"00E0FF3F07848B536540ED42939A12B85A6D14797B8B21B8858551BE3700000000000000FA5C1C4C95E03F1EC9D8B2FA5DCBF18810BA1ABB1B48979ACDD39E7FB851AA9ED271D95F51D94619881F211F",
-"00000020BEE10E9B7555648F74DA2FB87907558FF3D7C70F05FF465023000000000000001BF9D329E8C7D645F25D9786AC575810867942133C9B8EF11AD51671A774A89F5574D95F51D94619B1CF6553",
-"000080207F1AE3B022C3B1D92840617D91B03B63435EE282CF38E3081F0000000000000026DBDCCC18F446C2AE504B16BE690DC8A5632A41BE917EB5E2779AA644CCA500BB74D95F51D9461924F30AED",
-"00E00020EC960CA729BC34D62941A4663A2642021E5F220914B30A603100000000000000E013A88A6B64C61DDF4790F1B82E06287F986C0B9462D78CFF80965996AEF3BB4975D95F51D94619EF61F110",
-"000000201A1FF2EB3BBE76159FE1F96798F09F1080284CB724BD42531E00000000000000C638D56616D52D002B90989D4FEA839212E953431E18B001101B42BC6ACC8E7B3076D95F51D94619050E0C6D",
-"00E0FF3F96FFFF0283CD97C66C06B40CF90A4CECAD61010229ECE1EE0D00000000000000350FBC73428D810A5CCA40DEA74A23F483A6341A3A4D4470AF074A102214DEBB5C76D95F51D94619B3DE2E0D",
-"000000207B1A0D8AD77BA206827C591F8D9A862F4439D06BBC97DFD70800000000000000B9C124AADFA0EEF9BACAC9317F49606F9F4549EB4793A7139B0652F9967F4547D376D95F51D9461944876431",
-"0000FF3FD13F87E2A8BFCF9909A65C2E3BA8E0A2B92C5E7338C4C02B3500000000000000A9CB6CD368E4DE3506C18D176DD8C5C91CB5D692966194C5D685608D0FEA0BB0C879D95F51D9461954A82CF3",
-"00000020C20C20F915DE0089F44D17AC646C753670A8F912F84434A91000000000000000889770E9210E841AFEA8655D36B1465B8F1700B6A2FB7A64E133A33DE3046EBAD37AD95F51D946195774D5ED",
-"0400000091F21D83242F21FA1B65A040E8912644C004EE028E2093693A0000000000000025A871AE2D4AB0E7B8B034E6098C7B271EA3CC2DE98B4566434D238BD42DB2E9237DD95F51D946199A47EF29",
-"0000002091AC463071C3C214299AE02D25C42808DE641E8D01299B621200000000000000D62B9CA966ACB446AA45440EBE33A5851AF89A6C006D5DF6C39A717F452BCB12D881D95FFFFF001DC659F7B0",
-"00E00020A667AACA75B54AECD74A5A3671749CA13328F66AAB44D3CC5CAD4E2C00000000A4CCBB932C65D566632C58663818F3E2C7A6A2E7B7649D24C10DA23E9E7029F00686D95F51D94619DD625481",
-"0400C0009106F601D95A29BA2F98CF4137EE21B5B98AEBC13084922F2C0000000000000006E7B7B7C706A2004201B8F76C98A43FD8CD77AA920CBBEA1C6D116CD4F87BD36B89D95F51D94619AD1E46EF",
-"00E0FF3F91539EEDDA1F9832FEB1EEE68489EE00F48A8E39B8F0E35E34000000000000006AEB797936325BF810ED8D3ED561B2DD1AA4F3BF4CF89D911CC8D7A785B156BEC08AD95F51D9461906CCBBBF",
-"00E0FF3F3C12C9AFFE889EE778DB2ECFBD7F8B196DF623B6769BD2043900000000000000FB042A6B45CFA28564BEA7D1EE4DC213345DE7CFF6A79F5E566A225645EAD2EE2A8DD95F51D946191A09B8A5",
-"00E00020613448A4DE5FDB18D781BEA1233570A4EE2381B5BE9CF9D5050000000000000094F592AEE1A52BEC1CCA4817A5D68F91179DDE0EED1AE0914C27508873C16ADB0F91D95F51D94619D18B5F0A",
-"04000000C1A7E8C5F5036E257CE28DE13CEDA69A0E2CBD46E9A857592C00000000000000693F99B2373B10708CB25A2AA097C409D50E695C78011BF9F7EB4ADA67ADD4D36493D95F51D94619AF31C8FA",
-"0000FF3FC911227B721D6460584C006DA7AD171DAEE5551EF3A6945E18000000000000008ADC7329CF8718A5FD12324E8D3C1CA6BA9F11DEA57D6BD01500B589F79170B45495D95F51D94619F5C7C180",
-"0000FF3FF33222FB888AC8136DE587F4069339B983512D2B009EF32C43000000000000004546F7AFB3E283EE53D024EE74DA53AC36ED6BAFD5ADF9CC034E15C83DAB0D24C896D95F51D9461937593626",
-"000000209F50C4743415DB821DF2748284C4B1E431CB139C2CC1972510000000000000000F8A0A529B9A91F5B94B81E1CADD395204030937A2DA04AEF0A9FD1CDB153AB88098D95F51D94619AFB028ED",
-"00E000200EE8455E27C2E23A70D326BFD2942A830C8722BA4459A0572E00000000000000BA27784A020C68F1AEADFA4B4F10EF1137FEF6D9944860739E7A91318DD000301A9CD95F51D9461961BA4713",
-"0000FF3F3540898F8D182B13D1AE3D06E19ABA60AC89632CB8A54F8E1C00000000000000B6970AF18EBEACE738BA1219C31D95F33B8EB2E0330D5BD4613D4416621B02C87E9CD95F51D946190C6A0F12",
-"0000002082B3BAA36FEE51BFFD9A04F699F1D5C67CF8D8A1F37C1A4F00000000000000004D89955A322BB0B17F6946B2CD18EACD9F0AB3070DB577ABE8323A24D53E3E9AEB9ED95F51D94619BB732601",
-"00000020F4B006F415D2164EF47293FE44C243ABEEE0FA31F45540340E00000000000000DD6834505F7FBB3164D855D18EB74E5D93F39870C835762B672F3AAE375C9CF2A49FD95F51D946192DA9B201",
-"00E0FF3FB1688D3F8BC6E2AA549562FF81464786814FE689FDCEB6AD0E00000000000000D69F0C46546DF14E534CAFF2388DDBCFE699CA122C22400E640F7FF69E6A344C6BA0D95F51D946194E5F0B95",
-"000000202935A536D1E7743FE0D2E88FFA77FD749885BACAC21C96AB210000000000000086CAF945B4367F74EB365CFEF3838ED82B9C1EB3B4752F2750B2E911CD89EA0B0AA3D95F51D94619F876AE94",
-"000000206E31C3BE9DCC1903252020CC8AFB6A97E8375DC380CF833C0800000000000000EA3722B13D5AEE6A8B204D07B653C6AE8F572585FA42BCC56682FDEC1C8CA818AEA5D95F51D94619046F93CB",
-"00000020A47E93DB005A1ADAFC175FCB1CA44F1F5CAB8AB6ED46465246000000000000006631ECDFB19F44B4F5D23026ED66EB5261CA7D6860BAC0B435ABE30994093F04A2A6D95F51D9461992841AF9",
-"00E00020497AB6A5F3380A3CA4958A4F84A83BE620C0A48B1A4CF6683A0000000000000021F16C21651C30A1336B75973378A96F6135BB720B49D86D37B529A9F6D224E9DEA9D95F51D946198385ADF2",
-"00E00020855213A1526AFBF32D898630FF9C7BD103AA5914D83815E51100000000000000761BAA2533DFAF632E64B4B96D27BDE1D6BE8E718C4A2F3EC9F6012923F5986E68ACD95F51D94619478F7B19",
-"00000020B7538EDD3EBEBE9C8BF33321D0E156A4E49793EF36EC98FA1300000000000000F2FBE10481142D3B054F0E2A7313EFAAE9B138D69777ABF1D10395820364453508ADD95F51D94619B1B3464F",
-"0400800048486AA89AC3B2B46BC503F187B400015EE3A0B7A7F5B1CE05000000000000008F7F93F301587282D009D02A6AFE15A5B4956BDFDBC918CAA0F0ED224FA0C6A636B0D95F51D94619C987FEB5",
-"00000020C4400FCD0882F0438B14DA06F4658FD5E80EF60302EC6A6C09000000000000003A52307BA91685E8736B93BA6882262475826068EE51C5CF7892927AC369A716A0B2D95F51D946193AAEBCDE",
-"040000003B033A001D9FCF7094FC873DC53D8F1AE156C3A3A3B37B0A130000000000000031DD827879C3545940CACC348A51AE4DCD58092B1A6DFB2EE21BF045E6833A4F5DB4D95F51D94619B274ABAA",
-"00E0FF3FE83E21A0F138C0870698DE02F3A5635DD0CA625C0985E9910600000000000000F2D31E09C00DA9EAF76676960C1DC57C6080CCEE07B6680BBA3DBD8DC8DBFF51ACB7D95F51D94619A047B51A",
-"0000002044463BCB5450A5CDE79EA5446FE253AC7C3AC6C943D0B14D3A000000000000007FB12C02E92E443FA6DCCEEF736300E72B5C2A9995E7ACFA83A5B0F7B51205EE1DB9D95F51D94619912E8E37",
-"0000FF3F2E59BA13B72A3E8B2B9EF50F09CE417DFA779B370A0E44AE3900000000000000E731F32E65798D45A0FC1FAA7B91C774AEB60FB5888DD83D6FD8F8F776817CA29BBAD95F51D94619773C2A7B",
-"00E00020D1A978F4E0D4064636F58118F8D07B967D9B8CD3FBB41E702A0000000000000062424EDB1B284CDC7F97F371177AC76A0A6CF773D7B34302B188E1E518120BEA25BDD95F51D9461979967A5E",
-"00E0FF3FA11B3E9403426D1BF860E6EE4E74A06389ADF06991DD76BC2000000000000000F2E637037E6879FC5DEDBB6189BAA93AA869EF122723F6D052922467C9B10AABAABED95F51D946196B78B131",
-"00E000201FF8D6D9C161EE8ADFBE2171A5FD69C1E41AFED7FAF861F614000000000000000E8C563CD3DC5543CECBEF5693B938AFFDC752A0598FF5057D3DA3F5837BC9FC39BFD95F51D94619AFF391F2",
-"00E0FF3F20BA59A109B081E50A04E5173CC02C1BD758493349E395143A0000000000000026CA2C70876F0AD8DAC4408EE5C2749F72BE874BFB35E1651A1C0E77FC7B3FB85EC1D95F51D94619BFACF99B",
-"00E0FF3F4E54C9D578266FC69CEFDC4DFDD6C27BD3753AD82D81367A0800000000000000B017218BE0179E3575C79A63E0459290E6C393A35F856DBFD760E0635A954E6EA9C3D95F51D94619B7AFFD2F",
-"000000204D59BEC870A1141820D43F183759350A88CA604409B656414500000000000000D5FB339ED71D7112F6415B6C198530D49655D9B540589269C211CF4F80DCB63F60C8D95FFFFF001D06F258A6",
-"00000020851291AC2E014829E0D6B87E96F9670258E61C7CD4390D6EAAABDC38000000004B9699BFB680C6B44EC42372E07051D99E72032B898FDA4607F9A9E53E467EB908C9D95F51D94619CCE79E27",
-"000000203A7681E984F1A71249829ED998480F03BDF16CC73958C24620000000000000008BDED69C8C970B036FEA1772403DE59F9C084A34A662541388135451D1D64F4F6ECDD95F51D94619778FF8C6",
-"04008000E0EF537F972C45505EE2F0DAB85583C50484E6C028CCDA7912000000000000009A8AB50D9177CD2431245FB98F793487BBA52151616CC62D7C045F86F558C327B6CDD95F51D946194B364DA2",
-"00000020BF3E57C4BCCCB423409F805C0D26ED46B8C013512E3857CA2A00000000000000437FAEB05743B07BA665CE6BBBC0150B9009718A6BC57A91B2D66C32A30D7B3179D2D95FFFFF001D6AB3DE6B",
-"00E0FF3F2E989B9315DE12DEB4B2CA747D184CE03C2DA7B2F49D37B3EFE33997000000008550C40C7C913BF748EE1458B24CD58C56C5D6E82B13E03F7C9753A5786B1D654DD2D95F51D9461942447923",
-"040040002FF0B66A900EB8890C502CCCF5B299EFD5DB23FCBA6A69F316000000000000005EFFE569F79C58A5F3F04AB3CA95E39A2EB5A331AC6459F2CAFDEF15C90BCB85A5D2D95F51D9461986CF6F0F",
-"0000FF3F12683A37104074EE661FFA5457B1C20A2E8178C1D1EF32AD1000000000000000AB97547DA1AC3A6054B06109CD56705C8EC862360B72E0F07F35BE60C706E6A20AD3D95F51D94619DFA8DB87",
-"0000002023017A5D2461ECE2667612CED0DE1B2C7916BEA61D65FDD84500000000000000CFA41AD61C4B807BDAB1A55303FA35ADADDF3BDF398C55E59A6C8DD57DD8EB45DCD4D95F51D94619903234B8",
-"00E0FF3FDFFA3283A43D830C2E6F6B5ED3E7564785B52E6799B4C4CF05000000000000005F50EAA0879E7D57DEC9153B9D7E341A2EBC33920D38A213CDC2C2F5FBEB6CE5C9D5D95F51D94619D39BF5C1",
-"0400400035045D90AB893E418F0743255E928E4764AC07D5E840D53C43000000000000003BFADDA651B589033D27838D4A63C194E4078C68A22C9917D22FEA2130368C0E97D6D95F51D946199003D436",
-"0000002032A4CA09216AFC5E2F5AA705BF605364EF6948A840CE84EB44000000000000002F7F3F2B01E5DD0CA2B9ABD214FD55CADD522B5367845EA154FFFE9A5E9AFC3ED3D8D95F51D946197B426621",
-"00E0FF3F16C5E69A064C15DD99336DAE59F6D2691122508DEFCA77151E00000000000000B8509073A41FD7ADAEC3D4E5BB3FB035E2ADE090FA0919FA92650FB3395FAE724FD9D95F51D9461955695B43",
-"000000202710FDE66DAD79582402B70A76706169E50236AC6C9385EF0300000000000000A74376DCD7729D16BF84D6740953A01339661DD3F0D04489805C1796E7CEBF2507DDD95F51D94619D857CE1B",
-"040080008EAE0AC737D5BEB1FBB3DF7B99B29DEDC2D91050420B55C517000000000000009F4FE6C0E2682EEFBF881EA8809D1CCAE519B00ED5FBE864592EEE9ECB06C42EADDFD95F51D94619A033B27D",
-"00000020D31B0F3679EE031D5EA3AEC9F7B30B523CFE9A2C46BE59990000000000000000B219F5B1CAD738F9A94C30440253D743C5627E41954A542301C684F0B6DA82F9EEE3D95F51D94619B256896F",
-"00E00020D72C57263E5F8F7BE6480597F6FA3A469610C0AC840A35D2070000000000000032E96030071806D0F327D65DD0020638E13582C682B9177DC99F99AB8D563CF41DE5D95F51D94619CAABD43E",
-"00E0002025EF28E560B8AB6D7725EC642CC6CA5F8E0DC3E5757B9A461A000000000000001778B59C6A1C4CDE46B85C71A4DE03B55D9DFB8B8714DC464549AE2EDA52F1A85DE6D95F51D94619B83C8285",
-"0000FF3F2E514CEDAE8A1C64CCAFBF2EA29DC260755B421EC516F6E1400000000000000051C77DBE82905A5599817AE6209D4DB838A476A0C02464098AA55ECA49C7C26DCBE8D95F51D9461908A172AA",
-"0400C000A7C7D4DC9F55E1EFF92E9F3D25B43D427826B24E9BC09B673400000000000000AA851792E1E4F59EAF221CC1A68E54D20F8706222F70AF641A082EF03926475585E9D95F51D94619B75D67CC",
-"0000FF3F46120F4B68B33BCFE2A002FB89878349C88BC66F6E4994AC3F0000000000000082CBC612E3013A760E8D37819A098750FE674C8E63FCE2D10AC6D53846A4D97C22EAD95F51D946199953C125",
-"04000000E8AA0942129347FF2584E5860CEF3365422AF601DC40DB800D00000000000000027F66D4D5432EF2E72CA7406B1476C557DAFD373EDF5E021D35F6E88161E28D8DEAD95F51D9461944337CBF",
-"00E0FF3F0ABDAE2BBD5B5B60B3C488D2F1CADEB8AF5B44DD6A531CD03F00000000000000918BF40CD184576AC26E973B55F39C93CA2BA695D988DAC4D08D2093037FE31F72EBD95F51D9461908AEF817",
-"00E0FF3F5D28C91927394BA31B1A5C2F1DF82A12D5776500E4484DDB18000000000000004BE01665187BC377F7AF98CFDFC2D0F377BD8B8D1BEB30145D86C39001682B8197EBD95F51D94619A901E456",
-"0000002087E12314790915B8BD6EC0C87A2EA067BD16FBFC70C2311A2500000000000000F43D948FEF061EC4D412EDDA8A2AA7343C9E4E294CEA99960DE59F58DA03734A4BECD95F51D9461967F3311A",
-"0000FF3FBEE11C8088F9B6D9341C65ED7E8CCD961B1EAF4A7A5258AD42000000000000008C0E5C2E18FAB3CF34E9D0E34DA8733259EC92C6F742DA9AA75E22EBA7B68A2BECEDD95F51D946192491C307",
-"000000203AFED437EE43D0DEAFBF3566CA5ECC38D9AC9DA2E673A84E22000000000000005F58825BCD61E2E142904AA4DAE69A77861DA658414F085FEACF006F28E9BD7756EFD95F51D9461937CA7397",
-"0000002096A04B9616ED4EEE1B032D8590662082795280018916CE44390000000000000089FAF2F0C776B65D7B882D11C195FF3A71D442A10369DB5222A3591E099ED69917F4D95FFFFF001D13469C78",
-"00E00020E0F90E67887B9C0FFD4ED6EBA4DC5FF94F1ACD46DC606A4341914B210000000068EAE88244C2C06491BD98323E2CC1199B63D905463E870AF9EB17890540B84A6FF5D95F51D94619A1E10B3F",
-"00E0FF3FC5222A736F4C27CC9B944103F24D402D08AE63C21A41732A28000000000000007B1BDD4EBE155C5442C5DB6AE2B049DD836B864FE06F47366585F687628A8B0BC3F6D95F51D94619923C629B",
-"00000020C34B155FDB9D68AD2F3FC42DB0C050552ACAD239D4A8385946000000000000003ACBEE7858EA3BD0BB85C5811222CB729014A9555DF0E973B3496ACA113782DF45F7D95F51D946198E0BF577",
-"000000201A861DA3D92BC3BB52015E379F0F4F9F30509685F22C09104200000000000000443F848F34E57E46BAD32C5486992338E1032AD04B8F87B94AB298400D7A2D95FEFBD95FFFFF001DAD4618D5",
-"00E00020B03796DEB632044BFC6B557AF6516CBDE68B89B4B1723CA2D1BDCBE60000000064660AEC50B35E846ABE83CB9B9092672669B3980AAB30076C9ED956F1E9B6B613FDD95F51D946196EA27333",
-"0000FF3F6D5FE0636066999EDF567A71010182638BAD75678D946CAE3700000000000000A1522BC169655CAA8AE4A28A5EFE630077FCD728058499D890098BE5EF0EC430ADFDD95F51D946193D79F083",
-"00E00020D465A645CEED4D8F4852FDFC77904BD034D56E35CB8677E13F000000000000007FC968C3A09791D3A75D7E6C03C29EF1D9D04FA021BA2C13813AE03CDC3ECDFE5E00DA5F51D946191D8943D7",
-"00E0FF3F0B103E204840A4C26D4A1354DAC7D0ECDA31366CF5F7319F28000000000000001645AAC3888536089CE85E4223AC98B7A0B3B4585705DD15ADDB6ABE595E673C8301DA5F51D946195D1BAA3E",
-"0400C0002DA3D7BB91069E51D8F63159ACBE7442F1859F7D92EF1F502800000000000000027C198960F552977E63F295324D91AE6B6B8D0DD570F40C05A1436116FF8E724E03DA5F51D94619CBE73D89",
-"00000020981058BD051301CD5946E0D21BB7385C1FD064B5BC43C19425000000000000006F570A6E3A6D92DBCFB3EEF0FE007B29307225ECD01132EABE7E3D61E473EC8B7E07DA5F51D94619EF58EC1C",
-"0000FF3F097D96F0481CCC912500B42F15E26D8EBE7B6CC004F050064400000000000000E3DC420F8A85687D210DDDC36D97D1EDFBB3013C391E150E92244BB81FE92B427108DA5F51D946198D4FA54D",
-"000000205C234C116DC17223F9204A794B066458BD20C124E21D86EE43000000000000005D811E28C72C3D6AC0B8FC96B6019954086F500B69C6F42A8F9B1343CCFB91F93D0DDA5FFFFF001DE4E84505",
-"00E0FF3F9CF2A11814B5F0E5F766ACE64A657C4E8245095B40A95D1EA2390939000000009D7AD583B67C88BA10AA08E645A93686E8F837682F8F099287C61A6DBAED33FE9A10DA5F51D9461984CE6261",
-"00000020BA05C9ECD018B605754AEB792E85F6343ECD28C45A61B1324100000000000000A32394FC5221E21A10F17B67381CD536E38A0F29C1C0C07A138343D3912A03DBB011DA5F51D9461961E8FC35",
-"0000FF3F2223283185B36CC931A6F748132EA1B7AAFEE8289D0EB13801000000000000003F77C5524E1366EDF138B754508A92E24008A55F25DFB0539110C2C1FFCBB3A50D12DA5F51D94619E6B80A90",
-"000000204A25BB82ECB4D27175CA52023ACCA1D3446B7EF3D1604130250000000000000089B4FEDC448AE88033379D76DF1624BFEF142EB8296EAE06B1DC7DA1048D99BA8C12DA5F51D946199CF312FE",
-"00E0FF3F9A7ACACC56DBCB336712F1949873C567AD83CEB94D9A53600B00000000000000BB069B734AD310E198B2B9BE9C398FF46A2A923B0DE5CE4420E4F152272E2B4BF612DA5F51D94619D43347F8",
-"0400000003386F80CB6DEC73D97304CAB5A0ED754F56AC5D2E36D17718000000000000007F84AA4DF03586800BD3D745DB9D6EF1200AB4B80FADA45B185048F39B33181C7514DA5F51D9461948EDF8EC",
-"00000020B49D7A96A9CE78C0AFFCCB36E7C552AD0AADDC8C228FA0E03300000000000000D6CB2B3921001024246A19661102399831F200D29CAACA4BE6716D8C389786909916DA5F51D9461955C4A732",
-"0400C00009C9F6D4D25ECC2C996229A8719F979341DEB0DCC418B2863600000000000000ED165239939A5F8E37A95CAA7241E987602DA78D1E9F186E72F8C72D691D3F80DE17DA5F51D94619BB69CB95",
-"0020002049B5F40E852BCCF48056AAA81437048B9653F490575038602E000000000000009229864EB1A55E362527F6B13D2EF9BCAD126D24B6379CF60B858A419A10600A061BDA5F51D9461961F23D05",
-"00000020ED49F5DE633114944AADF99B7ACF165DD4FDEAD548BA5E870D000000000000006B1EDBDD0314F54EDF0A39815C015FF44854AD38A3313D06D8B5941DB844EECBBC1EDA5F51D946199B401A0A",
-"00E0FF3F28BB19F6C6CBE0B39695AC70F43386A025AB0643AF52A0642E0000000000000070BD76FD5538CE5DD08D146825603285D68DE62B25A92E6F4910430899995DC4D71EDA5F51D94619CE95EB10",
-"00000020CA15CA901873C9DF770F21FEEAE00F74C71D1369100347AA0D000000000000001D7738B763C43927D15B5E65BBBA7E244B599C17A7E6F7A005892A0E33099896AE1FDA5F51D946194A5810B0",
-"00C0FF3F4F377865B78EFBF98350DFE33464163DDA5C25385712B1592900000000000000E36FEFB3BBB529668BF61FEAABB850ECF222C7C67FB3A1E185927E2ABCBD45692722DA5F51D94619DD696226",
-"00000020C0A5FF63C8E90CFFE6C170A63980D6BDC83C15483C0D508B3300000000000000B732DA222318786D06B6CEE626B810FD7D37AEF0839EA7A676857B4DD176D4E75624DA5F51D94619F458F553",
-"00000020D94EE69027119C94828F2B0BB59FEF38C0D407A839CD58CF0600000000000000E188028664A14682CFD48AA0F506405F57D0AFBB3BBB629C62949339DA7949760326DA5F51D94619BCD318DD",
-"000000202F9A3EA105E2DEB2D65D098528E8311424516E994FF594CB2E000000000000001C5076C60370844761AF5E3181D822044B694AE2AB62D09B3A1C331B46EC91CE2E27DA5F51D9461915F4A015",
-"00E00020FDD50655DE4F5D27101EC8B544DFBA448CFFA1E483F503742E00000000000000A8EEA32EDAE6F68015CCC33424C5B2837231FA7DD9AC12318D0CBEB786F7B0AEAB28DA5F51D94619766CAEA2",
-"00000020656D1A219C880AC2AFFA7C0C5BA7D64CE99F7FF578394D17160000000000000037AE2AE63591C48F4D7130D4F1B81E43FE3CCEF35B93B6545DD2A1D27705112A5F2DDA5FFFFF001D4B8C20EC",
-"0400800033AA75892B9597C183859C052B5E77A2A4FA6C95CF8FE136898738FB00000000F4CD86FED418137CBE4310764D25A38738CE770D08B5095A670C506724D0DE27482EDA5F51D9461952A6D7F4",
-"0000FF3FAE0A26813E5D2E58F27275716C7C25B12A23BF2E03B3FFDE1400000000000000ED2CAB8E2DA8F0FEF2CA1B69EFA323B521F06694629CA099F7C8D7BC0E4747F8872EDA5F51D946191DB589ED",
-"00E0FF3F5F96E4D1CE8FC422BB60D39F12B02198D6741BDC5DF275A11F00000000000000F52370AD071AB58757A896E640CDE04FEA24C16585A7964AA3A25E6D39F309ECA832DA5F51D946199024A8F3",
-"00E0FF3F976C66A515AB28851279C65FD6441BDF8B36F015B47EB7BF2500000000000000064A91B614B3F50D726F43CB4B00F386A91A957DE7DA6CAFC46D672FE0A8552A1433DA5F51D94619483699A2",
-"00E000204977357E15161E3DC88A24A3E584F2DD99A04D4B040C4CF206000000000000007AAAE87C5DDCA5D1B8E9587A49206E1DC16325E6D692A2A8B12D1B13FF97F59A9034DA5F51D946191C97D088",
-"00E00020BB52C21759B6E63FAB19FB7CC996D475B802FC6A889DF07C14000000000000006DBF0C81A5DB51C7A0DA6B8643AF088F210105AA47C78DF166B831753B505EA72637DA5F51D94619493BC687",
-"00000020BB2496FAA2728AC630D7B370DE252E82C462A19B058F39462600000000000000A781B034445F4711B4209DF986A149AD11070D3FD697E0C23CA82432ABDF2484DA3BDA5FFFFF001D125F0AC6",
-"0400C000EE4CDA6EEE17B09922A85E4AFDD0C3D936F7971D95C42D0A86C861DE00000000708EB4F51B4E9AE5DDB1918B2170383520D1A8CE8FBF9445B91F9D04F2CAE965233FDA5F51D94619BAC235C2",
-"000000208348458AC5AE17CBD23F724D840B654F752C9CE959BEEDA1250000000000000028C20F2A592AD1D9FE4874FC2322DF94AE8223264D011B7AD59D34276D3C7EC3A941DA5F51D94619C2B262D9",
-"00E0002002370D5FF901C3C7378AD3DD5F7CE19D70968CB6CF1717EC31000000000000000D2D3F08559C4CC5A59C4439E5BE99F74D9AD731BD2DC5428B971DAF2F5013CAAE42DA5F51D9461993401D48",
-"00000020FA93CEBD6D3277B2422FF27798EEA8DF7EEFA9FC1AC24DE22400000000000000A9388EBDB0F5FAFBCCAE6ADF772F156308DC28FCDF1C30BDB07210A236E415698244DA5F51D94619036270F1",
-"0000FF3FCD89453960638EC7E38D29AD263E723DED273CEFD99E4A4C3000000000000000B2081F4C89D0231F7DEE2E2C16A9BEC9C050FDBC02D46B5C9044935D61D87A092C46DA5F51D9461954771401",
-"04008000119E9D8A56D9A2B1E7AB7CDB26D8C04798E72C5729F6316C30000000000000006BEFC07461C951BB96E99637F6012ED4FA1B7A83996294E369234970776FEFFACF49DA5F51D946198AC5E465",
-"000000201FC4F85E1E928783018EAF730542AD1DD1ECFCBB5059460B1E0000000000000045AB3BCAEF70C01173341164F5C83B55D44FDEA690722F1DCB7FB86C658B6BB3824EDA5FFFFF001D22E57BAD",
-"00E000209F9201BA6E13B21CB7AD1A6B5B62102BC2353E7D92040D58E34C6A4F0000000038EECFBE88A35513004CDB0B2ABAF3C03E4822C1FA02240305F25863DA621ED63A4FDA5F51D9461937404253",
-"000000203689D0F39FD473776358DE0FCC16627DCE0E42AC0214CA462A0000000000000002108B218E4202AD9BC25C8DFD37E1A143164CCE5498FAEFFEF045F7910EB27D1A52DA5F51D946196D7A031E",
-"00E0FF3F265EB6E71FDC39F19E5A4863FA07B19A16ACE8D7B9166B3D2900000000000000BC4E60FA7D27B403211C96F8A2FF9F6116607A43AE6C8E28FADAD69D295254284A52DA5F51D94619E00CFD48",
-"00000020B23B72AEED3EA823BAA1EC34E94612605B70FE34FD22D4BA3200000000000000A0BCC813029EEE25215AE6C4CCBF13D032C5B0AC4CB4FDF6CF869F3CF739FEA49852DA5F51D9461965740D26",
-"00000020FB842CF86CF6CD8BE86E1024D9F8700BABECF6B18C28D0BA2700000000000000E7D7B0E2767BA452DB49EA8BD6AD4F2566C71310980A09B4B5AC5EABF4EEB6887953DA5F51D94619CA35E726",
-"0400000062EA09F4D1125DF6BF2D2AF279E87225D01C5EFB73184D54270000000000000073E919FA7FC49447F9A91EDBD48CB28D774E7F0E4AC737C96FE759FB28030D2ECF56DA5F51D946192334CAF0",
-"00000020D234E4121A7EE1699EDB8FF33BE5C8E384AC87AFD018812935000000000000007EB89EB7A007176D63424B8A6FE35FC89F34D475A7D3B9418F89D4D548ABE2C47557DA5F51D94619D5A424E8",
-"00E0FF3FBAE3607CF5C179DC3C9C80ACF9211CB960407A7D0A7A4ACB0F0000000000000009D60B799172CE4D50E0F4F5BF692B9EB7C81E003E44B3F4BDBA7194A9E03B073058DA5F51D946190D77C1A5",
-"00E0002083D91EBFDB6B0BCE235592924AF354593EBB83654269AB7E440000000000000094CA9091499128C37488B1117DA17D8699FA2169705DE9A3F2C1D0F2769021BE9D58DA5F51D94619C83A16A4",
-"00000020A876DA5BFFFB42E44FF4E370DFC78833A0294999B780096726000000000000001370475472A346F310DA3424A44773D8F4038DCA781A657F867730F0FA58B2A14F5DDA5FFFFF001D0DC57A26",
-"040040004F75E11CE7F1225774DF7755418EFA4CEE6B8F0FFAE6F878CAA83894000000001EC322C484EB888A2916654623A0C8E82CD7BF5FBAA99FAEC45BB0B16641168E135EDA5F51D94619C1960CD6",
-"0000FF3F9D245C6E9B6216260F5A8522543A929651C289F5C305CC8F17000000000000001C22AC40C804BA80A50629F6038B48EC3FAF21AA2583370C7AD74B8FF97C9A08FC60DA5F51D946198A002FED",
-"000000201EF41DA6CE803AC2D69E3CB5267BAF12DDA3422E0C30A2932900000000000000A472235D5E87D1CB83396F1F9958250F6F82626962927B78D52D83E399DCF6BCCF62DA5F51D9461986B7A662",
-"0020002017C5F7086977750D6B7713B865BA2C2313DC898F6320317F0D0000000000000095DDF8A97D27B52C1B80353017812FB1D898088720C404EFBE05D0BF52637AF3F466DA5F51D94619A0561321",
-"00000020489BD3D1B10E5E2200D6BC7F762BB603BD5E1889D1CDB24F1E0000000000000044FF60D2D89ED8BD606FDBB25F6E98B2F63FDF5B7B13A23A43D7288E5FC92ADA106ADA5F51D94619FC19B567",
-"0000FF3F2B9069559CA5838BEA37A1FA13123F2F299718BBEC0A3D972100000000000000EDD67C41E108E32219A54E0C74C8A1B99A4187CC14E408D7D590891320FBD02B596BDA5F51D9461929F34FDF",
-"0000FF3F2E84F906DD31DD803AAE860C073B91F7C0BCA1F0DE6FAC3B3B00000000000000F348769D18661C3E32B254425FE1FD1511FC6DAA7AD58B9141B425065C5F5CBE636EDA5F51D9461970084216",
-"0000FF3FAB374291903AB19CB6464769131D11DB6A36368030471C31290000000000000002014A496A03938273E340DEF29E53C29C5227047E6C97C1F3524700895ADCF2606FDA5F51D946196460D9AF",
-"00E00020287AC62BCA9148AFB3938CFB02E8382DAC04B0B156A5B8F13900000000000000D6F890DC0F6AF3C724A05CF4376AAEC0B775CA1C596A91E508A802FB6A25DD6BFF70DA5F51D946193187AC3E",
-"00000020C71972A8DDCA501A9F4BED7897BFBAEE15B8A6E7498D7D4E04000000000000008B4C22CA12B0600A9683FF4B49EBE7986D918E6215EC5AF495E8273AACC6DE9C4A73DA5F51D94619197C22B5",
-"00E0FF3F78367E7E4B70A1338AE39D4C62E17A41A00C0535FC44EA6A4400000000000000423E762E34102D5141907E52FCB450683404B77D172210BF1A976122B277B8E7B574DA5F51D94619B9D21732",
-"0000FF3F2A4DCD2FB8A60713F2E949F91EE2BA8D6FBB0E88BE097A061300000000000000E02A9ADA54236C1DF183B0CDD3BFB1F04C7637264659C397B0B058C6A33BB9716D75DA5F51D94619E58F0D1D",
-"00E00020623E049F7186566884EE30CC9B35769A96CB2F79C01ACE6F45000000000000005EC11BC05781C8171D97665C35A3D0A7FF5F7EFE88C253F1CD24244AC15FF638F275DA5F51D946193BF21BDB",
-"0020002073C56D522D2374919BEE54F479212B5A146112AB2CA81B8C1C000000000000003E1CDB0E4ED8C100D8E812EAF000FCBCE5A4B6363F7F03ADC880CCD896177AC78578DA5F51D946193C941C77",
-"00E0FF3F08E1B5C1E7BEBCFD07567C063339023A34DAEEFCB4B6B4B22D00000000000000E0FEAC4683C77193F5EE6965E1C6CAA3F02BB2BE1FEC2DF44BB5622D7903BA3BBC7CDA5F51D94619600F88CE",
-"00E0002057EB67789BADC8644B8CE23A74667F38ADDDC17A2134B9122800000000000000BA5246BA78E93C441AAE5065AEE8543074D05887482DEBA74932434141DB28E0E47EDA5F51D946198473C2B8",
-"00E000203855E6C32E5F9685B71933130EB6CD753317E719F02BB5B341000000000000005AC30B90274F5634EAE79219FB1E01CC4707F219BECA5DE9C0CA1F85E5884A9B7583DA5F51D946194D29A471",
-"0000002061E7868F7DE7F3EDE8CEEEC9B7B0143F8F1B88A0E076DA112C000000000000002A00B54934A0C70C2A2BF45EDA129918B5D94085F1DF8C40175EDF6712625DECC784DA5F51D94619A8EE4EDB",
-"00E00020777F144F0BE9C918B00D011A5E2884EB8F8D8DD4FCF0FC6037000000000000006860479D2080328FB38473B6616F7808AB9389BEADC2110B091759A904B23B27DA87DA5F51D94619B4306433",
-"00000020BADE7B2FDCCF532517454570F0736CC0CFBF1A3638CB63563500000000000000D9CAA2E8EADFAF08F8300637FEA25A853441C1D98F9F3BEF428778918361A6398C8CDA5FFFFF001D24673378",
-"00E0002077EE36ADE39FDD02766396A4B34196D0667C8ADB1A4A816C532D30AE0000000084DCC24CA2E77A584493DDD6BE34B11754C8D3B65C683930063FF5ABA187144FE98FDA5F51D946193C282421",
-"040080004FFD0525E7CF6DB62549280D045EECF0060D9614B6DBAB21110000000000000009455C7E45826354EA8163A1AF94EC3066DC492448E8396F29EEDA01F5EB16971891DA5F51D946198AF07A33",
-"04000000F2552D3C0A2D9DD7376BE53638E8447901A27CE97D3BDCFB3F0000000000000000F7D91853736DA294597330FD7AC8E9DAD4063E91EF03A56FA8A6ACF13970897C92DA5F51D946193160527B",
-"0000002018DD487BA0C065393BD99AF69DA0FC0B61F21B2B76237AAE090000000000000095EC2B4F1BF272111FBE080A48255F04908B55A433D8A5B4AB8798733157C4132D97DA5FFFFF001D0462B89A",
-"00E00020CA63A48A1F62419B464FF6D6442AE2A7444828C682338515469AE20100000000454B8891D491EED517252AF3F4738AA96CC7B8FF882735D70ADD01E01E61BC483A98DA5F51D94619899926C9",
-"0000FF3F92A8D0AFF667049244EE1E251D0D5A7248E4A2DF050B9EB127000000000000000386C1CF8DAF117CDEBCCDA03E1FCACC8CE9C5417530E3F5AC2EB5BEE1F367EC159BDA5F51D94619CF3A7D2D",
-"00000020808949C33B4688E83E5AA14EE861EB1CB887D5009B6000CB3700000000000000BD15685728AFC91A88CC3F284ABBC6D9E877C59F4966DE4EA971720AA1730912EB9FDA5FFFFF001D2597FC2A",
-"00E00020E038AE0A95C2C5C4CC70FC9AC5D3443D19195DC1459DE17544748CC800000000CBD03DD8C26845F280369CFB8A4357C2B54A805DC77694561C40D088BB1190D7BFA2DA5F51D94619F75B2930",
-"00E0002030B28288108CE20533E370350EC18A5AE4BE23BE4180BCEE0D00000000000000610CDFDEA55753350BCE5C8484BA055C44095C77E601B620A660B13033F7BCCCBFA3DA5F51D94619B2E31662",
-"000000200371E618290B5E333A4ACF75064CF78C3305E46CDD7B6B31430000000000000058D796301F8AFFAD2754D608DE263362DE09310B9194FD3B0D803193B6A452D46CA5DA5F51D946196E8BD716",
-"00000020B3497CEBB08DD5F406DB59C48C8B9D55069A14FE12B31FE011000000000000008DF038AD845A2C4C25C1257DF86496C462253C72F07AE7F3303BBA8615F4568D1DAADA5FFFFF001D31CA728D",
-"00000020DDAE36D878E059493D402F2D8F036F9E5CCA663E18E89D6F7A3F501C00000000AD756A232103C1C20CF8AB4D941B686B572379A8288EFD37D25E5CC516BF8C6E25ACDA5F51D94619104DDB9A",
-"0400C000D3E82F6800BD2BBD4CA8F25F7472B5786AD8CD0D93BF41721E000000000000008D8197E3BB00BC2822DB958B0737680CBD8B0430504E98AD48F59B4F11F8D2972EACDA5F51D94619412F23E2",
-"00E00020909AFAF671EE9F8BE19ECAE576C5DEC8809473DA3C4C522D44000000000000003203E946863595A52007C3B6F2D0C0BAEC308065728C7D6A16A778314F7EEA2AC7AFDA5F51D946197EF7FC5F",
-"0000002099A6EC84F87709D6632296C583E67C75195D604DE705E37E170000000000000075068A0CF26402F4689411165CD57E3EA77CF166E0E0E16A55E758950AE3167679B4DA5FFFFF001D9040B624",
-"00000020EA84F57E76EAF06743357878B3AD321E620AB43C42FEAF67E49BAE3D0000000013F70EB336CBAB2E6516A3DC005D879DBD80AA47006A9B9928B3F1E5E288B505A3B6DA5F51D94619A6230F71",
-"00000020BCD01E77D614420AF89754F5AAE3D35180F3FCAE10D5D7691C00000000000000736FC4E30FB79225F48D50E5D67861A5BDD4841055D448C83C01769046A631FE73BBDA5FFFFF001D701A8BC9",
-"00E0FF3FFD58D763AFD30AE030937821E0DEC3A4ADA03A8CF3DB5DAABCFCF2B60000000060F14E59EF80E0A9967B7C3A76A827B93C0C6103DF6C965CAC870B71506A0E638CBDDA5F51D9461910A8FEE1",
-"00E0FF3FCCA16066D56B877B6D3203C96A059ECC74A916F75366393C3700000000000000BD0657D64B0CD8F045E61FCFFB73B536E6D5F455372D9CC8D53C34541F25823FC3BDDA5F51D94619DDDB2561",
-"0000002025D28B69D6FCAACCE2CEED403E2AD5A60C4AA81D8ADD02B91B00000000000000F83165D0D9B8E06FFA7C0EDD4AA74594FA375C373C75565A065ADAE71AE0F8C940BEDA5F51D946198CC6D8E0",
-"00E000206DBBA4D1D34F1D1015579665DFF1A58F7B4C56DDEE1A65B03800000000000000DB29ECA3A1BB2FB22A339FF61DBB5D3A8D4C007840CF1B97695EE0FC3FDCE67D37C0DA5F51D946197A5394B4",
-"00000020D9A0FC3294130403D69B16CEA3525EF6A11C73CB83B21D563E000000000000001951FA3606F33E4D0072F89A1ED7005A23A77BC4B48DAE5FA6A05F7E665A4065E9C4DA5FFFFF001D9254B32E",
-"000000204445C4574C52E42A45D0B4C3659E51AECAF8ADEAB74EC21CE4D7694C00000000A0B22B2BEECD731DD47290131E70C693B1E34264632BC6C410FB8509C40C711A00C7DA5F51D94619D5D9AD14",
-"00000020F4BF9C94619A6BE6A5A6D75A412E956B078C1D46E393A5981100000000000000D2A9B1DCE6394C1D6CEFAB3C2C2A47F2E4C96934D5CFB8B45234EFA479CBAAD260CADA5F51D946193695BA25",
-"00E0FF3FECE523246FC33F16F0319425378593D2EDC9273DB16B95D40000000000000000AAB3B0E90A35D83D7AFDA0D59C50C623286F8C27CFE6B3C2406D7BE073DC8B9319CBDA5F51D94619D46DF20C",
-"0000002028029A986341E204B86891D2EF8A411CA830C4405931D9A90000000000000000E10A38035F1353D02393C31D61A94DEEDCD2BA922BA39C511F1C324FA753D1C0CCCFDA5FFFFF001DA61183F6",
-"00200020C023CBD465F2BF3B42B1C9D2B45B98B348E8C85B002F5D343317A7F9000000005A30C41D9F1B64E21434ED85F11FE39C2C89A203290EEC983C1A1251A2CCFA0A51D0DA5F51D946193CBF292B",
-"0400C000C0107180CBB4A41F5B03EE1FE47BE8BE20459E343EDEBB7126000000000000006CC71C12714E9BF5625950184F68C0378E9E1F70901831C84E970FBB93C79AB75BD1DA5F51D946199E29BCFC",
-"000000201BE5A84E582BC3E1BC919ACFD62F1A9294F7E5D0E67BE8FE33000000000000003D56A26D62F633249CF25B81A3195D372E29C4C19221346E1A406FF93D49849F34D2DA5F51D94619B3261B1D",
-"00E000203528A303E9E9209570D865E40234CFA93ECD897C0CD9FA172700000000000000C7622B577AE8414F7D0D7EBD34AE8A43EF1E9356E0EF6833F88F40E77929A1BA7AD4DA5F51D94619521A95EF",
-"00E0FF3FF720C11625BBFF5E68E819062280D6F6C9E2D9D15D176AA41D00000000000000F7D396F38F84F0A6322DB12277C076B8706CF6219BABB9E0E394B09B6C95579A3BD5DA5F51D946191DF810B9",
-"04000000A9FC7DA2C24CCC9B16294F31DE125DD5C5FBA67D553EDF182900000000000000ADB49664A4AAD2A3905E1E6110719F3BF6EBD0C74FF77D7B5FE444534D4015CA66D5DA5F51D9461941408623",
-"000000205792BBB5D5150081DB214D2F2209DB0D7DFFBB24A561D1E935000000000000008230701FE2F56F9D7A85054BB5030F8152995B92929D1AD347419CC437366707C8D7DA5F51D94619E1724163",
-"000000208ABACE561ADA638F84E4E3625378813FA0DEB2E0A24203202E0000000000000032A3BBE5C0BCA6BA1215F50157EC15C7858C3270B6F6AAFA3A21A2AC7254E34D7FDCDA5FFFFF001D4D88D018",
-"00000020EB15463DBDCC968B37A1544F413AF84CADA9611E853925D9B53EF45F00000000E5C25EE932A0951048E8FD4A5C308BCD83EDBBD011917EF391E75F8658F70EC252DCDA5F51D946195F2C60C8",
-"040040002354A4E30C2EB2EDC6BB7DE76C5262FB70CECF6B5693C5F812000000000000005ED6A8538AE1B6F1EE98ECA547B2E4357E5789FE12DD5C32A3A47C25002B8D78A6DCDA5F51D946192901BF82",
-"04008000BD65243A3861E0FD1229494911ED90EA57494046588D2C7D1E0000000000000084CAC2ED8E2A0CD28270560776D49B800942647E9082A2BE444D0A072ECD922E57E1DA5FFFFF001DCD1808F5",
-"0000002085A61F0F731CAA1AC308B0ACCE7E04535F2D40584C59DFC92AB18302000000006F3200688367572E9A2F146DC819F440AEEBEF29DC79A522798006EBED8D29D498E3DA5F51D9461932FA0486",
-"0000FF3F81DAAFD4496D035FD6E7F31B4E428422D43B492A07CD15813E00000000000000EBE527D4FA8624D6E55A48212F5C42CE5F8700A210BA7868B2C15B15EB1E444F13E4DA5F51D94619C0D1AF19",
-"00E0FF3F25BE13ED83A15017D7379450D44E6BDACFD7F615DF2B01EB220000000000000093E7D905DDC66B1F0549C33FCD7F815800F5DA9FD56B6E9A9F5FFE5D6E07D9AD17E6DA5F51D94619512082FB",
-"000000204EB7BA22C703D91FE65FFCD023F559CBD8E013F32EA094160D00000000000000C8FBE38A0211AD189DAD43D048D2B5A8395AC58D0C98D600DFCDD89CCFDF19AAD0EADA5FFFFF001DAFB94E3C",
-"00000020C343F95752C8C3E06F146F6A89AA687FA1A4FCB73EEFD139A647971500000000D7A14CB1FA3655040F3B95B6BC44FDD3A0B9CDA9F7B6DABD514255031B0A0102A4EADA5F51D9461994DD1D82",
-"0000002087D1ADD3DE3A5E9BFFCE597C74D91CB2639035AD1101967B2A00000000000000FF25C51E3E46341D715DCCA148D19F63926417FF4B65EF4DC54014BD32E07F9355EFDA5FFFFF001D287F03EB",
-"0000FF3F4284DE90AF749AB58BE050604D83F679A512FF4F18B2E7C74E44256100000000F8217D0248D1F30E820DBE8E120FF6227B5BBBA9D95EB3B7F68D38AE7265C2D01CF3DA5F51D94619A40E84E5",
-"0000FF3F3BB89FE534DF78D037E66CA21584B840279C22A4DAF785211B00000000000000592C128BF16DF89197D10F4F1C2AC9E5C270983C6BFEDCD9EA27B0EAFE6F118C39F5DA5F51D94619D1977028",
-"00E0FF3FE0C42BB66100AFE9286CA40BB8633C7F23E27B47E77574C42000000000000000246148D38404B14E96AAB37C3BCB598C66B1D97D61DE9A5240C79F8797A34D83ADF5DA5F51D9461949224BAE",
-"000000204E539ED6E7B873CB31D56F7A0EBF72D0F2F211ED23DADF773A000000000000004AEFFA5865794BA228A995DF0BCA3AF15940685F43616252283C318EB880A740C1F5DA5F51D94619E70CEF5C",
-"00E0FF3F0885A2C3E9B2937EA228240AC3AB8697307EA5989518ACF4210000000000000061D0605F14F7B9B4560D4C30F1E3B8B7F68715D65F5673487B3AC9558B8AB886D1F5DA5F51D94619F1399711",
-"0000002000F731CDB45476ECA49119894DE9D1F2D1E2E57190987F5D320000000000000078D00476DD77CCEF976247398C56F154E7DCC44175249EDDA62C5D55F0720ABDECF5DA5F51D9461916C4E578",
-"00E0FF3FB0CC010056B9609701DDBA2CF5CD30CE8D346FF6D88483182B00000000000000F985B1E1AE68666F9E3A9C927E7D5677CE47C9BCB6CC595AB822D27FF65C3CA0C9F8DA5F51D94619BBEF5D85",
-"0000002002CFC3656628E11A66B645189AF21A24D9EA840F607BF39D2100000000000000FEE62C088CE14ADE424F3978881BA45550C7BDA9DFD0D7683EBA3FF3271AD6EFA0FDDA5FFFFF001DB48B4488",
-"00000020CEA99C040CF1E99EAF74110B6B483001422F7F17DBED4063A5A1083A00000000227CF1693B6491AEB00E5B3FAD8C03C38A35C559F959F5254D51133797F75A3228FEDA5F51D94619DCB4D471",
-"000000207608753546012B384A0CCEDEBDE4B5F44B84404EFB92C5FB3F00000000000000BD63C5EF139C8A8E18269CFF2F3EE11BA3EDA699C7C043A24C7DA0633CB6ECE583FFDA5F51D946199DAAEB26",
-"00E0FF3F84D438559BC9FD6B9E4AEEB194F8E44B78B4143CF111E52E1E000000000000005C863D79D683886992B532FCFE7F5B4091452411E53BB78C0814117FD3BAD7C03C03DB5F51D94619C42E5E60",
-"0000002097690B87C2C5D5F8FAA23C3BBFFC11415D95BDCAC460AA7612000000000000008B3D9AFD71416110682E9CC3E04B5A881ABB6A1207CD9ECB4D08FA51290EC7DD7805DB5F51D94619E03A5185",
-"00E0FF3FF54730BAB49B7CB841DDA84D00B0F9088D1E1D15AAC42A3A230000000000000033AC7347F0A610CEC9AE29A09B1ABF803CAFF9C63F36CE0C0C6904BF5DFD13A54608DB5F51D946193C4199DB",
-"0000002050A61F4E96F49C1377F13435E78C3057E59B89A133990F853F00000000000000BEB36363413E65CFDE4C87AEB483331A2E560C7E5120052FEE3152E386A715E1090DDB5FFFFF001DC3171EED",
-"00E0FF3F087DD92D0A9824B4C2E1DD456B684BA519D91F2F946799B894E15F1B000000009DAA5457CBB0D861DB686446319E960947900C72D2206CD377F67152C5B9988A740EDB5F51D94619B48B95D2",
-"00000020709AD210B2CE032F2A15985FC57A511F185F9C02B598F2760D00000000000000FE5E3C3555E25D70C913C68BE7E36DC17DF8ACA6468071C07AEAC71FB600AFAE7C10DB5F51D94619062872EA",
-"0000FF3FCAADF9A6ADDD1812F220BE3AB24B30F8CF435DC9E243E3722B0000000000000026139014834545C877DA4941663A6DB03730DE5ABBC4493BEE9DB4F999F22525BF11DB5F51D94619293328D1",
-"00E00020A94C45F77D93C46725DD5EC8B1186B1C8548F2C96CCF8FC54500000000000000CB92C703D0BD85F447E7358F6184E3EF9B9859F26CFE035522411DE652ECBEFC4412DB5F51D94619B056FE25",
-"00E000207F52EF3F7BA4FCBC7396065189F44AF88D0432EADD4BB6013A00000000000000CA8A03E9EDDFA824EB77B3F9CC46C5F7FE76098330C02174D60A8673030442AFC812DB5F51D94619FDA2E3FA",
-"0000FF3F41AFD9210AE33A9080634E6E3CCDCCF15C076B8AA228C5CA3E00000000000000E5809302091D073E3FC1EF5993F80F84F86A4F5B29A028A545C9B990F34BC8789913DB5F51D946190D19BC21",
-"000000206B604BE0E7D4D8679ECCCE092F01AF83C708808C2566FE6543000000000000008B3619B777CEC99CCCB4C389A04118E71C078B9F415F0DCD74E1A98749B5EDBFEF14DB5F51D94619E74FBD3B",
-"0020002003EF9A1B7CFC5A2B612CDF5C05E4F930ABB0591C2B8CFDBF35000000000000007D339CADED8A0474CA92A71C2665270C869E873E15E317B478A8AE34F4134A720117DB5F51D94619BF8C2857",
-"00E00020EA6626DB6B2CABE673C2E3227FF6C708361DB1ABBD6FFD2F3B00000000000000F6E98E714F606581989A4FE42D0034AC9605B33ED2C91D0BF01C22BE66BADE35E618DB5F51D94619A9852CFB",
-"00E00020B1309B9D3DA00E58FE1DF427B9A1D105A7D6CBA88E4DE14910000000000000001B3647018FAC1865319BA546645AD6E5251A689D47F6494A00CC278196DC166BBC1BDB5F51D94619D489415B",
-"00000020B66EA88769C1F15623955E89BB674856FB5F43A12D2794E71F000000000000001CA8FA1D131CD50D76E563D532D4DCA356C7B593D701F5A08407F428B51E36736D20DB5FFFFF001DD071A00D",
-"0400C00060367557B2A6B0AE1AC2247A62036B8449EB7A9C244989DF3BB4FB5200000000FD05987E0CD4B54C29400CF5FAB16BEAF70ED77DD64B038E9C0B03C6CCF3E01AD322DB5F51D946192366CED3",
-"002000208D498CBDCC8C7B6B9721450053EF09E5F69995B0838BE75E0C00000000000000D3E9436B9E4571FAE98A45AD193566FE7FCEC15194DF4F497C67E6C481FE1E6DF426DB5F51D94619E27B7501",
-"00000020BDBC0C807581568E63ACCB8D137EADBB69F81C8509BF9B1011000000000000009AAD4124408CF5ED2B94E5EDD36B24548F561CDF8BC0BA03289858D2238B3150BF2BDB5FFFFF001D26423D77",
-"002000202F0BA2E986E04CDE96404DEF50B8DFF203608408B3EC82CD32E339AE0000000011675783580DA6492906C12F4575AF376FE338A7FE6327DD8BD455D5EFC1CF54C32BDB5F51D94619340BB8E2",
-"00E0FF3F7497F46E675CF0243E5A72CF1709C8E4734A3E62FB2D2F6A2400000000000000869AA4D1575DB5473A2E19F3823CA7FD10905B78AEF97E47A7DDED2AD2F4A8890B2DDB5F51D94619212E4A6D",
-"000000207A7537489B965252F3E26B5704A8A8E84D017BA05E71FFCF0700000000000000023F1D87F4CF5E7A9D409F67DEFD87E427063A10793EEB59FF99AA68B95475EDC831DB5FFFFF001DE1F8236D",
-"00C0FF3F50D4DDDF98CD0FA9665AAA43C46C2C932989571EF96E3ADD17C62A8D0000000078913EF8F4BC215FFCB103D2EA13C7FE61610F71992E92E7E2B0132BA67C6D7C1335DB5F51D946199C6D2ED5",
-"00000020A410B6D62B090613BC9384C4185635B05D5CA7354D0E72201900000000000000F09F1638528BE5387B5437A9977E01E07A362D5B95936BD7C2887AD95015E37E5D35DB5F51D9461919525AC4",
-"00E0FF3FBCE097E5608E190246CF65438E50DC1EECB215F6B300C627000000000000000051AAEA11F7B4D220E7F531BE15D0BAD42E1F7AF2A3D4E4380C47B02CD71EB8E3EB36DB5F51D946194B24B79B",
-"00E000201982DC7A79338F222547D430FC87FFFC8E78B0466212AFF24000000000000000CC6A253001209484F58CB785108F7E6D573197BB456691207CEDC7B2C5BE00EBAC37DB5F51D946190AA48134",
-"00000020BF87ADF125644967F526ED1009D19382F9955C7D0963E22C12000000000000007428765618B0A316989393BC454C29B503ABA26B5F1320B953FE9AA2A1F61A43683CDB5FFFFF001D9C4650F0",
-"0000002020BF1E1EE2864D704111753B35A2F1EBE55F027EBDCBC53D1CB03C86000000002307F0013332BBD45B6772FC8A77EB79A7B32ED7CE6AC9272DB0FD2DC90164F9E13CDB5F51D94619B2F73244",
-"00E00020B377B6EBA3F7708F30359F37D3A1A275829A47A91268FAC93F00000000000000A0BB78A322A7705D4E2E3218A903A4C976696E466A2480E9DD7BAED4C6FA654C433EDB5F51D9461989D1DA25",
-"0000002086D91EB937841709D876AA9B4345FBC65BDE89887D3FA7DB03000000000000007B5BBBB9ED7A18A2408ADED1EC829F9AD1A2A078DC6E7C27F67584DEC81657E2723FDB5F51D94619AACEF50D",
-"00E0FF3F6DDE5D88B183056971F74D3CAE4912BDDB3F190ACF78155D30000000000000000B118248318CCE5CE6BC96EB90B8C651A77DF88C8F9D66FE7E334F57A9D832DFD53FDB5F51D946198E83BFD7",
-"00000020AAD335E3F12EC6BA2428FA1D6F35697BBA95D34B0201920E3C000000000000007D4A4CFDFBAE0DB75A137C7EF43A93A937B7A66F4E5AD193E03257984767C195E741DB5F51D94619E46EE0A6",
-"00000020F0E14C1596FE5256A14D5E108A3ACDB076385059223307393400000000000000495B87902535644689AF73BA2390A7268635C492624D8245C613046D7A363C10A046DB5FFFFF001D4B175647",
-"0000FF3F0DF9B9571558D3867E272B451A115872F4CB0E9B750192302DA6339800000000CF008DCEBC2EF389A5D14F640F8C2C45A8F930DF46A80AD096C6EE984EAA52F90048DB5F51D94619F7B38779",
-"00C0FF3F8BEB5384100B1DCD983A2D63586EA161CE6D3BB85A4095C116000000000000003B17D98FC313794E98991A3B5869AA8662A62FD18C8EF0200D2E363FAE4DA574554ADB5F51D946199769BF7C",
-"00E00020A7F54533532B618A89BF100F3F44FBD4944C1009E6E4DD882200000000000000BAB223A287D2BAD9F6094542A711686CEF17FE3D4A6E78A6FCEA4E57D54ACE48914ADB5F51D9461915B92237",
-"00000020090E88E960B22DE5B355FEFE5563284E55DCB09CBED2AA2945000000000000009013F33D6B3238083E695DDC2C925D0AB6FB45269CBC477136BAF8F5BEF5D14B424FDB5FFFFF001D3A0B0F22",
-"00E0FF3FEED4FCA9F868A55BA9F20472DD1D77669E4361172FEBDB2771447BAC0000000049275D3588D958CAB7772E2AA7E49460AF0826713EC3BB2768B31E30FDAF6B0F9150DB5F51D94619B3959979",
-"000000207377DC7AA9405C1C28144116972A9938461C300DACA6425B030000000000000042D4EEE7EA9817FD6CC4CDC2D81ACD9057ADAD1213B4DF56EBC4B88427B6668AE251DB5F51D946199976928D",
-"00200020C63BC9514F93F353B5B35753F76C39C2FE137AC90307192D3F00000000000000EAC5AEF08B41E3F6A131B41F9E78BC375B978BE6C8B134C5A3348CCD4D250CD98852DB5F51D94619E1E36669",
-"00E000209A1A34BEE88A25E95CDCC6B7B16332F9D3A29B9D43714D8F1000000000000000F2218730002481953901365910EE7A679188DD38F43059F93E6688C6DEDD24F42D53DB5F51D94619B120B9DB",
-"00E00020B619375DB1848A97C939A563D3DB9892DECDBE6B4E70A1C71F00000000000000DA68D31CFC4EE05A410A685450B9693B4540C261A1FA00AE51164830040B69053E54DB5F51D9461941FCDE9D",
-"0000002033E73628DF8E00973083CA4848A2434CD1C2BCAD9077FEFD440000000000000070396A4E7940EA719F7A2B844DE055874B00E3FE2BA29382C7A531256B7A16F87C54DB5F51D94619D3A7C66D",
-"00E00020ABF0929478BD53E6B4762DD61C33138DB49B80D39909F5E40100000000000000DA542B077636C1CAF3055336314873C381E2172D1CE06D421F88E7AE66810F29DD54DB5F51D946195E05145A",
-"00000020E0D6984AE59B8590C5FA3CBD5E75B0F3ADC23F6C4D112665130000000000000048D3E667DF72FC689A69E2A57C75896DA57E8A7357468F3C4BD3E81C8574A0F32756DB5F51D946193EC753E8",
-"0400C000CBF76203D7A76B1DB97E8EFB2FD7D9F958876C279C588D8B41000000000000003CC36D5B2DF04DDCA62E65D522013AEF796AE3CD529F03F47B7FBF80F66EB754B156DB5F51D946191D02B306",
-"00000020D786CD7ECC3E420547C42177A47AF303E663B409BA6C116A190000000000000055DD3097C4F9D473291C0E74614F5492F75F41320B9E3DFFF23D82C76EB36A5A6D5BDB5FFFFF001D5B5BD71C",
-"00E0002005914A557CFC59C081F790E5A2528BAD41D6A3D98CBE072BF87CED230000000063B1650C631A500775C996A5AAC3AB94562248B277974A13481E67035AD9E552465BDB5F51D94619A30E8D22",
-"0400C00030EC9939694E824D8C8943A3307FF2D651234A56E43E16BA40000000000000009BDD5082B5BB950753959337336CA823EDDBEDEB1BBD9CE9CEB59B76B1055433AA5DDB5F51D9461940699BD1",
-"0000FF3FFAC717705DFF249A939E2C8DBB414A7D8B1D4630703F61F2310000000000000078A438633B50D812CD10B8BE83F22824F5EE05532B462F312E7B37B3188404C36460DB5F51D946190FE9A3E1",
-"0000FF3FD2C113C67ABBB2D737E1BD7793E04595BD6F70FCD8E15BAB1400000000000000EFBBEF747CE15750F87B8FC112E0152274BD9197D64934476FF99741B1C13FE4E660DB5F51D94619ABD79475",
-"00E0FF3FD29A31784A6C07CC9EF65AC766DCD092EFB45552B9BB674843000000000000008D1FC3918FEB293169859845F0E81894216068CF224FFC57D36F4F892F6CBC5A4564DB5F51D946192A7ADB2B",
-"00E0FF3FD7CE63335D651108EADA0BFD010026BA61D12BD9DDB8DD33330000000000000096FEDABECB32D9126EF9996EAE42E17C95D4FDC762835EE456714CC9D04088427166DB5F51D946195641CC2B",
-"0000FF3FC82A690ADAD8B0903338C6E13CCE93EF55EADDC46F59360C2700000000000000FD79E7D9AE4B9D1DF4180D8200DF6DC11519C41007ABA55AE9C1D47260F4868FF369DB5F51D94619EE319CC6",
-"000000208F4631021D80638A8E287714BE9B102887B3BD068DC885B90100000000000000B0206B7A796E55C26C55A91461ECDF3044A443016246DF0AD03FB35E5D131357AD6EDB5FFFFF001D4E80A310",
-"0000FF3FBC4D934EC3F80ACA28D005DCE4F4FB72FDE85E2652EE1F78DC4ABEB8000000002B347EBA745DE354498E447D6716E4CB327797CDA6CEC89000507FB1AC25E3359A70DB5F51D9461976CFCBAA",
-"00000020F24CA4B0287FE771680BCC3FEFD91CF03CF6A9980EEB928811000000000000001F6D083A0E5499BA7AD0FAC5C8E3E6B8292D2A30393C1D8863BA3625756D7198DD70DB5F51D94619AF7C5C4A",
-"000000207E239E87765E9E5F3F80AC0904B7F14A4DC547F4FF4876293900000000000000D098F558AA97341AB3B0FA44082438DFD27C818EA698045487792AFF98D8E85B8E75DB5FFFFF001D05820A9C",
-"00000020DBA458FEBF7C4AB49AAFA5F060E82B0493AEF21FA94BBBB62718937F00000000310D7A68200DE97B4A9AFECD2CE08AB1E34CA928AA1A3F2E5009F0D9DCB03839AE75DB5F51D9461946F40612",
-"00000020EBAAB5DCC73227673CE5BFEA7EA21DB8F05C2B784522A4EC1100000000000000493EEA3435B335F86F2EBEFCF32E9799F672EFB0A9AA6295CA09A9F1A8C720165F7ADB5FFFFF001DCF9400D7",
-"00E0FF3F5D5ADD75B98703D43BFA7A547B61D110115AE790E1C956CC4881E94600000000D0A96CE742F67B5A9E16FA3889F335AA0190C70263477D0853642EEA481A00E2DA7ADB5F51D94619329C9403",
-"00E0FF3FF57A1E2CA54BF66DD7C70F3BEA0EEC771862BF8AE1320CBD1A00000000000000D1F84CCA8CCFA8BB658B8CE0FB0243C3B93CE4A16BC2D637866C88737BBEB5760E7BDB5F51D94619C02F14FF",
-"000000200E4C1A7A4F829E163D3BECB06221DBA9A245F3707C67973733000000000000001601F35D3B288F295C78C5966F84A2CCC6E13F75DBB10868A7B0AD5566BD584DE67FDB5FFFFF001D6505F618",
-"0000FF3FE86A82D73BCA089F4FBF97699EA711BAE0FE181716B9736A35F47CA9000000004F7A6A014357B20DEC1B181727F79428547AA33D2CEDDB72867B130D2D831F4ACA82DB5F51D946196AD50B7B",
-"0000FF3F6E662ACF23EFC3705591D1873BAD6F9E5E30BBFBCE40B30A20000000000000004C17A0251788DB42E520E1AF38E8C698D6DFF237423545BFA71656AF582BBB410085DB5F51D946196CD69958",
-"000000204821B649B8662E3247C3A075127C85C1BDB5A7629BC4218C2400000000000000FAB33C2514076B8B79DABD9224BB1DE4E0124E3DBE968F94E47B4FE7A9D32E03BF89DB5FFFFF001D00802F2A",
-"000000208B0F1E308BC63E38945692ACC64CDA38FB5F9DA55AEF4B9283D90487000000005FCEB0E2DAD589C8F97C230ADCDD35BFAE6AABBF1560038FBC83CA5CF1BAAAFCE98BDB5F51D9461966307361",
-"00E00020745E651784DE342B9AEC1574F3A5DFCC6773E5AA5841850E0A00000000000000739C93D4D696C9305118E357BF4F89B183F0209818BCDF118A956248208E0DAC678CDB5F51D946194504BD5C",
-"00E0FF3F042EA22AFD4B121CCDC24FBB0862FC3CDEAED9BC51C1FBC52D00000000000000B342302C4B3A4524304C7887336D1DF36C103F2450C67C632AB49FC207D3623D948FDB5F51D94619C35E0A58",
-"000000206D672F4ED44E2E0301B7303DFBB83026B4E19DDB163CB41A0600000000000000F3DAE36118711671475C3482F2E5FC9429936ADCE151B5323B04AC61E4AF52DE5694DB5FFFFF001DDA052D96",
-"00000020C07C18508FE6739850BB9331F31F27803EAD4B561AB651F342A0778000000000BD34BEC1CA5D8437E7D145D8D8390ADFCBF10DD4E0A3567F5386228D50F53D670795DB5F51D94619C239A00A",
-"00000020A8E2B04B8D4088C4AD7BD155F258D19E918C3008413D4ED82E00000000000000CF2462C7DCDEF177556231EA4FF969F6448248394A73766E1A0EA14E63ADF13E6595DB5F51D946195D18D5FF",
-"00000020A5B3DFB7211D44179B6CB4CAB6F07F4927291418DE7264A71D0000000000000053B68E4A062039066F93EB26B085AC3D22CDEB5A9AF3068260387D111E756E17249ADB5FFFFF001DD95BC196",
-"0000002078F151003DA470DDF480400EB610342E3105E4DA667CF777F26E182000000000186D6ACBC7070806B7E89350DC6A06317F3D70CF216097FBFE48CD5263690C6FD59EDB5FFFFF001D21017B6F",
-"00000020A397F3BA6F4D44025B210C17B1CC70AEE0C21270BB5E0C1CCEC62E8C00000000FC35DB275981107944FC83451A9B1790719C519791635D93DABFDBF28FDCF72B8CA3DB5FFFFF001D29945635",
-"000000207CC9493EE2BE2387844886C8C23C9DE362CC208D27C9C988145D0067000000003D5AC14150E73CD2CA1515648782B6EF0F2221F827D3431F3612D74C01E6A44E44A8DB5FFFFF001DEBA7F68A",
-"00000020602CA256978995458CB898544EA6D5143A3AC3139AC595883DF9F6BC00000000F8147E0C5DB8D0FDC3D82C1F459DA6138D4BE1E3D8F75F1288512BD9415A882225A8DB5F51D94619DAB91C9A",
-"00E000202E1B6494F6F89B1E1C3EB56F9529D4D54F1FDB6C2D8E01452300000000000000189733F18E874E0CACC547AFF6AE3B823ADAA467635FF0E2DA02C439ACB4B4B904ABDB5F51D94619300DCFF2",
-"00E0FF3F1F23EC727C72DF0A27B9CFBD7D9CF609BA3D58D1BDF430000D00000000000000149553A8F4EA6DD5DB90A4365F83ACDB3C0771298986B84E0EE0F41D5A413D99ABABDB5F51D9461983809BC7",
-"00E00020A91B25BCF9734D94BC8EDFA5B46493E774581F650D3D66D438000000000000009974EEBDDC7A837E4399A21C62E9C34FCDDD3FC6582AC0779DF1CAA32E6ED868A1AEDB5F51D94619E8297664",
-"0000FF3F3B2CF8D94766B50F13616E98F6A3409CDFCA614D1C39BEAE0A000000000000000146387A2FE611F26321015303FED9B92603F445D612416F3B65EF907C70524501B3DB5F51D946195C8B36D9",
-"0000002091CE797E443B28A4098F175DC6C1C16B72D33CEA135021070200000000000000846D8E412756F293B853C42AD698160C40EB3C6011CA87EDD3741CB4C8D1A7E1C2B7DB5FFFFF001D0C500EF1",
-"0000FF3F32EB9DAD9C01B6159414B567D745F5B28E3FA5EA181F3CE31B80180300000000CE3EBC20954664FD4E6BE45F00D4195EBE734FF65E7381BB0FFE3319B79C4380C9B7DB5F51D946192FB8C266",
-"00000020A84F273D0BDB3670792D4C2BECCC25990ABA3FE6FF5334D33700000000000000BADEAE56E39438455DAAB8C9BECD5ED9E7EA93C396C008EB4A0B16BD80C43B2076B8DB5F51D946198E559988",
-"0000FF3F5D86DC5A04E0E9409FCA85D0F688425B14EEC06269BD98F52600000000000000BFAD3B5E0D942D052D978685DDBC0997CDC78EB3246320678F449FB257250ABE69B9DB5F51D94619E314F041",
-"00000020CBF75D17596AA95F5D6B143A32897519074E56F7FBF5FCD543000000000000002691FD39E8BB2A98206C55AE2FDF86E9D2132559F6DF72A91F45F7C6C21092C736BEDB5FFFFF001D4281E103",
-"00E0002053600AF1AFA2ADE1347C6A71D7C1EC854775669DF10E9C419C8C1B49000000004151F228E1811EE20CEECEED21162CF6A2CA65C394FDFE7FB4A225CA1A34F0B117BEDB5F51D94619369777F1",
-"000000202B17A5282980E7CB6D47B8C984340B55CE68C7B33F99F7253C000000000000008F640B004A6B933FDFA2C024DBCA4090D82FC32CD24FBA7832F73B39A8F81BC5C8C2DB5FFFFF001DA0ABD6B0",
-"0000002012339439A77BE007FB0C734CBD99A0EE4655F7ECB438AF43C0A7CE0000000000F09CA6B447A5935E06F6336954F3994DF6881722BD4EC9C0E25985FB886DF8366EC3DB5F51D946194606FA54",
-"0000FF3FABB294CD3AC1D2644259164240A141C9EBDF450F28879E2B180000000000000027B887724F9FEE8EB7894897FC8C14D273BD14D5EE1A8228A617B01A7F6FB2FCA9C4DB5F51D94619FB024F1E",
-"0000FF3FD2BA1F5F1F39290B02655DDB599053B38E25EF882DE827711B00000000000000393C50C219C4D31C4B7CBDF7F74EBCD5F55ABF19CF33F87D846F04A5D75EA663FAC4DB5F51D94619430850AE",
-"00000020A503EF68A81D997BB90544174AAFD964F7F99651A7B5C5E022000000000000002F3D129B3EFCC194CFA4D1B85F19032C373536D5FFF177BBD2B1B2A29B94DC6D6EC7DB5F51D94619B22A99F8",
-"0000FF3FA032B2DDEDCD900AA0BDE77A2DA1A6C8CD94BCCE12DBF26E2A00000000000000DA067515CA36914FF6FB34E16E24EA4CD357F354EFE501EDC134B35DE0F354D01FCADB5F51D9461985157812",
-"0000C02045F4512101C286E5FACB0F973EEF686A9ADFFC344D6753E40D00000000000000A7A8343D1882415AC7211CBF68BBDA1AB290C27C05A3449D0ED5FC56057F07FFA9CADB5F51D946191DAA4A01",
-"0000002066DB777E435022626F769A3541FCD9BFFAB14316B3B06346400000000000000031D98EB13AFB4D9074827531E77E301D8B71C2F875EC542D1A42693C743DF7BE05CCDB5F51D946199C07AD78",
-"00000020786D21872269E03C7896E1BFF053E03822DAEFD1BCE114A32A00000000000000A05CF32E9E65EF1800EDE1C9F258EC777F0CF545D9287CBD5EB97210C657BF94C2D0DB5FFFFF001D24B4689F",
-"0000FF3F29B66547FB9A0FC289E645DA5AD7BEB3B1A1CC610CBA51E70BFDB9F100000000901CC721A7B8E7EC1742D364E73626AF9D0EA9FBB88C2261891742F588D6E60388D2DB5F51D946199A4F5D07",
-"000000204F5FA93EB4543D675E643183CAC605281CD0EE5CDA8F046E16000000000000005A6C8387D57A1987CFB4BF49A9D0FB16B88F8553024D34FCB02921B79A306025C5D2DB5F51D946194A2CC678",
-"00E00020D24BBB8ADC3812830E0293426869A6335F2A4773E51D97153F0000000000000036B30456850FC321DE0502A3AD227D05C3CE95ACD1434A455170221F888C34EA74D4DB5F51D9461902DAA968",
-"00E0FF3F8A1C1C36B162C9E754E5769EE841C03D440033B2C58502693D0000000000000077BA75FFB8364852CF2C045D7F84EDFD9F0B5A7EFA573B6E36AF17D1E1105F2808D7DB5F51D94619A719BBC1",
-"00E00020BA8F308BB375F6C6D9E2CB4E2EB120BEF10773F777CF4A6F370000000000000041845552FE11598A1C95665F48034B1352D68927E7FD82BC0A74EC175B0626BEC6D7DB5F51D94619BB45DCD1",
-"00000020995471A582E4C028C8E0F18754E865196963D5B85F41AD6F3800000000000000C62B0C992D40896548B409BD4FBCAC914B593855D9B6687198E0B37FE0561A6F82DCDB5FFFFF001D4C9CE30C",
-"0000FF3F52EBBAD182E397D9F4177840B24D3E8FFF2AD565092E23689730F6610000000096A70965BC88622B355F96AF7E6F6D87C3A7E2C9D5A7810B1723BE0F7083CF7AC7DCDB5F51D946198BCA7277",
-"000000201FF0ECAE74C1A8193625B035ED38165DE2DE729998B8F79F43000000000000009CF0933C2E53A33C207938026307B0F4C6F0B14D3AC9C57BA48DA5E00F7A96FFF3DCDB5F51D94619D526DF85",
-"000000207B3D26E792CD7DA8A54AC9C74C0FEB651EEBB12EF6D0AB7B12000000000000005EF622B35A9F94EF116F9BE339BAE0C42F5D0A30A1325D6941D63C9575C3242CAEE1DB5FFFFF001DE16132C6",
-"00000020F4CDA557F13C8D086A8982CBD4ABD1EADE5EE1594E22CCDE9BD74C2F000000001A183E2D818D0B4E3743DAECC9FA69C1FE12472CB3823D2327154B009A9CDD5A68E6DB5FFFFF001DAB780FCE",
-"00E000200DCC9E5470F4956566775C84FBA3D76BF3A814D58D2C73DB75565D5800000000074BC592A5D31401CC2464AAA9CF6F9CF8EA763812F141F901488500D33794A1DDE6DB5F51D9461963E6EE67",
-"00E0FF3F8BC20717EB4EED38C847DC96ECBB535460B6035F35DCB5F00A00000000000000C1FF77D91201AE2972509CA17E46AF9B4AD80ED4D54B0D1F1810E9045D024690E8E6DB5F51D9461932CE7648",
-"0000FF3FD7C40C9E73EDC371626808A802CBEF06765295B1B45801760A00000000000000C8ABAB4C1B4732CA4DB580764CBBEE080CF5865157708BAC104232A6B82DC1B305EADB5F51D9461920321E4C",
-"00E0FF3F6D046818360A34CAB153358EA6A13E34BF166415CD1DE4D22800000000000000BA43A54B294B116A5DEA121033323220EAB90110946FB1897E47BBC34E9553FFCEEADB5F51D94619AE713FF2",
-"0000FF3F5A01AB00E806A5BD896EEE814FFE0749CFBC3B72D23B657F0400000000000000E139813032A78AAF63C454C6BB575EAE24AC347245F9B907CBC1E37791D3F1AAE4EBDB5F51D94619B659552F",
-"000000206B103E0DCE591AC594C909A232E43F647099460F9801E3182900000000000000966863B1EF6FFBBFA29B85061C941D10322DBB053FFB7AC894456CDE1650BB8F96F0DB5FFFFF001D000B81A0",
-"00000020A41AFDE8E6948248070670CB3C613476F34A9AC7172020F489A75693000000000FBE444435A0AB97A9822297C78B6ED056EA3D2F0EC087C070D8FA3B550ED723AAF1DB5F51D94619E532CC11",
-"00E0FF3F612D2176CCCBBB5EC644D7A383AC80D7C73EF8208BF098694600000000000000D9A81C1F40CFFE40D1B8E737F495FE75C2B998CB61CC8B682C6FAD9D2A5E2399BBF4DB5F51D94619B4379683",
-"00E0002001146987BB1426E92C51D17D502D9E5658EFB6381373ECA92F000000000000004DA80B4A378669845A49A8D47E6DBB523426A36CF9D317DF303D5EE292BC7ECFC5F4DB5F51D946197874C536",
-"0000FF3FA2C849C47826B97D5531EB8987AB5519000E7D94244B6C622800000000000000613D66D71703EBB47C3B86506B19FF800331B9D193C7538DE27EC3DECB361089E4F4DB5F51D94619DB411D11",
-"0000FF3F31971C50FFCB488617D12C6CC250696C1883FC32E83427E03F000000000000005C5756F4A46A7A59ADC3CD6DB6A82C0FA351C6383A1DBF2A18DD13C071FD46E30AF5DB5F51D9461977448DED",
-"00E0FF3F1C367CE7B2E14EC03E4C084EFF44618575FDABEDA37D353B1D000000000000001E720F077184D65EFB81413584817F065D9EED64449A7E7EDE69F8A6F9364CB267F6DB5F51D946197D63CA01",
-"00000020380320F09B1C0AEEF1F03EAE1629EFBFE18CE6AF88883DC92200000000000000065B63F960A20EB73D459ADDE0ADE7EB6780F9175C72EE8D623A2D4781CE47AD1CFBDB5FFFFF001D13B10238",
-"00E00020566F06E119D6A0BBCA96F3688E4FCECD3522DB52B46ECFE88958EC3F00000000A32E1EF64CD86620C779F8AD0C9AF356E55B05FB97418F1AD0ECF00E4D02DCC4F0FADB5F51D94619AFD4E180",
-"0000FF3F7AD3A9F40ECDC5418CE8F6DBD080472419BF4D3043E1F3022A000000000000005B07E1E2914C249C752276E310D7EBC7558B837C71493A76E62DD583FA558DA1D7FEDB5F51D94619B6EF9F03",
-"0400200064390F6666F6AD13A5FC82D58437DD94E98FDAEE5F94401C3900000000000000FB025251843DC2A4A21766FD6F6F8A7C4AA2DCA67EF86DC67E4136D2B159F75D7300DC5F51D94619518F88D9",
-"00E000208E00560DC2E8497B0EA89BE883B7ACE8B028E3DB579A38A4210000000000000084480E57DC88B921510695B7E754298CEBF54BD0CED11625402456B15D91E7649404DC5F51D946196AC27997",
-"00E0FF3FAA33EC2DB7A83937665F1962981A294E1786E770DFB41172070000000000000088F99AFC579F46CD9993CB6C10CFB6FA939B58F490A8029805EDFD89F293957BB407DC5F51D9461930ECCA90",
-"040000006DFB48B2CBC5B401CD2EE918A00CA82566C134D12B9053FD3700000000000000483CC270ED9739E3388DB7C9CE043488917B0F31A738A20B559A4E31FCA29E512F09DC5F51D94619464FD0CD",
-"0000FF3FE3FD07194A678F94853279C9968666FE6B694D6DFFD439233400000000000000DCDBBCCEB7748B7B61282D07E1D65B48CAFD5BF05014F43A3BB708C5352AD3CAD50ADC5F51D9461989F563E4",
-"0400200082B4184D6C9A93DD76C9595BC402AF61430AAB766E450B2800000000000000007F5D1F86BA351ABE60E9C24515CD2B79C6AD3EA478CCB6C4DBC080DF625E0A54960DDC5F51D9461950277476",
-"00000020841B9812B5D476E62F1AE64EDE96C06524ACB99FAEEB10620300000000000000B0BF8724F493BA9DEF09C09E149ED1812FF5EEA15145102C8FC981162C24E523C10EDC5F51D9461956798B5D",
-"0400400073C049BDFB498F8E52CA60E79CFC766E2A4AD57D4F3E3DB13600000000000000C1335671779056F2F379AECC5B962990F8581122FEF5D326D520C67E9724E894E60EDC5F51D94619AC1E58FF",
-"04004000266200E393C49E0D6E2DB1B3E5A7C9FD5AB5B74B3EDD6A562A00000000000000FE9A32D3D1C543023FE616FAB3DEBD5B39B4342507366C69A9F93E8D051FBCD5630FDC5F51D946190008CD86",
-"00E000207BB1CBBFDA9976862F5FF1D0389ED2ECECDC59261757ED742200000000000000D5FEE9F2F6C1C95D038C9BD6243E40BF17B9940AD6EAB200B8744E105EBCD6DFF00FDC5F51D946198FA9D139",
-"000000201017EE59B01224D0C9468E7D0790DA5BABD6C6B06474D9790B00000000000000B7AC21FBF3B05447E64DCD75B19C64DD2F810B16F7445CE6BCAAEBEF0227A3189111DC5F51D94619ACE30A6F",
-"00000020786AD62DF4FA766203C3F8A7283D2D094B198E43613CC4641C0000000000000090D5171286D242E7E303CBBE4DCA6B72E0C40FACAC97E35F57860557A3467F090F14DC5F51D946194C3A3BAE",
-"00000020C194880FAFB3FB6F5294E8BDB76E0D378AFE2262EC91364C2D000000000000003DB4F9D594F7B97CD5B0C42A5C56387307D08CF7353F151DA2354AEAE68D2F8B5917DC5F51D94619DE8FE1E0",
-"00E0FF3FA225B38554118C3EBAF534E0EC88AC4F905DF9650168A94B3A000000000000003DD7A6E3417B2C772035A623B8E89948C2E70121872FF22BF58721F1BB3AAC370918DC5F51D946192A725C38",
-"00E000201D9DC2BFA3FBD9EFA1BD82CC58D928624699C00717E11FAB21000000000000002CA61E5BAB74D68F15ABD3081D325151EE68025127BCB4E86F3CE06F7F5D79C48018DC5F51D94619A05B28A2",
-"00000020B594E9435F4F0AF498708D9651CB55F7E7CF578A02A95C734000000000000000801F3B4C89459CE671AC7FC1914738065F03958AD544DE9A2926421D78AD1F57401BDC5F51D946190F148295",
-"00000020E79AA6C3BA37132DD9A186ADD125CC39A24B767E924690EF17000000000000009B92E3E40F0D27B15EF810F5C3F6D1DF3506715416C54E7272BB1180BDF818665A1DDC5F51D9461950A0DA26",
-"000000209E42CFB1C34316CB1E9A74EEC69803EC8F1F6510B3DC93C73E00000000000000324188142E318FCD6893DE54B3370D2D5ED81CB715F35794C396815CD95B6E9A2822DC5FFFFF001D4B4E6CA9",
-"0000FF3F1AFAE29CA960A6F3B772D52D6DF1A59C28C6ED7381FF32D6E8D1E1DE00000000DD292AA8615508FC990FA7D25185EF5FAA2ECEE58413B322596225979E7524ECD623DC5F51D9461958DBBE05",
-"0000FF3FFC0E5303EA8B759EC8433FFBE7F968DF716119A09C12714A2100000000000000DC46DEDEBC2498A15CFA4B014F9CF163CED5E478AA70E1AA3A6ECD7BEF1F253F7425DC5F51D946197BBF2458",
-"0000C02044DDC95383F6DB81CFC44654CB7D31E01D54BD292117EA1B2A00000000000000CD804878AF9ACD4BF8F6CB888A9D2292E55750F69B26F7B87E3A05539AF787CBDF27DC5F51D94619C56AC495",
-"00E0FF3F372F17BA68F70CDA9D2BCA5D98A4FCB3F20941333D22AE691C000000000000000B69DC14B38EA80C70A9174D0CF2F220FD7FAE7CF719D778F1AF8B8888D5D5137128DC5F51D9461932D6E6CB",
-"00E00020A8B9E88F45E3D8DF5F243FDA0A18BDE926E60CA01CCB296F1B00000000000000A5C16DDEA2838B1E9045D1D570A8659542C0541909309F51906E9801E65968A9432ADC5F51D946199FDCEB78",
-"0000FF3F84F1B53FFB48C3F6E8914ABAF86AE2631C6E06BEA8E4A3600500000000000000E580E80F3D830B10C676CBC6628A64B34F97DFD44AB9F6158490D989EBEA59A36B2ADC5F51D946198BBA0194",
-"00E0002054866276FBE8073E2232260D2D1AB51DFC42FBD5D8EA395D3D000000000000001832071EB6D0C61BD8F08CE7B28D975BC36CE438A9971EDB20579436C5D35B91512CDC5F51D946192A32B53D",
-"0000C0206AF47B1BE2320FC17BB2B7FDB9F77E92B9ADFBFB08A53EFD2900000000000000BB380D34D8DF463BCEFB6EFDC3C76C2E7A73443B1C4F40310948CED93CDB80B2792CDC5F51D9461999E9BB94",
-"0000802078E2426CE9A4128263C30FABB894A77F60F445B58554FF2A4400000000000000A97A68B5E30789A0F174CAD371325FC26220D74D549406C8748DCF2F0D60B440A32DDC5F51D94619B2595E44",
-"00E0FF3F7D2AFB87F2C79110FAC05AB317CE9BB5D05A8C97B24572710400000000000000E9407FA350F980717259447BCF18A114307D8D7E071C97E51E44D96218B216BCFB2EDC5F51D94619FB728EF1",
-"00E0FF3FE340FFA5AFBDBF2C69C3AC8CFC4A2FB5B63330DA7920297342000000000000007C539461FC0AC02FA994CFB05BCFB3479BD881E10237ED4337E4C96A3567D88D8C30DC5F51D9461956DDA754",
-"0000002057D6EB1A2C586AB034A592E1A8B4FFA8076DB60AC592A67E3F000000000000004B542E64B8A052017CBA6C9EE735455ABBBF36EA0DA6799C6C236A94F7B975366935DC5FFFFF001DC78F8868",
-"00000020BEED9C7E7B57177DDF8C537231EFCFFF9F1BA2F26B476D9E56CD01BB00000000D180231F11D6B54C81B3C14326100C9E900B930FB77DA192CA158BCDD380EE36CC35DC5F51D94619776F92CF",
-"00002020CB3EBB05EEE0C86ECFC754D0EAB6893F6CB8489F2B57E7290A00000000000000D422BE5DFE340803C339464463507C15953E5C22465BBA0AE6812A872397446BC436DC5F51D9461994CF7FFE",
-"0000002087F5BFAD40B47610C67C89F4E0B583CF8FB6E45D82D982023B000000000000005FB4BC14DE57669B2ECE460B8CD294BADD58EB4E67335136AF0515098667BC1FF237DC5F51D94619363A0473",
-"0000FF3F742A3D85145FCB8BA6359A7878B0EC24CF893AF13DC7C4583E000000000000007C6C3818872F5549E0EA0366128AA69F8801423A650126425628FBB0164EF4DE7C38DC5F51D9461999BD8FAF",
-"00000020CFFEC8F66638D24E8EF20620C11EDBBCA020CA0C28A571320600000000000000343AD6F5E152C5D3027AA1213CA5A16B792CE8979E22F4565A8182B992E4CA6DD239DC5F51D94619D5C7CC0B",
-"0000002093E1540C962FEC7C39C88344772A5D317EB76551B81136FB1E000000000000006317B5420AD89ED06E95626F4BAA4E4322F4FE6BEFEC63524A38CF1068FFA56BAE3ADC5F51D9461973EDA8C6",
-"0000802063432DFAD531DE8A0DA40AAC354B360312C3E6D707D7F5120900000000000000E5952CC860DA9E815A02D3732A4866B86116798BFB5490B8C92A733102655902573CDC5F51D94619536E509C",
-"00008020A636639AE3B61D5ED3C4677CD62611026F44DC5DD8EEE6781F00000000000000A7ABB5DE464A782740362706973D6CDFCE1DD25A5C5EF2AF5F63534B608D74D2723DDC5F51D94619102CD259",
-"000040209B22112EAC835C595D8D2742D4907E652FC1111380D09ADD15000000000000005EC5B4761B88CC47E3025781B5B8C8606CBA629BDA527545A81C054B72721575413EDC5F51D94619C288A214",
-"0000FF3FBC290282CD7B125FF25746B5932542924F112D0A5319A4211E00000000000000E09AAE16CDF4C97929AAEB419A9D2B889C6DE925B6F859B08C2933C501DABC006440DC5F51D94619982754B0",
-"00000020CFD6BE0D7E6978F893D64F64C24D643B2C6810F74A3718E11D00000000000000E8BEDE87707DD46DAC610F725FF941119401822C8DC87BF1771EC1A2C9F5DF0E5B42DC5F51D9461983E1CC7E",
-"000000207E29258A26FC08ED4147B7F2A99C24E625C3C8FAE0BCE19813000000000000000DD4FF70D58E4FBE10D373FDEEEE5715427134524F9F26E7B440D91811819EEF8B46DC5F51D9461909169A4C",
-"0000FF3F77582F545D6A6E6CED90346D4262393F5C85F200B262EBCA1500000000000000A4C1EA3DE95DD38E231DC344F18BB715658571ABDBC4AFB23F664DED34B5C264C548DC5F51D946197FC8BC45",
-"000000203B7F2DA7A2C3FE5CB5A968AACFC8A0AA11DD2C30FA88D8C531000000000000005C3EA33DA8DDAF5DD2D6AEAB037DD2344E413C3631DBB936B70D28F262D3153C7C49DC5F51D94619BA85F5A1",
-"000040202253D19F056A3888416A34F6774A124D8D44A1AF9BECBF333D00000000000000ECED3EDF907E72C6F65E1890302B349057DB829394EC4A4CCB164D15C327274E264CDC5F51D94619C7EB100E",
-"00000020D10AEB81F2DC53412291394A738CB0345BF3F06F3EDC074C16000000000000008DA6A5A7F2D1F847E8CCC274F7E273D2D6F0A42D24CD9B2B7864AAC68FC19439DC50DC5FFFFF001DAC9B67F0",
-"00000020C43C26EBA1A3469320AF150B871E75344975335E1F3521130A0AE4CC0000000015B42AB588AE26273A8BE281CA9D29B9BD0225FC5F6F0688E5BC102E08B3D932A755DC5FFFFF001D3053B0DD",
-"000000206589E93C67212F3CD3FE35E663A3860509032B518E0A66B4ECD69D930000000021BF00F70B6E91C112FD64058BFA423DE41C47341ED0B7A93EE319ED03BD18505F56DC5F51D946196F889378",
-"00000020FD8DC512AD833CB9BE1AD0024C97B44D4D661B8B3882E35A0600000000000000DF907BCA4429C636B2FBDA60C92F8B5B147FDB574F7AFC519347DAC7CCA924383B58DC5F51D9461957631223",
-"000060206C86840182F1A498BF6505A43DEEEDA3F0C7F3B0E983775A1200000000000000CB6F664807EBC598A698F84340B85572D5EAD4BD0D379E60B0E47C4E5C4C21B30D59DC5F51D9461922047707",
-"00E0FF3F5EF57AB87E972C7928547C8EC16E8813B33BDD4B509B8AE81400000000000000715FF9C0C688B63BEC20CD372D87BA1801C8067D8FA990704A4C0208079C9D375F5DDC5F51D9461989416F1D",
-"000000207DE1A02389C70CCCE73F50AC91128E2FDFBC2C6DF531BBAA2100000000000000856E1FA12015F0C12DE5FF74042AD97267D586F1DE98DFE20024B5D505C3DF9AE35FDC5F51D94619DDDF6DB4",
-"00E000209779D540A48056EE4A9604B60EA83ED009800B92E093B6014200000000000000D71B301C3D59260E1FF57432A833903EBE6F9688FAC953B77690A2D29E3E3DE5A362DC5F51D946193F09244C",
-"000040205C7D8672EF0EC5E573719A42084B0F84C8E6D7F45D8A8C503A00000000000000238EC6ED4095615996766A26461CAEA224FB17F7C5F7D48914F27ED2D0F26FAC1F66DC5F51D946191C9FFACD",
-"0000FF3FAC4870EBDF180D34E717BF489F20551DDBC75435AFD26A751F00000000000000E4EF6F12569CDDBFBB28F66D53BD5C6DF6E4FB29C6FB5AF33D4DF7FE76B931AD7266DC5F51D94619B6AD5C23",
-"0000FF3FEE06B392258CE3EE3F71D8B135FC5B2BD9550EE76B4E5EA61300000000000000FE81B015519E8BB7648E42838A6E0A3D906C36FF320556E2577B71C887A85512F969DC5F51D946194AB4FC2E",
-"000000208D4B08514E677FEA91C7B6A589712DC6BD4A15F5D94AD07A19000000000000009428A16C6FF6C29193A95C2261010B3855AC88BB115412A6D5C5B478EF05DB52C66EDC5FFFFF001D4AB494B7",
-"00E00020D632EF61F8006CBFEBAEC57BADBA12FA4855E4E517A830D1DB3151CA00000000BDB486FDCD1026B15650BE7FAD8CED4D4F330393F3C6EC2A24BBAF57D3BA2BE0EE71DC5F51D94619377C11A2",
-"00000020324D9F2D0F922780C55609EA1FE7AAEEE9049B0B0F22A83A1B0000000000000016A887BEFCEB5D5E2C5F809B3401B618DC10B5B9E4BE6ABB3B1F41C41D9556748F72DC5F51D94619F41AA96F",
-"000000202AC8B961186816D87E5D1B5BC635D28631C2DFDA3D3223102200000000000000AA3304EC1E054EE89F93D5141F41819B2AF5913FA2420E523686D0552EEE527C7174DC5F51D946196D4CF13C",
-"00000020E46C8844A90F5AA4486FE4EF44CC6C428E602663001D8BBB240000000000000047597BBEA37E2E539D2F1244CB2BFB701BFF688F76236DE9F9DFFF40A328A4223479DC5FFFFF001D59A78CD0",
-"00E0FF3F2A30F58BD8CD826904A439767626E92E223933D53B2025290A5C97B100000000549825EAA87DEB4F74C3C9509B9C4BD8896336FDE9E956580C10725D6584AACA447ADC5F51D9461993A78129",
-"00000020DBB23AC7991A85FA1E5110459E161E179A8ADFDC2BDAE0D92400000000000000A834CF86286FB4C06F180F5E0572BC3085816E71C54D8973699815BDC99BF03DF97EDC5FFFFF001DE57CF9CF",
-"000000203645FCC4059E78F959C066D2A498BF53B5532F2D4B010FD9B19C02B2000000002B3FE855AE3CE13EE901BE90DBA8802BAFC047F671C2536411FFAB7F073CAF64CC7EDC5F51D946191AF02B97",
-"00E0FF3F39C24160E2FB11040ED4668845D066F93D8DF20E7083A98A33000000000000005C575EA1D9A8075AE3D6B826FF302FB4580B7BF0F5B4BBD95266188D879C6FCCFD82DC5F51D9461970291440",
-"00E000201E78431C5201F854848D5CC8CABBBA69DB81CB63F26A05173700000000000000A0D15F19E63AFD7C2B7E2744B1773565F2A455908247B3757B0DCB500FC22A2EB283DC5F51D94619B2278CF7",
-"000080208F743E9B76C984027D42975D06E9ED41CADA7A6054C986B70300000000000000A8144771EB01F035DD5B5B0EA1A9B48C1D4455734F7599345B6005684864E13DFA83DC5F51D9461909D945AA",
-"00E000203A9E6C6342A8B2DEBB43A7DACB5A6989C11BAA428C8D1C43310000000000000067C5B4C2737253C9482360A080D705D949796D42F327BB2525BDDD9C22C022DB8586DC5F51D9461919D11A89",
-"000000204340BCD9D16134572EAFEE0CAA2A3A03C87A51623A2EB0D70E00000000000000CB8281E22E49002B6CDEF1D5A115A2242A4A532149C6635378F1EE3D742FC4A4CB87DC5F51D94619E90004C0",
-"00000020AE1DBB31FD52EBB31774BAA92E7847E75F92DCFB80C8453E1700000000000000284D5FA6D7C3C8C9ABE283CCCF964D8DB6FCCC6076DB7AE7660334736AB631EE2988DC5F51D946191C132F41",
-"00E00020C833519198842CF16E03BA32E42A61B2519347FEF38718924500000000000000FB376252202C5857852538AD7790DCEF10ECD1A535237B5FF645470408AD3FA51D8CDC5F51D9461986820E2A",
-"0000002011BEF4CAF41B9177EB556782546AB89E2FF8B602C943C690160000000000000042CCB1E285D8E20CFA4B542051F72DF95264C420677203004EB6D6890385427FDB90DC5FFFFF001DE90FA63B",
-"00004020E7E7082E9137076FD12DC699C18A7A6769AEE9DB9AC064D0A317FD020000000014F9AA57EF2D5346699E4785B8C557C43FF5A92DDCCAB6727B573124357CC23EDA92DC5F51D946194E6741D9",
-"000080204EAE57F7EB57B12F65BDE2431D60632AEE23FE5887C1D3340900000000000000A97B465425BF2AF8CB4A14961E905D9419D2689DDBE0B994973C807B0CB423898C95DC5F51D94619008FE79B",
-"00000020A68A979B90811572070AB6CAD920CF9756E15C5044976945110000000000000092FDC7832423482C940F45CE464AA782BE97D92788671FBE56561C67E47DB9B53E9ADC5FFFFF001DAD3A6CE7",
-"0000E0202F2F0E5DBE0F8925599EA8DAFAA8F652D75942FD1BE65918A3618BEE00000000815B7DEDB8EB005A07D0927591A3DCE59B496983533987C597073F1E554D28697A9ADC5F51D9461984B56B01",
-"00004020226A81610CDA7FF93ECD92174258EA54D92DE08E567389870100000000000000DE43D3703231FBBD7E5608B551404913076E79F7F22F2DC2054B20A7602BA89B499DDC5F51D946192B535280",
-"0000C02082D31E04270D6D3E4F1B9FBB3CEDF655F7E81C832D4A9B8C2E00000000000000078E2A1A3A2D29D268D6A177F0F1D1034D3939F246618F254EA3B2384BE9C43C199FDC5F51D94619A08C5EE1",
-"0000A020BF7DED330C2917B883486B37B047B77FDDF365BF842160260E00000000000000558A220FCE8C0B53C15A3BA1EBBB0F70BA5C280B61E1785CFD5E5D7E75DA68BF99A0DC5F51D946196A830F55",
-"00E0002000D47F8B8D7537FA346F443380464E8400E5FF7D7852BA1B0100000000000000D848C52B0CCA825185330EAD71107D936DF2819482A12A67995F1396C2E29CC3A4A3DC5F51D9461952CD7D50",
-"0000C02042FA6BD445921C0DE2C0DCF12FD658281946A1FACC2CCDE71F00000000000000F3C4969B60F0230FE79EB698AEE0191FFF27B9D3FB0E91DD286C1D5525AE910C21A5DC5F51D9461903E13A56",
-"0000C020E839D44E4066358DF5589CD0B804F1BEDD71C393539E76F53F000000000000002136A52C7BD731B522D166C0549DF2DC5BCFD55E4E432B6FE02E3C3C069DBE6B55A5DC5F51D9461927D5279B",
-"00008020993292974976D7EDA15D1AAD355ACC3977E547432A64E0DD3F0000000000000003FCD2C49E63482CB16B9630E37DCAD47C7C94BDDB87ABE02B7FF97D020EACA26DA5DC5F51D9461906C62F32",
-"0000FF3F3D42B8E3C5967AF0603B9B16AF3E7221ABDBA98CF01F81F94100000000000000841207C746124D8C8B1269B354FCD378E1526A246C46E2946D6F54A91B352437A5A5DC5F51D94619EC3F7D92",
-"00000020440250977C833DE2A9211DBEF54F273AA3CD347B48CF7D301A00000000000000BC142BDEA4C9DC7B0E147E2773B3AA182FA362A542DA19CCEA4095F32B2819E744A6DC5F51D94619E7B6D342",
-"00008020F04E752022A9C930449E323BCF14A36A2B7D3869C5B4024333000000000000006F6755421443D46FB5CE1746994DDEEC7D5C6EA45BEF08BE98E3EB30226CDB3B31A7DC5F51D946198C93F8F9",
-"0000402083932046C0F62F5286046A8A62D2D4F95AC07DAF2C0010F20E000000000000009B921B04855608D3291413F872E33712812BFF959A32F5BC1198ED9A7778DF296CA8DC5F51D94619006BDFB4",
-"00000020943960E1FEEFC97ECA6E412806F7C11C0A68CB10DC4845103700000000000000FF153E06AE005B580C55BC26B4140C6DE3D2D62C5641734AA7F3CBEE16E378F298A8DC5F51D94619D7E70B7F",
-"00E0FF3F3C8E714496D2550209C2FC7ACBC80786B795FAA82B563A4039000000000000005360017A81D2DDFDA1AFEC428663F2EB2710980FAACE5397161C78D8D7B7D7E2CDACDC5F51D946195CCEBB9D",
-"00E0FF3F6863D1D5DEEF3870153FE1E40E484F3F71E3176D0AA8B8D50B00000000000000AB67DDFE322D01D027A60BAB6A16741A50D0AEF4040C053B7C4D94596A55A16404ADDC5F51D94619EFBE2F5F",
-"00E0FF27A7BCDA89211AF69D9D5B8CA86F96B8AAD5251F925054099302000000000000002D45D28C52EACC7279E4C3221D29A7266E1748CC43EBC15D8F30A2556EFB18E486ADDC5F51D94619ACB4F374",
-"0000FF3FA1572ADF5E317D772D299AB7B9102CADC828E2CAD377E47F440000000000000071842DF09A52F3EA3F46E0344D6FB174D8606C0F136594916F1CED92A321FA0517AEDC5F51D946199B13E4AB",
-"00000020376525A056FB33C9425D8913E1862A31385370D2F968328D3E00000000000000428D82448AE5CD0F565B3C51FC643A0F5D6BED2E8525907E58FE4FE6BEBC47E0C2AEDC5F51D94619ED469CE3",
-"00000020ECDC4F4F15BEBF7D9DFCAE9B8CF6AEC857F055156FBE41293E00000000000000814BEBB25E12A36D9B8DEEB5CD0CBA814358456AF4D94A7CD558FEDB7B4DC6F4BFB0DC5F51D94619EBF8063B",
-"00000020FF489FC4C6DF8E9F6699D625E2899FD3177E3DDADC0A2D0D3800000000000000E7567E33E75D6C1F0E2730D6004C570570D489AB33D8EC960A4777A934796FD379B1DC5F51D9461939437EC8",
-"00000020AA71BB45C9924C9744035E4B24006D97419E4E22D37B8D471E0000000000000030E7B210C8AF28DB19CBF6DA252437D00ECAC9AE274C8E0B5CE5A06833A11D9732B6DC5FFFFF001D0ECB5907",
-"0000FF3F5073CA62F814795029E74B910A19019AFC3DA49534799AF81E6609AC000000000338CB4CACA6EA392F1CDA8EC61CABD51A1A7D3762A08B27636497560D22FB7504B6DC5F51D9461921A00DD9",
-"00E0FF3F9F6FCC8B155BB9A350694D160B82EE97D772C029BABF539B2200000000000000A9CB834B3FEB20C110C2D3D85D6B2109A6860DF51EF4A9A2B5F638FF0C30090F23B7DC5F51D94619497CC717",
-"0000002052257CAFD019CC14C20467982536B8C93784E86369ED8FFC16000000000000007B705FF0BEAFD861489F14BAB94729779D9371A4DD1F2C21D60347873B615C395CB7DC5F51D946190C08B615",
-"00E0FF3FEACC24DC64A11E429A1E3AEE30A3F9D3E7770E61A15D5C332B00000000000000D17A10FA52FEC3B3A29430B5BB25DCE3C8C9649B03516DA0D42C402C498E492547B8DC5F51D94619C6F2262C",
-"00000020C71AB011BE16B18DA17C2072223E105D24DFB7473C8DE8594100000000000000CCDEB89E0DF39BE96E99A6384605D43D20BCA1E1F52CFB19EA33102676CE03838CB8DC5F51D94619A6DDCC5D",
-"0000FF3F3A1BE9DC196ECB706CB1378B6813BF11235D9EB1FD780A341A000000000000006AFE69D8350EDECA34A810E2A959EBD270A0C006290C6B48437C98EFEAC0EA1ADBB8DC5F51D94619D17F2401",
-"000040201F1B0C05896CAE6897569597A561E1A5E49049BE1CB717C92800000000000000DAB2DCDD90A821CEC729E8589F66A8F522CA445193CF117082E1105BDEDB08085EB9DC5F51D94619CB26D96D",
-"00000020D8DBE35739F6F0F1EA86A2ED4E6F74F68D08CE4BE292FB48140000000000000061EC0A656BDBBFBD599073BC525F220789AF07DCE135B6E9127EDE9D15B791C81BBADC5F51D946198700EF48",
-"00E0FF3F05DFD428472A9892D6359969C2FF33F3B4F73AF4F92E802E4600000000000000893BE34EEB5075EF437504D2AB0C05826441C25816E4F99B5EFEBED9E5E8C81A8CBADC5F51D94619897E45D1",
-"00E000206287454CF93DA48BA4A94338E5EEDC8E4E899C3CACB9F38E4500000000000000F9FC16C93A42651E701786193A913A87AABF71736A1F8CEA03FF4D6401040DA8C7BBDC5F51D94619C4BFB612",
-"0000402062548119B3251256B6D073A044B7B1359B68D78F03C6CBC20A00000000000000D2CA4DABD5ACD6F4D929434324256FB49AF1BB1C1B6E2492E23DAF68C652C7C711BDDC5F51D94619AE0DBE6F",
-"00E0FF3FE72E2D389F6A2E7537726E492B2DB06B7ABB60AE111F5FDF1000000000000000D2B05AB6F7068F299DD2622CC5AAEAEC1B98C98A02E3F613CCE9FC6D5EFF174730BDDC5F51D94619214A5CB4",
-"00E0FF3FCFFA47F5160C135A0ACC047507B444F759B4ED5650206A0B0B000000000000004D9E577B089211927C5ED6161E66FC8E896E50C5248BB8239196AB6F4C517B1F70BDDC5F51D946193715F452",
-"0000C020EF4347A371D418E8BEB56E9F859DBA99A77284DD2A1984A0370000000000000051999B3666D9DC81604259E7233745C19D2CD7DAD8B1AAA03B1F63A52CD0AB704AC1DC5F51D94619B46A03EF",
-"00E0FF27873F71DBD306F6AA0553472EC3254DCF706CB74BF564932A32000000000000003FF74714A0FA25D1B00A9542E5BC9CB9EDEC4F95353AC27F89122E3AFB2F00588CC4DC5F51D9461957648214",
-"00E00020F373B2C49F9FE3DDC2294D56DF22706D67BC3886781C0D3908000000000000002993D5C954157EBAE09FFD140706FB14B92A3FA9BC5F4528AD5CC3AFCC98A9EDF9C4DC5F51D9461970D0529C",
-"000080208078AA2C138A0F48DDF19CBD821C2713D109A1230E37DA1C220000000000000042EF4BEC2396D768DA2F558C5641CEE96D4803F56121A220DEFC6259CD39244F5CC7DC5F51D9461965606F54",
-"00E0FF3F1F73049A1BAF7C29E4CB80DB69B337CC77A1B6C739D530282E00000000000000516CA570A176064AA77BA194448D43D7FB471592349E0A96A78689DC7668049A1CC8DC5F51D94619C0299F80",
-"0000FF3F4E5845478204BF8769B3EC7A556B428D84B00E2529CFE59406000000000000005C24D34E0FC492BB5E7FD13DC5A33CA3D6B067699F35299A1D4793ABD9E2BE79ACC8DC5F51D94619E4E4AF61",
-"0000002038E1479E4DD3556841A3799A3A5B7E159286087F6D638BED020000000000000046497D57CA9C58AAACCFFF12DFADAB7EEF01C3DA74D849B6588AC96D158094F10AC9DC5F51D94619EDA35295",
-"0000402046143CA31ED6AE7B39345F085CA4E6E01DFC95AE4B63299B2C00000000000000ED1344D8094EF984BBC83C2F81CAEBCE6D475E2F402847E132CDC9F73315C312FDCADC5F51D946194F3E5CD8",
-"00E00020234DD4991CACAE77DC8C4BF5A8E029AF608A7B46748F992E0C000000000000008D55FC74A51D1A60C24330D55B9361BB23D6F5EAA1C679FEA98F8C496485AC36FFCCDC5F51D94619042FBB2A",
-"0000002022F8C181F3A432A1FC2EE267618D900BF4BCAECC85C8201B1E00000000000000F198430F24CD5FDEB049AA5029AB5D326191A4BBEFAC2F15AE5D91A7FCC2EABDB2CDDC5F51D946197D44F563",
-"00000020D06ED25DCB3FD2F96FD77D52EEC24C7DF4CABF6626CE962E090000000000000098AA9F40D96DA7AFF7C575DA6A55D0AD85D004958DCED7A2109F0A9C61C57CEF86CFDC5F51D9461970AFA328",
-"000080206A5ACE0DA00D92DFB646AF0D4478767371BF13E1003BAF251000000000000000449D9CE869765E12EB656868DD3B64E09821EEE90230C6FA901E8A2E9A73EEB7E2D0DC5F51D946193BDEC462",
-"00000020DCF4B9A489171F378E4E7990B189E0FE23E3B1755929D275070000000000000058AC0653ADDA4F1E7EABF7ABC6E45C4CA84E41CFF0091251E4862C8CFF4EE8ACA0D5DC5FFFFF001DCE966EEF",
-"00E0FF379CE89298E1B6D18C2EBCAEAB2B7A0A8562BED5E47175C8B88363DC0F000000004691AA28059E4285C3DC8E30A0D9D35AC20E6662B1B5C33172F1EFCDB849236EF1D6DC5F51D946198AA3BC39",
-"00E0FF276EF0996FD5E5D025CEB33E560B43D6FBC7932718A97620EC1D00000000000000E5D3828E72F57E2091C564BEDEE407C6CD6083B480B6700E4A66CA397515D60FB7D7DC5F51D9461952C14570",
-"000000207AF299D8C9348CA4640D66BD0BE459E33EF05B9594F004DC370000000000000011DDBCEE8988F4F0CE0EEB3E2827CA23E26121B8CC08EDB76B6FD095878612942FD8DC5F51D946191C405DCB",
-"0000FF3FE66AA1E41AF45C190841750CC54D3EFED2452830DE59D9861300000000000000D9BEA8C438452F62687BC92F07D72E46C1E0560E168CA036AAD002337312A82F8ADADC5F51D94619F0F9FAF2",
-"00E00020FE43EA81A9E87B8F3B063F7419A42D7EC61ACB2BCE7E84A307000000000000004E46D2F6213207E9199A481701E5A63BF6B1A46A85B922C40CFC0F1885B5A49CE0DADC5F51D9461926D06DED",
-"0000002035B6860B6AB04266C171C1E99C5A45688269F2F111C184280E00000000000000280A9F5C7B9E89C0424D8C1D4D847C0665949E0B00A5571F00ED7C2EA3004334B6DCDC5F51D946190A1F6F49",
-"0000C020F08DB093CBA07997B557CB3DF35F1F230A5992AE2F4EE68A0300000000000000BF6A5B12C5DDE7955BC97B729DCB5A5088EB0362AA33AB2DA9A21547E130C15049DDDC5F51D9461906DC2678",
-"000000208D0FFD88FDF10E0F3DAC3F3DCF8C400BB6AE0432FC682CA30B000000000000002E4DD0CF6AEF85D1D23AE30C093DA2669B75A94CF0BE9C04E985915E4B791E630EE2DC5FFFFF001D6B821B92",
-"00E00020FACF9C3D70A4A4E7E555690EE39D36C91334ED67F4F2A7B0C3FABC5C000000003BFDF934D3976324AB641D257B704843113AE5C9355F3B13DECAF9DD80F5DBE50DE2DC5F51D94619C79414C7",
-"00002020F84C928DB73094D9D9516AF8A65053DE91424FCEAB5D668C2100000000000000760DE0C0603C9FC18894645F555A5381AC2D85DD5F5E2B42C09CD0B0CB56473F95E4DC5F51D946197C87FDF6",
-"000000200D234C0E780B985D2F2AAC1698EBAFB1C2420B68CD05E62637000000000000001A04DDE9F53772C2C03F3CB2BF9BCB56C75E28C0733B56310FFE381C69DF882D77E5DC5F51D946194A7489E0",
-"00E0FF3F8689A36C4DE51FCF0DC1916F8910CD4F96278C6A6E2A1DB4300000000000000033DD8154EAFFB662C3668288EFE68581E21B3523390587E4B41755768FC738BC80E7DC5F51D94619B8B5CE3A",
-"00000020A5442DC75571FCCFCF7A6B8A633DA2AC7BAF013B2161A541020000000000000057F0E1BD6CE1B8A9B657BCCB0B60A4740A78210B683B32C59FE53B57C893FB8CC0EBDC5F51D94619C185DE22",
-"00004020F86C3701760A68BDC4E0E5957D5A29B30553BC4833BF6EFC1400000000000000EA7B1E792646DCF43F816432635B5A13FBB77D114867E82D1DA5B6D95EEEA113BAEBDC5F51D946197E02A971",
-"00E0FF3F1D532ECAD277990540BC4B2A9EF328122ACCEA72E0A8A15F4100000000000000580A6DED2ABBD054FD456F0C6189ACFF7BBF17F4AFC136BA47E246429F864F8935EDDC5F51D94619C6DCF639",
-"00008020A31BAB75F2C768B434428C7698D16C9A7FE2D191BDD4B61511000000000000001D274C3B50D43D635214A0234C0DA2BE7D94548A9FC798AAF526ACAF17B3169A48EEDC5F51D946194EC4C86E",
-"0000FF3FCEFEC53E09B8AED32170085529DF1BFDCBE69D2F38490BE20500000000000000D9722C50020CFDBB333B680D1280FDE6C546AB1A8984DC5213E9B4D218EE79FB70EEDC5F51D946197A0810D5",
-"000000202824CE4121964DF9E8A7885923008ACF02BA87D0CBE1FAC33300000000000000D5AE8BEB79826FD0DC0AD9F5F5F7BEFF83140A28792B5C4AC36B3586E39D973E31F3DC5FFFFF001D6D7576DA",
-"0000A0203E50B0182D63640E1AA7C9E1B61B1A4606D5FF6583B7C67FAD5BABFE00000000DDAADAC49212CBB9A2883ED09454E1351821AB1067AE49CD036ACD8384B3FF03CFF3DC5F51D946194504BF3F",
-"0000FF3F67E187068DCC380E80A1B69648486302F2F0A056B9880C08030000000000000093709D9621368DAB09108EE6A6558C081418BC7A9EF62FB3BBE4341CFAB7CCD5E7F4DC5F51D946195DA14AB1",
-"00E0FF3FA3B1FAAE184795B2E4160500393602AEF7A887180E30E2AE1B000000000000001D27F46BABF7EDB1F436F5630489C6326F0A14CACDF507E83865A9E7F2060966DFF5DC5F51D9461903F31F0C",
-"00000020F2A2A9922872906199F02E319017CAD171231DCF1304B5EA1C000000000000001D9C3B0D1762C9721A2EE705FA4079A1CB90DF2C18CB8A60090E83479749F03420F6DC5F51D94619206C2541",
-"0000FF3F8301AB0118D2FB43F344D5794BD2A2BB0110B98E8D3BB1AB1E00000000000000C006CBB85B3E9CA7355FAC657AF0687C198902E8B651C2D91A139BF5F40446198EF6DC5F51D94619CB553151",
-"00E0FF3753AAEADB6A8D1B7E8B0B04A78269E681D7222DE944047F460800000000000000CE63592743B749F5BCD93F6484AC800BA8278A95E6F88A8DFCE59E3BBA26D386FBF6DC5F51D9461902896280",
-"00E0FF3F4D044645833602624E02DC4C4B98BC2D8B976D607060E9551400000000000000021708C1523EC11E2B8AEFE27006299D9B124FAF02ACB9ABD7EBCA5246308B1B39FADC5F51D946199EB65E6A",
-"00000020610E1335A270A9D75EA977E2CD084024DCCD4A6BBEAA06881D00000000000000CFAAB4FD32B2E292BD7703E9BBAED7FF0DA453A50F545D4F275D822D140F695361FADC5F51D946194ECB2CDB",
-"00000020413D86ABACD4F8BE19E04FBAF30817BAA2DE56C3B4648FCC3F000000000000002E8A5FD46D3CB59D7279D9E630EC011CDC4373B84CC4137C846CF6570B302A0E14FCDC5F51D94619623F0698",
-"00000020B29D6A35D69B425B04221F77646EE469C6BA9B587C8EDEEA120000000000000066888C85240238E63DEF746EF3D5936AE408BA2A287AFFC46F7CF235E5B6CB04F2FCDC5F51D94619EC46C926",
-"00E000206F9E5243D47422FEC8FCBF468E141D5B51CACD34FD1C62D00D00000000000000FBB28A85CF2225D9A2D73F32A65A14912521DE2FCF2425F1EDC6AD224A1E54A720FDDC5F51D946199E9F407C",
-"00E0FF3FCCF3D92D17862273D7E5443781F254BFB12DE92A82868DC33E0000000000000031E0DA4B51806EB9EEF2F03B243B45241F58922E3DC515530F007E7F616021229DFEDC5F51D946190D9F016F",
-"00E00020AE932823993F2D63D5219AB7182CB444484A2753716AD48D1C00000000000000CF96FA89EB94EF99F7AFE14AC5A6908686F35D1A4D62D487CD4D6CEE2E031626A7FEDC5F51D94619306DCFBE",
-"00E0FF3FE7F2A10D8C9410CEB029702BA0A411D345AB150BE8168F7A0E0000000000000025795D67A77881C826D1CF59E13D9B03609B6533814CB2D03FCFAFC77D85582EFDFFDC5F51D946192FC55C0D",
-"00E0FF377481D7FCE63B1F99020C6A0AE04F1CDEB7B4907061D6EA06290000000000000087A81A063DCE695BFCC8DEE7B1BCE571EC4EFFE6AC99FE10E1CCB4DA65FD1D225701DD5F51D9461975B51ED3",
-"00E0FF3FED8E3810193746692D11C13F755090C3E4354442C862408A2E0000000000000020BC436749962C13F984448A64B1F0993D2221FC9C2CD1843ADBA8BEEDBE550CA003DD5F51D946197B43AD15",
-"0000E0206D52AAE62564466F60885786AE8DD9C14529096C33DED93F0C00000000000000CF4E3B169653DD1B88912E3513CF780B1DBCCF4CBCB65DE16A6B4F4380D17935A503DD5F51D9461992337335",
-"00E0FF3FD5ADADE7E3B0FB7703026170F6D4389A8FD3A31CE3F65345370000000000000057EE56E765472FADD5124C174520E40AE6FB2E2ED771BC6803F9517EBB8BF1AEC803DD5F51D94619317A4149",
-"0000002077E14C968F1C17FE87C898C3192C4A4352D645555FB84D191A00000000000000A391135310547279C498B285BB0C1597DA41F8219CC3D3331EFBAE269B3B07049005DD5F51D946199B07B348",
-"00E0FF3F7AC691BF494C2AFC4E3AEA4018B31E8FF43E726E585C116E42000000000000005CFE6EB7F62CE7C2C5CD16E771836C1DB023FC270D088F9A9358D8F3A996B2CC0B07DD5F51D946198AA1ED56",
-"000000203B12961B12080DA045B64BE13E28EF3891E441458CA6ECDA0D00000000000000C499BE872C20F735A6AD424A00FBFDA8C2F21B46EBA6DDC698BC14AA19A140EE4D08DD5F51D946192907776A",
-"00E000201B2E21AF65F7725DF11525649EBCD9004AD0EA8A44AA8D8E2700000000000000C3F1BE8EB41DBDE16E448178573FFC1A34F82D0419F93BC8F84BCD969072DAEBC808DD5F51D946197974EC31",
-"00000020C84C4DF828F9BCDE8F48C09F0059EC3BF22C6E81A0CF510326000000000000001F3897166E589880E0076BCFA3487FBD6CF8E6B10FF6F24A35595CA368635C854509DD5F51D94619634D8DCF",
-"00E0FF3F53576B2F25C905F7E246B1305139A7084C3006C1E81973FB3F00000000000000B0087CB2C5C1113C6583D6B33FD20E92E82B94C8B68F5C7DDE27C491A9C17AA9B409DD5F51D946197D1EEC77",
-"00E0FF3FC0FADC1CDD3D10A710316A1C5BCCC5EF64DCAB256DA0E7C53D000000000000009F8C90DB6F676EC0221E91750790354823D3963C1DAF342F9DA8E69BC044A3691F0ADD5F51D94619A3AFBE03",
-"0000FF3FAFA1D545D2680D4706914DCF5438E975D524F8267C9247A40D00000000000000A10682F8D03FDCDB7719082342A8B00444362706C8BFD4D964C02993BFC3CB3D540ADD5F51D94619DB13E470",
-"000080205119E93F42417F8257E07AB3F0B5D3689B6F21AFF223C5700400000000000000E4E02B7B3A3869744D5DCAE841408FEDCDA37428D80A1A22168DF2837895511F570BDD5F51D94619854FDE0F",
-"00E0FF3F90CBB181BD42A0F503C501B1BA860B950C4DF279F7A22AFC2F000000000000009B0A723445E0CDDB41381DCE06E571F7DEC62D51CF4D06FF2D62943CE53A3B3A6E0BDD5F51D94619F3B4159E",
-"00E0FF2F7AB7A7A3DA0C321E249290AEC8B3E54ECCBA39C92013AA5E17000000000000004761A2F732C31CF95A8354F6AD93DE9A5231FAC6DED5EA60BEE4E42E1CD4BDB37E0BDD5F51D946190CBC8458",
-"00E000209FC01060A1BF7B7940A8D3EBE73C6210E666671329BBB04B1F000000000000005BCA78E71AD9894F84ADFC92DEC5F14136418E2CEA66CA1BC983560A0972E7E9460CDD5F51D94619D446C8D5",
-"00E0002003D3360A3155C198C007BD67E384050DF4F54ED689094CBD3400000000000000BAE1CD2CEA8505D65756D9F53694686529D17381C72F8664A3AC08D98D184FCB590DDD5F51D94619C37A182B",
-"00E0FF3F0A1A4F5F350682F0FDC2C6C9F08263E2BB59F097E12FF7812600000000000000A96C88773E1A471E8D3E28AE6062E4C0AAD824A1C9681F8449AA7BC75634C430EC0DDD5F51D94619D8F0FC99",
-"00E0FF3FAF60DC455FFB1C489691108C49E81426C5B8DB609E0FD4DA250000000000000062A22B6748FC0C60C8D04933E7207CE5D7753B90293E14E5028872C3815464DB450EDD5F51D94619BE6285B3",
-"00E0FF3F237EDA086176828375F721F8AAA1A55444C50DC76809F69208000000000000008AA67C0B8CB40077B01FF10C973A4AC9BE97CAB81D4ABF647928780C6CA88D925E0FDD5F51D946191D5E2FD9",
-"0000FF3F4491266CC42803E7F335E9B0876890C3ABE997A68B037F673000000000000000A15D05FF49C7ADE81B1914DD79570848C1638956C8C70CCCBDAA5B5A14C70C45890FDD5F51D94619A1408FC2",
-"00E000209FC14CF98BAEE6362F691D8A93EC94DB9C2EC159010C2B661F00000000000000B27BC2A827EBD4A4C07C9A71B69945D0238FA7BCBA8C531EE21C7FFA7633A5A5F610DD5F51D94619A510F632",
-"00E0FF3F327932C4F31570C1D5451F86866125FA5E8CA81A96D5077A2C00000000000000B00C7F091AB5A47E3DDE33E378E6AFD91A0D5C24CCB5190B8A19195B103C69D65F12DD5F51D9461902622A93",
-"00E00020B832D16E20FCBF4EBAC89D1FDA85F81F65AE3CB79B6E89841B00000000000000134B5C4749A976B361E5997C039E7756FA2BA3C6AF34F15FA5A35AA302FC9C1BFE13DD5F51D94619981FA225",
-"00E000209720529752CBF99B48C78E72621C21BED7D39A749E8BCB54210000000000000047FF55B891639D9FAFC65367088B8DDF3C0853034DE5F38F7D7B89557BD732B58D16DD5F51D9461920CC5E75",
-"00E0FF3F624D259D286F4E56AA5E023963CDD0943861D221352F081300000000000000009EF130A05C81536246841DB4B63907C07C7D432583CAFE8814D26BCB3B97D39BD016DD5F51D94619DAB53E83",
-"000000204F30DAF4FCE92097814F5DE302AC2BCEBDF2FB8B76643EF84400000000000000C41ABEFDF2A366DE31A86C9B54C9F6D42AB958EBD281D0CD05621647BB299AE22F18DD5F51D9461916F7BE32",
-"0000E0201888ABBF9C14D69F60B6E18E9C014A7EAB390B535B675DC02B00000000000000867CFE3D73A8778F9F7A8B070E118B39C9515D50981963428D5841AEC44A0CFC8018DD5F51D946194DCB4900",
-"00000020C876C487E81EF939A9DD6E3A901079B6BEFDC569A3A6A69A2D000000000000002BC8B6AB4EDC57ECC7D214C57684233ADD8506674C8BA9A38494D189E7289D203319DD5F51D946196A6BA4F6",
-"0000FF3F9C440AF53B0AE454393FDB6F2FBDF2B27D9AE061A35B43D74600000000000000B102F1DECA5A4D1F6E2F544833ED396D2E99702AA75A12C1F76E45F585F5AC9A1E1BDD5F51D946196596DA87",
-"0000FF3F608C32EC094FF2B953338E2DD6747B14595A5B054947BF333900000000000000208BC913C0DFF2B2636646C3A0DF23D8523B65C375411E80D3986E5D2D804687481BDD5F51D94619E247ED2A",
-"0000FF3F17643455D12556C30F429E2AC26F44F088D9CFBF2E15D16C3B00000000000000A65F2B779D5B6F36F4C213CCB52702591BD6F30AA25CDBF14A932E246BAB4310041CDD5F51D946195D86A0E3",
-"00E0002074AB4778446034408F93DB1D2F97D8AB6B59AE5B33D29E391D000000000000001FD1DB31650B47C8C16A3DF1087CCD3B2B728616C822D032E24895704CD295132E1CDD5F51D94619E903DF6B",
-"000060204498EA70068257363CD4A4F1F3171E20C5E11369E787EA2B3F00000000000000529456EDF98F4E122749DC38E981C453ECBFB39BB9B8A04D7E371FDB0922695E271DDD5F51D946191E5AC66E",
-"000000209852773E3EF0AD721BFEC3BC650E4106CD3D6EE2A41582983A0000000000000022B40A98DC28C39EFA9B6D57689D33BA622AF6A40B0FF3EC57575977F36E6763A61DDD5F51D9461994DC2210",
-"0000FF3F04FCB693544A51E06CB9428AB48CD048E7DC457C6D1940AD14000000000000008F21D625373599D60D9D05E9A37D6D38EB7EEA5B31509C6059EE70DD2EBC7301211EDD5F51D946194EE3B3A7",
-"000000209AA358D19E1ED27B80FF3F31C50FB8FBBF786B3CF2DE2FCD3E0000000000000076B0478B79FDB6CBB5BB93AF9903FB374A0B6F349E04191208C8FBEED94C44669A1EDD5F51D94619D33FCE6D",
-"00000020F1700E98A56CB310CD9869F1ECF5BDA8C9EB11E3726D4DCB2C00000000000000E3F06D54D6CBF4820B28501033B6F4701532ACA59F702A9E4793AEAA63CC8F868720DD5F51D946196D362269",
-"000000202E7E6D9B3FA717282427628EAE800C653FA6C32F6E4D31590A000000000000006AA08058B64AE3309C05623DF7430C972EEF8F0CDF6D06E4CE21A23DA72CD3DFC720DD5F51D94619BF838744",
-"00E0FF3FA04E112D3198B98686189E49DE86958D5E6746F916E41E6E0200000000000000D020E7CF497413492658EC9B2272AF96C277F0ECE924D9B9A1637B5924F5A9D7D820DD5F51D94619052325CF",
-"00E0002049BDC3A8FAC98F54AFC4A811C8F46BD3BFDEACC45E6AC87541000000000000005899E8B01C6B6F8F908486BD18859A044A062668196EEEFEB3EF4C7B9F878879B621DD5F51D94619BCFB6426",
-"00000020E7AACFC575F20B38BA13200B316F67DD0EC684E3313CFBA4430000000000000076A4A1F760259CE5BD3330177CE64FB44767CB9DDDA0D3D84CB4DCCD2F806F69E221DD5F51D9461977FB7E24",
-"00E0FF3F719AE718610C88017D713C056A548D07C0C2FF736BA233D70B00000000000000684E06F0015A7047A39EF427BFB259EE22D95C0A1326725911954490C1CCF8604E22DD5F51D94619AC9D28E7",
-"00E00020E97F3E8DA528DF643CAF5039B56B7F97C96DE7FCCD9D12880A00000000000000F3237672B3C5C051509307C3559B48AFA03FCF0C346CF2F0C2FEB4D91015E7CA9B22DD5F51D94619E6FC4719",
-"00E00020AEEC578C06A9D0AFCDD8348EAD3DE05DD0CB64871A8DDB7341000000000000006A4F26D7FA0F8F60F7E4AF8773BFEADA447E84AE11194621E861074BEC00EC6D4C23DD5F51D94619135009CF",
-"00E0FF3FD852E3C348AC41355D79C29AB03FA845DF7FF0DD63751EE30500000000000000E4775910D96EF11E54691BF0BEC00A7381DD90BA71C2BC882D2049101AB9F175F623DD5F51D9461935898F23",
-"00000020CF90356DBE5340BAC8F396A9B8DC6597C43F4D7FF448753738000000000000006B0AAA2063728DA631271568B95518C2893E314B2144440D69AED8B6F5DF7BC54224DD5F51D946194EC83F21",
-"00002020668C213BFCE9A7033CC5C626B329B41197DB1AF0282153A027000000000000004E6B19A80752CE719DB7B62C41EF2CF83A99641033D16342420DA58759EA8E3DC624DD5F51D94619000FE5A3",
-"0000E020911D27CB645DBE117B4CAD8324A12DF5D0489C6F649D792E3D0000000000000058D94CA69E284F36EB66B5BE4C96F9006765E490F0569D8A5255A5F2D8E90062D724DD5F51D9461974C10F11",
-"00000020FBEE1F3A133CB9A9FE24AA1E6C1BFED9C374B890CB727A4E0900000000000000BA8CC108B47F6E487501921781B73717B7E428BD3BBEE0EA9D4CA4439DB63BCBBD25DD5F51D946199C8FC285",
-"00E0FF3FCD9441AF20BB1E722EC6F123ACB6FE2B337C8B784F02225C2C000000000000005CDE6AE576C56509CB3A6C30CB2BB8B3A3C3DA9723F598352DDD65E05658D44A4626DD5F51D94619763F3FA6",
-"0000FF3FDE4B30ADD3D79E7D2712BF2C3E364BBA325270ACBAF3DB1820000000000000002A179EB83BA1E70D0C532208943F712C54308315CFF7EAC3B43C5CD8778D97B7B427DD5F51D946198C88D01C",
-"00E00020DEC19E02A78BD1011F2726E049B59CE27351A17826585E771C00000000000000EFB38AFD3B60C524836FEFC6D4AF348CC251423D6BBF8F30FAEA80C12689D026A228DD5F51D94619BE09D4C4",
-"00E000209ADBE93CCC56C43907C475BA5BDDD61A2EBE2A5EA6A0DE3D1000000000000000360CEBBB0B2A2739088FA5DC61471D9F3AE370A188B0218ACED6BA8C9BCED6EBF129DD5F51D9461934496CAB",
-"0000FF3F67D8AC11E66D75E83747FE138334879A10A2F0CA839F1D033500000000000000729BCE5637A100C09CF5CDBC74146384630659599C1D32B3BDFDDD10CAA57841352CDD5F51D946194CA881A1",
-"0000FF3F022F34A3ED0728DBA305BB48F0350A2DAFF808CA521F85772F0000000000000083290FA6BF8F2CC6C5E0A1D2C76F0485444F3425154B1BAE6BB4D6FBEFFB2D36812DDD5F51D94619A615BCAA",
-"00E00020F3B7B9AC1BD12D2BEC8AF733419603567F17F9DAF315160F2F000000000000003921BA0942FB4E7BDC7CECBA6BEB2662878BE33D26CF3D303852C52C8C48FF0AA12DDD5F51D94619F9618285",
-"00E000203F85ED61716327D318604BFC26AB1BB72CD007E882E709081D000000000000004C1A27F79B534EA22C6B093370DEC0B2DD6D171FA56A270E308C2866DB602F0F6E2FDD5F51D946194A2DE131",
-"00E00020D49E4F6E2E835E6EA8E9202BF528BEFBDC8CF7F897F7EE140D00000000000000C46E2B6013521C9BEC1ED5F9D4995E3D1A44E05B61A41307A933149A0DA81F0FAF30DD5F51D946191524C37F",
-"00E000206948101D1ED6F1EFE547D26279DFDE71F7FACBA89B99C6473300000000000000ACDE61EFDB144903D7E8F541E8BE8DB76A589C83F9D0997AF33E9736D63135E3BA30DD5F51D9461901901E09",
-"00000020C79A7A53D90620C8960B3107ABAEE5AD5018B07BCC645B133E000000000000008F77DD1D730DE85358C0D6B5B3C0F74193D087956DE828399171DDF8A4434849C032DD5F51D94619FB0B279D",
-"000000205359FB1BE191B4AE55E3697BD94349ED2D23D8A0EC212E10330000000000000008FD359FCFF9057683C6C29A79B5FFD858F54349789FE45D4E1AC68F6C7B47A68333DD5F51D94619D71FE270",
-"000060205E7CDAC06FBDC366B7FFCC11F86E3125021060E3E362D3F71100000000000000017737C28912FB257DEA03947185D01EB03B16D4619346FAE04221B7C0655CA89533DD5F51D946196ADA071F",
-"00E00020B6D13936BB6291C9645E2FB3573236DCBFE4C795E3714D04020000000000000014F462F97636D9604AD9903049DE1F11F015722C3A636CE67080C642010021689A34DD5F51D94619559A3071",
-"00000020023FCB80CD66DBE3BDE7E17B53385F0242F983E6A05D79B72800000000000000ACFD6FC21E2FAFE2F8216CF3531F93B51D4E4D8087C453356D60B3B5916E1B59D534DD5F51D94619325F2D76",
-"00E0002075609C6FB824E2D938DC2B208C4937B245E6CC160A1D20481300000000000000CC4DBF91ED33C62668967714397802B4FFCE23A81AE887B464A7230B253F58914036DD5F51D94619FB798152",
-"00E00020297C9E8A4C07E6E9AA7B5B89C5742035B448475E6CC3E8822B00000000000000DFB8EE5F800B509B5E86DED5B93390F46108244E84E10A4B5875F13DC3AF0AC21C37DD5F51D946191B099CEF",
-"0000FF3F5CB3FDEBA59D45AEA2E48D3388D626683585E000B8F60D01380000000000000008B3791D421FF10B4E2B32BB100D9D8DD4C789DB579C2BD8E2EC33901B2271E94437DD5F51D94619F2ECCAD2",
-"000040206A2990C95968DD18EABA92651FFB939CC16C2C7DED585ABC3E00000000000000F867FB7BAC519EE099FDA7579DC9FB10EADE6F33E3E872CFE9947892597C89964F37DD5F51D946194AECC69B",
-"00000020355D0F96AD62B31785C7121407AE1B2CFE3E31ED545E43430E00000000000000E1AE378FCB70BC60F001A240CF35DF650ED77E57D4C451B44CEAB4DAE057685E8539DD5F51D9461928319F5C",
-"00E00020DDA3207648D17B59058495F9F8949F5125F392D5CEB94DBA32000000000000008AC401563FAB951BA052CB9A8DC0F4A4F76B63C20B2DB82EC212A8884D0EE7376B3ADD5F51D9461976212CA8",
-"00000020752442179C689E13A5345514AB05F97EAD16A6D2D8E32E420D0000000000000018561A8FD2E2CCBD896BC085DEDD6E2F3E2D5D265DB47ACA0C715F5E0959EBF5EC3ADD5F51D94619C6ADFA41",
-"00E0FF3FCFEA4029B605BF5DC06EA349688475106EFDF3D966A032DD1A000000000000008413ABA746CE3DCBA05BE6AC40B7ECB0F8043DFF8DC2EFBBDA73BEC9BBB237B0103EDD5F51D94619C4C3E6A5",
-"00E0002089D2801B8F822ACCEA61A48E932201DC10880C1BF69E3B9F3300000000000000ACDC7E16BE58A23B62CF6366A61013F44731D2E2B0C3D662484262AC5A0F55922D3EDD5F51D946199C334549",
-"000000204AE607F154C08FE059D1A4F8033CE7971FE766B075C19EA80B00000000000000A062155FE0C2EC505E30B15E3C9BD56E8878AC6D3CC24A970DCC881A95ED724E333EDD5F51D946197869D4EB",
-"000060207946E11C937DD36316CBCB7D52185253DFEFD14FF16CBDCF180000000000000020E9A2E60065E64730228DEADF42EFE572FADE8988A73C4D0DA01B68CD502619483EDD5F51D9461931C982BD",
-"0000FF3F659818DBC437FC190E808A07CBE3066D485F74BF3C5277BC3F00000000000000028B40EA4103CA6C65F736ECFF0CF01A12A681B2B2B631A4D80BB744AA04D852B93EDD5F51D946197FED96DA",
-"000040202058DB52DB91EC699007773D84ADD5FA4034FF2F24BF49A11600000000000000628C32F77EC38B96CADDFBCC83E99BDAEC1C2A81057BDB0E4A696D40D774C5B4CA3EDD5F51D946198F0618B6",
-"0000FF3F537ADDB278D95F5414C2552971E60DAEE5F9906FFC5B29D41A00000000000000FEC2E4A666E0D5B02772C0214D003EFDE4D9FCD206A8B10658FE21BD8456CDAE0B40DD5F51D9461905B823F2",
-"00E00020D8F5C823AC8428B98072EEB754BC130E1B36696BA53EDA1F4400000000000000F3EB684009B49AB43DABC0D35C5EF4DEEA1461104441F221A5021ABAEFDA3F585E40DD5F51D94619D5791F58",
-"00E000201EF1F115563F74F7E82973771129BAF713B6F4047AE021BC3E0000000000000000A48AEDBF376E80FE90A3AA1A0FC4EC6B9FE2A0DD3C1A334437DE26835A30137542DD5F51D946192577D792",
-"00E0FF3FAC9EE8EF2CC119794373E019E6E717D92A399E80BC9B015D02000000000000006189AB0F34A77840A8F5FA2DE6FCC71ACED1B1BCECE4085F7532B10328AED9EC2E44DD5F51D94619D4E2F41D",
-"00E00020F19FB3343A3738AC48E7E593DC4EAFAE5AE5339F4ACF2B924100000000000000316B5C2F2E1924EEACC381D7DA3F69CE7C53FCA0F2545B89009AF33E64AB1B1D4945DD5F51D946192935F509",
-"00E000201B7671D7517FFFDD59014903C466B0100FE07D2FE685E2B601000000000000000A6FD2DC8606DD7B69B80413692A93821FCAB39733C5CDE42E34CBCFABF29C809047DD5F51D946195E3D2D59",
-"00000020DBA687B70AFB0FD9AB1DC553ACF4F8F13D385D654B0EDAF815000000000000002CE753FC2F480E7B398E393C3A4C5ECB90846A427650D38EADCA36C76AFC69692B49DD5F51D94619B90B4092",
-"0000C020923B5378E4CE1976B6072B6C90C17C9C98B949DB682515D233000000000000008F4157CF1145144C2BB7331F2A0E6873012CE46B07F2B8F4467AAAFA3065E7CA3D49DD5F51D94619A24C3FC2",
-"0000FF3F4E0C2E6E9E123F0B989DCF8CADDA566CC64FEE64EF84556A270000000000000000CB31C3F03092C4D8248BDFE525163A0A13D3F5DBFDECEC90E26DAC4034C6C07949DD5F51D94619687F57F2",
-"0000FF3F91FD7EFB252DFFED851BE9CD2C14ABC67FD564F2A1AA69A041000000000000009C94D8A082A0822BE6E4EDB0FE23735E5429F64387F54726CC72F62758E6E311E54ADD5F51D94619A34FCEF4",
-"0000FF3F890D3B192DF6017598E3DB533C97702626A6354E6E59729A27000000000000000EDEB9300D6022F9BC95A15177C1FC1E19A99F82CB43A6B9DD54CFCD90F2F191954CDD5F51D94619A8F8F339",
-"0000FF3FF824BC2AEC5E9F137CF12C51BD2D63E6D0837C04113E22C228000000000000005EBE3AF07A0686F8332ED2BBB19A5A21C838E8978B675F054E6CFFE6E87EE9AF4D4DDD5F51D94619C53711E4",
-"00E00020359F392FB3D64DEF7E4F229A141B6F447FA0EFC9C85DB2332F0000000000000091BE58574EAA5ACBAE9495EBCB5EDFDA10C18F121DCA6D9ADC4D739DAE7E433B054EDD5F51D946196445F350",
-"0000FF3F379B93B4D045E25692AAD519037A977F7C9159F64AE06B282D00000000000000DBDA991070A14AEDA1B33057D3FD8D414FE1D7981356EBA9309AC2A921E28C9D884EDD5F51D94619FC1B23D1",
-"00E00020F804FEF7AA128E2FA01F22C1734CB3A2634310D95C077D7D2E00000000000000ADEE0DFB6AC9A81C99C48B3BC1431861D31CFAACA2A1DAE89FD52998311D6FC3DB4EDD5F51D94619AB7590D9",
-"0000FF3F6D4AAB6578CF989C47E792C3C280C130178CF0DBA45F4A92050000000000000077416185C131C27A7D6E8167A4492E5407856F0482AC7E28715E8B2A2F52AA49634FDD5F51D94619550BEE2E",
-"00E000205F709020EBBC16092F78FE1DF1FF717C3B90D7C8693228AD3B000000000000005A1B421B9AF7FB5A054B0C69AA07524AB44781EC0A7B82EB1AF510AE4CCE316B834FDD5F51D9461986004F53",
-"00E0FF277C4E0BC28258786DC8F399A1F36152914C518BA66C73CFA53100000000000000B626F7D4D254FEC73BE1AD9196BDC68D84841D43E9842B56241C237CE6820C37BF4FDD5F51D946194DECDA0F",
-"0000602092A5DFCDF3B04F4246490541F3619E132A244EB87576A0584000000000000000B9527222AB8E607B9DA7545A98DFE9F0FA19A22EFB4CEBF285289EC4C99E5A2C2351DD5F51D946195258CEBD",
-"0000FF3FC417A20DDB5CA4CD71503B9714042F5D13DF5A21F88961531B00000000000000B14CA175E581167569989E908C1FF28BC8F79180253B1F73C22A6E11E29BE2C57153DD5F51D94619A4CA059B",
-"00E0FF3FA6BE892CB0D1518DDE5E1D5460A221949C2AC640C06110AE1000000000000000B658F48C5E2AAFFECC5467F59CE98AF263E108B1CF66B13931B7CF2D810D58DB0E54DD5F51D9461919D6907F",
-"0000A0201FE45BEBE9392D5FBF59D2BB8ABEBAC332C9B657D89E13EB0900000000000000936B67E7D25A534211BC442C16DC7106C4B9F75DB1BEBE24CA4C88C43E0621BA4454DD5F51D94619498B42DA",
-"00000020401DF831517DEBBB60C1C5B99DF657A02D2375471D13E856200000000000000098397866E46D22824D4E17024E9FFE8C43F57A2725D242F81D4A03FE4C9D6EC35C54DD5F51D9461918CC6D88",
-"00E00020D42F6216BAAC42541AA67A4EB0874E0140C5ECC1C294B5A14500000000000000A0B1AFAFA0627B086DDD18F3D30B5DB350299E219C81B0B1006C430CE0AEAA918054DD5F51D94619DAC13853",
-"00E0FF3FE594BF5F21899F64309A32811D8A4EDCA8FE99BB005D302727000000000000001137DBCE1FD432F74C69B0A1C887EC08ADADC9047F090C0DE1D8B22E401446BB9F54DD5F51D94619977E626F",
-"00E0FF3F68C0B764F787426F7D1D8A7C64E60A9380BE78ED29C633C51D00000000000000527BC1297A7416E0FF316219CBEB05FF6EBC5A28E2D402155FE9A3A4622FC3D8B755DD5F51D94619B9017D6F",
-"00E0002037A2510F0EDA0DE93995D15C55EFD051FE49E330F14D60713A0000000000000041AD900338EBBCD634DCC53AB6D3DA6121A5E8F9DE675A3C4EAD7DF38E7A40F11956DD5F51D94619F4556CA5",
-"0000C0201F10819549FE6A9679E480DA63D5BB47180E74617529628D390000000000000007FB8C0C2E1F7F04A5C397F2B0588BDA66E54D64AF6E621EE8FB5B7FB2A270113056DD5F51D946191F4C93A0",
-"0000FF3FD9273651C7EA879A25BB66AAE401E8327EC5E975D90D03A81800000000000000BAF334A9A5073A49B9734D442F25A39646215C647021FB4E49EF4E0EC4FDE9E7EE56DD5F51D9461975134830",
-"0000E0206E1BA7E14FA2C2140DCEA86018AFF362D29478493341F3220800000000000000A56AE1ACA5DDCCEF48BEE12727F8C9395FAC863375096714EF7BCF35A2A0FFB06B58DD5F51D9461931C391D4",
-"0000FF3F9B6E570145740386F0C462CFC09EC7C16C8AC51E94DC37431C00000000000000EC0CB44D074662806D6F757C8F60B487E9DD7BE93D29279F8404EC20F67ACB8C715ADD5F51D94619B8A733E2",
-"00E0FF3744851046298EE32446DDA588C3EBDAC608B322FC8776E9B6020000000000000007F1D3003E52E10C217A4B33AE1E71C14FF6BD9ECBA25ED729C37057B050E8A3775BDD5F51D94619D0317C76",
-"00E0FF3F28B859C825E9352C4BE621F9E3C8DB5974AD98BB71B72D321D00000000000000FE87F604A9BFACB0C3E7562E2BEC9E9846819905A2A04B7F3C86869B71FBBAD0AE5CDD5F51D9461953E40452",
-"00E0FF3F9C3F43782D371F1727E04356F37428D351C233827D248A790F000000000000004265739C26FC9229E8803CE656A5FE94BAAB362F12F5D61C16E2A9CD2A2D8B11E35DDD5F51D94619B8A34F1A",
-"00E00020891B651FED09F5E6BE69EBBCE93FA06367360BF4DC0BE43126000000000000002B9D7C4D264CC1F02374A681FD623C789C8F279D668C631E3F6B733F0A299CCF435EDD5F51D9461995070C97",
-"00E00020C110B07636F202FB065EFA78EBBEEF7E433751319257C1F509000000000000008C861B78B423C6463E3250E85425B0B217637D5BC7308EDAED0702DD10D5EEF8FD5EDD5F51D946195BBEAAB0",
-"0000FF3FA82A1BA101562879612C3AE71311B3621C7E443BFA87C6E82B0000000000000047FDEE34DDF89DFCB0588E9567746645A42716E536F4FDB06909F7F68CA2B19E2F5FDD5F51D94619AE4E0804",
-"0000FF3F1D6B2CF326604198814323E65A23336B0E0BF677A3A09D2205000000000000008B8FD3CC4201986A2ECA970A52DE43E77D880603FF6836F41E1A0AF8608F9151F25FDD5F51D94619AD68A441",
-"0000FF3FB28810ED2BC626DE821C7B6112FF7FE9240AF2971435DB5B16000000000000000A2D86D9D47C78452C6F6B83DD570038FE4277F611CCF932EBE0B78E209FC5ACA460DD5F51D9461905F9A88E",
-"00E0FF3F06F47FB493FE79F30DCF02744BB8898FC9AC4DFBDBAFF0A5170000000000000000DF0E5ED0E18ED016BBD115E6D31E498A43E1BAB40238971C1B19A359BEBF63CE60DD5F51D9461906FECFD3",
-"00E00020AD212764D22BCFB3BC37A465E4FC6392E020205CEE56FAF64400000000000000B32A33EA223716EE2B3E07D3F0CCDECBD66D5B9A91E8748A782B3F2D64426341F060DD5F51D94619B26D0184",
-"0000FF3F3C9D63D11FC5B428883249DDA8AB0A4B0ED1B8CBD36559251E00000000000000B9D92A9B0D5FE2FD7033F9380DA3885EA6122354C448C7C23FA1110ABE89BCB5F661DD5F51D946196CE695AF",
-"0000FF3F0911C2430483EDB511CDBB5B7729F8EA9C1319DAF2057E594300000000000000D7AF295F9F55D0720653F242C1D2EAE2B20FFA3BF5648EF0DE6948A64836B560CD64DD5F51D94619D84DD4AC",
-"0000002003246B3CDDA6E089A60F962054FDBFF901CCEB093BC7B9F84100000000000000E98483A4DF573C0CC76B48B1E36393F39A01C15216372413A46B886E183843532866DD5F51D94619E1F0DEB0",
-"00004020BA511AF74082194DCF1B26E4D55F25DA502A9C15B908194644000000000000001820A2C3D1B63BD5E9C7DE9B8533F8AD86AF452631789625C773AA532DAAB96E7C66DD5F51D94619B71D89B2",
-"000000209604F517495B3A6E25B2419E92DD0443FF074147EDDC25F31700000000000000FE4EB4AB441AEB2788F53CAC82F5A39891AE446FA9AFAF68103F103D0CA955276E67DD5F51D94619F781DDD0",
-"0000002091914B3AEE982656CD715D22E73E9EEE6995406B525CCDB203000000000000002328D569EE5787752F6E97C4E44F1912F14FDB9E3DFE6846707D11A7D09252178D67DD5F51D94619184BFB09",
-"0000FF3FF23A27DA945CD583434AB45B2991D3A7436A05D40D3FA811290000000000000093987F7E89F45B147666CDD478A6B81333636086123DD94E1A4204B1F5F71091D069DD5F51D9461987122E1C",
-"00C0FF3F791948AB1D883D036A60A177EBC1E1A5A6BEDDA1696682994100000000000000EDF94C451E321DDAD59423C963ECD2EB808BAB85317F047C09B1E0DD2CCE24C2E56ADD5F51D94619DA015209",
-"00E00020F2E8917FDED11CB2AE4CB39A7BE449963C704A224F41609D1900000000000000856EF465A72E4E0C5BFA6130E3E336FB2F7C160DEE8A6097C5A6B2EEF281FF7CBD6BDD5F51D946194BC5CD93",
-"0000002035969FD8710B63229A171BE81E0644508FDDE4A02CFFE3B613000000000000001CD8E44E6B2CA1CB48D048EA1183FF2AB05F91C403D57BFBADCE0F109D7B7A03236DDD5F51D94619F93B4B57",
-"0000FF3F8839F48C911A971D3079E4601C1ECC9AF4CB5867E1D067AD3800000000000000418D0119ADCD48C14D48F257091EE864704D9B639593FBCCB09A99D3836C8BD6B56DDD5F51D94619BBEDCB49",
-"000000207BF1FAC3932D13F9C693213F5DA1AD53BA652F7B89A7346B170000000000000032E02B7FC9C8D45CFD5378465EE75A10883CB4C10F3E0AE1D9437D9A5F813F77F36DDD5F51D946199492383A",
-"0000FF3F5FB8D15529561D0F5DD7B82EA1E5BED7D3F280E0469202F814000000000000007DC1BEF6270C41BD3AAA2B6169FDEFAB8AC65CB9BC19D68EEC037D7AB276F0C1196FDD5F51D94619C067024E",
-"0000FF3F2DF9B36C42A5640EC18B9C369A56E50768D8D2C2080CE25C3E000000000000007CC7439F5AD58F98D7E0B62BB643A16066DFC014A99AE457AF593A03E959596C3C6FDD5F51D94619D7CEF066",
-"00E000202B2ADD084493345299A7DE5A4B531AF16393A45A3A6CC6EC3C0000000000000011A0669DC74FDDE6FCEA1853ADCC1FBED4532EEAC51C8EDA34BA0BD14B2BD3E2A070DD5F51D94619DB492F75",
-"0000602040D6760072820B425A9D2B776E55FD55DFB162B7362600921300000000000000508A385C01EE14E8F4C83C9562B308EA039C67F1C3A4A96C504D782487D9D50E2671DD5F51D946194D439F9D",
-"000000207F4149639253468DD7836A7574AAFAE1B09A3AEDFFE41E0D0500000000000000D838974FC4E2DD910DC232E6E1329358C5322B4868C5F5525C414EB1D7E48EC49D71DD5F51D9461914440593",
-"0000FF3F3BA5A65B5E9724FF1E75CAD4654A158503459B7B64170A8D16000000000000005E83F546B56169FA8B71E35587E87D20013E75D1E4C5E3F2CBE40099849349162973DD5F51D946193D84EC65",
-"00E0FF3F504B18122A893A999483ADBC95B2FD57433496566C4CE2B40000000000000000E574F9DE92D8387EEE0BAC442DE155768FF394360A825B254069FF3444F63DBB6A73DD5F51D94619F3CA63E1",
-"000000207AB3B2122A780D4D81A39C43D12F2D8BDF3F3DD431872D383500000000000000E9D21E4E37F38CCCF15A418760BFD884BEB32DF77C6195CA8835C1C0C3AC4A73CE74DD5F51D94619F30F3795",
-"00000020CE015302233716CAE1262BD27D99CADD44F999521E2E1C9D3500000000000000ABAF09A978018602A83513AB5B5D440B819427305CE32AA789B4CF4250B8C783F074DD5F51D946190F905D09",
-"00E000200AE89335248A7E5DE89689251604E848853C5BDD17E2A6FD3E00000000000000C795268A6848EAF6D5EB687415A92A14A9854BCD1C47AF8B07BF26CFD34D16071575DD5F51D946194C580F6B",
-"0000FF3FABE5C689697F2270091AC56E0B17C80FC359DB5CD9EBDE7830000000000000009AEBAA8B2452452A8B6A89BE744FF837850ABE08FCD795AD701278287FC214D48E75DD5F51D946190CE22A47",
-"0000E020909B3ABB98E995C9AB83E1AF83B467BBEF834371D9F2E04B31000000000000008DE3B349468EBC03BEA270D66B6EFDBFAD18E8D29395A45692A99999C75FCD431777DD5F51D9461965BF5DAB",
-"00E000208E4592807DA2B88AE3C8E81877AA758DAF2727800BEA974F020000000000000001D73900D0B3878F4E4CC142BC4C3A89007348EA3CD064A7EC0CABE152CABAEB4B78DD5F51D94619B25CED59",
-"00E0002061E400B7C0BB5FB5EDF453E7D93DD3B7FA7346EA9E0D93FD00000000000000007FA6C6C4AC3B7F811C843E5DB34B2904DBE0B7C7E074DBA74C10E770B6BC2EA8C078DD5F51D94619B17FF101",
-"0000FF3F40075B0F1213AC1766E14D50561C515CFE9A9F71498B64481300000000000000FEE8BB9890C35AFB4C2FC782BF8FB5841F3E9B5694EB67706D43B744367FDF125079DD5F51D94619DD3D30C0",
-"0000C020C3C68C5AE9CF0DFAC8A08DD77E6DBE823CEEB147492B6C5646000000000000005A4794ABF4AB4E3185ACC83B1FD2D16EF8E03BC697CB73A7ADE21B7B1AB857B4987ADD5F51D9461907DA4A46",
-"0000FF3FDCDADFD4BBC5B12A549A10C613D4A3CDDBDAB0CC8D18125D3A0000000000000009169DBDB7DA5157F0EF0297E4CA278C4884C4CF8D0F432E05C7A341198ACB89487BDD5F51D94619ABCBB5FF",
-"0000002070643B78DE2E7D3F387CF6C9B2FA8199D16B5A4039B0B6D12A00000000000000C20350430E1633CFEF394FAABFBB5BBBE6CE1BEE02656359F62D4613BB8D1CBE317DDD5F51D94619E36BF68E",
-"0000FF3FA41B1E05DD994517F6ADD4E0767D2777C5C4C3E0060337351D0000000000000034B4D85B30D3642EBA1DE05A155CB80D6C5DC32C7B4A75F2BD1CF38770928416647DDD5F51D94619AE058059",
-"00E00020955ADE25EDA2396590F19151F86AAE5AF8255C8A4A1AF08C1400000000000000A903D6976B0C1044E5D56B634E7639621978725412D7DA6F0F39DCC0839D54357E7DDD5F51D9461912D02A41",
-"0000402082406BC0DE28E567639BB974B3FCDDC6A8E248DDBEC5D7540C00000000000000D7998959BF3B451BE326FAD980821C99F45D877017819C94C292596BB44ABF4A6F7DDD5F51D946190D866BA6",
-"00008020E87E5B3210BA2B53DE31632FE9DBE2E872F43E9F77EE2031090000000000000089D11112429F967685C4280D5664DC68F371178599EC28AED8163935126670E3107EDD5F51D946193FE9AC9D",
-"00E0FF3F9B6B8D6F630676DD6B6B4D47B5A4D93FBA4D203BB208073101000000000000007BA595B2CFD6D7E6C27769C443B8B81537CE72482224A6F3967D1CF48A085FF6C07FDD5F51D9461937F32B19",
-"00E00020D80A71E0398B7FEA395E64EFF5D1A744E7801D6FB028EBBC0F00000000000000597F0CCFDC80D92C6457A1B8A9C2E03BC69C0B37783A8004C2B63E054CC71A847D80DD5F51D94619E44EFCB1",
-"00E0FF3F6ED76671D31BC3D1288DC8E6B5A4FF724243DB57D109ABF43400000000000000F298D63F02BDB0658C73BF0F15FCEFAB8F741E8FB12DD52071DAC091F9AC6DCAEA80DD5F51D94619182DC0D0",
-"00E00020C6F13EB5E309122BF620846BB158FBE8BE2462C83B23E4A42F00000000000000DED239A3149F7F36E97B8E4BBF048294A1CB968AD758D22E4DA64AD2D3BD43652481DD5F51D946193950EDA8",
-"000000200AD51A869858DCC5971E520B649EBE0C550391D1FA8484071D000000000000008BCBE7F6A6A871B9E5263D424218D9E2191F8827B38D04F53D91B3CE31640277EB81DD5F51D94619C178B69B",
-"00E0FF3F4391C22D0374DB6AC8E7A8F3E55C4508A28593B65E1BACB51800000000000000DFA64E1BD4BBA4664413B8BA857A67FF23F2C441669A34D6B9363EA9F69B175A9082DD5F51D94619CCC0AFE9",
-"00E0002011672A6EB0E2B2CD99E213997984C7574D718DA7FE27A0443E000000000000005224E4557FC6C37D52314E61FCA9BF8010D1063162581C6F57AEB83D81687F770783DD5F51D946192945C7CC",
-"0000FF3F7657FA23D016924ED7C60FC69F7FDA61B63405D372E1C1311200000000000000F9120FFBA4E52F39EF5A6CDEF9DB4D979CEA51E55E057F9751958468F798E706ED83DD5F51D946193677EAC9",
-"0000FF3F855D96F3749986AF8A23590C5C45C9F942A8896A7C5997A732000000000000006B2731E775307424775A7E4A6BC06E6BB06F786F492F8F267F085EA763ABA1C51184DD5F51D94619F3AA61E9",
-"0000C0209191DDB04626AA59D39CCB8B469D394AD75788212845C0501500000000000000D5F7A250C2BAB399AFB3046FF8E90CAEDA991A1A4DF7C6896BCBEEA4C9BABD045884DD5F51D946192169B1C8",
-"0000FF3FE50B517358BFE5A395BF8CC65C776F573A419793E499B0E01900000000000000991EB4A56C6C7E03635C0B806ED76DEDF8C80A6FC36C22B330B96ACF72F5B6D56585DD5F51D94619A1EC7A4E",
-"0000E0206A7939881533A875B281B279AD5DDFF12C3D139464E86872310000000000000052148FBF662F41D07E6556F1105A118438EE972D57A2C8B411F95B7C07E27292C687DD5F51D94619317A854B",
-"00E000202B5D2D4161EE699652C11D03942184B17260FAB3349748C62400000000000000EB467766493128638F760A3590547BEB1E320F65ABE6299512B4252C864A3C01BF89DD5F51D9461985F43A25",
-"0000FF3F4B72CE51D693F60FBC8618E6D47D51BE58C94E4D4C56148F17000000000000005C4113C8B24F99FE5E7551CE73E4358C68F45208A0E3AEBE548445FFE9B0013B538ADD5F51D9461923F0A13A",
-"00E00020E6737AADDAF5DB9D4EB426AAD9397E6B5C8AFD6EA6B45A7B3B000000000000000CF5E547D2E73A8B14678F8F4596F25E79B17804F90746DF9999CF6452109F6C6E8ADD5F51D9461912D9F65F",
-"00E000200FF1630474FD441D9ED3E5AC2A9DBD42E93802190040C8863300000000000000D6415BCC3D599D44C701C400A675977D6D3F9E805CDA1B35CD875F9081ECEB35288BDD5F51D9461982BA1910",
-"00E00020559BAEE534FE434E2858CB55A31DD0F748B8BA7E6337FA8F270000000000000004BE96DDD0FC4D66A6E1ECA0ABEEA9A66D5AF1E22AF1E5194825A30F968619A24A8BDD5F51D94619DC78D06B",
-"00000020A7AC9D68560CFE5A4BB855012E21411FB0BF9219D2D008362000000000000000F7D2EFDF5906FF903B7A2A0757DE38291BE486DE051A631367439E8FDE6CA3E9118CDD5F51D94619E9D331FC",
-"00000020A13F584F73D7E5C0855FB3340E5AB67012C1FD6084FADC710A0000000000000061BA87FF04684EFBDB6069D2B3F46FED238A3190EB69A407DF51143063755C090F8CDD5F51D946199E93E1FF",
-"00000020EC363FC69C5BAEFAD7301BF04DB749DB4BC6B1C3BBB8AE620100000000000000FDAAC6BC83E870A9154E6685B6B4963762E50FD49DDC2828BAA7DB965C8A2B06428DDD5F51D9461921A4281F",
-"00000020E6AFAF2DAE8C98C7081D7968C3380DA0D0BE78D20E032E2E37000000000000007687A2C2766FB4959DA4585261CEE392FF709030A9020E508B832E2B338602185F8FDD5F51D94619DB7946B0",
-"00000020DE89B4BB6992658A8466BADF0947D09731A93535C1C11ABE2A00000000000000789980010CA49F2DD869DE875A0B0A0A0C4EB1B0D24A5B6353D35DB512AC81242E90DD5F51D946190F573E6B",
-"00E0FF3F6F2FA1ABF0850E01834D6750195B7E66CE3C0D1B2F3458EA0700000000000000A05CBD22F9A9183A7D72D01EB6A78FC83C8E870F29A4C9DC4FD6658EADC37896BC90DD5F51D94619661397A9",
-"000000202768141A1503BBD3A6958758BC8749DA5C479A16393CDB430900000000000000F5CE35C7732AEEC32D8251CC618B0AE9A8744A7EAE7171D83217D507EFC097EA6891DD5F51D94619996A4CFE",
-"000000207A5C44640294566D787592D8AACD2E19095C2030D31E1ADF4100000000000000768A87B6ED11B3F35049A34EABE01FB5CC5C011423367BAB6DACE925BC29EC907391DD5F51D946193C4217E8",
-"0000FF3FA82405AC6C91C1F420D0C45E39BCCCDEFDF60B3534D9A41A43000000000000005DFA1C19FDBE96BC03E788206DB74D7EAE4B2299DD1690F957E6A821E4F3F376D991DD5F51D94619805EAB14",
-"0000C020A1EFDD183BB05C285A3B239A7F38BC4CF63194A5EA94AFD136000000000000009FD766D353A02EE9B681098F90EFAA95168BF3FB60067148C963FF7BF3AB1B4F3092DD5F51D9461986EDD63B",
-"000000207CBCED77FABECDA3FA7685AA2DF0EADF2BE6F31AC20CD8DE030000000000000070A0701FAF5490B9907565AAD50C8E7BE331223439313714D809BC66A66A91D2DF92DD5F51D94619F2E46337",
-"00E0FF3FD8C883033A5B7E7F189ED430D59BCC6441190EC9A7F982123700000000000000A3F06251F26700C08B91EFF249F3196B4CF2F4D8EEFA3A5E942800E060689EDBE396DD5F51D946195F34D4EB",
-"00E0002040DD85020E76A081BE26D071F54128F312CF60E60DC4197F1B00000000000000C5DB84369D56C67AA86510B43EF3AF7EAFDAF6A793719461331011029F46CACA1D97DD5F51D9461973B24309",
-"000000208D44E89B62CFB0735F6482DD0BFB7BB2E126E42EF8387734280000000000000011FDDB40B57B7132022B050F0FA9E83114E6DCDFEB722B385918A25FCDC426C09898DD5F51D9461994B92B06",
-"00E0FF3F264744B46495A62EB32D932F5537C04E0D5A2E68A7594BEB0500000000000000FCED90885F37FD3231F4254F8D82E73C1DE8DDCED380A35F20EC2B89E90C8ECBE89BDD5F51D946194BC73A09",
-"0000FF3F3C51CA5456964A64CA6FF755F15D5547E82D61DC89127150340000000000000071B7AACFAAC934B1103A818C62166452660A51F0AD6263F8A074C212EEB59F65E69CDD5F51D9461908C16864",
-"00E00020B13E6CFFE7740D99A993ECD65014CF27108431B4848118FB0E000000000000009E0BE4F9399DFD374B2160B63F05EB4DECD5D4C56190962684BAAB25D5E89AAF279DDD5F51D9461919A71E3C",
-"00E0FF272E92ACE484E7E337AAB62CF0CD58C8040AC0FCD3411127814200000000000000A2F17F76B3E48C95A3DD48575F7315078128E4F6AA6710CE388336D90465FC13FD9DDD5F51D9461993EF7816",
-"000000207A4F5673A0C2972CA225CA6F7366596DE0A7DED0ACF741EE40000000000000006FE7702DE8E456C664DD8878D7B8A77A9E7DA257F4FB48E29494E287E9599C64439EDD5F51D9461967662BAB",
-"0000FF3FB3F645DB951FF4550AA99FD2C3CAA8D515FD53BD4E9A93AD05000000000000001AB1244007EF27EFFADFD61F2A3E14B45454086C1B9DDE36B71E221954B193D9209FDD5F51D94619D1AA9460",
-"00E00020ACD3A4863E38536009A15E96A53EC9F26127FF628D99E3652200000000000000CD2D1B7DAA86D60862949A9824FE08B2192939CC23B8F56BC944383E1F1C38B2F89FDD5F51D94619F1D0CB97",
-"00008020943A2FB89008EE3CCFDD17E7355809D541204A5267E1C6423F00000000000000F9C8AEE635F32F709076F1975B39601A4DABE2C18BE17C6F405FDBCD7932A051B3A0DD5F51D946193D3073EE",
-"00E0FF3F80B2D1385E56B17A294727AD9E78025203C4D0A1EAF255AC0800000000000000D49DFB02E915AE1DE2F52BB443EE628B7C355772C9C0EF35A42737CF94D756734BA1DD5F51D9461912ECDD63",
-"00004020E142B16CD9F137C2039FACDF9978D4A5544B5507D2CF39A20400000000000000B348B60E358F2FD7CA9E932F5A8F4FB8E856EEA6612E1A9D2995ECE47FB3E1365EA1DD5F51D946190A1C3BBB",
-"000000201C54E1422EEF43D72208A75D271E904BD007CBD145BE9E2E2F00000000000000E2F36E8933661406F4DA1B3297B831A02337071EAB5A0D26AD30EADB4335247F4FA3DD5F51D9461996BFDDA0",
-"0000002000AB0A13C24DC7BFF51C944DF38B886BC21A31A0DC51CB550C0000000000000084B4992BFF2C255D9EBC322CADC09EED280C911DC4D9F13309F35F7585C61ABF91A3DD5F51D946192AEABEE4",
-"0000FF3F8A148BFC5C7CBFEED926119392CDEBAC437B7F01E5F6A41532000000000000008FC70086A1F59F06084C76BF5566264B94CFE980370DEB1C5BD46844E98503C1E0A4DD5F51D94619C1DB031D",
-"00E0FF3F871BE0F194AD5BE685AECB2217E59DF59D53E4FF843153242200000000000000966A91F88F562E86AAD6EFB9007762D66F92FDDC14755892F4F1AEB26452DEF558A6DD5F51D94619DE75320E",
-"0000C02040AB1768CC72DEE0B960499B4C56B6BB31B2139666328EB82100000000000000557989C48EFBB43619B9BF6126C3494495777B56EA7D3C78D54A273B5502C6F166A6DD5F51D946196852908C",
-"000000201B6CD6EB05EA6A31A08DD1CF0BDA9690492BB3CB1056BFAE3F000000000000002213CF8440DBC4CB3CBB687E2DC696C1A37AEF896DFBC24091EFD9ABCBCE2CA621A7DD5F51D94619A060847B",
-"00E0FF377413AF2259B779448D4B07E9A915250ADF308F4A044ACA43210000000000000019A1048D38E4C41C1E356E55A208510C77EC7C1A2E92CF86C1E6C1E76EADCDFC54A7DD5F51D94619C0711A04",
-"00008020FEC651A3E34F129D1BC13B3626FF80EF671A477743B3B44022000000000000007AD3C9D4CD7B3AC5C295AAA24471B80AE31EB8D791D235CB1239326D541DCB4975A7DD5F51D946199AA7FE71",
-"0000FF3F207B9E596738228F3905533C8E4A9997F9ECA2F2F89D03580800000000000000F485747D71B3EB2E335063966BDDB9438809D87F4E175DA71A235008EE6CC9A488A7DD5F51D946196D07E3DA",
-"00E00020393E5CB8AFADBE2BE68331C2BD9544083483B0B5222836B81300000000000000C2BB5308DBC39174B1A5DBECBA3285CDFF30EBE1E42C222AFE5C0F8CA31F52F05BA9DD5F51D94619977224FF",
-"00E000202FA7CD6888DC7CE99FF696410568D9081475FDE8DE84F7D733000000000000008BB2AA406BD2F1EB8407D5D76457DDD4081A2136664DA92767CC87A2E612C41DF0A9DD5F51D946191C455E8D",
-"00E0FF3F7731344038B31D7BBAA314EDB4C467B6EB67ED61D8EFA87F390000000000000019EF53A96012579D0F0190F8087620AA8D3F7BC21A9D21A5B416AA53CE530D9B9CAADD5F51D94619864F5B31",
-"00E0002027EA264625BE85A9214D78DCA6EC92F2A06C9BE27B65DE6115000000000000003CF80154062E96024143E0C0D9AC990BA7B4BF8A80A537AF593E163D2129E6D68CADDD5F51D94619F5EA25AF",
-"00E0FF3F1ABC209758EB763C23054F328AA2505F6FE879D644A29F762C00000000000000BB93EA4D1F0442C0599E4386EC2CC948A787738E0131AF295C0989DBA1E723B52FB0DD5F51D946196F6F6E22",
-"000020204873339ADE7BDA43410CDA3768322C6B716CCE4D9888EBCF1D00000000000000C7D7A4B3547D00A1A2561B499C53AC683E7430168A004637B57068BE3CA6AEF770B0DD5F51D946196EC0CAC7",
-"00E00020EE24BE14380B9DAE1E340A943DDB655A7970B36E39F720433D00000000000000F7538ED30DAE94A8FB59144E57CA09FD9A8D0B841C8FC64AE41AFB9066C1774AFFB3DD5F51D94619E555F4C9",
-"0000E020A1BC8368AF2CE90718883CA3D5D2C3F20EC97D4FF136DCF44400000000000000ADB9F1D30CB822415560561ABF05BC5BD243A5C9EC86975CD8935E4C3A5D172BF2B4DD5F51D946194182967E",
-"00E000202369AB0F93618BC2DD567125252932D59CB124C9354BA08E26000000000000001C7A881576940994E91690482A5E5C788C549811F5B64D7D2291C5CC2DA2C74191B5DD5F51D9461941811CA6",
-"00E00020F3FA4AFF89FFDF77946F9AA481F242C3E1F93AF91CC6AB912C00000000000000F4F0C42FD9114C29743FFCFA190DDD855B73C27B1FE4FE16E4137A5E68FA587C6AB6DD5F51D94619CADD8019",
-"0000FF3F6DD204DB5C19AFE8C4E3309735FA56D96E1AC4CF0C652ACE0100000000000000E0ECAF962B0734770D03CBB44AF99F1A9EC94D9B4B74FD5F405C9EE9020E215534B7DD5F51D946194593D06A",
-"00E000208497683E18157CF2BF6ED5446FBAB19F11964F22D929635806000000000000007EDA0B02911BCF5A337C381041F470B6440784FD3DE1384BE4C110ACCE4C77195CBBDD5F51D94619D3F87F83",
-"0000FF3F9037789266C297CDA210AEE674324EFC65CECB5594ABFBA507000000000000008DCCD6AA2139F3A8E912525953717FEE71B1A230369EA12A3517FDA0A9FA49D98FBBDD5F51D946190769D8CD",
-"00E00020EA9EE7B1781684B38C7839300B137D7E5C624E22522A59C90E0000000000000077F22087E77FF2F84FDFC46FA3C74ECADCA1B3E61FB04A74C6770C4B78F9769CC1BBDD5F51D94619BD1A1127",
-"00E0FF3F9DC730AFA4258963AECB3874F546B82CA1A1AD02FF880830320000000000000024FABFB577B23678D04FB3B37F4452E71043B16DAB7C9010019ED51E95A5224FE9BBDD5F51D9461917D153C8",
-"00E000205B299072ED9DCE25086707AC1055A35E9632A145D8E6E4BA4100000000000000D896E25A12052473F2DF9359DBBB3CB1C1CF8070399C07497769E63C7FB54B6813BCDD5F51D94619654679E2",
-"0000FF3F439EA085803433909602CB296F5FEFD5354241A9F42B435D1400000000000000308CC164B34C9C761EFF5DD710387144938A1CAC78CFD95E5B992EE2BDC8170352BCDD5F51D946192425F56F",
-"00E0FF3F803EEA127A7592A066E9FE368C3D348D30B20FB2E2A9AC7A20000000000000001DD4678AA3A67C7803BFABDD9A600595D9F20A31904E2C79C87A9B55719E3DC29DBCDD5F51D94619C5D14AAE",
-"000000206979D20D3701414AFA20BCED78DF16FAEEBE9846937155EB36000000000000002221673A9915294D284E44A665558A594631B11D665E39CFF13A5FBFF7C040275CBDDD5F51D94619A5A0D903",
-"000020208A41F2B63CEEE369F745223A5F3D5AAC287D8D758F6D29B2010000000000000094322C057058CA4BC83CB0B1010B854E77993B29AB4201A87F1B0F3A3286224FB4BDDD5F51D9461995119B00",
-"0000C02089096E6B2E35F80034B477C50DFAD27178A69E0F6E4DC8A83700000000000000210FCBDB7221658400FD56D6ABCB4C9F012C0850303DD66EC3DBD5453267191CE2BDDD5F51D946191D7694DA",
-"00000020CDF3E8EE30FCEDB107AFD44FADA3CAE454378D3C00A0A69A16000000000000001232CCFEDEE8E463271BA6EAAB88D2E9CD7A806511C1183737CC675CF3422EE2B7BEDD5F51D94619791213B5",
-"00000020A03502786C61868C8E0A4AB5B66225A4E3FF817D4AC62A732F00000000000000AD22C59A4BDAE92CB94D1D9CE6D6DF6AA46F2C3BC1995844E3F19307A7B077BC76C3DD5FFFFF001D7B0836B7",
-"00000020DF48ABAA7577CEDB96D88F192CA4FFBC491D21EB42BBF02355EC2CDD000000005E75EE6AA2EFA2FAF566A1B4367EBFBC6E0108E5A1ED66F3D1FB5E899FA753D9BFC3DD5F51D94619F6BEE8F0",
-"00000020FEBCA543DC381283A3603D049A7BFE072A0C1D35B114E89A02000000000000001E7A24E917B2523FE71CA1B9D9807D0A1FA5F680C00DFAFC7A97D2742D012EAD04C4DD5F51D94619885FFDBB",
-"0000FF3F6D9CC5CC9D60BAB73DC80AE7D77AA0C9C9C36BF470DAE4B31900000000000000408A33B8FD6087316979051C46C3A20EC3A4DF680F6938224B652A8A373F1D9D71C4DD5F51D94619905059D1",
-"0000C0200463BEA0CBDA1E296D7BFEF8981EE570CB0D2587903F1F0907000000000000008146E691026FD1FD25DB40BB3F7B495B9FCA0B650561BE0F71EC51DB804CB9E7BBC4DD5F51D94619687EBAFB",
-"00E000201E4358B7CB9CA8778AE00752F14D5DFE407A1F1D3437072827000000000000003110192B744DD3732C0F130D67018B69A33F519C303852AD70DAF9A7CFFE39445AC7DD5F51D94619B1F081F3",
-"0000FF3FA6563CCFD82C7DF3CC479335889C29B8FD2F908990CA508B010000000000000077682751BFEC7FF7673514852C56895D5D21F63AF2B79AD797834C235DCE94EB63C7DD5F51D94619C4188ADE",
-"00004020DFB4A94EC89FF069FEC999EF9E56FDA09873B343B0EB15971300000000000000999FD5FD8515B6DBBF9A372D7D2FFAF030C0E02B940F4071FF6A72AB0CF93736FFC7DD5F51D946190941EC51",
-"00E0FF3F8D97DDBC70840F9B90C506FA0F71207F9B359B04BD9C3E0332000000000000002A4EF7F5DF529C4B972AD2B9A1BB644D6211A9C3E01112DA45C80BDBDD1B62571FC8DD5F51D94619D05ED1EA",
-"0000FF3F2375279CE2C50DC345904459F4CB3D820ED097BC112B39C00400000000000000D9B3D2B1EC3A30F299C55A7B627C292DC53E82D2837D464325A16E41457A87989AC8DD5F51D946199BF7C6D3",
-"000000204F55630D0E989A43756B5FDC305DD57A45616165BC79C1A23400000000000000C0317FB999AF01FCBF2374DB5300FF1DD2B355724AB87C4E04B247006B0B653EE8C8DD5F51D94619FD1B8000",
-"0000FF3FA7C6143A28E654499367D39A785F17008EF3B5B9018F037B3400000000000000C58FBE4159B89FD0A51E90E1A4066013CEE8EF199B0C2197E24680582A55AD942BCADD5F51D946190A6FB841",
-"00E0FF3F1277F1EC37E8F9050D612FFBDE9FADAB0C968CA83BD9B9FF1200000000000000B2FEA59807B547EFA485B412BF2532A4F43F8D9FFAB9C66844C6E9CA882C19AD97CADD5F51D9461932DA5052",
-"0000A02057DA85654BD7F9990DE9EAE4F25C22F45B8C8317C4EDD02B3C000000000000008498B11925CE9A114F0ABF12CA79AD2F83C9A13BCC4CDD90635C4EE5F6D5789EAACADD5F51D94619213A167E",
-"0000FF3F53943BF6726AC6871FF28C18AE865A90BE2F54BCAE31C3250E0000000000000010672D1B8A91C31BDE333C7210D1908C51ABC8E0AEFD8DACAA90F2274CF91FD0A6CBDD5F51D946196D772853",
-"0000FF3F87B30645B884A9B74656A1D493BF0B01A325E98666E3E95224000000000000005524D1B95ECB8DBFFB963D0B2E8BDF115548949E31D2AD80A0984DCE7C4BB7AC88CCDD5F51D94619B4A66ED8",
-"000000207E22145B85BBD5682887928C1EEA4826B892D4BF3814EAE72000000000000000B539525204B1C02589F8652C490913E7BBA2A8E1BE38981FE9D1426C364DF188A4CDDD5F51D94619DFFA427B",
-"0000C0202EEB9AE4B1EABD19D9C2EE529247ADDA442F674E2459D9CA3C000000000000004B76A68CC9066F8ACEEC242D2F04BA951916BB684F8FACA24CF93DFEB4D2A24620D1DD5F51D946191D1906DA",
-"00008020A6A6D57F8CAEE5DA0BC71AACB665445E4279814FE7167F981600000000000000B419DE893AEE592B4BDEF49D571749ECDE538D17C9E152FF188AEC1C5B82B69B64D1DD5F51D94619845A7B50",
-"00E0FF3FA41333FC465AC07EDB98CC4CD8E7A41B21010D9BD1A0DBFB2800000000000000A44E94F94EDEA4F7FF355AF2C7CC1919D36D163A97FA8E733EA2BD38750EA86988D1DD5F51D9461927D6FB51",
-"00E0FF2FDDAE8507969FFE08601FC6F3EFF1878052D13523CC1AC0DD45000000000000004F90BCEE409A24E3FBA7F168255776419D8601EC00E98A69F45B571DFFA50137F2D2DD5F51D9461928544EFC",
-"00E0FF3F2AE2B1A38726607603E6D3CD216201F25AA73F958673272924000000000000004B1C1D8C7E3F28AC01830230D1773A748D99C9EF101F7CE623F43B1228A72C0F8ED3DD5F51D94619B73B3B2C",
-"0000FF3F6E164079CC946AAB06B855A33889DBA2325E55ECF5FFB23D14000000000000007204ED9A964BA67207F734FC5C65FC5CC53C1D45C4FB4792034A4EC48A651C40C3D3DD5F51D946194087F26E",
-"00006020D9FB68D4FAF82C0497A8F7E1F8C4ECB43F3EB41AC4A950802F000000000000002BADFAA4CA5C2E6DA7F5E4CCD158F9F8E8C94624BE08193504C54D8F777BF5E9E4D3DD5F51D946191F4B226A",
-"0000602048D9D488B6D9359473F81C463D5C3A968BA691ED987F9168100000000000000007A453A440EEBC9D31B11B5271095762A63F18B15F3D2AAF8BAA572B3FF0A03F30D5DD5F51D94619660C751D",
-"00E0FF3F5629BAA6127C973CDF132366391EC883344273D7B897B08846000000000000000A1584A9DBE13344D0C964BD0E9ADF61B33D48F770899925FCBA49C26F26C26F5ED6DD5F51D94619D233A98D",
-"00E000209CA5E2F1160E88E7474FD0849DB3DCFAF75EB464789E584A2900000000000000F2410617E4C4F54A4FDDA6E75EA28D193504D8297526071681CA55E92D7C27E184D6DD5F51D946194A74FDBC",
-"00E0FF3FE7D5C175F2B3898F7286FFF7270A10BEC89B2B0541CD492C000000000000000049E9030ED6338B3D9F28C3D91DE19785792B6154ADFD9D5409DFF4B5F1F9B23A54D9DD5F51D946195B97165D",
-"00E0FF3F45930003EBBB1FBE38306589112831CF4127BED00BB2B8B41B000000000000002589988FD1D1AE5E1BE0B07EF6F987E871C6F6AC4B19DB7C7A5F669050495A9346DADD5F51D94619E27AC523",
-"0000FF3FCED0C4737C8099158876D4155C78933C50ED0A0295F9EF762E00000000000000327C544EC1A8C03453BD857ACFAA32FF0A10416C642BDA04098008C4BA212CD216DDDD5F51D94619298100B5",
-"00E0FF3F12BA18986F5D69F3FE3DB96158C7E69272C27BE41EBF17691D0000000000000069280FFEA87B881A10FB3848F5B2F76B27053407FA54DC404D43630BA1CD50996ADDDD5F51D9461977391976",
-"000000208A778D1E580E8F7BEAD797937446FB5232D389E484398C442100000000000000AACCFB7F9BCF5CB99EEDDF1C6A9622C15910E3D3457DF09C12F64C2AA2D2870185DDDD5F51D94619C9223013",
-"0000FF3F8ED1BB8A5CEF68579E3C9A325C4E4EDDE78EA2A4EA12B4F42A00000000000000DDCE64C223A6B475B2351C6B06F4F0F03BF4700FCED89770603F500762478B1798DDDD5F51D94619B917F59D",
-"00E0FF3F22853C1BADE416D68EB28D4069A0735BFA571B823F2A28AA4000000000000000FDB55A1695A5E08065915A77BB4C96458E188CFA572816BD95291E7EB02BBC4094DDDD5F51D94619518C87FA",
-"000000207785659737067D5E1D42D613DFDC0CA93779ED16158A6AF50900000000000000D792930E532F7F0DD0EA828EDE870F83E28A7732C8766A6BA1AB6BFAE0C085E207DEDD5F51D94619C7B29C71",
-"00E00020D64BAE3BA6FF9BFE289B345BDEA1A7560C480FFF01FB057524000000000000006C134DB8D92B3382D2AFAF19EF7594C10717BA9BFC7978744405FE291064261197DEDD5F51D94619E009530D",
-"0000E020D27489E6E02289002C15D42BB7D9DD4CA8E08A7B98078CEE2E00000000000000E6E8B9837CAE14B1F9309B50CF8CC1A92C5021BE0C13C74D444972D6A4CA9203C3E0DD5F51D946191ADBF1F6",
-"00E00020D136C989F10C05C295E6437D17187D01DFCCA0200119CA8A3900000000000000D79FC800091BD0646D316F889A59C5D668C24195B414A06E144270D0F3C8B88205E3DD5F51D94619A26DC898",
-"00000020011D145B4053F49D51FE395E20DFB39358638712656B97BB2C0000000000000034ED5867B70864A577044914F51F5E2B5CE16064FC0FE5CF94068DB4D5F3AE305AE3DD5F51D946191DC22046",
-"0000FF3FE7CF70BAA00FDF4E27F96E3DFC54D253D885BAAADE5A8707360000000000000038ABE661DBB418FA843EFF39FAE9E580757C90FBF1F970E84F8588BA0C5CE2A07AE3DD5F51D946194B801235",
-"00E0FF3F0B8F8987AA6E4CC1B079502F0A5A2C80DD247D6ED272AD882B000000000000002B9D9910183D4F35CBD132EB0FCB6AEBF35DF4DBDA9FB2519212E005BE10C8DAE8E4DD5F51D9461939ED9BC2",
-"00E0FF3F0A269FD2A5ACE0CC92507B209AB1A6F54388885ACBB885923C00000000000000375D7401EB53E4902D6CA1AA5FDE7C995A74A3461FC574D2BFB97BCADE6F864807E5DD5F51D946195B4C4EF4",
-"00E0FF2F37241737BCE1157F4953311FA8251BF688C192E790D33A15230000000000000085F779977E11251E38F18AE88D94C2D3C0FFF130817330E2CFCDCBC80B1CA8F154E5DD5F51D94619882DB583",
-"00E0002008B500DB3BF0B227BC8CBFFEFFAB212C6789E0112069BF6B2600000000000000425EC42AD74894AF710A2D5A67209A5C7ADACEEAD490FD5A2678F84ECFBFAAC127E7DD5F51D94619B47AF3A2",
-"000000209D37735BE298DA77E1E5054B620EC12404B9295A4DD1306D4000000000000000E670E4A9B31BB6AABB3FA018CC0067D92EBDB6669C527D11D55405DE9BE333C22EE7DD5F51D946199D71FB8B",
-"000000202539DCB30810DC974A00B8B71BB73BD96AA6EB620634193F2400000000000000384141C3B7A6981AB4D7335A2D77626BFA6F4503A2A4B60810B24655AB2FCB8431E7DD5F51D94619B3FF4D58",
-"00000020DB272F59E516BC123887740F0512B775C196573F6E3369A5210000000000000037EC5957C4A6C7935F18CAA555191181AC2D1E68DE66A0E28CCFFE721300CEEB5AE9DD5F51D9461961D6209E",
-"00E0FF3FDFFA1F9A46E1536110B4412CBA433AB191FC942D181618A82200000000000000294FEA2171BF6851C5DD1A0CC14FD733B8C437CB40DE2F9E1EEFFDC6F49C9E3259EBDD5F51D94619CFE1E3E2",
-"00E0FF3FAC669E81DB5E583B4AC29EB268148092CFC22A64DEF880AB3E000000000000008FC9D61308502B04E43C4147856ACD39C979E1AA9F6E78C4A4001AA40A1316ED8CEBDD5F51D9461930559E1B",
-"0000402067FC13FA932F1BD9B662BA6FEDF9546BBF83F09C9DEB12843E000000000000003D70EC688D1A67451BE2EC7C73F395E44FEF10870AE9EFA9E7DCF0FF456124569AEBDD5F51D9461970A2278A",
-"00E0FF3F4CA9AC0EDC0BEA04DEA21EEC53A9D9BD1488B2C081DE24A3290000000000000022A5B78EA269F153BA0E05AA2B75035C42C19AF6B18CD37850D177B58261DC6E7EECDD5F51D94619B3BB25B3",
-"000000204D5091C449BD92BB280E10C6A8D7C99351CE9CE24A678CD42B00000000000000E6E35ED6D2BE9CA68323AB5F258EA4100A6BB04876C25574621823F7590BB1A0ADECDD5F51D94619B26EC2B2",
-"00E00020EC7B236A84B5D3457B9C3674DAE211F82DD49AA9929DD4B73100000000000000B38554510202A1BF6B42AE5D77349312BE5697DE725631CCFE727057993F419A42EDDD5F51D946195A850DF7",
-"0000FF3F23A0966E14CD2BD7B36A8D021DA37D329F0003255BFE4F651700000000000000B58CFA34687FB780A07C2FCB5F6C5121AB0EA545C0E390A13A9708D3C94592956DEDDD5F51D94619111E303A",
-"00E000205F3365D5BADA70BCC9E063DF6D00F712D4C9625744BF5ECB3700000000000000FD353558D693843CF428FE628FB20553177268FCC5E5543D36F8C56993A7D4152DEEDD5F51D94619F3650819",
-"00E000207BD8783E08A6D589A793E1E08118C8653E9E90DCE0E6A94B3000000000000000C3F43FC3BB17F9BB8E49E6F95110D4141878C5F047F9892BAD005016ADA72D546FEEDD5F51D946193921D47B",
-"0000002050ABF7A822AB9B1CC23951BCB9BC6C3E2B7A363018961C460400000000000000987DE7DC7BDD38F000B197F6A6315185D23EE82C7FAB4C2CDC51FF6264CC64A3E4EEDD5F51D94619A132B0E6",
-"00E0FF3FBF9F9C1D68339BF5E6D9583EDCA55466DB1D659FCB6ABA071200000000000000F96AC92B359CF10B82F547E36C0CD1E6102E1CF894431E5FDF5BAFB260E46F947FEFDD5F51D9461953164875",
-"00E0002037C49AFBB291782FA798507124FEAA25DFD26D8F67F3DE953F00000000000000279374B8600AAEECD5A328AB8E00BE310A18A3C5ACC27BAF9DF281087B8051E9CBF0DD5F51D946191EE29588",
-"00200020D5DA1024A9CB0DC80128BB8A7A2F42436D82AB212164B0AD2C0000000000000009ECB98B3F586C6EA7E0730F1B08A403DCB57EBF5F51B7A0B7383633F1572F20FCF1DD5F51D946198954FAA5",
-"00E0FF3F9C5C03DD4B317545535B38FB8F146F6D322BCC54A8C044E32100000000000000CC2844A7D19B92BC95520951EF399980B2B5453729FAE389BEF14EED92A48136BEF3DD5F51D94619893726BE",
-"00E00020A275F0BD24D5BB9356E63868F1B931CF34741ED24DF0F5932700000000000000106101FBFE30433CA136C7A5C672AFE997D0B9F3B4172631D1FDAF49E371F575DBF3DD5F51D946193AD2523B",
-"00E0FF3FB68D036B902359758EA93162A203446B9F667905F90529D102000000000000002B9EBFE33803CB800D1E4C24C74D87E0B7AAF644A23F29D1585A7A9F99AF3CB0E9F3DD5F51D9461995F1387D",
-"00000020FD4D481CF84D002C6480B8E0DE3D8FC21E0A105EE3688F7F2D00000000000000117017D99D32E6ACE95A059ECA7DAFDA59E3B0822D8662A99F6F7ED3659F816899F4DD5F51D94619E27728EE",
-"00E00020A20D7C2BF885094D9C0735F0E54118D5DC9059974BDAA9191F000000000000000DD5B022B18F23D05D42FB6D7B8B39DAB2B17207D7117C880BF493F41270924B3DF5DD5F51D946196CE3B2CC",
-"00E0FF3F8E3D37A6747816DCA46E88D4BE67455B33A12EB06C9AE15B1100000000000000865BC87259D7CC0F846EE7E49D5DB6A917D1CDB3E15EC27F0DD2F861AD8C1B1CE8F5DD5F51D9461988CE020E",
-"0000FF3FA98911AFCC3987A32A859BFF3CA737D6A5314ED3974738CE2300000000000000F19AB15936AFBA938803028105E7C3E7202B29E35765B2DAD9AEE971B55C57265FF6DD5F51D94619E44641A6",
-"0000002018FC2BEA5F17E815F0A7175B4B74A1C6D15721A08610F9B742000000000000002048CE551652A822BBEBFFDBCD29267BAC62CCD6D3BFF3C7665CD29EEE94CCC877F6DD5F51D94619500EA5EC",
-"00E00020770A422AE6355C1C3EC9513019195E493D8B430A85CEF7281A00000000000000837B937ED9E9BCFDC674E357F9AE8DC2F6B4C98EE335B6A08EB382FA880FF71C44F8DD5F51D94619F2433F9C",
-"00E00020749C1C874ECCE4DE79D3A1D5E76DAAAE8EEE6A2D40455C621500000000000000F8225B80652702E0A7AB1A0D2CE627CDB797E5B9878F816351D6FCB1B76397730FF9DD5F51D9461947359833",
-"00E00020A5A4D4B08E323BAD107169E84FBEB8A5ABFC076CE357DEF627000000000000006BC3512ACF9965657B129C43B367D8692F4D0920B7B91D95365EEDBEAC023D6764FADD5F51D946190167A1B5",
-"00000020BF10C9DDDE90952D71FBA9B5E2AC1398B1070F8224F2DE5122000000000000000ABCB674E82B01747ABF0519348C7EA6B930A5BF191C8EAC8BC75F4AF7E3FAEF3DFCDD5F51D946199172E90B",
-"00000020777763EC21541004A3E307CDCBD7B4EC230B98403C70EEFA14000000000000007F45EE65AD65C5B0E47ACD1A5048252C9733DB57610609A99BD5734C3DC61F7E7EFCDD5F51D94619AC7C8586",
-"0000FF3FFED4CE7515F7C56B92832C67D7DAE872C22168A1A555A5980800000000000000358E6E0F279375025F1030A91F2412E38ED1D225ECB7ACAF8C1A4587E33DA5A8F8FCDD5F51D946196D50F150",
-"00000020DE3C0315581BBE76A6E2A6AAA548E9DBC233D0F045A7934923000000000000005DA2D35A20C8AF6DAECA1D2AD7CE6E668888EF65C06285B626DB8DD16111B57613FDDD5F51D9461955F303F4",
-"000000202ACD269AD12246A200A98D872634788DCBE2AC9C62C44FD31700000000000000218A52574A6DC5B2EED3143AE3B3A3BB24CF8BCB098D389B2051B284C964C9D24CFFDD5F51D9461995589842",
-"00E0FF3F47B8EEED8F429CA3A92DEEE957BDF069AC69F5EFC27275D832000000000000004ADCB8DD8CA622112263F304B7086891EABE4C25026FE4856A2589A161B5834EA8FFDD5F51D946191903A669",
-"00E0FF3F8A3DFBB6CC798383FE863981CDD878EDF06B2C32E9D00C203B00000000000000FC4B3E894F3C90EC43903736A9F0399839CF3A53F1EFE594A4B0028DFB0E7AF1D801DE5F51D9461911FC35F8",
-"00006020714408AB8A2AE2B6AA1AB34E9F34A87CE11A619612D986E70D0000000000000098ECDA447478F113FD7A673A65C2E9C68A24051B374D4514A81786ECAB944D0FE201DE5F51D946196B0A5C90",
-"00000020652AFD41C201D429DA8F705938835C28015F2DF54EBEDD65280000000000000073F088A370E40F24564AAA4FBE18938FF60092DF58CC280F2291CE7F1C4A5F4AFE01DE5F51D946195E7BA1E4",
-"0000FF3F20051A03C03EB0CDD4C602BF6824DF3913B20DFB2466728C05000000000000000A4FEAA13D6363EFBA25A53B7533AC54CA21724CF4CC4B3F273F3F48524629A71503DE5F51D94619E3629E45",
-"00E000200AC1E92B35765326E2770F6A29186237E877A675C9BE28A51300000000000000F22767163115693F0A37C26C57F5C3C0FEE2082542F8B7BAB7A56E588F2AAFE42E04DE5F51D946191D4271B5",
-"0000002082515184C44F840A81C15585012B2E8CBCCAF8F37B308FB92D00000000000000943907B27931B5BBBA635576E5ACDEA1E58172B236A094D860A85A1F6228B4DF8504DE5F51D94619EC9AE2B5",
-"00E0FF27922B94C306BF62394A48B9EBFA641AE4BCF901E95CEA410A1C0000000000000027CB5FE875A53A9994B70919760888AE70391185BD95E4F6A4F6A3A4A0783E259F04DE5F51D94619B807AE16",
-"000000207CC8AAEB1638324D8CB3A98FECCA790363810E251E8F9EE826000000000000007ED0C38B79364E8E09E7503647ACBE9154610A67A66182569785D48D743FA756B105DE5F51D94619331ECB4A",
-"0000C020F849DCBB9A78847940F2A6A59F5850586924156A736518A720000000000000006B7DAE06B3B50FC76D21030C3853801A5615B966B0FDEC3C50E0588B6C009FD8FF05DE5F51D9461924D57894",
-"000000203543E2AAE98E980DD1D3E30427D50D7835D170F828B45D233A00000000000000B43917AB1817DBEB5F306930132EFCB227346FF04DD82971A07E746D4BAFC993A608DE5F51D9461957D95EBE",
-"00E00020BC3C9FFEB2A040B9292924A477D05D10BBE84BB93DDDE9A01A000000000000004E1A76FB84E746240BAF7662EFDB9C513E25C4077980D67AEE5DC39F99FFCD8FFE0CDE5F51D946191019E3A3",
-"00000020C13F319E5649205C431010A90F26DB575E6E01C4777A10D84100000000000000CD9352294756820093B3A7FC485C80C742A46AAAC1E012959ADF35F285ADF6BCFB0DDE5F51D94619B6A5F8CA",
-"000000204297D93BA3EEB2267C665098AEE2FA1EDFBFBBFACC38B0CB4200000000000000B678FAEAA76634D9C59AF06D5AD91F7CA4682594F4E9DACFA2D9CA6792AF5B88D50EDE5F51D946197330DFEB",
-"000000203ECED298162A820DDAB96B11E0F18455D5200008B36A13342300000000000000660BE73E468AD89CE333B93F21B5FEB53FFC0940A1D34BA9012ADACCD585C1021B0FDE5F51D94619C8A172B0",
-"00000020AF739774B37B009CFC283949D24ABDCD592A00925B8FAC7D3200000000000000FE44FAE967E7C0DB498CA14DA69120B0777C1F5AF61936E37195909F70236B3CCA10DE5F51D94619941C1747",
-"00E000205D69B641F64DEFF04E5E37D181CCC556D85B1960E7643A1B1400000000000000B2742CAA3E1B0998580ED173C204B16033031666FCDEFD4FD56953366C3E4A501311DE5F51D946191CEB35AC",
-"00000020863782391047CC16143BEF6F170666EEC67EA672B1B2B37D0F00000000000000203B88504ADF3641CA525F9CD0526E27E5687440769D6C030E8EB3D50AA57BC7B812DE5F51D946199385C0D8",
-"00000020C42FC7FC13E128A4FE0764B2436F8CC741EF1E5441B4C445320000000000000021A937319D7C68F99215DAD2F642DB21F630F9998B87163FCF0900F80B026F397A13DE5F51D946190BAA2657",
-"0000C020CB0FDEE68F25AF72338D31189B852551E00709B0ABA0155924000000000000004F036796F5D668EFCDA2109AFD2F929F3330746698078124CF913D9E2816F99B2E16DE5F51D9461992460007",
-"00E00020BD15783186C3841C4E2B8853992F3B2E6C82948B1B4273664500000000000000F97D04F9D6C5DD487A04CD47E15B7D7390056411393EADCC1E73B555E18898002B1ADE5F51D946194D75E273",
-"000000209BCC737EFCEAC2F5B588CBD7250EE89E5ECCC0BE50A8AE4E3C0000000000000009E14FC3FCD4E95B7FCB7ABBD3970432A1F9F1D732DE6E22B86915A6744E3AED181BDE5F51D94619F01272FE",
-"00000020A09B387BA55753F9ED4D6EB886F71762FD07342395618FBB3A00000000000000891D1CAB3EBC81994CAC27A8092B05F88586CE6489468C6157F0354EDD705F6BCB1BDE5F51D9461926A3C7A5",
-"00E0FF3F6ED9349BBA1A792C5FF097C101879D32788742E835A721DE3900000000000000E0E9DDF7C18E0B2B28D8AA854CC6AFFBF84C159C206811994C47BD1DE914374DD71CDE5F51D94619EFA2034D",
-"0000FF3F28C7D131EFD21BDDECC2FF3CBACE23B6D7255626273CF2DC3600000000000000BD406028FAB61F52D407BAFD9689261E605ACE237C54B6F750FCC40D6AF2AC02281DDE5F51D946194B87B5E2",
-"00E0FF3F8F64F0445D7D729BFBB70B88315FDC307BAD3220EDF800B72E0000000000000083F6006BD5F5CECBBC1C6746CC39286F61E1116A4282053F7F4B15B67200A5F59B1EDE5F51D94619F1E3C99E",
-"00E00020939819EDF3FAEEDF2CAB0C1D9DBDD4FAB24D841C0B17881A0E00000000000000E9910D75CE5D5B320FC6B32AED869EF83A02920F86473D371028A39C4E3CB106D21EDE5F51D9461936142B27",
-"00E0FF3F9DF534708B92D3B1C0AE89C5FBC429B0B356892F318E0B1B2C000000000000008AE1FA11A0E55B564FFDBE417FE5ABA4E0E97396B9752D53448DE2CC90DD4BC7191FDE5F51D94619905DF9FC",
-"00E0FF3F4F7505828707BEBF6DEDE56D128DA397BB90EFE1122CC25717000000000000002885E8A5964DBB88FB6C82452AB9222258881B1D6220DCB4E03D9BAFC1931111AE1FDE5F51D94619EF441E51",
-"00E0FF3F2AF5CAAEA97BAD85DDA7DA2A1DD40CDCC4FDAFA9C42F35612500000000000000105D24D3F1904D4FC0E05FBD279BE0D31DA9706B39AF8E8F1C969E7EC25C6A630620DE5F51D94619D2F044B5",
-"00E0002012EE1F2FCA1C6B1CF5534A14114DAAD36C79865B893383CB120000000000000033F085F576948834784F69DC2A4935389980FB158D7892E63715F4C41457EAD05720DE5F51D94619EEDA57B8",
-"0000FF3FC847CFF62ADB2E2B2AB48B018B2B630502F27B2519187FED1600000000000000DD36D983D14EFCB29ECB52239B5E6960C6210C23B11FAB596DDDE72152DCD0B8A620DE5F51D9461994B434C3",
-"00E000208CB1C587F864DAB039F255C97C05CEB80D11B1A4EA357ACA2D00000000000000178C688DA64067033631D9F1511F7AEABB44FB9132697ACE1635F2D110F1135D1321DE5F51D946199B288DE0",
-"00E00020577DC7C61E23DD371E305F7086E519CDFD22F9F2AC04D92138000000000000003A568DA578B6AB9F5C79CA7FF8A125296A0A5E05ECCCFE43B313B9EAB52724C1F422DE5F51D946197A2FA886",
-"00E0FF3F99D878FFD8BA69E779F87B130658A641E5D83A200118FAB624000000000000000A6D00497D97551E308C5A85228935E2272DBB51628C46A28A26F4433A0DF23A1623DE5F51D94619E652371F",
-"000000207035AFC53399B561D8C7B4CC75C04E74BFCE66BA43334F1B2F00000000000000229DB6783B704073D224FB4FE2265A026F7845F63CEA625B15952BA0B3EAD18B3923DE5F51D94619689B01B1",
-"0000FF3F5784F4A1A16718742690A88B84951786E8FB5651B5EE66AE280000000000000019A3944BD08987BDC8645964C7A94424E71A0B4E0FF66E022948B3F13C021C705D23DE5F51D9461970B8BD90",
-"00E0002032E9F44E75D9E4B164F29F3139F424B5B21DF08461E30C8E41000000000000006161DF4AB9F154E36E64EF48B2A56C5723C465BBA9514553F40A26C43F2F81ECE323DE5F51D946191CC92689",
-"0020002095256572FD9192DAC8AE03300DB6E9AA2909C14E1092EAA61A000000000000008F32CE05723E10659DBA7A98D7676FA58919D1E04F939A87DC5E9BBB6EE8CABB9724DE5F51D94619CD93AC79",
-"00000020B19EBF4A953A0D8648E38F2B8B7ACD178312BFC9CE46339412000000000000006B444E54B9A044393FDD1F75859055F778FB3224DC17CF31EFFD68667A50E779B825DE5F51D946191221E2EE",
-"0000002046F0C4772A4A1CBF9395A632CC5DDC9EB44A248C303CEFDF3100000000000000B94174A25A2F04EFE62CBAFB434241E8E96D3FFE3DA45673A7BFC20062899A4B0A26DE5F51D94619AC60482F",
-"000000205E13FA53B0291BF57B8E10DE98B78490FBE5A69A22AC6AF3410000000000000035C314E4C22214B91F9D849202CC1B56300EC6C3E5DA708CFF049B44D9236C2AD027DE5F51D9461983C87D55",
-"00000020283C698B9B66077D30E499936A604B64BF1B471AA47DF1CB3C000000000000003153E8B8F09404F72579C633AA75782FADEACAF7A950F63AE25CCCC78C2AF61CCD28DE5F51D94619A25A49B6",
-"0000FF3F20CBB3AD39CF6C9282E59404BB2D06E7EDE3FD511024FACC01000000000000000B1CD90B76B164E9660AF634476EF38C1E9D8A83E7C27D15EAB2165762DC28026A2ADE5F51D94619D1F65C78",
-"00E00020221311B02B22A09CA852FBFAF8ED2C2997127B3ACCC603301400000000000000E3E641F28BC88E5790FF4B1706B52C8F58A8CB36F3215672B1E4B396389188552D2BDE5F51D946195C1EF4E3",
-"0000FF3F0019C48C292B3DCCB05A7B1609F8C8178B8A255B7480C14807000000000000007717F6468B890912C91A2836F75D727419E24331F71CD9CF247D24652B221138B52BDE5F51D9461918CE9AE5",
-"00E0002027F5E00502DED8476C112832E1F5CF74E28C11E67297E7892B000000000000009FFE2D1FE0574994EF265363B5627935AE8E1A48BE95972D13DC4FF6C4AD4A24C72BDE5F51D9461993066B2F",
-"0000FF3F86802D1BF31EF9CB627ABA9F61D815E808B0ABBAA58480D21800000000000000B83E95EE6C1E729B71B66486D72DACB855CF4482C43F18804AE2A438DD664D6DD12DDE5F51D94619646CD9E0",
-"00E0FF27EA93BFE1CB3B86D24FAF86C644651DAF765E15E2C8D56A7D0E00000000000000D5D99B1D4C80EBA9FC1AED50B36E68A03ECA2A89DDF4CF8D40F10E3049776E6C592FDE5F51D94619EF2F227E",
-"00E0FF3F483F08752D860CA8E9B1B60F69077D607D52F44883D94DB12700000000000000C4A943000B50156C59CC176806A7692A1173206287F87969554C93F2EF9585943B30DE5F51D946198D0C720B",
-"00E00020CE06867DC4C3EE36739779B47EDFB8AE62A7D4D1D965FA292F0000000000000082B717A5D9921150F05120BF7FB4F18649D4BD1867AC860B716EA10109DF129F8531DE5F51D94619781E0431",
-"0000FF3FE25F28199B411E89F26E276673DA44C3D5ADD0DB56A4421344000000000000001500BF1A956073B11F50B04843E599FD034E656CC13BAB8DB855290AFF65E123D231DE5F51D94619A6D322DF",
-"0000FF3F5017D632F7AFB9DBD1E497D60D2157717D6F1118B16CBD271A00000000000000BB88F493EC73BAC132670AACB5B40EFDCE159980899DA96F857E8EA545C708FC0732DE5F51D94619C178D3FF",
-"00200020F387D717FA780BDFBBE55EEF3DE67EE4BED6C8B826F4AB00460000000000000087662F9C78206C66ADC30F5BFF6DF8A99707FAF806DE6A44F04AFFED209461A6B032DE5F51D9461969756029",
-"0000FF3F3FD47933AD1E8CD49C1E03A3752BB39245D4AB1C4D5A255F0100000000000000E84744FAC209DE8266341021C75AC34D307A659E7BB50AF648B6269D0B7F5799D134DE5F51D946192A7096E6",
-"00E00020DED5F9E39F8676E651ACCF02A155EDE7D32A1CAE9C3EBB822F0000000000000032C8E9DB137DBED06BFC48A990EE66A0A4DB30402A24C3384166BFA82F24D5681535DE5F51D94619B3D9FC70",
-"00E0FF3FC9DB44EBBBDC53088CDF042B23C161AFDF92278ADDB205FB00000000000000008D12A60D05B82C30B9243520F4040CAD0C3407D7E7BFBB914CFF54CB14E652E72D35DE5F51D94619AF17275D",
-"00E0FF3F36B8AF8A79F7805DE5630FDF6CD94350C598645AC8E63D271200000000000000ACF7AD3FD186E7AAEDA4CA976F0D25872015118F27F0055768D696CD0211012DBA36DE5F51D9461930ED75C4",
-"00E0FF3F7699147B6BBBDDCA400DD32A60FACDE4F2E45C94B7E8BAD32B000000000000004FBC32EAAAA99BB88091F4DFC1A31A13230B87C5AE8394EEBA1C4831347ECDA0EA36DE5F51D94619A3A059A5",
-"0000FF3F7C50DF239DB6EB2E515ADF7FC2EC077C7FD82B51D7DC819C1700000000000000E68B225987153A1565A80FF174F9A0543A0277E18CBE303A6423DDFDD08F9F16B437DE5F51D9461901CFC1B8",
-"00E0FF2FBB0AD4B03FDDB5EC82E1F7AB086894B4E84CE559E5F963AE3200000000000000EE8B2688B688A2682EFE69CBEABA7D41EB28AC86B24235C057918F151D3D07491238DE5F51D9461981BE06E0",
-"00E00020E24DABE3C6C5E311210AE4F400EFEA1A81A78B60C7FD2BC52100000000000000B1302FE327E1423E0B6B0A56A1A9C592DB189EEDE56BF9CF57D70F0555111F78E638DE5F51D94619CC475701",
-"00E000206BC2E2907474FBCBCF0E9221F0A402967F8353E702E3F47341000000000000007F32D1BA0592864FDAB3D2E2AD70069257ED25FC3E54A17C41B3C19934A2A105FF38DE5F51D9461957816D0C",
-"00000020B43AA01235D1DB35658EBD8723AF34239086CD8638DD357116000000000000002028643EE0D80E281428C2E3DA698C1BDFC92DDAB17E753F09877914D9B198B09339DE5F51D94619693F81CD",
-"0000FF3F0A2353A9DC46AF3D6D4E9814A78213E361F0AE23F5FE94A21900000000000000238E8EA2E1325799BA3273E92B75622747CB2669FEB987CB0446FF8CC8353439CF39DE5F51D9461993B7D368",
-"00000020C93D9E40A074A9F39C7EA23474D7DAD11A85380121AC74512700000000000000D9C8977C3102832D0AC14256A6FE4FEDCE5F315615B84DF0CCB252C5340CB0873F3ADE5F51D9461996CA58CE",
-"0000FF3F709F4FF7D2F4B2A4487AB93C7866E48E8EE565FF2B79588422000000000000002B9D5448DF44143D423DBD4EA2AE7AA68CDCFA7E634601DCE352941AAA7E198D623ADE5F51D9461983AA5FB1",
-"0000FF3FABA5FD681B35184B71C762839450D4F968676ADA714E2D523D0000000000000087504278C485157D1A66241ED9AC3CA250F4C056AADF1B7C568A47432E643E45E13ADE5F51D94619FAFC9DC6",
-"00E000209D694DC03F352B0832CD629269E428CAD0E42AC86FD8D43C2000000000000000548AB8D7492CB19E8807AA7CE9D1E658ECB74DFEB936225FD3A428422D98EFE0D53BDE5F51D9461959295AA8",
-"00E0FF3FC4E456C165F5687ED833062FE9FCB3955D33626908D8DD0E13000000000000007F11D35F65EF40B4DE2658F842DE38D1B9920B0B5A22E437EB8EEA5B2C23E71D003CDE5F51D946195E893FA1",
-"0000FF3F2FE45D6B7DACA3BCA24024C08CCF84DEC3FCFB632D4F6A303900000000000000FE8E8D7DE7CC943A287E368E81D8D39A1ED2D21EE927F2CDB3C1615AF6C0EC66093EDE5F51D94619B106C8EA",
-"00E0FF3F1465E6F6468C7036C75D9974B151868CC93E88AC16B1F2C63000000000000000E3B5F3BE4B1C55C1DF0FB8BD2A5A7A612289CC0AE6FC4BFB52D65B843281368A7641DE5F51D9461900A3281C",
-"00E00020986BE2FBBB00F2B6D10843E1005779A923523F099FF03225250000000000000057830930EC32A0CE6DF0FC619E61287FA699DA0110D76CEC67FB5744AE5BAA309141DE5F51D94619BBF4AD5D",
-"0000802089EEA81AA55E121C5722434A574924556F872D8577ADB37641000000000000009DF5C0DBBD009F0034D5F7A5D3AFB0A0F3F77C2C51EC83A4706D9235E32D40F8AF42DE5F51D94619A31D974F",
-"00E00020796F6773D994120B06EF4852D2346AD0272DB50D51CC8C2D0900000000000000EEFA4335ED90D1A6678BE7F2010AB119FFC77288F382BB2EFD9A2585562C4EDA9A43DE5F51D9461942FD88D1",
-"0000FF3FF69F907D6D2D44216359D5A5FA5F4F2B399CFAAB9328FC110D00000000000000BB48B8A4A2F3FC4FB98FB5A172A9F46DF4EEA60768F658177FB15141FDD53FCFF943DE5F51D9461983086E58",
-"0000FF3F395117D8D9219D81C206781CDB5EABF1AAD217E679F6718B370000000000000098B53E7EEF95C9867C306CB1E38641A7878192E714C5F0B5AE272A94A59DD71F0545DE5F51D9461901A320CE",
-"00E0FF3F5BB53A86B130A47511E26CDBD9D19B10314C348ECC79B79D2700000000000000AD03871B221E309E509BCE2C3613F97C589A4BF223E0FBA90D881641E3FD4D211145DE5F51D9461945AA57DB",
-"00E000205490F27AC427A6E3904EACA54EDEBB9D3EAC707DC34013B93E00000000000000A7E88F8DC47E0CA44E6E50989A2D0D387423514513DC90F9A9BF4A694AA43261DC46DE5F51D946196A739782",
-"000000201EE1040F24C64A714AC921444896571DE8B99BDEA41CD2341D00000000000000A099ECC254E7793D672D9626507BF0E6598C3967B5DBE0C6278D48CC9A3CB3183847DE5F51D94619ECE427EF",
-"000000204F4A4CAAD729E0BB9996F4820F9B541B5E42537D568AAA6F450000000000000095F3576620D697C14F97E2088254085B4052D9A9F1BEF4D5CEC4AEE0B9FE79FE5747DE5F51D94619F734A8DB",
-"0000FF3FCFC97A1140D927AC6DC2FAA0564644E12F137B9568CCC0D93C00000000000000807F87A42B4C214EE755E163E8C438A509F42140C486B734C529258BCB2F98999D48DE5F51D946196C7B3FED",
-"0000FF3F11BBAA17E392C6D242A26180A67C2A5C4AD50009686575514000000000000000783E9375E8EA21835599B410FD8F788017FC649E028BEE3EF238B0EB432A40C3AF48DE5F51D94619B29B7B72",
-"00000020D2941F5AA7DD916454A8713E4BA62001853FA4850DEF468822000000000000007B63B8B20309B28D437111564BB4E52CAE12F86E433F527E3B4C18475E500B8F604DDE5FFFFF001D027F805B",
-"0000FF3F4FC558F9234EBB12AC2491C5EC1BC3ECF04F060D126D4784F150A6BC0000000097536513A6326B629370C613EE1BE7B046C8668C4B9DBEEB6DFF5B99CA741D39F44DDE5F51D946191EC11718",
-"0000FF3F863488137A2F43A0069102BC05E5176423C23EEBE5562719390000000000000005E141CA1DCD66B171F9791EAFB6F8C3CE4ED627A81CC9F66D4BB859944A0EEBBE4FDE5F51D946191DE6E15E",
-"0000FF3F6BE79D553CC0B5FE32090458A970F8DECC961AF8AD659B2A43000000000000006C9049AD3C7145D9F4B966476867685AC9BAAC05FBE9C90D9CC01387E04950C22F50DE5F51D9461921843282",
-"00000020CF10DA66311816D439C74490233E593ECB9DFBC3E49A5DAE1600000000000000156ACB0C43E7B567249239FDD30BF1D8EED4B23DDCF10F48D3CB7A2348F265515550DE5F51D946195FDC7FFB",
-"00E0FF3F2535B1CDB219FF40B5237893614EF17ECF5EE256D1D51DC73000000000000000E55EFA01670B0253C87464D93C82E1AC76B785BC68416B048A73A09A38ECE5725A50DE5F51D946195406EF84",
-"0000002080AF3B16384D790AD9086E139771D960F779F37C749ACC003C000000000000008C25A24792744FCA09146E5C7585E455255DAD2384AF09AFE8BF03FC11AA068C0552DE5F51D9461986A0EF62",
-"0000FF3FDBF84625E10D746090E4E408A7F7BFEACA17B2ADA67130E92C00000000000000A56D0E9B46424EAA9AE911412C75533F7758ADE46D89AF8D8E36783A07D649B2DF52DE5F51D9461911716184",
-"00000020427FAE3309950E7D6F2C36C6EAC23C2B11043CC7912E49B60800000000000000B7EF2863F218D2018EB4FFD9DE13FB3EDD96F1F79C1993516B20ED88968493681854DE5F51D94619BA4BBD70",
-"0000FF3FD1AB324843003755ADB4E42BF4E7735EC5A5A76A4F18159D050000000000000024CCA536847A098A2C09C3BF0654AD08A2CCAF81DD6AE2427943C3D35C9039DC5954DE5F51D94619769ADC27",
-"00000020907BAC0FEC5413C3B3A2AF2B20863170DCEECE25FC5D74362500000000000000181EA8F660324D9496C0F017D202646D8C8349E6F77C023F99D3A4BFF18243883B55DE5F51D94619B667C7FB",
-"00E00020ADCD389DFB4BF4F15DE7136F337B3474D4580169D1848C5044000000000000007CD1CCF4D1F9BF1EC6012763ACAEDC2CDF12B5B081460796134C5A4DD6ADD33F3056DE5F51D9461998115E14",
-"00E000203A82684D88E028DDFA5C909293764B578FA4262DA0916E7C3200000000000000C02146FF3FC887C4D7142B7AD626A4B8D52E7B6BC946D37CD81596EF29EEC8312D58DE5F51D946197D04AEB0",
-"00E0FF3FD647C895C668CF3F4C924D7BDA1A28D4DF67B3589CA251DE1A00000000000000B75EC026BDDC2E2BCD9529D23B65753E7B89A27480B40F6E672E623408F393C46659DE5F51D946199085DDE0",
-"00E0FF3F65B1CB5E3DB7CC9772D421D88CCC0BD2EE65BEACAB817B14410000000000000049B415BF42209877EC3006FBABDB64BAF843D27AE5C3873A6E6C9B4E221E7B8B7F59DE5F51D9461901876BC9",
-"0000FF3F3224626FEBC62709BDF1BB0F9547B221166A10350093DDC41C000000000000000A5771C735DEBFAFF09E929364F5923C53A081F541CCA77A1E1922C9C62F38C3BA59DE5F51D94619DEBC8005",
-"00006020A38C86076DAAD4D087B2078E3938C30DFF4B8E915BD991BF09000000000000001C05ECA9E08D0AE71E1E2DDF70FE3207DDCF312776B293FABBB7617691DC3F27495ADE5F51D9461958A9C81C",
-"0000FF3F8506D2F89767B6038ADDEB65E29998B0F1861218C717708B1100000000000000176308586D4EBB4FA8E38C5281B82E2BBBBAD7A14447F395F2BC311EF280F501BE5ADE5F51D9461976EA3591",
-"00E0FF3F26884995FACA5392A515ED31DA017BB1120F6D29CC40B27831000000000000002F95B016A3BF81D8B51D7E54852FEB9D135A859E2C47923B9E415D1F15C891DAC85CDE5F51D9461908FFF10F",
-"00E000206FA066D8D5F3596F1F699684ED71CA174578CC42DF8441B2000000000000000084F4AD8648563C296DA093550307E528B3EE85FEF20B79A8DFBA271C1436E702605DDE5F51D946192644B527",
-"00E0FF3F97F2B39F7D892BC4CD2F573D49520F0A5F60FF1C26AEDC292E000000000000009402A3CE7F3E5DEF377A8B348CC991B0DDCD38DA44C9FF7B93902BE417DA8650F15DDE5F51D946195189D2E0",
-"0000002090EF8D4A8F11F5AD892CBD0CA7FD12EB36311AE973AB29642E0000000000000062B8B32B17A1D08092206EF25FB7C7449B15618FD1273E656263E69FB3A8167AC95FDE5F51D9461905DA3667",
-"00E0FF3F882A2758245CAD6EA28D1F86B0352BFD46782C12E71A0334290000000000000049ADDE097B40EE8F9D5AFE571F89BCC5973754B707A69EADDD0E7832A367882FEB5FDE5F51D946196B5A6CE9",
-"0000FF3F16E89B1A38D55A3A55C5CF196AEFFA1C5DA3A394342ECE650900000000000000F99D9589351EE6504706A104A5C6E8F06678D076253DAAD8298B2512435F65F35160DE5F51D94619FCAB59B8",
-"00E0FF3F0F0A810FE78E9A1CC9650EA9B15F30C7134C0CF625D077022E0000000000000052D8B0BA161ACE264FEA3B7DE4B3A8DF4CCDB11D5129A910CE6975D0EA066888E460DE5F51D946196A208A57",
-"0000C020FDD998CDD7ADB81AE0B55DF3EE5D61C001A32EEBD3AEC4381E0000000000000096EDFDBD30CBDE2F675E1B19BF0E64ABFC4C8920E43F373C3ED093DF7F69AD737A61DE5F51D9461946523D4B",
-"00E0FF3F75BD94AF347D07B4E6BBCF5E3E233527B44CC8BF5A6A470C0F00000000000000A28FC3D836D7E09A4D051597E98BAE281713C62CEC8D03BA3F7DA7086C82FED29561DE5F51D94619FB3D9D65",
-"00E0002019BD4755D60A42C2C454747F5B360CF9934FE3F341A62B2D1200000000000000851ECAAF83CBF68B431177195EC13B7DDE0E26D7C5DCF22E1281B20425E2B4B4B161DE5F51D946199B2492F4",
-"000000204368D03A3D9ED0F9CAAE378EBDA95D7D975C866975000D7B1D0000000000000011BBB5705F399633F745AA62DB7687634C01B484C0E83504562894CDE6DC34B04462DE5F51D9461917461267",
-"00E00020353A44D5489B55BD9253D733E2ACC9021B1FA73455EEAA7443000000000000005BB3633FF18BAB445295A649EC05B6E6373F2D0E0897F99CA23228D369DC3FBD8462DE5F51D94619C099F88D",
-"00000020480485221852FF6FC6F9A590204F79D42EEF675E2C0EC69C10000000000000004F3959B9191EF333F775CEB847DDEAA81309E573CC88D8D2358DE6034227015FD362DE5F51D94619073CF61A",
-"00000020230CF944DA672B0B067E6D7EA281895FCB0FB80B7B432DC5260000000000000006A2A972D2B30157A859FF988EF6E1B81A7B7722E108A5CCDA3F1DF4A9A7A90DEA62DE5F51D94619D0A00B10",
-"00008020568011304D6DAFE9FB50EC0B48C35C8B8E3C84B1151E94A345000000000000007C420C2A27FA569D5FAE076944DF81B1BD21536C3858E0D34B808A574B2CE7ED6764DE5F51D946193994C88E",
-"0000C020D49F3562A831A9089008F8F1C82F9B4A01E2654534CAFD1C110000000000000087D456757802C28427179FBF0B1DF6CF6D28C1BBDAA272E31C1D8CE32523F16A0C65DE5F51D9461930D5CB0C",
-"00000020407EF5972545D7912FE94C29BA0665D74D87D14408062AAA3400000000000000EA5068D0149CCE393F785595ED125AAEBC84A576E2F94E5EA71F12B6BE8584729066DE5F51D94619DEC5650C",
-"00E000202666CF3B031FC8228B10DEF3CDF5CF5CBED7595D806939C93200000000000000C362E0DE8BB99BEDC4AB44582E50B26A1CAF62B81EA5B5B8A10EC187B9E5984D2E68DE5F51D94619E7517A1B",
-"00E0FF2792C79476E8A68547BC145127332DF36E17D98CC3C4BEF6710700000000000000334523AB9304A84514835DB6293E2B5C8770B3C051547603C0FAEE99ABB1EE5E3D68DE5F51D946193AB56162",
-"0000A020A08D7BA5B8036C81A561A7B8C46AD77F0597411FDC33615103000000000000000F1F8631D3ACABCF63D4792BB9DEF0DE1BCCED24E695AD94E586CC0C65E9D3F98068DE5F51D946192A064EC9",
-"0000FF3FC2E9E96E1711F87996BE181D41F273ADF4EB2E75F9F22DC53B00000000000000C69AE866C959578739E97BE58E1F4F115965F8E4FED8BC6498629DFDD110E11B1869DE5F51D94619E7BDF987",
-"0000002021E867E7DA696B58612D04A43F195FED03F66233B0AD74520800000000000000222F84E61BEBA79C740CADFB664871A843907FBF161E5626B3FFBCFF37628A61266ADE5F51D946195C523017",
-"0000FF3FEA897E77F1DE1BEF6035AB9229E7340B951621DFD0A1BA5B3300000000000000F49FE4F599B9AC898DE33DD195E5981B61F09F2AD60609E2DFB8163599B8346A166BDE5F51D94619DC31DE52",
-"0000FF3FB4DE63ACD6AD9B1CFF8752D232807A4D7F2FF356C52B3D130700000000000000749334762C025778AEA67676BE7E298E1844A113A6ACAA2EDCCF1533EA4F1B236E6CDE5F51D946192D9445A6",
-"00000020A87F992A75996BA9C3BA5CF3B28E681FD970C5C3F70298720E000000000000008EE060D8A29D17E5B7F2093D774D9AF8BA9930F91FC26AFD0D9DAF847C3373BC3A6FDE5F51D94619DC5DECAC",
-"0000FF3FA8E6A0DF1DAB917F02054659D3668CDBD2524F50A6169D6E2D00000000000000AD11573617D4072FB16535CE37EC909E9DCB06C8304F2EE857889FF26DC9F284CD6FDE5F51D94619B7295C74",
-"00004020B03B520D6C65482D2F3E485B1582AD2AC669DC6CE52449C6150000000000000062F06DEC40538931DD6E3574848ED3657AD9D53121BA86375B8673272AD67B284F70DE5F51D9461944ED126D",
-"00008020E0534489A7BDFBCA6F672FF0364613B096AEC914D55286F4360000000000000098B6BB05E7AC273A7933BD03EC60FD4A65A122BFD9F126B048BD0E6443995A25F070DE5F51D946199FAE5D80",
-"00000020DB50BAFDB22EDF0D5379510BE8A7A5CEBD50C4567B6DF0902E000000000000002F098DF7A53EDFB92DDD0032BC10D3788E4E6CC3B7E8ABE325F6F24158F0077D3071DE5F51D946193B413F8B",
-"00E0FF3F9F08D840573597AB292ED57A66213D534A77EB313787BA5E0F0000000000000094C5D45536ED2B3673BAD9AD4513DB05CD6B391365CD7A9382C6584CCB7AE7E0B371DE5F51D9461949B6CBDC",
-"0000002092279139861B811555667BD42E3C09B677368BEB822464713400000000000000C61E3180F16B665DC4E243ACDB8B17A3AB0915EAEA45591B668FEF16CB49BEFAC671DE5F51D9461900E96516",
-"000000208541811F0282A1475FDEFA8A19FCB864416E2CBF3B4455F20C00000000000000FB5699CAE1937171F9738DC42E4A8AE68522AD4379D50B81DFE03421496F8F5EEB73DE5F51D94619527E1563",
-"00E0FF37D58758280A06A5CFDFB720D523DF853968E648AE31B1D8792400000000000000A1B5B1E73037F012128E49CCA48BDB3E66C8AB38D4BF986108D369E3E41D4F4E3378DE5F51D946190A72E927",
-"00004020C3E1FA6834FDA23281BE56AA737E3D6DE44058075A1D5D201A00000000000000093A81ED34FD70106978472EA1FDF0CD35871FEAB4BFC367F36771AB2E585AF64F78DE5F51D94619990A8798",
-"00000020559CAECADFE21CE8F047E37C04AB7CB8BA449DE2B3DB6E551500000000000000B1CA9B22334C244DC12E589DFE750A62138E750D82A2D3985AB4DCA13AA1C4D3017DDE5FFFFF001D278E3940",
-"00000020E04718A47764ECA4105FAB1A79B462D6EA010E068E2B4405A18BCF31000000008023FB9665018152909FCB8562358374B1D286CAA74D803EEB34C8B9D3034BE8CE7DDE5F51D94619EB13AE04",
-"00E000202057D07D618421171D4F5247B3EDC49D12444C16F699E71F0C000000000000006B1E7CE89DB1694606B100422591A12630EEADC6C104B517091B19C7D6A5D670757EDE5F51D94619E796818C",
-"0000C020FA6C190DE80D55C85C73300994B1DD1123F78E043E6FFD6C3B000000000000001AF1989249C5EE585803D61D9FE1D0C6DF2C0E35D8752E9AFBA661314BA05B617A7EDE5F51D94619A390565C",
-"0000FF3F3BB658AEF758121017C089F652FA540673D4BF504DADB6C30E0000000000000014E191B8CB5057F35664B1CD234E8AA55D8F24B9D8C857E4336F309AED2F5D000D7FDE5F51D94619E2370799",
-"0000FF3FDA369BFEA1CD3FB5DF829AF688022EB45B5F2EC98E8AD1943800000000000000A69619372C2D68922ECD51C1955EB9904654C61A4EE8061AAAF84B85919E0683427FDE5F51D94619E1C888A2",
-"00E0002061885FDA5712581ECC5FA425D40C41A2DEA67C790F722F460C000000000000003A5CB203ED0BD201F55288A510F60E60750E830B5E00D0AD19E471F26AFCC93F3582DE5F51D9461925E2ADC6",
-"00E00020A59ECA67D6BAC9FCE274690D19A7D79F13B92AF474DA97803D00000000000000C9C9A69B497C61A2D21B800540EA722268DF8F1329A1BF1D5C1D25A01756B1455782DE5F51D946194F3584C8",
-"0000002019088870F1F6020E64284098F35ED7A01BB8732EE073560C1D00000000000000F901EBA823DB95CA9C216DC0476036DB73B84A420B537398C5A8229943A2A8882385DE5F51D9461932AC8EA0",
-"00000020D82773E83CC2C439BED65AD1D24760777CB685CA43B7D7FD010000000000000001E7448C495F8D482C0F220765AD641DC28FD8707C5D47F8FB51F6A5CC309F3FE886DE5F51D946192C99802E",
-"00E0002043AC7CA70FC1CCBACD489BC6A7898CBBEBE5A0E54A2395FB11000000000000009D9E9233FC121A27C37C529F903D51554195533DA407E898F80F651EDE215FF95987DE5F51D9461990E95255",
-"00E0FF3F023A5E8E9EDAB0092601738CEC45C93A2B6901C8FE06DC5D2E00000000000000F12BE1CA4E42B1137433CC3C59E753C5276BBC4A4183F0C2B353B8382C31D8B2DB87DE5F51D94619219D1C6B",
-"00000020948CA8CD7710FF978B0055A60EAE038B16DBD6A471A1A74C19000000000000009685AC8CBA0365B8C4E25FEF25791D820F7A2AC4EEBBA3B218777911B8C22E410089DE5F51D9461903A9674F",
-"00000020956A26DB1D268687885FFE98C41F42FCEAD2A241C05F180723000000000000000F561FA130C6B13B43533C56A664A4B42CB5753578AA4FF3A43FE49651200E85348BDE5F51D94619D30BF72E",
-"00E0FF3F484E141EF915B354C75FB9175070B76829DD155336DA3B4F2000000000000000AAC00FCAC1D4D92F2694FAB4F671A357A1D0E1D5829E86A9F9533BFFBACD201B608BDE5F51D9461947DFE3FD",
-"00E00020D9FCF5F1C04683A94FA236C2D591AE41C4AC0EF7B71C6D293C000000000000003A0CF7DEAF2A1306471A7F481E5B0C153C8076AD3B03F04E41D3FFD4F4D68261218CDE5F51D9461968B840C7",
-"00E000203CA766EC2A4F45800CE891A2702B303C43996E037F3CD2851200000000000000DF824DE45BB2216D39AE05E1B7F32A33E0DAEEFEFF34DD07220A713089D35032C78CDE5F51D94619FC291EAA",
-"0000402076C494F24FB6B00140D76EBCA9CE04F9C90EBCB8DF0FCB6D0300000000000000DF6432765FBE37FE06B33DBC8DFD32B3C48540AD5CB8DC4365100BEDCD2E587C7D8FDE5F51D946192EE832E1",
-"00E0002034AA7BA6358FDA12794C135D9E40084DFE2A967B0621FD704200000000000000B426E44312D6ADBFF8FA66F49E4A229F4C7CFA8BAB76A42B25C20DF2D0382F30E090DE5F51D94619D0F2D771",
-"0000FF3F844D4BCA9935BC8C547A3DBAC96C970963AD96C3A29EE1A63500000000000000A624E5582BB1A765C83ED5374E383020C2EFC37502054F29DE014AC08C403DA6C091DE5F51D9461968C75555",
-"00E00020692E4218BD9F6846CD78692A90AC71D7D0248634A53A5EEF29000000000000009D256BEF678698C67580EBFE00E3C04A1C7309A10516CAF42352DB654F02D8298092DE5F51D94619F4AC257C",
-"00E00020A7D591977053042AD2B5F224058DDCD97D3582CC10DC998A1E00000000000000D87EEB068EC9DFCAA556AE605792F240AF6BD09FAAB1AA97D4305137025198552C93DE5F51D94619E6221A2A",
-"00E00020227341F39D5F9383A0D4FE6B532C1C6F699C01ED7152521A00000000000000006990320EDC283357FDCF5BB696736512EB7FCE76A16D661699D0367FA83766FBB093DE5F51D94619B9AD3C7F",
-"0000FF3F70C9DDF7D449D00033F7A40593C4BD1F0E03BAEB5636D5CA2300000000000000544A4823784F19FF934AB042B175A2865585C99D29D57BB0DAE23E49638DDFD8F693DE5F51D94619FAE85980",
-"00E00020DDE7031A0FF8981E5A53FE8332DEED27E532A2466E960B1B2700000000000000BA01A5CFA871CEA6EDF0816BD04F4E4E85A2417EB28F254B615577FACB31E3DEAF96DE5F51D94619C61472FB",
-"00E00020A0B91FD2018FCAAD986264D146C8DC6FE7FD5CAF43E1AE592E00000000000000438BD640396607D3FBAE23EB936163647938D07165818B6C10FBCCD4689D4118BD98DE5F51D9461942D269C9",
-"0000002015582B4E879765FC89EF55D51C168C8652DC9F4A84A145AE2D00000000000000004AE3B076C2BA7F6FE1B9FF2B184C818D12235E4A07755BF6FFF9B73B16DCDCF799DE5F51D946192182AA10",
-"00E00020A62A3996D3E1D8D61DE4DAEB43F7421081AD105F891ACA901000000000000000F4D9626CF6EED466856EACD78796F947F818E3D19F5343B9463858441D927729459ADE5F51D94619BAD3786C",
-"00E0002094008C18A2AB5698255C6FD0CE1B28D59E2EAE1FC5AB4914040000000000000087C3192080F3CDCE9BED4DA9771119F9A89C7ABB713D3C2B72EBF93EAA33386D8E9ADE5F51D9461901999AC7",
-"00000020D0BB888D1B3AA0BCE565944157C07A17BBF3A75FEE1B9DB93900000000000000B7A558E1F6964E898B9876F832DCAE78F0716263E64674DF032D6AC61287D366C99BDE5F51D946199ADB9AD1",
-"0000FF3FF8042D7894814D6853C844E4B79D7C772C72E3F22BE342D74200000000000000FB0F7D34750110C852F3FAE9E1BD53F7A8CEF72C6F7066FF80704ACDEA6B6A2A109DDE5F51D94619B1FAAB10",
-"00E0FF3F8039655B1E3A5A9E2575B2C1EF1B9391EC77184E088524250600000000000000D8F4E6BE803198220A08D9BEB11431998D86B16B58DD7CA04653361B7F68123FCA9DDE5F51D9461963454C92",
-"00E0FF3F21A4D6B163E538EF822D3C923AA762B1FD9F7F87ECAB2F8B22000000000000002E99AA8E07B03CB034F0C99689CC388A828050292D4B34309757A1036726BC02EF9DDE5F51D94619B766758B",
-"00E0FF3F35327C9366ECD1A52EBF8974F7274D85DB635A58034B9A271300000000000000C6974D63AAF42890F38A66605F1543DCEAF0AE167D77ACAC41B2B52C5220E4168C9FDE5F51D94619262DB1AC",
-"00E0FF3FF8C3D2864E7CA0B3BAF4CC47671B7E3A7B0ACF583F5358643E00000000000000F5D8B4F7C04F044280D41B2DF0C85802B797BC186D3F1724FD405851CF5E341AD79FDE5F51D94619DE746D0B",
-"00008020AEFD2CBC7B1D66F31A637CE008D09DF5F9DF9965EDADED4B38000000000000006844113E5E3BDC57FD38E651BCBAFCDB8A289A1E3E89F548D525AD955A8B015A04A0DE5F51D946190F981D9C",
-"00E00020FC79B2357F0AB38131AACC6115405BB926FCF2C86BD806D726000000000000000B14063A86AEF4DCD661578CE6FF472176C5281C56245431910B3141873D954A6CA0DE5F51D9461910302288",
-"00000020F97EE9E645915309E40AFEC4766760633D804AC9943CBFE6200000000000000087D04D3AD69CE72C20E330FEA08C0FFFEDE98E65EB3ACD0A754D5CBB65E7659BA2A0DE5F51D946194EAE8605",
-"00E0FF3F17DF401EBB6984A4933EAEB46BAED80B02587512D1390B5F1700000000000000558AC3A0A17D6BBD533E86AF36D09FAD225D07A39567180F56B8C73052CA96E4F6A0DE5F51D946198D517D5B",
-"00E0FF3FDD033764DB86CDFFA278B96482BD29732F249BA679D966B214000000000000005860CD24AD410737F7F0793EFF64F208103E1219B17F4465D09306806383AE63B4A1DE5F51D94619A37159F4",
-"0000002080A5C0713B0663F177D23FF0B2E0F6726456C0139708F23F38000000000000000D3BE8E4651BA23AB1D559EDC099809F55227BC055ACC21324C366498500FB06B7A2DE5F51D94619E37BCC44",
-"0000FF3F36860ED052AF0944309C4F211A44F2692F315FAB1BCBFC412300000000000000B9804CBC8C0551F71F2A3F171335F25E77BCD5EF57C24890E67DCF1C317895C034A6DE5F51D94619E5352EAE",
-"00E000208135D192364526844A327881CF7EBCE1CCF457FECE8BF2C32C000000000000002F1428A77B7F16C4C84E92D250D0DE99F09130E2089AEEF8566D9F725C1D137B51A6DE5F51D9461998EFD863",
-"0000FF3FD12B49420E1EA38C02C1AB15BD696E6CFE211E8B2B338B830D00000000000000711A2821AC59AADDD1F21343D04D15D78E9B47D132FD41BBFB9908D9A20D6E3070A6DE5F51D946190F042533",
-"000000207DA46C5AD75CCE077CDCA92D110D1DF649DC69BA733B0AFB1B0000000000000017AA5DBA88F5BAE24836D9674092065DFA5EEEE29D6E68FCB8F15BEDE1AD113C20A7DE5F51D94619D7B51674",
-"000000202CA732696D5463F584C5A22AB140EB6F670444CE1BF5F1CF0A0000000000000040666D03FF4007E105CB701BF3A0294A10053382594BFC2EAF4D8E40322E16143DA7DE5F51D94619AEABDA53",
-"0000002022612F37341B33668015D79497278CA4DC4527B55C3595E23400000000000000D64B45E0E2277068CF264C7B7DB0205C373F479CE9CEAD090FD6D09839171F8C42A8DE5F51D9461919364AAE",
-"00000020CF5CF010AD6DAB47076096164FB89C32D3D1EBE578ECB58D3B00000000000000CC0D3F6749C9769C28DA514859B0B5DE76CD4DC4D745981EC122158FCEFFF3B559A8DE5F51D94619B244BE90",
-"00E0002025393C7E7FC2BC9CE015816AEBF00C5D0AFE477BBD16DEA70300000000000000E31950D98C08F08092CAFFCE18C7FC7C43D2C3A3BB3695F20433016880CBE02757A9DE5F51D94619BA7CEB7B",
-"00E0FF3F4A4B73313EEB03CB85E1A1FCAC61142DF99B8B2AECCAFB203000000000000000B8F5B72803C4CF4967ACA310B19B555E38C9941A55688FAAB99E55CEB1DB1B0DA0ABDE5F51D94619D1295724",
-"00000020E6FC1D721DF85F087267B882FAB82343263DED087C4C829629000000000000002E6E26262AB233C4FDEA19B152073025752E6430530BD24765EC60BC20BEA63357ACDE5F51D94619F040629D",
-"00000020087A5022AD595A8D52C0C9208A673E64F523203C13140D742500000000000000858900CC70B4B236F25DA19BA3106B77392FFE1F3AA632557223E67258A6857997ACDE5F51D94619186332F7",
-"00E000200B169EC20A375FB6290C2AB364AAF5A5E561150CCE35146A140000000000000018A519682B38D2C52F96FE55AC8E823F55D9A65567040487D49442A05C712D66F6ADDE5F51D946194BE7F14D",
-"00000020FFADEFB8A227B478D4E02713C472B73C62186DB45307097C0F000000000000003C4167270B9947C49AF789B9719AC0D3B614A1C330A7ECBCCFE54D239AEDEC5832AEDE5F51D946196B49A9C0",
-"000000207594E61EF119EE5048D268493F15A32D31D1F192E117A8A70600000000000000A48CC07CAF69880CFBD848C7337B8C70912FF7119083FB803A30FD921809E63133AFDE5F51D94619186F313B",
-"00000020B0B685971335075CE7E913227DF803306F14A8B348AD9C7844000000000000003041D6366A7388A2FB08E5870B5B09FE3EAA05C93DE638A6E6E54DBE5B096B3730B0DE5F51D94619DE7509F8",
-"0000C020D1C3F7BB528C22D961A24040D66197D2E81031B4C196B5762A00000000000000E339BECAD7EE618EBE02DC5F15669E92A4B018B6FA5397B738E15151B70C2F14A4B0DE5F51D9461908ECF88C",
-"00E0FF3FBF14CE9CE6B92255C4A162FDDF7EA3A3082EF2000DE576341800000000000000EEF0CAF6C8269164BE8AADCF7B3157213B49ECF98A7E8C1C23004F3DEDB09C5564B1DE5F51D94619220513C6",
-"00E0FF3FA8F26804BE24BB72139884FED19D93AF23FFE8F895C7E8F921000000000000006BF627C196750229F7B7C3CB963CE26452DFC794463BCA82B161F20BA29E8AB4C2B1DE5F51D946191326504B",
-"00000020EFC4C310976462FCC84433A63B96F5292941A107639A3F940E00000000000000E48FEDD788E345C44CC3B85FAE8EDD57060FF3E0CF271953A9ED571D02C77F3204B4DE5F51D94619D8F692E0",
-"000000200790DD646E2C9F4C147C3B22EBF05071B72E2FE15DB1046C20000000000000001AE1A602A5EF4979193E021195DAD118F651A3435DD0C69CBC3B0FDE21CD1934AAB4DE5F51D9461938B37B23",
-"00E0FF3FC26BB498F8108F7B6A590B8F3B9EE2BC1C713613C281A6373F00000000000000FDBF43E8D910CA9227053F4CB66E0CE845475BB56361A52408761CBBA983CE7A58B5DE5F51D946199900ADB8",
-"0000FF3F572CC160095C88D088D4F0B14E7361152DD80CC98A98AEDF2A000000000000002944A1C9E11EB6D0A50639FE4DBC48137ED4987DBCB1601E2DAD45279E8F43E27BB5DE5F51D946198432C4EF",
-"00E00020C2D731AE47F3948BD729EAA2768438924B5DD5E6D9E3ECD91400000000000000FB34A55FDD36141B0DB62ED4D74576E564F45DF7CB4023482931FE5AE0F03CF08AB5DE5F51D946195E69EC3C",
-"00000020BDBD965635CA9498726F2DF9B8C7A15449B64DABE904BE3A4100000000000000B3C92860424C236DE7E710447F8E6F9F7ED769178288EDA59EC6F0DDF10A30FBC1B5DE5F51D94619C5C46E31",
-"0000FF3FED3FC1B86EE45450A6C2806C6DB1442DD2DBA67AFCE4ED8E24000000000000001F281865AAACFECFFFE518047CD78B7FDB3FA5CDCA567D7DF5C43108D94267C371B6DE5F51D94619E278053E",
-"000000206EDEDEE3A46EA1AEE3851E77607EBFC51538E7F4D1BD50010900000000000000084B4EECAF5B9B55EFA2D5BEBDCBA7BDBB4C154232505FDAA1F2CB35855981F8F6B6DE5F51D94619AC115F17",
-"0000002022DEAC93338C957DED7D90BFBC32D9F2750CF27E4E817FCB3B00000000000000DA6140B446BF811792EDDFE21D71ED3FDEA6664D2C29319BA115DAF6F7F634EE64B7DE5F51D94619421CA476",
-"00E0FF273DBEF4DFBFA542C6C3644B270440D867BE1399DF486B0BBF2100000000000000588D0B3831B1D0832C24A2EE321684EF230B333BB65DCB13BD2D72F7AF375EED4FB8DE5F51D946196689747B",
-"00000020DB95BB341C28EF1BF43DC8D2F6F21F27CE0CFF4DAAFCE93B0E00000000000000814F3796DBF3012901F791AA676241994E4317B731FD975422FF7A788393806500BDDE5FFFFF001D3D18C9CA",
-"00000020E6EF4BB9D6AFF620A3A8AC5F985DBC72D728F3D5FBEB6CD1924391F400000000D350E9E23A90E71C23553A27504BF02A5B3657C9BB6A8242C690EC0DF204E8D302BDDE5F51D946192928ECD8",
-"0000002022AEC5AB3788227266AEBEFB9AC850352CD5BB35B8EF0B3E1000000000000000DB293B118F030CD0066F8877DA902C08BC0876B47D64B7534920649713AB876B74BDDE5F51D94619BD9FCC58",
-"000000208C69659CA72DF306715BCA7E148CADDA6903E657618062313500000000000000619553ECB6FB130A6182E48BA60AD0E8BBCC4B24D6B044F391F95CA80FDECD21E9BFDE5F51D94619F8CF8A89",
-"0000FF3F96939EDCD587B99C984F34D31AFB16CA41A8371350F92BCC000000000000000089A5A49CB5092D64D77D29759007FBA09499454C1DEFFC7B4C0CC5E0B2B892E224C0DE5F51D946190BBD5CFA",
-"00000020995174DD91F48E35B95D17C7F9797C5D3F6D584B6C1C84D80300000000000000EF4E603646EAE6C5CB9BA091B147445FC1ACB77370F9D3D6C4187F586E57D39FBFC1DE5F51D94619E68FDBE3",
-"00E0002011790A80F39CD6EC9E635D9BB94F8A88D20DCA32233E87ED34000000000000000FF2E9167144F61BB93A15DBF843AC39B065737D9DE33185F7C694A50FD67B7D56C4DE5F51D9461941CD2B2F",
-"00000020DDA0B0A2579F76062454645BF2B8CB0DD8E92DE60B0334E53C0000000000000057A8A212664066E93A45F9A99295804D4BCBFB776803827A61EAE401EF38C18BD8C4DE5F51D94619C666E756",
-"0000FF3F85BD46789FC60DAAF1135F6A67CD72F69E3AC8D4E16B3BBC0300000000000000BC9EF7156A2DC528F635AE050FD7E1E79689FDA2FD3DBF75C32281A0E14011750EC8DE5F51D94619AB4C89A9",
-"00000020FE544CC0E46B719A41F7F1826A67E874A259B29771E631A829000000000000006AC98465F076716C99E1F0B314DBF93A75BB7FD82257B116E6BC0E5FE237ABEBA0CBDE5F51D94619CEB2DB68",
-"00E0FF3FBB8E02828C2F4A2B05C44D71CCE561EE90994132821F61CA1F00000000000000728DF1A70163A1949B71106AC582E9DEB77D65D641C1648AC1DD16F64AC12A458ECCDE5F51D94619109B94E8",
-"0000FF3FF2A98BA4302811FA8D84643E2CB91BCA07C78C25EDB2F3303C0000000000000071F798ABB59C5A11C731FA22B0C91B30E80AF59A354D78F99456B793EF25514484CDDE5F51D946196BC75BBB",
-"00E00020D4372D217124EB1314EE3DBF71E0FCFA6F4D02B0E07FA34D2C0000000000000083C62DD42785F5A39E3517C2E23EC6322FC85F8DDE6215EF01840FD43ABC87D9F9CEDE5F51D9461995AD42E3",
-"00E00020DE658A184363EB959DDFDE9450FC315AB2F517A26CAAF4804300000000000000243A4FF168F4637784A180A5D025736988E9A992F8119BA4FBDCBBD517BF091DBDCFDE5F51D946195A4BCF16",
-"000000209FF1949CF23A47E57048E005EE0F22A93AE620AAC0C6284E2500000000000000B121072E17840D204C41A82BF276CEECCE3FA480A6A0DDAA9DF87AEC31BDF5FE32D0DE5F51D94619BAE5CD9C",
-"00000020455CA17A4519189DB927A3A981ACB9298EDDE02269505A103E00000000000000C1182BDB682074AC09DA80102995C94A8B93B2BCF7F9455555A6DC48F9E123A5E5D4DE5FFFFF001DF8100D38",
-"00E00020AE2887F9B43E8F1D48A1BCE9BE7FBDCDFD321F56768CE1F30A01C52C00000000B6C6F3DB34443F641A28D83B86529E7B0103EC1ADC7CD51141F149C1F5FC50AB73D5DE5F51D94619D896E625",
-"0000FF3F658D197452F150F2C1E26532DB9952DC85D57945FE82CDDA2B000000000000007BFBBB5C4A5F171C90383A561ADA79C2F52BB044A3257FD74645E80E72AC1570BDD5DE5F51D946192AB98A29",
-"00E00020F3B235C7C02B767121DD1936CBBC313F6A0562A600FF28C6330000000000000094390269614436D220604658AAA12787A14BC153DA9E702674FA7150C83D6963E5D5DE5F51D9461949808466",
-"0000FF3F6D2E24CEBAE3F6DAA10B7C07EA20DB8389DBB6F1F6AE8B990D000000000000006DCA5B79F214C61AA3E41A00A1C51C3EF8AD9F4CFB2F55AEC475794F185D4987E5D5DE5F51D9461950E19FCA",
-"0000002057F95B86E7D3277FA414E5B9BC0FF2F12E19FBFB4EF5B56D3D00000000000000EC3C3A793B250E10A2044D147F61C87BF03ECB4E81872D90F590F9500E52ED5683D6DE5F51D9461955CDAFBA",
-"0000FF3F87BA63A38EB1E595926E1CD8C96983C9F8751C10CB191ECC0200000000000000FC90C06458B7AA18A4D40C70D57E8F1ABAFF4AD8C5B142EB557A9BC860CEEAE530D7DE5F51D94619FF3E213B",
-"0000FF3F6D27642BA4B7021C3759F118D7EBDE9BC384388B43C5B104290000000000000082C1934A7C9D9D03AE598B5403223706ACC5FDEE53291D268143BACD795AD1FD47D7DE5F51D94619E5AA5900",
-"0000FF3F806E9B2BDC2663E91AF9D8EA751B2A7DCF0FD6C966DA69041400000000000000E982DFBF523EF9F24B03DE482379CF9EB5642A1B383BAA75A16F7C8CA969DB1160D8DE5F51D9461922EAC0BC",
-"00E000207D5F13875F3D87D2BDEC583FA1FACC84AA1F610CD8C718CE2300000000000000E87AD6349111963F4644C5646040EEA0C93715F1FE3B5D88D6821B64CBE8A39F9CD9DE5F51D94619AA98337D",
-"0000FF3FEDCBFC9DEBF707298AA1A4C73A98DF837EA1A3F3480FC99A46000000000000004053A0F773920BBC3F1E253D8998A7D3E4E7C1D6B441C3DF3389D1A530DEDB3346DDDE5F51D94619999EB051",
-"0000002081C94D8D0D8D464890472429CB030A9D502C5EE97258BDFF170000000000000023F1C5CBF7543F95F8193AF439B0C24BB9BCD81780198D4F4EE98EEEB4583101A9DDDE5F51D946193183F4CD",
-"0000002054E2E92C3A8D5555134573B12A582BF41EF82448A921C3B410000000000000005E60FA6B7C3E683968DEA8A3336BB6E576AFA482F5270F0EDDE1B8DEADFD5A6E1EDEDE5F51D9461996105224",
-"00000020BB82422FE6A0124560D9DA75C9E52F776AFBED3A6B1BC5160F0000000000000084D12D65CD9482E865FBBEA0142E5C0AD9BB03A800F4715D9B2C8953FC90CE2981DFDE5F51D9461976CBE8B0",
-"000000209823572591141935DA87B055A2A49D450BAC00D5CA2618280400000000000000F048785FF89E8466D11AB2136DD17D2ADF750A21DA3A75B60AACCF0A01C698FD4FE1DE5F51D94619C710D8CC",
-"0000FF3FEAB33C7F198D9FE2DC360A79ADCCC2E8DB963CA3A9B432033F00000000000000768EF19C86C7B3A917DD33B68DD9E7175D9F57C73CBC63E826AADCA9547D7A609DE1DE5F51D9461973602A68",
-"00E0FF37BF250989AEBAB92D0BABAFA6B533919DB6DD2BB09914817C0A0000000000000088DC8DC76193E64C7743F707E50E7BCBD270FD5586EEB32C32ED873F5A6FC47D2CE4DE5F51D94619B4EE0F4D",
-"00E0FF3FF6D194FD473D40B32888CCB6AE2B84D18974AD6B875F79A53100000000000000716DC0B172A239B43EED72E7579CEE257D9A2F0E1DBF3927EAD69AA863351A7546E4DE5F51D94619CE56CEDB",
-"000000205BDA5929EC4AC2CC034646C7700DBFF91B8165B5D3B9ACEA3B00000000000000FC2E4E6A7EA4FE255030621AB118FA99352610FD8329F281EF3F393A541CDBEADDE4DE5F51D9461962832E92",
-"000000205AE436F02A5CBF6A5976B1E70D06EDFAEA555C0CB8F450CE16000000000000004BCB2EC8213D0F80696463EADC9EDC14B152439A5371854D0DBAD92000631EF78EE5DE5F51D94619838047CC",
-"0000002068A3C2989DE9D1F34A9608610E45A935796C27F4776B3A351A0000000000000025299BD3CB6FB10D7AFA0DF001751260A88A61ED81B2AB819BA721099625C023F8E5DE5F51D946190918E0A4",
-"00E0002021F7C83E6223F9D32E5D5427CB1AAADDE27F6C0DE2DF33640A000000000000008169293A4D4F562B9E93745BC2CC0F41B8944C02E9EE02E6B4996EEE7EAE4BDB3BE7DE5F51D946197EEAA84B",
-"0000002011CA36E03D545FD46F26676E3304890D255BD648B0B6783731000000000000001C394059F2A48BA3F28EE27D8246212B229ED2909D18D5BA82EE597F8D747A3648E7DE5F51D94619F00603DF",
-"00E00020FD3EAD641573F85C3E025D26225424A81988DC2C8CB46B2B2800000000000000F793303342EF3FF4172EBA5F03D9CFBA17C8D545AB4AF643E99B7F2D7BF1FD1328E8DE5F51D9461939B6FE5A",
-"00000020A3A0232BCEEA814B3134DC1C7377AD59237FE8E1EC4F89712800000000000000B6C420AD7D90422A190A5C5ACCC3813E8CD7792B40F6641173B06EFD776A5829DFE8DE5F51D94619E99E62ED",
-"00E0FF3F24F303A8E1EC4C581D31CCA79170DCB607AE7D8676B0F7EF3800000000000000659441A7FA2CE00096B206F161510482A26249EC0FC6E902EFD0BC3C747A741619EADE5F51D94619865D729E",
-"00004020A022532F28735A67E7224D6E4A58402D28FB28A7E54E953D2D00000000000000447EA437A434CA827DA209312A9038243B52FED21871C047288DAB5C5AE753E323EADE5F51D946198F5026E4",
-"00E000209719E59BA1577051784B3E73C5B4E63E500749BB2254F7AB08000000000000001E66EA79F0E3133A8E67D2F785832AFBB6C4FF6E56252BCC8A01A813EA81977A9DECDE5F51D94619BBBF0127",
-"00E0002012AE854A03830BB32B9FDABB8122C1D09FF5DAEC2043954B3E0000000000000050FFE819D533E1A18AEED5901DA6BAA69BA77A3D501FB672FC417A5082D948A044EDDE5F51D94619A4071274",
-"00E0FF3F7978898AB7856374C0984A6FFF9771766645C36C15198B941300000000000000F0086EAA5273AE77FA23169FF8F08A45F2F39E423358210A83BE94DCE6954C72C0EDDE5F51D94619039F03D3",
-"00000020B113E4DDFC2943551833284F1F368BDEC31C66F87D14A6BB4500000000000000C2829709609CBEE8A40D47AFA12417CB5805EE83EDF7C8332E498EA83D48EC9831EEDE5F51D94619129EEF9A",
-"0000002066C828782979EA3B5A3921395B2C3957A9B334C6032A505C23000000000000002457208EC5BA09F5B47F626DC0AF9B8B0FC5E18D13350A6F9646B238893E585E23EFDE5F51D9461929CC1375",
-"0000FF3F3905D08696FBEBC3386595B3B01AFAE40967B320FE84FCED1500000000000000071DA79BEB05DA570DB4EB19A6C86800C96622EEB0D9082F8000B408407C70148FEFDE5F51D9461935528FFF",
-"00E0002025011288D185EDBE8A8EC458EA4DB9E736C0BABD6D15F9C43800000000000000093CD4B32E96D550F77142DE224FAC13AE047367FB1E955D17BBFE9EC8A619D4C8EFDE5F51D946199A1B23E7",
-"00000020EDAEEF78FD159BFD7296300009A662FC411C8D024198368303000000000000003F438375A0E7E4590E60BB09495B4602425B4FCB6D88F4110214CD22FBBCEEFA34F2DE5F51D94619B36E84C4",
-"00E00020C650E9EF92D835D0D3C883EBEC2B76F6B20CF1AC937BB55E2F000000000000001F3ED512006E955345FB5809D350040A939AE564B820938879AC14848F942321B9F2DE5F51D94619F95C387B",
-"00E000202779B4257EE31790656EBC83C5706ABF9CA4911D4254D7001700000000000000C419BBAA5C2A6114A42D21F1580548AD40EB388CD7B1E91388819A8C18DCAFD3E6F2DE5F51D94619CE611A31",
-"00E00020BC399CDF4766172ED4FAEBD87513A0D6453867CA5C8747D71F0000000000000096DB15D38DC15C768004D5F8C6B4748861F0BE552E9D84283075EDBABD47EA55D9F3DE5F51D94619D8C74A4D",
-"00E0FF3F22C794A5633E405AFA77C85AD7DABB54251088DD8429A8890300000000000000F70892E778B84DD9A67A501EA6A1FE69BA7F6EF95DE3C18A1DEB441794704845DAF4DE5F51D94619C933F90E",
-"00E00020B6687F0E2CE77A55981B93940B121270EA83E3181BC8DE0C320000000000000058A471922643CA8190400D50CA5E9EE56158E88FDB45EEAB0A36066941D0536EF1F4DE5F51D946197473FE69",
-"00E0FF3FE7485D57ED82394D08AA61D9BE105A258E66BCAF53C39CA926000000000000002C0B6268AF798DC3BB71B890C0D2219221C97343DFD5076192D7E4E5A711E4C443F5DE5F51D9461959F66324",
-"00E0FF3F5082E8A9B61CDFB00336532789D24BC513EBF583CB345A4734000000000000000E3CB617A0FE8AC30C518EB67A752549C06E7C7E0510CA4431C813957F609288E1F5DE5F51D9461993FA950B",
-"0000002056D5D654F54D560ED49AA041DDAFB3D177E448838E7CBF6C0C000000000000009E44D1A2A89DC0CFD40EC3CBC3AF6BE596938E17826DB06382535BDE5F09AC4A2AF6DE5F51D9461944D40E5C",
-"00E0FF2F19D40B77F8E93010E3B8FB33E235922FC36B325F06BD2EFF2100000000000000D70D4E8784869EBC83A6A80BA49888EB25435B8A0F218026705D8BF1CAF5CD1735F9DE5F51D9461970BF211D",
-"00008020BE585221562AD34033043E4BCFC09B26BA09C66BEAF4AEEB2E000000000000007E04FDEC8C93A8280B0F73F0CF7DABF9A8598A6BEDD78C44B9EC997D4F63FD804BF9DE5F51D94619BE6A170A",
-"00E0FF3F25ADE358BAE8998C86802AB6EC2CAC8CF40F328DA78843592A00000000000000943F53308170868B4D6C83325F445CCE4F0949AFADE64A205A66DD35CA49A5FE6DF9DE5F51D94619CD0AA27C",
-"00000020F6C4DE4CDF787668B70701E394E55C450B3DB2FE649AAFCB2B000000000000008FF2F2AA14E737F788E7D4FB27FCB2CB40042674E425097505551E5AED3D5094C6F9DE5F51D946192A11144E",
-"00E0FF3F62B544EE8ED32EBF64A0DE385CEE19466B4BE68B413AECBB08000000000000006069C655AFB7C7ADD7786D4D343BB7172F8C990E5F29DFC5065F398553B90D2266FBDE5F51D94619E36B0248",
-"00008020D1783063C3067155F8C4CC50E79D7B879B6BFAD1296779B83E000000000000000B84CA90690620EEB548434036D174B7063B8F62F30F4DE4CBDEF2FD9F225933ADFDDE5F51D9461931285CC2",
-"00E00020B777BDD0217CDD768D514A25E4D5FB953016453C76D0357E14000000000000006A5DC06E767D8CB26041B9F9AB0AF82630FF595CCEBE6DC2F1E24DB61F55555E7C00DF5F51D946197450580E",
-"00E00020188AAF373867BE2969EAE868F8487604C699ABB2E70F78D241000000000000004CEAF385CD74FFB123022247871C4D241065D1257279606B5C5DB56406010AAA2201DF5F51D946191DA1FC63",
-"00E0002013A9F272E8C1E79A225EFF2364F1E629FC466861E5EA49772D00000000000000946CFF00643181419CE910D85EB8B0A74E7AF2AF59008B0EA371B40E7D77920E8903DF5F51D9461905920BC8",
-"00E0FF27FAF4C327730154DABCDE87BFD4CE43E922D9A6FEA8DEBA4B3F00000000000000CC9D53695D19B58BE7E18D39489145EB94E150A9372FB6F52F0AEA3D89933CFDEA03DF5F51D94619BCEA6EFE",
-"00E00020FA02A727E51724EA2AD17D55B72E6C264F9A5BEB5B3652691300000000000000A718E4797739C636C34A30827D1339587B2459E8DBC92AC47FE029B7B5FA5E6FF004DF5F51D94619C91A6E41",
-"0000FF3F9F31A1981BF17E8A98BA49C1102CB7C03C475CBCA3CE8E2C290000000000000088F88CC8BAF7DCE839164EFB8BD7DE8074F515FE8B1A0113AE393C82A59B7B4E8B06DF5F51D9461900AF2988",
-"00E00020D417C0A191AF306CB6C1E19E61720360942A3C1CDCA440350F00000000000000110B6BB310BCC76C781BCE9D97F8FEE14FB6FB6254A4F8CB5E18A569A8847182A706DF5F51D946192EAA4DE1",
-"00000020BA09006E2D5122B38129162E38A94A28B578A70929E528CB2100000000000000BE867B6799207C3A3CE37CEC0032C87A316466ED3EBCD64F1CC1BA212CFBDD773207DF5F51D94619B89B8FE2",
-"000000203736D4D03A98FD703BCE408B516EE1A6130340D42527F7C93B0000000000000009C10C16C9D5EB1C5685152AFDA3CA0DF088E6BAF9D1EA95D6DDF124C8641104E207DF5F51D9461985EA25A7",
-"000000206A55A0C8D4CEA5B74CD73441D62F5F67943EEBE9719756D33300000000000000A642456FF135147DB5AB461FE6B9C8AB08A0396FAA3BE9B3CA85A58DDB61C8327708DF5F51D946190D181B3A",
-"00E00020063E5A7B3CBA46253C21BA8C54078BF800A93107490DB2432C00000000000000AA003AE4078A176F46A106BCC5603ECB4632268416476033C2A2A95353B2B5D49608DF5F51D9461939D50AEF",
-"00E00020DC0CA823C3CAC69E81D5AC1A4F3EABE8A90B453D4DF52D9028000000000000001012105CE9C109C59BDDABAE440DE3AAC1A9402660AF31322B2D7B317C67560B9A08DF5F51D946190B42FFA6",
-"00E00020A0C64610C0A286708DF7E9705714ACFDBE5AD9124657EC984200000000000000D689B4D90068729DFD465C235DBD120EE46599A3664AE36AC2F2877D7388E23F610ADF5F51D94619406AFFD8",
-"00E00020B339AB26A9FD47C7626EF0C22B2A74F40F93653C3156FA950D0000000000000018BE900E0CB51F6B262BB8145357F5E6270687A15453BC2866FB32B1F9546B080D0CDF5F51D94619C4494A05",
-"0000FF3F6D3455D1465293ED58D40F11A1D6726840C1A32389E4DA561C0000000000000056012D69CA6D135DEAC2953FC5884D6B98808C82F827026235F40A4BDC4B8C25390CDF5F51D94619A339B41F",
-"00000020427B17C75AE8B8E333E57428C5C0D07F525A65385E91143539000000000000005D3C7B0A06A3C56F307BF0CEAD7AB05E431175F7740E3918D983C041B14743E8940DDF5F51D946198DFDFD3A",
-"00000020148FA50C1DF6488EE4373A372303A6948549E974358649F02D00000000000000BAE365660215D4676C359A1B1B9D5E7928F7B18D62DE5A2148705494D549F330760EDF5F51D9461915EA8D99",
-"00E00020A0B28CDAAD52519843E0AC8694D2C156C9BC3634CE21AE0139000000000000001AB983EBB3F4A3FF5A0DDB059A0F6CEFBB6EFA0BEF73B9179A8F6CC3064CFAAF6F0FDF5F51D9461946B49294",
-"0000FF3F42712CD5123BE142748EEBB3F537F23E290665995FD8913F000000000000000015634A4126EEE1450BDCE64B7D75CF1EECA70A72A742F12CC82EC4DF8FBF9BF65F10DF5F51D946194DC09ED1",
-"0000FF3F7AD7932EF02F87FB1609177BE427B7152C1139BCF2B82E42290000000000000008BCE83DF63DD5D1B595033946208F85FF292078C5A0411209FD5EEB4F5C50A3AE12DF5F51D94619F4877D97",
-"0000FF3F0E7A0EF4D5E95443447BB70C632CCE88554A13841C6E2C620500000000000000C986855AF92D10902D5DE6231F551C1FBB73D0590613FB8901976E8CE1EC81205C16DF5F51D94619208DE502",
-"0000FF3F592AC23E5A75192652D0D357F05B71F3FA391F4510ABF05D390000000000000074ACAB7CD4B89116B9E98E7D6728628CA4266761FA5AFEB4DE9A7B6277EC628F8116DF5F51D94619194D8D1E",
-"00E0FF3FF130B1082B31E14AD4854DD12A84D07AE4A1B366092073F00600000000000000BA8C0AEFF142FD827C7CE13B097A05EBA09BD4BA6A9FA68518803C2118F707954917DF5F51D94619C54F515D",
-"00E000206E1EAEE927046F6E06E5B759DC9D3E0B239D01F5EEC14A131A0000000000000099A7C27ED04946EAF80955E9B6F5F888391D32DA957EE71425B78C566AEB78840F19DF5F51D94619E52FAD91",
-"00E0002071B3736F06C2A4F658E2EC97A372C0838853E119CDF891FA050000000000000028C25B1CC2619DCFB92D677411B93FF8436322EC96D7B55A455B1892E9755592CF19DF5F51D94619085E8467",
-"00E0FF3FA20D13CE6C4B74D6ACED5AE23C71D46D52DBE65EA36AE18B1A00000000000000A7987194092C791294DEF4F561717787FD8E45F9D63E54FE8A157810EAD174DC911CDF5F51D94619EBB0368F",
-"000000201807BE93A2CD62E9E56FEE3787B3C4D40D099924F025EA5A16000000000000002BE08AD088B5AF96842AED2122655E5637BB0FBC169D3EEA14F6526FC554F9EDB71CDF5F51D94619C7C66D79",
-"00E0FF3F466D97CF500E44BB645A2CD499A066E24C4145AD545EB41B09000000000000002B6DF2F699835A655931CCB9186BCE6CCF00F104B04A7FD98D4615308FF8E083591DDF5F51D94619C3388CBA",
-"00E00020247E868B021245B7921A26934C9B2F1A92A064E38B72A67C2000000000000000829DBEF431D03C6039AE88DB38E5D034FA3D002CE0409EB66EC12AA5C05DB12B6A20DF5F51D9461935751101",
-"00E0FF3F6C4DAE6312C08DD55171ED47959D3E0BFB8CFB156C2291870B000000000000008058A71B10167C74AF899BE09E31B8A4EF1973A4A133755296BDCC3E18F2F673D120DF5F51D946199805013A",
-"00E0FF3F516D042A7D88C1BE1C59ED23CFF19F665561C8EB738F86393C00000000000000F904EBD119A459D7540D546D0F857AA6B23860856544A970CF9F041C13D6DBB13822DF5F51D94619592A016C",
-"0000FF3F18677784E92A5F52889891445BA31E9C3D35A7546C59929001000000000000004A042A68B8575F526E1DEAE1C80551A4BA69E13A0ADA5DCE80FB7932E24C3C927423DF5F51D946195E40F143",
-"00E00020327F9333744A7AE0CDA1B0E8237C6F18745653D842E3F81745000000000000008316BD0692DCD2FE4461855242F2FBFFAD9A8B09E942AB99FDDDB6607D57CF6AFC23DF5F51D946192F46ED68",
-"0000FF3F13532F89CF688C350C6FE80FAF8E86F870F81A7617562E463000000000000000896A06DFA9F5D6E7EF6399E8472744FA4C9FC4520EFED12C4642825C93AF6B752D24DF5F51D94619CA830A37",
-"00E00020857CA7D83EB658457EB8FB8D626F2380B38DBD85B2B3D0A711000000000000008FE6974B7D94E2A92011FDE6B40C8A404B729E23670B44C6DE4960E272E80F090925DF5F51D946198A940D54",
-"00000020701733AD037011F3EA1522D0D70E1D1CA239010C7933AE8C2A00000000000000825D062F45A5525E996F5CC479FC33F2BE967233275528C0B793E558962CDB162B25DF5F51D946191B6920EC",
-"00E0FF3FF5D465604B263E5FA714A937034AB3E75360EECBA1B6477209000000000000001EE7BA0F75176435F6B4D7A98B1239E80230781FE0EC942E01797DD7C3834ADB4225DF5F51D94619D797DB36",
-"0000FF3FD0B47645B25B46791EFEAA4856FF81274CF8EDE6DF0F4A712200000000000000AB31AE910AA3C72794FF66FD3105F15B9BCD493BB8619B985C9821F8AF413AB46C25DF5F51D946191C7D1DF4",
-"0000FF3FEFAECDB751E3F2C4E37CE4B023E2D5C02C2C76A3647178AB310000000000000071845D5FD14897B6FDD7669C6551D2B207259244881D75CC2AB6FF3C96CFE80A6127DF5F51D94619D220D9AD",
-"0000FF3FBAABAF190183D75FF44BB393F3A0202FE21803CD48AE73DE0E00000000000000AB2EAE9C692F3CBB6BD8D18618CBE8B19C6AFC60F3E0C9DF685594F8E4485BA58727DF5F51D9461971650C83",
-"00E000202B5EB316EB3BC71CAAE3C851001B5DB76FFED4623F8E92EE1000000000000000CC5F96E18B39040037F5C31C6E8FAE0D8D562E41115036C776F70985A0FD2D923A28DF5F51D9461911063A3B",
-"00000020EC14B850B73DD1B3A8B72CBB9644A169A02884F158BB973B0C00000000000000B0B4FBA356D4249F3F06A68E17045DA4BC7826BDC2C089429AE32E251EC78E705528DF5F51D9461945FA2E8F",
-"0000FF3FEFCFDE14B7A24814A82E77E1E2A3DC94624EE1D9C9446289170000000000000032AF92DA18BA17916E423710538B60858D1517481E6EAD9E88001D55ECB594717F28DF5F51D9461976621483",
-"000000202A7C007C2BF0A204BB7669BED6ECC56622DD6BB9F2DFCE193000000000000000838493DBF39909AA8CA3C81A6C9DB6BB32EB0CC9450C833FD432E5211F94D161062BDF5F51D9461923E8C6F6",
-"00004020CF6918FA23944D91CB6FB15DDD9AC0B2A9ECB094AEAB3FC5190000000000000091C9842609FD249223C447B4B8C461C4021F206AF824F86532E5439A3A5801AE832CDF5F51D9461914568B4F",
-"00E0FF3F10CB20DD57E8208918C6FBDA61E727CA511888F43AF9C1F34100000000000000E4A059A2B1676012C8F41ECEAA2966562AC3B4C4CBAE8F7F15E8081B2DB29656032DDF5F51D94619D13D99CF",
-"00004020E21B34431043AC369A946AFC7C634508EC5C88F39311ACA04100000000000000EF310DD6C9FA6BD9D145BACEF1F061657CA342E84E96DEAC8BE6C013AE183BA1252DDF5F51D9461907A6CC02",
-"00000020E75444895D59E3EBE9F5BBF7672FC774F796DCE352588F7A3300000000000000190742534A74D2EFD0A90501E94312658F2291A96DBE7D93FDFA58672271928CCA2DDF5F51D946196FF6DEB3",
-"00004020BC58447B45F77ED676CA516E2B19FAC6C4A7EBE3C3860524320000000000000007F3D2D0937F552B86BFA974BDA53D4DD0846823457A4FBF66D6D2AB87605D3F982EDF5F51D946192EE0C56F",
-"00000020B5FBAEEA70B8C770C6609B4D16F679A405E8E810639784660A00000000000000C6946278D07FF307EBFE9701FF00CE521C895DA4895A1B2A81290835EFB658A2DF2EDF5F51D94619FA228073",
-"0000FF3FCE85C5DDB9432BF5720993AE84E5413F83110823321959B819000000000000001BC29FF0245250AD89CDAFFB7A6AA28161B99DAE4B16E2FEE3E580AC30D94FCA4E2FDF5F51D94619AA324619",
-"00E000200F0EA54493AD727C1DACF74A44D459EFB0FE179057404BF931000000000000003E5FFE48B16FE400289B775C3DA2D69C785B8B93ABC5559C590664756CF6D0A6862FDF5F51D94619B0069F88",
-"00E000204F0C1BA4032F6A2329A205085D1B35ABB464E868C378CA010200000000000000DE6B1D47881B6D6EDF005F880C3E80BB13A763CDAF39C37F083759DA831634AFB92FDF5F51D946194D096640",
-"00E0FF3FD134A35C5BD392BAAA7C97A010A117F44647C870A0D9F6852A000000000000003400A2948E3DC3D428F7C83A4725CDF2C24E60C8B42C9D913A001065FB3D086E8E30DF5F51D946194D26A00B",
-"0000C0207D93C4D416A6AD353C162675F80D47F1D7089BFA0DBAB93B020000000000000036DFC7F8D0D2F165863B5E7567001F5DDA78FAE16FDFA54B65ED5B5F0E515F2CE930DF5F51D9461942C3D41B",
-"00000020C9A51440CC11DB6CFC0535BAB274218C05E07FBB2634CC2D430000000000000017F6FD2272910806E06E1472CFE847336672A508BA1B72C487EDE95CFB71E4F53B33DF5F51D946196443DAF8",
-"0000FF3FB8678B7DF3518A6C3700047BEEBA74ED9C6CA63EE878949927000000000000002664A672C2AD42575B228A140A308BFAC52144A897703A8C9422C3D5C1018F4AAD33DF5F51D94619F0ED6F56",
-"00E0FF3F1679412F32754DBFD44CD2C72E288D6DA755196BE53F90ED0300000000000000741C93EEFAF510C47EF8A9782E5A06B5B856E8F36A596867ABD3F4EFE2E592C4CF33DF5F51D94619EC116E3C",
-"0000002041661449B7FE7F64780F1C4E9D2516AD60C1C9EEBFA6B2DA2200000000000000A39DEA2DCB28DE9E549C7DF6F4C64EFBA470A1A0B1A0DE7011B6BDF56F8B28FE0735DF5F51D94619526951CC",
-"00E0FF3F3AAFBC3A1FA539E2D65793E164F0F6290C22B38428F43B042300000000000000C13AA466961A5CF8F29DA66E58BE08F4FFDC7E5F5E8C4002DD17D6D58BFFECFBFB36DF5F51D946194E1E5BB9",
-"0000FF3FDA505F557360EBA1C68DD8D01101798F6619BD59E4ABDEE003000000000000009F1C81B1F11A4DD8E8F5F2813102CB010D27523FA3535F0E872534E8763B870C4F37DF5F51D94619FC7CFDF0",
-"00E0FF3FE31166C8166F4E91B1CBEBC831BDAB44390BDF780E01D2C102000000000000006FDC801586C6673C05D1FED67860BC541C626C9C0E6ED2BD71ED346F893FB6958A38DF5F51D94619A0515C49",
-"00E0002031B0ABF451E54DCA2F8F1DF5D8C680C44C64A5DF2ACFA1740C00000000000000506AC3EC037CA95409B83A09211EE934330F0F8D6C64E97E4995E776C20064569C39DF5F51D94619F12FE9FD",
-"00E0FF3F7F4FE57CFF11885F72F68B2E1DE695E69DA7866BC2FD7C001E0000000000000067E9E428F0C57E6C43A415878587E5847FE14BFE6412CEBDFD768AE76BBA21DBE739DF5F51D946190ADACBEF",
-"00E00020847DE7EDBF63E0D00CCBE9DA4AB0B5D3A13D40CE8ECCF9B22200000000000000D21D3165DC4917548EE937A1648A7D0B5916149E5EFB7172087C161CC3AC47DE163ADF5F51D94619BF6F32A3",
-"0000FF3F4FD9B362171141961F8FEBB4489C0749FF885C4418527A0B45000000000000009DA1DAE3D9ED2B421BFF2A11DA8BDECACFB4B2F9AAE772ECF15F2A0072469EB3453ADF5F51D9461993F6F53A",
-"00004020CEF270ED0962381D1D49FEA2912963C664779717999C837F1C00000000000000FAA77DA98055B7C6A5424F41A7D5C6488C9174E03E2D3ED520F9C5E29AFE1158B23BDF5F51D94619282EA821",
-"00E0FF3F1904C40AE73B98909C4F105DC3709EC429B8A92A3D16A22B0B000000000000001982FF422B2145C2961BB290A066990C6838172BA3B27685A40D87CBA4CD8FC0113CDF5F51D946199AD8F052",
-"00E0FF3FC2B183760E31750DB78C6676853930ADA707FA05B82648840300000000000000D0A25D4283E372ECDA056C583B29610B75EC438A35E58D1C608E200F07CA66D80C3DDF5F51D9461964A6393E",
-"0000FF3F9D06BE363D3E42147CB4693141AFF5F513260F08D0FF86CB40000000000000003C79394AC3C08E7CEA106420E3329C41C856B03D06ADA7FB8BDC69444943D2BD703EDF5F51D946191DE34298",
-"0000FF3FBE521145A1243432C6E97367F47E6B9ABD3F81A397B76DF71F000000000000005709594DD3D56B88F23FD3779DCF2FF92FA674543656E95A10DE9A4C14A83918073FDF5F51D9461932889C11",
-"00E0FF3FFDD116442D80857A0C0F215C160ED07FDB2D318C4572D7050F00000000000000081A78D1323B4A99C121A1CF04391BD389EFBDD4F922A70A1D31E543C39AEE40EB40DF5F51D946190EACE804",
-"00E00020A9AFF4653AF821EFD40FA9D867038121815F83980A1D01FD34000000000000008B612E34DEDEF1BA54E2F3D9D0B66E9FAD44C4E77B92DD66E1C7523397BDCBD1F440DF5F51D9461948C9C332",
-"0000002075B8FFBAB545961E0D0182449EE1B8D5AE1FFE7CEC32B4E12A00000000000000B4BE688C7F85DA05185548A470CB93EB1FF64E53621130992191F87ECB3BEC44B042DF5F51D946199D2E8084",
-"00E000202FE3B487DC0A7CA1ADA08B3F280FB75B6909B2DFFE7A58971A00000000000000FA62CD7CE78E38F2B897083A90788E8849799F1A4D156BFA1FD20350649179D14E43DF5F51D946199386D14B",
-"0000FF3F5FBF11F7134055D37007E1727A72042681117EE7AF000DE63A00000000000000B9E414CAE586A308531C7EE5A8002EF0331C48D6C6F8720E65E68DAE3B8219E3E143DF5F51D946195C2B6C68",
-"00E0FF3FDCFA583A4F8B9DF60B563407BBE59EF03C8EC26D6EF11B5F2F00000000000000FB772066534FF179616AA2B03B03AAACBDFA78357E56BC83ED30A3A2DB4CD7441A44DF5F51D946193756BBA5",
-"0000FF3F15C53718AAE2D5032A538095AC2481D04F17431FA1087C20240000000000000099DDC1769EFA4B8E62BBEDA297C13B76A67C840BCDBF20E112EAB7DB79E5A45B7D44DF5F51D94619E2C1B95F",
-"0000FF3F11240CDAFBC1CC03D769008606471A59DBAC0D46909EDE8A2200000000000000C11F1B9FDA70A5E3B602F67F61BD9C6FB377C257F319B8A4F4D9BA88FE75BBEFA145DF5F51D9461943D72B57",
-"00E0FF3FA218D8C6BEFC27D54FAA3AFB9941E03CB5742ED228E6C5DE09000000000000000B1C966706BDE9D5EAE46937105D120D452FAD854482BDF2B9C44052F383586B8347DF5F51D94619D6AF48F5",
-"00E0FF3F70CBEAB97D46E215E262FC595611021111EF5827C23C74A13C00000000000000CF2EDC5152B97FD324F3838B5D848E925DDFCD046A6489E02610A19A1DFCD3680A48DF5F51D94619547C142F",
-"00E0FF3FA6BC31388AA384BAC63ACA7842618707FB0FBD657105A4E40C00000000000000C4205BBB983DAF87B6D47A2C10F14526606F0AE3CE34936FDB27DAB234099CF89B48DF5F51D94619185D1C66",
-"00000020B980FA0F8EFBF5361311382177FF2F4DA123A824C858473A1100000000000000F72EDE58DA91C20B1DCA6AC03B40E5FF0B762B5388AD718B4BBEE28CBA6B2395AB48DF5F51D94619BF623982",
-"0000FF3FF142DAC6285D573291BC655F843F236F7D2B8ADCD7D0060B28000000000000004AF4FBE3A5435D9BA2298CB7FB12345D55C8392C2DEA8C7E9258016A2A2E123B0749DF5F51D94619C7EA610A",
-"000000201145AAEDE4822AF6A8F917D8890B098E919F9FCF80ADF6BD1D000000000000008CADB98464DD0B5404BBD354F83D5F29C08C760BD8A20A37C7E742F368740E450F4ADF5F51D94619B599776E",
-"0000FF3F40A0B6223F50DB5327F2B005623CA8280DE739348DF310653E00000000000000256B837064F36EC6DAC30354AD472A747E264FA341F2041C1607F286A7641FFBB74CDF5F51D94619C4AE9417",
-"00000020400427265B7A40D7F9502C4AC4327F08A213BE617E6757644200000000000000EA90FBC59DA9F00873B77E1F923A7EDF0B3ED7E129E2E8583AB4A9E8A14B2CD5004DDF5F51D94619414AA424",
-"0000FF3F16DAC28224E741684D98CB47DEF6CFC3A18A579817AE2D212800000000000000AC03005668CCBD8DD1921A4709D9285CC300F60CA3A5315D9C5F5A5A16ED81D1414DDF5F51D94619E2376FEF",
-"0000002097941123E3006F440162D64F6C389BC206ADB356A33329F20F0000000000000073A7DF487A3F8B7E5164E306D8BA045F2EBA5F904A1834080D400BD6C4DD9E88584DDF5F51D9461966049D4F",
-"00000020909E44C998465BD1283EED15A18919B425944E1E7DE6A18506000000000000002E1EA77FF13847E81820426D4B92A34280B949854BABF9FDB6D3944DC24905B2064EDF5F51D94619E91E9EC4",
-"0000FF3F547F29B1C1640E2235811C498816CB339B65A5FB36D7C34443000000000000003BEEFAFE03CE3C8BC7E87BFB4FE9A358E345397B9B9B7E34DC75887B7B7CD0D99E4EDF5F51D946192A8C0B11",
-"00E00020F614A8E5CCD80F4F9423A7FFBB039E0C14CE27FB6CB2C0EB3E00000000000000BBD12759DEDD2B4465689A4DB2F69CA3F274BED6DE4E914084F40409F75F07AE404FDF5F51D94619AB9DD4E3",
-"000000206618A7EDB74E9025B0E4C875AEB91A3860B753366241EC4B3A0000000000000012DA5274957274F4BE93D5E7EE8F15462C946180572415A9477900A42D023F0E5551DF5F51D946193C0CED92",
-"00000020C31DCD5A5F38A3E22145637A49749F8A8B6B6E508EC4938141000000000000000162F5F39788939A55991F5FD88523BA8318AED40611A171F162393A9C28C1DF0D52DF5F51D94619CB5ECD09",
-"00E0002047D3C8225B47D022699278407F33141D2410402756C48D64010000000000000087736785BAE777E7ABC9E01FED92C274296EAC7DE85425F1D7F56FAC1D69C8EF7152DF5F51D94619F1404390",
-"00E00020547B57BC5158506678CD8FEF16F014B735226F61705AF4DA2600000000000000DB5F5435D89C00A609E63E95400AE054C9689684E098AD02B6FFFD6A5F9AB0657853DF5F51D946197925A1D1",
-"00E000201E6FC5C350EE9AFF412990A518E7CCDABA507983FBA752410F0000000000000094D242B4A769A552F1BE0A1B780833E079CF49397DC2ACAF57ADF71C5106B8249C53DF5F51D946199AD4FF4B",
-"00E0FF3F1EFDB19CFCDF491626FB4C5F25AB54820252DA9D9F45642B1A00000000000000772FA14D58A7F5549911E4C01643419107188F06C78D3DF137028E1A696970F81554DF5F51D9461942E466FA",
-"0000FF3F189660554FF87CF04688625168E88BF5F22AD3103BA5146936000000000000003144813BF2B9CF9D2BF6FA928A701C292DDAD6A8553EFF2155B47C1908BDAD206654DF5F51D94619AA7FAB61",
-"0000FF3FC252692BF52EC02451E515B850E7FA0893A31BC66BAB9DC02E0000000000000024538E9B42B16A18114C732724D6C48C434B47F67D7C00EB97ED3F0AF0069AA9DF54DF5F51D9461989D0CD7F",
-"00E0FF3F3E9083E4864015787CB7E0D2EE704E7A0770D558CED7BDDA20000000000000006AFC9F9AA7A844900F80B464FCD4CE1D2053507D4DF4D6D76F04C42FCBCF91EE0E55DF5F51D946192F6F2E2E",
-"0000FF3FF1477B7C1B04BC8A388C0C980048C6D07E9D7BFA5B23E94D2600000000000000C70FE7E7ACD0742CD97C65CD0E3799A69715B3B76EF1545B67E3FBC066D327543455DF5F51D94619E37EFFAF",
-"00E0FF3F167D1E22125F5583B8507049EABD8161DBD198057D53A4FE1300000000000000EE843F4F92CA3F078D12C1757757C597C2500F72A3E5B41158E4A01C44BCB0B94C55DF5F51D94619902F4219",
-"0000002014C273AFE9A1EF059CD766D33FC94C39E7C1D80B3B4281F43D00000000000000346DEF3B56A9CFFFC2ED1E3B2CEE964CDFB2F57067ECFFCD0D82277209CC415EB856DF5F51D9461912049CF8",
-"0000FF3FA0E8C95A46FFAA92C28D1FF8F84FC7C90854C0BE1F31106C240000000000000024C1F26E7F8905C8173907DCBF2E6613C8803CD423ECED8DF924313BC40F68E2F056DF5F51D94619E6BCE2B2",
-"0000C0204C418B40418893607E0EB44DF1BF3FE0060DFE916383BF161D000000000000008197A150F0BFB3909582E76707DEA4E91EADE510AE2022B823EFC1AE0045D5542D58DF5F51D9461941CC4B57",
-"00000020B7E20CB5D8E97BB6B353B35372E2458800590053C844A86415000000000000006B46447DC8E858134C0D7CB8F6A9A045E3080874685FCD2180283E37289F064F8858DF5F51D94619A7D5B5E8",
-"00E0FF3F44CC59BD9455A982C6B4DF6AEBF21DBABCBCC07EEF88AB83240000000000000036E170E2E8BEB6078E7E580EFAAD245DC0C560754358CE38D45550BDE0E1FA9CCF59DF5F51D94619FD89B06A",
-"0000FF3F186696E4A1A0A2757E3FF00B539461F8A090F232302B20AC1600000000000000AD7D7AB87EC5993CC4246A63D8E1607BABB11BF6D6E079C954E26095A0E3C9426E5BDF5F51D94619C54834EF",
-"00E0FF3F32C3A41E4218A7664B78F2EA3887A27320303817EE8549B44300000000000000068C4EE73C47BC2076A89F71E46785421B249B2CFC007FB34A9A24B962030708415EDF5F51D946198795BDE7",
-"00E0FF3F8249C014585C2A7D103117E4E9D379BCA5A4DF9D3A81F42B2C00000000000000C4132845DE91A27289968D28248BC23F5F08259E3D7F852B0FD254CB21A08B5EFE5EDF5F51D946199B936623",
-"0000FF3F212F89E935F765D29D79BA494512434107DFDB6FF7D154E60B0000000000000053A96B350858B4331E79A81FD314519FEADAEF477A9EB4DD5A44D22BF0CD93DBA85FDF5F51D94619159D7C06",
-"00E0FF3F7C102AA2DAB5A1DB50277BDAEE676DC7893BF90D559DF87B020000000000000033C8E41C14F7370B49D83C5DE8517B35E03617E14105C1393B20895F7723C6C4B960DF5F51D946198BDF2981",
-"00E0FF3F7276529EACFC9A242A44DD90C0F842DDD1E7FB4BCAA7014D3D0000000000000036DDF5C7CAFBC04270F2712BD7C6ABC31155C1A605E6A1E64A636CAC03337C6CE760DF5F51D946197C9E73CB",
-"0000FF3F0A5706258C1107B83C24F9717647888428DB09ABA69D6A5D09000000000000002FF89B3B29258CA7FD5F8135C5CD6AEC330CE5FD37A751BD0C9F2296AC6BC6D71B61DF5F51D946192ED3D529",
-"00E0FF3F22C9852074A344875708BB765DAFC36FF3F0058F6E613E201F00000000000000DFE43407E42065DED08F882326B60D256CDB41872B8EEEAE1CB9D05BE29BB8967B62DF5F51D946195B533293",
-"0000FF3F5B4BE1A46E41F8C27AB0D26FB717AC5F91363A815C7FE9F4340000000000000007905E2854C6CBB5C2EDF261584411B6A07C120399103B1609315FB1DF69AA15DC62DF5F51D9461929380F9A",
-"00000020E843C8C8DD213F7483ADC340EF1407C86FB1EC471EB1EF161500000000000000358E7A5B233CAB84E9C6E21A4EA006A8B315C33D641C999BA35CCDAF813AC3C4FD63DF5F51D94619A38EBFEC",
-"00000020AEA2EB764B832758FA1EB3F9583E935A8D6E806861D92DF132000000000000007B23CC4656819D3F20B57EB5D769A8354FD691E11EDF2F1E4EABE7C8AE92B8B13764DF5F51D94619DB6447EE",
-"00E000203D8BC749B601F13F081F764D12186C021A16467EC82B0A743900000000000000BD70CE24E3B7878F186739DC3159C95B45BF1C42EB43560F064B09E08C61BEF6A664DF5F51D946190AA443C2",
-"00E0FF3FBF9162EEF63B5186D80203761B885C01B11D38EB283375843A0000000000000035F14169D87509463525B4323217BD0201E96FB98E5740A3847189C3C341AD87BD64DF5F51D94619D4EB640E",
-"00E0FF3F6A28A04AE971CF00485125EDDDB8DA8836A0A1304D19C2363F00000000000000FBCDE2D85C050A9E8ECA370D8BBFB908AC608B4620E5EF5E49EA4E4D1F87FD091C66DF5F51D946190F8C90BC",
-"00E00020B90BB192113F9009CE0E303B869F7FEEAFCBE005B90E4224180000000000000085E1264A76B5ED81422E836E5711D447123E4957D0976FB89CD3679F88D89F41A466DF5F51D9461973596294",
-"00E0FF3FAE6B71E12748022C526ED147755B937D92ABFEAAACD1E02700000000000000006CD4F27B7A32C2DA52C43877E617BF55AABFBC5AB27B3D1FEB99FB99477CE5CF2267DF5F51D94619561543F2",
-"0000002090C718EC0FC8E48D82184A03676B89A8F6AF45DC558BABC11300000000000000BA1F2E566A2D890530B7261EF85C231AB8BC86998A1694EB0E94E40BF63DCECFD767DF5F51D94619A46B1E61",
-"00E00020F89F9F68971B594CA46C104497E2A7DFFA4141649B60E0C94500000000000000B61C9C44C88560E52B5DDBA2769C2DBFB3A48A86E7143B469865FD61ED70957E6A68DF5F51D94619265B2DF4",
-"00E00020282E3276281D2F80367F6106BE1D3CB713BC8AD722A728D7160000000000000098C2B68BD4A8C913F6C62920AFBFDAA7C398FED1359A67598CC855C87A93B8CC4F69DF5F51D946195FD05DD3",
-"00E0FF3FC8F396B9BAD2E5A7567502F0A615ED21C7810702371937B54200000000000000CCB94375B9FC7B796076AB2F8E0AAD9B361FBB53BACA364A7BC1EE392C8B565A0D6ADF5F51D94619C5FEDC09",
-"0000FF3F18D8B2BA83DF91585807B31C7C13E681EC393FD97C7F7D432F000000000000004710F73040D4201B4FE0E65BADC65B046A9CCC0D259913630A1028C733B4048F4C6ADF5F51D94619A28988D6",
-"0000FF3FDCC20EDBA67F4AD35E9C1947D6CFE2810A5FE5F459AF7EE61100000000000000889F8A348DCD612F51562F8D04C0B44DC607228214E4ADC9224E165E185F302ADB6ADF5F51D94619CF71F62F",
-"00000020C7DB85B4B657D2C65340A66A0176BF29FDE8DCAB4A8408730100000000000000EC6106F2C31F012DE8FD7422FACF5CFA7C1E917FC6EF492001177DA7FC7A76B8B86BDF5F51D946191EEB3843",
-"000080205074EF854EB77638EE66582D6C40B927377C5BB6419453473C000000000000000DEE0136D9C0C9B87A8CC92659123D2BE2B8A856D31D248AFC8F325ED83D81F0D56DDF5F51D94619475A0F10",
-"00000020FD5D37E1FC4AA863C3096513588C2288A9423B8DDB8ED7481C00000000000000D12939CE88DD79BB6C3A6BC6DCB85F4222362480073232D3E057F5CF328CE8675B6EDF5F51D946199AF25210",
-"00008020244E49289E7A9F805AFF9FBEEFD5BB4549861C2FB7028F3311000000000000005DD2FE9E1407D6389A3A21DAA743BECFBCDF7DC1116EBCF8DC8CD5A6599B63CE656EDF5F51D946199656BB79",
-"00E000200A39572F291C83B2A7C9CE40E165770F30F8B7B059828C482500000000000000EAFB765589A7A4102C9F5168A689A12B67B802CE6735D3980FE2E0AF0FEF73D0EB6EDF5F51D946191644476D",
-"00000020BACA4A6FCD4019BBCC1F70A7AC365A172829F0719C42E4C30300000000000000176D6FAC96DC16CBD205131BE9EBB38E15C8BD956FD6D9BFBBDB84357F536903F86EDF5F51D946193C5C6205",
-"00000020E3E6B471ADC575F0D6103654FCADAC8A506F8EE67C66B3F5380000000000000059EB8C6EB9A1E2C8D6126FAFA0561B4AE7DA9D1481CA810D1F523204047A26B22B71DF5F51D946199F8A6F85",
-"00E0FF3F018178A37D437432E79A2D208A4BADBA331B7DC650B3570B0E00000000000000B6101F8883DD817119869519977295D527074EF2ED00C57F35AA9E4B7EDAD4672272DF5F51D9461912044E28",
-"00E00020BD62D9B3385DD10658837FC98EB44137B8C5D79D7292BAE22000000000000000527C4F2DB0ED37DFC2BE21E788681DCB564353810E007D275576AE423E8B0E741773DF5F51D946199C7D3121",
-"00000020756DC6C89AE858C1D7BC737E57523BFBD215079E272478A742000000000000006408F29BA393AB5DBF41B6B51CCF703A797FDAF49752B85637576EC407EAE3394573DF5F51D94619BFC24C4B",
-"00E0FF3F58B1BF061F56C54E3AED924B10A9F4B4B73806DD4E326CB702000000000000006A1340C7EAD3C15BC52824C80A0177F5FE2EA6263AD3FE536A2D708A648AB5BFA273DF5F51D9461930EC225C",
-"00E0FF3F6CCC42EF25FA1AA9CA50E0D291B93CFE29B8AF5507804CE21A00000000000000DC24517EF997702E3669A681CF39AD22B668614ABE1DC44E415DADD6F2895B59CC74DF5F51D946198888BB20",
-"00000020851F983AEDBB980003F02606C4295A2E32B9CFBD679DB6CF1300000000000000C6ECB3373A1E3EB08393AA232B7BA3B963C253812E3B9694D783137EB00258889375DF5F51D946195483697F",
-"00000020BA211311D453FCF5FC9D42B36A3EF2922E9896CD88BA18C91300000000000000997A0DD29B7D71830178460EEF9EF2F02F964650F8CCE9D4349B667725C4AE3C1278DF5F51D9461935FDFC77",
-"00E000205940ACE02E9E9EEDA283503DD96AC14DCBF6B82B891825092600000000000000DC54634055BD6B41D192770F7503B522FC746C587F882D9E681F2A921FCFC6F6047ADF5F51D94619FACE2501",
-"00E00020A398050305DC06E22EBF7782A8CF4280F8484A2AB14769C837000000000000003989DEA1E6DC8E27257B2113EB6185DCAE66B5F974DAC79C2A0DCC517E85598A177ADF5F51D9461994F2F77F",
-"00E0002055157784199479AE257FE246AA059548243E252D1C995B08320000000000000033CD626B8597FBE64509E246483C0DA1AF194AB9DCD8189B64AB344BEF2B8DCC4D7BDF5F51D946192289136D",
-"00000020D3C4213E3FC52CE1CD067ABEAB719FC7C5C89D69A1C0049000000000000000008A5B556EF9B15CA7CF955CED47BA0E1999017E9186085F0A6D55799FCC3A2A25A47DDF5F51D9461940349E24",
-"00E00020C0456064BA84913AA94F6EAFC4403091EEF388A76BB933FB22000000000000009FB0974945F42A71D6D4D006B639767C82F2695C026577E36DA0312F5DF7C4FDAA7DDF5F51D94619E98F58AD",
-"00E0FF3F5EB68D953DABF35FC29F0DD165DA93D4868F227A82D324E339000000000000006D1B87639CC3125AA03EF4D93D1BE12BE6761EC8CB9E3F987D0DC7E086880AFFE77DDF5F51D94619C63F8DF5",
-"00000020B3621E1643EDCC4092C602DBAE72197C2412F10EFB8C8AF744000000000000003A5763A74A5394091AFBDD83927FDCA3DCB77EDF9E8F8D26B101489B8292DF4C217EDF5F51D94619973F9937",
-"00004020F47DCD863E6B21605A9F7206BFA8423A6AF3D2CCFC273EBE3900000000000000B10A5CF2565E3981D4025C154A80F8568AF47ACCBD4B15D49B901DB02E5945D5EC7FDF5F51D94619A58F9BD1",
-"00E000208949B5A6581B5C78364E3F24994A0B2EB75A21326B197DE91B000000000000004DB56D0D183363F6FEEA3B86131B6E146AAF79F88E82BE9140FC248DFAD2A6E77380DF5F51D94619A8FA8B16",
-"0000FF3F63334B4369D1CC33F092ECEDEFA7153642B65B49484F49F62E00000000000000BB1BC8CEF65E3DE09A3C935EA3E3A61135267C37B1729F40A4E335AAE57292590681DF5F51D946196C8216FB",
-"00E0FF3FD6F8DF4DDE8D9ED40F497215BB49C522A506AC3001AE5270130000000000000064A52CA9D41F266781EC108F9C9BBC1B742482B24E3382C40FF0BFB8A8DEC2EB2C81DF5F51D94619FA89CFEE",
-"00000020E8EECBF53AE52E8E158D3C5A1A15ABA7DC8477A7AB0E055B3100000000000000DA9AA2DFB3CA13E2D929F4F2DD7F1C9A5D1264963C1CD17F3BAE2B9FC39184919681DF5F51D94619D1967FAD",
-"00E00020C440074AD0A4D5BE6FA64315A9634BC1B7C36F317E596C1B0200000000000000F90720BABC0A24CFCDBAD8AE7E1BAC6F817019A56A4C1CFA19227881E2B9D8FAAF82DF5F51D946191FE9E819",
-"0000FF3F9FE82FB8F67F05840A35E972797779EDFEA8FA9C5AD984F233000000000000006F6141F001799674DCAFF2060009D956BA90EE8882C3A83745B90FB300EA9968B882DF5F51D9461978F7061B",
-"00E0FF3F134E3FEB79955587EC01B26D6C7E8C22FC758B3FBA287CB33E00000000000000810AEA87CA9EF7782B683E71DA9C4D7DE51E82CC14329BFD8DF45594F6CE1758F983DF5F51D94619E9E75793",
-"00000020B75477A48C5DDA4E3E9EF7544AD6D321C74C5C1B2A8ED74830000000000000008564E83B3FBE38B11F09DE63EFF61F4A1BDEC9143BD32133500EA8986B35485FE184DF5F51D94619433C9D0D",
-"00000020D45EBCED5FE42BA87CB623D77922C43F53D28DA8A7A232A22500000000000000FFE16F7F0D86D27CDA757D8DC5AC27178D378B0ADD4BCE908B6989560557B44DA985DF5F51D94619054A4A94",
-"00E00020A411662559763F62ED7804833A66ED9F756A700608DB8904390000000000000022EE8E5CD0EE27C1471BB92027C4EBD192CCFC6F354597EE5DE672B0D5FCBF04E286DF5F51D9461944AE278D",
-"0000FF3F185C599EC23A87B06012BA10D614F9F50430C979DF509B9B0000000000000000302B26D2191473BF7F02AA75381A98CD65445CC882CA0E8697BD403364EAE4116F87DF5F51D946199DDFF5E6",
-"00E0FF3F94AD5A659E87F9F1D92F8080B75327FFD08976BE033C75713F000000000000007B357E433721D7A5293EE6B30F75AEC8BD0C0DA32285BE6B500CB0F435AF0136D787DF5F51D946196D9CFE54",
-"00E0FF3FC2EE6A48C29BCBC226B83DB9C28DE1ACB9D108A9C996600127000000000000006E6B6832EC4E8E8413FEF539AFA5CD2DAC7010F3DC604CF446E03AAB3606867ACB88DF5F51D9461900B2D118",
-"00E00020FB935811D0A045C670B63EDE44ABA3F5B485BC85129A3B1B2100000000000000056B1C1B6C42A3600814287C48DC664B32F9CA1FBEFB986EFDC4150EC44C623D3389DF5F51D94619B0ADDB48",
-"00E00020C52FD476EE1969A6A388E6D58557F4AB0D4D0F7D68F5F0D23800000000000000DC24B7F2A73B2E9A5C500F2809135FAE4A7C569E854BE76EB5727054E423C6F7B48BDF5F51D94619A42E5726",
-"00004020555666FEA0AF7DD684E1EE8FC86809F1B51ABABC01E587EA0000000000000000731863593A5B9CB7A762D28CC95C3A7175473BFE4958FCEB5EF5101D8E48CDC3B78BDF5F51D94619B9E9B758",
-"0000FF3F10DE25933ED9069A5F88E67DE71C55CED692FC1054D5B658410000000000000017B266D96C9A8B868F3C34817E18599A72314AA90CF30D1DD02009497346BA3F528CDF5F51D94619F1F57272",
-"00000020827B8D331A29E08883CEF06E8C703F6B69A2A01E3215AC6E32000000000000002516728AD49BE2E1C33F26B035C81A5F4EDA29FE06F75F5A532E71772D624B2BFD8CDF5F51D946190640E5C6",
-"000000200D1C9D701CF06744CDE5DCE82FC5A7E0F5AAB0223CAA02FE3A00000000000000837A726CBB8AC0ABED6F288872CA2572CCC507D94FB960EEA00329B1F2F9B7FB148DDF5F51D9461983910729",
-"000000208707EF7BD0D2A8EE62407A712EB4C80CFFBF8E72774A72B0170000000000000075DCA80A0BA880D90C0F0C00E1993C297503E72E078496742E0E2793735D33882D8DDF5F51D94619C7E3D8E0",
-"0000C020C40B58532FF687A85122589B3CA08B731EF3A45ABC3339140B00000000000000725304BC2E50431241D37EF0D1F2702C4FEFC71E77E1129AAE28A4A4B1923E9C9C8DDF5F51D946192EA75C8E",
-"00E00020194585B19C0C9708EE6943F4A47E9CC30ED58EA523BF18AF170000000000000026A273C9A9EFE2DEAE6B1D280DC1994581B832DEF85EA7560B34B1F9CD9EDD02198EDF5F51D94619392FF849",
-"0000FF3F4A58E9EDF6DAB7E689F681B90FE710104CBDB4ADAE5C6D6A1A00000000000000049F2324A9DB85EC8A5454F8CEC29FC8D52FF0DF63FC159387E5B37CCE5B2646458FDF5F51D9461930D1121A",
-"000000202E85DE41BF4EAE2125724D19FD29F178DFDE5330C7C739C81600000000000000AEEC8A5A503C127C7044B29842CB8DA1A1558C4297AB199A3C9447A60B045A309F8FDF5F51D9461979943F84",
-"00E000208697B1202D625322D816B3BA37ED3966172F1FBF55D23C2A200000000000000078A7470153837EF11CDC07006456DD5A8458D51AC3225780558E0DC774C04149BC8FDF5F51D94619C06D43C2",
-"00E0FF3F62E2C66E53A73EB2023316CEE9F4675E58A942CD5ABD20574600000000000000FBC72A3D531290F2C7AF9EE7650B869910D14A5D856C258BF180A2DE5C6C06B6C291DF5F51D94619FF323C27",
-"00E0FF3F0F6DF9A40CC3D5A629EF295C8FE0C2015C9C34B1C0E48F9E32000000000000008DFE3EC58373F9C6EE575AA0919835DE621BA68CE0D02093AF9E63FFB86E66B9D491DF5F51D946199033437F",
-"0000002031AC266423219516B3948EE20D4EF7D13230F57E594158101D000000000000009FA6155DB379D734653D76E5A86AD42124B6121CB183ACAFAF24C36CC16604DD3C92DF5F51D9461996B1AA74",
-"00E00020AF9FC25DC3F6F21ABAED351F4FDAF2CA7E490F92778892AB0E0000000000000036EE3160EB9ABAB13B87156B37440271B5E1CE9C0A1C53E067842BFBABB489876393DF5F51D94619703C168C",
-"00004020384F47F2891629AB7B3F166B5C1F4C3AC6D8E7FF07D3D9013B000000000000006569FD3AEA6486DB79C568A2B124CE5B3668A165C7AD1168E708D7BB7C50BC6D6F93DF5F51D946196FAA94FA",
-"0000C020F57AA2B1051190AD1053443D0AE80AE552E26ABAB841EE750B000000000000001DF485371D37AA4D785C3A992F02E2CB2AF88116E45CDAD348CD244C8D19D06BCA93DF5F51D94619805F2EB0",
-"0000FF3F465543B9D2EA6D094742521F28A9F68CABCBCA0C066803230C000000000000002E0D84FAD576E1553F56EAF1A7D779F40C391795BC3F209DE6ED7F45FF0BC9713994DF5F51D946191DDC0B30",
-"00E0FF3FE1DD55EC5A085B2426AA5FF2DF428C424634586C9F5CA9234600000000000000BB5A38398C3622815DDC46BF95F56DBB40457B6216A40E8778558F828E5A43B9B294DF5F51D9461912549635",
-"0000002057EE24C66A695745C92ACB9F54B2EEAF97EE91BC290E26B1260000000000000057E92788C7F9D6B896DBB2825619C1D30E053D6BBCC9C5004DEF4B3EC28DC875C294DF5F51D94619021461C3",
-"0000A020A130CC71160420B20D8B65E41BD12B25BE7421B52F5B82CF0900000000000000E883F7BB51B7085C650AACF54DB0491C3C770B9D446CF91D4FF1E497011933C5F994DF5F51D9461986BB024E",
-"0000002021B67836BBE8B2188B75024D80D77E761246CDA1147A4E522B0000000000000068188998C77AE5B1ACC1D12C11BA38CF08B62E5799B9A2BB97816A80402DB4B2A695DF5F51D94619A46E40D5",
-"0000FF3FFD7704FFEC56D926AC9994A9282CA5E07DF3D8E09787612E1F0000000000000015CF70644E3DBE717D120E4612F7D5B31EB66651261A9BF7CFE0EFDD12B50E6D7297DF5F51D94619FD9FC52F",
-"00E0FF3FB406473C19968FF1CDD335E6AE2E06239AC00490E40D87FB2D00000000000000193A1BB6D84C03D88EDBD6628731E6B4E4328260DEEEEC73D20F677AA8F98D9F7B97DF5F51D94619983F40AF",
-"00E0FF3F604AD9DED7F53B3743CEA3589785A131B2851AE60BE7E8E34300000000000000D6C7DE19057B72BE1AC7163AE2A2669F7AA8FEC55DD086343ACB362ADF7F2A419097DF5F51D94619055E42E2",
-"000000203408A76FBDF35162368CAF1F91974A0FA4B388623C86D0AF2E00000000000000A3F307C41219E2DB09C07D8658746CC60CFECF43D8E56011D776526EBC2B2691C098DF5F51D9461935BDC024",
-"00E000201C33ADB026323080AB13232F84F4E6C0871715268E6C41861E0000000000000098C9AB72E817FF42C3B7CFA557BB0350AF6A83683CBB2BE8FE0D9E00A4C9B6BA2599DF5F51D94619F34C18B0",
-"00E0FF3F5692BB787D7BFD6B73CEE2D6C9CB44AD1A0344553E22C4A601000000000000000B67EF3703FB7D0EE03030E2B2F213E24FD7B377BF5E7B73A3A5B1D4E7B993BAA49BDF5F51D9461974938345",
-"00E00020722A0FC6120FCD3351ABBEDD5152A09FC063B17E1A9139FA3E00000000000000C08D30840FA020DFA655C6363D764B0D54859D5C70C241B90575DC9DD8B6C226D99BDF5F51D946190174B7BA",
-"00E0FF3F03E579D175CED3F7784D02EA8FABB555E0A4DD5D8AEDE7880400000000000000DD9178FE0480B097037ED310BBD0254CAEAB97999492AE44815FB4C729B3B2208B9DDF5F51D94619CCEECB72",
-"0000FF3F452A896E6F576C1581D74F4DEAC5C123C3E54290B941490B3D00000000000000704C70E4D04C69435A8C7A015992DD0D2BCA6BF26C426F65ADF46E997169FA162E9EDF5F51D9461978667785",
-"00E00020B38A10059B57465ABD45F4601FB6040320083BCF4A327F630E000000000000009ABA9F02600D486A4556C37B1497D8E7672402C8B614747DA7C280F77696D26F809FDF5F51D9461986A52A2A",
-"00E0002088F2DEAEAFB237470E71D72CE26C5F71620B43CC3F63685E390000000000000052F7F9C6016616265D6EC819E2BB241370039B3959587992CE90785D8D78713CE2A0DF5F51D946191C081A62",
-"00000020CF3AE31C33C72F77E8BA83535DF2916EA963B46C7C7F132E2100000000000000B349039F8F2DA40090D9E140A40F169A99DA0EEEB84733FE3528554DA29DAED15AA1DF5F51D946190DAC4C19",
-"00E00020A75384C24647D65BA646303C56007CF2F1D45A748630DAAF2B000000000000009BC4EE27432A801E88F2741D2AC9D78B535FDB5003CA20EC8BF5B9A1BF10BA721DA2DF5F51D946194B610789",
-"00E0FF3FCCC1A3333696BFB289C8858C5EBEED15D699D7B301F779B01B000000000000001AEA9B8A6CA0A649645EACB768AB9D18D8643CCB47116D6044EE650B8717D15FA4A3DF5F51D94619BACC3B5F",
-"0000FF3F70E0C7B227008C594C4C15C4708FE1A62785A941B658157A3F00000000000000F33DEFC9B846BA0DAFBFFF8857EE58003F1E5DDE8F2337C84D1D09BF4637665E00A6DF5F51D946198EB3464F",
-"00E00020056EE3FECD7DA520AD2C84CFFC57B659098842FC32930BFA1000000000000000FF7D30E5D4EFB5516E032728BC6E36F4745A134FC53321BBF5DE1A18DE39F88AB8A6DF5F51D9461971990F09",
-"00E0FF3FB7A00D310A00B6A4088640CD80226D578AC36CB0C39C31FB10000000000000003F03D416F3E96A7F054A44221FE538E296CC22F554C0C0942E707592A3266D51CCA6DF5F51D946191F95A253",
-"00E000202DEC7DA5F28F55D9322B65E86C292BBB483DCB7AE04846AD0000000000000000B340C8B4316F49E5F21685B7BA005AE3B0EDAE6FFDCE387FC0646CBAF224B799A8A8DF5F51D946192F309C64",
-"00E0FF3F6A8CEFB32F74BAD626986E3052F61758DC6FBF0B783B86E343000000000000008E29E2EEA9AE1B6F7BC735F10D2B956B6D53CA7A3B2071448984D2E771C2C26AEDA8DF5F51D946198412B7AC",
-"0000FF3F31F8ADA938CE0202F69B7C97D98C6A19C7F7816E749D972A2A00000000000000C29801BD2E74A4977169B0378044FD5D6F5E0AC773F91587433188D0DE40759D48AADF5F51D94619153ABE87",
-"0000002098632A7DE01FF2AF38D26D73F94DEB6BCCF1397AB7C19985260000000000000045FBA6951933E1C819203EE95CE8C4B5917D6DB9D086016A1E8B6DE687F88D657DABDF5F51D94619617B725D",
-"00000020B92ECC42DFB5D431B4DEAE787F693FA5FBB359B9738EA1581F000000000000009DD0816A29938BABA8CFB0BE44313937E547EB504B77CBE0D2899CD5F6834047BAABDF5F57E5301950D466F1",
-"0000002073A3B0A124ECFF72EAFC9D5EFA46FDA2C2285040DFE567461200000000000000303BEE72229F594FBA53F5087B7FFA802B4B9C0136E4E3F6ADCFE7F24C146BD007ACDF5F57E5301907D878C7",
-"000000208207ABB0C8DA3E4A750E4B40491E8C3CE85D65B52E5EE71B2900000000000000ACBD59C6238D1F44EB3DDE8C02CAB376CDCCA5E35B7EA6A6E1CA3E8AAB97A95F6EAEDF5F57E530190ED87F47",
-"00000020F53879CBBFA92264AC9AC72EFFF0749AC82B26C5B342EF761300000000000000F264F8AE5ABBB47769A8D4E90A942EA8EF12488B8B91DC4F3B94884FECC3901226AFDF5F57E530194EC3CB62",
-"00E00020CC8B217A5C10DD64F30DE53D35A652AE2B95AC061AAA2D540E000000000000009FACF216E81D4EBF06C06969330C619DA359AEC05312DE43CC811C1C822E575202B0DF5F57E53019EB732B35",
-"0000FF3F1F1BB12687DFCD596E5CBB5E5FA27A64A9055B8F1603955B240000000000000026E2865CF20DD059FEF1BF09E1B1C8D8EBC146690F613D824E0B652CE9F80AD9A7B0DF5F57E530196A7AF75D",
-"0000FF3FEA9266D1FC0F74F2BF9FAC36D2F57333A8EBADAFA2C898CB0800000000000000E40C5418E461C5EE2CAFCDDC52A0A00E41103F48409EA0A474A3EB981BDB0EA0D9B1DF5F57E53019EF66C718",
-"00E00020F30C9125F01F259F56B9490069179A1D7AF544F2CD02EC9B0E00000000000000C647BCDACACE74C309753E5AD02DF295285076AA295853D50FFBA662616C2CF8D7B2DF5F57E5301967F53E80",
-"0000FF3FD0778C1B97832EFA8B937743D8F7235DE5188727801DBCEF0700000000000000BEA43FA2E290EB4CF156DAFA048405220CB186EC8203225B60F1CCEB98692CE643B3DF5F57E53019DFFE40EF",
-"00000020F4E1C8C0329EC5AD4777C2A967921B951745A743954616991A00000000000000B8BE58C2F0B09ECC9D44429D32908188121AAC849117BF1C36E2D00293CCA79F11B5DF5F57E53019DB2C5A4B",
-"00E0FF3F329E34E3AEFD6274A9AAB9F7E59EBBEF06411592A59D9BEC2500000000000000DFA5A99C3189EF1D721B92F60CE0DB5C5A88DD21A9F32E9D2772829AF39ADEE033B5DF5F57E53019D811B6DB",
-"00E0FF3F97738E6C7963809C4DBBF20EEF212D9A35D6EB3358F58C8905000000000000000A5898A58EDBC18FA525010FAF57BC340DF095CA3FA7106C37795A8D2D26340D9EB5DF5F57E53019DB445E05",
-"000000208F9D7BA0F740C24212C803453C9C89D79F91A942BE46333F2300000000000000D2EA2CC1864333AD7F3ECFDF526B86DA76EB86FDCECBEC1CB2E456FF020471BA80B8DF5F57E530193E01FF4F",
-"00E0FF3FA9EE3BF1BB3AD171098707E4427796B8E7BDAB0298C4FE2A250000000000000001A939302E35C7D26F92B8A2395F05E30C6E76C42EE64473BEB48D444CB2930E87B8DF5F57E5301988013EFA",
-"00E0FF3FE98BEF41349E03C238DF94B9E957A4B0123AE264C84D5CC11700000000000000B68961D79AB855494ADE7F1E39D419E13ECDAC0DF009C2F3ABA5B909C20471F056BCDF5F57E5301991E68513",
-"0000FF3F0334E56DE704BC96809620BF0D769217AA0568A365C8B5BC27000000000000007C0F49728BEEC40B44960F3586C52AB19B520FD8286364D376D94F9CDA562F8CFCBEDF5F57E530197B83E2B6",
-"0000FF3FBAA169828AB89C37219138B7A8A3F4FC95656424FA8779DB0200000000000000FA8A3712E4C2AE488CA76F8834EACEA7B16317BE4F28AC97838354B24F6E3D7DBFBFDF5F57E5301905F51BF6",
-"0000FF3F68C052F66E38C98C769811A687AC171821E4B1655D6871980F000000000000008C89D9E825791108CCA548523F2BC848063FB62142333C6A9266EA4538A350BAA5C1DF5F57E530191296350F",
-"00E0FF3F777AA4974A4A787DADDABB2AC3B921855AC32DB374C8A58C0000000000000000865A30A95573A93FDD64157EDE2C3CA8FB0B73F5CFF2E739560D4EED8495F7ADE5C1DF5F57E53019EB597A56",
-"0000FF3F629F57E4CC1FE2FE34D5518469945CC1E9CEC9FE5A39BB5C000000000000000097E3B04E868EFA404FC0573FA7E3C8E0BF07CE6688ADFE98C40C2DEEBF06F401F7C1DF5F57E53019B95F3BE0",
-"00E0002087E8C8EA06CAA05096D398FFEE95F61805C6B038F27E3DB40E0000000000000078C75FDE06373C6E2CFD01543A18D17110E74B8FB3B4772598D5BEC3A759109E72C2DF5F57E5301912D75427",
-"00E0FF3FE75875B97AA55076C8CB5BC43FD55197BD002B67650120302D0000000000000085535A47318BA6A6EF5C53DF9771A6566049F53D3E8A240CB723C1D8A81CCE4105C3DF5F57E53019D838FC95",
-"00E00020DF31CF05AD3B5353B2AAB5C498B456E09EA708114F7766C31D000000000000007BE5BB8511B6DD38875953211237C94CF80B2252F897712D45B3E743D6FC374049C3DF5F57E53019F9DC8A56",
-"0000FF3F3C361A3191F358574A932FD166F907D7EF58657DBF2FECAC2800000000000000287644427DD41462F2AB596CF2B3D6C660A25BB7EC488D5FDB5F32AC0AC6F5EA80C3DF5F57E530190819FD59",
-"0000002057349B2CFF3576B813537C5B6DA40C5D8A5D0453908190B60E0000000000000088DA5B90F87354574ECD84C69815ABD870C8E0942D3B23998F58A82B8C576EBDE2C5DF5F57E530197E91BCC5",
-"00000020E4988581D0C9F11A9FB3BB8FDD0716ADDF6E42AB53C2DD9B2100000000000000E9FFC9750D26BF5A7FF717457EF7E6A24DCB157EA59905579FA4F3192C3C38A8EBC7DF5F57E530196458E5CF",
-"00000020AE51FE03DBD7AC035634964EDF1CD80D8FF403C2094A5E551F00000000000000239A8BB7372C559C0DF7FA80EC85CF5F74EE9BA84D84D5DAB6832E345F2C79F910C8DF5F57E53019B52762B9",
-"00E0FF3F2E32EC35F0E6C32BC9A00D69ABDBC234624DCF79026E184112000000000000008DD28C8CBCCBCD1B34841DAB4DC5AB825B9AFC4ACCAC016F1094E9483AC0867C21C8DF5F57E53019F008C782",
-"00E0FF3F4A261C32A6E6C411AD2B45571D1EA2E0E604805291C12648020000000000000037C027270DACBE6F53C07119742E751FC49B48BDFFF49BD40B9DC52AF304EC56EECBDF5F57E53019A5916E9E",
-"00E0FF3FED34379822606997107F3F3F78F49854FF8DD27A5B13CBB805000000000000006C65C6A0EF3815F129AF6E44695D5F0ED85A700D5DD8753CB1E8438CEA84301D2BCCDF5F57E53019716E842B",
-"00000020E4139AD4D806E8A1AFA9F19199F6FE84A07B6356560DE12E1900000000000000A2D49FDC20F8CE768A5FF26948B64C261819499D64FB6FFBA322C4386046EE93ECD0DF5FFFFF001D32CB323B",
-"00E000202194DC98A096B09B2DB61B9CF93D67B861CF299E6FAA58E9E7D9A5CC000000003583608727DE709E953781437BF810B769DF2F7C4D94E1DB8DA49585F7CEFB6DFDD0DF5F57E530193ABE340B",
-"0000A0206F960B6CFF8BC2E3EBEA80C2954EC5517BA412F69D8321970E00000000000000383FE0BA8D55EEF022A3D32A7033EC7601C520DF5480986DA1A2EF3A0D7A504E1AD1DF5F57E5301909CE558A",
-"0000FF3FA6ACCFD30F5DFEEB438DAF36424C0AD64C130C09E1BE1AA60B00000000000000083725152C02BE02B43F3165CB344F4C9908E3DBA42568884D928057D562468560D1DF5F57E530199C272553",
-"00000020C09AA9EE21F2C9A4232BD7256221B88B1CFFFE2462F3A7A407000000000000003890BE548DE0161690568BE6879292CDB7FBF0991D351D06C0B665EBE0327AD7BBD4DF5F57E53019CE84135A",
-"00E00020F1B732D5026E64ADE8E9D6160CE56058C99326940FF32967020000000000000035EB3A43813AD6D35A714C2922348C16B2CCACF5BB21A7A5F4834DE0A5F13891D4D7DF5F57E530199BE203EE",
-"00000020F9523FCB134BB8A5B803466CE8035CA277A74D9F2E66C0060D0000000000000070D6D78DFECD603A3D35A7CACB2CFC9964A1D82AEE7E8F80EF82735E5E35D72102D8DF5F57E5301939179149",
-"00E0FF3FBEBF162FEA32F9A7F352FAA4D8B7AE63B9AA36AF44CA74890F00000000000000CD75AFA02BAC875B3F07A0FFAFF173E4A696F3838E09D160FED3F31F9B3979FD25DBDF5F57E5301909BC74D8",
-"0000002096C509196FBA402FFD5306C970E771FEF40719F661428AE40700000000000000DC266ECC518892E2ACE85E91CAF1BD98F7BFAED7E28283DFF87AAC60B378528278DBDF5F57E53019D3C149F5",
-"00E0FF3F91FE947846B3AE8D6E88285B488EC9063A801620A89D9E23260000000000000038FCA4427CB0EC7DD71CDA754C5459C53C9FC446065D72F72C7786AE319B3387B6DDDF5F57E53019AEDE1610",
-"00E0002055D61E69FD9C28A532DDFB7339F12463FAA883313D2D6ECE2B00000000000000E79B411FDC3B1CBC5F75507393965EF36E7E8C841D448CFB034A9E3FA45333E728DEDF5F57E53019CC4ED72C",
-"00E000208D7818ACDD77B2D13CF918BD9EEB234E6DFB67A2CFC589E90F00000000000000FE53090A58539CAD5F180DB61FA057027A3F35CE088D16C50622F7926FC23FCF25E2DF5F57E530196BDF838B",
-"00E0FF3F7900280C0A59621B6D84C34F858FB66B8B4B07C0AE81EBD31100000000000000186677390747AFEAC10E3077E7EB95F99AA1C6E6D09AB6F9B664DE38E716651B69E2DF5F57E53019074BB0D5",
-"00E0FF3F41CDEF86D8F3FC15C5FFD463D0E0F304183BD90FDEE60F6C1600000000000000D82A19AC465398795B636791F42E85072C1BE94E71AF21E3883D6E48F57138097AE2DF5F57E530193D322243",
-"00E000207D42B91E0A1D1DC74C104C04DAB384DBE029B7C82C813F151600000000000000715BC0224E4A1BE3B24EFA6139676A297DAB387A0AAD71A995DDD21770B21478CBE5DF5F57E53019E184B10A",
-"00E0FF3F2D5AF472A12DE8676ADA867CB80DEC51B54FF6CE0E4681132D00000000000000C4F8FFB69B41B26BE919862C2AEA4FF924CC5BC4F6D589E828FD1C8DC0F636FB8EE8DF5F57E53019929F7D58",
-"00E0002055CB5DE42630FC11F441CAA6EF3CE56B980FDCF968882E0C2E00000000000000ECC1B7FA0FDACDC7057EDB6AEF9190C90CB6CCAF2A06A40CFFF2145370CF283C39EADF5F57E53019BAE98798",
-"0000FF3F16F7C9EDAFA3678ED51C612A7ECB396D001EAB89C56F7D7C22000000000000008184C8F51AD194479A8680E27B5005167A99FA3BE9EE1BB697636B4AD4CE8EE9D4EBDF5F57E5301943D8EA1E",
-"00E000202F603E57A5C9450073D40CA2CAF0B9F51A58AE27961727BD2F0000000000000029CDA593ED70922B07D2F252564B9DC734AD17C9F9269B5F23533F9EFA1E07C9CBECDF5F57E53019D9E4F0F8",
-"00E0002059DC4A75D0137FB9C73941943A84994C9C5604C71CDEC36E290000000000000075BA7A5684CAD69DB1EB359EF5AAFD54F6712919CF68E54CD12D21D3883E639A2EEDDF5F57E5301925B06DF6",
-"0000FF3F319AC65F8C7B1D96D3F2EEA9F6E8BD7EB792C89CFE39F43711000000000000001E91263AEFFE199D902C9E1B66E5C6CB1A1B4C3DF670450B7D90A31FFE5131439CEEDF5F57E530193EEF7BFE",
-"0000C020A92D4FBB62144674D2F9381207F0F0AC4B138A25589721561500000000000000807BB918E61CA482186F38C58CFA56F085343E7E2B6218BAB146A93C0B274FEBB6EEDF5F57E53019686119C8",
-"000000208C798596F16A9A69A662B1D4613049D56AAE5A6A56D8E7AD0B0000000000000075057B7A1EDE3D363D74D57D4E9576A50C0133A1E36C07CE8E0F018CB9442BA7D7F2DF5F57E53019CACD1700",
-"00E0FF3F23F0518CDD21AE425FDC6366FB86FE53CB69F8EF508C8DAD090000000000000031ACAB81F4251A1EE6CBD623037B4660C5B19C4D0472A9EBE66D9CD5F6C27E54DAF2DF5F57E53019132AA84E",
-"00E0FF3FA42C774FB4CB4E01C42DA7692EB8777B1356BD71EB1CD33313000000000000004044AB8FAD5950F10A07F95A899B47A4D24BC0A310E00B6A5EC5F8CA0007DBC4FBF3DF5F57E530196E43839A",
-"00E00020C24688031967247B0C0BB7772C99AACF049225D23898861E2400000000000000AE654FFB6F74E285A523B123558C518ECD30427D26900699B576BE3B84F5A7AED3F4DF5F57E530197ADAE878",
-"00000020AFBCAB48F2AB4B83AFED7E92BD82E1D395E6BD137AB153251500000000000000158A1DE430572DF56202CB4182B81C857D7FE5BAB53711E55B1F3FC578D8782CF8F5DF5F57E53019E22BB09A",
-"0000C02005739F1C84FFF9F9623FB3F3398FE088CF728C5ADB77138B2200000000000000CC220FA5A4E3503FA161FB9FE2AFF33030C96C0F86BF572FAA20D5E65AED01204FF6DF5F57E5301927938970",
-"0000002061215E6F0F0F75C7BED1034E688121C91B70A0E173AFEFF517000000000000006C7CB6EFCDBCEACBF35372F3E31477A3F6F2EB78FEA223547E4A21970CBB8B248CF6DF5F57E53019662B1BD2",
-"0000002002CF386F45B764FC164925849E7C319498CD96FD34E97F5412000000000000004EFEB7DBCE72A16AAFE1389E59CF8730BB7030A206D1E256CA67C7DD39DD307A3FF7DF5F57E53019104FFFB3",
-"00E0FF3F50498A47106CD48810F4985B7AEA4836EA7BDD2338597BA31200000000000000EB5054B8236A5AF25939713BC7FA8B883335D976EC445F33CEFEA05FAF2BB14F79F8DF5F57E53019EB1DD01E",
-"00E0FF3F59B21D9B7DE4827396CAC430C19CDAD2963C0AA47F43DF912D000000000000004858DCB35AD2D0CDC6958991E3AC1E6B3493EBFAF70E05271AE28CFD7C3D7EFA45F9DF5F57E53019D81F9620",
-"00E0FF3F8B82BE2E3E0E2D00935818D9A21C95AEF421D50801926DBC15000000000000005C9DF2CCEA4EC186F9AA3B4507373088851C074D90185F1D094E5CE9716E3A559CF9DF5F57E530198F1B8900",
-"00E000202E35B4B9F1CF3E696710C793F363254FC51BE9CED6CB9FA40200000000000000357E9C2C74BDC0FAE8698B702D82BF67C0D077B1347B5628661344E64CBD94CE4EFBDF5F57E5301949F71D87",
-"00000020C8036C96D6CB8DF4250A74C3AA63BF8E0CE8A339D343A667130000000000000037AE2BE8BFDD56D145DC266E2F77AB0B2E09B62E891E4256C91AFD6F748AE43DCDFBDF5F57E53019F1A6EC87",
-"0000FF3F1A1735BCD4312C4DE8C350982778EBE493BE915702AE28110000000000000000E2428F314E5DF0ABCBA77A828E3B15A30FFFD304DCC0436A2806E921792681CDCCFDDF5F57E53019934394EA",
-"00004020038BF52934479450482FB9FDE21D05C7E95AB8756C1277330E000000000000004B638193C9DFB90206498625994F00E0C189FD41CED5DA5F64AF7C3D0B1BE02D4DFFDF5F57E530190597FE11",
-"00E0002086E1781BCCF952B2FB33B6C11A500C31A733236A6BFC5123180000000000000078B824574BF579B724130A15920FD4AC2E84D99C0DE3E9D7150A4C087352B68F5900E05F57E5301934CE9ECC",
-"0000FF3F4B61DD47889CCE7D47774FF51901335A0599FC82DFFC282A22000000000000001A839240F9F505C139298FEA43C8D8685C3B116B3C7B519F02A64EB334D98E144D01E05F57E5301920BD8E1D",
-"00000020C10AEDCAF979D53CB967739ECBE2A96C09B3AA80DE21C58919000000000000003A90B0B3E2ED5C7ECE6F70CD3F01E58884DD7664CC600B075EDB7288832ADE961906E05FFFFF001DE8DF04D3",
-"00E0FF3F9B26BB8729D0F352AE0FBA2A3556BEC5F7EAC98EE12ECE6356E5BED1000000000CF4522AB1A8112FDA47D7CEFC0EAA5DF0987D7878AE3606DBFE234D2D3FC3EE9006E05F57E53019DCA20CDB",
-"00E000205CCB46392F12FA10743BA6B4F93A128F55E5B99AC7BE831B29000000000000008AE4F2791C2AA6FDC6DA990738B05C394D2CCDE2AA53793B5B5FC0973A2150952709E05F57E530195972E6A8",
-"00E0FF3FC3C3C67A2A35231E88C274D92CD96E0F13B72504296D307F1B000000000000003A126691565B8284FA263F4CAA447DE82C1E48BDBC7F9E495234D784BD2A680D6C09E05F57E53019C4E742D5",
-"0000C020D898094A898BBC0DF8E445FDC4667D3D68FC950CD80B33501500000000000000A1D5E58673102E53E34907C0E865DEE6AD4BB12A11FA1D685908AAF8B3E6FE25AF0AE05F57E5301921A0966B",
-"0000FF3FAAB614CF65446060447BBC8BC3417A68E0415936D7F5EF1D010000000000000089A9A76CCE0877438B36A9477FAEAC33DCCFAD2F4FA078FD6D4F47EB5BCD13F17D0CE05F57E530193EF66588",
-"00E0FF3F49B5704A4AE02D116CBA16669BFEC62A1BFBD8A4A136A04D2200000000000000C22956B1621AD427BD01B51807EDDF9B22894DA96FA0D1D39DC924881E60FA97260DE05F57E5301938AACC72",
-"00E00020869F95C694D7E38D67D8D6A73F1C864700140D4F1B24E90C0400000000000000450804C56CBF564A137F011115B653313A4571E0171821B60EA02DB1ABC9AAB5E40EE05F57E5301955EDEAC9",
-"00E00020C650149E16319DFEE2852B34D82B3A113C7FCA3310EFECDC1800000000000000EB12E4D035AE2705B3B36C84EE23F5C9E8EBF12BCE8C8A6FB102FCF2AB0D8E347812E05F57E53019D8FA29A6",
-"00E0FF3FB66886570E6F79B5E1E40E1770AE4C16538B89B05FE01E762F00000000000000FCEE9B130D370B5A3A59ADD8A25183A54943FDE637CB8002AEA7F8F0C14F7CFC8813E05F57E53019476593D1",
-"00E00020392A50880611B8E6669CC8565217776F9FF8634F5D4F9DFC0300000000000000856029E2B509080E38EF3A82701632CF9771DDB12FED510BD344AE36E3970FEB4E14E05F57E53019D1EC26E2",
-"00E000203900510E1F7213565E4C203B0F284C2F9B99706728E3036B1100000000000000FAA71F32A35631387C73B84F37455892C09D2B619EF8BC4645C50D23A105DA595D14E05F57E530190A55579F",
-"000040200A590CCDDFC6007BA8B086A7B867F8F9DAFB91F9033C26BB2700000000000000AD31090C2F236A537AC720E75BB83D46DF4096E6F5C1B369488B47809651A8A8AA15E05F57E530192224D5D3",
-"00E0FF3F791D9E2DFE8A65DD5698910B4CCC63C75AE8FAB35FF97AA20400000000000000D1CF995940865AD6659FBA963EB809902313292DE633705BD235C11579D914D68E16E05F57E530199F90C0F7",
-"0000FF3F121A5B0E268D5B2B94E358CACA6BCC20FA1072FADD797C590400000000000000AF6B6478ED401AA33EA2A2F73DD64F7FC1C15D9D9BDD2EAFD0BD94A1EB25569EC916E05F57E530191057DC2C",
-"000080209660B4C0A1E89794746C0FA4077F8663438A4ED4A4BEEDEB2200000000000000291D452ED03D20A619DF27806030207C4BF46106E484C246F7B8A0B3F44AF6C62E17E05F57E53019CC1F938E",
-"00E0FF3FF6781D9D7066E2BD430749EF75A47F847E1172D2EE67338D1800000000000000A7FCC239324CA850E1207D67EDDD95076882E31E90C5B757E2A700BD4C7694986517E05F57E53019EC317478",
-"00E00020888E18BE5E5DE57F03744B37D15B997AC7FD1D6C52207A011000000000000000CDC7CE253A8D9D7A01D3AB4D6625A6B7161ECD6096EA24021BA72B75CF808C27A317E05F57E5301922092C1F",
-"00000020F0438E0E009B510B9E981652B1682CB62EEF76CF7FCC515422000000000000003FFDC4139F67265B4B32FF7C1D0E2F94267DF42EDA958E5A8AA2D4F611E7477BC718E05F57E53019ADEB6803",
-"0000FF3F1C789F4F1476E4057FA233E6BAD79D074C415761CA9A5BA21900000000000000DED9C35146B251718ABD7FE31FD93D9B9C02C838C05BB348AD5738233EC964902B19E05F57E53019637BD213",
-"00000020682E2ECADE3B5520BA3F322191006091509C8BA99DC3949F1B00000000000000D2CD231950419637EE2092E452206411B54435F6C216CE11D9D8393E0DD056370A1CE05F57E53019EECC5A18",
-"0000FF3FD5409AC98E38792A11404300749E734E3BD973AA7780302D2900000000000000D8AA5B16D941CF8D0AA35E8E8A37B55C2A9043810ACB4D2980BACD9F4C2AD8DDFF1CE05F57E53019AE51BDDC",
-"00E0FF3F2354151A71287BC08D7840EC4B3D407DF9BF52D05328FBFD14000000000000009EA3B1C59FD788E6667A8694C9AC99E1DE5C9BB8FCF1AA4F6C6049574DD3CDB17420E05F57E53019AA95F6FF",
-"0000FF3FC2102B226C33E58D2A1162AA32636EF216698F5A983B26FE2800000000000000EE0D27C4B8F7F8D38C193AE9DDDD40C20CA2B7AF30497DFF4B44826B5A7A42796C21E05F57E53019437826DD",
-"00000020909325919537F39739F2B0AFB6D95512E344B837760FE17A19000000000000001E17FDB005935B084FA30D2924928977D3863B7351BE14C438241361ADDF32012226E05FFFFF001D5D03715D",
-"00000020E78DB64D057D012B1EB7C6B6684DCD2ED0E30385C7F3B4478617E0910000000058250588B45D2890CA43DFCB8CF0D1D6583632040F27046095468BEAC0F0B0C0A926E05F57E53019078D4C97",
-"000000209545B8A97EDE47AD0918B700CC9D2642B4B0A9C158860B5823000000000000003D7E5D86413F1ABF4F04156AA2AB40F561228EA79D6A49632974744B3585F9090727E05F57E5301959651E3F",
-"0000FF3FF1C8C1181F6DFFEA321328F229D60A793A8BBA217C10EAB40700000000000000DA592B31A37A55E3709D212A16E8EC96CEB7D03EEB49203098BEC0D5407FD2CD6528E05F57E5301961558369",
-"000000209D9665B4E3C61846F2CB0BB5A3D7D62137439715786F841D0F00000000000000025B62777D54A8342B809D4185DFBAD2C8DC3E3BBCC03D85E09AB85957D8A8962C2DE05FFFFF001D06526356",
-"00000020E135694930EDACCE30E7938B893E2A54E3B044BDEC57EE0CDAD7AD7D00000000D696D39ED73F5352E744208AA6E9C98CB940F10D2EA0D4491711D99D295ACCC54A2DE05F57E530192DD1B5DD",
-"000000204E7069296E3633C2707052A66F6A6F8942E65CC2C0AA491E1B00000000000000E9626BC1A9976925C21C1328EE07F672D93D3D70CE9EABD213FC6F1A9F6148007C2DE05F57E53019B4F77292",
-"0000FF3F2C6CD837145E7387583D8F4D1084D5FC908A4E5DC92189672D00000000000000EE2DC920EDD5EDAC9A9D99802E7CDF0A3B03ACAF5019EAB51B356C260C0C69604C2FE05F57E53019A2A4AC97",
-"00E00020C1B1F3C2875DB62D9E025E67B656192D55C0733D2E12C0000700000000000000A8AE5216A7E437E3359DD71CE59046566139A674F2EE2233C00EE8F683680A52CA2FE05F57E5301924444544",
-"00E0FF3F469845F3CDB80A0FF0C3F16B21175E8EB508C4D8234BBD132700000000000000031F2283CB8A7B9B37CF9D2BF933C95FE8396B4A97C9018F622E178B2DC3B4F27832E05F57E530193D560E9D",
-"00E00020B856D6AD18EC2503887976C57DA655E9899C9B22CAB940511D00000000000000CB9435BBCCAD064930CE1650CF7E1ACBC4952F21537C3A86F4AAFCA8C9DE92FA9032E05F57E530190B05AABC",
-"00006020CE34228A9284A10AC1EC1692EE6F821754C2C87356F4D80E0C00000000000000043DE2C25E1C170AC65D69102E7291E81C92896F173A0B5DDA6EB7DF0A8BD96CD632E05F57E530199655BD84",
-"000000201301B36D0FAF1CFA88506B96383A8A655D1971E8AABAC5A62D00000000000000EED5193DB3B2505CDCEDF4C06AE6D14E074FE9F1347F2FE4363A2FCE1C603E10CA33E05F57E5301948A9DDC5",
-"000000205CF69A307E8674B51D55B4EC48ECC40EECA80821EA7763112E000000000000008E0401A98B1DAC33E11FF5754DF42AD41C9E3C53CD0FD2C77E77BD4B8AB687DD3738E05F57E53019637FB4DC",
-"00E00020C843B7266B735F1B89CE1BBE2A58B804A903DF0C3CD0CE6613000000000000002FB3F8A856CDA02DDC2FBDE9BA1531DFEE19167A73289DE9169EB56FE87468DD203BE05F57E53019BB396B05",
-"000000205BEA3350C1655B60527778F9C665D445075C3E14815CED471B00000000000000D01438334E525EE577A1AA591ECB363CD88EC8F71BC79A1AE6FF44EEBF922AAD5C3CE05F57E53019B6FFF27D",
-"00E0FF3F41DECC0372FD9A4BAC32F953A466141E4B02484690A916730200000000000000EAE9B0AD975801487A6F491EF5108C13964D41F0B327776ACAF9271E682A1BBE7C3CE05F57E53019E4663C0F",
-"00E00020DEB252CDD265CE6D8B7A3E56DDE4E33AD429273D53C6F0D802000000000000005256F3CAC06998DAE0046363AC372D01076490BD9C2733C1AF9CD9379FBBF21C213FE05F57E530191D2E08D4",
-"0000FF3F77208B0B031D953FE19EE0F6C81598A4D87C63ABD14B465508000000000000005691AEB7F22C3843E6A68DDA5362E95B0F6FBF226F5A66182C1F28E38E1B26D4753FE05F57E5301902DD17E9",
-"000000206C58159049BE8F4C4759462CB211F7BD5103BD6E9A38D97F0A000000000000003CDBD7D9F381053A576BF76C0D752222188B9615CCA22641F34EBDC13E4168FD6640E05F57E530196A15B481",
-"0000FF3F38B05DC4DBD6FBF198E06BE26C32C26464EB1913AAF2CB022B000000000000001AE2A46A3406B9C4ED6C34565AD2B5C8E7D6E963CB7613924F61CE0E9F45A0081442E05F57E5301923EFF07F",
-"00000020C0F0E5634DF14BCD9FEA79A336AFB2EFCCEF73B12ACEAA1107000000000000006EC127EA1BF7E2333E360D452927CD6770A286BDFF101F19BBA48C5B32BA9245F142E05F57E53019B3B602CE",
-"00000020399BAB1EDAF542FD59B290FB14511C7BECA69AA40FD0342D2B000000000000005F3261433C62D27A5C47EC95E923F82A447EF78DA4B25A743DAD55E83D9F721D0F43E05F57E53019E9BF8429",
-"00E000206E7CC60970005DBA8FFC1488BDCBAD3BD404D31C49CA13C70200000000000000400BB76FC159E15BB4DD8EE1966545759BFD5654F18E9303A6B30C33CEB84B7A3943E05F57E5301974802F84",
-"000000207E7751DD85307C59AAF0EE6E077497EBFEB033277E42A38B040000000000000062FF129FD4C0CF9BE9E188FC3D0661DBD916DBAC57F5767242247A27D265FDCF6A45E05F57E53019F4E13E02",
-"00000020E0E164BD95AA61ED54430BD653EC584CC7E3AD08A4C320E02F00000000000000F461300956FABE2321D82B1872653C4016B55E6AFB19A6F085D8C4C96981A44BCB45E05F57E530190B1CA137",
-"0000FF3FED2BE9C9E74DDD1609F2CC34E45FAD69C7CDC86878B35DC016000000000000000E121DAE51715F80DE5114DA056BEFA15789B8383D1DE092903CC33353B3699A5946E05F57E5301968EE9BA5",
-"0000FF3F6BD59167CB0311F675F3784296E6DD32B77BDBEE49D28CDA2300000000000000F230882D0F7BF6EF930CA333E8F0C9D11501E02EC8E16DB614371BB37BFD4EF58046E05F57E53019EA93472A",
-"000000204304F2E9D880EC5B45FEE7F113C950377A5DD63D33501E232D00000000000000DB4B6F7677B58DC1D917535E8787390B405BA0FCBD3DCC27A2CD52288919FFE65C47E05F57E530192C640570",
-"00E00020FC56630B55CCD16E634FE524D3990E1220FBE3E6E204FAA21300000000000000B1F5B4EDD0B7957FBD1E1A7E09D52E1AB7D995C93C90856BF8BDF01A82377EEBB149E05F57E53019B03053A8",
-"0000FF3F3A7E32E9FC40A7480B0AA9C6C760FD30F031CD91F03414C82200000000000000CCCCCE0585CC1E338E57DCC51013F860611F87DC6039B369364C903A0F000F5A304AE05F57E5301975C8D887",
-"0000FF3FFCFA7A8CCD8A64F0523C708C5C143F00D6560CD6D4C775CA2E000000000000000D6B9864F71E525DCD5B6DBA0D83242E5E71941139F1E16E35C020A78D9BE724CA4AE05F57E53019C63DC30F",
-"00000020D15D1B5BAB7BE778AB8DC4BD2A9D7D977DD6C60B24409F9D22000000000000000BE1844F293A1F1A788620DE9ED1D042C71C7C180FE1D1A14A64D811D07F90AB834FE05FFFFF001D7E60EA9E",
-"00E0002025E7C91544855281183E0A822B0ACB4A91C30028BE29392BD4CF55E700000000E7091BE7D2137B5679D59BC8A7A3D2ECB4FB26E4217236E5DBE8E3D34B4FEE450450E05F57E53019064795FE",
-"00000020D8D2070F92650F8F06D549D05197A7035892B87FAD390D6A1C0000000000000088CC3CA5B64169BDC19CF7B021387B1C1D83623DD751247A1C2F370EDD361CAE3A50E05F57E53019384A23F3",
-"000020202F081A4D1822B70572CDAEF1EA96976390AB732372F8F0651E00000000000000C9FD6DF33936B15B00A7C6DBCDE5398D4B91EFC8547AF3FB61E01BB723F0C4F43C50E05F57E5301913DB1469",
-"00000020A692726ED19C24BA4369A3634018DF5CE521838CA2FFE60B1E00000000000000DE7682E6C9D4D0ED6FCE6F7634E1024F4C78A817E88E4B232B5DBB2BEBCE40C9AF51E05F57E53019EDA396F0",
-"00E0FF3FED27A94CDF0F24130EFFD4DE7ECA5F33CB5526D1488CB9071700000000000000E621E5D3087B5BF097FF88374FC1F324D3D374D928F02EEDF1BE454A51E832C3D452E05F57E530198A921F2A",
-"0000A020F509C55DCC1801B6C4C185383B8660AD147F46FDC23E75BF2F00000000000000BF3B93A79C0542F8612BBD250CC4A14BFC367186ED928853894D609702671FECD653E05F57E530193CBE7B92",
-"00E00020842933EA07C34F7F43E5F6C4597C11FF203EA2E4D3B234930300000000000000E18F14445A53A50E3F07B55D4FA668008C786588CE26FA5B4719DE0F95C8F38FC655E05F57E53019F821F8BE",
-"00E00020FAE803866F95B43D8AB1168F497BE2F351F9D8BB6A1A68920800000000000000582928DBCA1373A6AA7EB563846D4DDC06E76C28AA328A756FD6AB32CF7D0D2E8956E05F57E53019903AD949",
-"00E0FF3F7968BDFF8959506E27F16F5DA7274048EF5D0D4D46E6F8D51F00000000000000927B64040B84CC338C5908FC2B8C45A1BFB37D3310DCDFC3F42264B2F40D35033F58E05F57E530191038A35E",
-"000000205990BA2E425119CAA1EF24CE675CA9E7412BEB2CC1F946391A000000000000000F4914D31010FA6CFE979C7DC67281F741F1B40EF72825C9901227A5A26D0C08165BE05F57E530192B393E4A",
-"00E0FF3F89E7BAD2183ED7A906AB381CBBBC29243A2121C62383FD120400000000000000ECF7B05A81396D79B965DD56EAA2543F61C4C40BE24D25787497ACE75E0CB106385BE05F57E53019087F19D2",
-"000000202842B3B9ABA83386BAC4BD8669C9446E82683CC492C42AB90C000000000000008F9BCB322687CA310F47E1E6E1883026C98694B622C478734EAC66ECB7426BD0685CE05F57E530190F981DA8",
-"000000209E82998A1E864EBCADE5E2D7D73D29B8DC0B84253192FCBF26000000000000002CC95D47EC179117B4F7A37D760FA29C852374E7144DCEC4C6FDB821F2C648B04861E05FFFFF001D26A85D03",
-"00000020FED2F2F0AE606166D4FC3F10029DF0FFE655E65237F7B91676DF5F6A00000000D040EFB6A47E8EFBCEF56DC81A12E13A099DF49812A2529B395B3D669FFAC65AAC62E05F57E53019901CA2A8",
-"00000020A671AF3F5C95CEE3B975159C00E141A71BC7F07B2A28DD101C000000000000009014938D4CD0EFE087ED4B65DA7433D3456035DD34F0EEC6B32D30EAC55F7D4EDF64E05F57E53019966DC5AB",
-"000000204CA0CF9CB75D99FCA53E7D5B27C180403F9DBE63EBACFFA815000000000000003AEEB60F9E597CCE367900883C0E11A3FA5E653DC6D5DF7BF663CB9FB6B1DC7E0565E05F57E530194936FAAE",
-"000000202EEA3C77F6EF60C827C3A5E100F559C2012D786CC3A56F611900000000000000957438EB9A3D3588AD15C199BD4779C37A20563A26035B4DDEF42D8B478250582F67E05F57E53019E61D52C7",
-"00E00020AE61D3B0BE51684FAFF65839BB70DB7DDAB58835A0E6F6020400000000000000DE3583E14DAEA953CD488F15319FC00CEF4779D0F117F5DFBE7DC316D7DE3134E567E05F57E53019E6FA39F5",
-"00E0FF3F6E5AECB6D1AFFB1B452F5BAD516A317C084FD036F044BC30240000000000000065D3C5FD7FE92ABBDE5921BE96FAA1F7F49E5F7964A3BD89B92C9BF890AEE1F3F167E05F57E530191885379A",
-"00E0FF3FD12D89D27578C06917FE3D123243134A17DDEBBD0834D7F60C00000000000000DF2937F74E4D09B53BBBF56FF9751C9764BFB76122B00FBCE210894CB06E18162B68E05F57E53019B0DCD848",
-"00E0FF3F1015E8AA5B20FABE9CAF5373DAFB9279B55E885CBEB3483F2300000000000000A22E615D0314CAE32D253D4BAAE2D48AC757B86ADBAAAB5F3E45348C1DC8AF5FAD68E05F57E53019CC9AAC56",
-"0000FF3F6023E1CBD9728FF1714C9D048D4B54A10B55405AD5B60170090000000000000085D00C79B9F1EB6DA5A54CD765F0AFCDD21AACA19F0ABD0F0CF6B420A4215E51146AE05F57E53019DF5E88FB",
-"00E0FF3F036188C5F8E875AE5E7C9078E38049019D3D66950199555B28000000000000004F85EE3335E9FC9ECD18464E6FB558AF0564F0850EC2F0183820E75871C30F289C6BE05F57E53019FD2ABA89",
-"00E00020D70E26317E0B689E316357FF9BFA0296A43EF5401DFDCCC311000000000000003BF474124A836CD7BF4103C4F76BE13EA9BB643729550E2B791DDC68E7DB0596C26CE05F57E530195AE4D1E7",
-"0000E0202340B30E43AA9FE7B312DB1B3A175B2D752F26C2960547770500000000000000D62E81F6269CCEDCCDD4B31F9266564A0B2EDB799413164D98F8FAB6E1B150084E6DE05F57E530191385CBFD",
-"00000020DF18AC4D399ABDA68EA97EB4E81022AC65114D916A4528F8090000000000000029E2B9DF4CE8DD1CA5C4FD5C94F9BACCFFFEC4EA4CC470A19F709FAF660E1E14896FE05F57E53019A7C121D5",
-"0000FF3FB2F7AFA08B4CB2AF9CAF323ACE71088E5BF23BEAEC8DB28A2D00000000000000955D14B7B8079F39DB216484056F1E780290CF9EA9DAEC5254614D8CEC2EAE21E26FE05F57E530198505F290",
-"00E0FF3F6BB64EC5FD79EA24DBCA7AA79BF84E2054FA1BC8678EB2AF09000000000000006A7E6AE255DFDA0BBABDE0CE8E54DF9B3898F840B88FA958DA9333EA5FB0421C3D72E05F57E53019B3DA4713",
-"00E0FF3FA73121CAB394593C0E977FA8DFBCA6A5A5A641DD4A30296705000000000000008DC8D135BBB16E2B492CD22A68A93B5A88DA80AF7B5C1A22F302AD7AB2B0EB0B0F76E05F57E5301920C3DF10",
-"0000002098D190ADC73C602B4880CAA4C9395304E36542A38FB36EA1250000000000000094733E2DBC8223D192624F595C547077576441FA80EACA1B4F4BC676529238F5D976E05F57E5301979F67882",
-"0000FF3F8896D3886ADDB0848B87CB71B932666725F835FD47F911101300000000000000EF3027C389D8139FF6830226AD48095112B7E3A1F568A80FE7EE62FC83FB7DF13379E05F57E5301931F1F18D",
-"000000209CB293064EDCF5AF552AF1855B74323B2117CC67C6E9FB8322000000000000000007D0D3879E6989440AD532EF60FD931FC38FAE7A92756F498636BD6F6F7F076879E05F57E53019650145B9",
-"00000020933B3EE36AEBBC79F1EF24329BF850A8E61D46965923F2221800000000000000D65FF2BBCA791816A9945661ACFAB0CCB728DD71349C846F68EE5F9FC09B09041B7DE05F57E53019FF20D5E0",
-"00E0FF3F6FA78D9B611A303D770050285900AE2E5A8893A94BCAECDA1B0000000000000098362FC7FC628934AD4D8053E40D41F2351F0F78D928FDEF3409A18EBE28136E587DE05F57E53019B23712F3",
-"000000206CBF2CD0962F342B6BDDCA1F88A3840BA6055B585A55136E020000000000000018F4845AFA97A5B4664019A85304CAE581899BE069A175B85ECDD21F6484B27FA97DE05F57E53019D196B4A4",
-"000000200E3B57E17B286BE6234B657EDBC029757FF1EC2D9BBA54061F00000000000000EE53C1F13BE6E876E2DFA91AAF64CA935CEA4471FB63859406D58A7329AC530C8A80E05F57E530193E648580",
-"00E00020D75B920ED9B06C6CA2A5681C242CB9BF214D6D966C41CAFE1D00000000000000AFEA18AC6BD433A47533E6DE21AB03C847F43E297F300147305752608778BEF82C82E05F57E53019639B504A",
-"00E0002059C0F06A1DCA852FB5FBA0996DE396183285741EF8F386C11600000000000000798D06E448F84D2C919CBD66C9F9D43FBD15D5B3A95155C73169694DD5914E4C1B84E05F57E530195B7276C9",
-"0000402061A4B61C15F0A1DD988D0C4922FE8220CA42DF9E061251C42C0000000000000018E92D24726FA5E0C6C391C990251B82112ED8698DFD9737DD247B1CB16648A9AF87E05F57E5301991BB47BB",
-"00000020C1562E2EC8DFE80497EFC9AE9959D5E403CEC5F77871383C2B000000000000009C60D8FB5C63A584102490603205037AA661810241544C3F2606B2B3AB1217B5D087E05F57E53019823FB039",
-"00000020B99F984D21AEA06A8BE0CD5DA8305DBBBCADABB00F4F931C1C00000000000000B59EA77F6CCE33E151A48F59B2618AD053CD21EF8619B9015F2E3D093CADC4120689E05F57E530199FF4CEF8",
-"0000FF3F96689DB83CFEBB00ACCB5F423A0ED9AFDA6EDD561C3F5F790C0000000000000063237029B62843097106E0BF772001795172D52FCAD3DCF46227B69A6982FE5BFA89E05F57E530194071C331",
-"000000207E525B664B6ECC7E4730BEC2BEBA2CBA6D230C0F3961A5CC2E00000000000000054AEA7CC49FE6B12AFDD3221D16FC020B957A08333BC1C9AE8D8380A020269DC28EE05FFFFF001DCB22BF7F",
-"0000E02078A7A1C68B60FD04FAF3C4652001D2BCEB54F708A23F60C724C595BF00000000FA312695CA38A2AD53BF8B90C6C17818DFB15A18992790B9FAC9651BE079D5C40393E05F57E53019192955C8",
-"0000FF3FE8F8D993383E0AB095175520C1E0CFD215AAA0FE70F2784720000000000000004FE6A8BB2326CB2F43742418BFA32C6301AB9D985B16E4D500DACF3AD3FF9F39A496E05F57E53019FF01C331",
-"0000FF3FE73FA4D75EF2AD1C636AB0674C6628065F70E607AC2837762F000000000000002072846B35E3956637B651B5297FBEEA1C6B248639559728386E420412B2BDFD7897E05F57E530193F6A490E",
-"00E00020E5E99A0147410DF6BDA0883FB59DBD24C4DFFCE01DBD591A02000000000000001B7AF7583819077665BA0C7D4F2E97E61BE536A72E2026541C4419A1C75C3CB2A697E05F57E53019E6887C3D",
-"00000020701D78DC85EC6F21521F7D63AEDCDD1EB3BF2210CCB6ED5F1900000000000000C56F5B268E47F9465B855162563DCE215D9D11BD1A5C2B667F5623FF3A97B949DC97E05F57E5301947860622",
-"00E0002021546E1B8F3808EF8B92F1FB5F0EBEC5D1970752F4D819E10A000000000000002AA5585A173915CAC5D6E6A0517D72AE8846132FD49C81D43D93C2A74A3BFE301F99E05F57E53019B7E3B6D9",
-"00E000205CD3572A1EA2EB4B7F0A4BA22A8759E84EFC870100B76EA50A00000000000000755CE41FE19EC1825B0C18C0055E599DF759DAE68FEE5B109C28A672658770E96599E05F57E530196277DC77",
-"00E00020A26F3D3428BCDE06E5AD9205C9BE8F6FC7C5B044A691195125000000000000003D4597211A8BDEADED60735189E4E1324D713564256EEF829156C373AF589860749AE05F57E53019406C229E",
-"00E0FF3FD1C29C5860043E5A741DBDF7C289F58CE7EF820AF471BE091F0000000000000028BBD5093031EC5F8AF0C1860148093D19091A5F86495D027DA438865CD6D295EA9AE05F57E53019EA04655D",
-"00E0002028CFC9C05ED641CA16256146D89C6A13E75018BFC4AA015E1A000000000000002194A3A73270FD278083BDEED9EEA1432FBB734B30AC03FE056A00986EE603C9989BE05F57E53019E58CAAFA",
-"00E0FF3F40B4E0623D01BCBB9132CF7397AB6968DCB994CF92CA5B0825000000000000007FAB83D4AC18149A5BC85FC5A62BE9F0A532D3BC6BF7978CDFA402631DEFC64CBD9DE05F57E53019B5027C8F",
-"00000020A2B4ABC88EA141AF029FBBE784A44027D43B03DC925BD1A62500000000000000169C42588FBDBB7A31875AA74E209991FFDDEEF9DEBD1F8F4FA84736528D368683A2E05FFFFF001DC73C06D2",
-"0000FF3FD1B0180BEBAD048AF185C8731AE55ADB36AE4DD25D5AB7F790D5170F0000000074DD756323CA8EC2B6F8E93429AB6C0AD83DF075F6F596268082AC874FD82921C6A4E05F57E53019803A67CB",
-"00E0FF3F4D555092A938C203E2F9116CF0FE2CDB7414E81E7A75358D0B00000000000000EA53376809CAA0F9F3F4380B23A236533B18D7921BF8ACC6FB6EE69B98905A30A8A6E05F57E53019EA022D50",
-"00E0FF3F21C61A328673B64D1F6647C0B7B625E79B6DE7571345E5C60F0000000000000069F5C1FFE1B8FF03FC2ADEFFF5EBCE4C56A5DD9FD2A70B92BE08AC8BB6AA9ED1BBA6E05F57E53019F9441C29",
-"0000002077FFD0BA9EE33B1F8AD326A316203A1045CDE03E5DD3D6A128000000000000009F18730B5BC6A980868DB6D64EBBA89A6EB280B98C74DC5EDAC15A6AB3A810F1C5A7E05F57E53019C0054D8E",
-"000000204BAB309D09ED98BC51858460ABE811534DB5916B0567FB1B2E000000000000002D4CBF1E3B711311C4DEC25213721A504BD39CDA948E495E1F57FF0A62B1F5EB47AAE05F57E53019E78C5ADF",
-"00000020286DC4D4C367217A5F0FE22269F9B6E35B81520180B5D4D0150000000000000036F00387E9BF546872E4F64D1404EE40742813BC47EC2FCF15F644518972F11B82AAE05F57E530199B23A084",
-"0000FF3F134CE0B04DA94B968176EAE78E1E75F209962C921B368E252B000000000000002207C60242B14C67547ACC2F2A8EB542FB6A899BF8FB0473907D966CA2A8BF6F88ACE05F57E53019319A14CB",
-"00E0FF3FD22D748DA693B0BF659A3216BB210BE35BE9095F083D47670500000000000000301F0BB6DD092EF4B5F80F52B834026D1E3BCD5BADA275FA55EF53C852E16EC338B0E05F57E53019F887CDF7",
-"00E00020013D56B88743419E4988AB531158B6D5A01048357526ABFB1C000000000000008ACE1EE557303C897A29BEBD737851A54008B68BCAB42C743E506EED189F0121AAB0E05F57E53019203ED5C3",
-"00E00020552603EFA68F9581D50B8CC5B7F76BC12005EF541E3EE6AF0700000000000000AB4D428095605F0D182D064D74B10C34108BA20730C4E1FDF49DEF10D4287C0D9FB2E05F57E530197FC250C1",
-"00E0FF3F7E57D2BA5E3412AAD0C741777C22A136795283F710C864732200000000000000FFB16EF14D571EEC193C9E638A3091D9B614F9AA7E227DC8CBE32288B7957BB6C1B2E05F57E530195DBFF6F4",
-"0000C02016B5642B26CA7AD4F0FD916EA6AE3AFC032616BD02DAB8EA0800000000000000EEB8BEB36F39301F4B195BC80A8E9EBB2F5543C6ADAFBEAD86F6489803C42DCDCBB2E05F57E530191278F82A",
-"0000FF3F331ECCCB5C954A1BA8B928A51D30086C6186DEB4CEA5ACB230000000000000001ADBD91702835A9C0696A3DAE5FE8759CD1A587CFDD153BF314D1D997FF2742E77B4E05F57E530192BB71CDF",
-"00E0002030FDDEA599375BDE33B561B622CABB33B5E7FC9FF99EA5B1290000000000000072FEEE2AE0D512233274184B780FC3E0CC96938CC6619356B5B00C3264E2E4A02AB5E05F57E53019F9187985",
-"000000209CD943B7E4F18C35375DDD89C6F969C058A8C5568E8F8BC923000000000000003A40AEDC577857D788BFD3C391F5FD1E991220087FDD5B34A491E14CC2A3C8FF72B9E05F57E53019E5601BFC",
-"0000FF3FE7816E9E65AA9FCA17AE70F1FB488C2C933E6E43397E0E901F000000000000005E70B45B4D9BDBBE30686FFCEABA5E2F3B94A0ECBB457714CEB4113F4DAED2E70ABAE05F57E53019951611EF",
-"00E000206D5A46D9A5DBB76D6549CFBB8B84B951613E865A4591276612000000000000001722F2457D69BC73A785165A830F3F2151A45E58E454715918425B4C486900DB24BDE05F57E530193417FF00",
-"000000201770E776E3A243C0F93064AE80CAD132B43A3E6513570D20260000000000000090F5C97C460B027C57EA0333E229BB1D8ACF49A907C5D498F00C7CC49BCF96BCABBDE05F57E530197FB602F3",
-"00E00020A107A94CA4861BB5537C4646FEEB19D702068CC10F3BDA881000000000000000B2DF22FF5CD0E9DA95C2FE4AB80718067327F66CEF18E2A77951EA53684EE112B2C0E05F57E53019CADC52A9",
-"0000FF3F61ACB48F250C92D8830AA556F78E23BDD62FAA109C731D2B1F00000000000000C9D4C72F56237CFF4B1648C4439BDA504710C9A0977ADE950C80D71C8339A71EC2C1E05F57E5301915B64903",
-"00E000204901F7D1B59A4673264F7EF6C6D702A263B75AEA585BC1E00400000000000000E7131B701FFD4BDB3A783CE743D73A7E8399CEDCAD91EFDC1627884775C201D44FC4E05F57E5301948508D25",
-"00E00020B7591B94E069B16555D37D43607906745BB589462B4F849A1600000000000000DA43D56CC4EC8CBF12D72CB5B016671B9D3C46BAD716B5F2F5BA4B4719BDB04164C4E05F57E53019D741E871",
-"00000020B5D0FB3E7CA3581A0FF4DA8FBF505F4B1F394ED03436FA6A05000000000000009B3FE59E934E16EBC8415BE740ADBA9E1D34B9799BE58586FD00DD0773F1663B2FC7E05F57E53019AFC02E40",
-"00E000200831E57D46DD91220E5C3244904FA3BBC2DA2148B855CD4204000000000000004C8E9F75E78465617648CB006C0317E8D9929038EF6B0F2A293B59B8FB1C0D9126C8E05F57E53019FC1A98DD",
-"00E0FF3F04C776B6496653463F25F5F859414D01DD005F9E0081C8011100000000000000FB147D39D82A102DA667819F49B894900A3042FA52D6A6458E3CA29C34A24E9389CAE05F57E53019069E2E04",
-"00E0FF3F462DD01841811675A5B60FC2E78BB74A5A6C177C79ED95472B000000000000002563840EE5613026C200FEBC5902908D04055CEC4F884746038504554D7366D9A6CAE05F57E530199EA973B5",
-"0000FF3F8675CE587AFC2DF55D4511CB42F99408E4BC0B0A030C515411000000000000006F87BF076F5E8CE8B167D460EB91AFE74E69D8F6A4E61C55437D3C6CB04DDA0C14CBE05F57E530192426E7C7",
-"00004020AFF73BFD7CF965250410CCDDA0E78E9FA4D8838E583D867F2600000000000000C8A3D0B0AEC4643E2607E3C0E2BEC24E31FD328F774F096A8E687F153D6AFCE020CBE05F57E5301987049EB1",
-"00E000201CD2774805CA49987161D73B932DB5ED4FE5DE57621A06591700000000000000F441C9FA90D227D2D28C3398D8678497CAE10468C8537CAA596B1875BF0E083644CBE05F57E53019BAB42262",
-"0000002044AB851CB44AAFDF773534C8815A37FB23D3CA4374144540120000000000000088C4C17D8C0100904EB1B606B7A687272249D40D4CEDFF35F099E78053175996C8CBE05F57E530198322B994",
-"0000FF3F88115FA0D6567CD4C98E69B180FC23CD340397C2708E00822F0000000000000059C4958FF0727A009AF51CBBE8F1958129FEA2992F94C4F4B42501702F0CA203ADCEE05F57E5301922ED5F84",
-"000080206A86C957DE79D85D9BE17A2895B0F060F01B6E20F25D6FB91100000000000000039BEE9D4669D700B3BD3B10C9FBF5C505EE6E235F930C0B6638A72F7CA822F807CFE05F57E53019C00E9003",
-"0000002041FA639982D9B37B6D308ABB4F0674F401EF139753ED5E7A0A00000000000000FB1F2590FE9C5FCFC997A69863A95D19D5595723C08A9BCC720A1C04769942E6B7CFE05F57E53019E0136335",
-"0000002009CC0DE3E69F5F0668100A28A8B52C0368BEEC937A31BF391100000000000000E061A451C20D0F07D4E765476A9BE14029A0891D3CA9C688621E98E3AA4420A3D3CFE05F57E53019021DBA2D",
-"00E0FF3F28B6717C5ABD45A845B2766A8BFBEC88E252484772BD01D32B00000000000000879FDCA088C62EEFDD2429CAF7EBCC83C380B408D1278044CE0A481DDB5C38208FD0E05F57E53019F1446738",
-"00E0FF3F6A2F49084058A4B09117F4135E1549270A7B5B5CCAAD71722B000000000000005E3305289B5B6C042380B844EE94749D96ACDE6BC12641B637CB056DB328606E70D2E05F57E5301920D9AC73",
-"0000FF3F77C286C2A6517D75F7E2A03A0D6E3C6C0C92EE98F8B8B04B17000000000000001F39FDB4373D003BBD254ED2BA05BA95D5EE72A9B1831A49E9878265EBBAC31B1DD3E05F57E53019DC82B55C",
-"00E0FF3F1F3C16596F4557FD5BBAA490270795C8E0A2E1C686801AC20800000000000000DEB9E9D754C994D8D6BA7EF09CDB5A25D214C5B83CE5157B9C576C6A5B63528733D4E05F57E53019F99B9583",
-"00000020477987E16B15EF0812F3482681909C9AB28FD2BA15B94FA106000000000000003D673A36A9994F21503BE9C9B1FFF732B102DCD1DC07F002A2C679B0824018F1A8D5E05F57E53019954CEFED",
-"00E00020D936ED422BE25FDA47893DEC148CB1A9D7DB01BFDD5F4AF3190000000000000072E08AD1249B1B51F02F827D7900738F0F2AA267FAA87C992BB07C90B65C4B7361D6E05F57E5301994B1A978",
-"00E0FF3FD2747ABCD020285B18011C952919BB54F04112FF5A01FB8E0B00000000000000BE26A71F2CE830F50FF297BC754EDCA6F1516CEAFF09CC0BA390CE9544D8F02354D7E05F57E5301938D6793C",
-"00E0002095E21F073426B2B9D17BDECE0554B6E67E0CE2BC51D153C02C000000000000007791E62A0FBC1261B75CB2977215D607C2D0A8DD23FBFA281484BCC012C5D877DCDAE05F57E53019F5B30458",
-"00E0FF3FF76A093A9A646043816A882830D960177EAB5ECA0D26B1EE2C00000000000000786B03AC708B9E811E5FBAFAE3060C981FAAF374B20FC1CA828365D817BD70CC97DBE05F57E530192EB58CDB",
-"00E0FF3F16D7FF5E6F8D9FE8D57CE03DE7982633CC93D15F71F539852000000000000000274F1D6BB10681870AF2D3A2BBC8187F2DF5277855E583F4718F4993410C47724BDCE05F57E53019E6A059A9",
-"0000FF3FB9C45FDA4A61B6ABC03041543804F21129FD4A3F3AA1C60500000000000000004FB0D40DCFFBBD61393EED3AD741AB292549566DED95F689A51AC4A12F96465F66DCE05F57E53019A14EC07D",
-"00E0FF3F840669D9C6940F9A2990D7A2D329701F9B00A656CFBE429A2300000000000000CEEFCA15D9BFE9EA7239CD4A8F1E895E2BA1639BF258644F6C999ED6E2185065FBDEE05F57E5301949151C40",
-"00000020237363C760D21E3BCE125C23ABFA60719A8C4EF052217AE92200000000000000DF57EA6B72F0F2E19BD95CC91B5FEB51276E1FFAF16620557537609174A7B4942BDFE05F57E5301905CBC04F",
-"00E0FF3F16D0883782B8864B2208E2C8EB99F7DDFC1E4FC8219BB5EE0700000000000000923FC90E9073C38D76B134F7D2D9EEE16A68B7F40ABB21E7936E90B8F3D4DB4A44DFE05F57E530194111182B",
-"00E0FF3F95164DD7C4AAC4B9DC96DF6CBBF93B2C12C4BE420FD2A6FF1300000000000000815455EAA069C3D849489038A5A6152C4E7038CA005C6E32B64CC2DC665A0366E0DFE05F57E5301993A3EE97",
-"0000FF3FB903F3F726F69E4689161CAEBBA3ABCCE21762F8C9B8CBC42900000000000000E1D523AD1BC99DC16DC28DF9ED5475722B570A5D197987CBB3BC841B4630B8367EE0E05F57E530197D3F0EF0",
-"000000207BB18EB39D0038043865DBA88DF8969534201D81C59BB1F80600000000000000278C8571356130CC4318677F6BB6963F3584B92CFD4244977F89DC6AC96F261C9AE2E05F57E53019DB027FC9",
-"00E00020D51B6E93A89D015F5A281BD6D9BDAA96A816EB7A2B216CBC220000000000000099897484A2CCDF2474FB796AD77A6EC445914753182B8054AA48EF3604D84EB838E4E05F57E530194D2C3286",
-"00E0FF3F98F59FBB71B03E1EC0C2C6143BC93D9299B5426850C99EFB1400000000000000568667142CD2444F2505091FAFDB261A740FFB0CED18ECF315FBF8ED5689538508E5E05F57E5301954A27C76",
-"0000FF3F6F6C85AF3A981BE45CD6D974F36EEC5BE1E3FA9C2A18742306000000000000001C32A9F58B55A86A03880B8AB6C9925DD9F4994AD97116246477DAA66F5212EA48E5E05F57E53019563D6119",
-"00000020114C6D68DCBDF857D5E41E4F51DF206ECA7D53562F1755812A00000000000000CA6DEB61F85AB0641FD703D34665B40120841E4ED228E4F4EF97E6CD9A87D76F1EEAE05FFFFF001D134B1B88",
-"0000002099152064009A3730397901A49392A9B669285739994E42BEBC728A1B00000000D8F8A25BC59AE467CF712E64AE60F278D9C3EE8EB1C358A24070606BDBB840595FEAE05F57E53019E702FDCD",
-"0000FF3FCBB44D858D9FB2F219B74E7760B7EA689F558A3E6DC5DC110500000000000000AA9CAE251AB19CAF6AB12095CFDBD85F8BEF4BCF1817300E223F2CDD60B89277E7EAE05F57E5301931A8D512",
-"0000FF3FB15B2B9964F09A3BBC94751B63748AF3BCFA09AB48626A2C260000000000000057234225C75C6634C05F3C33B37BF87C44064BF4D6C069D3C2726A799C0B1EE78FECE05F57E530199A87B1D8",
-"00000020C1B6199D972490B7706BE236DB15880BFF9C864C37A1AD1E2D000000000000007C856B9B57F60C00FA42B9A56ED451FA115B01A2A1297BAE85FE7E0239CC145AC7ECE05F57E53019C9674667",
-"00000020282FBB15F160575E9DF8E4037C6B30DB8F4EDA2BB615DC7D1100000000000000B7FADEA3CE738B2243850F3390E0072B8A8BFA38ABC1317E4B6FD9C93CEF421CE6ECE05F57E5301999F4B029",
-"0000FF3FFF4F9E128C32DF043D0827092063A0D0561A93A03CCAFC5E0100000000000000FA2F847A6E63024D0708B12FC1859DAF026F27100A8872D45B2029696C63A69090EFE05F57E53019FD2C93A6",
-"0000002017045988EDC60DB4F87BD2E21F5D11EC7A9BD71FD1D192992F000000000000007421690664463BA860508D380F1FDDD9422670790B5F502004FDFC365B18A3C4B6EFE05F57E53019A3766992",
-"00E000205B740767B9828D3C6C4F77E68E354D233522AAC47233E6C8240000000000000016C006731B5454C2F38E55F8DE9743AF2CDA6E7A431A31F686DC2C73A04EE2DF56F2E05F57E53019B61969D4",
-"0000002049153958347D4DF17896947A6F782763201028EE28A8868E2C0000000000000075B726AC376836420D17C54B787B143A38C37E99E183CB35B76129B1E0E8D12804F3E05F57E53019ABFDDEC3",
-"00E0002045C1F85D495151DA29189106ABB0F4B8DEDAD09108B40F920300000000000000AEF77E9F0EF856C5F8A4AED93E8851B6E413513390D25723F54A9ACFD46C78C863F4E05F57E53019729DD553",
-"000000203C048BEDAC988DB08BE24E6C5704A00179C89DD2A80E0AA80A00000000000000C0671918CB698C82F60FB4FA9053E1B1805FB18EF82B4D633D50EAE381298BF560F7E05F57E53019509A86C1",
-"0000002087E090A6AD7D80FC2DD95A16DDC0A5D78349601C5DFDE6AE080000000000000076E524F88A26326204B7E897DB7D9EBEC1003002207674F767439AE28AC7C5C6F2F7E05F57E5301905C55900",
-"0000FF3FFF8A6BD371594A8207644D2C5FB9B56BB0445360F9EA72ED28000000000000009DDD0BBB9D458147FD3C37A9FBA372A88CB3028E243EB9A07112B76C75991E33BFFBE05F57E530198235AD79",
-"0000FF3F3F74926E4F3113229D5ED59DFC2C95C122D418C4AED4BADA0900000000000000BC8709B8A29FD3FA135BE44AA9B6DE7E9EE6B82A6B05E8F41B9432EFAE34661B6BFDE05F57E530192FD0FF3A",
-"0000FF3F2B979D927340DA2C8D53A289B72555DE9391594088066DE4080000000000000034B963C46FDE306A015E4AC3E659FCCED3C6CB9B465AD0034E5FF7DC0151EA477601E15F57E530193FE49035",
-"00E0FF3FA31F3EE4BA92F6871F8DF5D9F07AAC43D36E15EBFE7F09C30B000000000000003C198CD320580BDEEE4F06B8841E0BE4B6603F783D6C0240B69250DDB72A42158601E15F57E530194A097E04",
-"00E00020818900480A2C9AC4134360FA3F0717CC3079B10DF0AF27BA230000000000000053E44971F5738388871AB665EB476B74B837050C585850873E0577B7FD9D2649D001E15F57E53019281EA415",
-"00E0FF3FAF90D490CAB89BBA61A0CE0761A529F67C02DDAE09B384FE2D00000000000000AC3922E6862DA767BD7C4318CF1D55CC39083BFD9A8AD74E287F053C78CBBD5F9602E15F57E53019037A9BA4",
-"00000020F1F70ED74C7808FF6E21B0F15AE963460C267FC0871C9E2C2700000000000000E356F43132B2349C2E43D1100A2BECF51476BCB314B39ABD3D1F576B2E2B087E4807E15FFFFF001DB8C1BA58",
-"0000FF3F96951669DD49CF297CF62C3F4063CA3F94B929E4EBE4782B0B15CDE300000000535DFCF559FC40C05E8F1789A839395B12234A0426E84156F5CD220A65325EA1E207E15F57E5301977A3730C",
-"0000C02037F3E5B6341C4072116B6FDF946FBAEEEF12A4C9E8B3BA622A000000000000001F65EA358240AE441AC487892F3207CF90287644F16ABD3E50264A0B7EF953C82D08E15F57E5301920093F2E",
-"00E0FF3FD6AD22B7F5B12A39DCB3ED7C5B31A534A8B35F5523432B0E1A000000000000004547968F66FEA20B6C407E46B05631013546F92CE3EFF46F3DA40DEC1A2EA1C9A909E15F57E5301972537156",
-"000000205CDA0F2AEE160A7552FDB0B09876F95C346E436D519B181F28000000000000004160AA5F10D776A524FE53A9C010ADAD3C3B515DC3C8E9A06CA98C227826D6D8C30AE15F57E53019A5B7A5B6",
-"0000002037F6DBC65254872AB0AA5EB7645B6AFA2A80266A1AF8E150270000000000000013388DC90B2AD477283B69E49274315D0E28126FDDB4D667739AABBA0F8474BEC70AE15F57E53019D32EF9D6",
-"00000020D095508E5DA47F0CB37837DAB094D5C955F567899BBADB7029000000000000002A4CD4E1E2C4FA7E892E47F44537257E3C016AF267A0258047BA588CA36B6C0E060CE15F57E5301913A52951",
-"0000002078775C2DDB686D9FBEDDA870E9E016EFB1952593089BCD6D3000000000000000DE38A84C31324451D9111030C83FB425CF4364FD405BDF5DD0DBD3E9BCE469A7960DE15F57E530195E2EE91C",
-"00000020CF85DF5A0DE4363EFDC6B4F742D79469418E5CB51D8DE4951900000000000000F14A927289F78DC4C6A134519F4F3976BD68C516FB4E15A58BCC3D5AAC812EDA7112E15FFFFF001D8D9EBEE4",
-"00008020C952C61AE1685C49B1DFF92F9C768395E13947C9017408607128F45B000000001C5302DA5FAFEEB3A6FF81DAD7AA947EBAA3EDE328BF609FB4CBD2E24CEDB793DF12E15F57E53019A66F294E",
-"0000FF3F1CD30D1B851D0201069C95911751D53FB665E5E10C0892BD0D00000000000000BBD90E509AA6E42C9D0EA467B9AA702E478B6A2AB632C0F6842E429F9861BE4A8F14E15F57E53019901E359E",
-"0000FF3F5B9671E62AD3A32F08C533F57471132B3CD82551696262BC250000000000000035D0F2FD6AFF913DA32263242A2C7109265BF898DDB2BE399F9D14A2D16002CDB914E15F57E530196C63E90D",
-"00E00020388F5CA1860E095CF18714F1EAE50E49557BBF0B00285AAB0600000000000000F753820B13FAFA94313AB61F7A2B856EB806B3E69EAEC791DA70B0D5571D308B2116E15F57E530190251A543",
-"00E00020F7F563C13EAB61EE21642217C0CBD68A0003C96FC2F331350C00000000000000A6BF908C8A6DEB66A9637D2679BA5EC963B4BD011088AD7B1A78E542478217512F17E15F57E5301978B8BEA5",
-"0000FF3F228E275F2D801831B21E18B5A2993F4397C12A4587FAAAC60700000000000000FF439D288D4FFC2AA1D25B6E03125056E61D0BAE7C33F355EBFFFA14CD31CD6B2B18E15F57E53019AC6A5189",
-"0000FF3FAF149F24598B4E9F815EE2DB4B39E870E19DC5782F078E502D0000000000000070847C6AED2A35E915ED7234ACB43F79A421AA0954DDAE3F35C59CB749319BB9A518E15F57E5301932B5FF68",
-"0000FF3F5C69BBA5DB7EA524FFF4834FCAE5394A512D434DBBAEA0C61900000000000000604BCB32D7013E962BF60371C37945ADE37A734ECE8EF3693FDDEEFE2BA44CA2CE18E15F57E53019CC5E68DE",
-"00000020425CEA8D46084146209A8DFF3D93C6D945DAF34A434DF9662A000000000000001DCE0D1CB341DEF43AF461E1DF44F581080D67D5C86694B2DAF7C9C80D6B6A110319E15F57E53019FEC89150",
-"00E00020DD65C55312B4F43E8540818C2574EDD5CD71662C4DD4CFD121000000000000002AFC280205F7BFDBE7BB7F5426D1FFC928DEFD4A9442C3DC04A1549550019200E91AE15F57E530198199FD33",
-"00E0FF3F8A24777FC4DDBFFEE2D98FCC143C685F4B2C70E1E7A692E00C000000000000003857D7513A9778F95F779B26362189C0739C471B47F66A82C1233BABE3C6330E2E1BE15F57E530196392449C",
-"00E0FF3F7CD7070CD3CCFE2F916E73C9EB26321EF36FE8C433B3AC3F1500000000000000BDC1AD80D610D7CF015F55C8BB66062C3ACFC6098044525E96E71CAFB7E0D34BF01BE15F57E53019F8BB54AC",
-"00000020415EA6263B4BA0165F572584D6DDA5E93E5BDBF40ED5DA7E12000000000000006C061820C1676A4DF9D735B47CF85D49CFC9795F24E593D0AE29311B318179E6BE1CE15F57E530199A767444",
-"0000FF3F63F75CA6E92B2EEAE3246DCFF3279E569B571686B4BD3F1B1400000000000000BA658EB1EBC1364219B476F1585F7857A8D180FE99D4479A6F677BC83CB5D761461DE15F57E53019D1A32A8A",
-"0000002092773977EDB5B12D2760F3133053EB312CCCFFFE910DE38016000000000000008142D3F947ED0975BCCE1D0142F4EBC87DDF1FFBA040F6A704FFFC933C92FFED321EE15F57E5301986F915AD",
-"00E00020DFEB5BAC1A96E39F8620936606866E4D5912D019BD453FB10B00000000000000EC7A368DDC214C376FB1083843D3BA993EE68CC162D652D162594B1842BE82A92620E15F57E530198E6B4950",
-"00E0FF3FB24F979E3CBACCF29A59E6960575B27BE68B280C89EC0AD30F00000000000000161018F12375E1664BFB11602E69B6FD9F4AD9F7D7646CF47CE6C02068B80DC26F20E15F57E53019E8BF929A",
-"00000020F931ED6E2E1A8038AA4B8A191530E088A3734C5D1D7B4E592400000000000000EAE115DA771FBF80E1110AF2699E24565161682AB03190697DFCEECC84BAD2BAE520E15F57E53019B2B9E530",
-"00E0FF3FDF9E162CB164423483288D7E38797F29EAFB64548FB366B50400000000000000ABEF252067B25EE44742A55398E96679E5FDC8ED8A11113970DF55C8D9A84BE6FF22E15F57E5301984F6A84C",
-"0000FF3F76C80142A40277EC95CD7DAE2E2DBF056A2B98A8084D02902C00000000000000D7E679165E0B2B78318394332178B8FC3B08EA2FBA0EDD7D42BD6AAC4E91039FB123E15F57E53019E2EA0005",
-"00E00020DB24C0CADE19C1C6A990FB682059A15D045DB3A46F874F970700000000000000B259EA65890CC58F7AFFDADFFF321BE060C4CCE4F8E649EB79D1092E6B1E481AE623E15F57E530191810CB84",
-"000000209094DB3FF80558941CE25ACF91471D7B1BACEB6C41D025B52200000000000000B20968B971705704E25D8B2B0C7A6B03B6F31C6A6758A8BD683D54C0B5920E0AEF24E15F57E530196FA7AA8B",
-"00E0FF3F6E5ECFC66A3FA3D2164197878F55737EF9461B529B6DCDAB1B00000000000000E61A18AF1848B39C724B108D0CD85D1458CD9C8F00FF1B59F2B759C2A61747911528E15F57E53019CCC25A39",
-"00E0FF3F143F64A5050BD7FDF74AC4B51E714796C78A3E1E779803250D00000000000000C917A2E403F0ECE89AC6630B1BE7F4AE27DD0E89363A032246D209469549A1EB5128E15F57E53019D0DBEE4B",
-"0000A02080E5A9DB1D11C63E65619E7AD4B7693986C6558CA4D5418B2500000000000000E3C9D58F2CD20B0EF6CB6EDB864CA44076BEA2748F44F47241B37D96FF71C07A3729E15F57E530192C620539",
-"00E0FF3F2B5141D0DE80EABE5EBA44E6E8AC9D4D143D13D346055B9430000000000000005D9A41CA4A672C9660D545696D8F3D4951A3D4CFBF66339C6E4DA410096CAAC2E629E15F57E5301954C279FF",
-"00000020AD169D521FFF361DB2DDD6B97BB47F1D2EE4F503CB4998721700000000000000214D467AAE4CAD2C36DFC2BF99CD172A48B993D021D022D3547E420BF4155453022AE15F57E530193B780A69",
-"0000002041FD6E0DD14378B7DDF14FB1CA5DD9D1B6AD95C6E91F902B07000000000000008269F402C510C8C3AF814A8BF086801F020AB25081A6B5699CC0994ACB5B1F48682BE15F57E53019075D7E2D",
-"00E0FF3F5958E12DD953D1BC5E61563DEDC9E30492A8AE12974DC3252200000000000000F0062C1A1609DA1D12D93F87326112A1558439ADEADA55D270262856B17C2A1EC72CE15F57E53019EF0C98B9",
-"00E0FF3F76CA413F197BC6E4A9890CFD97C38730AA72683C3C65B7360F00000000000000F9E053E866690A47E4C8A2622CE0822D05C516C1408E384CAFAD2A30DD8725BCA22EE15F57E530191637CAE0",
-"00E0FF3F607328BDC4950799C8F8EB0860B35080EC9865CE7C20021519000000000000002A84F2C70FA8C6570FA9B9CD12CF40FE55572E517916D1D152FDF49F6422BE4D522FE15F57E530192CBAA14B",
-"00E0FF3F0745A71D5340B6B05DC06A0B5234C88792844BF596FFE7DE30000000000000003025DB55483FAB0C4A5915DE9045ED1CD5AF7701D26C38DEDAA7327884558240792FE15F57E530197B0B055E",
-"0000FF3FE0B893A2E64B626CD81B48D9719EE40BBFA8BB34243FF00A210000000000000083C696F71BB9E3737BD1FC69165C914DF2AFBF6BC9801BE587B4737457B76CBD7732E15F57E5301914AAC272",
-"0000FF3FD3BC4A89FFB0D50C973174A16C8657AEBAFA87E4F3A2B774200000000000000074B5931AD8A06CA8FE8CAEA8CEC3242BBA59CE5B4D7EC32AA92240116D196A6EAE33E15F57E530194395155E",
-"00E0FF3FA1ADA7A7CAF369E6AC0623F0C0B21E0ADA63A7D2F6B565240900000000000000AF92A6377562F0E3D32D3B48E4B3C20BEB541A3FFF995D683432B2789EB35492CD35E15F57E5301936898A1B",
-"000000202168C0D4894728B389FFA8F48274AD66F1AAD0007BA785112E00000000000000E75DA6403DC25833C66B5FEBB95AC328E95846E6D65F1F60AB626F80FE1E5F7FD737E15F57E530193825DDCB",
-"00E0FF3F181C6B606B01C5C9912DC2865C3C596A428C052191AF202711000000000000002FCE6E41453CDDC072700277C1F9052A3D236CA19F8945D6205CC9E724D20EA50938E15F57E5301985D52055",
-"0000E02034ECE51A5CD9FEF6376590BBD9ADBCDB23DE1CFEAF91B19F2400000000000000A5DF900E53684E55AB6B45B8C075F3D1FC659DE419F170B4C1C622962069F2650638E15F57E5301943D3F6FB",
-"00000020B701F4EBD9347FA1FA09E52CAE45A164C18C8D83927E7C662E00000000000000F46E66062D5CCD0AA597D7F7E24EBFB088C705456315F94997BBCBDF37057CE53139E15F57E53019AE392033",
-"00E0002080C33AABF07B4C4EF8E8301E2C4E615E8C2413EA2ABAE63D1E00000000000000DA46325E9420383386591C066CFB046A2666E0A422DAD7C268275700CEB5E6C26139E15F57E53019C01E5D87",
-"00000020BCA3A8F3C301AFED7AE23353118EB03B63E489081F423E3A140000000000000063FCEEEBDE13945CD9EB5AA97E775236B31686306D696777C814850BA2E869F7293EE15FFFFF001D040622C5",
-"000000205C45E628AA1AA4C328067D2AF9F015758FA2FBCA3C6883BFF9BA513A000000002508108774FFE063B21B5DAE6B467D798B207145EE6BBCD70BBD8579F97B53676B42E15F57E53019A90575B1",
-"0000002051CC09539C7F450B1BE871C066C50547AC54BF862E589A67040000000000000063EB56BDFA2264562955E9AE49A2F460B75BAA7E7D3F83B6D8CFFF1173216364F042E15F57E53019A22CDB11",
-"00E0FF3FFE363F51AA1CDE19CF940DD34111E2778B888B93346D3DBF1B00000000000000408F88DBD90680F1DB416B982D9ACBB6C685BDF6E9FECD6D2D89C11AF568E61F6C46E15F57E530194CE1CDCB",
-"00000020E8CBE536DE804B6D47794DA544FC5C6AB439B202B79CCF7E04000000000000004E44C24EB43BFD6CF8A331893D93A0CDA0FA2B543910C02C90EA990F3CFA95BA1347E15F57E53019D99D0E1F",
-"00E0FF3F2A61C9429F927B40C1C26355EBE185589D00422CC0E92D492600000000000000EA6BF754233F70AA5E4E1FDC01D0AF2E748D1594CC552E4E44DCE43A01F890EDAD48E15F57E53019AB568ED7",
-"00E0002050D8171F826B9C4CF1757CE4EA41B8BC913CE0CAF37BBAC9270000000000000032F1C8257B134DEB88984FFF947F07C8B38C69704270ABB040DC7223650CAB9D6649E15F57E53019EDCDE9BB",
-"0000FF3F34406015C629B23C0CA756B22E450C9188073AEAC2AA0D380200000000000000E584D5F83BA176DC77B1BAFD589CA0064708BBCD186A8440F039A987A9956AEF7349E15F57E5301957C03C18",
-"0000FF3F3BAFADB2A6A585755CFFF66F6E8FFEF0A613957458D2AB5B0C00000000000000F6BC59EACAB6C6497887029446245665032F0E21C5BFEA04A7DB9D341DD6D15FE34AE15F57E53019E0EA1967",
-"00E0002090741B8ECE5DEF3E204FFFA930BB8750F7A2C9195FC961401500000000000000D4BF97CEB269F26CDB39DC85D340057A47AEB7E71EF64DA7B062892595E2464E614BE15F57E530197D56A45B",
-"00E0FF3F739F6E27BCFC795DAD73C1D94BCC3800219D8FAF4E8029092D000000000000006183E257352E37B3788E5FD2A7C014227A52D3034922E62E654416EE4A87684B694CE15F57E53019779F2197",
-"0000FF3FE512E5A16D763CC9476B40DEFC36221492FD7E93FFC0D0FC2F000000000000009BA2C9E320A7A9AC26F9C3E357C3B5455B11C585EFA6BDA294E35C8E56F78AC3984DE15F57E5301955248699",
-"00E0FF3FDE4AE9541D7B19B99201109C1478B10CC3BACE05B365DCCC2B000000000000008E42FA23E957F586434BC1E36D7161DDD62A1BD4D4742C43A64ADBD41241D901064FE15F57E530199ABE8CDC",
-"0000002050EB5E2D73F4CFF6F9AD5C2F7DE15225EE15F27818EDEB943000000000000000A929DD139859429964727CB6D21E798872BE272843BB426686924357153BAB175250E15F57E53019179A242D",
-"0000C020730DBF6C67D2DA9BF28B29BF0EB0C0710A0367FEE88E32150D00000000000000256B345F3B6F31DEDE33AC2A20E669274335D97D04AA326BB2A7116F9AF79259BE52E15F57E530194924129C",
-"0000FF3F396C34AA602730E87FCD03178E1353D1A82C1BA33B087A0329000000000000004F69A379AE571896FF70B4B60DC86A266D71B3B2D6929AC5B723E64A8146CF623254E15F57E530199F85D894",
-"00E0FF3FEC81464C8F14F3030DF4AA1999C77C7A8547D1D3B5B202C02000000000000000D6713A860FDCD01668198FAEA0375056E48CA2809D624706E3F90777DE1F593A1E55E15F57E530191B274C4E",
-"00E000206E6B771DF572C3AB2831489172929636678B2E79F6238BC417000000000000009601B1B5976F53151203224CE860CBD26524D90239CC392532CE27AADB3F94D48F55E15F57E53019EFA42297",
-"00E0002095EC81ACFA123877C3A8ED16C2300A96C48AF9CED70ED526100000000000000064516EFFB9662DD057AF3EFB66FAA9BACC7589F21642D1A1FDDE5DA69EA2CC004056E15F57E530198338467B",
-"00000020262B6975F67EA15F1C145DCBE058D079D767F9CF42A8BE661600000000000000EFF062B7837A4E2FF39029ECC975C36B257EA75C7EA9AB42307D82F7B3AD1576E858E15F57E530197B4612AD",
-"0000E0209EA2B9E5C8CE4826A1F0DE56FF954E25707CDB50BC19335E1600000000000000CE90D8066F60AC8973DD0FA2B1B3A2F17B1E4D5C8A8C3154D87A7ACC21B27399FB58E15F57E530190CD56406",
-"000000204D8E510A0B0AF3FB398D04761396E6AC74EA0B91B24A2F782400000000000000F36F2D3ED69C1B2775EC121EFE8FD61ED0BF52E8D433E5A423353C79359E246B7459E15F57E530198A434973",
-"0000002069BCE2D1C2A64E1EF06077EE868AFEED966C47267D5840FA0800000000000000F73D5B405749CA40D2390234D5691A7DB3DD1F117E29F6FB3BB8989923A919DD3B5AE15F57E530193AD4DFB4",
-"00000020137A9162A33D50266711E32E34AB25E2A6BCEFDF0BFA83672F00000000000000E282426BF518015A08EC90D3278C4799DEAA185C34D78981B3760C20901344D44D5EE15F57E53019EB28F9CC",
-"00E0FF3FBE35B436054054BCD0B89FA32FA5414E4C61E71BE51C78AD1A00000000000000391313F4A480F69E26751AF404FB67E8BFCDF0CA07A18EE8213C6DFB9C45E14B575FE15F57E530193ACFAC22",
-"00E00020A62B2F538441CEB6E2CC6D2E20E8B4808E6C3BBDF37C3B8A230000000000000002932A0F086057FA4F282A9BF05B7763B22266619109F80E3F1D11EEB47E6D9C7960E15F57E53019317BB256",
-"000000206061D20082AA82C01D0F4D66414A6ADA7B7CBF0348EBC6AF080000000000000049A545870518D81BF18170EDCD601B06EB8275234B9F93E5A5101EA5B788ED192C65E15FFFFF001DF69C4529",
-"00E0002058015E0B4A824B75DA11DC7D6FE05D7976B4778C2A558849C228428400000000C5CD4729706EAA4A14FC93441A28EC1378B808A585F42B46AE56404D81F41DB57166E15F57E53019371B4F51",
-"000000208D5121378232A0B4BA87282549A8660DF5E2C4C762F46A762000000000000000D425A27BF56E958D2E21D80044D8450D5B4DB99494F1DDE61579E5570C79233C7467E15F57E530195A3FCF65",
-"00E0FF3F52C3433CB28A6CE59C22C054064858794394935F0A8668E01D00000000000000D5BF66B34E1B660039D7C6DA066071CC0BD40176B3DC529098F313AA6A8C615D9767E15F57E53019CE36E9DE",
-"0000FF3F3775529E5417632623B2503605ADF27CFD9A06E8B7A4B35E070000000000000031BEBA7E8492AA99C6EEB0197599004A2F2682DFD2F4AC59B18C4B3C52766277ED67E15F57E53019DF45E20C",
-"0000E020D45CA531C84C9A86F61B640C5B54450B5DD8216B3CD23139140000000000000055629B67DCB5870B39D606F344F90EDFC530D246EF03951537FE8F3992A3022D1769E15F57E530190423203C",
-"00000020CFD908D0C5333516FFC54201001806879FB87EF6F43FDC7416000000000000003CD632B861558B4F74B6531F96A3995F6A78599A093304F86BD5975AA4FAD4D38F69E15F57E53019373A8FEE",
-"00000020105023CA4621C7B637C528E4B0D3BC8556ED79EDBBF0241719000000000000006364B2D028A4ED35451FEE6E32C6D3DD1475B7697FC3ABE593A4354834004D29516BE15F57E53019E149792A",
-"00E0FF3FD11550B694D6EDC923CD145A9729E3CEE6879C7654A30F8F2600000000000000464BA442E209343A61E0CF14206EB0CC4376F6E8636EAC9712052B0952A8C1A80E6CE15F57E530190F83885C",
-"000000204F23359FA03355CB5136AAFC6596CD7BE60A277A799B87291A000000000000007B6861DD1F5D2B96B4F44553A71B2759CFDA10E2FD8E448A0C2C681223B6FF92C26CE15F57E53019EECBD324",
-"00E00020723218D0D0D31991FD3B8E9A8D8FC012013330BBCB1EEBFE2600000000000000C694B5B22A305BDFAD65F2D69DBE334D4D6FA91A3B579E172C6FE0865B57537D5B6FE15F57E53019FAD9FF4D",
-"0000E020A42C6B6FA61A9B39F166455B4A270ED0B3B7ACA2797EFFEA1D000000000000001B62FE353A8A0FF46A9149B4ABC0EBA722E89EBF425814D2A36C35FEE6C35ACE736FE15F57E5301941C69A59",
-"000000200D752189F6334B1A55867B035653BA0CABB1412D7EEF2EAE180000000000000004BAFE19B4D55A437B4C865D5A6BD97CFEB4897A50AF8741847A95F50236D3ED2670E15F57E5301984921D61",
-"00E0FF3F52CA76397D8D357E99ECA06F2B935BB92BF7E550028DE00B2B00000000000000F0FC8440D0191A49355962D12C458D46F9D85D085C1A356376A950CA297FE4625672E15F57E53019DF79C105",
-"00E0FF3F1BF08BE6609405B3AA98E4BE9C2C1B2C35D64201476F937B05000000000000005F41996BEFB552700D93C04D7758E96B3BC52F46A0B145F7B652323ED8BE24579273E15F57E530198224BD03",
-"00E0002075E82FA054D35CB6F84F03A58E617A571488D0D559EB292E050000000000000041D3D092E6ADA5BBC03B839176D2FC2193BF9C87245EB00A0FB83504B7C5987E7C77E15F57E5301962DF2421",
-"00E0FF3F62BF712441B7AD5A3A5A06207057C4B23F1EC1C1BD03EF011400000000000000584496CEE6F5A40ACB8D41288676DE2BAB11F40D83C473C655206D68C558F385F479E15F57E530194430DDB9",
-"0000FF3F0B442D187CF7E2FE45D94300BF9DA726D62920516AA9ED6330000000000000005F4C138614ABF9065499351C1321E51D0B96E557FF961178BBFEC94F1F7E974F7E7AE15F57E53019FA1D9184",
-"00000020871927078E6135473B1AC3BE8F67730C2E6BD1B35FAFB76713000000000000009A82C017A9C211C969229EFA0ABC51D422718330BA406A2B82B1B173DB3429ED497FE15FFFFF001D7FA8AAF9",
-"00000020DE4A48BCDD41F28653C738B02D6E925C54F45382B0B77AC104F29E1900000000445F0B5FF0569F59F4A13057B6E63251237C555652257190827696BBAF4DCCE47780E15F57E5301955F007D5",
-"00E000200E4A2CE3072E1BE24761F1C638054A32E0CF6B6F122C946612000000000000004EB929420EE9B3AB271F097E3A5718E3086F9A350FC0811101699C4255172E307681E15F57E53019CF71660B",
-"00E0FF3F24F502957FC38C79C0FB906D5E4DF20FB46F917BB40A62ED26000000000000004934CB5B6868F54AFE7003FE7D0F9A1124725F174697B61EA4A56266B6F951099383E15F57E53019F76D23CF",
-"00E0FF3F6775D1E8191AC992B939F297DDD7C75B81A19AFBDF51C78A2900000000000000B06AC5450851D585FE0141686D757F095F3322AA0269D66E466F432237B86B0A6D85E15F57E530197A89B3EB",
-"00E00020C42D5E9106BD5BFE840FF50E4BE4F3D777CD35F6C355A17726000000000000006D1ECFFCDE35B4782D7131357A4FA27E6391B294F81C9150F37FDC838447A68FDA89E15F57E530192DA5339F",
-"00E0FF3F25C08630E6C514EF44860F170615ED1448F2A798336EFFDD140000000000000089633A6C3CD3AE772CEA32F404A5A168766886391F2145C816793EA06C2C68B3678BE15F57E530197756A733",
-"00006020DA46F12925634BE7A8FA6E71807D156981AA7925B7C3F3B81300000000000000B8D5F02CA3ADC78B18442F72D611C4C872EEAB429FA4CDD2D30B9878BE2B58E0B18BE15F57E530198B967EFD",
-"0000FF3FA60F6A58509BB3ED896E834A598814ED867C3A4D1D0A70BD16000000000000009A9EC54E6DC6AB943ED27B1BD33F0452308AE8A403AE8B4F961E50FEFA8A1E41218CE15F57E53019539FE230",
-"00E00020B3C9E21F276BB021DB0501A376A634D4E43F499FEF671B700B00000000000000CAC29FE1B60C781FCE40E22FE9A7681AFF2E70B6F9A03186802863DB6AEC76F71290E15F57E53019E3BA02E4",
-"000000202013521902FE81A4125B2DCFAF1E05BCC6C37AF9A187C0100E00000000000000049EF152169386F9B8EFFDEFC7D94519261F64036608B3F39A939B5FFA62E1475490E15F57E53019CF23E80B",
-"00E00020A204AE57970A72325888AD8762E83ADB0FF8B2F91560EF842800000000000000BDC47528A63F5BE30209D1E9C493940793FFD912311ECF1E9954595F562DD1879C90E15F57E530199A663582",
-"00E0FF3F85F85B59FB4DB6C57A30FB8A3B9BED23C526AF0F266FE93D25000000000000002B339D1D69AA0F07D3DE6318C5CA9BCD42E7F6B7A3BA7E35F01C2A8730F3C8B0A690E15F57E530194C0032DF",
-"00E0FF3F0BF403B4147582B4E36D17D3B6282E942B78DE402BD08FEF0000000000000000DCA904DAFC638B209D571570EFC69A1E41FFD482A064B06D19EC1B1244E6848C9391E15F57E53019309C8A77",
-"00000020EDAB40BCCB20BE17CD93D3D16466CC6F8FB33C1B464411291D00000000000000E359564FF56520BB70F2049EBF9BEAD2EE63D2C59569F6306C239CAC86EFADFB4E96E15FFFFF001DBE649102",
-"0000FF3F0F157E17D673ED4EC79AED383CE0AD72DA825CD5165C26E7EC839F9900000000054A42487A1F07709F76C08B408E106A4308DFD2A6A96E0955D54869F1C0524B5A96E15F57E53019968E5D42",
-"0000FF3F4F6A08251E7A04E00577F991B50627C9DB9C11E83358538E170000000000000062DAAF59216142E3237D1BF03B2C3DB39510AD98082206C53B030905A9B6D087E796E15F57E530199BE05B5F",
-"00E0FF3FE9555A66E1949B79E8AF3514CEE3F8BE5007B4C85FE147610F00000000000000717219E59594C982E7156DB1DBB394ECBAAD958F857B413FC2B0DF839DAFA1933A97E15F57E5301916163FFC",
-"00000020420CB2DA023DE1F84862FEAC68C70B1509ED1818C304CE0B01000000000000001D5E72FFB7EE0C986319C458C3D995A7D8E9C093F37761E66D6FD1D690261801CA97E15F57E5301906E9E771",
-"00008020BBCA392A702F393E6658BE748803627BF774EE1116B201242800000000000000D320C4BD7F198736D7B243407015FEFC4404A4323DB39D6B960910F69E9D647D8F99E15F57E53019964F7B3E",
-"00004020EAF30061A1805DC6A6926E935F3C0B96D39CA0729C683A7D0A000000000000001E2C94D393A6F067CDE6F251139F1DC95BBE2A2A407B65DF6BD66ABB0F67F7CDC09AE15F57E5301967C2148D",
-"00000020828B5BF241133F58D4F312C312C1E20354ABD1B71382327C1500000000000000460E1D7370BDCC82F536B792F068B4B333D418901E6BFAAE5C208122F0542044CA9BE15F57E5301959C15602",
-"00E0FF3FB49494E5A640D3AF4A0A20917C05FEAE89C4790C7B2591472800000000000000B6554063CFDAD302204F8AC4C9B931E9D3393A0D85E00B097649FAC99A3A991A2A9DE15F57E530193524A102",
-"0000C020B5B339A70598896F60A437A1EB3B7C2ECB31F4F88E13FC550400000000000000637390775BEF4602BAB40570674918FCA342E80C76443043F86739D2D0724688F49DE15F57E530190A57A1AE",
-"00E000203C671C997D27D887DF8B1E9B1F8165E02D2CCB21BA19424E13000000000000008F0B0476BE93060D990E230842B7C1DF0D2386E3B5352D7277CD94269B93FFF900A0E15F57E530199E5E5D2E",
-"00E00020C38DFA14A6FFEB3FABA9FD3F49B675CFF05246F6AE4549CE0400000000000000988D1118A86EF4E54CC306B9C85F3F792A08E2A1A4391A4AC442A45C8B8B1310C8A2E15F57E53019F845FE6F",
-"00000020D6C97E2241BF697BD28A7B535C0EAB5A8A129754360E7D3C2C0000000000000089ABACBBBAE72E70685366FC14C69385B6D21431AD49559A74557FA380E8E3B1EEA2E15F57E53019F9C63622",
-"00E0FF3F3805B5BDF6B2A3602C6ED2F629136E497262EB69036A8CAE1800000000000000E9EA1E4F88D808F9885B96C5F4C90FB01803B8ACCF25F2271CF6F5C45A60C66E62A5E15F57E530196F54ADCD",
-"00E0002045C7FAF2048CF9B7FF1AD781049F62330D6C32301DE41AF50000000000000000857A0CE4F029F8C381CBA7A210B2F8829BD78726E07A00913ADA62DF0EF050BC8EA5E15F57E5301980006717",
-"0000002053510BE523B745E5AD5BA3D04FF22CA750EB2F33BE7CA0AB1000000000000000B3966F124490C825716C51201B60E25A446F535ADA9CFF8787649812F6E795ADD9A5E15F57E530190AC0760C",
-"0000FF3FC0C9CC6F4FBCA534246C4900A9A778BE83D32CBAD603763C0B000000000000007CCA19D2F9F2ED360415197EA254F589FE08C227D20D48A7E579C47ACCEBD05EB2A6E15F57E53019692FB48A",
-"0000FF3FAB2AB45B55D2A5A7BB4F2BFA6C3ACD057A9B8D25B4FF4CE31D000000000000008CA0D0A3811416E155C034E08CEA30B8017544FEA34559F8167A0A13F342D7CDCCA6E15F57E53019B1360A41",
-"000000201F85E5B73A95661213C47501DF84C58B52F7577B7CD989510F00000000000000A75DE50DA940CE81A6049A13B2150AE5F779897BCAE7126B74A34433ED8E647AF2A7E15F57E5301934469BD3",
-"0000FF3F900F6341724DB4E1EEFDA23474B5F3774595A68E8AF1E07A1C000000000000009DB0A449A73B9DBFB6D74DFF7170BA5FD659764963E0428B1CC9D463ABB8E55E7DAAE15F57E5301934671177",
-"00E0FF3F64317D2B48BBAAC736F3C3822C1BB906048F8824C560B9CA1D0000000000000095B122966DE74D84F4275A80CB1889F42392E818C3D509BA83A5A9343B0B198F00AEE15F57E53019AF2D223F",
-"00E0FF3F1FFE89AE165E0D05844D664F7665796D897557E6296A660C2F0000000000000045A1FD0F0A8196CCA8F6B1576D1B3BA002EE46807AB1041FD2E787F18D5E908219AFE15F57E53019C05FC3B0",
-"0000FF3FA5C085E14634E100E1390FCC684E05783C6CDCDF7A5AE1A113000000000000007A004447C4663803115ECD7BD7FEF3ABCAC154B0767212BDEE66CDAD36B0DE333AAFE15F57E5301943019111",
-"00E00020578762E8B2CA0C4502DD5FCE88F56A6D8F5FD11F4227CBB9280000000000000071B03748C54A8F09965E85555DC79B280B6AB4496E261DC90A05DE5C149D6C7B79B1E15F57E53019200A41B9",
-"00E0FF3FD061C079658DCE2E7E3F831937AF4BC4B1F8C862181436F02C0000000000000098FCB972EBF5B710020F08E6D3716BBA30AFC087BA73799629966EC2F1073D2810B2E15F57E5301942F49720",
-"0000002092ADD46EF33D8B31A8CCEC164C133D9553427E1DC4023B951A00000000000000CB9D709DCAA8B3BF1CB818226021F21563F2EA6E3AFEC29D41993AEF204375879CB2E15F57E53019EF13A019",
-"00E0FF3FEA2A029F5BE4FF175B7B7F1625BDF394D51D07FB1E13D556180000000000000019DC76241109FC0F2619B37E7D685CF3AE71D0C92E404EBCCD4110CC8C027760E7B4E15F57E5301981726E47",
-"0000002025AD851503D52EAF8D6497F4B47C74338D2B956DE30F753021000000000000009396E6B427D3759C37A5B3C83F2D3A6DBF8AA190170D62BC226514AD07038864FAB6E15F57E5301957085F52",
-"00E00020147D06C2C70D9C30E9E6A75A3946C4AB86DEC6B089ADB2470A000000000000008F076E43CD12947641C2796BF4372300EA6DF4F8BC7E1C42B58561F3570B584575B8E15F57E53019CAAF1545",
-"000000208F5C4163408896C9ABE309D1DB48C5A756252960DDB918CC1600000000000000E9BBD58C948600D5AA1A3BC8BE8071CF0754E28E37C41B426557A32B6719A69DB6B8E15F57E53019E60211C9",
-"00E000206B9882F665645CB84F0CF7E58A76AD14A2CE129F46AED3BE19000000000000000191B60E99534F8289B0B1220FF8DCAB139D8FE00966E734042EEC296E3EFBEA75BCE15F57E53019047C4DC3",
-"000000206BA323456216E80C9AD3AAC7CC90D109C234A8BCC0B3AC571E00000000000000669505F8CAC9E052EEAEAC03B4079FA768638DBFA50D2501437EDDFD7500162126BFE15F57E530191022CC35",
-"00E0002042AE33750C2854B3639FE576FB48D1A66E08204CF3DF08B404000000000000009386E0CDC1AA5D5C5B797FF64020B1A60953003EFBA52DDFBBCBCE8BC965FEC453BFE15F57E53019E64F85E3",
-"00E0FF3FBB199097E6F146E33AE0064737049EEFDCE0A6BEB47AB2C408000000000000004255B4AB1DD855652E5FD2D871BFA098B17234C116EC45A7D797EA4058530046DFBFE15F57E530197FD6A302",
-"00000020D6207670355CEDC0A4F876FE7BF987695BCDB4886FEB0DB30E00000000000000D517C8A0873065658A5C2BA1D67BF7AC41D1E02260577A8518AB6E3D5D2F1A57D7C0E15F57E530199D8EDCAB",
-"0000FF3F4D8599ADAE385327AB2969B58696C65BE29D07045F24346C1F0000000000000013C6676621176C7FDC0477A7C201CDC94D75BBBC23A38E722597E39B2BC3087F59C2E15F57E5301976222F34",
-"00006020FC81B9D9F4736E8F1E1C82617173CDBDD7AAD9AE16D2862C2A000000000000003D49D4F1015D113F23EE3F90201CFE4AC5A9A197E303DC134AD9DC4F0543A14DD3C2E15F57E53019494D3167",
-"0000FF3F8CC1BCF99112570EEA38ACFE6F95CF30BFB7FB7EEB787343060000000000000062FDD3738CB5204392BC5CE2552CFCB42251C8440A73D3EA59967406EA97C22066C3E15F57E5301932590B7E",
-"00E0FF3F7A4174F7EE9CDBDC969A41EE4803AC2E9635FF306E9850861100000000000000BC2DA742955D8CC48EB4BA5253968285E3FDE6C03332B7BBDD28481B044CE4739BC3E15F57E5301990A93046",
-"00E0FF3FE3C2F65EF29E97000B8B070418788C7E842E251DB11C515508000000000000000ED6AC4642FFC8FFDC27AA29DC3874827A18B99C46BBABDBB1FFC184449B8E34D3C3E15F57E5301948FF4BDE",
-"0000002088FFDDC790E4E70B5DCA223D420DF644608446198E99C1E012000000000000007A6FBF5C930AE4247229951378A4E489D6A99349BF9D41FCBF34FD83F25B60C459C4E15F57E530192892FC7E",
-"0000FF3FABD4B7B16993FEAFDA56D560CEAFD54E4BB6C72226B295E60E00000000000000A83492FF8C6ED32E1F1F432264F910DF948650EFA496542789238040AE784E7D0EC5E15F57E5301943DA04DC",
-"0000002088FC631DA5661F8D2F30E2F7003B3EEA987CE74442B845261F000000000000007D28F695C55FB73396688F0FF1D36C9D311A5163F44C40CECE4E14582392555D95C5E15F57E5301966761EDD",
-"00E0FF3F44DF9090F6A67A96FC851E4FA95D15AAB69CF0E6EA3684B024000000000000000E48D1F005A2D5378D4A38747ED2B07F375A261DDF67EA1BDA3A5E8A9B4AED8BB0C5E15F57E530191CCA5536",
-"000000203317F73FDB6079D83E015D743D8DD3D3F43D848532AFFFD91800000000000000A806C725F46EF39DD661A74C6F87177C89E4D2370095A0F75027332774F55E9270C6E15F57E530191B8A9664",
-"00E0FF3F9609644F9EFB25CCCE4983514E8FE22245580AA64F96F3BA1C00000000000000A4CBD055A9570BF7B085D8E10CC33EDBD468AEDFDDDC8CCCFAF17AB90CE508CDABC6E15F57E53019F4EA20A5",
-"00E0FF3FEF4F0A8BD402048CF7699BE7122E20A768F94653417F0DD82B000000000000002130C20BD8819B90E1E935D63AB9EF572F0515CD407991422DDCBC24F20DF33C49C7E15F57E53019CC0C0004",
-"0000FF3FF649F1C58B15BB5313EF30BCC009707B5EE77119B2D21B641600000000000000F71B8AF832A28A1CA7D064187EA4193B6687F86297F294C2BD13EC508DB3B847C1C7E15F57E53019369026EA",
-"0000FF3F0369C6CCF6262A927AF176A27F96F0DCADB653F87F2BBFC718000000000000001EFF6193F58E1BC1C0E4E93F438453640DAE7672CF7662F057821CEFDD141E8381C8E15F57E5301982A68DE3",
-"00E0002028F4A9F01F1999E58EE8CD8A46F1DDC0763F43278541BFFD1600000000000000AD14BBCA04A770CD2143ABCD6B5290800C4C29AB976727897CFAE9F24FAC45E711CBE15F57E53019407BBC14",
-"00E00020CCE387F2CC4DF73A20B63FBEF75E1CAC6BA9A6DA9C8DAD680100000000000000FCF11FA52B9AC6D63A758D5973F058B7A88AE8058D739792DEFDD6B2AE983857CFCBE15F57E53019B27A7344",
-"00E00020CD5898E1FF19C06C9394297FE6423B831D3135F42D7D4FF7020000000000000002E5CA9FBAE42A61B00C98361CE869A08C8ACD87C179F18500F4A8C15C53014902CCE15F57E530190E3B1F6D",
-"00E0FF3FF1A91C0E49C91B325CE6A4A36864FE955CF7AA772B51793A1400000000000000B54A37383C6F07192773F1B6F523A727B635CACB4162A3E2531B4979789CB69BA0CCE15F57E53019248F872E",
-"0000FF3FB6A187973AFB85FA4AFBDE56280FCE59A8F77D64EF6B79C22800000000000000FE9D49615BE7828A397A538803402ECC765E4C18970880E2EF48F00264F05A0AA5CDE15F57E530199DE5E396",
-"00E00020FA69AC2A5143D96B65DAB13E34587B5B94847343FF67690D05000000000000009773F1DCB71C729FF23EBA5ABDC814116E66F05ADD483284E00F17C894A6EFFF14CFE15F57E53019B9117F8A",
-"00000020BA19DF17DC1824A7222DE124AA1422D3E5F074370F5EA35900000000000000003544644EB6B86974EDAF6371D5D57F0A8130DB330A5B824C919B4865EE74A2CDB8CFE15F57E53019C2B56AE0",
-"00E0FF3FB7CDCE1595717152E9B959F140B4809B37713B9AED25716E1D000000000000003E546E3CE5813F109438E56C3C74B2F7B1B3797FF023EF0D59EE5AFF815C8BABB7D0E15F57E53019D1EBFA16",
-"0000FF3F952131642198301B697967EF1A7B275E07643FE4D15870760700000000000000ED70EF57D12FF301B4CDD15CFE41395E4B7A61966888A37BFDBEBA54B2B8046557D1E15F57E530196D634D17",
-"0000FF3FCB637724BC185E05CA44FAB42D498727511EE88D9980B10618000000000000003415881FA99673F3795A5574FAB772A82FC09C93DFECE320EB446C6613DE25E1E7D2E15F57E53019D19FEAAB",
-"00E0002068F7DA308909308BCB2E39DE6568C19CE9EEE932FCD2745A2300000000000000E63E7D960C1B097FEEEBCB7CEB0F4C52D98564A9D7B9F5D4A9CD783377090E639DD3E15F57E5301991B4CECF",
-"00E0FF3F39A8A1F9FF89F34CE361BD4FA07FE62FFD68FDC5FDB8BBB229000000000000009136A1436780580DAF6D4EF559E8C1CDD1B7F9B07F6493DEB39E6FB9EAEDC53DA2D4E15F57E53019E1AF9678",
-"0000002010D5501B6BCF27AEF00852D13D69DB2AFD1136DA7C116E2C0A00000000000000368E736AAA81ADBC87A38B2079B06C6BC81CC21976A5868442700A5D4991A60145D5E15F57E530194F4E7CCC",
-"00E0FF3FBB41B7A9B70EDA75720A572B3E3C9D681EF7F9C43B95079E15000000000000005CECBD37B9E4A65504A9FA65241D2725940AC71CE88ED1987A938E31617A20DDABD5E15F57E53019B6CF4941",
-"00E000202303BE9E9B004BF7492C679E32C5F1DC3C8C6812392C793A300000000000000076E954488F8858CCB72042619F07FFC0E8C342D579CB44B4C26321868A1DFDE773D8E15F57E53019CC39B46A",
-"00000020F29A7A517DD300C6FEE13E0BC6DA9BAAFA2E0CFA617120331000000000000000C402435E34C9EC31F1A68F47B7FD0CFDD63C6AD586033B3CF99FE62325668BAAF2D8E15F57E530198932D123",
-"0000FF3F937A72CBF13EC7D77EC5FFED645064337349A21DBB55E41F0C00000000000000BD7AC77D240F19B7E854913DA118DB6C13B1FC5AEE06815B3B4881182F1AA18A0DDAE15F57E53019E75DF37E",
-"0000FF3F1E7F59D9DCAE1E05E2A26DCE52C17B198CBD231035C08CFA1B0000000000000079AFE4E014D8F10D37A9BF41136E060CB6FE9AF578CE185F4C2D1193D1D8579747DAE15F57E53019CB500039",
-"0000FF3FC27FE43D569DAF3222AAFF0086E52127A9A7CC261A2DCEEE0B00000000000000BECC9E4534E8CC424F2ADE8A24F1B031950737A87ED7FDAABF871AE7862768D482DAE15F57E53019CF3D2E25",
-"0000002009E27B40116C4B9D86E981CA2739B3DA5AA3006AD53976AD0C000000000000003E010E75D181CB899D40403B04BAD3DE13D75ACEBFFE88E0509FC1AED07DF1A3C3DAE15F57E530193C739154",
-"00000020ED971A803EF803B06502B46847A6C46BD52315CA931AA9E614000000000000004A9D4780685B436B44915B19B13B3C984EA58B277C926C16161618BB344DEF7375DFE15FFFFF001D74387418",
-"00E00020DA0FF4AFDF4E2E8F44B7279DD244A624D7B171A70298B71C3DC706E1000000003460EB5760B7F019E091F28C5FA0CA3B96C39D9BC1E82142E7C96DF80D8454C9A4E0E15F57E53019C64CB8B0",
-"0000FF3F88FC22092BA992A6BEFF4217FA756BD052A1107841DBF3E507000000000000006B5E5D9F184DE870C30A617A57FB37AE04352B154B8335487840F423A9F95EE415E2E15F57E53019BEC033C4",
-"000000207980A2FD176E7016838244AEF665341F8C86CFFEA42126F30300000000000000B3EE9A1806D5C85F1C8CD7BFB028388C4753A98921F295F58731A05FE3833E3ADCE6E15FFFFF001D1E8AB9C3",
-"00E0FF3FD778516B5F5F27581125274CF9F34B6F6D9CF04165883A61E25AEEF4000000007E869DF7A0E4B1336BCDDCA0420D27EA4A91E6AC232C2BFFD90056404FDF0E6EB5E6E15F57E53019793574E4",
-"00E0FF3F6B6EAAA9E38BC0CCAFB1F171A27DE268546613D8AF347CB10A00000000000000DAE11C4E9566912E2DDA5E9090AEE17FC66AAFC4523CCE02FF0C72453E1CAAC32CE7E15F57E53019EAF088B6",
-};
-
-
-const std::vector<std::string> testnetVBKblocks = {
-
-"00114A390002D35CC8D2AF793FFA03D142788E46C2E8A85A663690EA99759301000002A4F2F3547BE0F9567A19EE22B99E0D8ABE5FE0F85B04211E74AAAB428281",
-"00114A3A0002134D71B94939EF53DE4373948E46C2E8A85A663690EA99759301000002A428F18CFB82035638B201AA36AA6D7F9C5FE0F85D04210AA2AAAD277DBA",
-"00114A3B00024D818663BB7B16BDE53DA53E8E46C2E8A85A663690EA99759301000002A4B788E1ACC1C2242F04C800DF25C3C8925FE0F8650421B54C0003604D42",
-"00114A3C0002175D008AB539BA1F27265A298E46C2E8A85A663690EA99759301000002A4F97D9373DB27114FB3A4159DF76434D75FE0F89E042240EE555AC0BE2D",
-"00114A3D0002749011D799238483B64B66A18E46C2E8A85A663690EA99759301000002A4453BEE2E9E942F12D8661F69005A77035FE0F8AD042191960000661F6A",
-"00114A3E00024409D6206949CCA2701E68678E46C2E8A85A663690EA99759301000002A475BE280824F538A8438871E4318D55C55FE0F8C30421F2B95555CF427F",
-"00114A3F0002CBA4E45DF48882437967F1CC8E46C2E8A85A663690EA99759301000002A4D062EE19FC32E1E649C10ACD6FA101735FE0F8DC042225545556A1D7DE",
-"00114A400002D036BA80CB8CA86A0D3C88F78E46C2E8A85A663690EA99759301000002A42DAFD85CFFAAAEB67064BD9EE0DA1A0A5FE0F8EB0422448B555D140115",
-"00114A410002D13B0F68898ED2DE6771AA8E8E46C2E8A85A663690EA99759301000002A4DF33FADD8C4DEE6DEA3DE61148C9674A5FE0F9360422A068555F45E0D7",
-"00114A420002AB29DD03CA38432D6C92699768898ED2DE6771AA8E8E46C2E8A85A663690722D3EFCFC1E277D21F7FB0830C6ABFA5FE0F9AA0421830DAAAFF56B93",
-"00114A4300026235CC80B36CEBE42BDF11F068898ED2DE6771AA8E8E46C2E8A85A66369001786FE7EE017C8E09E79EB851CCA29D5FE0F9CE041F96E600016C14A1",
-"00114A440002FBEEF9ACF51F3179B79BF26968898ED2DE6771AA8E8E46C2E8A85A6636900AE82B8C2FFA7BCCA508A21D678538485FE0F9D2041F7B755555F78BA1",
-"00114A45000211C466E924166E63159F69DE68898ED2DE6771AA8E8E46C2E8A85A6636907AC3FE7F27CB75A4BE176AD346C0B4945FE0F9E604200A6FAAB03D1DDB",
-"00114A4600029192DB50BB0AD1EA24D0285668898ED2DE6771AA8E8E46C2E8A85A66369021DD2B0398C479CACD4F10C5E6EF86A95FE0F9F9042042630000A79516",
-"00114A470002A993E3B6E14A0FD55F50149168898ED2DE6771AA8E8E46C2E8A85A663690F56F398126CBD5BD6F176FA4DB3215C75FE0F9FE04207FCB00024EE7D9",
-"00114A48000207590C613F2B8312C14E56AC68898ED2DE6771AA8E8E46C2E8A85A6636909DFE972FC75608B9DD57241111FC02DA5FE0FA05042110CA00048DBEA5",
-"00114A490002151E2F455332015CEA0C25BE68898ED2DE6771AA8E8E46C2E8A85A6636903A647ED7E17DAC832F70F74700AFAFA25FE0FA4804219AFE0001253521",
-"00114A4A000279AEA51A62D10312C1687BBC68898ED2DE6771AA8E8E46C2E8A85A663690B9B660D3D6ED44D16AA925444C56F1135FE0FA610420BD6C555C0AB7F6",
-"00114A4B0002B4DE71D311E8885A51DCBD3D68898ED2DE6771AA8E8E46C2E8A85A6636902CE11FA034B3CFABD190AAEB546ED1425FE0FA730420DCF5AAB45A7560",
-"00114A4C0002EA67BADE3EA4375ACA14272268898ED2DE6771AA8E8E46C2E8A85A66369088CB0C2FED5D80C3D509CBAAF269B1075FE0FAC3042124BEAAAB723D34",
-"00114A4D00023347EEE66C8D14DCA3DFE73868898ED2DE6771AA8E8E46C2E8A85A663690A2D40BC33419B961C28D3EB7081E15EF5FE0FB01042006D9AAAE768384",
-"00114A4E00026451FE5FDC402AA5049BC7A368898ED2DE6771AA8E8E46C2E8A85A6636908CD1CA3E6A2ADA76BBB83FBEBC4C6B295FE0FB43041F5C7E5558184D6B",
-"00114A4F000288FE1734E8D731B9FE6ACF1D68898ED2DE6771AA8E8E46C2E8A85A6636906B27EB9AFB7E19CD4A0AE9419EB0CD5E5FE0FB4B041EA4E1AAAB996912",
-"00114A500002568EBB1A834C3864A46BB20368898ED2DE6771AA8E8E46C2E8A85A663690ECDA5BAAC1135BC6A9081254AD3C8D6A5FE0FB4E041F1780AAAAECF79C",
-"00114A510002E17A96D880838C7F79E0507068898ED2DE6771AA8E8E46C2E8A85A663690972476D9A945A02B81C322081C1593D05FE0FB5B041FA653AAAB3BD091",
-"00114A5200025BA386A53ABF3110D500F9C568898ED2DE6771AA8E8E46C2E8A85A6636906CF4E25E91957FFD2F3531194512FBFE5FE0FB6204200393AAADDD78B7",
-"00114A53000277DFC305870ABF11B371180968898ED2DE6771AA8E8E46C2E8A85A6636901378C1B661F13CA2C0424E67E74B86E75FE0FB8204208562AAB0F22B42",
-"00114A54000255949E944E7566B234DF5CDE68898ED2DE6771AA8E8E46C2E8A85A663690539E02D79AE8FE1F0A3B9C91D7A0FAB05FE0FB9304207AE95558462FC2",
-"00114A550002FED0E7F939E490D6EA2F9C9C68898ED2DE6771AA8E8E46C2E8A85A6636907F2B953A67F1FEB89751B7C71D7870495FE0FBA00420C2F3AAABCEB13E",
-"00114A560002CF164C4B1C8B9B67AFEDD38EF939E490D6EA2F9C9C68898ED2DE6771AA8ECB338EB01FB3E76DFFA001EDCA15695E5FE0FBEA042127AC555C1763D8",
-"00114A57000214D020FE86D5D9F450A899ADF939E490D6EA2F9C9C68898ED2DE6771AA8E493F8EDE728C17DD1FA4BD24BE44B9E05FE0FC1104202BA95556A016B5",
-"00114A5800025FE8BBB64F9A83F2E70CC9B7F939E490D6EA2F9C9C68898ED2DE6771AA8E807F86B7996EDD66E78926DD12AF54BF5FE0FC16041FFBB500012BB799",
-"00114A590002A3598CE128B6A3D67B466D86F939E490D6EA2F9C9C68898ED2DE6771AA8E633779BEB275E24203FF559C849F4D4D5FE0FC3004208949AAB43A4F9D",
-"00114A5A0002057A657968B561F14DA06C12F939E490D6EA2F9C9C68898ED2DE6771AA8EE99E1B994D4AACD4AEEF93595E073FCC5FE0FC8F0420A0D6000241D56C",
-"00114A5B0002DF10C208639C998C48DD5DB4F939E490D6EA2F9C9C68898ED2DE6771AA8E9CD71B53E3462DBEB313BBE0C6571CBF5FE0FC97041F3B7CAAAAFBD907",
-"00114A5C000277C0E1F6E99056EBF4B19637F939E490D6EA2F9C9C68898ED2DE6771AA8E06415E25D818FEE2DB770D8F96AAA60D5FE0FCA4041FB6B1000993FD82",
-"00114A5D00029EB722209A3D41A3114A3957F939E490D6EA2F9C9C68898ED2DE6771AA8ED7D7D46F45F822AB4DDCFBDCE099181C5FE0FCD5042012ABAAACE6F5F0",
-"00114A5E0002D212F267737F45FD3C428EFCF939E490D6EA2F9C9C68898ED2DE6771AA8EC22FEA6BFD6C79941AE7EEE48455DBD55FE0FD05041FABA4000292B39E",
-"00114A5F0002DE01EF0DED4E49A4293B5D75F939E490D6EA2F9C9C68898ED2DE6771AA8E4F03FF4037A5B5AAC0781771C6A54BF85FE0FD21041F4E68555A6E415E",
-"00114A600002261873A938919C624AF85240F939E490D6EA2F9C9C68898ED2DE6771AA8E03F429636FC45CF21D406D0AAB5672025FE0FD2F041F5B66AAB39D1A8D",
-"00114A610002EFBF8A983F257935CC952E18F939E490D6EA2F9C9C68898ED2DE6771AA8EC16F81E8E91F54F6BC50E976C602305C5FE0FD84041FB151000017FE0F",
-"00114A620002F2A2D1229A235E035FA9D930F939E490D6EA2F9C9C68898ED2DE6771AA8E04E01C8CADE5CB69D143E9EFA4B0CFAB5FE0FDA0041E9286AAAD6F2D3D",
-"00114A630002D95DCCC18B54AB444E40D4C7F939E490D6EA2F9C9C68898ED2DE6771AA8ECDD5A2E67EAD6841CF4B088D76CC0B975FE0FDA9041EA0A80003AA2B13",
-"00114A6400024643DDEE1BEB27BA08330089F939E490D6EA2F9C9C68898ED2DE6771AA8E8DDAD5853AFDE095D919B363EA44DAA85FE0FDB3041F0E37AAAE8BF2A7",
-"00114A650002D713F01B746CE302BE5E8D75F939E490D6EA2F9C9C68898ED2DE6771AA8E0603E4F73AE540B1E887CEE7C003C2525FE0FDD5041F7873AAAE106AE4",
-"00114A66000255840098039FBB89BA236DEBF939E490D6EA2F9C9C68898ED2DE6771AA8E33B155D3110A615627FA8C5F7629F6555FE0FDDF041F62C45556FD2D59",
-"00114A670002AAB786C67A2E9247AF40F38FF939E490D6EA2F9C9C68898ED2DE6771AA8E568752AC2F0547FA4B8C6544C80219475FE0FDFA041FCDF7AAAD74C68A",
-"00114A680002DDB27AFFBF52D16867D8E0E1F939E490D6EA2F9C9C68898ED2DE6771AA8ED05CD17DA5DF9A930646F00540E043EA5FE0FE18041FD7AAAAABEBB361",
-"00114A6900025CD60CCFF1E23180B877472FF939E490D6EA2F9C9C68898ED2DE6771AA8E6C228B74BD710356C492882DB23B22B15FE0FE27041FD9455557AFBBAE",
-"00114A6A0002DC9359FE75B9ADF6950AB64CCFF1E23180B877472FF939E490D6EA2F9C9C8ACAC01AF26F19C49E31E45C9C7069EE5FE0FE3604202D8400022B63AB",
-"00114A6B0002818316A9D541C904EEEBEB20CFF1E23180B877472FF939E490D6EA2F9C9CC3F95365279129022AC92D92E428532B5FE0FE480420807000001323E3",
-"00114A6C0002EC54FEBE5A0C23EFACCA1E94CFF1E23180B877472FF939E490D6EA2F9C9C9D21D825507625FE2802194A465CFACC5FE0FE490420C3C40000BEBFB1",
-"00114A6D0002871DBFE7A067723BA9984315CFF1E23180B877472FF939E490D6EA2F9C9C9131304B40F2CBD6AB5FA0CFBB8449F45FE0FE6204217183000061A81B",
-"00114A6E00022D868AFD3926A89C9709C610CFF1E23180B877472FF939E490D6EA2F9C9CD4C3E6F7B5414D0CBD0046BDD7CCD0CE5FE0FE7104218D39000743B5AC",
-"00114A6F00029E323F073F3F791D4A26B166CFF1E23180B877472FF939E490D6EA2F9C9C4D60939C384DB62CAB7B9E3E10D1970A5FE0FED60421EBB9555A7464DA",
-"00114A7000024D99E893DE614A2A8BDD279FCFF1E23180B877472FF939E490D6EA2F9C9C5F85A0E1F96D86180384C80D3DFA74305FE0FEE5042041DE0003858E19",
-"00114A710002E848B17D7C411CC647E0A444CFF1E23180B877472FF939E490D6EA2F9C9C7C091A422F9EF2B270DEEA635E45AE885FE0FEF70420970C5559434098",
-"00114A720002DAA219B7934C5EB7AE73276BCFF1E23180B877472FF939E490D6EA2F9C9CB5DB26B9AEAC891C80A0400B1FF1A6245FE0FF070420D91200013E11CB",
-"00114A730002A736A593651FD319FC13A934CFF1E23180B877472FF939E490D6EA2F9C9CBCF8D39E05793D5055CAC60EAFE5CFC25FE0FF0F04212A7CAAAEEF4FDB",
-"00114A740002333748051F12F7D414C71C79CFF1E23180B877472FF939E490D6EA2F9C9C2A93EF99FCC292BFC984AE5C26EC78BD5FE0FF1B0421AEA65556B89CA4",
-"00114A7500020FDB8E7E1E2A6A6A33E4AE6DCFF1E23180B877472FF939E490D6EA2F9C9CB08FBA3542816E1243D7EF2161FECB055FE0FF280422184AAAAC350018",
-"00114A7600023417E7D8EB6B9490C8466BB1CFF1E23180B877472FF939E490D6EA2F9C9CB3428F9FEE4548CDBC04EC46932D6B115FE0FF3404228298555B31A15C",
-"00114A7700023E97A3D52C410D7E10A99C4BCFF1E23180B877472FF939E490D6EA2F9C9C429D13885160C88EE1A5CEFCD5C3AC9E5FE0FF5E0422F5CB555B102546",
-"00114A780002AE7D23B763CE6840FAE4FD13CFF1E23180B877472FF939E490D6EA2F9C9CFA8B2CEBF0B36EE8E1FBF86AA8AC4CCA5FE0FF830422A621AAACF37BB4",
-"00114A7900021058562B89FBBB12ECBA914FCFF1E23180B877472FF939E490D6EA2F9C9C4568D082BEDE6873C56600722BE20FF65FE0FFA404227777AAABFA31B3",
-"00114A7A0002084802710630B358F5ECCDBECFF1E23180B877472FF939E490D6EA2F9C9C4117F84741763FAFC5F72C85C444446A5FE0FFC9042260EEAAAC0E6980",
-"00114A7B00020477070A4621AD7400D0359DCFF1E23180B877472FF939E490D6EA2F9C9C1C8D0D8430214333D410002757554D885FE0FFD60422332B000015D1B3",
-"00114A7C0002B34D4B44EBA03180DDE85BFBCFF1E23180B877472FF939E490D6EA2F9C9C746D74806E79760C7BB89EE8FAE14BFC5FE0FFDB04229DDA00002CFC1F",
-"00114A7D000215C27A7DDE79A5D685F608ADCFF1E23180B877472FF939E490D6EA2F9C9C58B06B8E8743D999DEDC3F7B7965597D5FE0FFDF04233C190000842D27",
-"00114A7E00025F908D06B48F45877A88A3D27DDE79A5D685F608ADCFF1E23180B877472FB67E1EE8E33F49092B8EBF3A2A72AAB25FE100170423E7A75555BF4229",
-"00114A7F00025EBE51B3302BB58CBDCCFC407DDE79A5D685F608ADCFF1E23180B877472FD2436167B0C3CF8C1D7FF791570243EF5FE1001C0423354D0005AD1DCB",
-"00114A80000233B5E5EAFF315EA61034B77F7DDE79A5D685F608ADCFF1E23180B877472F85533C7D4782DADDFDA4C10FA0A962965FE100430423DC94555663D08F",
-"00114A810002C8FEED8404BD70B3D97806E77DDE79A5D685F608ADCFF1E23180B877472FD51F24C838F11DA1B275476DD1DF59EB5FE1004604239BEB5557B42CA4",
-"00114A820002AF5809B4C10E03F058DEFE397DDE79A5D685F608ADCFF1E23180B877472F3107D36C07AA19AFFC4A55E23FB3BCA85FE1006E0424543F55579612AA",
-"00114A8300022C66965494017A6263F51C4D7DDE79A5D685F608ADCFF1E23180B877472F7D2C4018AC1BFE1B06B20C16E4C0DA7C5FE1008804240D3A55578AD6B5",
-"00114A840002EB14261484D4FA016BD7F47B7DDE79A5D685F608ADCFF1E23180B877472F63758D7355AACDFCE06885DE84DFF4D55FE100A4042429AF555C0A991C",
-"00114A850002E1EF64A0AA394D85B4085EEE7DDE79A5D685F608ADCFF1E23180B877472FA02F10E0B53CF05A24DC8C37CBD9EF075FE100CB042437BA555738E8DA",
-"00114A860002025EF31C2C7609584E2383267DDE79A5D685F608ADCFF1E23180B877472F5B87EB0EAE3D9E6ABF9D117DCC6011215FE100D00423F870000205910F",
-"00114A8700021D8A11CBF96DAEEBE670CA3A7DDE79A5D685F608ADCFF1E23180B877472FBA2C307B090CA9B9E7A10543984B6BF05FE100DA0424A4F000008BEC4F",
-"00114A880002D7E04928EB478D3CCDE34E437DDE79A5D685F608ADCFF1E23180B877472F63E36E8266DB1812542429EC8762F46E5FE100DC042531E7AAAAECA2B0",
-"00114A890002CF0BD7A615704D315EFE64F17DDE79A5D685F608ADCFF1E23180B877472F1FD47EBA67FB0A6804B6048A6346537D5FE100FD0425FC8BAAAC186E48",
-"00114A8A0002A6A575D503D9742FF90E6C1C7DDE79A5D685F608ADCFF1E23180B877472FBA2E8C58925D9C457C9FA52B5E2E17D65FE101020425E37C00030B34D2",
-"00114A8B0002AA755699FDD4D12D228BC5167DDE79A5D685F608ADCFF1E23180B877472F55733A7CC467D76AE4445B01515B8E9D5FE101200426A1CB5558AC0F78",
-"00114A8C00027AB2A64326724E2F46334E9F7DDE79A5D685F608ADCFF1E23180B877472F6E03EBB65E11C2F7F09C9192B8F0E6ED5FE1012A04269EB6555827DFB6",
-"00114A8D00020279BA114928349B43F5C5987DDE79A5D685F608ADCFF1E23180B877472FF220E277A4CFC4CCF03BBAD2572ABE495FE1013E04273B58AAAE652100",
-"00114A8E0002A0FA854632AE3D5C373314E77DDE79A5D685F608ADCFF1E23180B877472F1A0694FB25CDA54E0C6F66162CC0B3375FE1015F04278AAD0000586259",
-"00114A8F0002473DA2452160E4CBC9C7A16E7DDE79A5D685F608ADCFF1E23180B877472FD74FCD2E5C3C976E29E9D934F4F55F845FE10177042770CB000B202642",
-"00114A900002C103CA90D25AB23D33CAEE017DDE79A5D685F608ADCFF1E23180B877472F02F80D1FDD7B9388064E8BFFFDCB51B15FE101AC04279CEA0005C3959A",
-"00114A91000250D838B3B126DF64ABB483E77DDE79A5D685F608ADCFF1E23180B877472F277D75075C80FA55C6776F3BFAD4C6BB5FE101BC0426E77DAAAF93A1DA",
-"00114A920002EC00AEA92D50F79191808B3AB3B126DF64ABB483E77DDE79A5D685F608AD58115FD6B3DBEE0E9087494A774363AF5FE101DE04275691AAACC9EE8D",
-"00114A93000261A096B4F5739B4B6405D409B3B126DF64ABB483E77DDE79A5D685F608ADF8BBB36C7F1B30A05263D017266844425FE10229042736545557765E94",
-"00114A940002A3E0544094A26E585749185CB3B126DF64ABB483E77DDE79A5D685F608AD5F513384FB34D44FBD096BD5CF65BBAE5FE102300425E474AAACDDFD09",
-"00114A950002F47FBCB919250A6825AFA0AEB3B126DF64ABB483E77DDE79A5D685F608AD47EBF4A18EA7DAD0022D1BD330D25B8D5FE1023704268FCA00033707A4",
-"00114A960002477DEAB5EE1777085C396498B3B126DF64ABB483E77DDE79A5D685F608ADB80A4061C4D430A8E660EA3827B050065FE1025704273E75555C3D2FFA",
-"00114A970002EA345D58233B002EB10921C8B3B126DF64ABB483E77DDE79A5D685F608AD5DED62CE6523DAA9AFE536766D3AB4F65FE1027F04272B75555812CB60",
-"00114A98000237AC918DDAD8A75469C8A9C0B3B126DF64ABB483E77DDE79A5D685F608ADBF5F4CFF89DCBF6BDEB81EE08483FA225FE102870426E01AAAAC61FC83",
-"00114A99000292891D3E1F9ED26BB4147CEAB3B126DF64ABB483E77DDE79A5D685F608AD12161BEF4B2A004A1F095460060FDB165FE102A204278B9B000213BDAF",
-"00114A9A00022307D48A011FEA09289944F1B3B126DF64ABB483E77DDE79A5D685F608ADB62419766FDC97FD36827BC16C316E0B5FE102A904279F0600084068D7",
-"00114A9B0002F830C74234921060FE9E3410B3B126DF64ABB483E77DDE79A5D685F608AD67A323909037C468495394A6E91F4C915FE102D704285661555FB88115",
-"00114A9C00027175F3E474C1A1E96A2E6B9FB3B126DF64ABB483E77DDE79A5D685F608AD5B2CF6143E89730D237E63B241BE153B5FE1032C0427D4D8AAB13CD6B5",
-"00114A9D0002D80631F1498CF5FCA0B0B87DB3B126DF64ABB483E77DDE79A5D685F608AD7A695859F679D7548229BD846FBDAFBC5FE1033F042637B2000078133B",
-"00114A9E0002E6C806F7A294C7DDE2E1D188B3B126DF64ABB483E77DDE79A5D685F608AD08C599083755D2FBDB162010252C653A5FE1034404268CC1000264BE7A",
-"00114A9F00020A9CCE8E8CBF8913D1EEBF99B3B126DF64ABB483E77DDE79A5D685F608AD5D6902A7F4020B2338D9D71E743CD91A5FE1034F042749BFAAAB7D1357",
-"00114AA00002FA96A0B6F6D47E74F34459EBB3B126DF64ABB483E77DDE79A5D685F608AD2792A0A73BABE1F3E0F23AD38DA72FCE5FE103690427DCDB00026CD6AF",
-"00114AA100027F75EE55D7A341D44AA3ED63B3B126DF64ABB483E77DDE79A5D685F608AD9F38F14117C5A95605788D9E56F007195FE103710427F8E400056C4655",
-"00114AA200026F57A7FD6E58E3CE5C2F50A7B3B126DF64ABB483E77DDE79A5D685F608ADA015D56199A4496B234A36D2D64933205FE103980428AA74AAB1DC9BE1",
-"00114AA300021FA017BA3AF71F29374E4662B3B126DF64ABB483E77DDE79A5D685F608AD1A84D1BCC7FD842489B09463B85FDC1C5FE103C20428608EAAB5A9B25D",
-"00114AA40002B7DB49B8D42843619AB57916B3B126DF64ABB483E77DDE79A5D685F608AD5C04BF82FB7244FA085C0537A970B5EA5FE103F7042802E4555E3CAA66",
-"00114AA50002F09E2FC690E40B842B9C0071B3B126DF64ABB483E77DDE79A5D685F608AD5EA622F84C464D40512531D86D2566DD5FE10423042753F9555D5EDCEA",
-"00114AA600023D18E5009EB6894A036CE48EC690E40B842B9C0071B3B126DF64ABB483E76AC44EB589FE80A253B36007D946542C5FE1048C0426EA2200022B3324",
-"00114AA70002C68665A544E08FC40D23BB28C690E40B842B9C0071B3B126DF64ABB483E779C7B9DA6F7025FEA3749FC0C6D9EC5E5FE104A70424D7AEAAAF39198D",
-"00114AA80002C9C6B6AEA36F5EAAFCD433A2C690E40B842B9C0071B3B126DF64ABB483E7F160B9FF4431E8EECD101A31C59A73235FE104E70424F0DB00028A3B15",
-"00114AA9000248F6A42601E35AD37E66F685C690E40B842B9C0071B3B126DF64ABB483E731AA480D8875E4EC8F25C7DA545518185FE1052804241562AAB0B03D2B",
-"00114AAA0002EBC47581C81448A3D75B644AC690E40B842B9C0071B3B126DF64ABB483E744C18658CB723E91033029700D4B93175FE1053A04233FF1000016C0F7",
-"00114AAB000202768A77630933637FC959ADC690E40B842B9C0071B3B126DF64ABB483E78287CCF41C0511D2490FD02821993A925FE1053B04238C74AAB2152811",
-"00114AAC00028DB7C883539C0635A56A6294C690E40B842B9C0071B3B126DF64ABB483E7C492526742F8E8FE2C07B76E1BE714F45FE1056604244368000B82A95A",
-"00114AAD000207F8CB4E05173F0BD4F2CBE0C690E40B842B9C0071B3B126DF64ABB483E751A7C15E4D6F58AA28B3FD5541774BAD5FE1059B0423F159AAAC191542",
-"00114AAE0002335ABCB39555E3E4E3B7DD8DC690E40B842B9C0071B3B126DF64ABB483E7E8020C9AF2BB1C5DA1B8199328D26A195FE105A5042362AE5556AB8129",
-"00114AAF0002736F881FB64CDA59095BA958C690E40B842B9C0071B3B126DF64ABB483E7313DE3BBCD7F9085045D4DC89D491E045FE105AA0423E028AAAF134378",
-"00114AB0000244DD0A4F0E391B49B02CF6AFC690E40B842B9C0071B3B126DF64ABB483E7A326CAE2793D0419BAB4ABC3470078795FE105CC04247EB85557D40953",
-"00114AB10002AC4EA7D93D138A815F4B055CC690E40B842B9C0071B3B126DF64ABB483E787FF8147A84E05D954F5C952E0246A275FE10680042460B455556160E0",
-"00114AB20002EE7F44C54B234C5EC4219276C690E40B842B9C0071B3B126DF64ABB483E70ED56CEACF4782B3F3BDCD05AEC001265FE106810420F9FF555A111EA3",
-"00114AB30002F485861C25A6D07AA47B4B26C690E40B842B9C0071B3B126DF64ABB483E7F630EE670AABD8710E241E3E279DDE065FE1068F04219C5F0000D1637E",
-"00114AB40002341FF310E435E2C7B74F5B27C690E40B842B9C0071B3B126DF64ABB483E753B0B5D5AC8A998F058B34E56EA4F82A5FE106D20421F4A3000BDD643F",
-"00114AB50002A4D952605915D096AADBF9E7C690E40B842B9C0071B3B126DF64ABB483E7951FF605C41285B6BA554A3707E67F345FE1073504212D0C000383C4A6",
-"00114AB60002D936375594246556916E0DA7C690E40B842B9C0071B3B126DF64ABB483E717595DE829722D9B82472F7306D18EA65FE10740041FD1E7AAAD5F9605",
-"00114AB70002A5599A3F29BC5E98438BFAFAC690E40B842B9C0071B3B126DF64ABB483E7FB614E3554AD68EFA5F23FBD54987AF25FE10748042035315555F660CE",
-"00114AB80002494275F13A80D36EB78FECFFC690E40B842B9C0071B3B126DF64ABB483E7369ECFC2E196161EFC30EECC83CD848F5FE107610420A4B75556A6FC64",
-"00114AB90002700BAEB72E531F0E7DAC7198C690E40B842B9C0071B3B126DF64ABB483E7D6560B965A0FB0A91025ADA7C8BA24795FE107690420BF330002405A7C",
-"00114ABA00029B58DF540A0255ED187A7807B72E531F0E7DAC7198C690E40B842B9C0071E184613D0B2BA8801CCFAE1FBC50CFC05FE1076F042134250001BA43FB",
-"00114ABB00022EE04D2834911BAFAA70606AB72E531F0E7DAC7198C690E40B842B9C00711E330EB9CB834250F0AF678387D126C55FE107850421B2FA5556D80232",
-"00114ABC0002B7BB85CEC5A15CAE9227E6F1B72E531F0E7DAC7198C690E40B842B9C0071D755A19247E638F418FE856D32D459765FE107910421DE27AAACA9A4DF",
-"00114ABD0002C58E2E68805F16F532E7E84CB72E531F0E7DAC7198C690E40B842B9C0071218276E51E294CCCBEE12B86B26AFD555FE10797042244865555D688D6",
-"00114ABE00023D874394C56338BE3E92D666B72E531F0E7DAC7198C690E40B842B9C00717AEA0B5DFB2BCE4BB1043A368AE1700D5FE1079D0422CE4500076E99C2",
-"00114ABF0002E1336EDA294BFC82B10AC95BB72E531F0E7DAC7198C690E40B842B9C007188511D68B742B8A27C9C69CB373DF95C5FE107C8042357B2000330EA83",
-"00114AC00002E8ECE50F26B3DBF31ED3C2D1B72E531F0E7DAC7198C690E40B842B9C0071B58805AABA98FFE71F38D74BD03720505FE107E804230A990001A22B17",
-"00114AC10002FC2D6E1243AB018C54A58E5EB72E531F0E7DAC7198C690E40B842B9C0071F23626C1F89820899AACB93AD203B9345FE107ED0423010C5558CC7125",
-"00114AC20002748C73A24A8D4155BD086F31B72E531F0E7DAC7198C690E40B842B9C00714E0F7F13E0D5AED357612838628D35385FE10810042395D90005017DDD",
-"00114AC300024FE72E404B30F72FB6001995B72E531F0E7DAC7198C690E40B842B9C007114D43E50B14403E1531C277329DAF2295FE1081E04237559AAACA76441",
-"00114AC40002114EF53AF0019B5E6E754BB3B72E531F0E7DAC7198C690E40B842B9C007133C3C7BFB677D5E3B3C4E6ACA8894BD55FE108330423D738555BAB67E2",
-"00114AC50002D85DDABD6F53EC644B1BA1B4B72E531F0E7DAC7198C690E40B842B9C007159799512CCCA1A3BA4F9DDB2214C9E965FE1084504240ED400039A5E7F",
-"00114AC60002FED41D92DE28F7F5EB9960E8B72E531F0E7DAC7198C690E40B842B9C0071C3C646C03D14E7D4811995299824506B5FE10853042455E95555938DED",
-"00114AC70002FA7A0BF99F7849F38AAB06CEB72E531F0E7DAC7198C690E40B842B9C00715D7EB5D365D15AC6D5573973F4FDC91B5FE108690424BA74AAB2B15A0E",
-"00114AC800027AA92DD81C9842438B7AC808B72E531F0E7DAC7198C690E40B842B9C007129DB5F0ACFACB1676A15A5660AD57BE15FE1089C0424ED9F555BC0A09D",
-"00114AC90002941728D4576B6736020BA69AB72E531F0E7DAC7198C690E40B842B9C00712DBA6B23F6870CEE63646C7DEA79C5165FE108AE042467B2555B32670D",
-"00114ACA0002C3C7F6CCAC2C6ECC31E4B0EAB72E531F0E7DAC7198C690E40B842B9C0071E01FC13435016C4A0E415075ECFEC8D05FE108D30424B49F55573E4205",
-"00114ACB00021F36717EF170A509824E319CB72E531F0E7DAC7198C690E40B842B9C007195313C3F8990581A0A5C218652475FB75FE109210424884F55565A8B13",
-"00114ACC000251DB30DC137C869E06313783B72E531F0E7DAC7198C690E40B842B9C00710CFFD769E01220421DF64F2FD8E15D5D5FE109250423635E55589CDC75",
-"00114ACD0002D1C20DA5A24BF52A8A53306AB72E531F0E7DAC7198C690E40B842B9C007145F40F35EE2D668E1E2CDAE3AA93F0345FE1092F0424031FAAAC600C93",
-"00114ACE00022A43F0674F8EFC7F8204E9CAA5A24BF52A8A53306AB72E531F0E7DAC71983EEF9834F9EE8391D2B9141C2182A7045FE1094804247E99555EE9D709",
-"00114ACF0002541B9C6B5CBC45E7791E5DFAA5A24BF52A8A53306AB72E531F0E7DAC719866F048C51A16AF80E93D3277C4A495E45FE1099A04249DDF0003E65A19",
-"00114AD00002948E31C7CFCE45C9F5F9614FA5A24BF52A8A53306AB72E531F0E7DAC71987C5553BF7990901094E4E5B9009EE9F05FE109A6042361525555CBF256",
-"00114AD100029648F05484353D1668F105AAA5A24BF52A8A53306AB72E531F0E7DAC71983750F00D7BB25CE2CAFC5793FAF8878B5FE109A80423D2080002064E28",
-"00114AD200028A915821961B650AF9A5F6C0A5A24BF52A8A53306AB72E531F0E7DAC71983F9248527FEA865ADF3141C1CBF70EA35FE109E204247DC0AAADC801D3",
-"00114AD30002DDB2B5135D158898B58D856AA5A24BF52A8A53306AB72E531F0E7DAC719892D07B70E616E48E8821DEBED8EE54415FE109EB0423D17E0008560B68",
-"00114AD4000202FB7A4150EB9F5BE4093DCDA5A24BF52A8A53306AB72E531F0E7DAC71989DEAF9BCF6525AC70DAACC38781452A75FE10A1704244F9255557AAED2",
-"00114AD500024B617C2317B0BCA9BFB8441FA5A24BF52A8A53306AB72E531F0E7DAC7198B5D53414D306A03351BFF706994946C75FE10A2F0423F9C35558A16B2E",
-"00114AD60002CDB790BA66A01D215D13C95AA5A24BF52A8A53306AB72E531F0E7DAC7198B81CAA54F8999D1141E55CD6E4E211135FE10A4F04242054AAAD211000",
-"00114AD700024C4AD99DC2BC7B29AA1158BAA5A24BF52A8A53306AB72E531F0E7DAC7198BD1FCEEEA41125E5F96052335D4847B05FE10A8A0424151A5555AD32DE",
-"00114AD8000202DBAF0885C773661B7C3526A5A24BF52A8A53306AB72E531F0E7DAC71983A243E146D3AE5C54A3D41E3457C1D445FE10A8C042369CF00050F9BC0",
-"00114AD9000208F5C9D8DD75E215EDD0E2AFA5A24BF52A8A53306AB72E531F0E7DAC71988C0DE590C73A3505574A28FED007D6275FE10AB00424148A55565723F7",
-"00114ADA0002FB89EA37722B1649D94CD468A5A24BF52A8A53306AB72E531F0E7DAC71988D6FFC64C3F648735130B168F94A709F5FE10AC90423F03E555CD7FDCA",
-"00114ADB0002E8CF479BF4912F09169A10E3A5A24BF52A8A53306AB72E531F0E7DAC7198A49799FE0446B17DA8485F1DC5DB82DF5FE10ADF042410AE0009734418",
-"00114ADC00028BE405E6CF25FD7AF75053AEA5A24BF52A8A53306AB72E531F0E7DAC7198E28CD0E97C3386929D02DA451D83839A5FE10B2D0424411FAAB137D6F8",
-"00114ADD0002E64755B71093E508DA43DECBA5A24BF52A8A53306AB72E531F0E7DAC719813DA41F23D654EEE039F7BD2E28791185FE10B3F042323905557EF5FC5",
-"00114ADE0002E2E247E2324E8E32818B669EA5A24BF52A8A53306AB72E531F0E7DAC7198807E51E04C1AD7AFCDEA36F8F88B13E95FE10B9A04236CB7AAB5F6C524",
-"00114ADF0002546B4D30F84800DAB4B2883EA5A24BF52A8A53306AB72E531F0E7DAC7198AF5BD08B5F13F2B065B1584D36C793585FE10BFB0422150E5556046284",
-"00114AE00002FEA8ACB6627ED71A64B51C47A5A24BF52A8A53306AB72E531F0E7DAC71988F0E250DE1D846C9CA7712BA160C2C585FE10C550420BD93555979DEC5",
-"00114AE1000266AAFD43F8340D2F8A1BD322A5A24BF52A8A53306AB72E531F0E7DAC71987DDDB604A473706BD415397DD74C4F675FE10C77041FA139AAB1EA4CE0",
-"00114AE200028A593C7EFE349321F88EA48C43F8340D2F8A1BD322A5A24BF52A8A53306A12C799FD4BB810E7BC79B3F0B7215AF05FE10CA1041F935F5556989C92",
-"00114AE300020386CAABA650D2036E3EB44B43F8340D2F8A1BD322A5A24BF52A8A53306A1CF50A3A282FED4926D578A9EC409A925FE10CAC041F5BA20000EDD281",
-"00114AE40002A66169E83AB318FC95CFA18543F8340D2F8A1BD322A5A24BF52A8A53306ACB119006B4555E1455A160F9D65FFFF55FE10CAF041FB6DCAAB4CF8414",
-"00114AE5000295773ECACF79F9455321CC9D43F8340D2F8A1BD322A5A24BF52A8A53306AE01089FDEE723E3E21689D9E9BEFF6C85FE10CDF042037B90002D92BC0",
-"00114AE60002C608545FA4AD5C926DE0CE9C43F8340D2F8A1BD322A5A24BF52A8A53306A420A9454FB5C606025D14F0E32FE189A5FE10D33041FE25100011F0035",
-"00114AE70002D209D8420D23B90EF173BF0F43F8340D2F8A1BD322A5A24BF52A8A53306A722C278145CD4D9C3DFADE0634BDF1855FE10D37041EE999AAB1BCA647",
-"00114AE80002073C3B51839712AD01D54B8643F8340D2F8A1BD322A5A24BF52A8A53306AFECB2BBE4FD7917E3AC7BA1A808F3A825FE10D72041F635D0006B3998A",
-"00114AE90002E6159AF4EE2227AC257A21FD43F8340D2F8A1BD322A5A24BF52A8A53306AE7F1902E45920400CE17230D1E84AD9D5FE10D85041EDF140004F9735C",
-"00114AEA000229FED0454FBF12D47AB65EFA43F8340D2F8A1BD322A5A24BF52A8A53306AD2AF1819F64FFFB5CC28DE8B6D53BC945FE10D94041F125AAAAC7D573E",
-"00114AEB000210858D94A9B3BF4BF40DDBE743F8340D2F8A1BD322A5A24BF52A8A53306AD32E74F15A76CEC46D491746004286455FE10D9A041F58FBAAADBD825F",
-"00114AEC000220A60EE08E59A162EEA9076A43F8340D2F8A1BD322A5A24BF52A8A53306A40CF495C3DBB55A6E6F6B4E0A70855675FE10DBB041FCB020000D037F9",
-"00114AED000280339A5C392661B6576C2C2743F8340D2F8A1BD322A5A24BF52A8A53306AFB314ADDE24AB63CD416040E6B1EAE945FE10DD3041FBD7600046C054C",
-"00114AEE00028B23EEFEF5ACAFF4B679282143F8340D2F8A1BD322A5A24BF52A8A53306A6F21F43253AEDBDF3E04FDBE919FE9715FE10DE0041FDA2FAAB0128D08",
-"00114AEF00029227064CD7807C84595A9AB443F8340D2F8A1BD322A5A24BF52A8A53306AA949916F3320143B0158D664FEB51C655FE10E2F04202DFCAAAFDD6EF3",
-"00114AF000029351E45FDDD125B3892044B943F8340D2F8A1BD322A5A24BF52A8A53306A37354C216FA5374576D45ACBB12FE2065FE10E68041F4267AAB5437443",
-"00114AF10002821325D34A7A88FA8A2963BA43F8340D2F8A1BD322A5A24BF52A8A53306A76F62A4E53586F7BF06A87AFC13003015FE10E9B041EC90EAAAFC17C54",
-"00114AF200021AD42DBE83CB44176642F77543F8340D2F8A1BD322A5A24BF52A8A53306AFF5FB9FF4B2723ABA2FAB0A8F8B819405FE10EAA041E6B9F5556840FA2",
-"00114AF3000221593368833E80BA7930F47443F8340D2F8A1BD322A5A24BF52A8A53306AF592F6EAC7FC056C99FA939C9CB969115FE10EAD041EAE0C5557642149",
-"00114AF40002FDC386E53852260656BD5B2F43F8340D2F8A1BD322A5A24BF52A8A53306AC3E869E9DC80DE9D1109196FF018C3525FE10EC4041F287DAAAB61A00D",
-"00114AF50002374009109986381B1EE737AE43F8340D2F8A1BD322A5A24BF52A8A53306AFC6B0664AC72B91894093CB8638114FA5FE10ED0041F45F5AAACC12C9B",
-"00114AF60002A5AB29B089659ADA9F70A1EF109986381B1EE737AE43F8340D2F8A1BD3223EB8492A1F45A154FA18BD6DB3879DCE5FE10EEC041F9B86555E11D6CF",
-"00114AF70002D05AFF03C671A93EE7536DB9109986381B1EE737AE43F8340D2F8A1BD322D383AF91AED099A3209FADA061A764405FE10F19041FA34E555FD9CCC7",
-"00114AF800028AB103321B2E940B4312FED4109986381B1EE737AE43F8340D2F8A1BD322EB9ACE4BDB1655B7DFE8ECA5EB2FA4AF5FE10F4B041F5823AAB6705CEE",
-"00114AF90002F6F9D097ECFAC1AD267D6AE6109986381B1EE737AE43F8340D2F8A1BD322AEF4E8FA0972FCB276B4E7662DECF3255FE10F7F041EFB8BAAAC9D12B4",
-"00114AFA00022E4A0F6023A3F92F62A6E224109986381B1EE737AE43F8340D2F8A1BD32248D1B7E52EB120F031300FC2C15E007F5FE10F85041E976F55590451AC",
-"00114AFB000220A701D3A0107C7E22A6BB6A109986381B1EE737AE43F8340D2F8A1BD322864CADE8B235F4FBF47EFEE4682F57835FE10F8F041F062E000151A0D5",
-"00114AFC0002E741B30BB0BBE2AB42D4E470109986381B1EE737AE43F8340D2F8A1BD322EFB362D5CDFDD6793B23FDE7FA64C4745FE10FBC041F62F100027B424E",
-"00114AFD000205B8301B15FCA13B82B68801109986381B1EE737AE43F8340D2F8A1BD322819390C1D88A24056C37C720620E90CE5FE10FD7041F1ABF0003387690",
-"00114AFE0002E1233FC6AC2E74721EEBCDC0109986381B1EE737AE43F8340D2F8A1BD322BAD27E1804C9DF6C662B6576D75C0ED65FE10FE1041F28925557D61EAE",
-"00114AFF0002B379D67F7A4C4CEDC793CF4C109986381B1EE737AE43F8340D2F8A1BD322E5BECDA084190C850C520201FB72A8B55FE10FE8041F890800001106EA",
-"00114B0000020B8E1FD795096B9014C6ECD8109986381B1EE737AE43F8340D2F8A1BD3227127F33A705312A6DBEFCCA43DEE03685FE11020041FF80D0005967317",
-"00114B010002CB39E4F402F4CFF750CB17A7109986381B1EE737AE43F8340D2F8A1BD322EAD0C9E477A1AB7F7092D19BD2077D8C5FE11047041F71B900007AA968",
-"00114B0200028A95833D2695C2BB8495E2BE109986381B1EE737AE43F8340D2F8A1BD322AC42615E528A9A14EB3574046451EBB45FE11064041F4744AAACFE2E8A",
-"00114B03000280208D1B82A5B21B0D6DD846109986381B1EE737AE43F8340D2F8A1BD322194DDC1E7AEEB107CA53B6C72852A22D5FE11081041F4D1F555919A188",
-"00114B0400022D07599ED9326604ED2558E0109986381B1EE737AE43F8340D2F8A1BD3225541C18D43520BD0B8E7F1BEAE0E98705FE1108C041F51C4000237BB6F",
-"00114B0500029BC17CA540BB7124624C67B0109986381B1EE737AE43F8340D2F8A1BD322FC676F356ABD77F320B6DBACCFD475B65FE1109C041FAE7CAAAD38AC4B",
-"00114B060002658E51C7B166F79964635160109986381B1EE737AE43F8340D2F8A1BD3224D06236C075DDB64A1D42486F115AC735FE110A9041FF428000140C136",
-"00114B0700024185BA391AD1C1B942561FFE109986381B1EE737AE43F8340D2F8A1BD3227609530A005ED6367CBBEDF5416AB9035FE110B50420490C5557742DAD",
-"00114B080002E602F1A1065A86457E5E0E23109986381B1EE737AE43F8340D2F8A1BD32235DA50DB32FF36A0A9ABD317738B94B65FE110D00420A55F555BB78FD1",
-"00114B0900026D0DD1DBD5569BB634730D44109986381B1EE737AE43F8340D2F8A1BD32259567AAC4B07348641825A28A722631F5FE1111E0420B2180005A2DE19",
-"00114B0A0002EFFBBDD2ED9AB464FB26C472DBD5569BB634730D44109986381B1EE737AE7E2D451BAACA199A4FD58812BCDBAB1F5FE11144041FB4FE5557C23491",
-"00114B0B0002494B50449B22359ABBB51CF2DBD5569BB634730D44109986381B1EE737AEF9202961193B1B40D2C554C69178C2E15FE1114B041F8A22555EF29731",
-"00114B0C000255A21B830921ED55DB1D52C1DBD5569BB634730D44109986381B1EE737AE94A7431DDFD42913E9B1094DCC0F152A5FE1117F042000985558A4A138",
-"00114B0D0002A0B0CA683E968F31CA9110D2DBD5569BB634730D44109986381B1EE737AE82FE2B0A0837FD13679642538F60C3075FE11189041F8D230000B26812",
-"00114B0E00027D5D402F514F0619AE50A4D9DBD5569BB634730D44109986381B1EE737AE5289F62D164413F7C06BBFFC0E5F7A2F5FE111A2041FF3630002BA56EF",
-"00114B0F0002CEE9E784A7B8A62B8CE16FBBDBD5569BB634730D44109986381B1EE737AEF8BD94E757CC0523C011F56EE9E461035FE111E104200DD8AAACA0D0F3",
-"00114B1000028BA1A6BAEAD1BC102B9B5808DBD5569BB634730D44109986381B1EE737AE7563D3223C6F3CF0B40595DEA20188865FE11240041F667D555AD033BE",
-"00114B11000266DCEDEB6113D8E503E6C82EDBD5569BB634730D44109986381B1EE737AE098708BFB438AFB304D2CF740BE338D95FE1124F041E2D670000044E65",
-"00114B1200028D1F131831F6F62C1E29B5FEDBD5569BB634730D44109986381B1EE737AE3F89C4B55F3B167E4899B919A004CCD55FE11257041E75CDAAAEB38245",
-"00114B1300028F6BCFDAD082B54284A12F8FDBD5569BB634730D44109986381B1EE737AE73F2EF29376CB470E120BBAAF24C42AB5FE1128F041EE07055600D192D",
-"00114B140002EF32ABCE5FF1F528C5C4CA41DBD5569BB634730D44109986381B1EE737AE90D4350C683A0D0081649587FD41C6B05FE112E8041E63F7AAB09AC7BA",
-"00114B150002283AAC18B9A1F637A0F475AEDBD5569BB634730D44109986381B1EE737AE217FDC90C3203958AFF9310030BBC92D5FE112F9041D56C7000611C02F",
-"00114B1600020C4938BAD2738E6C1C1777D9DBD5569BB634730D44109986381B1EE737AEF3EF685BBAFA1F2E5E1ADEA672A4BB135FE11324041D8C3DAAAC2483B9",
-"00114B170002FC4A849F3200FBFE1F76269FDBD5569BB634730D44109986381B1EE737AE8B65B4754A093A637AC2C86A96B7F8F45FE11329041D53E9AAAD84D7C3",
-"00114B180002EDC669171D78791182F78C80DBD5569BB634730D44109986381B1EE737AE869CBBB45C48D0F07B561CD7945866A15FE1133A041DC66E5555F06F59",
-"00114B19000247690FB03FE3B615C47485C4DBD5569BB634730D44109986381B1EE737AE900C3918D1210F2DFC89917B62AF223E5FE11352041E0055555F54E361",
-"00114B1A00020188A8DF42386EE33FF63F97DBD5569BB634730D44109986381B1EE737AEAB19CF01DBB5B86B8E2B92647E7032275FE11384041E195D0002E5688C",
-"00114B1B0002E9FEFEF043C430491DCD16FEDBD5569BB634730D44109986381B1EE737AEF50E187031C1D4E498A9DEDF596F4A8A5FE113A1041DBE250006047589",
-"00114B1C0002C30519FA049AEE47AB451896DBD5569BB634730D44109986381B1EE737AE63FB978D1A32DEF47D653331224DFCE95FE113CF041DC54EAAADF527F1",
-"00114B1D0002F6CEBBEB2EAF563BF5A99133DBD5569BB634730D44109986381B1EE737AE9EB6D4CEAC515233FBCD3C7289A39C4F5FE113EF041D7D76AAB1D95A57",
-"00114B1E00027C1A5D44A19402A4FCA864CCEB2EAF563BF5A99133DBD5569BB634730D4477D2B1BC1C371194134391C39F315B745FE11418041D76D9AAAB5D5DE7",
-"00114B1F0002674DF612C26255AC9AE97B6DEB2EAF563BF5A99133DBD5569BB634730D4439B94DDED3DE2452EBC5A06BB44F0B065FE1141A041D47730000620163",
-"00114B200002369787845FD37365116F877DEB2EAF563BF5A99133DBD5569BB634730D441FAA5F25FEBC8850DEFAEBD57734D4E85FE11424041DC7CA0006B0363B",
-"00114B21000223DB2BCB44ED2450699CCE94EB2EAF563BF5A99133DBD5569BB634730D44FB72164C588E6677A80244667ECD96D35FE11451041E259A5559F90877",
-"00114B220002469E172C759ACE4ED8A0C841EB2EAF563BF5A99133DBD5569BB634730D448715E45D67F6A4D8264F4039A26299385FE1145E041DE0235556B12288",
-"00114B23000242BDA60DFD12401191738ED1EB2EAF563BF5A99133DBD5569BB634730D44BAB965B0A83B8FE9E198EC12623D1F335FE11479041E3276AAAC79F737",
-"00114B2400020B6CA4B6C05B5D6AB0E754F3EB2EAF563BF5A99133DBD5569BB634730D44F7AC58B796187937A5198B6E075917DE5FE1147E041E3FD8AAAC4959D9",
-"00114B2500021A324472A8A9BF2CB2E6BC98EB2EAF563BF5A99133DBD5569BB634730D44469F5C351B3001DDCDE7E62FAD3D27225FE11484041EB9D3AAB5574927",
-"00114B260002C5EEB53191599736A84C7709EB2EAF563BF5A99133DBD5569BB634730D440ADCE5EE3E341B820AEA7CBD1CD542D35FE114FA041F33375556CFC31C",
-"00114B270002662F3DE1B5571319EB8A0E92EB2EAF563BF5A99133DBD5569BB634730D44495270FC4773CD53E66A29098DB3EFC75FE114FF041D88A6AAAEF0DCCF",
-"00114B2800026AC0C8DDDAEA2D9C963DF758EB2EAF563BF5A99133DBD5569BB634730D44A4535BC3BB4D441216A4F75F68702B775FE1150B041E02205556B3F58E",
-"00114B290002015290CDEBFA5E92AD5E9E1CEB2EAF563BF5A99133DBD5569BB634730D44DB8E093DF6E23A4CC3FF65BF0BE25DD55FE11517041E5807555E4E7E4E",
-"00114B2A000235A4A4C3424D41A69E11FD11EB2EAF563BF5A99133DBD5569BB634730D4419451DCCD57FCBA4BED8791CBA08A05B5FE11553041EB08DAAAB8C9F94",
-"00114B2B0002B5EA5EB197B8071C8C53703CEB2EAF563BF5A99133DBD5569BB634730D442BFFF51046A3018CA2F2A9CD632B71715FE11584041E1E2B000226E261",
-"00114B2C00020F16D05CFB4901C48664EB2FEB2EAF563BF5A99133DBD5569BB634730D44AA0A8BDD0BBC7EAEE7AB5A550DDDD74D5FE1158A041DC598AAAC05334A",
-"00114B2D00021313767DDF59C5F215D27C4AEB2EAF563BF5A99133DBD5569BB634730D443BAB424A67CD99E8ACB6C9E98B6BD2C15FE1158F041E37CCAAAD1472D8",
-"00114B2E00021E5E660B9F1552A9955C4B2DEB2EAF563BF5A99133DBD5569BB634730D44FCD881CF1D592BF43EEF2C23D5ACD04E5FE115AF041EB2D4000393FEDA",
-"00114B2F0002CFE0CD4C39D437E74C453BB6EB2EAF563BF5A99133DBD5569BB634730D44245C05BBD410FD533159612575977D835FE115B9041EA76C55568B0F31",
-"00114B30000236F13B34CF6593AFBA9666C2EB2EAF563BF5A99133DBD5569BB634730D444862B74CB33880406A9FE14C6D9FC1BF5FE115D4041F0AF355606B0DEC",
-"00114B310002CA73AA4D33E9617A1E6611ECEB2EAF563BF5A99133DBD5569BB634730D44F038B986DB4D3C4B6BE18409D486025F5FE11606041F1B8EAAAE8DBAEB",
-"00114B3200020F7BD36F7055AE35EA3DED8F4D33E9617A1E6611ECEB2EAF563BF5A99133C84F7F130B5D71D5344E3EAB4C44ED775FE11615041EB6980001F740ED",
-"00114B330002549D847986F88355720A82014D33E9617A1E6611ECEB2EAF563BF5A9913394A945CE32B8068B5854985AFD7966B95FE1161B041F04C8AAAE34E07D",
-"00114B340002A989D645C3F7335C4B69D32B4D33E9617A1E6611ECEB2EAF563BF5A99133E776BC0EE799B401091A06957E9209815FE1163C041F7FA90005233034",
-"00114B350002E1389A1DAC50B7AE078E6A374D33E9617A1E6611ECEB2EAF563BF5A991338E704545A1FB9C0B6A2B8D74AD88C9BB5FE1164A041F70460001E27B0D",
-"00114B3600027A0B24C878EA2F329090A03D4D33E9617A1E6611ECEB2EAF563BF5A99133E799DC6D7D22487114B343C7D773E38B5FE11650041FC8DD55573B69A0",
-"00114B370002688984C0A3B5A40C362575AA4D33E9617A1E6611ECEB2EAF563BF5A99133B5727E4A5CDCEC19797719EBFBDDFAAB5FE1165604204C1BAAAAEDC398",
-"00114B3800028777F19734266DA60AC052114D33E9617A1E6611ECEB2EAF563BF5A9913352E97063A3A7B0191D9E611E8BCFA0DA5FE116610420D6A90002268BEB",
-"00114B390002DF988ECE2C8D55697315F79C4D33E9617A1E6611ECEB2EAF563BF5A99133A22B35CD5A53FA88231E4EBE532EFD6F5FE11688042145FA55560ABFE6",
-"00114B3A00027393CF2E3118521CCB031F834D33E9617A1E6611ECEB2EAF563BF5A991336C047D8ED998B410A520AE5802392D6D5FE1169F042110F1555749B936",
-"00114B3B000283F8E1EC02DC3D84BA2105514D33E9617A1E6611ECEB2EAF563BF5A99133EBC4A2EECF247788497B5A5BF9151CFF5FE116DD04213C75AAAB97C50F",
-"00114B3C00029EDE8C6DBE6D04091F7A21564D33E9617A1E6611ECEB2EAF563BF5A99133CEA0354469B75D5B77FD4DCF2C9070495FE116E004207FFB00044925C9",
-"00114B3D0002C58E0CDC4E0D4929DB59ABC74D33E9617A1E6611ECEB2EAF563BF5A99133E9DB806F55BBF8DBC5DE333F1E4584205FE116EC042122DD5556128149",
-"00114B3E000273FD70A090A5DDCD021CFEC74D33E9617A1E6611ECEB2EAF563BF5A99133324AC477C115C5B61185EE92CBF3D3795FE116EF04218F065555DCBA4E",
-"00114B3F00023112944E54D4BBA5C46254224D33E9617A1E6611ECEB2EAF563BF5A99133145D93339FD6BE9268C90372D5ED562B5FE116F80422389B5557FC02E9",
-"00114B4000026D2491068DBFA5CB3158F8B84D33E9617A1E6611ECEB2EAF563BF5A9913336668EB1CA7F39F7B207258CD17B40665FE117150422C1415555B12DA0",
-"00114B4100025161C77D9CA6275437C897654D33E9617A1E6611ECEB2EAF563BF5A991330D6F2A01DD85E792888929DD209C0A565FE117370422C5430002FC9020",
-"00114B420002EE4804DF2482AED07D512D0B4D33E9617A1E6611ECEB2EAF563BF5A991331BA1BB3D69A32A61CEBE7B37C067B6B35FE1175A0422ADD85559DDB83C",
-"00114B430002FB81C1B4F977520ED669B2B04D33E9617A1E6611ECEB2EAF563BF5A99133BBB7596E2F1F0BAAE6C9FB19617806C85FE1177C04228B7FAAB20D65C9",
-"00114B440002D94ED3C7A387C1F651BEC2E84D33E9617A1E6611ECEB2EAF563BF5A9913334A4AAD753A20C9F6EFD2686C7400E835FE117A504226F6155595F8540",
-"00114B45000279AD930CFAF08133D4FD940C4D33E9617A1E6611ECEB2EAF563BF5A99133215992D4E0D956D6B95D19C3400904685FE117BB04222682AAAD0A5976",
-"00114B4600021BF9B76BA94B70D759D5311B0CFAF08133D4FD940C4D33E9617A1E6611EC16D46E161A9E4D1951A9D650E85145655FE117C204225A9BAAB185861F",
-"00114B470002694C90368FDAE2B6996C730E0CFAF08133D4FD940C4D33E9617A1E6611EC3C5DFED2E243CC7C875F3909DC87615A5FE117EA0422EFC90005C80DC5",
-"00114B48000296FCBF08FB45212614AE950F0CFAF08133D4FD940C4D33E9617A1E6611EC806F3EE933F14F4CA58E0B65BD3FDB085FE118310422ADB30004E0781D",
-"00114B490002462C96D6DBB15755E1DB81800CFAF08133D4FD940C4D33E9617A1E6611ECA048E54EBA1D4082EA1046F5B7398C5D5FE1183E0421AC8A00010DFFC2",
-"00114B4A000208F5412C1B1AF169BD715FED0CFAF08133D4FD940C4D33E9617A1E6611ECA2F9A5612D6130FCA590CA63977658905FE11842042218D2AAABC9A762",
-"00114B4B000248FA434A48D1E199FDA3B8F40CFAF08133D4FD940C4D33E9617A1E6611ECF6B046AE69DCCBE15AF860CDD2CABC675FE118490422BBA455590221C3",
-"00114B4C00021F35C5472A9EF641BAD8FA0F0CFAF08133D4FD940C4D33E9617A1E6611EC5DD2701DB44BEFF75ED6155085497A6A5FE118530423542C5556D1CC7D",
-"00114B4D0002FE4439EAE1B1A66514A239A40CFAF08133D4FD940C4D33E9617A1E6611ECAD4EEE296DA5036136D5EE049E789F385FE1189C0423D996AAB2043273",
-"00114B4E00026C9B7C8771DB47F84227325D0CFAF08133D4FD940C4D33E9617A1E6611EC8E033A0BC6C4E39C60E177A24163CA845FE118B00422B73255558F504F",
-"00114B4F000266BBE768A8CAB6C03664F4C30CFAF08133D4FD940C4D33E9617A1E6611EC067D7A70CAC2EC1AF7FF2018B29549985FE118B10422FCBCAAAB70C5E8",
-"00114B50000216727FEE84CEC11F631AC7480CFAF08133D4FD940C4D33E9617A1E6611EC6D1DB45BE42CD2D4438FCB8E9EA01C545FE118CB0423C11E555B6B0ABD",
-"00114B5100024EE071646D86F68B9E1DABDA0CFAF08133D4FD940C4D33E9617A1E6611EC769BD38713FA459808DA849E6A4B38255FE119010423DAA3AAAD8AFFFC",
-"00114B5200020E0F262F023C4DCF02A284900CFAF08133D4FD940C4D33E9617A1E6611EC0352EB31381BEFDFFF265EF6ECE42D625FE1190A04233811AAAD7D22EC",
-"00114B530002670AA306886288ED37B83C2F0CFAF08133D4FD940C4D33E9617A1E6611EC78571AA995D87A60A5F9AA9ECE2938485FE119130423C99BAAAE216BAD",
-"00114B5400022CE6AFDC25F31C222728E4130CFAF08133D4FD940C4D33E9617A1E6611EC222F7606B94EC04AA972D3FE33D955775FE119BA042457AC0001C21D03",
-"00114B5500024F868D004B43C32AFC2AAEC30CFAF08133D4FD940C4D33E9617A1E6611ECC04933ACBF9D99AE206A2D7A77CD8E735FE119F50420E69D555D62F6DF",
-"00114B560002570B5721DBEE6C841223B7A90CFAF08133D4FD940C4D33E9617A1E6611EC7F49D66FBBADCB5B239E76B9F6307CBE5FE11A22042049550002A73A8F",
-"00114B570002254FD6ABD01E07E9F760040D0CFAF08133D4FD940C4D33E9617A1E6611EC9E0634D24566A821E1BCA90109417E8B5FE11A2A041FF89B555861D3DB",
-"00114B580002E24E5D38CB7085E0453566BB0CFAF08133D4FD940C4D33E9617A1E6611EC704A1B2AF83B03A357E8A5AA53B045045FE11A34042074B10001DFFFDB",
-"00114B59000220BA44BCBE64704012B656C50CFAF08133D4FD940C4D33E9617A1E6611EC026336330944418DCE65540208684A5A5FE11ABF0420E5E6AAAD1D4E43",
-"00114B5A0002E60C440021BB6C2883426E3BBCBE64704012B656C50CFAF08133D4FD940C0F8FA39A951978BB29F2D71DAFC8A8DC5FE11AC6041E9BF7555EE808B5",
-"00114B5B00025158654D223FD05FFACD67B0BCBE64704012B656C50CFAF08133D4FD940CF529B797DDF0C796EED8FB6E67758DCC5FE11B45041F16EDAAB1846AC3",
-"00114B5C00024F847CE3BACE482DAA3E67E0BCBE64704012B656C50CFAF08133D4FD940CEB4603C94E5126280FFC98BAB41362B75FE11B6E041D3EABAAAE53BD49",
-"00114B5D0002E986B07BD4580724D1E8138DBCBE64704012B656C50CFAF08133D4FD940C79DF1B78F3FD409FD50E097026C1CA215FE11B99041D108F0006EBD6FD",
-"00114B5E0002499F6F5ABC890627AEAE3D62BCBE64704012B656C50CFAF08133D4FD940CEAFCF943E85ACB79CAD3376C5E4440BC5FE11BAD041CD626000058AF59",
-"00114B5F000238FCEADBD24FA6910E1A27BABCBE64704012B656C50CFAF08133D4FD940CD3AA92BEA0289454242D857DA39B4B485FE11BB2041D04CAAAAC144BE2",
-"00114B6000029F62CA4E74B3FE28950F01D1BCBE64704012B656C50CFAF08133D4FD940C128D8A22F424742F4D2D22D3808307985FE11BC7041D77FC5557D72CA6",
-"00114B61000240E99A76BE356A3463A902AABCBE64704012B656C50CFAF08133D4FD940C20931E8068B863BFD9AE844162D3A18F5FE11BEC041DA0B0AAADA46652",
-"00114B620002B64E88DAC6282813C911CC66BCBE64704012B656C50CFAF08133D4FD940C4F1BC0D00941566376D7D2728210A8945FE11BF5041D801555569AECFB",
-"00114B63000272FAFB05C012930E1D528A67BCBE64704012B656C50CFAF08133D4FD940CFD22E683D371D6DD1255870560ED8BD15FE11C01041DE4F7AAB25CF012",
-"00114B64000291214E55FDEAC23383E68AB0BCBE64704012B656C50CFAF08133D4FD940C55B1E5B8E699641F6BA1F7F7F61891055FE11C2D041E3CD0AAB0F6C48F",
-"00114B65000251FEBF480729ACD52360D7BABCBE64704012B656C50CFAF08133D4FD940C3D562A1B40DB991A1AA35213D43577A55FE11C3E041DF734AAAAFEE26F",
-"00114B660002D270EFC2EFFE89FDE66FEB95BCBE64704012B656C50CFAF08133D4FD940CE61B282418E312CD62EE28FCB02AD74B5FE11C44041E3721AAAB694383",
-"00114B67000224B0D6FF4317CA65892D8146BCBE64704012B656C50CFAF08133D4FD940CC2B0A34C8D81F6B498F024FC9B596DA65FE11C5E041EAE820006830AF1",
-"00114B680002C3047737F54D051E97B9E644BCBE64704012B656C50CFAF08133D4FD940CB47758EB55D3621CB8E72BB6F7BB1D415FE11C85041EC2290000AE92AE",
-"00114B690002A4F4400E32782D66FE16A5C0BCBE64704012B656C50CFAF08133D4FD940C16E12B8DAC247F088F75D54E1385B9085FE11C88041E95F4555885CCEF",
-"00114B6A000203B6BFDBCF891D3CA1B94AC6BCBE64704012B656C50CFAF08133D4FD940C847DE7358C1E983A84D6B3A0458687655FE11CA7041F21D30000D7C405",
-"00114B6B0002D8E070A213582F3A1DE6DE5ABCBE64704012B656C50CFAF08133D4FD940CA77A3D2ACB5E83B2A8543587B2D3E8955FE11CD2041F1CC7555856C81E",
-"00114B6C0002157570647D5087EAE46F9A36BCBE64704012B656C50CFAF08133D4FD940C7D3F4AD10CBAA1C323B21C3DAFF0AB075FE11D09041EDB5DAAAAFD10E0",
-"00114B6D0002FCAE32F308A1E17F22AB4B38BCBE64704012B656C50CFAF08133D4FD940C1586863B0715252B8D48B8D05F7599CB5FE11D20041E5ED4555A6EB2E6",
-"00114B6E00024389DF2285C38C204C02BDF3F308A1E17F22AB4B38BCBE64704012B656C521AEB5EE33277605179D27DE395E43A15FE11D2F041E813E5556375A21",
-"00114B6F00020271FCE09CF8FC2AE39D0672F308A1E17F22AB4B38BCBE64704012B656C5B9DA28B5F3F7CEF0FB035B672BCE2F775FE11D3A041ECD26AAADB1F26B",
-"00114B7000025BEAD8FBB1F7BD993B41E8E2F308A1E17F22AB4B38BCBE64704012B656C582ED76E1711050A01904C584070D5FD55FE11D4C041F30B6AAABDD8C02",
-"00114B7100022272EC450530CEE41F6CADE8F308A1E17F22AB4B38BCBE64704012B656C51AFB08818035E79C73485192E04F7DF55FE11D54041F6ECAAAAAB62390",
-"00114B72000255FF104262B0E08FBBD6C32BF308A1E17F22AB4B38BCBE64704012B656C55CD5B7BED08E891FEAADE0B611268F025FE11D69041FE6FB5558252BD2",
-"00114B73000263DDAAEF947B53AC311B3D65F308A1E17F22AB4B38BCBE64704012B656C5742A097164C15D84BAD82530500FF14A5FE11D71042018A300021DB3C0",
-"00114B74000293A583A6356CE1E487D98797F308A1E17F22AB4B38BCBE64704012B656C5A20F99BD11A5C32D6D44BF05731D5E3A5FE11D8D0420933455568B6A13",
-"00114B7500027244D2A7609400728885CA34F308A1E17F22AB4B38BCBE64704012B656C500FD9838D74EC2DB0737254B4B09EDF45FE11DB804209A6E0001A20E4C",
-"00114B760002FC4A9B7BF97514C40C26AE86F308A1E17F22AB4B38BCBE64704012B656C5E907D6BA8128CBDD4700F1BC46FA9CB95FE11DEA042051B6AAAF98D41E",
-"00114B770002403A5C7585C955FD2AA0E1AAF308A1E17F22AB4B38BCBE64704012B656C550B2D2D2F2242231CDA8A903E56AF1545FE11DF8041FE5240001B2E6F7",
-"00114B780002650320FF7099336297E4E82AF308A1E17F22AB4B38BCBE64704012B656C5E4D1FCAA6A17DF4A4D580F59B253B3105FE11DFD04203DEBAAABA3B424",
-"00114B790002D45F632D2B6E88EB6B88000EF308A1E17F22AB4B38BCBE64704012B656C570068B1A5F9AD572DA2F76A7145111345FE11E040420C815AAABC8F229",
-"00114B7A00029BD9BB33156E74D4C3CEF0E1F308A1E17F22AB4B38BCBE64704012B656C546420F4531A162E28CEA1658F96B369E5FE11E0704214DF4AAABB2BBC8",
-"00114B7B0002408AC63D5CE1F716094FD4A7F308A1E17F22AB4B38BCBE64704012B656C5A1701EF2B760451EBA45F988B8351E4B5FE11E100421EF395555A0BAE5",
-"00114B7C0002D1ACE2B5BA22B67FD6D6EBDDF308A1E17F22AB4B38BCBE64704012B656C5EA0CDFE405D2FAF6F6D7416E16C2A16E5FE11E2A042272015556BF6092",
-"00114B7D000279C4C07E9E201F12ECED44FEF308A1E17F22AB4B38BCBE64704012B656C51FB6D7366A505DDF85250AEF2B674EA55FE11E3C04228A85AAAD2AA071",
-"00114B7E0002B7C61055B8BDF1CD5B599E06F308A1E17F22AB4B38BCBE64704012B656C5295A525B931DDDB646E1ADBC2753F8835FE11E470422D7A4AAAAD6D81E",
-"00114B7F000281F566BC8A610A6A5E7374C4F308A1E17F22AB4B38BCBE64704012B656C55F1DEE4C66EB71E992320A0797AFC0765FE11E5404235222AAADC0E3F0",
-"00114B8000028CEEDF2C71FE3F08F95C6983F308A1E17F22AB4B38BCBE64704012B656C51824E72BF6E4EABB03D8DC90C5D0A2C55FE11E740423C2B0AAAE8037E1",
-"00114B810002343644B4F9393AECC6CFF7F1F308A1E17F22AB4B38BCBE64704012B656C54AB1231F78CE2D6E94960122F142C12A5FE11EA60423B213000363F7E1",
-"00114B82000206A7D991931E9AEAD7BA334DB4F9393AECC6CFF7F1F308A1E17F22AB4B3869E715AED4551AED96D2C0737A0CEA0E5FE11EC704232BDDAAAEF2AD6F",
-"00114B830002D9169DD9DE2DC471DD5B1523B4F9393AECC6CFF7F1F308A1E17F22AB4B38CE684223C319744760E9C0B0EE96BE785FE11ED304231819AAB3911594",
-"00114B84000267080C75D16770042FE6ABFCB4F9393AECC6CFF7F1F308A1E17F22AB4B38ED561E6794B48DD0364A45420FDB67E45FE11F0004238FE555575AEE9F",
-"00114B8500027751649BE6166E46A066D3BCB4F9393AECC6CFF7F1F308A1E17F22AB4B38F2E50B1D87C66EA2EEA33E4DCB127A9A5FE11F0604232C1B0002729058",
-"00114B86000235EA339D32D2F8D9D976364CB4F9393AECC6CFF7F1F308A1E17F22AB4B38B4C39741C2B1213B03185330E83E1A8A5FE11F410423CB1800009CFF28",
-"00114B8700027B31D0C5B33D066D27EBEA3DB4F9393AECC6CFF7F1F308A1E17F22AB4B3812479E8959C7DBB308B7CA467E29819C5FE11F4404230A5C000376B57D",
-"00114B88000296E3420946457560483030FAB4F9393AECC6CFF7F1F308A1E17F22AB4B386B7F86B8DDDC47541065B1D6D81674F95FE11F620423BDF65555C765D0",
-"00114B890002061FA3F76CF47636714350C4B4F9393AECC6CFF7F1F308A1E17F22AB4B3877B3EE7A3BCA5AD02EB663DFDD596A875FE11F790423BD38AAADDFBCAE",
-"00114B8A0002FB1287736F74894C2E118F50B4F9393AECC6CFF7F1F308A1E17F22AB4B38785928E53726FAB444681C41FCF97E295FE11F980423EDD355579430A6",
-"00114B8B0002C9F29AA1F91538ADBDDC153DB4F9393AECC6CFF7F1F308A1E17F22AB4B389936D74684BA6DA8FE3B8D085976823C5FE11FCD0423E0B7AAB41C4E31",
-"00114B8C0002BB0E141C1B2148C5781CFB64B4F9393AECC6CFF7F1F308A1E17F22AB4B38BEF9EC9880D1112D8D0C0C23066D762C5FE120140423496DAAADCA505E",
-"00114B8D0002F70AC610477C76C3946019B3B4F9393AECC6CFF7F1F308A1E17F22AB4B38CDF3DCBABEB2F731BB66666F662E15ED5FE1201D04224920AAAEE5B30A",
-"00114B8E0002AB8EE0663BD1942EFBB52D6CB4F9393AECC6CFF7F1F308A1E17F22AB4B38C9CCBB519DF970184550CE489B55B7F65FE120290422CF38AAB2D2B126",
-"00114B8F0002C5B6F5B14DABF2A5259E32B2B4F9393AECC6CFF7F1F308A1E17F22AB4B3888539CD0846A63F028A662EF754EAA405FE1206004233E8E0007A08C9E",
-"00114B900002F6E7D3F6FDB64741ACFA97EAB4F9393AECC6CFF7F1F308A1E17F22AB4B382316547C1F47DC1AD9129F6BF6B2BC6F5FE1207504229D66555582C362",
-"00114B91000283DEDB0A5A56318DFDB2E404B4F9393AECC6CFF7F1F308A1E17F22AB4B384997F22D8CA4F8B4F9EA873C1B88D7F45FE120760422D83B555BA3D709",
-"00114B920002F0735099A7557D600D033687B4F9393AECC6CFF7F1F308A1E17F22AB4B38C1DFE5437FA0B7C5753E545CD0D78FA15FE12124042392CA000150FF52",
-"00114B93000272BCB63772F7344547BCBD55B4F9393AECC6CFF7F1F308A1E17F22AB4B38E4D99B30347211837ABEF455A93B0C415FE1213E04203B8B0003775402",
-"00114B94000233FEF0EE5FD0F4BD5A3D921AB4F9393AECC6CFF7F1F308A1E17F22AB4B38B545C75271A3E73B288972776477AF305FE1215F04205AF35555C930C1",
-"00114B9500029ADF885E74882CAACE8FF056B4F9393AECC6CFF7F1F308A1E17F22AB4B3875A3C16C42393F4A16DD7254CA67C5E55FE1216904204B2DAAAB359C6E",
-"00114B960002084203D6C676439CD4CE56A85E74882CAACE8FF056B4F9393AECC6CFF7F177CAA4A8B621435572DA9564EAD6E3055FE1216B0420B7B8555794D615",
-"00114B97000293D692D958EB6DA8AC01D74C5E74882CAACE8FF056B4F9393AECC6CFF7F13A933335B497443EAB3A90983F530F015FE121A804215533AAAB2E10D1",
-"00114B980002F36BDE01CB21C7F313E692F35E74882CAACE8FF056B4F9393AECC6CFF7F1B40F2E3E7B9A3197A9637F7A733C3DA45FE121BF0420A791AAAD2BD3FA",
-"00114B9900029DD631988BCFF1A712D726415E74882CAACE8FF056B4F9393AECC6CFF7F13EC9D9F42727DDE1D69611A34E7F9FD35FE121DC0420D04E555B9BC8D2",
-"00114B9A0002E41564FA07DA71D255D799775E74882CAACE8FF056B4F9393AECC6CFF7F17855D030E524D9352B1D5CBBD4BBBC805FE122050420D6E300025FE1C2",
-"00114B9B0002D714BB3843C1896031ACBF7C5E74882CAACE8FF056B4F9393AECC6CFF7F1A238B39F3C1AD4F80A780A4B1753C4ED5FE1222204209C235559E46CF4",
-"00114B9C0002AC557628DFE72BCF8F72A5365E74882CAACE8FF056B4F9393AECC6CFF7F12D7BA8EBD98090A05AA0996C48C927835FE1222F0420A42600018A3F5F",
-"00114B9D0002F5F00E2A1342A80A87E77F1D5E74882CAACE8FF056B4F9393AECC6CFF7F1247059A7542681DDC57BA5DE3F14FF255FE1224B042103F70001E5C612",
-"00114B9E00022D3DAD5F76A54FDB247569075E74882CAACE8FF056B4F9393AECC6CFF7F1A6E2667C4BE525C512C9076578C533095FE1225104210E4D555887B733",
-"00114B9F00026EAE0767F498D79D1A86D3DB5E74882CAACE8FF056B4F9393AECC6CFF7F1066A213746E107F81DEBECF7FB58442C5FE1225A0421984FAAAC03ACC3",
-"00114BA00002B25B863C70D60486F11705A55E74882CAACE8FF056B4F9393AECC6CFF7F1735130C0E0D0CE387F385728FFCE1C925FE12275042211365558DB3DB7",
-"00114BA10002E2D3AB8A81AFA406BF570F9C5E74882CAACE8FF056B4F9393AECC6CFF7F1AF97257C075E6D2BEFE20FA2F60E525E5FE122B50422242300074223B0",
-"00114BA20002E6CFE738E3EEE727CF5CA3F15E74882CAACE8FF056B4F9393AECC6CFF7F11C661684F957A211A224850BD48B09515FE1232004215E690001864E2E",
-"00114BA30002E5B736115A00778603E222C85E74882CAACE8FF056B4F9393AECC6CFF7F163AF171A37C871A4707AED38608655505FE12325041FBEFC000A3A0C79",
-"00114BA4000233502DFFFACE312DC059B9815E74882CAACE8FF056B4F9393AECC6CFF7F1A070B917D21463557C76C906CC7182875FE1236F04204821AAADC742E2",
-"00114BA5000239D3B0E3B5D9B6DA6F0FDA385E74882CAACE8FF056B4F9393AECC6CFF7F140B71519339ACFF1DC7437C6ACD2CD205FE12378041F6197AAAEBF30AE",
-"00114BA60002CCE18C4750C78E71A4EB11735E74882CAACE8FF056B4F9393AECC6CFF7F19366BF1777D771F8EC13D04B338EFECD5FE1238F041FCF9600027C5252",
-"00114BA7000234B66BAAFBD1970309AE8BD65E74882CAACE8FF056B4F9393AECC6CFF7F15127D87851F00F47308AECB85ACF2C4A5FE12401041FF3055555A79737",
-"00114BA800023FDE5F11A41B49DCA53A261C5E74882CAACE8FF056B4F9393AECC6CFF7F111336D8448BEB734F8EBF1B15615D4C05FE12403041E4EF50003E6D304",
-"00114BA90002AC803EB6520F24CB07B343B15E74882CAACE8FF056B4F9393AECC6CFF7F1D7253586CD5E92FAA647CB0D741B2BE75FE12426041ED99B0001B6286C",
-"00114BAA0002C48E80045A39782AC573CCB1B6520F24CB07B343B15E74882CAACE8FF056D6FD9F79A84517AFFB334F7A9ABB38FE5FE12442041EC073555A505CAB",
-"00114BAB0002BF814358C2B1AA409D4F4A33B6520F24CB07B343B15E74882CAACE8FF056ECCEA674FC9D5E79C4E9C49722614B3B5FE12472041ECBCA55575A6A47",
-"00114BAC00023E43CE18AE4459FA648EFB08B6520F24CB07B343B15E74882CAACE8FF056D3EEBC43D3B6D391CEFBDC35776997D85FE1248F041E73A300003B3354",
-"00114BAD0002FEE5722ED91D2952BD01C6B8B6520F24CB07B343B15E74882CAACE8FF05617EA50D819FCD53A93C29A17E6F4D8475FE12490041E774655556DD7B8",
-"00114BAE0002A0A96C5EA4D13A4098446405B6520F24CB07B343B15E74882CAACE8FF0564B2A14E045A7336C44519E016641D6AE5FE124A8041F06D7AAAD0DC2DB",
-"00114BAF000287F891F0B2CE7C0F0F8C0D48B6520F24CB07B343B15E74882CAACE8FF056A9DFD2E2C71B944839AC9174E874CAF65FE124AF041F2535AAAB0C872F",
-"00114BB000025D8653E83958D2F5FADB8EECB6520F24CB07B343B15E74882CAACE8FF0561641E0FCCCC1B57A6936E0DA6C184A475FE12505041F9C06AAAE897213",
-"00114BB100022F0A288DECFB16FEDA647D9AB6520F24CB07B343B15E74882CAACE8FF0567A14DCC32E6F7C6DBC347B38498AB0E95FE12572041E82560002DE8A83",
-"00114BB20002F79B58BFFAA31E789381237AB6520F24CB07B343B15E74882CAACE8FF056E0D6D6D680E7C15F3BB73DA4C194B4BB5FE125AC041D1482555AC12586",
-"00114BB300023C17BE4D134475888E116447B6520F24CB07B343B15E74882CAACE8FF056615402D6C38AFAD442CB49389AF316B25FE125F3041C9E38AAAC9D88E5",
-"00114BB400022F365281D1BF246E324FB4F7B6520F24CB07B343B15E74882CAACE8FF05693A8FF4C6A91C2436E70ACE268BED01B5FE125F9041BF459AAB6EF1FA9",
-"00114BB500024E577E7C5DE7D45599AC5C93B6520F24CB07B343B15E74882CAACE8FF0566428D086CF6A6E62254A0BC7285C84615FE12632041C58C2AAAB81D42D",
-"00114BB60002A765A7F85375F14E680B3F0EB6520F24CB07B343B15E74882CAACE8FF0560AA277D4DBA24756919EF5A0456B49775FE1264E041BE59CAAAF7BEA89",
-"00114BB7000260696584C63650C8B7874431B6520F24CB07B343B15E74882CAACE8FF056B1B2E04A37637D318914E5E26351BDB05FE12662041BEF01AAABB79A1D",
-"00114BB80002CD56C934710D3927BA2EE807B6520F24CB07B343B15E74882CAACE8FF0564C378DC731D2F9D652F94AB25127E0735FE1266D041C1830AAAC2DB511",
-"00114BB9000279A56E188676D52400F3F268B6520F24CB07B343B15E74882CAACE8FF0568087FFA71F2726E614EB08F059E37C355FE12687041C60CD5556260023",
-"00114BBA00020BA47F53D67B40E9414AB7EDB6520F24CB07B343B15E74882CAACE8FF05633AA824EA876F468B787AC9491180C625FE1268A041C708B00061F5990",
-"00114BBB0002FA416C4EB1D5C4D5BD8043E1B6520F24CB07B343B15E74882CAACE8FF056D559EF18FEFF9E337EAE504C77AAF85F5FE126B1041CE649555A2F5349",
-"00114BBC000213D552A41F2FF511F27E41F8B6520F24CB07B343B15E74882CAACE8FF05675CEADC9E06FE080B6233BAA376957775FE126F7041CBF2EAAAE198C54",
-"00114BBD0002F6A7600F7AD687A1010B1475B6520F24CB07B343B15E74882CAACE8FF0569180465B2A043F38CFDFCADE9D06CAF75FE12715041C151000006E342F",
-"00114BBE00022F516069F5DA21E9BB43E7C00F7AD687A1010B1475B6520F24CB07B343B1BC9D4F8DAC99AF81BACDC24D8B48DC225FE12729041C125B555765035A",
-"00114BBF0002641041E41E4160477E278D2C0F7AD687A1010B1475B6520F24CB07B343B1DC12DBBF602D76F87B1D5C7D95BE451A5FE12730041C3E9F000A6FBA97",
-"00114BC0000281A0580956ED348E7B4531AC0F7AD687A1010B1475B6520F24CB07B343B19F5D9F4AF20049342E8D23DA61370D865FE12762041C9E2455591399E6",
-"00114BC10002643D7AAE8BC33E0A0F04661F0F7AD687A1010B1475B6520F24CB07B343B1FF4717F3384DA9986A26812F8C3CD9895FE1276D041C472455585E264C",
-"00114BC200023AEE34CC231F558E269167F40F7AD687A1010B1475B6520F24CB07B343B19B1FF719C1FACDE32961BD2F7F3678075FE12776041C9A43000285DEAF",
-"00114BC300023D90F8871DE4D9FF48AD9AC50F7AD687A1010B1475B6520F24CB07B343B170D4C614434A7D6DE0F4E45A7B10FE665FE1278A041CF7A0AAABE7EFF0",
-"00114BC400028747CC4F7559313B32705F1D0F7AD687A1010B1475B6520F24CB07B343B1AD8F898917D40823BD6AAB00076CE4535FE1278E041D25AE0002DF253A",
-"00114BC5000231E05158D09828A04DF5FD5F0F7AD687A1010B1475B6520F24CB07B343B1C919C02A0DAA72B7D89272701B19BD295FE12797041D9E5D0009E03D76",
-"00114BC600022ED79E698F006754786F4C9C0F7AD687A1010B1475B6520F24CB07B343B1375921735E4D5DDA0E3B9FD11AAE48825FE127C9041E015B00070C48DF",
-"00114BC7000206B33583E65AABABD6CC07350F7AD687A1010B1475B6520F24CB07B343B1311AB0E9BC07F738D1E316A97900C21A5FE127F2041DA2F2AAB1A5EB85",
-"00114BC80002AFE1F6EB31251FAAC82843190F7AD687A1010B1475B6520F24CB07B343B1FC3B1B05F5BBF6EECA7B474322806D225FE12841041D7210AAB0239CC3",
-"00114BC90002F574C00B8A3E89100FFB51C10F7AD687A1010B1475B6520F24CB07B343B1B1AAE79061C13F4249B64B76F782E3AD5FE12871041C961B000390774D",
-"00114BCA00029DC6DF35E6F7DAAFCBE610310F7AD687A1010B1475B6520F24CB07B343B1991B0D4C2A8A24ECEA95045A2616ADD95FE1287C041C4BA4AAABA8BC8E",
-"00114BCB000246E0CF2B07D672DCD7B109EA0F7AD687A1010B1475B6520F24CB07B343B1D004496091BBD118EF7F1D1C6E3329665FE12889041CA0A4000163176D",
-"00114BCC0002BF76766E741B657C4CF572E40F7AD687A1010B1475B6520F24CB07B343B1D1DF36E2B23FCB0C85DD54A734A404545FE128A3041CEC525555CB022B",
-"00114BCD00027E8B192A16BB547ADBBDC4300F7AD687A1010B1475B6520F24CB07B343B120EB5CFE9F7CD1048CAC05516576D5F25FE128A5041CFE160002FD2A08",
-"00114BCE0002E42F86797E423339A3B8F8690F7AD687A1010B1475B6520F24CB07B343B1CA58BD996BA2F594569FE13579DAD8DE5FE128C2041D8077000A6EF5B6",
-"00114BCF0002A63FA058303FBB2B0EB43EFA0F7AD687A1010B1475B6520F24CB07B343B10E2DF82C8F897CBCE23B48706E521BE25FE128F6041D84B85557B62128",
-"00114BD000021499FCF8D3F7FDB0F1B0A5F20F7AD687A1010B1475B6520F24CB07B343B16AD794B462380E2684F15FE42AD38EA45FE12913041D1F68AAACA09FBC",
-"00114BD10002136134A13E353FB91FF77F900F7AD687A1010B1475B6520F24CB07B343B18A5475E18150C95EAFF810A6415713EB5FE12919041D249D00033D1ED1",
-"00114BD2000245CB3085094B84249AEB48ABA13E353FB91FF77F900F7AD687A1010B14755EDCA54D8B00AD592011B6453A0243565FE1295B041D94E9555818D191",
-"00114BD3000233F2E34FC80C720AF878B0FCA13E353FB91FF77F900F7AD687A1010B1475FD5800B89A830BE795C4657D27E38B5F5FE12963041CEFD15557CD5F34",
-"00114BD40002F30F1C84470E7431FC80763EA13E353FB91FF77F900F7AD687A1010B1475AD4DD18212C69E8448B1813F467F6E0E5FE1296B041D578CAAAB9E1134",
-"00114BD50002A88B7BCAD57D25EE498A6448A13E353FB91FF77F900F7AD687A1010B1475AD7BF0B97444A8580BD29361355D9CEC5FE129A4041DBF52000994F861",
-"00114BD60002F59684BEE9E5C7BFDBA32EF7A13E353FB91FF77F900F7AD687A1010B14755C5A4E1C4947245ADD69FC5322149EB95FE129D4041D41BE555C4DFE45",
-"00114BD70002D7279A7691A9F3345D094E83A13E353FB91FF77F900F7AD687A1010B147572091B25C833BA3CB5022DC68B1DBB505FE129E7041CF1F40009F4640E",
-"00114BD8000212FFF50A44CBD53623102CD3A13E353FB91FF77F900F7AD687A1010B14753448D1448723D317583A49F7737B9ED35FE12A30041D26790005FB89F9",
-"00114BD900021CFEBE57BD611E1519B3D67EA13E353FB91FF77F900F7AD687A1010B1475E907C7A58BD9E9EEA501F17998EDFFA65FE12A57041C668AAAAB74FD25",
-"00114BDA00023029A9431F2B3AAE37F692C2A13E353FB91FF77F900F7AD687A1010B147582C861B9ADAD68475A61AE581E47DFA25FE12A6A041C413F00057625B1",
-"00114BDB000210BCDD37038C41C91AE1E9D1A13E353FB91FF77F900F7AD687A1010B14751173161A93A6A3EC47D28E63258F379C5FE12A7F041C7135AAAD004BCE",
-"00114BDC00028DFA914C78278EE2D6E43FA8A13E353FB91FF77F900F7AD687A1010B1475E0A87951E18928125F128309A9CDD88D5FE12A86041C99F0AAAF385A95",
-"00114BDD0002F96E8C7521209EFB681867A0A13E353FB91FF77F900F7AD687A1010B1475CF1BD408F0F681D25A630F0A8EAE178B5FE12A92041D02F1AAAAD13820",
-"00114BDE0002D2849E6E247A6FA5E4C1FCAEA13E353FB91FF77F900F7AD687A1010B1475D69C901860DE6E53512902C86A6B56FC5FE12AC4041D56E5AAAAFD60FB",
-"00114BDF0002D748CCF1AE76D4A7682CE015A13E353FB91FF77F900F7AD687A1010B14755A4CE43CDCCCF095ED84E940CEE081EA5FE12AC6041CFB68AAAF5E2AC7",
-"00114BE000029B320497B70A7F9D9A1D80F3A13E353FB91FF77F900F7AD687A1010B1475C5A4C500113F2F86F6F4EB1F156138675FE12AD3041D7FDFAAABBB06A4",
-"00114BE100026B8891CCDA2622A85EE7E71AA13E353FB91FF77F900F7AD687A1010B14759DEAEE2628CB9CC700A351FE538CE31B5FE12AD6041DD07F00036A3E77",
-"00114BE20002744B505109E46C4A6390F898A13E353FB91FF77F900F7AD687A1010B1475FD776BAB4336CB1E9035D158D860B3765FE12AE5041E55ECAAAEBF155F",
-"00114BE30002B349CD2C8C557F516341FB90A13E353FB91FF77F900F7AD687A1010B14750D0E911CB9D57EEB87FE4E6EE1778D335FE12B08041EA20BAAAC360F19",
-"00114BE4000281F7BCE61CA6F5254131E4FBA13E353FB91FF77F900F7AD687A1010B14757686100A6694F52F8073F6279A95BED35FE12B23041E888D00014055B7",
-"00114BE50002CB19A701BCA8793CEBBC38A6A13E353FB91FF77F900F7AD687A1010B147522A420D5C44E523A018D2985423A863A5FE12B35041E97D8555A3234AF",
-"00114BE600020A9472DCA4892375CFC653B001BCA8793CEBBC38A6A13E353FB91FF77F90327BC3E155269E6C861E0BE9730EB45F5FE12B47041ED4BE00006C19D7",
-"00114BE700027BBA4E50860C64E67A82902601BCA8793CEBBC38A6A13E353FB91FF77F90FBC49A770A23BA9A264F2E176A5FDAE05FE12B4E041F13845559451FE3",
-"00114BE80002E059053DF47FBC6906D5E85101BCA8793CEBBC38A6A13E353FB91FF77F90CA002D34C7C01E4F0275BF1382DF6FC85FE12B59041F90A9000299C171",
-"00114BE900027A7ACABB225C0B336C54F2FB01BCA8793CEBBC38A6A13E353FB91FF77F907BDC499647D346223F366AB578952A5A5FE12B63041FF8BDAAAC1C6B6E",
-"00114BEA00021FC88E82E23F04E14AC16CAA01BCA8793CEBBC38A6A13E353FB91FF77F90BEEAC8D7C4774D2D09E43F948CEE6DCE5FE12B7204206C58555964F528",
-"00114BEB000234CF2C3E7E30B8F322C34FE101BCA8793CEBBC38A6A13E353FB91FF77F9057B1825F872063DA697589187876A4015FE12BCB0420C2295558ACE16F",
-"00114BEC0002FFF789AA61210B1C0B4D826801BCA8793CEBBC38A6A13E353FB91FF77F9043D1FF11E626B28B1DDFCB689518C85E5FE12BD5041F72D6AAABA72E2C",
-"00114BED0002307BE65D9D5E7DD003999D6201BCA8793CEBBC38A6A13E353FB91FF77F907F7F3FAD29184F8D3D60B7DD3C24BE635FE12C3D041FE5CD00038709A5",
-"00114BEE0002E7984277B23384217027AAA501BCA8793CEBBC38A6A13E353FB91FF77F9075EC1C43EA69BD0BCD17E7663B357D925FE12C5C041E57680006E09681",
-"00114BEF0002A054AC8D9B30B2CA84D8B2E901BCA8793CEBBC38A6A13E353FB91FF77F904253339E68FBB5E5A8571CB5A53208C95FE12C6F041E55C9AAADBA594D",
-"00114BF00002B209E11C75D9F393BC773A5501BCA8793CEBBC38A6A13E353FB91FF77F9052F8653E5EFC31FBCDF800201B4CE18C5FE12C7C041E8D1DAAAE9FDC30",
-"00114BF10002FFC206672A1034AC6B35E03501BCA8793CEBBC38A6A13E353FB91FF77F90C75C55E70E7FB68BBEBFA19DCC3EA5345FE12C91041EE407555AAF6B47",
-"00114BF200028AD703ACA8118E2F184E7C9801BCA8793CEBBC38A6A13E353FB91FF77F906350E724D2C64FB38D7D2F20C7177F2B5FE12CC5041F152F555E8F5344",
-"00114BF30002A6914D8F5FE3AAD333A1E97201BCA8793CEBBC38A6A13E353FB91FF77F90E7D4345A460E48079689A09DB35A3C925FE12CF4041EA0DBAAACF9921D",
-"00114BF40002A15C4346CFE0F1CEF2DA81F401BCA8793CEBBC38A6A13E353FB91FF77F904E42F8779BC3AFA5B66C4EEA4F8762205FE12D0F041E486DAAAB642B1F",
-"00114BF500029E718DA7F4A2E2AA8C962A2E01BCA8793CEBBC38A6A13E353FB91FF77F90A34177D2F5DA5B2E49E4BB525A28C61E5FE12D27041E598C0005C4926B",
-"00114BF60002094CC69D75312DF8E28616CE01BCA8793CEBBC38A6A13E353FB91FF77F908D3ACE34818831E23FE838D15E2F11765FE12D37041E7A4C0002E0EA93",
-"00114BF70002D7C94349472F0BA78EDBA80701BCA8793CEBBC38A6A13E353FB91FF77F9097BC0D1135EF7773A1C322C146E493EF5FE12D54041EBC0A000365C18B",
-"00114BF800028DD0C774E69529D5BEFEF60201BCA8793CEBBC38A6A13E353FB91FF77F901DF4BA1F142A45A1776D8471EB41BFE35FE12D5E041EC1DFAAAF54671D",
-"00114BF900020795C92B1913A18A9A46FC8901BCA8793CEBBC38A6A13E353FB91FF77F90A911DF50ABDF652B662675EA40059E945FE12D8A041F2EA955559C84A9",
-"00114BFA0002CE614E8855037B39656728192B1913A18A9A46FC8901BCA8793CEBBC38A624A1106C88DE65BA9C9CC49AB93848CD5FE12D8B041EE38A0003E50A50",
-"00114BFB0002D68CFF7D616F9481661B9DFF2B1913A18A9A46FC8901BCA8793CEBBC38A6292EA47CACFFB49B70588AF3CAB9B4135FE12DAC041F8624555D09643B",
-"00114BFC0002E4D094D50B5B63DF15B37D5A2B1913A18A9A46FC8901BCA8793CEBBC38A64CF0C1AE169DE938149304413E3B608F5FE12DC1041F72E5555B563C93",
-"00114BFD0002A09D363872F2E6DECB46F5462B1913A18A9A46FC8901BCA8793CEBBC38A688E4B82DD56AAB012FD3255CDC30A9315FE12DD2041FA72A0002CFBF6C",
-"00114BFE0002373D767C1C4F82A43B0B342B2B1913A18A9A46FC8901BCA8793CEBBC38A663017BAEBD0743E995A1BD7BA6FA93AF5FE12DE1041FF21000020488D8",
-"00114BFF0002B29DFE5BFFE0B165A73952552B1913A18A9A46FC8901BCA8793CEBBC38A65AFB5877CBAA46E1FC9786AC09A7A1295FE12E2804204946555E7E459E",
-"00114C0000022E64D9260FFE86DA332C8F292B1913A18A9A46FC8901BCA8793CEBBC38A646178CDFF63D81699B04F304564E21845FE12EA5041F5EC100011102DC",
-"00114C010002C739E08E2CF1A12D311221B72B1913A18A9A46FC8901BCA8793CEBBC38A63937175C5D9EECCC767D14516AAFDF575FE12EAC041D72740001275080",
-"00114C0200022F3235176C600782C15C50372B1913A18A9A46FC8901BCA8793CEBBC38A6EBF19A9BF9FDAE5EE1705132D18C443C5FE12EAF041DEA95AAAB56D0BC",
-"00114C030002311DC0235F57FA4A502BBFBD2B1913A18A9A46FC8901BCA8793CEBBC38A61D29DD3C01FE1F9FD18A5C9051FDE0B95FE12EBC041E76A6000544C87D",
-"00114C04000273F53719BF4D4AED708B9AB32B1913A18A9A46FC8901BCA8793CEBBC38A6739AE77A0E9F85914C8E7EE52D7139035FE12F24041ED185555A840CEB",
-"00114C05000222967C9B722D0FC8146C280C2B1913A18A9A46FC8901BCA8793CEBBC38A69EACF4F4B61CD45F659092C39BB9A9D15FE12F33041D5561AAB41C9AB3",
-"00114C0600029ECE913ECC785A37D4D83B1E2B1913A18A9A46FC8901BCA8793CEBBC38A63B7D75973FFB2E86918CB263A9C45F5C5FE12F84041DA1ADAAB3095FD4",
-"00114C0700023C6F7BB2714990AA62969DBC2B1913A18A9A46FC8901BCA8793CEBBC38A65F4EA8F50B830FC11F9778E5D0540C6D5FE12FB2041CA708555AC78C0D",
-"00114C080002807AAEBE73B75402AFB3B80F2B1913A18A9A46FC8901BCA8793CEBBC38A632466FAD3F540FAEE33A6103B53EE8B25FE12FC1041C60EEAAB133F232",
-"00114C090002A3E039977B2D5A3FD5C6DDD42B1913A18A9A46FC8901BCA8793CEBBC38A60871BFD761B73EF5D19A16525DCA27005FE1302D041CA570555CB3A520",
-"00114C0A000248BC61DA75248AD4C3DF16532B1913A18A9A46FC8901BCA8793CEBBC38A6AD6E5BB1939A5EA754AB68B7187DE88F5FE13057041B49FB555639F1A8",
-"00114C0B000299BBB63367324013FE68038A2B1913A18A9A46FC8901BCA8793CEBBC38A6BAFE4CE74E6030B8964555D9145AE41E5FE13079041B1AE80000E41703",
-"00114C0C0002AD358730DBCA6345B70591AA2B1913A18A9A46FC8901BCA8793CEBBC38A66BCE5EA1FA6BCD87B3BF828C9B8C881E5FE1307D041B072AAAACFD8C4D",
-"00114C0D00029A3C9793DD4C1F14575AF1792B1913A18A9A46FC8901BCA8793CEBBC38A644E441E5394A0B01338F8DCDC6E9C3B35FE13084041B77A3AAAC1603EB",
-"00114C0E00021F6A952DAACE5126EA5E886A93DD4C1F14575AF1792B1913A18A9A46FC89FEBE7E550A147383DD96D82269CD88D55FE13088041BDBCA555F01BEF8",
-"00114C0F000230CB9E9C69DF5DFAF9AAAEF793DD4C1F14575AF1792B1913A18A9A46FC89A604659D410358E61358E93EDBA52CF85FE130E2041C5141000665B3E9",
-"00114C100002F95D81F58A43F6BAA7A799F193DD4C1F14575AF1792B1913A18A9A46FC89C2A64B6B8E6589D28A41F5E8B7EA57F05FE130F4041B454C00001C2484",
-"00114C110002EF01C4680EA26EBED8FD7DEE93DD4C1F14575AF1792B1913A18A9A46FC8927483DC02FC8AA7DBB518A3BB600B9585FE13115041B7C0600003B034F",
-"00114C120002D1617D0E8FE7C4218241BA4693DD4C1F14575AF1792B1913A18A9A46FC89A9BE03EE1529FD84F3F3EE60B0EDB2BC5FE13117041B7032AAAF62573C",
-"00114C13000293217472726A768504C23B7E93DD4C1F14575AF1792B1913A18A9A46FC89CB8E2A692B15D8D746017980F1AED1945FE1315C041BECC25558DFA1E0",
-"00114C1400021F7CC5AA4027AEBF694AF40593DD4C1F14575AF1792B1913A18A9A46FC89A4443DF87A4C41B6551FDDEEEF197C4D5FE13166041B4193AAAB19A5AA",
-"00114C1500020C8BBC5E444F49FC4BABDE9A93DD4C1F14575AF1792B1913A18A9A46FC89AB92DFE5D908E145A088F2C944CC84D05FE1318D041B97FA0000DFC25F",
-"00114C160002A02D4A5C8B36057F3B0B3F0893DD4C1F14575AF1792B1913A18A9A46FC895A4919F4A45120AAC149065647E3F2845FE13190041B6CB2AAB03BCFFB",
-"00114C170002F4C93F1F8A9EDAEBF087BA9393DD4C1F14575AF1792B1913A18A9A46FC89432D4C5428E73651D8B564069C6F48055FE131D2041BE3E355555AAFFB",
-"00114C18000260FE169352E6A43B7EDE009493DD4C1F14575AF1792B1913A18A9A46FC8910B39DAE6DF241A34EF80BF0430188595FE131D3041B4285AAAE9439A1",
-"00114C1900025A45649F3F3DA2C92F013E1B93DD4C1F14575AF1792B1913A18A9A46FC896AF4471CAD5C5B6AF43B35F531EDEEC25FE131DE041BC46400003DAD47",
-"00114C1A0002056B90D826FCAEC6A4FF16F793DD4C1F14575AF1792B1913A18A9A46FC890806F2F3916F34ED004C431C5F0603895FE131E8041C17F90002A8BB57",
-"00114C1B0002A7CD115848A9903F1E413A8993DD4C1F14575AF1792B1913A18A9A46FC892E0CC2385118848D747FE6147F24A9305FE131FB041C73E200087CC556",
-"00114C1C000209287ED0E89BB6626C9B7FD993DD4C1F14575AF1792B1913A18A9A46FC893760D49E15FE02F5C1D377F1CD518CB05FE13229041CA755AAAD7DCE65",
-"00114C1D00027B75ADEA043F352B51CC7AC993DD4C1F14575AF1792B1913A18A9A46FC89255817497A18BA863F9A49F757369BAF5FE13235041C5C4500018F464B",
-"00114C1E000248FA652EB73C5417A0FE7DBC93DD4C1F14575AF1792B1913A18A9A46FC890568CA5728133B95B571E1AB74BD87165FE13244041CB2455555984F8F",
-"00114C1F00028AF7C1311B470C3B536ED2D393DD4C1F14575AF1792B1913A18A9A46FC894DA11C3AFA05DD07AE02DEEECEA5E1A25FE13245041CFB38AAABBAD0FC",
-"00114C200002DFB4DD15AF13BADB6D1429DA93DD4C1F14575AF1792B1913A18A9A46FC891BB1E006B294955BCC413B54D9CAB3325FE13249041D8A490001BC111B",
-"00114C2100020B762DC5D64202A11767AC4293DD4C1F14575AF1792B1913A18A9A46FC895F5DD615EA3D56782D3F72EF9C1F22F75FE1325F041E0CC10000928412",
-"00114C220002F7E192D7A292D9485F91D654C5D64202A11767AC4293DD4C1F14575AF17956C1487C4D9F8C752874276F507D31E55FE13262041E35480004DC776F",
-"00114C2300026ABA1E4FFAF89B2528C84B5CC5D64202A11767AC4293DD4C1F14575AF179D2BB5AF40014ECAF0E6F25663AF8CC905FE1326F041EC68800025B40B3",
-"00114C240002CFAD8F32C12731F6884EB446C5D64202A11767AC4293DD4C1F14575AF17979B199F20595F2D79BD1F4EE4C3EF77D5FE1328F041F2459AAAFA96353",
-"00114C25000256EAA1F424454DBF8BDD55C2C5D64202A11767AC4293DD4C1F14575AF179238B1DDF612F34A7C5B106DBAF88E05B5FE1329D041F170E00014F35D0",
-"00114C2600024DAEB1B9F0FAC636B1885B89C5D64202A11767AC4293DD4C1F14575AF1790677BB3A4393CF751EA0BEEAE2FDDBF85FE132C0041F727500097D5139",
-"00114C270002965657F33E358D428CB3D7BFC5D64202A11767AC4293DD4C1F14575AF179A5793E9E0EAFE216D1A4EF9666ADC2495FE132EE041F563B00021D86C6",
-"00114C28000247DD0419E544A8BE0C441377C5D64202A11767AC4293DD4C1F14575AF1795793B89204F13AD21F2E47DA5BEC61DB5FE132F4041EFDAEAAAB07E6FC",
-"00114C290002B2AE00EA88737FDD192CAA6DC5D64202A11767AC4293DD4C1F14575AF1799208AEB24BBD110FCE607C310CE58D125FE132F6041F878C5557D7E112",
-"00114C2A0002F3388EE48ED4DC92752E0632C5D64202A11767AC4293DD4C1F14575AF179160CBD620CBD77960C2CEDE8E474B65E5FE132FE04202B62AAAC5BC1A3",
-"00114C2B0002680A19F33C9D4CE0E4194CCBC5D64202A11767AC4293DD4C1F14575AF179E192DB0D17D26795368F24295FAE70B45FE1330A0420AE37AAB186F498",
-"00114C2C00026E05012F480F99DD154C669AC5D64202A11767AC4293DD4C1F14575AF17909B24854335857D7188A2DB1BFA7A92C5FE1335504211CA25558496AC9",
-"00114C2D0002AF2C098EC321813F7ACB2ED1C5D64202A11767AC4293DD4C1F14575AF179E7D69322945DE90E8EAAE489A4415FA45FE133600420069CAAACC58553",
-"00114C2E00022279A66A7B2706D7D702DED3C5D64202A11767AC4293DD4C1F14575AF17978779B3D27F5C6A2387878C40FE14ADE5FE13366042079C8AAAC787086",
-"00114C2F0002EF080D1A2594693C11D3F03AC5D64202A11767AC4293DD4C1F14575AF179B62E57F32B4251DA6FCA207A08F639715FE1337B04210CC5000160DF25",
-"00114C300002FBC1C777DB6AE29DB3A7C5DAC5D64202A11767AC4293DD4C1F14575AF179ACAD5BE8A02C2A70E32AC18BC12C30BA5FE133900421447B55599CEBA2",
-"00114C3100024AE5CCC2796490A590767190C5D64202A11767AC4293DD4C1F14575AF179AC7022A88EE339E83409F305EBBC99855FE133A404217D44555650CD51",
-"00114C32000262A199A335F079D7EDABB894C5D64202A11767AC4293DD4C1F14575AF1799197DE96230C1D142C109B15D75FAA0A5FE133E10421BED2000013017A",
-"00114C330002C60CCD2BF306201038269B74C5D64202A11767AC4293DD4C1F14575AF17953EF33ACF38FF3125E58986100BA6A105FE133E20420F9D20001BF2FE6",
-"00114C34000233EC66AEB871DF6651EF5EF2C5D64202A11767AC4293DD4C1F14575AF1791E10C2A44A75BAFEC7FD5CE2D837DFBF5FE133E70421B248000C667D87",
-"00114C350002EA10B103BD62BBFBF8287361C5D64202A11767AC4293DD4C1F14575AF17966ED637A022D2A4BB3E4F3613922D7E05FE1346F04225489AAAC0491A6",
-"00114C3600024F1A3EA4C41CF310F11EADB103BD62BBFBF8287361C5D64202A11767AC425661211ECB3257ADC95E6D56A91D80DF5FE134A8041FC44F000C6E8BCF",
-"00114C3700020123201A4B86428281BAF32703BD62BBFBF8287361C5D64202A11767AC423A6607434303383472DD15CC793F2FE25FE134FF041F31DB555E21C494",
-"00114C380002D1318FA075AF4C6471BD5BCF03BD62BBFBF8287361C5D64202A11767AC42A185BB1EE6B647B47D97DF7B68079C765FE1352C041E0670AAAFD84E08",
-"00114C3900024CC79C38ED27373508F070C103BD62BBFBF8287361C5D64202A11767AC4291C328DBAAFCE1647A4AD5F452A044835FE1353A041DBF145555617189",
-"00114C3A00026FBE8144866F79872397270E03BD62BBFBF8287361C5D64202A11767AC4295E11DA45FBEA4C446EEEDDE7A7ADC2F5FE1353B041E0FCB0000A83D2C",
-"00114C3B0002163D7141AABF1B3F0B1262C703BD62BBFBF8287361C5D64202A11767AC423873AB030F59856FF3607924532277485FE1353D041EA56B555A01AF5F",
-"00114C3C00023E9B243F1DBF5B7235364C7003BD62BBFBF8287361C5D64202A11767AC428DD54E017E4FB9196D5F34554BA4FB665FE1356D041F3C14AAAB98AFBF",
-"00114C3D00029324739A9BBB9E7DD4E807E503BD62BBFBF8287361C5D64202A11767AC42ED1FB1125A6ED2657462A1B13FD9B7B75FE13571041ED653AAADF06FDC",
-"00114C3E00027CBD0244BB2E2A55731EDF3C03BD62BBFBF8287361C5D64202A11767AC42A3C47452AE6BBD394953F55DD3EBA6F55FE1357A041F64B8555A687F0E",
-"00114C3F000286456D34E3EC1D28F296AC5003BD62BBFBF8287361C5D64202A11767AC42A9F7230C160AADD8D7E9625CC55511995FE135AE041FD9CAAAB1E7DFAA",
-"00114C4000021776D93CCADDC3FF7EF9B45103BD62BBFBF8287361C5D64202A11767AC422E46A2D34C6041C658BADA3D215ED44F5FE135F7041F5CD7000096FC41",
-"00114C410002B5E79098961AA134068640E803BD62BBFBF8287361C5D64202A11767AC42DCFA3ED90F8A553241DA6FAA3E7241D95FE1362F041E77D9AAAFAEF59C",
-"00114C420002C01AC6B84212393CE89ABFE003BD62BBFBF8287361C5D64202A11767AC42391BFCFBF73696B0D535C5290037F5C95FE13653041DF5A35555947230",
-"00114C43000216436FF2861F00119D44D45503BD62BBFBF8287361C5D64202A11767AC423449F09D339F03D2AF32FA3FA3D7C1535FE1366B041DD7F7AAAB7725E4",
-"00114C440002A1F12BF15329A124DB33501E03BD62BBFBF8287361C5D64202A11767AC4216E41A9CDC0590F1F31C7F87B125D2875FE1366E041DF7F4555686C66C",
-"00114C450002B94C71D477754DD90EF54B8503BD62BBFBF8287361C5D64202A11767AC426069510969E050C1EBE84A031BD058CC5FE13674041E837A00045598A7",
-"00114C460002E3ADA31E7EC35780298D4A9503BD62BBFBF8287361C5D64202A11767AC4243AC67CE0B4E0B01D8692899165C41225FE13694041F03620000FB74D7",
-"00114C470002C43E6CD8688F15D2590F251603BD62BBFBF8287361C5D64202A11767AC424D37E7C29E43885E751ADE82B36780CE5FE136DB041EF8755559DE67BE",
-"00114C4800029C5BEC11FA76DEC54CE82A2003BD62BBFBF8287361C5D64202A11767AC42BEB1CD654A21758CE09F8A9404FCCBC85FE1371E041E21C2AAAE71A16D",
-"00114C490002FF0098D3DDB583A6023E199803BD62BBFBF8287361C5D64202A11767AC42C4AD3A82CE629C5AD2FF929FEA6FBF2A5FE13729041D6C1F55555DDEC8",
-"00114C4A0002E367254023E68B73A96C826AD3DDB583A6023E199803BD62BBFBF828736195CD8F1048C60197402E1888966E61EB5FE13758041DCC7600002EA3F9",
-"00114C4B00023975A5CB800E390139739E55D3DDB583A6023E199803BD62BBFBF8287361EEAC62FBDE3CDF55F10CAFAA5491DB625FE137A8041D789C000BC9F637",
-"00114C4C000274929A957698ACDBBA498766D3DDB583A6023E199803BD62BBFBF8287361FD9E79154BB592C46D6128EF462A406F5FE137E5041C8E44000354E535",
-"00114C4D0002D526E1EAA3B4BFF6B76D0435D3DDB583A6023E199803BD62BBFBF82873611769645437580E16A07477512DEE1ECB5FE13803041C05EB0001447967",
-"00114C4E0002F73B6EB7576274D0EBA0888ED3DDB583A6023E199803BD62BBFBF8287361F272CCFD4635A64F66C1588CF89BCE7F5FE1380D041C081EAAB11A065E",
-"00114C4F0002BA2BC74CD5CC32F3D3F0709ED3DDB583A6023E199803BD62BBFBF82873618ECC4184E18A50F3D7D9BB78DBC418D75FE13833041C62690001A043F5",
-"00114C500002B2BFD540DD012A8FA7928C2BD3DDB583A6023E199803BD62BBFBF8287361FB3556FEDE3B86E6791A6EA0EEEC83565FE13838041C3A7455580ED675",
-"00114C510002B43291B381D3BFABE19B514ED3DDB583A6023E199803BD62BBFBF8287361E88C50B0B720AF0B2C6D2C213D949B835FE13840041CAE77000533F914",
-"00114C5200025A1292CF94536CBBADFFB348D3DDB583A6023E199803BD62BBFBF8287361B84B78E14FB9AFA4A8629C1793DCB7865FE138AC041D11D00001A04BE5",
-"00114C530002207BECAE3A3399A2DF63B539D3DDB583A6023E199803BD62BBFBF8287361CDCF208199B5C45F47E654F8BB81C7385FE138B1041BADAF5555AE2A2F",
-"00114C54000285E607B7C5867B1A5734A18ED3DDB583A6023E199803BD62BBFBF8287361EE7F13015B20FF71476D87145195B9A85FE138B3041C2036AAB30274DA",
-"00114C550002D3754DA6D79F3843326861D5D3DDB583A6023E199803BD62BBFBF82873611C03C2A1D20A4ACB7F0AB1385BB204615FE1391C041CA034AAAE30AAC3",
-"00114C5600028A01EC378F1BF30284093632D3DDB583A6023E199803BD62BBFBF8287361E9693C54967375F11E58443227B1CC645FE13926041B52AAAAAAD55A48",
-"00114C57000206C3A256371A66707A1A8247D3DDB583A6023E199803BD62BBFBF8287361EC174C785EAE16AE4709547658A9CDDB5FE1395F041BAAF2AAAB1BAA67",
-"00114C58000233A4F702C3B7927EE31EDD80D3DDB583A6023E199803BD62BBFBF828736181BAF080E1B8459CFD7B8DC986A677BF5FE13961041B361A555C0E2BD4",
-"00114C590002511E1E96EA31E5B567BF5812D3DDB583A6023E199803BD62BBFBF8287361920ADFC84E857EC45DA4C229F2D90F435FE13998041BAFE25559031D65",
-"00114C5A0002D7FB683D3896359DF018E979D3DDB583A6023E199803BD62BBFBF8287361AA4161E1ACDEB4DA14DBA467BE91B50A5FE139B8041B43DAAAAC932FC0",
-"00114C5B0002FBFFFF5920FD64E4A7AF4B7ED3DDB583A6023E199803BD62BBFBF8287361CA56037F55C2C2C1A7CFA7FBAB5BFEDE5FE139BE041B3D53AAADBA4146",
-"00114C5C0002A1956CEA70C9F9D201D94FE6D3DDB583A6023E199803BD62BBFBF828736107FBE6034E88F7782827E0BCB7A597D75FE139C6041BA50E5558FFA3D6",
-"00114C5D0002B55CC73E740D7C3B1ECDD4FAD3DDB583A6023E199803BD62BBFBF8287361FFFCE9754D44046EECDB2A76DD68CB065FE139E6041C06E05556FB6836",
-"00114C5E000260638E6350D91A46525149563E740D7C3B1ECDD4FAD3DDB583A6023E199866227373D8F28288A2A8FBC4551A627E5FE139EB041BFCA65555E1901F",
-"00114C5F0002CE0D04A2E37C62C75449AA5F3E740D7C3B1ECDD4FAD3DDB583A6023E1998A20EAB2BEFF8207445E01BF66CE5BA785FE13A14041C708B00020E5570",
-"00114C60000238A5E6B27493697513D1C4803E740D7C3B1ECDD4FAD3DDB583A6023E1998E44ED94749E21ED879D9EC301CA106BF5FE13A1B041C3CD7555605F7A1",
-"00114C6100021B3DDA23285127CCA95E4E803E740D7C3B1ECDD4FAD3DDB583A6023E19980D515A315BF9D2B484597BF2532C65865FE13A1D041CA8F6555786393F",
-"00114C62000221C9CBD6F6352394CA67472E3E740D7C3B1ECDD4FAD3DDB583A6023E19985945767A9F80E6F39BC4BC23DBCB6F835FE13A3A041D2F7E5558D161B9",
-"00114C630002DACA1D616FE7489F2CE8FF783E740D7C3B1ECDD4FAD3DDB583A6023E199880512676C617842E657BAFEB0900239D5FE13A59041D34100001D4C49E",
-"00114C64000246F553020854C03FA582094B3E740D7C3B1ECDD4FAD3DDB583A6023E19980E64406964F8BD4B048E6B7456034E045FE13A73041D2D34555CD7B9FE",
-"00114C650002BDBB9DF76CB57125111F50653E740D7C3B1ECDD4FAD3DDB583A6023E1998DDFFFB2C79B26C6D48C6513E8A834F645FE13A88041D3CA4AAAF5B3C44",
-"00114C6600029030EC0846B5CEA44E7835693E740D7C3B1ECDD4FAD3DDB583A6023E1998DB05A5F43CAE11394F8653CE69A6D1CD5FE13A96041D6ADC555BBCF4CE",
-"00114C67000257AD86E922BF705B4DDF08383E740D7C3B1ECDD4FAD3DDB583A6023E19988EA42F7EE47679C4167151E0C4B1D1ED5FE13ABC041DBD14555A333352",
-"00114C6800021C62AEEDF9770516BCD4A60A3E740D7C3B1ECDD4FAD3DDB583A6023E1998A2F60C7AADDA02367A96005652E8E5625FE13ACA041D9507AAAB0A835A",
-"00114C690002D828C0E5BEF9BF799CC3059B3E740D7C3B1ECDD4FAD3DDB583A6023E1998B9778EBE45D3F6E612802D8912ED69C35FE13AE3041DE3CCAAB2058689",
-"00114C6A00029173018547331134C3BD74013E740D7C3B1ECDD4FAD3DDB583A6023E1998228707C9C90A8912FD1F7A813ACEACD95FE13AF7041DFE2DAAAFDB46E6",
-"00114C6B0002E102FF9F63C58DD2252B19433E740D7C3B1ECDD4FAD3DDB583A6023E199857AE26B4E3EB3B66EE0C49BE8F21EE885FE13B1A041E30050003226A05",
-"00114C6C0002CC036E5447173747892AD41F3E740D7C3B1ECDD4FAD3DDB583A6023E1998B2AE295AAE391C7D3833C4F4741227945FE13B2A041E14D7000046040D",
-"00114C6D00025C245AC0D236C696AC2087EB3E740D7C3B1ECDD4FAD3DDB583A6023E199894F105624F725350604C17C1074E5CA75FE13B38041E5FF600007CDE69",
-"00114C6E000226C005608028C45224E95F673E740D7C3B1ECDD4FAD3DDB583A6023E19985267C631A0C6DE3CF7F33102EE2D5E6C5FE13B41041EB14755560B57B3",
-"00114C6F000234DB1E8DB6F06E1A5CB82BDB3E740D7C3B1ECDD4FAD3DDB583A6023E1998CE50D0C2A11DE9954A11D2730B26E4A45FE13B44041F22F25557968177",
-"00114C700002FBA39BC2D6CA33FA502F64D33E740D7C3B1ECDD4FAD3DDB583A6023E1998AF96497A1FA2F746C160BBC31D0BDF5F5FE13B5E041FBA3AAAAB0B7969",
-"00114C710002B39B7C3008952088E1B650CB3E740D7C3B1ECDD4FAD3DDB583A6023E19980D244FEED87AA713D90D3F9F47F36FAF5FE13B60041FD06FAAB52E2E4C",
-"00114C72000256D5CD281D11C42A6D614A5B3008952088E1B650CB3E740D7C3B1ECDD4FA2703A5F17D4F0D6DB7317E400146E4755FE13BAB042076D3555BAC8973",
-"00114C730002AFEC07928301E1F921207C613008952088E1B650CB3E740D7C3B1ECDD4FA68012E8FD84DCBF4300B2A5ED292E33A5FE13BBF041F6F23555611D251",
-"00114C740002065D67BB96019D19AD5C4D0A3008952088E1B650CB3E740D7C3B1ECDD4FA81F376AD0FF944EFE5DC1D6B3AF87FFC5FE13BC5041FA769AAB2F9CCA5",
-"00114C750002B0B436AF16E15471C622CDF83008952088E1B650CB3E740D7C3B1ECDD4FA6B301D6B47EB210B4C1316866A666B1A5FE13C0A0420328C555B0537D1",
-"00114C760002839A2BD811E6098EF174D5913008952088E1B650CB3E740D7C3B1ECDD4FA5ED566B8F0D58FA6ABCF10CDF78F932C5FE13C31041F4FFB5559D70701",
-"00114C770002BC6A1D812FD9E1C3343FF6EC3008952088E1B650CB3E740D7C3B1ECDD4FA3BAA0BB32A1619963014F2915576A0465FE13C3E041F2171000349FD30",
-"00114C780002F925775E228202F6BDCB3C8B3008952088E1B650CB3E740D7C3B1ECDD4FA4FBA7ADEEAB1C813353D3E855EE869295FE13C4F041F7E57AAADFF258D",
-"00114C79000286B926182D8F96B72E55472B3008952088E1B650CB3E740D7C3B1ECDD4FA0AFC9579FDF2221D89B1CF7D2F8F8B455FE13CF7041FC7B5555984A9BA",
-"00114C7A0002D2384339AD948FD8B86689F13008952088E1B650CB3E740D7C3B1ECDD4FAAFA3F9329A99679DCCAEE0B439CDA5E55FE13D03041CF586AAACB998B8",
-"00114C7B0002A2941F06D98CD70A6491837F3008952088E1B650CB3E740D7C3B1ECDD4FAC738C6BFF5BE7C8EE4410795E52B08325FE13D12041D549EAAAE1BE0A9",
-"00114C7C00024E985418F3461BA2C41274643008952088E1B650CB3E740D7C3B1ECDD4FACE1D0B20B15D25A026FAA66D978A8C2F5FE13D31041D9BE2555B0BBD7C",
-"00114C7D0002037E0A67074DB2D1AC101AF33008952088E1B650CB3E740D7C3B1ECDD4FAD40F401BD2F7360888A0B0A89FB0FDAE5FE13D41041D979FAAAB6B9BEB",
-"00114C7E00022C467FC4A3A34974337CB95B3008952088E1B650CB3E740D7C3B1ECDD4FA5C7A8D34DC5B1ABB3014ABEC5FE98A8B5FE13D44041DDEBC00045F60D8",
-"00114C7F0002C52EC8569D32D2FF2E26C6513008952088E1B650CB3E740D7C3B1ECDD4FAB4C0E3A00CA00B3645C3D4F83E3677435FE13D52041E69E9AAAD3C2509",
-"00114C8000020B78C167AAA55534C2CB500E3008952088E1B650CB3E740D7C3B1ECDD4FAB62A287F27ADCFE8169F6733863E98005FE13D6F041EBDD6000295432D",
-"00114C810002F7B56E0400D9CAE0A9776A1A3008952088E1B650CB3E740D7C3B1ECDD4FA9A19234AC6390B12A691BADC7CB27C715FE13D77041EC1B70001AF9CC8",
-"00114C820002E5FAC38101A4545ECCAC50613008952088E1B650CB3E740D7C3B1ECDD4FA7F7D18F97353DBC8F23BA3F067B74F295FE13D7F041F3A075556CB1670",
-"00114C830002BEB0142A3EA1D299B3643AFF3008952088E1B650CB3E740D7C3B1ECDD4FAAFE1EBB8A69C3DC7973E839711FCBC225FE13D84041FB49B0002627379",
-"00114C840002AA0C3B2D1B04EEDCE856472D3008952088E1B650CB3E740D7C3B1ECDD4FAA85664833D61BB06321FB68A9D25CB425FE13D8B0420454F55589BD9FD",
-"00114C85000243817EE1E56DA40699E012383008952088E1B650CB3E740D7C3B1ECDD4FA8F5FC3D05D0DB8D2858BE6A4F9C10BAA5FE13DAB0420CEBD00068369E2",
-"00114C8600021A7AF68629B65E978EFCC5D6E1E56DA40699E012383008952088E1B650CBF288FE16DD84915AFE4FAEF1C8242A885FE13DF70420C221AAAD72320A",
-"00114C8700022BCC6D79683178A5510C0562E1E56DA40699E012383008952088E1B650CB5359476A8F86C1E20D29738DD62E909E5FE13E3F041FB7BB0002EF5519",
-"00114C8800029552099710C6779D88F34D63E1E56DA40699E012383008952088E1B650CB42F2FE9172D96EFFDA39CC344AA546655FE13E5E041ED53800001FDB41",
-"00114C890002325932F7E9A2E072A2628A3EE1E56DA40699E012383008952088E1B650CB567901300807FE1BE33DAEE6198E5C825FE13E94041ED294555699E058",
-"00114C8A00020378C6D93D67E2D5D6B241EFE1E56DA40699E012383008952088E1B650CB8EF106313B7F0B6637F1C77333C8213B5FE13E98041E55F2AAABA269DE",
-"00114C8B0002AA135496FDFF746C07732451E1E56DA40699E012383008952088E1B650CB341A2B09B4F349715EC7B82DE51209395FE13EB1041EE03155592C0003",
-"00114C8C0002AD98C5087452B082D7132022E1E56DA40699E012383008952088E1B650CB0BB2F7A02F283DDD03EB4DDFA881812F5FE13F05041EF94A00015E46E3",
-"00114C8D0002741146E6BC63B7C355B95190E1E56DA40699E012383008952088E1B650CB97CFB012654F6D77B7F4885A4893704B5FE13F09041DE1F40000747DA1",
-"00114C8E0002D39A76B8DBEB075B71E1FEE4E1E56DA40699E012383008952088E1B650CBC279B9D747323101FC1BC2F56F35786A5FE13F0C041E6B660001A760AC",
-"00114C8F0002E4E410290CA6C93C8F443A4FE1E56DA40699E012383008952088E1B650CBC656D7D56E676F93B030A08C016130705FE13F18041EFA8800009DD70C",
-"00114C90000206C720831083A0EF624359FDE1E56DA40699E012383008952088E1B650CB656F15CE9DB39CE93BB11ACA4F5127A85FE13F30041F5CAC555C08B842",
-"00114C910002759D866C2C93472550D87BF2E1E56DA40699E012383008952088E1B650CB6AEDE6B8AF413B686666C95E43D133F75FE13F43041F7A9D55574770C8",
-"00114C920002FA7121BCBF52EFE88FB52B72E1E56DA40699E012383008952088E1B650CBD698CAF212680D6762B6C710C94852EE5FE13F89041FB9C8000535FA48",
-"00114C930002070733511A61E53CECD1C549E1E56DA40699E012383008952088E1B650CBF38282E0DF78E41436081ACCFF7544385FE14002041EDE1A555A17A3A0",
-"00114C94000217323BFCCE5D042EF67BFCADE1E56DA40699E012383008952088E1B650CB347A80A0A739BB7388FEC7338C7CA5785FE1404A041D1427555A58E73D",
-"00114C9500022FFCE733CBB581C77AA0093DE1E56DA40699E012383008952088E1B650CBA32202DBF9F86505B1F31975DA73C6E15FE14058041C5534AAADB6B320",
-"00114C9600026B9BD8C1BCBB174FCBBA4C14E1E56DA40699E012383008952088E1B650CBCFCB5C9778A6E6AFD6D12A4C650DB9D85FE14076041CA025AAAB6A6963",
-"00114C970002847845622C01D7470E04462BE1E56DA40699E012383008952088E1B650CB0312CFDE4E909187745119FC6D2530745FE14079041C9D360001C91A6B",
-"00114C980002515C06A4DFBDB9AAA986E1D6E1E56DA40699E012383008952088E1B650CB3787C1ED038ACF289AB5A47E5139D2895FE140A1041D1DCFAAB48FF25C",
-"00114C990002A06C0E8394A054AFE4D16646E1E56DA40699E012383008952088E1B650CBD11BBDEAD60732AF55101046D24965FE5FE140D2041CED4D555B3F4D6B",
-"00114C9A0002F7C0D5E8398CBC4C9E8006AF8394A054AFE4D16646E1E56DA40699E01238E111FBEEF4CE8A0B7D71927686F3B82B5FE14123041C8E61AAABC05E71",
-"00114C9B0002DD4120F43D23B2A87A67D0B58394A054AFE4D16646E1E56DA40699E012388831C07D8F3C61F9BDF226194D9FAAA05FE14126041BA8BAAAADE7F74C",
-"00114C9C0002A015BD0600CE6DD65324752E8394A054AFE4D16646E1E56DA40699E01238BB908B8AF4B1C5903C619E02749127BE5FE14130041C203BAAAC1F250C",
-"00114C9D0002046DA91A610399EB6BA8E9758394A054AFE4D16646E1E56DA40699E01238DD37B83E8254474C23730335A863537A5FE14141041C7A3AAAABC9E0B0",
-"00114C9E00025D55FB5AFECF370385A248228394A054AFE4D16646E1E56DA40699E0123870B1AAE8370F1D4DC4A35D698C733C0D5FE14145041CB738000335DF1E",
-"00114C9F00029B42C70FA581FB0EFFA426B78394A054AFE4D16646E1E56DA40699E01238EC786051D5C20D52BD956B03C048D6A35FE14165041D34FBAAAAFEDD34",
-"00114CA00002C432D883D017728084EB6F668394A054AFE4D16646E1E56DA40699E012386AD29B7A4F6A6AC90B79936D8DF60C175FE14169041D2BC700056840A2",
-"00114CA100020056DFA2594C1B2A5EA1735F8394A054AFE4D16646E1E56DA40699E012380579A185471F3F9DC91CEDC6143A1A375FE1418F041DABF6AAAAE97CDF",
-"00114CA200029E711833D7DF386F9701E95C8394A054AFE4D16646E1E56DA40699E0123882AC2748CC3D3D5B65B935FDE4FE3D465FE14190041D845D555A4359D6",
-"00114CA300022879D4CFAAEB207F0732C3708394A054AFE4D16646E1E56DA40699E012383F7A6753DDF85AE19E927EF5A8CC734C5FE141BF041E19B5555734BB7D",
-"00114CA40002F5DECE149A0AC835476E87818394A054AFE4D16646E1E56DA40699E01238FD31BA1AE1E9235BB3D3F4D166A8F77B5FE141C4041DC02FAAAB0256A3",
-"00114CA5000214624B9DB973A3BCE835B1C18394A054AFE4D16646E1E56DA40699E012386613B2F99512338F1935C4418BF93FAC5FE141D7041E403D555735CE8B",
-"00114CA6000244724E8E4C503F261E0DD1508394A054AFE4D16646E1E56DA40699E01238A6FAA5C834CF80A15216AE3BA2DC7E855FE141F3041E78350001946887",
-"00114CA70002EF775386AE0E2B422C3993928394A054AFE4D16646E1E56DA40699E012388D9DD3D0081EE0F0E73BF5F704B820BF5FE14208041E82750003570D01",
-"00114CA80002CF026B9AC7A053392D950A7E8394A054AFE4D16646E1E56DA40699E01238CFFA42C896CC9F4CC510D8FCB7C85DEE5FE14247041EB378000177E1B9",
-"00114CA900029A0104EF4BF83432EFCC004C8394A054AFE4D16646E1E56DA40699E0123843BE77DB9A6DAB617E501F8795FBDE415FE1424C041E068C55588152EE",
-"00114CAA0002033F88B97E64964691E74DE08394A054AFE4D16646E1E56DA40699E01238457506A53C89E8D17F355D90039AA6DD5FE14255041E8D7FAAAAB31249",
-"00114CAB00026748A88B8C1D6A2F0281FC0E8394A054AFE4D16646E1E56DA40699E01238D1E6B4675C3043491F36DB1CE8EE5D065FE14284041EFE7A00025D4464",
-"00114CAC0002B8B582E82B3EF883B9F37F188394A054AFE4D16646E1E56DA40699E012382C2CE0C0AF83D44C2A3ADCE53E84861E5FE1428B041E9F1AAAAE1256BB",
-"00114CAD000218977D9E050DF76AD1AD70D68394A054AFE4D16646E1E56DA40699E01238F029C70F73C1359891BE168BBB54DDD75FE142AB041F1C260001D7F744",
-"00114CAE00021E43EA88522AC0F28928EBE79E050DF76AD1AD70D68394A054AFE4D166465B57B595954CD5A4E8A38963E9BCF3705FE142F6041F112DAAAFEC7200",
-"00114CAF0002DAB3EF8C597F463C86899F3D9E050DF76AD1AD70D68394A054AFE4D166466A204AE36143936DE86A0FAD1700B96E5FE1430C041E1F9600024FF0F6",
-"00114CB00002CE91B8A5A62D54F43FF143D19E050DF76AD1AD70D68394A054AFE4D16646B6395FC1066FF5855452F1893F6D55815FE14313041E498C0000F41B53",
-"00114CB100026D689CB80A0C4C2665BD15CE9E050DF76AD1AD70D68394A054AFE4D166463EC88C3CF6386FE31F8F40D87D7E42945FE1433A041EC21C5555D7BEC6",
-"00114CB200025A0F2DF85A28022FFE29258C9E050DF76AD1AD70D68394A054AFE4D16646A6B44C0DE659D044CDC9A74D179055695FE1434B041E903F000016810A",
-"00114CB30002584A80EE0B0A202C6003F7DB9E050DF76AD1AD70D68394A054AFE4D166465059EEB378C44A9601026DD4F9639D6D5FE14351041ED795AAAB4B7EEC",
-"00114CB40002DE2847460E0C26E2CA25437F9E050DF76AD1AD70D68394A054AFE4D166466791296C6CFB810F42A2C399DA76259A5FE14364041F5AB0AAAE5890E5",
-"00114CB500020820C4DF88BB8334C65F9E5F9E050DF76AD1AD70D68394A054AFE4D16646C889972F9B69FC96D2322A481B6A0FB55FE14372041F989900007C7A06",
-"00114CB600028C656CEF833594BC82ABA1669E050DF76AD1AD70D68394A054AFE4D16646923C2B2FC82A1DEEC9462D2313A1A4A35FE143A7041FF525AAB1519B88",
-"00114CB700021C9E8B7D1459EF9DBA804B089E050DF76AD1AD70D68394A054AFE4D166460ED82762D8141F024D95319349E0F6255FE143D2041F6C4B555C628376",
-"00114CB800024E78929B953F95CAD2DC988F9E050DF76AD1AD70D68394A054AFE4D1664613D6AD5A6149D5C43F9F0368329C79D75FE143E5041F263CAAB042B35B",
-"00114CB90002F9CFAFC00512EBB0E401D17A9E050DF76AD1AD70D68394A054AFE4D16646674C03E0FBD1C38619120E621E3B165E5FE14418041F65515556A2D5C1",
-"00114CBA0002DDB67D30971FF1C4645EF6579E050DF76AD1AD70D68394A054AFE4D16646B1ED7FE7CFFAC564AAE03B760534FD2A5FE1441C041EECBD0004A44D2C",
-"00114CBB0002E2473B204F29014D6ADE658F9E050DF76AD1AD70D68394A054AFE4D16646B97DADA180600555317F687104D6ABF35FE14429041F7DD200023198F6",
-"00114CBC000227C53E9354AB81B18D89AF479E050DF76AD1AD70D68394A054AFE4D166463A40449B592502903D04C6BBB906540F5FE1446E041FDA8A555709DB91",
-"00114CBD000281E6CA2174E7EC206F8AA6BF9E050DF76AD1AD70D68394A054AFE4D16646A3E9E5BF5E1ABF0052C3BFDF211A918C5FE14473041F00725556F8A139",
-"00114CBE0002A2D1E006B9CC7FF690E8272A9E050DF76AD1AD70D68394A054AFE4D16646B703A7F78449B89AFF7BDFA4815837BB5FE14478041F8AB30002BE02D0",
-"00114CBF00020D7BDF826B962EAD53AB618E9E050DF76AD1AD70D68394A054AFE4D166466B680645E9AD0B4B6E0912A7ECAA04495FE14494042016AFAAAB7C922A",
-"00114CC00002CAA6874FF3D00D2136ADBBF49E050DF76AD1AD70D68394A054AFE4D16646EEE236DFF902D149399E4E0D75D316F15FE144F4042020F2555B724EAC",
-"00114CC1000289B748B4302B6CF65AAB247F9E050DF76AD1AD70D68394A054AFE4D16646A020F712EA631F396D44C488CE5FD0CE5FE1451A041EB3560002D7D040",
-"00114CC20002DA74FDA610AFB47DE7BEA005B4302B6CF65AAB247F9E050DF76AD1AD70D63A5BD95980DF5FC0A3F86F5E2453CC585FE14522041E8C72000886710F",
-"00114CC300020134A8B58BEC9FA59E45E678B4302B6CF65AAB247F9E050DF76AD1AD70D64D22F094EDCCB4F17844DFB0FE7E55175FE1454E041F02B2AAAB30973A",
-"00114CC400023892FBFF68DBA40396110858B4302B6CF65AAB247F9E050DF76AD1AD70D69D2A6113712459547C8B76D2775F04875FE14550041EB5F300034D683C",
-"00114CC50002E2370B3F434B664332561845B4302B6CF65AAB247F9E050DF76AD1AD70D69678545CA79C62BA7BF9849AA7443E985FE14559041F4E655556ADDDE7",
-"00114CC600022FE9222C68D5E877F01F53FCB4302B6CF65AAB247F9E050DF76AD1AD70D6AE94BC4EAD4806484B493C6C668517225FE1455E041FC2EE55579B1775",
-"00114CC700029434F137ED2A798BFF0DFA31B4302B6CF65AAB247F9E050DF76AD1AD70D6460F849DCC9F45F5EC15503ECBDF1E045FE1456B0420510AAAAC38A314",
-"00114CC8000262F9B676B7D9CD5FD73CEC6CB4302B6CF65AAB247F9E050DF76AD1AD70D68D8FF2544D2949D7470706C9DAF599205FE145A60420B392AAAC3EF835",
-"00114CC90002D78E9517657F984E9E0E9EBDB4302B6CF65AAB247F9E050DF76AD1AD70D67023E0ACCCABE23D2D48996A82E52E455FE145C204200903555B54E4CC",
-"00114CCA0002CE0EC373BAFB81414E31E423B4302B6CF65AAB247F9E050DF76AD1AD70D653200ACEFD8FCBE85808B44B9FEDD6645FE145D2042016AF55559F02E7",
-"00114CCB00023E6D4C0E9560901805C17F87B4302B6CF65AAB247F9E050DF76AD1AD70D691F63500CEF24DDF7DEE5D26C832F83D5FE145ED04206878AAAAE842FC",
-"00114CCC00025834402B6D73EF38C6B22D79B4302B6CF65AAB247F9E050DF76AD1AD70D6B7B7CAD6647FACED7030F306DBB63E605FE145F5042078A90000EDCBBD",
-"00114CCD000262212D7CEC16604EDCFD4BE9B4302B6CF65AAB247F9E050DF76AD1AD70D60438AA705D3A4C0EA511BB95604B9C5A5FE146160420FC55AAB531E4B1",
-"00114CCE000251D96BD4C28576E65171BCEFB4302B6CF65AAB247F9E050DF76AD1AD70D6F325698434F68E6945D46CA2BC16038A5FE146470420E91D5557713C4D",
-"00114CCF0002C45846502F005172864CCD76B4302B6CF65AAB247F9E050DF76AD1AD70D659A22510DCA39596F5DE6F4E9DBB8D085FE1464E04207941555967D3DB",
-"00114CD000029AB72CE7DB76BCC0840FDC37B4302B6CF65AAB247F9E050DF76AD1AD70D63B7B1C79C6C6679F317D944A937526F15FE1466D042102F05555AD213A",
-"00114CD100024EFB6E804D23A81F905872FCB4302B6CF65AAB247F9E050DF76AD1AD70D62D58AD8B284079E65EF164EFAC41455B5FE146BF0420FC5700018EB0BA",
-"00114CD200029A3B345E81DB2A5206AD3BD8B4302B6CF65AAB247F9E050DF76AD1AD70D6C18F23AD429212CCCD5AE229CE9B1E795FE146CC041FCF7C555ACCB625",
-"00114CD3000253B77821E8976D40B2DDD76BB4302B6CF65AAB247F9E050DF76AD1AD70D6CFDACFBC51BC9BA4580C8CF61AD7A66C5FE1470704203461555B9F1253",
-"00114CD40002D25D06E72291D9A548A1DA7AB4302B6CF65AAB247F9E050DF76AD1AD70D663CAF5FBF147154D57E2D5F3D3AAD8455FE14718041F921F0001F39F72",
-"00114CD5000285B401A5B5E372633ABCDE84B4302B6CF65AAB247F9E050DF76AD1AD70D6713A3D04AB0BFF32A2AC39161F5B836A5FE14725041FDC8655565EA04D",
-"00114CD60002E73155E49E8115592CBBD4BAA5B5E372633ABCDE84B4302B6CF65AAB247F9B820D4A38890BCC2DC547185EDB7A155FE1472904203E2300003A2AE5",
-"00114CD70002F1CBFAF9A25DDFB1F3D3B859A5B5E372633ABCDE84B4302B6CF65AAB247FD5F150677A9570C12FF7CD7FB53933925FE1472A0420D2BD000380CE57",
-"00114CD80002D4D5E2FA08ADD2785778208BA5B5E372633ABCDE84B4302B6CF65AAB247F65A8E59EB550F5EC42C7DB3B797FD0D05FE1475D04218262555870811E",
-"00114CD90002B97BB823E5FA08E15E406CE2A5B5E372633ABCDE84B4302B6CF65AAB247FF8F5C0DDBAD5B2BA05085BFC97F48B215FE1477A042101FEAAB04ED145",
-"00114CDA0002D467EDCCC10A1BC608C147F6A5B5E372633ABCDE84B4302B6CF65AAB247FABBC4E911307C0B0218E229A910F1B415FE147D00421075255555D44CD",
-"00114CDB0002F38177F070B7B85313A7320EA5B5E372633ABCDE84B4302B6CF65AAB247F11F0607B5ECA72D52EFDEF834F5C587E5FE147D7041FC2C9AAADF34DA3",
-"00114CDC0002C42A4F84322A5223FA8B2A92A5B5E372633ABCDE84B4302B6CF65AAB247F3B2227E57D5AA6004F8FE5923295431B5FE147E0042049930000FDBB30",
-"00114CDD00028A8E0AE804B17ABD01A30E98A5B5E372633ABCDE84B4302B6CF65AAB247FBB5095DD9390C2140ACE0E1B93CFA4945FE147EF0420C3CD000469B68B",
-"00114CDE0002526C0BE8E46DE1D5C56B4B25A5B5E372633ABCDE84B4302B6CF65AAB247FB2DEC8312159DB7A637385D28A7170BA5FE14810042114305555A07E55",
-"00114CDF0002766C1057E4C2A886C080A0BFA5B5E372633ABCDE84B4302B6CF65AAB247F1DEF0E251F0ADF7EA559711CECC8CA725FE148260421020E0000F88045",
-"00114CE00002469F9D151DE25B4E509CEFE8A5B5E372633ABCDE84B4302B6CF65AAB247F05B4C550A7E00286CF61A2D062C466BE5FE148990421332A55564C7084",
-"00114CE1000217801D042592A966C512C3D1A5B5E372633ABCDE84B4302B6CF65AAB247F0FF29E0211F437B4805642B9B467722B5FE1489C041F4D0A0000960441",
-"00114CE200024461B2153F129DEF76E9BA15A5B5E372633ABCDE84B4302B6CF65AAB247F59766C9175E822FA9483E86610F281F75FE148A7041FE6F600014B411A",
-"00114CE300027BCCE945A895EE017B305464A5B5E372633ABCDE84B4302B6CF65AAB247FB3703C2623E3DB506677506AC54108CC5FE148C10420528900006D1832",
-"00114CE40002EEB4E3F39CC6E1FDD2D2BE2DA5B5E372633ABCDE84B4302B6CF65AAB247FFF8AB6DCC0CDED47A6F7BFFF60C9DA6C5FE148C304206986AAAB22A1B1",
-"00114CE50002485F610D079EDA9F8EA2F043A5B5E372633ABCDE84B4302B6CF65AAB247F5AA9B88E4DD6369FA7E5C341FF2B804C5FE148D404210E08000646B2B7",
-"00114CE60002236BE5A41677C2E1C5E51ED4A5B5E372633ABCDE84B4302B6CF65AAB247F3F1F8E1DCFA4FB2C626D9F8CCD028A165FE148EA04215C6500012EAAB9",
-"00114CE70002CB65EAAD8FD87B74F217B47EA5B5E372633ABCDE84B4302B6CF65AAB247FA57907A6C6506490F283467A5A493B3E5FE1490404218E3FAAB02F33B7",
-"00114CE800027EF40C3AFC501F57151855CDA5B5E372633ABCDE84B4302B6CF65AAB247F1845295E3500AFAA2B0994FA1EA85F885FE149130421A8580001CA8F83",
-"00114CE900027D942B2026D2983CE2B6566BA5B5E372633ABCDE84B4302B6CF65AAB247F3428CABAA4E346943F039C814ABD8EE65FE1491E042207DC55584E1267",
-"00114CEA00021391CE9B4262FD4816867EFE2026D2983CE2B6566BA5B5E372633ABCDE84CEF9734994C2C51F844063AB419C91BE5FE1493D0422810D00088C453A",
-"00114CEB0002938811D1652330A98054E3872026D2983CE2B6566BA5B5E372633ABCDE84BEB4A6BC22D810752F40A99F192745F25FE14969042276A20005F31373",
-"00114CEC0002E27AC1353A6997EE7F5D697E2026D2983CE2B6566BA5B5E372633ABCDE849DB2489467F97CF7983D27248AD229B05FE1497E04221A840003A8C9F9",
-"00114CED000241C207EFE35D6F3F0A27DF552026D2983CE2B6566BA5B5E372633ABCDE84B7ACBD57AC593B6336D1781D7ABA9D145FE149BE042255130004474A70",
-"00114CEE00022BE287110FE185217DB1646B2026D2983CE2B6566BA5B5E372633ABCDE84DC2340BC952EFC9BC0C250CA590FFA675FE149CA04217DF85556282EC8",
-"00114CEF0002DA0C8EE4ED85E109E6C7BE732026D2983CE2B6566BA5B5E372633ABCDE84C2F9A975D30A46A7A0DC133004A26DF95FE149D60421F1445555894CC9",
-"00114CF00002470EC9EE7D0F18B1DB87B0912026D2983CE2B6566BA5B5E372633ABCDE84DCBB5FF7CE646842A5007A9E121BBDF35FE149D7042262A50002BA1261",
-"00114CF10002EE17A0255B712EEFE24829A52026D2983CE2B6566BA5B5E372633ABCDE846DD962836AFA12ABF50BFC36B36EB4DB5FE149DF04231C1B55558301F5",
-"00114CF20002565470F47F338266D736E4262026D2983CE2B6566BA5B5E372633ABCDE84F4F8949CE0B369D54E4D5FB0DC132DBA5FE149ED0423B0DA55588D5B82",
-"00114CF3000240B6CB478D9D8C43E06298622026D2983CE2B6566BA5B5E372633ABCDE8427C5980481AD9FC2220AC899D0461B215FE14A0A04242077AAADEAAA9D",
-"00114CF4000292A7F7036A47F747E89DA6332026D2983CE2B6566BA5B5E372633ABCDE84E6F8029A0CD6FB32137EC0E77D73B8A65FE14A140424276F000BAD0296",
-"00114CF500026F0BACBA188C9FCF1A46E5FF2026D2983CE2B6566BA5B5E372633ABCDE84380FD88D72D0CBE98B7C8854476EB1715FE14A690424B7355558F9EB38",
-"00114CF60002D59F90D20B7A7954D7F7E99A2026D2983CE2B6566BA5B5E372633ABCDE8460BA6E7DA582D01BEE31EFDE4872F5CA5FE14A7404233711AAB0D9DFF4",
-"00114CF70002FAD845F2F05BB84CB39AFAE52026D2983CE2B6566BA5B5E372633ABCDE841E702FA011CDCC55012039BE9CA526BD5FE14AA10423B990AAAEE40216",
-"00114CF800022C065F2D79631E1BCD234FC62026D2983CE2B6566BA5B5E372633ABCDE84E5D2E2A03EEAB1700A9E1BB1E5F1A8715FE14AB204234C1B000A652D10",
-"00114CF90002A2110773B5E6E3EB4EE91DE52026D2983CE2B6566BA5B5E372633ABCDE84F34794D37E360EBE29A1C92AAD856E6E5FE14B1A0423A10D5558A92365",
-"00114CFA0002DF877990734EA14816A28E4E2026D2983CE2B6566BA5B5E372633ABCDE84B84CF6BEC603A232CD928DACCF8EC6605FE14B380421C2D6AAAE9173CF",
-"00114CFB0002B72823972F1E18B8B20309652026D2983CE2B6566BA5B5E372633ABCDE846EF3730981B96850C9AD777F673CA4EF5FE14B580421C6D855579A20F6",
-"00114CFC0002F1C5C8F29C17490F11B197D92026D2983CE2B6566BA5B5E372633ABCDE843A8C6DAEF3C17D8712FEF3A50423B6B75FE14B5F0421BB480001BA141D",
-"00114CFD0002E40B853B778217DA158F77BC2026D2983CE2B6566BA5B5E372633ABCDE84007C59C964D8B2FDD59DC4CF3ED9C8865FE14B65042247A8555FF220C0",
-"00114CFE0002D46FCD194FC2DAEB00E369E93B778217DA158F77BC2026D2983CE2B6566B2649F6D29F2272C1CBF21C8FA1D73F425FE14B980422DC5E555B3EF1E0",
-"00114CFF0002412988BA05EB88519D9BEE123B778217DA158F77BC2026D2983CE2B6566B56B05ADB2FC26B39BC30CC5E20B082335FE14BA9042250C8555A46422C",
-"00114D000002809E61AE47C24875802612323B778217DA158F77BC2026D2983CE2B6566B4680738CE54208C330643C50C29DF3E05FE14BBD0422A3CD0004BD416E",
-"00114D010002CA4462BA8710E9C4507CD7123B778217DA158F77BC2026D2983CE2B6566B44EA62335C23A02E4C4351B0967121A45FE14BE10422E24E0000BB06B9",
-"00114D02000291DAC566741280108008B1A83B778217DA158F77BC2026D2983CE2B6566B1F57354B917964D6EF210C20ED33C5675FE14C2E0422BA9C0004533528",
-"00114D0300023B92D77130E8F01B94E432DB3B778217DA158F77BC2026D2983CE2B6566B6987263B438AA23934C0C7F39260A54A5FE14C4104219AA1AAB1CAE8D9",
-"00114D0400028BBA28AA7DB0B1C8641EE8E93B778217DA158F77BC2026D2983CE2B6566B7C051238748E7264FDF1631501D334BE5FE14C6A0421DEB00004AB3DA5",
-"00114D050002FCE0BA19037E95F171240BD83B778217DA158F77BC2026D2983CE2B6566B476B35D2EB78A504D220766F05392F815FE14C7804219D1BAAAE0ECF19",
-"00114D06000208CE5EBCB637E56038323EEE3B778217DA158F77BC2026D2983CE2B6566B8BECA9FAEF65CB0296369F232D78D1E35FE14C970421FCB0000258B001",
-"00114D070002540CD6E8CBFC807BE53D926D3B778217DA158F77BC2026D2983CE2B6566B9323286F8FAC2FD578FEB54EFB64E6AF5FE14C9E0421F6D10001512099",
-"00114D080002F6B2C102E28066D7494C41573B778217DA158F77BC2026D2983CE2B6566B6404C7A13E85EDD140AA1ED2CF983A465FE14CB0042282600000C7CCC7",
-"00114D090002302ABA8639856B3F06BF62B63B778217DA158F77BC2026D2983CE2B6566BABB67ED646CEC79776EE4D5F039259375FE14CB30422CD10555BC6ED36",
-"00114D0A0002B8455313CC653763CCCF19C83B778217DA158F77BC2026D2983CE2B6566B0B8363ED830C5E8413AB4F9C092DA5435FE14CD904237A48AAABDB1BF5",
-"00114D0B000237C23D1F2ADE8F1CEC57F2333B778217DA158F77BC2026D2983CE2B6566B1C826AFFBC7DA893810B9BF58BC493645FE14CDD042343DD0003127EE9",
-"00114D0C000261999499CEDA8819C6D532F13B778217DA158F77BC2026D2983CE2B6566B99981544204508CC557879585333A9905FE14CE90423EFE2555D03E2BD",
-"00114D0D0002F0F3789BA0A644A1D7A766783B778217DA158F77BC2026D2983CE2B6566B0A1113ACCE9F7CE15F6C0DF104E4416F5FE14D6C0424655C5556D03DEA",
-"00114D0E0002316ECA0F6BAA1BD8B08129D03B778217DA158F77BC2026D2983CE2B6566B75BB858A7848CABA9AD61CA1E4C1CBA25FE14D860421DF65000393E007",
-"00114D0F0002A878E83A0767881E70AE90123B778217DA158F77BC2026D2983CE2B6566BACB0390AC34357B0BB1E6B36B52DC2F85FE14DA70421FEEA5560F619CE",
-"00114D100002A099CFB5DB027D32875BA2603B778217DA158F77BC2026D2983CE2B6566B67AC6DB626159C3C463AB48F36C7B1275FE14DDB0421EB870008D03DDB",
-"00114D110002192D17116A1D3FF8ED2EE63E3B778217DA158F77BC2026D2983CE2B6566B081623330882A10F68DFF9072548047F5FE14E6804216C1C0001B13279",
-"00114D1200021ACDD4FF7942DB647A56B721116A1D3FF8ED2EE63E3B778217DA158F77BC069AF0C6EF307E3F978A44AE8B8EE85F5FE14E84041F19E700004CA15A",
-"00114D13000282E41C3C1E689B6DB5CDA314116A1D3FF8ED2EE63E3B778217DA158F77BCFD3DD8DAAA57700CCA92062BBE0691815FE14E85041F279B555599ADA5",
-"00114D14000217788C37FE70B87A39852133116A1D3FF8ED2EE63E3B778217DA158F77BC177C03317A2D9A7F5F46A1C4C14B75535FE14EEA041FBC0F000394DE83",
-"00114D15000268F47689797B84C6BE8AF726116A1D3FF8ED2EE63E3B778217DA158F77BCA126E994BBF216DAA335C1F9B7B93B7C5FE14EF4041E5BA6AAABA6466F",
-"00114D160002AF729470F6C22CDEFF3B1E9D116A1D3FF8ED2EE63E3B778217DA158F77BC68055895CA5A5B22F1E5BC56538FB4555FE14F07041EBF3A555A6E562E",
-"00114D1700027F8584B57C0206F8DE93EE92116A1D3FF8ED2EE63E3B778217DA158F77BCED56DA6FAD5A54263A85A778C0ED78EB5FE14F18041EF56AAAACA66D2F",
-"00114D180002C3861A9CC09EA613FE761273116A1D3FF8ED2EE63E3B778217DA158F77BC23C79D9EF0279A4F23DDC528C3AF16915FE14F28041F3750AAAB6636C8",
-"00114D1900026908E9B7B5C899DDEA41DD13116A1D3FF8ED2EE63E3B778217DA158F77BCCCA3DBD328BF039EB0D81DC2D9042AD45FE14FF4041F7E96AAB13FF640",
-"00114D1A00023ED1978B37EFFCBBE7CF0C83116A1D3FF8ED2EE63E3B778217DA158F77BC0AE7793FF6708A7391DF6DE2920758405FE15006041CC2E800019CF0CC",
-"00114D1B00023723E6D1FFFB50124783AD4D116A1D3FF8ED2EE63E3B778217DA158F77BC989B91B5D2FC02103C1148A535F0FE435FE15021041CFC2455584E3C74",
-"00114D1C00024116E290B99BF4115BA9326F116A1D3FF8ED2EE63E3B778217DA158F77BC37BB544BEC7CAAF1090C2A42F8D29B125FE15040041D08D3555B01EDD4",
-"00114D1D00024E401264210FC79F9C190F5C116A1D3FF8ED2EE63E3B778217DA158F77BC751AE8C851A386E1B2D68033ED3966065FE15078041D05A0000396618A",
-"00114D1E0002D536A8EC21749EDA8AB17D49116A1D3FF8ED2EE63E3B778217DA158F77BC54C2F04599177F0AB6CE92F39C75EB905FE15082041C960A000140567A",
-"00114D1F000278909A6E9C89631FE9D2F177116A1D3FF8ED2EE63E3B778217DA158F77BCC601671D0A2B4BB2C539783F53F8091E5FE15091041CEE8DAAAB925BD2",
-"00114D20000289E38593524A477C4E9F573E116A1D3FF8ED2EE63E3B778217DA158F77BC98F95AC31B1C1D7B6DB8BE2A6F5CDA905FE15095041D30CD5555C9A186",
-"00114D210002E86E6B1D0B0D86C17CF8FA58116A1D3FF8ED2EE63E3B778217DA158F77BC00277B9D2E2F2872E827F607F671478D5FE15098041DA39455572DB9D5",
-"00114D220002BBA4F38E426FF8500DEE6C25116A1D3FF8ED2EE63E3B778217DA158F77BCE96AB334BC5EA31E7ACB113686574B975FE150AB041E216FAAAACDF7C3",
-"00114D230002556CB0BF941B977DED6AE08F116A1D3FF8ED2EE63E3B778217DA158F77BC7AA5726E9753858AAAE0DE048EF3BE4B5FE150B0041E564700092EDC5B",
-"00114D240002587F65DFEDF5E38FF277F5FC116A1D3FF8ED2EE63E3B778217DA158F77BC4F6837340E1CB99E8411F3976EF80D705FE150DD041ECFADAAB16D5AE5",
-"00114D25000246346C2AF995FC9185612E11116A1D3FF8ED2EE63E3B778217DA158F77BCDBD0676E5CD56BCC43C8AF56CB0364885FE150EF041E82B3AAB3B63B9C",
-"00114D260002252FE593F7F211858A08CB742AF995FC9185612E11116A1D3FF8ED2EE63E67B838F3C0D57FC2032820828ABC16ED5FE15126041EBE3555561AC67D",
-"00114D2700027E59C1C4A304FEAAB68274ED2AF995FC9185612E11116A1D3FF8ED2EE63E00EAE24E6794F6D6F054091CAE31DFBA5FE15196041E46B1AAAC2C48E6",
-"00114D280002635B07E840CF21EE98B338562AF995FC9185612E11116A1D3FF8ED2EE63E9310304DACC2058BE779D7FD3DFD0C755FE1519B041CD46655575E80AB",
-"00114D2900024D2EC6B97DD6CB845F55A2932AF995FC9185612E11116A1D3FF8ED2EE63E5BB41E1D0F0858F97C455FC4500A51355FE151B8041D4779555CB94221",
-"00114D2A0002FE729BEFF417C4BC6A8B5DC42AF995FC9185612E11116A1D3FF8ED2EE63E9E10420CE5C1C5C7969453009E17CCBB5FE151E8041D4CB3AAABBA8916",
-"00114D2B00024F282CE5014E5821F8E128E72AF995FC9185612E11116A1D3FF8ED2EE63E839FE5F496FF743C9D6C5D38BD860F8A5FE151EB041CFF085557A2F261",
-"00114D2C0002E8D16389BCBFF6F7C4F8D6EB2AF995FC9185612E11116A1D3FF8ED2EE63EF1197833D3966ECF8E5C11CDA89DEFAC5FE151F2041D7932AAAAF6CE39",
-"00114D2D0002657A1A23DB4EA92ACCF891C12AF995FC9185612E11116A1D3FF8ED2EE63EE5B624B9E7ED745B22266D6A516DD04F5FE15203041DE0C4AAAEDC4DE6",
-"00114D2E00027657DB92F3C031F3CBFBFEEE2AF995FC9185612E11116A1D3FF8ED2EE63E3EEE7D5AA5E79ED5390C8AD77E6407205FE15213041E1D9F0000324DFA",
-"00114D2F0002114C96C71761E7298FEC80972AF995FC9185612E11116A1D3FF8ED2EE63E9994EFDBBD5C250A55F894A15AAFF82A5FE15214041E61400003AABA3B",
-"00114D30000249D719D6EBB36813D977175E2AF995FC9185612E11116A1D3FF8ED2EE63E95A3B3581AD618992ABC3CBDF21022A75FE15225041EEFABAAAB9FA64E",
-"00114D310002E64FE1500ACA2D29708333A82AF995FC9185612E11116A1D3FF8ED2EE63E96E46A3527720871AA6C337667CECFBD5FE15228041F3196555C7C35A0",
-"00114D320002DB81E9C63534B999EE19B3312AF995FC9185612E11116A1D3FF8ED2EE63EAC81CA27163AF3C9139BB8F1800EEC375FE15259041FBD03AAB0FD9072",
-"00114D33000229D5D45EA0F345E42305201E2AF995FC9185612E11116A1D3FF8ED2EE63E9CB37A60E0A7D10481A2A5F0C71F365A5FE1526C041F585EAAAF76757A",
-"00114D34000214E64490A053F3B8AEEB004E2AF995FC9185612E11116A1D3FF8ED2EE63EDF078431FDF731F1D9705D1D639961325FE15299041F94235556EFC940",
-"00114D350002222255BCF208B7198E0C31CF2AF995FC9185612E11116A1D3FF8ED2EE63EDE5AD528EFD4469798DFB3E73E7772F45FE1529E041F467E0000ED4D28",
-"00114D360002E6EE060838B95B313185D3392AF995FC9185612E11116A1D3FF8ED2EE63E6EC09AEA6F4F522526EE0E9456ECC52D5FE152B6041FC724000167A651",
-"00114D37000240C44973C083BD9DDD60E3F22AF995FC9185612E11116A1D3FF8ED2EE63E6379F6A02BA6A56A14B402A0FA952C305FE152CF041FE75B000711404D",
-"00114D380002E903B2BBBC8BA9B9026BFD5E2AF995FC9185612E11116A1D3FF8ED2EE63ED1C0D94E7A2B9ADFF722CC387112AABD5FE152E5042000D9555FDDAE8C",
-"00114D390002DE9A834FD40341DADFA00D652AF995FC9185612E11116A1D3FF8ED2EE63E43A801084BEB40EC0D9BBCBCC186D1245FE1531B04202D1CAAAB47BD4F",
-"00114D3A000256B6968AC8E8CD9418A4D1BE4FD40341DADFA00D652AF995FC9185612E11E450CDEE601E5D63761DB94C882B42805FE1531D041FAE1D555BEEB1F8",
-"00114D3B00026BBC1615EF263774AD3A992A4FD40341DADFA00D652AF995FC9185612E11188C81D9431BD16880C8A3BD36A52F4C5FE1535A042047580003BF24D3",
-"00114D3C0002871DCB5E10DFA943BAD071EA4FD40341DADFA00D652AF995FC9185612E117253519085A9B445AE01870F8A0D4BDF5FE15364041FA22B0003E8DFBE",
-"00114D3D0002CB890700166814395F3FFE4E4FD40341DADFA00D652AF995FC9185612E1108A5E20CD4C8E25EFAA4744CBBD30EC75FE1538404200D54555CBE7C65",
-"00114D3E0002C72DE6022B5403D8C10D9FE34FD40341DADFA00D652AF995FC9185612E1187371B9BA585563AAFD7505A05A81B645FE153AF0420021F00041441B2",
-"00114D3F0002F0F81A444F1F5B07DFB05F764FD40341DADFA00D652AF995FC9185612E11AED94CB3D35C9A86BD95824A1ACF94B55FE153BA041FBA875555881398",
-"00114D4000025D8AFF5CA5BC7ACC988370364FD40341DADFA00D652AF995FC9185612E112CBA66876F74A8F609981E5A15F69D495FE153BB042022CDAAAC660842",
-"00114D41000289BAA08A08E022100F275CED4FD40341DADFA00D652AF995FC9185612E11B910431D8011CEF28C598A682B07813F5FE153C00420C3BB555572B8CF",
-"00114D4200024E359748204FF8874BFC69824FD40341DADFA00D652AF995FC9185612E11502F67370844D360022A134B5E57A2425FE153CF042152C2AAAADA339E",
-"00114D4300025EC43C9337C6D7D4137E5E504FD40341DADFA00D652AF995FC9185612E1156D7EE558406FBFCBB789AC8790EA53B5FE153E50421AA14AAAD573EEF",
-"00114D44000267AC63704CF9A0F84EBF1F634FD40341DADFA00D652AF995FC9185612E116E4AAA6A3D3F86CBB3D007211BCB7B115FE154710421DA360005AE465A",
-"00114D450002B2434F4A9864F00AC228B3CD4FD40341DADFA00D652AF995FC9185612E110D52BB8430BFA08A2937FA6E2185FD635FE15498041F6F9F555608DF1F",
-"00114D4600025DDBA5A06D41E1A94FE5BDFC4FD40341DADFA00D652AF995FC9185612E118DD1AF57A97C08A95794D9ADED8126FB5FE154D1041F4964000A7DAD89",
-"00114D470002BD762CEC2029C35C9FC627DE4FD40341DADFA00D652AF995FC9185612E11A1B601D241CCCF7914CABED12409EC6D5FE15512041EC34055576A5A98",
-"00114D480002521A41CF16073A25FDBA57394FD40341DADFA00D652AF995FC9185612E1101B22DDE108FCC128FD884D8FC6967DC5FE1554E041E1B69AAADC4803D",
-"00114D4900029FC44E644B4F874066D242FC4FD40341DADFA00D652AF995FC9185612E1196322831E1C826836F19BB7BF25853255FE1556D041D92D05555CAEDD8",
-"00114D4A00029A7EF21956CCE1959AED24924FD40341DADFA00D652AF995FC9185612E11CA228B9FAF8900156273D4D3D729DA6D5FE155C4041D9090AAAD18E1DF",
-"00114D4B000265FE71F4CF150462C0BE1C394FD40341DADFA00D652AF995FC9185612E11D00DC8CFC206139B03AE3CD2A198F6315FE155E1041C942200039ABD6E",
-"00114D4C0002DB770FDB4841EC5906B604F14FD40341DADFA00D652AF995FC9185612E110A14DCE025243751A408ADDC34F6F2DA5FE155EC041C9B115557C73906",
-"00114D4D000256F088E52EED140990A6998E4FD40341DADFA00D652AF995FC9185612E110F15E589A97260126A30EB917123C8BD5FE15609041CEEC000007D6F12",
-"00114D4E000260DDD9D8280A9E13315F26EEE52EED140990A6998E4FD40341DADFA00D65818EF0751026A003CBAAA4C804EA67895FE1560B041CF34B0007256CD4",
-"00114D4F0002E290605BD11CBB60904D6403E52EED140990A6998E4FD40341DADFA00D657950998A3F32BF47082D6E5F709D286B5FE1561F041D713F00031623BA",
-"00114D500002D08BB2806EC32C32E00467BFE52EED140990A6998E4FD40341DADFA00D651048FFE3B8EE1581125D4345B77491125FE1563F041D9D8C0000E50122",
-"00114D510002F722EA865BC9CF9079E07F08E52EED140990A6998E4FD40341DADFA00D65E459FD6058ABB4EC81569F0814DB188D5FE1566A041D9462555A244F86",
-"00114D5200024E404DD484B6FD52D6E65131E52EED140990A6998E4FD40341DADFA00D659D9E05D8C45D4D30C6702BF45B4D43195FE1568F041D56EC555C74B2AA",
-"00114D530002DD0A639562927DECC7FE6800E52EED140990A6998E4FD40341DADFA00D65A6C301A6B1202F05ACA710A8B3B837425FE156D5041D38BC555F074B72",
-"00114D5400025584DCE6EC655E259D236EDCE52EED140990A6998E4FD40341DADFA00D6579E6E7418D3EB27D90A95522B1CD41D55FE15726041C8834AAADBD6F98",
-"00114D5500020AB3DF5F5E422EE95E9F852AE52EED140990A6998E4FD40341DADFA00D65EC9401D19109FE9A439F294D5A6C6EF85FE1574B041BB39E555BE099AA",
-"00114D560002F7D150E61C09BF9935E9F0B2E52EED140990A6998E4FD40341DADFA00D659EF20563E3EA79F236516F355614406F5FE1575D041B9902AAADF3F8F3",
-"00114D570002CF7B653A6D09ADCEB16955CDE52EED140990A6998E4FD40341DADFA00D6520B04CBDA8704BF522331FD7FD734D105FE1576A041BCA1AAAAAD6DA86",
-"00114D5800024F2EE6AADE6B70352FE104BDE52EED140990A6998E4FD40341DADFA00D65AE71049257FE8CD4BEE010FD39E79A7D5FE1576C041C0F8C5555CE7CB2",
-"00114D590002E9B339FF72255B268C574F24E52EED140990A6998E4FD40341DADFA00D65B6A27BB538B38A05564AB79C5580DF245FE15775041C873655596F48DA",
-"00114D5A00028DB96C7290CB52A6E20CA3DDE52EED140990A6998E4FD40341DADFA00D65025B4FF5C830AFA59CFA15792B35A6075FE15797041CDF6B5556CA4573",
-"00114D5B000227FF84647F23DDCCB05BB51FE52EED140990A6998E4FD40341DADFA00D653FAA5189C83D634C45FEBE55BD6BD2945FE157E9041CCCD50005B48F15",
-"00114D5C0002ECB05ED5D30EE8F6CF67BC32E52EED140990A6998E4FD40341DADFA00D658BA26B50BC26FD915D91DB21BD9B8DBC5FE15810041BE870AAADA317EE",
-"00114D5D0002237B80412EBFD68BCE3A8F90E52EED140990A6998E4FD40341DADFA00D65E0DDCC349634A24965788285BBA6EFD25FE1583C041BC42F5558CD526A",
-"00114D5E0002A5BAFE9DD39F69FC5ECA5C8BE52EED140990A6998E4FD40341DADFA00D65E5939406FEF06E5778799E5B513DE5045FE1585C041B85E7AAAC688F47",
-"00114D5F0002425F887E1DB590C467405145E52EED140990A6998E4FD40341DADFA00D655C516C0C3A8E26802D623F7467CC07415FE15876041B7E1AAAAEBE7AD4",
-"00114D600002439ED23F04D81457BED33DBDE52EED140990A6998E4FD40341DADFA00D658CB1F9A345268C689A539EC657B7BEB75FE15882041B8E900002A2AC3C",
-"00114D6100028A5016D297808E7CE8A49872E52EED140990A6998E4FD40341DADFA00D65FB7C6660D69FFAF90354D2A7392CBC3A5FE1588A041BDB21AAAAF61DDF",
-"00114D6200024A17917526B4ADD3CF932A2AD297808E7CE8A49872E52EED140990A6998E2BA0E4FE8589F03A04551C7158D0E4935FE1588B041C3A4E555682EE4D",
-"00114D630002651EB3C1D7A17FC9FE7EEFCCD297808E7CE8A49872E52EED140990A6998EF7CC9F35783D7959727E71EC18718D395FE1588F041CB9900007B09994",
-"00114D64000235C5322A7E75BDBFEF402E3FD297808E7CE8A49872E52EED140990A6998E48D851CB9ACAFE843180866775EC1A3F5FE158CB041D3155AAAD76A750",
-"00114D65000263BA050B2DC7E6A5245593BBD297808E7CE8A49872E52EED140990A6998EFB14793754FDB5B6A97F8A4EB3A0F3CA5FE158D4041CA5C00000EAC1AE",
-"00114D660002A5E0E6E508BD16BF7628C71DD297808E7CE8A49872E52EED140990A6998E17356B72886E21A2EDF654EB995934715FE158DE041D0738AAAAE5A121",
-"00114D670002F13EB5F547030E7290106A61D297808E7CE8A49872E52EED140990A6998EBE25711B4CD38CBB813495A7773A28BC5FE158DF041D62A25557630443",
-"00114D68000215C6E9B1878FE98B3D1EBBEFD297808E7CE8A49872E52EED140990A6998E7A6EA5FB66CFC87EBB848EE43BAE2BAD5FE158F9041DF0A75558C9E82A",
-"00114D690002D3ADC917FCFF396BD65EA17DD297808E7CE8A49872E52EED140990A6998E880CDFB6A9BA7C2EC5A0E8E0071C19345FE15903041E032EAAAB20705B",
-"00114D6A0002C4B512A6E4784C087FF09BBCD297808E7CE8A49872E52EED140990A6998E4C8281E703B1C075C9D022298146059F5FE15925041E6A3AAAB2EE1518",
-"00114D6B0002A7370F2D69EFF630E64E6887D297808E7CE8A49872E52EED140990A6998EF115CB59905D05DE8D529749E7201DC75FE15958041E55185555BD67A5",
-"00114D6C0002240AA6FA8054ED2F4BFC8ACFD297808E7CE8A49872E52EED140990A6998E3579036691C30CA69C46273EC22023ED5FE15975041DEC6B5559BB277E",
-"00114D6D0002A82417F18D750339E629947CD297808E7CE8A49872E52EED140990A6998ED17AA277FC718C1C28B3FC438E7EB3E75FE15988041DF34B555BB475F0",
-"00114D6E000233A20B6765D708E28D24047ED297808E7CE8A49872E52EED140990A6998E5F25F8F29D0098881E398155DF6504725FE1599D041E2C7AAAAB85BC19",
-"00114D6F0002E26259895E54560BB278EE86D297808E7CE8A49872E52EED140990A6998E7BD54B9D75BF0BFF6436E5440F196C985FE159AA041E59A9555559A2D2",
-"00114D700002487C0D1012F9DCFD9DE60992D297808E7CE8A49872E52EED140990A6998E11578DA62A5361FA379AD5EBFB6FA5C75FE159B1041EB3CEAAAB09C1C3",
-"00114D710002122A0A37FFB23BE1EFDE6471D297808E7CE8A49872E52EED140990A6998E6D3363AD7EE03C2632648CAC4F3FC9175FE159B2041F2FE7AAB3BCEEA0",
-"00114D72000296B0340F90CC5AB7EBDC8CE3D297808E7CE8A49872E52EED140990A6998E503C756499C956981E8050F22B7664FF5FE159E1041FCB33AAAD468320",
-"00114D730002C5FA7EA6701F64F5D283FA12D297808E7CE8A49872E52EED140990A6998EC379FB4A5BC49EDE502183F5CFAC80E05FE159E8041F6AE6AAAF10C655",
-"00114D740002EB3DC373EE3F68081E3C5DA0D297808E7CE8A49872E52EED140990A6998EA01B019F8DD2030C55303A3A9A1096885FE159F5041FEF45AAAB43BE7F",
-"00114D750002BE871015E134C927CA8B5094D297808E7CE8A49872E52EED140990A6998EA240D661616533D718FDFBC321C7C8335FE15A36042051150006E3D4DE",
-"00114D760002F836DDEACDE3C442613EE9D115E134C927CA8B5094D297808E7CE8A4987264A78CEE262B0F0AE110A87B490EDFE45FE15A5F041F80F5555989F69F",
-"00114D770002DF4304960657FA3671D9141015E134C927CA8B5094D297808E7CE8A4987287980DD840C3EFBD36290A33FCA734E85FE15A70041F46D25559795EDD",
-"00114D780002AEFDC3707D90E1294D8FCD2D15E134C927CA8B5094D297808E7CE8A49872895D15F7B146956B2814D2C2E695196A5FE15A91041F92BE5555897010",
-"00114D790002EDEEA079229A0643A6968B8A15E134C927CA8B5094D297808E7CE8A498720EB1A76901B1035E526773C47655F0195FE15A92041F7E1A555C2C1B87",
-"00114D7A00027F3D069F75BBBA3E80F181E415E134C927CA8B5094D297808E7CE8A498723277BB69D0E00BF3F5EB61ED5EA860575FE15AA604202683AAB0FBBAFE",
-"00114D7B00027C99D9C012AFB4E08541D78615E134C927CA8B5094D297808E7CE8A498720DD504C7CCDB4F7C87221367D54865885FE15AFC042061330000D87F24",
-"00114D7C0002B8DF28CA3E6B3B0999681E4215E134C927CA8B5094D297808E7CE8A498723554E0778C2948BF898900AB5B2CB2AD5FE15AFF041F22CD000071CBD4",
-"00114D7D0002CCC1187189FC8445EDB4DC0315E134C927CA8B5094D297808E7CE8A49872004EBA35F574490AE5D3B9A8A183C01D5FE15B14041FBEDCAAADF996C3",
-"00114D7E0002803C62B9244F000AD953C2DB15E134C927CA8B5094D297808E7CE8A498728041518FC369C0B275A41C98E1CFCB705FE15B3D041FE92FAAAECFAFD0",
-"00114D7F0002B4FF095C2BC5B6FACA59385D15E134C927CA8B5094D297808E7CE8A49872DE4F7D2E7CA0EB5A39A77E321DAC3D135FE15B4C041FAA60555831FBE0",
-"00114D8000027F3B07E53F56120AA2AA579B15E134C927CA8B5094D297808E7CE8A4987261DE7E79D2A60DCC827BBFC42500AE125FE15B85042000F0AAAD3F848E",
-"00114D810002B20088802DEE73D632DCE23115E134C927CA8B5094D297808E7CE8A4987219A5BDC3D37E4A3735AE8ABA375CDEF35FE15B8D041F66CA5558DD8E0D",
-"00114D8200024E6E89BB9CF65C73FE348A6715E134C927CA8B5094D297808E7CE8A49872F043A670BCAE288E6B63BF73445520215FE15BAE041FE305AAAB1EB6FB",
-"00114D830002D47AFB81F4C331B26805F79815E134C927CA8B5094D297808E7CE8A49872E88BE4AC2DFACE9E2D0442BA8644945E5FE15BC4041FD1465556A82675",
-"00114D8400023DC903B7A7CD56DA515DD41C15E134C927CA8B5094D297808E7CE8A49872E9F78775ABCC7D55628FB6B56AC025285FE15BD3041FFFEB0004005F2B",
-"00114D8500026BC42E76DB96323E5745524915E134C927CA8B5094D297808E7CE8A49872A7FF1F7A8BB2F919323CEB4370834E0E5FE15C1D0420581F0004AEC99B",
-"00114D86000240E043DA9966EBE70BFFDDB615E134C927CA8B5094D297808E7CE8A49872BFB26E2076C2C7906242D789EB34598C5FE15C2A041F5E42555FDB8908",
-"00114D8700026506065FE2271848E4C4DBE115E134C927CA8B5094D297808E7CE8A49872551162241ECCD4394CC0759D073AFE095FE15C7B041FC10000041D3099",
-"00114D880002A4720CE1768F06FE537C85D915E134C927CA8B5094D297808E7CE8A498724AB855621B21FAE6F2A41E81A7F285795FE15CE4041EAB4E000129F036",
-"00114D890002286BCD7A1EB0B32ABF831F1215E134C927CA8B5094D297808E7CE8A498728DD0596910C6144B070B6B0062F49FB35FE15D07041D351855578B25A2",
-"00114D8A0002A798EAC37CD6E7F732BC05EB7A1EB0B32ABF831F1215E134C927CA8B5094584B32244E5C2DF4871E315E17D1F52A5FE15D68041D2203000274750A",
-"00114D8B00025FF429C7C3DB407ED75C8BAE7A1EB0B32ABF831F1215E134C927CA8B50945076095A319384691AC081DCF4C42EEA5FE15D6F041BEFB5AAAD77965C",
-"00114D8C000219D6FE635CCE19110F1848F37A1EB0B32ABF831F1215E134C927CA8B5094BE7EABC5C405EBED0725E43A2FE846E25FE15D78041C55A6000185A220",
-"00114D8D0002A723857C5D3EFC93C57CBEAE7A1EB0B32ABF831F1215E134C927CA8B509481354FA0EB3006E53641ED63FA94D3815FE15D8B041CB60EAAAD943E54",
-"00114D8E00028D7B95B79A6F984F5F601A297A1EB0B32ABF831F1215E134C927CA8B5094AF2F6469CC4C2E4D7B6DECAE9162657F5FE15DCB041CE8CC000745F607",
-"00114D8F00022982B17885EE652E4E6014867A1EB0B32ABF831F1215E134C927CA8B5094BB761D5E8A6A507708DB3EE2CAB0011D5FE15DDF041C4B93AAAE8E64AB",
-"00114D90000290054D1BB2379F220765E1B57A1EB0B32ABF831F1215E134C927CA8B5094A153BD082E155D2F5291FBF2110605035FE15E38041C7BD6555C4ADB57",
-"00114D91000210B8C99CE0BD370C38A9D9417A1EB0B32ABF831F1215E134C927CA8B509425251B7C129AA99EA9FEC8D0020FFA785FE15E4C041B794F55562DB6C1",
-"00114D9200025C71A3A024C152205A23BEB37A1EB0B32ABF831F1215E134C927CA8B5094A3EFCB9D24976BA81810B16B6FF016A15FE15E52041BA76E0004B0C6CE",
-"00114D930002BD2CBC54D9E8ED8CAD65609C7A1EB0B32ABF831F1215E134C927CA8B5094529492E3658757D69765202557282A865FE15E5F041C10F05555C39832",
-"00114D9400029B1A22C9388148D3C044D5487A1EB0B32ABF831F1215E134C927CA8B5094C46D212248AEBF6ABE8EA7B16A5CE4ED5FE15E63041C5DFFAAAB3F72B4",
-"00114D950002953874C0380056DAC22D15D77A1EB0B32ABF831F1215E134C927CA8B5094B7602D68538B6A5F4F6AC9FE3375AE3B5FE15EA0041CD6495555CA9FDD",
-"00114D960002204C25B5F7E6AD3D076FABB97A1EB0B32ABF831F1215E134C927CA8B509477C4FC6B7A1FA00BC55DF9485B5A1CCC5FE15EC8041C48440002238883",
-"00114D97000260CDEA93CBF3E5FF37A2892B7A1EB0B32ABF831F1215E134C927CA8B50948C0CE5E1E4B36218CAF4371E35DAD6BF5FE15ECF041C1C3A00014C5DB8",
-"00114D980002E87B904CDA06F0DCD2F1C8A27A1EB0B32ABF831F1215E134C927CA8B50941BB864E4CA38E3E02D782B93B4AFBB095FE15EE9041C85E6AAAF3F0899",
-"00114D990002E64911ABB7FCE43193BC21F37A1EB0B32ABF831F1215E134C927CA8B50940A34D4A7E4399C17AC23804486DF33615FE15EF6041C972100038CCEDF",
-"00114D9A000273A853C444BF285CD651F5D77A1EB0B32ABF831F1215E134C927CA8B5094E97D56F0EFAD50FEDF1A677D2E35ACAE5FE15F16041CE847AAB014DB07",
-"00114D9B0002681F07DAA81BFFB2A1EF59CA7A1EB0B32ABF831F1215E134C927CA8B50944F13E569F3123AD1A40E6C91967E2BBE5FE15F26041CDED7000771DA51",
-"00114D9C0002B8996F7CEE1856B39000FB377A1EB0B32ABF831F1215E134C927CA8B5094ABDA313F3D7F743F3A1FD95B09C008375FE15F52041D2289AAAC5197D6",
-"00114D9D0002BDE1CC76334E3306BB328D4B7A1EB0B32ABF831F1215E134C927CA8B50942B3B5840235EA723EF53E491A59364885FE15F57041CDFDF0004495E22",
-"00114D9E00021174726DA7785DE1F885892B76334E3306BB328D4B7A1EB0B32ABF831F1212509868067896B2CE60E3A94AFF8BF85FE15F63041D5858AAAFDAB3C8",
-"00114D9F0002C8094FB00286369A45A315B176334E3306BB328D4B7A1EB0B32ABF831F12E94BB5398CF36FF71A21509784215EA25FE15FC2041DB283555A5DD24D",
-"00114DA0000220300CCF5128F27F0C7830C076334E3306BB328D4B7A1EB0B32ABF831F1232AAED71385DA1FFBC23A86C3AF770995FE16008041C7775AAACBA2794",
-"00114DA10002A4317ECCF36C5A93B31BF4E676334E3306BB328D4B7A1EB0B32ABF831F12F5A36F6C0DA47DFC826CFEFD94EB3E165FE16034041BC74F0000EB404B",
-"00114DA2000236842FBBB0E0E2AE7C44BC8476334E3306BB328D4B7A1EB0B32ABF831F12E9CE9C6CA041011848A79120FF0A8E415FE16055041B8BE95556B4BFE0",
-"00114DA300024DA4060035C2002B0D150F0A76334E3306BB328D4B7A1EB0B32ABF831F12D10F92C4E7F23CE633871740EB1B3B115FE1606F041B7F1EAAB5EA8AD1",
-"00114DA40002C60B0205F26F731F549E0ADB76334E3306BB328D4B7A1EB0B32ABF831F1207C11D29A42F6B4580DA21EF00C92EF25FE1612D041B91C0AAAB3F913C",
-"00114DA50002AF4031F041BE3E5EF602A60E76334E3306BB328D4B7A1EB0B32ABF831F12207DE6D8DB0B1B4D6B2EEFCE42A72D6B5FE1613C04193C4AAAAC254F05",
-"00114DA600026F47356921FA413470D1A80276334E3306BB328D4B7A1EB0B32ABF831F120A3FE0E91B044722CB63453A6755B53D5FE161470419793B555B7544BF",
-"00114DA7000255314FD44F4927B9B41EF6D176334E3306BB328D4B7A1EB0B32ABF831F128E796EA7D4F59C07CEB35F6C0DF53FEC5FE1616F0419C05155556DBB3C",
-"00114DA8000270EEDDF502F98DE10B77AECB76334E3306BB328D4B7A1EB0B32ABF831F1268E610C725C3529C877F2B779CCBD89C5FE1617004199907555940B8B8",
-"00114DA900028FCDB8A33F7E1B6CE4967E6276334E3306BB328D4B7A1EB0B32ABF831F12288DF949E5826D7ED40345C99ADF86085FE1617C041A03EBAAAB492D98",
-"00114DAA00023440CAC9145E4C05F8A8311176334E3306BB328D4B7A1EB0B32ABF831F12D28E9BA699411BB922A3C7AD09F216425FE161A1041A4A400001C2178F",
-"00114DAB00023749D64C8E0107F38C7E41BE76334E3306BB328D4B7A1EB0B32ABF831F12E037AD86400D2D29AEA494036FBE3F2E5FE161A6041A2CB5AAAB5D10A7",
-"00114DAC0002830B4E22A1E7B2A7127757C976334E3306BB328D4B7A1EB0B32ABF831F12885DEE0438C8C0668C43B6870E125C675FE161AE041A911D55563E2C66",
-"00114DAD0002F0700988547017142B41015C76334E3306BB328D4B7A1EB0B32ABF831F120B124BF40B625ABD6306DB7874FB9A875FE161B1041AEB1F555C8EEB7E",
-"00114DAE0002D0F0AF5CC6F718669FC7339076334E3306BB328D4B7A1EB0B32ABF831F124BCE10F3CB84E4AF8E1DA2C00DCA508C5FE16202041B5ED6555B84BB68",
-"00114DAF0002BD4A70D9B97CEE3E561747CF76334E3306BB328D4B7A1EB0B32ABF831F12BFED1AED38A84B0032F430CAB8908A425FE16213041A836CAAAC16EA6D",
-"00114DB00002D3C4D521699CBB7D00DC7A8576334E3306BB328D4B7A1EB0B32ABF831F12710B74552CD3BDD7A5CC3E474DD069435FE16218041ABBACAAAF3A2D81",
-"00114DB10002537792C61770C69EEA6F3F5776334E3306BB328D4B7A1EB0B32ABF831F12CA5A06A12B2DEA6ADCCF141773DB62595FE1622F041B2670AAB14C35DE",
-"00114DB200022A58CDAA8663D0387FC79D6AC61770C69EEA6F3F5776334E3306BB328D4B9F60927A1ECAF893B76919DA6F8499B15FE16257041B44260004AF8B76",
-"00114DB30002B648806A6B48661B1E05F4FDC61770C69EEA6F3F5776334E3306BB328D4B887217299192DBB027D91A5CAE9035AC5FE1626A041B1A1D555D62F329",
-"00114DB4000299FEAB841EE99ED4711DE0B8C61770C69EEA6F3F5776334E3306BB328D4BCED749D6C002511546599D0A4622A2945FE16294041B4B0A00069F6FC6",
-"00114DB500028BBB3F6B28C6316B49F2C96CC61770C69EEA6F3F5776334E3306BB328D4BB98E15BCA85204B991BE44B5798D421B5FE162A6041B16D3AAAB5736A5",
-"00114DB60002B376E47E63E8D4B0856F6EC0C61770C69EEA6F3F5776334E3306BB328D4B6C85B7D464F2D346590D28F89E6EE9EE5FE162A8041B4B45555BE2DBA9",
-"00114DB7000240E66FCD3DC29E664562F40BC61770C69EEA6F3F5776334E3306BB328D4BE870A197CD8CCBA7348FF9634FD9332C5FE162BA041BC7AFAAACE4A353",
-"00114DB800025B3BE7D7F4BC28E5D05AEB16C61770C69EEA6F3F5776334E3306BB328D4B1A5C35C40FC133DECC5A4744AA330B275FE162C8041BFBED5555C19D97",
-"00114DB90002C1705531C4037B6DA9EE7017C61770C69EEA6F3F5776334E3306BB328D4B82126AE6B9E8213BD8B5B33AEC9D4F4A5FE162D2041C43BF555CFE5A36",
-"00114DBA0002EA951B06800F67A10FC116B4C61770C69EEA6F3F5776334E3306BB328D4BFDDC2CF2975BBDF7DA35504D4752BA705FE162FE041CA1D20006CAB54F",
-"00114DBB00027175324455A0268FD72BC84BC61770C69EEA6F3F5776334E3306BB328D4B06F145B6381676C2FD53361DB1736C5D5FE16390041C5E59000183D492",
-"00114DBC00025027BCB3940BB4271D8EFB0BC61770C69EEA6F3F5776334E3306BB328D4B8866BF2097853F5DB25102DD6F2D8E375FE16395041A61235557440174",
-"00114DBD000297C43DC94074CD12F9418ABCC61770C69EEA6F3F5776334E3306BB328D4BEE1D452365B760B5E2CB2843D6E4B5045FE1639B041ACF3600003F1348",
-"00114DBE0002F7F8B4A2CD840228F37A00A2C61770C69EEA6F3F5776334E3306BB328D4B41277E16EE732EE44BC1181C20AFA9E65FE1639C041B3667000008D3EA",
-"00114DBF000220106CFFEB0EF2DF27C99B37C61770C69EEA6F3F5776334E3306BB328D4BDCFB210EF475B123536379BCC99CBA5C5FE1639D041BB663555597F51E",
-"00114DC00002C259B4EA97F60FF86392FE49C61770C69EEA6F3F5776334E3306BB328D4BB5F7108041461C7BB4CB34C90F9C9A7A5FE163A7041C38B855562D8983",
-"00114DC100023F5BE36DB4E848377D369B99C61770C69EEA6F3F5776334E3306BB328D4B772365402C93D6C400AE93FEF1CA40F95FE163AA041C96300009D04403",
-"00114DC20002FB712AD2F3BF0DE88189CCC5C61770C69EEA6F3F5776334E3306BB328D4B5DD4835E334B11510281CB36DB6DC25B5FE1641B041D18DB0004142D3C",
-"00114DC30002EEF094C96679C168248BB403C61770C69EEA6F3F5776334E3306BB328D4BA9C76B23BCE153AD3C84EB1A35BC118B5FE1643D041B8F650000426A6F",
-"00114DC4000279A2F53941C9EC30D60F3FE0C61770C69EEA6F3F5776334E3306BB328D4B8203C7D53D5789BFA96851089264154E5FE1648F041B8187555C52E5D6",
-"00114DC500021494AF62BB42C420F86E0ECBC61770C69EEA6F3F5776334E3306BB328D4B427615D9AAA91C97A6303066980670135FE164E3041AA2515557164B3E",
-"00114DC600029442CFF9A8EAEB867A5445CE62BB42C420F86E0ECBC61770C69EEA6F3F57F27E0724EEA238F08DF64CABDC7F41AA5FE164E90419CB1A000294F1EE",
-"00114DC70002AA47FDC8C4ADE2EF38DDC7C262BB42C420F86E0ECBC61770C69EEA6F3F5764926163CC21A89D0EE6EE0DB5D1A9435FE16518041A2E100001D53E12",
-"00114DC80002AA76908EB5BFA8B112732C4C62BB42C420F86E0ECBC61770C69EEA6F3F5788FF63F44AECF537F3C23F57339F9D8E5FE1651F0419EAA0AAAAE6A133",
-"00114DC900021AEF64C56D9D6AA52736ECA162BB42C420F86E0ECBC61770C69EEA6F3F578B00724DA69F1FBD1748E3BE770B695D5FE16557041A46DAAAAF6F3F4E",
-"00114DCA0002E775A826A3E7178AD0C946C562BB42C420F86E0ECBC61770C69EEA6F3F57242502681EEFB58EACAD3D1940816B425FE165650419DEE2AAADF046EC",
-"00114DCB0002064EF45244B0F7A42C29E33462BB42C420F86E0ECBC61770C69EEA6F3F572F992CC87C8AB2FF38073F4F10AB48C35FE1656E041A21000001492BF0",
-"00114DCC00024ABBA7B8A01D75BFE53DE64162BB42C420F86E0ECBC61770C69EEA6F3F57060C54BA1AC73757362D1001925C40125FE16594041A77FD000311F113",
-"00114DCD00021BAC095D1C5DFBCD0CDDD75D62BB42C420F86E0ECBC61770C69EEA6F3F57F05585E6960E5E94314935F904623CAF5FE1659D041A56A25555D60E35",
-"00114DCE0002846234DDA743C7BBD36C59C762BB42C420F86E0ECBC61770C69EEA6F3F57F83261BAC78C82E8AE31A812B7D180CF5FE165E1041AAFBC555BDC1C28",
-"00114DCF00028364091C2B29B74A595C402062BB42C420F86E0ECBC61770C69EEA6F3F578F74417A52FF12B078828214D4A88F1A5FE165F3041A11DD0001646113",
-"00114DD0000293884A262F1658413CC4606B62BB42C420F86E0ECBC61770C69EEA6F3F57CE48650A432E5C3AEA66E6314336DF3E5FE165F8041A439055588C7FCF",
-"00114DD100022FB9D5A8AF6E5DE574F9DD9862BB42C420F86E0ECBC61770C69EEA6F3F5735A33AACE3891766F08F5DB35CDFCCF95FE16601041AABD9AAAB335338",
-"00114DD2000215B3A16DF9F62F043DD8F15B62BB42C420F86E0ECBC61770C69EEA6F3F579AE0C4918721376B3E4C704596B259A15FE1660F041B0609AAACA950B0",
-"00114DD30002E1E558B8434C5AB5131EC95262BB42C420F86E0ECBC61770C69EEA6F3F578FA8EF4281F240EC0B67C182A999494E5FE16615041B4C740008BEC475",
-"00114DD40002CC3BE1F71171138B5EA0A51962BB42C420F86E0ECBC61770C69EEA6F3F57A54D676EA43F98B0ABA4D5B8A86EBB5C5FE16643041BB997AAAD24DE2F",
-"00114DD5000296B995535EE77D093756067562BB42C420F86E0ECBC61770C69EEA6F3F5707B5800C304CAFA15F3234583045982E5FE16660041B710A555645F79C",
-"00114DD60002AD420DE992E26799E883E6C162BB42C420F86E0ECBC61770C69EEA6F3F57711B71FC579D9F34C59E99BC93340D4D5FE16678041B77BD0000E4C480",
-"00114DD70002AAD4D4B0C31EAA210FD92EB562BB42C420F86E0ECBC61770C69EEA6F3F57011819684FED30B1A2FA6AF50FA0E4DA5FE16690041B922C55556B2105",
-"00114DD800023BA27B1602C0A018FC01543862BB42C420F86E0ECBC61770C69EEA6F3F5776200798359D470ED8BF8D7FAC6FCF3F5FE166A0041BAEB2AAAB44587D",
-"00114DD90002F175BEC386F7525625443EEC62BB42C420F86E0ECBC61770C69EEA6F3F5723D78FC99D3683BA70F7EE6A86D7BBE65FE166A3041BF06BAAAE409B62",
-"00114DDA0002FFEB2DB03153F0B7733BD2AEC386F7525625443EEC62BB42C420F86E0ECB54133402D11515463F615C4E07BEA7DD5FE166B0041C6F640002337DBB",
-"00114DDB0002AC84148AA1961BE95CC02EADC386F7525625443EEC62BB42C420F86E0ECBC3CEA2DA8332C25E92FA345923C071BB5FE166D1041CC1FA5555B39231",
-"00114DDC0002E5FC4A0F21437F2239070254C386F7525625443EEC62BB42C420F86E0ECBE3AF9E40D156BC4A90F2411FE0C845F05FE166D3041CB3650004423345",
-"00114DDD0002BA33D3E000E208733E143BBFC386F7525625443EEC62BB42C420F86E0ECB212985E44FB0E4B3D62F3D282D4D34695FE166DF041D42325555DB4F15",
-"00114DDE0002D9818CFD95A894669B22050EC386F7525625443EEC62BB42C420F86E0ECB551861DCB217E1A1A8D1CDF86A5A44CC5FE166E8041DA17F0001BF305C",
-"00114DDF0002A3F219129831E0239D5FB0DDC386F7525625443EEC62BB42C420F86E0ECBFCED4CD0F4D0233F232DB645535EDF085FE166F1041E132A555641E883",
-"00114DE00002F74773FB61D1EBF6984A9F8DC386F7525625443EEC62BB42C420F86E0ECB585FAF1E0A6E879AAC20A50658FCC21A5FE16710041E848AAAAE4A10DE",
-"00114DE1000246EDDE2FAD1507ACB476BB7CC386F7525625443EEC62BB42C420F86E0ECB252B62600B615886C8A42662EA19BBFD5FE1671B041E805CAAAB452F4B",
-"00114DE200025DC142123F62C609BECE9C88C386F7525625443EEC62BB42C420F86E0ECB0CA3FCE880B087C752F0DD18DD1464A05FE1671E041EEEE7AAADEF6FB2",
-"00114DE30002CE0671860C0AD6871526DAEEC386F7525625443EEC62BB42C420F86E0ECBA70FAC7B68B0A4AAD20C283085784B365FE1673E041F8E8A0004C53CF4",
-"00114DE400024F078EED041160918D25B0E8C386F7525625443EEC62BB42C420F86E0ECBD85189B3EA7D5720C16092DC68E55E735FE167E7041F8320AAAB0574CC",
-"00114DE500024259CC63E232E2E7275A917AC386F7525625443EEC62BB42C420F86E0ECB94512EE84270252FA06EB37F465C3CF15FE167E9041C8AA3AAAFAFC76D",
-"00114DE60002847D9EAE06DFD38F209A3BCAC386F7525625443EEC62BB42C420F86E0ECBEFF914B4E12FCCC6AA7A9F9561CB75155FE16825041D21D8AAADBE6D17",
-"00114DE70002A939E95830C29E278E25EA1CC386F7525625443EEC62BB42C420F86E0ECB2624C821B6899F19152980190A03CBDB5FE16838041C88E200002B2EE0",
-"00114DE800027B905BB1C33DEBB560086553C386F7525625443EEC62BB42C420F86E0ECBA754F32AECAD9C13DB841CBBB668E4255FE1684E041CC2540001A9224E",
-"00114DE900023F451CBEB66AF82B08E6F25EC386F7525625443EEC62BB42C420F86E0ECB1B8290A373BC72B0F0A793B603F8655E5FE16854041CEB92000318B479",
-"00114DEA0002ACE0BC0357F06981A9035D37C386F7525625443EEC62BB42C420F86E0ECB56D50AFEF177228657ADAF8C8B06AE495FE1685D041D65EA0001545ADD",
-"00114DEB0002E05144EF14F8C13A0C610392C386F7525625443EEC62BB42C420F86E0ECB48ADCB461AEE13E56900FC9D8E5AAECB5FE1686D041DD7180000FCC717",
-"00114DEC00020FB6ECC7F8F4D71F6B5D9822C386F7525625443EEC62BB42C420F86E0ECB59A6CA0BE6CAA80F53E785985C7680935FE1688E041E2103AAB0B63E2E",
-"00114DED00020A5CB287FD9DDE5B0CCE0D55C386F7525625443EEC62BB42C420F86E0ECB58BEBAFD4439F8FE30E757F03E076B285FE168B4041E0C8FAAB00B6407",
-"00114DEE00027973DEA98BDEFFF9327334DB87FD9DDE5B0CCE0D55C386F7525625443EEC4CE96EFFD472012F2E18208766936A475FE168FE041DE1875559290036",
-"00114DEF00028E450C78FF38C606308B4CBF87FD9DDE5B0CCE0D55C386F7525625443EEC4A99618B79CAC4437464986FC7C83B985FE1691F041CF63FAAAB383772",
-"00114DF00002154F57882B309D7B14918CB287FD9DDE5B0CCE0D55C386F7525625443EEC3075DFF70A0559FB3926F5B7613028D25FE16921041CEB01555618847A",
-"00114DF1000224831ED8CFB71969E7ABA80B87FD9DDE5B0CCE0D55C386F7525625443EECA07036BFA2CDE6CC128368AD3850098C5FE16935041D7EE7000212B1A3",
-"00114DF2000292D37EA71363DDAF2E3D23EE87FD9DDE5B0CCE0D55C386F7525625443EECAC5C8F527D9420F52859DCA45A92694C5FE1693C041DB4470003C43A7F",
-"00114DF3000263E0E9534FC7E8EABA8A4E2087FD9DDE5B0CCE0D55C386F7525625443EECF1638DA0E361E637D720CEC76AB50E8C5FE1695F041E30C80001352647",
-"00114DF4000217AC572221D712444AA81B4687FD9DDE5B0CCE0D55C386F7525625443EEC721745EBCF7723B1918A9CB76270417D5FE16988041E14FCAAAF8A02F6",
-"00114DF50002BD648A7F9FE594E0153112EF87FD9DDE5B0CCE0D55C386F7525625443EEC122E5FF81CCD5629AAD8257713F162EE5FE16996041DD67E55586A4A75",
-"00114DF600026BA42B65DD92619B14E9927A87FD9DDE5B0CCE0D55C386F7525625443EEC3AB2D4015B627F175180B4BDFD6AC8BF5FE169C8041E2FE85559EB7B50",
-"00114DF70002274150000B128BD2A36FB2EB87FD9DDE5B0CCE0D55C386F7525625443EECCE90903E267E712B47925DBDC73622105FE169D5041DC314AAABB20271",
-"00114DF80002CA96F3589A77EB53EC80CBF487FD9DDE5B0CCE0D55C386F7525625443EEC2925F173A2184B42309F5B5265A5B3F95FE169D8041E2295555E56143C",
-"00114DF900025789C79044B4FCB8AF41B79A87FD9DDE5B0CCE0D55C386F7525625443EEC7821ED711A8922A10145C1952528DD205FE16A07041EBBE95555DF4F4C",
-"00114DFA00025C95C2322F6877D9A8385F5187FD9DDE5B0CCE0D55C386F7525625443EEC5A6B39975683D7697DB89326769BBED75FE16A09041E58E00000C2669B",
-"00114DFB0002B3092A2507A7A02E71EFECB387FD9DDE5B0CCE0D55C386F7525625443EECFAEBD61F10CA23B01EAFF3ADA64417DB5FE16A0C041EFA0D000225EB90",
-"00114DFC0002145F857434C0CD52CAF762E487FD9DDE5B0CCE0D55C386F7525625443EEC448D5AFD714DE6D0F1EA4AAADD8CD4FE5FE16A4B041F9AC05557696FDF",
-"00114DFD0002BCB93F3772ADD509645EA03587FD9DDE5B0CCE0D55C386F7525625443EEC0347DEB193F594A03DD76907D64879035FE16A51041ED6CF0005B9731E",
-"00114DFE00020220BDEC2445BCBF09F6416687FD9DDE5B0CCE0D55C386F7525625443EECC00CD0FABF119456F2D9774B3714E3CC5FE16AA0041F67BA555D461C30",
-"00114DFF00028098F2BF6AB9778BB5FC91C687FD9DDE5B0CCE0D55C386F7525625443EECDDAD73E7AA0F559AC01820367D4E2BCD5FE16AB6041E4C87AAAAB9F5E1",
-"00114E000002D08BE04E34B55EDBE44EEEEF87FD9DDE5B0CCE0D55C386F7525625443EEC7C7AB2C40821A8EF2B60403F80A6811B5FE16AB7041E7DFA000341946D",
-"00114E010002F6CE422D97F34CB822052B4187FD9DDE5B0CCE0D55C386F7525625443EEC8F22B04B012666F9AC713F17555EDC615FE16AC0041F2430AAAC4188B6",
-"00114E020002A8401EB5C43ECF6E26BE8C2D2D97F34CB822052B4187FD9DDE5B0CCE0D5521BAE5676102A6F65FE5AE40F32ACC585FE16AD3041FA1DEAAACCE45B2",
-"00114E03000287C0131524BC98AC88FB78C32D97F34CB822052B4187FD9DDE5B0CCE0D556060B3AB14D4240C020226DC615038535FE16AF0041FE5CE5555D06670",
-"00114E040002768C9CE2E9A890669FC841942D97F34CB822052B4187FD9DDE5B0CCE0D55B7081D9ADF0268935A897765A144599C5FE16AF2041FE87AAAAE3050A9",
-"00114E050002F1D039F2B5B217296DA6150E2D97F34CB822052B4187FD9DDE5B0CCE0D558A20E7A74562FBB8C8F2F22A2E6CAB5D5FE16AFC04209660AAAB728155",
-"00114E0600023BF3F38F63943BD176C978752D97F34CB822052B4187FD9DDE5B0CCE0D55DCB5663C534FD3B2C01498FC1340F18F5FE16B390421159CAAAABB6E7B",
-"00114E07000286E1A99C476F0C1427FCD95B2D97F34CB822052B4187FD9DDE5B0CCE0D55B24527D9498C0320797D9FD3EF5D3B015FE16B4604204CE15557CBDF54",
-"00114E080002CAA2C07DA3AE1CEC435A77412D97F34CB822052B4187FD9DDE5B0CCE0D550DAA198B6DCAE7BB1C0309E2343992395FE16B4E0420BB5F000457BA4E",
-"00114E090002FB2E6E7B9600D3FF0B8CA7472D97F34CB822052B4187FD9DDE5B0CCE0D555810E8E9963D454916136F18AD031D3C5FE16B7904213FB2555A3E91A8",
-"00114E0A0002B6A554CA4AE9F8363B859A802D97F34CB822052B4187FD9DDE5B0CCE0D55DEC7CD5488A18D94B8EA8A17C06820C95FE16B870420E731000189B91B",
-"00114E0B00023588B782C0681253DA16F8FE2D97F34CB822052B4187FD9DDE5B0CCE0D55294A5AFC4E409DB6D234CEB18BB5577E5FE16B8B04214F4AAAAAEFC4AB",
-"00114E0C00023349A8BAC20331E0E18DBD802D97F34CB822052B4187FD9DDE5B0CCE0D55AA5973E11EB87DC8EB591DC1C5B5EB1A5FE16B900421F9CBAAAD94289F",
-"00114E0D0002E0E73A962B8B77573A2289712D97F34CB822052B4187FD9DDE5B0CCE0D551BFDDB979A63375808B55ED8EAB0D7675FE16BAC0422A5305556F37883",
-"00114E0E00021B6DE630B7E6F088227388812D97F34CB822052B4187FD9DDE5B0CCE0D55DBD0B5A73BA03C1FD37F7387203B28055FE16BC70422B0230005466418",
-"00114E0F0002DDAD0087B6781DA756D8E40B2D97F34CB822052B4187FD9DDE5B0CCE0D55C28F28327934CF917C2B66C66D64D4AF5FE16C4D0422C2BFAAAAC5D523",
-"00114E1000028940B43D34CC1939A293BB5A2D97F34CB822052B4187FD9DDE5B0CCE0D55CEC59C3B21E072131CF69AE2C5F2055A5FE16C4F042018725557C10D77",
-"00114E1100023DC05BB558AA682A935664742D97F34CB822052B4187FD9DDE5B0CCE0D55C703162F939C386AFF074F8D45E8274D5FE16C560420CD5C5555976BDD",
-"00114E1200029C007B72F7C028AD5D113C6B2D97F34CB822052B4187FD9DDE5B0CCE0D55FA8653AE7611598CF685B115E9F4C9BF5FE16C5F04215F9C0006557AAD",
-"00114E130002A7246C0ACD906DE88253BE2C2D97F34CB822052B4187FD9DDE5B0CCE0D55F1C8A4BD50B781035DD110E1166F27DB5FE16C840421E4CCAAAB199545",
-"00114E1400029D329039A29893343BFE61B62D97F34CB822052B4187FD9DDE5B0CCE0D55858F20C5113887EE04FCFC2D82480B925FE16C9C0421B43155596A913C",
-"00114E1500023A5198443A76001C0F94F6D52D97F34CB822052B4187FD9DDE5B0CCE0D551246D7C5343B591BDB431F81DB1C81155FE16CA80421DD17AAAB035D86",
-"00114E160002D86AFD32CE2B9377CDED11F1443A76001C0F94F6D52D97F34CB822052B416E89E9FFED9BB807834F9FA599C93D075FE16CA9042255A7AAAC1F6585",
-"00114E170002CB493F58A90E1DB841C06BD9443A76001C0F94F6D52D97F34CB822052B41CA4A3C78B4DC25516BBD3147637C3A025FE16CCD04231CF30001AF8F0F",
-"00114E1800022E2822969EA1C7D12F49B85D443A76001C0F94F6D52D97F34CB822052B41467C0B73EEDE9AD8E7652270DE1FA0655FE16CD20422EFC655556FA532",
-"00114E190002236E4FAE250596824A5663CF443A76001C0F94F6D52D97F34CB822052B41CDA36146B7F3655432AE2D073D709BDF5FE16D620423A190AAAB335874",
-"00114E1A00023BC4F3E9E142BDD49ACA6B10443A76001C0F94F6D52D97F34CB822052B4163C490238293D692E840637B72D334B45FE16D640420A63FAAABCEB439",
-"00114E1B00021F0FC98844B280D404D231AA443A76001C0F94F6D52D97F34CB822052B41C24FAFBB858026E9E0860AF900DC26165FE16D6804215ECC55572B4495",
-"00114E1C00022A66D19777B0EC1B36EC28C0443A76001C0F94F6D52D97F34CB822052B41B63BD41D48A96C52E41B8E5D3B907D1B5FE16D82042206070004917E99",
-"00114E1D000299426884B3D18D87DFC173D7443A76001C0F94F6D52D97F34CB822052B419D5AB79A325168A68ADFB8DBF174250C5FE16DC004221FAB5555A7468D",
-"00114E1E00025D54018D4537DA65F3C46945443A76001C0F94F6D52D97F34CB822052B4160EDC6013EC8FFE55C736948AFD43BEA5FE16DC1042151E1AAB0094536",
-"00114E1F00020D11B432D2BA7474C717F0F5443A76001C0F94F6D52D97F34CB822052B415021FCA6D0D517D210CDF6904068AA025FE16DD504220ED6AAAD0D18B4",
-"00114E200002D1A797C4EF6F4506775842AC443A76001C0F94F6D52D97F34CB822052B413A5CC20037609614C798A0A482B77F375FE16DFA0422477BAAAC7F6790",
-"00114E21000282FF87DC74C0202D3D68E1A7443A76001C0F94F6D52D97F34CB822052B417AC7D7E7C992F0FF1DC0E8793C8281875FE16E420422188AAAAE437A9F",
-"00114E220002230C809517D26E79529C44CB443A76001C0F94F6D52D97F34CB822052B41D6D21E750969CB05ED2259E7E5F35A9C5FE16E4C04210E5800003347BA",
-"00114E2300020AE1E98858E732064BB2C409443A76001C0F94F6D52D97F34CB822052B41DEB967D2C8071BE2CC82928FBC2053695FE16E4E04218F8C55560262A0",
-"00114E2400027CBDF562C5A7A9BE8043061E443A76001C0F94F6D52D97F34CB822052B4117710C2532EBE4F20B11938AEE9ED2B65FE16E50042244BD555568E727",
-"00114E25000236E6B6657B309D90FA2CF974443A76001C0F94F6D52D97F34CB822052B419B0D95FA2864E1C4CF7ADA14A8F1A8A85FE16E520423007C0001703EE6",
-"00114E2600020213A80B86220A6F7D6CB75D443A76001C0F94F6D52D97F34CB822052B4164B3DE5FBEB18C19FF163CD4F6CFA06E5FE16E6B0423C4B3AAAF0298F1",
-"00114E2700028C4C8F9788E0017C8499AD1E443A76001C0F94F6D52D97F34CB822052B417ACC3DF54608001E1D1F055CF612FBF75FE16E7C0423E0C65556D8199F",
-"00114E280002ED27ADEA9A4C98402AB09036443A76001C0F94F6D52D97F34CB822052B41B98F8FD7AF285CECADB97BC07C81E9575FE16E8104243D70000463A745",
-"00114E29000245A730116C0B2F8A2EB942F7443A76001C0F94F6D52D97F34CB822052B4152635096DFC3CE67C9F9137AE04EF75E5FE16E8E0424F13B55587CC3CA",
-"00114E2A0002B75A4869538D76730B207CA7116C0B2F8A2EB942F7443A76001C0F94F6D52609C672156D11A0B604AADC36A7436B5FE16EA004256A45555D6DF55C",
-"00114E2B0002449D457B59A7EDD2605492BE116C0B2F8A2EB942F7443A76001C0F94F6D5155A3C81CABCEE90EDE9646552DB89B55FE16ECC0425C399000212E27C",
-"00114E2C00021A804BF69D0CF7A32A035198116C0B2F8A2EB942F7443A76001C0F94F6D58910AC8EB57E25AD94CBAF4397DA12185FE16ED20425508E000840185D",
-"00114E2D00025B39BEA6266E24A4BCE586CF116C0B2F8A2EB942F7443A76001C0F94F6D5369FB7201C2E9A87659D72FE7173EE585FE16F37042609DA000030AD50",
-"00114E2E0002E58043B5F37E6152CF8260EF116C0B2F8A2EB942F7443A76001C0F94F6D5CF1593DA183E6BB6234385903282771D5FE16F4C0423EFF3AAAD010EFC",
-"00114E2F0002A679EBD261DEB5D9EABF6FF6116C0B2F8A2EB942F7443A76001C0F94F6D59DF782FD43EC8E817096FA5BA42B25C85FE16F5304243350AAAE2D219E",
-"00114E300002AC0C068BE3CC9F48F10AB335116C0B2F8A2EB942F7443A76001C0F94F6D583317805FC8A412C9774820034991A655FE16F5D0424D6D1AAAD043CF3",
-"00114E310002D634C13F4BD23C09AB2BB278116C0B2F8A2EB942F7443A76001C0F94F6D5F6A33AFCE2B0EA3D6D1E8336CAE28C225FE16F67042565C65556BA5E87",
-"00114E32000201E293E20BB2C89924D55676116C0B2F8A2EB942F7443A76001C0F94F6D5E45A63E75922C47D2E0539820B616FF95FE16F6C0425FAA9AAAC617898",
-"00114E330002B66857827738C15143505003116C0B2F8A2EB942F7443A76001C0F94F6D5AED1E6AF7929B45E638925758D13A7FE5FE16F710426B741AAB3B6C370",
-"00114E340002C7FBD69377526528A0CDBAFF116C0B2F8A2EB942F7443A76001C0F94F6D53EA92D0AAC8CEE478584CDC7AF000CBC5FE16FA004277CB2AAAAFA7659",
-"00114E3500026B5D3D40B29BDFCF6F68A007116C0B2F8A2EB942F7443A76001C0F94F6D5FC00E2C5C05DF572AF1A8590DA41B7155FE16FA80426EB9B5557A9EF59",
-"00114E3600023E4B4F04A6555E91D7250A12116C0B2F8A2EB942F7443A76001C0F94F6D591504A3915ED464BABA57BEE8FC01ACD5FE16FAF04279E76AAAEC32646",
-"00114E370002D709BF6416C80DAB2BC50100116C0B2F8A2EB942F7443A76001C0F94F6D5A9A16029FF9E1831335E0D2814CBC6475FE16FD004285B735558B40385",
-"00114E380002932879197537DED62AB0797D116C0B2F8A2EB942F7443A76001C0F94F6D51B3F55DEC6D764E497A7BF78E1887AE85FE16FDA04283D23555F21CC04",
-"00114E39000254BAF31E302DF08CD5850FF4116C0B2F8A2EB942F7443A76001C0F94F6D58C7B4E564F901D54C98435697A853A155FE170440428E4FDAAABDB74B3",
-"00114E3A00028024F24061BFD2B8E85F75FD116C0B2F8A2EB942F7443A76001C0F94F6D5EFA276737ED296525FC495B06D94D7235FE1705204266EF3000511FA32",
-"00114E3B0002E733BA546CA9ABC35F4B5406116C0B2F8A2EB942F7443A76001C0F94F6D5DE07ED5694C92FC0D750EBAC499B2D015FE170960426F05E55555AB39A",
-"00114E3C000216C55EE403952CA2C58E6EAF116C0B2F8A2EB942F7443A76001C0F94F6D52AB320AD20B990B507D84441C0610D615FE170A40425CA6055574A2849",
-"00114E3D00025E44290990CBEFEE564CDFB5116C0B2F8A2EB942F7443A76001C0F94F6D5545E730B4BACB08C3E0BA72EDAA86D155FE170AA042643EC555A58C2A5",
-"00114E3E00025C1C6AA48ABB8539A54F8F960990CBEFEE564CDFB5116C0B2F8A2EB942F75F7B7DB30A94CF913CAC05B77DC6BCC15FE170B80426FA84AAAC58A8F2",
-"00114E3F00024410B8EEBB3829C8A2157EDB0990CBEFEE564CDFB5116C0B2F8A2EB942F723BEE2A06C471DBA9034D9246DC7CC7A5FE170C4042775E25557B15516",
-"00114E4000026D8929C35878A5A0AF2031A30990CBEFEE564CDFB5116C0B2F8A2EB942F74C6115525B1FFD6AC0774FCB110F780D5FE170E104280394000052DB18",
-"00114E410002F60B1896246F365D97EFC20A0990CBEFEE564CDFB5116C0B2F8A2EB942F76C85E95B1C6847074B54C15878435BA95FE170E3042809F7555913386F",
-"00114E420002881D0ABECBE5DA6778A2538D0990CBEFEE564CDFB5116C0B2F8A2EB942F75820044F9B161B865D2539CA2FB410F75FE1710F0428F3070002ABE594",
-"00114E430002D9574CF7703C9C0A6BA0F1060990CBEFEE564CDFB5116C0B2F8A2EB942F79F913899C33280887D7DFEF70F6163E95FE1713104287A81AAB238CFF2",
-"00114E4400020D5149725F2A1908A4112FA30990CBEFEE564CDFB5116C0B2F8A2EB942F7A1CFD167F7103DAA15D51CF4C82751C15FE1716004285B66AAAE183C22",
-"00114E450002F4EEE50248B349155BD6637C0990CBEFEE564CDFB5116C0B2F8A2EB942F7C9877EBE48227FA0364AF187797CC4FF5FE171B00427D1345558DC91F8",
-"00114E4600028404675792EA355C0EAA706B0990CBEFEE564CDFB5116C0B2F8A2EB942F7A217C93D101663516AF99F7EF129631D5FE171FD0426543255575388C6",
-"00114E4700028FDDFCB30DAE494D628DF8840990CBEFEE564CDFB5116C0B2F8A2EB942F70017F9A16CB06FEA89154003550245915FE1721704250BD1000011BEA4",
-"00114E480002EE128CBCD29B6960249CBDBE0990CBEFEE564CDFB5116C0B2F8A2EB942F7A31ED0019C92191EE5C3C0F4317C954F5FE1722E04252B33555AF2B5EA",
-"00114E490002442AAED58D24949336A4860D0990CBEFEE564CDFB5116C0B2F8A2EB942F73ECE0BA97837B3A2CB6E2516A73E02325FE1723E042551F95557576BB6",
-"00114E4A0002AE179A1453BE7A26335F257C0990CBEFEE564CDFB5116C0B2F8A2EB942F75080263C8B91EB2CFE54823E5B04C01A5FE172480425B47BAAAB89C264",
-"00114E4B0002E3C3823854444857E0F825360990CBEFEE564CDFB5116C0B2F8A2EB942F751083F4CBC787BD225350B8BA62776AD5FE1726104263F790002A2D2A3",
-"00114E4C0002118C1B6CB9F0AC7DBA6F9F270990CBEFEE564CDFB5116C0B2F8A2EB942F736F4A184C7489997354E2D5131AAFE6F5FE1727E042661500000D8B599",
-"00114E4D000279D82A5EB11D60B4402A27940990CBEFEE564CDFB5116C0B2F8A2EB942F7D8C4A7FF35D9507DE5753A07CB5D67D95FE172980426671DAAAC934AA2",
-"00114E4E0002AEB698D836A9A21B14854CC30990CBEFEE564CDFB5116C0B2F8A2EB942F7509F3450FE237A2B60F23D4344A250C75FE1729D04268460555EE7B75A",
-"00114E4F0002E2610D99745285A74D8230AE0990CBEFEE564CDFB5116C0B2F8A2EB942F7AABD1E343D77EE3C7848B1DD53403E035FE172E004273E0AAAAC356E89",
-"00114E500002C3D5C20D9A2C2E8A9925CCD60990CBEFEE564CDFB5116C0B2F8A2EB942F7295E0CD0B8B54ADC70A46C56CFEA07555FE1732204262C1E5555F019BE",
-"00114E5100024C4137956777976F26D2E05A0990CBEFEE564CDFB5116C0B2F8A2EB942F76830D4745788B8178BD27C1B73ADC7C15FE1733C042534490007B05549",
-"00114E52000228F49395B95FCFBB77539F88956777976F26D2E05A0990CBEFEE564CDFB53AA49E88D99C5A10FBA3D591A339981F5FE1735104255141555BA2555E",
-"00114E5300021FEE67D63E58624DBF551AD9956777976F26D2E05A0990CBEFEE564CDFB53EA01A998A185E2835FE827364108AD55FE1737804258AED5555A3789C",
-"00114E540002B44228A1F8EB6C3441EC77D8956777976F26D2E05A0990CBEFEE564CDFB5DC6EA4A07C788180078D9BF07B6E06685FE1739004254BF1555BEE40A8",
-"00114E5500020DD55E2A7CF8F1ADE71A146E956777976F26D2E05A0990CBEFEE564CDFB5B417A507D9E4FD2E3B5F8BB198431E9A5FE173B90425762DAAB0BB9189",
-"00114E560002621FB374A4257C48BF5EFA90956777976F26D2E05A0990CBEFEE564CDFB5157A0F7B8D10C42B6F0DE35EB5B0522F5FE173E304252BB4AAB2848660",
-"00114E570002B19117F04F7D5D48FB3E7630956777976F26D2E05A0990CBEFEE564CDFB51CE986AC8F922CE5C94F9F7391ACA30A5FE1740E0424DE48AAAB91D57E",
-"00114E580002E1D93633DFB7FC451905423E956777976F26D2E05A0990CBEFEE564CDFB5F98FDBD9EFF569B2066389A5CADAE0AB5FE1741104248A65AAAAE567A4",
-"00114E590002023CDF273B224B080E9101E6956777976F26D2E05A0990CBEFEE564CDFB5C31A61EE1458F05147FEFB7D27BF2CF65FE1747404253AFC0001CD4367",
-"00114E5A00027EDE2499E824FEC323804410956777976F26D2E05A0990CBEFEE564CDFB5AD8A8CC9813783D3761A4720B4D81F725FE1747A04238482AAABA8F8F2",
-"00114E5B0002DA716D974EE549DC900C575B956777976F26D2E05A0990CBEFEE564CDFB5491E5852AD20ED792BED2C2BBA261E9A5FE1747D04241B72AAACE9CA7B",
-"00114E5C0002F06FD906F378E5AE0A41B3DF956777976F26D2E05A0990CBEFEE564CDFB5386621FAF6CD87BC619E6E54D48624D65FE174F90424C64FAAAD10B037",
-"00114E5D00028CF04691E32D3E7C6488CA12956777976F26D2E05A0990CBEFEE564CDFB566F46A97D74589DFEC308EE47958564D5FE1751504228CB955567BF37E",
-"00114E5E000278554DDCED5B1A1321507EAD956777976F26D2E05A0990CBEFEE564CDFB54E9FBE853B681E0EC931DC737AC86E555FE1752D04229D88555A6F1522",
-"00114E5F0002563C839038E1CB5174A6F4FD956777976F26D2E05A0990CBEFEE564CDFB5FE96C54CE15CC668D8D6EA8C0A2147705FE1753C0422C22C000037F1EE",
-"00114E60000210E70788CC79412880FF4B68956777976F26D2E05A0990CBEFEE564CDFB5047750666F614F056EE5E2E319E3B66C5FE1754304231B380002081E8F",
-"00114E610002AA1B59DCF290AEB7072A1772956777976F26D2E05A0990CBEFEE564CDFB5C03022A29E80C0264E18CA0A5644D4B55FE1755E0423A1B355594D70E8",
-"00114E6200027A3329F561DE8E7F1A08667F956777976F26D2E05A0990CBEFEE564CDFB5D7CB59447924E3F19EDC66E24AF758C25FE175EB0423B480AAB001D2D9",
-"00114E630002203D1B8877DA2279C39A02ED956777976F26D2E05A0990CBEFEE564CDFB51F570ACC19DE0A8BECB03CC55B9987405FE176100421420F5558F0B71E",
-"00114E64000245A628D6DE355CAFF1AB5D75956777976F26D2E05A0990CBEFEE564CDFB58662301030C220FCCA3CDB01C2FEB4185FE176550421251A5559B08047",
-"00114E6500020FF6BAB7E650FA6F62C2E525956777976F26D2E05A0990CBEFEE564CDFB54797450CA07D20737121CD36F7B78C535FE17661042062730002E50C34",
-"00114E660002FB32208BAE234CB65CB14548B7E650FA6F62C2E525956777976F26D2E05A1F76C215F02FE22F94D3A2006BACD26C5FE176720420C1075555748553",
-"00114E670002A99E8508050B9990092BDBB1B7E650FA6F62C2E525956777976F26D2E05A6E1B3893ECAE339883F06B33C191236A5FE176910421048A0003ABD2F1",
-"00114E680002C5DCAC47252999B3C9766D76B7E650FA6F62C2E525956777976F26D2E05A143F9CAF7778ACD81A40370A5201D8B05FE176B00421002C5558B20353",
-"00114E690002257C81508D8E065BFA8E4F92B7E650FA6F62C2E525956777976F26D2E05A9D8134698960D1E77C23083B6CC927E85FE176BA0420FDE9AAAD7268CD",
-"00114E6A0002A122FBA5B3D1EF259A2A46EEB7E650FA6F62C2E525956777976F26D2E05AE58644D6D33DDEE6414566FC2F14D6D95FE176C30421683C00038455E0",
-"00114E6B0002BE02026BABF206573D6D9EB3B7E650FA6F62C2E525956777976F26D2E05A288E661CC2DF7CD01E47ADE54B4B73F35FE176CF0421D6A4000A3D2969",
-"00114E6C0002C848CAB4B0057523310A3E3FB7E650FA6F62C2E525956777976F26D2E05AFDF8B80FA13A6EAAC969A0768542CCA95FE1770204223A0D555831F16F",
-"00114E6D0002424F43ED5FA363757A606036B7E650FA6F62C2E525956777976F26D2E05A318C95FAC5515168C6924CC7A31F04515FE1772E0421C8E0000029ED47",
-"00114E6E00025087635270C05B63347467B4B7E650FA6F62C2E525956777976F26D2E05A659D2F0660447CDF2653D1A89C37537E5FE1774604217FA1555F018FFF",
-"00114E6F0002E730B79664FAC47238647B86B7E650FA6F62C2E525956777976F26D2E05AE54A7A723C93F3D27AC70DE6FBF80CA15FE177740421A24BAAACC7376F",
-"00114E70000209EE1315EA51667EB291DFB4B7E650FA6F62C2E525956777976F26D2E05A277AC9A1C5A24EBEC992E6FE28B04FFC5FE1777A0421500BAAAEE5FBE8",
-"00114E7100028531E7130315E2250CE0AE0BB7E650FA6F62C2E525956777976F26D2E05A396BF2EEDD7A3B861FFA9B868C24C5825FE177860421D299AAAF0E3863",
-"00114E72000262D05267879007B5DE0B18D5B7E650FA6F62C2E525956777976F26D2E05AF6DE25A32DBD1DEFA902D37605E3A2F55FE177A90422345BAAB69ED3DF",
-"00114E7300024640D7A63DB5AFD29E4AEFAFB7E650FA6F62C2E525956777976F26D2E05AC0314710DF914CC01DC7E43797F34E895FE177DF042218D0000380DEA5",
-"00114E7400021CFBB2EAE12F64347E74D85FB7E650FA6F62C2E525956777976F26D2E05AD49D7E4919705B633145AEE16FEA43515FE178020421928E555670AFBC",
-"00114E7500022E3CC20036D6BD838958E85FB7E650FA6F62C2E525956777976F26D2E05A8AFB04DBD12C271AB6990F6CC8E323965FE1780604217C5055555A9C7D",
-"00114E760002D6D758BD0F56ED1545B62EADB7E650FA6F62C2E525956777976F26D2E05A1CB56C94B08A37DEB88B4CED221E8DF65FE1780704220ACEAAABA12CFD",
-"00114E770002960854DFC8A00BE0FD97087CB7E650FA6F62C2E525956777976F26D2E05ABA59C94E4AB00EB70BC61B29931C050B5FE1780A0422AD1B0001631100",
-"00114E7800022C1F7FC275CDDEBDE4851CFAB7E650FA6F62C2E525956777976F26D2E05A3CF6A3A1F6EAC8D302BEC38D58CE4BDB5FE17824042347C30004229A03",
-"00114E7900026105DF11FC3251104A88FA60B7E650FA6F62C2E525956777976F26D2E05A66673E0F72F4A8821B49494464CE17325FE1784404235F1DAAB0E2C499",
-"00114E7A000251142508DDE19522301F9EA811FC3251104A88FA60B7E650FA6F62C2E525F1920B8916783BB5C8C6E117963B6B265FE1785604235522AAAE19453D",
-"00114E7B0002523D322C89E0FB847814134011FC3251104A88FA60B7E650FA6F62C2E525871B8A5D4423E776FEC1C08910B4303F5FE1786404239EEA0000ADEB7C",
-"00114E7C000247720B6F830008D458F7750A11FC3251104A88FA60B7E650FA6F62C2E5254D54721C907708593942CFAC1882DF2A5FE1787B0423FEFF55576DCCD3",
-"00114E7D000292F5E5504ECF50BE9088F47A11FC3251104A88FA60B7E650FA6F62C2E525D69083AD796306B33BDF126EC01B47DD5FE1788104242B26000909AAEF",
-"00114E7E0002BD4C18A688D7DE87EB1CBAC711FC3251104A88FA60B7E650FA6F62C2E5259E51BA033DC53E7669962E291D1965895FE178C50424B9F6555AE337C2",
-"00114E7F0002D315F22BDD332D6D7851529C11FC3251104A88FA60B7E650FA6F62C2E525301143F948F24685F0315409356F04675FE1793F0423D032AAAC6ECD3C",
-"00114E8000029633AD3B0571684FBE0E615511FC3251104A88FA60B7E650FA6F62C2E5254EBA08CC1B0F3DA770F33D65F9E0033C5FE179450421C9F25558F5EB7F",
-"00114E810002E698A265F71502262483E5EF11FC3251104A88FA60B7E650FA6F62C2E525E5C26DA89FAE3ED93F03315A43E431305FE17950042252E35557E20837",
-"00114E8200024DAA2F6EF820880F3C9E189211FC3251104A88FA60B7E650FA6F62C2E5253D6F576550383582256F81C79E0B14015FE1796E0422BB3300072D7CC7",
-"00114E830002D2199AE69098DCD2346DC31811FC3251104A88FA60B7E650FA6F62C2E5254A4524888F3F15EA8A9021AD9E51D2055FE179980422BD0DAAAB2C2FEA",
-"00114E840002521E471D3CECE05C89E2FDE411FC3251104A88FA60B7E650FA6F62C2E525BFAA9AA320C776AE98D3C99542FD24375FE1799A04227B33000316C2CE",
-"00114E850002F0ABD81F3E544002512B488011FC3251104A88FA60B7E650FA6F62C2E5259C3A88AC90BA9D5E47AF841527BD2F5D5FE179BB04231B990002D99071",
-"00114E86000211683A108275648BFAAF007E11FC3251104A88FA60B7E650FA6F62C2E525DDB2C3EA41757B756A3ADC41E12831C45FE179C304230767555691F323",
-"00114E870002BDFAE2ECB08448F2472A360211FC3251104A88FA60B7E650FA6F62C2E525327F87536A74E60AC496103F5CCA2FFB5FE179DE04238A7500021666C7",
-"00114E8800020E6F9BF9C1A3BF03F9D2BD3211FC3251104A88FA60B7E650FA6F62C2E5250B4B53CF9D4CCCCB1B67A9EC42983E445FE17A0804239DC000026C03EC",
-"00114E8900028848537CB24AC1A331B2DD8011FC3251104A88FA60B7E650FA6F62C2E525CC68BF352435A3B774E51F205F8F872C5FE17A0F04235973AAAADE3588",
-"00114E8A0002AECB7FC04B229B158881A5D411FC3251104A88FA60B7E650FA6F62C2E52555D78E3E5AD195B6A95A3508FCBD5BC85FE17A100423E56555602755CA",
-"00114E8B000211F2FF0672BA6C3C05F549B311FC3251104A88FA60B7E650FA6F62C2E525BB4E2D2AC965343BFA909492D17AAF515FE17A430424975DAAACD6AD6B",
-"00114E8C0002F0D2D6684D17C7A2FA383B9911FC3251104A88FA60B7E650FA6F62C2E5258982BB143FBDC94FDE3BD37B9F7716B05FE17A5D04241527AAAACFE6FF",
-"00114E8D0002119ADEA06578B1B97D823BA611FC3251104A88FA60B7E650FA6F62C2E52560BDB31485E6D9D72EFED99DF1C746905FE17A7A042430FEAAB490BAAA",
-"00114E8E0002EFB138F093ACBB947954531FA06578B1B97D823BA611FC3251104A88FA60265E0B097E6BAE6EC1E8D177EBA2284E5FE17AB30424383600038CA783",
-"00114E8F0002829221407C9328238B991F02A06578B1B97D823BA611FC3251104A88FA60760F3BC1C9C48170A457E38BF0CE45145FE17ABD042395ED00009CB264",
-"00114E9000029828D8A7B726632A177A7E44A06578B1B97D823BA611FC3251104A88FA60B11B7B086B08C4F05506EA4AFFE0DEEA5FE17AC404240EFAAAAF72912A",
-"00114E9100023C94715B229BA14E5BEB8AC7A06578B1B97D823BA611FC3251104A88FA60DA0A2B253EEAF7622ED0E31E6E51A6A75FE17B1304249E010008CC811D",
-"00114E9200022FDE1FD9BC25211F5F1A7F1DA06578B1B97D823BA611FC3251104A88FA60C4571C19B9CD58ADE30CD63E7DAAFC7A5FE17B4204236DDA0004756735",
-"00114E93000252D6591D40B23662DF7678F1A06578B1B97D823BA611FC3251104A88FA607917D62D53C642D2A347E53D0C767F165FE17B4F04230F1BAAAEBDB781",
-"00114E9400025851619B685A74F0BF31188EA06578B1B97D823BA611FC3251104A88FA603FE6C5976AEB7BE6D5A0F4E6419B48245FE17B630423755DAAB0064D4F",
-"00114E950002A1B93F547135C580760717CAA06578B1B97D823BA611FC3251104A88FA60F6107CEF4473A6028FA8BC1F841B453B5FE17B720423B190AAB072E975",
-"00114E960002343B002076EC18592D4275E8A06578B1B97D823BA611FC3251104A88FA60D0D1A5B6125B192E4FC69973811C33A65FE17B9904240D43AAAC885B3A",
-"00114E9700023D0D849BE3729DC0623D1778A06578B1B97D823BA611FC3251104A88FA60DC1963EE1843F8E7D8546329333619855FE17BB20423D761555B5DD0A4",
-"00114E9800027C4B94B01C309C54FFB9C4F9A06578B1B97D823BA611FC3251104A88FA609B0740BE42A84553168BE3823E4F8FEA5FE17BC30423F793AAB0F8C5D2",
-"00114E990002A61720B40682C88C3505C204A06578B1B97D823BA611FC3251104A88FA6030845DE82ADF3FFD6BBC8B34BB829AD55FE17BE9042445760003F330F3",
-"00114E9A0002D09734249853C152FE64EB45A06578B1B97D823BA611FC3251104A88FA6090A5DD2F4E5B1DE3C10346A2625E06825FE17BF40424148AAAAD1D6B6D",
-"00114E9B0002081E3A028BE19DDD31EF6E89A06578B1B97D823BA611FC3251104A88FA60EF867AABAAFF6CC4CFA46BA0C47721155FE17C1004248C0EAAB2122EF4",
-"00114E9C000271528BD75216A3C60956B0BAA06578B1B97D823BA611FC3251104A88FA60D460B1247C01E1468E283C691D9849A05FE17C5A0424964B555569915A",
-"00114E9D000297F905EFAEA0070CD619709AA06578B1B97D823BA611FC3251104A88FA602DD66802EC2F06763F34290839EBA1F95FE17C650423881B55557E2956",
-"00114E9E000250714A2380D108D2863E1696A06578B1B97D823BA611FC3251104A88FA60A043867D3E0F0497D767ACB70FF91DDB5FE17C9C0423F786555CC043EF",
-"00114E9F0002CFC3420B240EB699B33441E2A06578B1B97D823BA611FC3251104A88FA60F7921826C0F2D66A835417FFC6F0B8755FE17CB0042360CC55579A4692",
-"00114EA0000264630A8EAC32C72AFA379CA8A06578B1B97D823BA611FC3251104A88FA603AF34A1E444167E7470EE323783BF1DC5FE17CB704239B73AAAD3427BB",
-"00114EA100021B2165BA74384967F470454DA06578B1B97D823BA611FC3251104A88FA60F50E69C976E9FFF51498B23B1B99400A5FE17CBF042428BCAAAB35553E",
-"00114EA20002B553E89F4F97A9594DA9DE44BA74384967F470454DA06578B1B97D823BA66D0484026DC8009C6611D9C8B438EB065FE17CCE0424B3B0AAB130928E",
-"00114EA30002F5BB4F2E787FE2CB4B26BE08BA74384967F470454DA06578B1B97D823BA6629ADF5305B8F2A6BF3F2302096DD7835FE17CF60425144CAAAE3F8956",
-"00114EA400027C092ED93CF2165157903817BA74384967F470454DA06578B1B97D823BA68230FF8DF9CAB1CCC27E5A54D6828CB65FE17D010424D3605557427EA9",
-"00114EA50002D1C67223DB4E8AAC85FC493ABA74384967F470454DA06578B1B97D823BA6FF44D74DEB857E974A1315AA5FFC1BCA5FE17D0604254FE1AAACAB55BB",
-"00114EA600022448EABC9D743F9B00C4B1C9BA74384967F470454DA06578B1B97D823BA661B52DEABD3ED30D27DC1F8EE36CFDC75FE17D120425F8D6555BC1ADA5",
-"00114EA700023C86111641D5095240E8DE74BA74384967F470454DA06578B1B97D823BA62D454610B8E7024DC2D3CA2D2A89B0D65FE17D3C0426729BAAAB3F160C",
-"00114EA80002F6F6ED09E2636B44D1889456BA74384967F470454DA06578B1B97D823BA6AE5BAC53898707103BFEF879CCE39BA65FE17D3E04261CCA000A91E494",
-"00114EA9000239F5FD7A8AFF60186E446509BA74384967F470454DA06578B1B97D823BA62BD6FE62B4270AD5A6E16885445C38885FE17D7A0426E24A000377FCB7",
-"00114EAA0002D88C7EF2E742ED4494CE4689BA74384967F470454DA06578B1B97D823BA6690ADEF65B5A4504BB16BFCD2E532C115FE17D85042608C355564600D4",
-"00114EAB0002D963CC2B726ED53718468287BA74384967F470454DA06578B1B97D823BA62208239B035DDD908C91AD0CFFFBD4475FE17DA704268D580000534939",
-"00114EAC000240177F53C27B663DC7DA2BB5BA74384967F470454DA06578B1B97D823BA69D8A64ACA329B6C271706B0DF4F124E55FE17DBE042670A4AAAD967D99",
-"00114EAD0002356D10D3FB1994C1DE8ECCCEBA74384967F470454DA06578B1B97D823BA614CA0D8F988E7C0B05666E47C10A84E25FE17DDD0426A3C6AAAB70DD00",
-"00114EAE00029E52C98366989FBFE0E6A0B8BA74384967F470454DA06578B1B97D823BA659BD63350CE6F736EBC5C8B926AB54D85FE17DE004269DE9555D00F62B",
-"00114EAF00021D88FA371AB74F04FCB93DA4BA74384967F470454DA06578B1B97D823BA60A61B525F8D83ECBF6AB4D324B76B1D05FE17E0B042764285560C1BD9C",
-"00114EB000024E7862808D968DD36DC47804BA74384967F470454DA06578B1B97D823BA666BFCC42DA20539E5477DAD79E14B9AE5FE17E80042703E3AAAB86F6D9",
-"00114EB100029BD578AF6D9D0C85DD173EC6BA74384967F470454DA06578B1B97D823BA6F9817EF250A54CB08A5DCFF4019E786B5FE17EB90424B38D00001C643D",
-"00114EB200021473A01E25130127F9A46711BA74384967F470454DA06578B1B97D823BA6A994D301D7B8EDE5D047E421BAD70AB55FE17ECF04240FBA00005003AA",
-"00114EB30002CE439B43D4A74A235EA09E5ABA74384967F470454DA06578B1B97D823BA6461971CDFC1A61F70529151B29C32A615FE17ED104244514555E41CD10",
-"00114EB4000297009604CC8DCA6FEAA54D71BA74384967F470454DA06578B1B97D823BA65B83E63E56A6656450DD84FCD9AEA9E35FE17EFF0424F54A0003E2D7AA",
-"00114EB5000206D589D91B94FD39B9BFF51BBA74384967F470454DA06578B1B97D823BA66014CDC694D99DFFB4708A105C23CFAD5FE17F1F04248A650003089C56",
-"00114EB60002C6C6009DC9BC6E35F777BEEED91B94FD39B9BFF51BBA74384967F470454DAAFAA08F6BD749B1B25F62F21D8905BF5FE17F6004247FA400024D71AC",
-"00114EB7000263DC32ED46BB75E62DB3BFD7D91B94FD39B9BFF51BBA74384967F470454D1AB3C2DAA02F570D11369F6A644349545FE17F920423A73D555636945B",
-"00114EB8000262D511018EFE5C9901B158B0D91B94FD39B9BFF51BBA74384967F470454DE66A13AB4CEC13AF386F411CE65B7F465FE18008042331570006236445",
-"00114EB9000244E562A9056EE9A31D27F17DD91B94FD39B9BFF51BBA74384967F470454DCC1CEA55717CAED2A8B88D33C7FFA29B5FE1802E04214668555D1FF34C",
-"00114EBA0002297C8D463AB27FAD6858AEB2D91B94FD39B9BFF51BBA74384967F470454DF22F6665214EC8BA1396F81381CED8425FE180430421206655572DB23B",
-"00114EBB00020271E2E4002B26DEB2A4994DD91B94FD39B9BFF51BBA74384967F470454D6B7FC7675B2557458245340CAD85AC145FE18049042150035558232A03",
-"00114EBC000245A30D2EDDAEF327128E3AA7D91B94FD39B9BFF51BBA74384967F470454D69A91DE1F75D0CF98C92F09DFC5646445FE180660421D0F20009359270",
-"00114EBD000280ADB047519920C9EA53099CD91B94FD39B9BFF51BBA74384967F470454D95F42F1786DA53CFBC17E7D514CF6B405FE180980421D7420008192423",
-"00114EBE0002506F2044F12A5F9EF7529AA6D91B94FD39B9BFF51BBA74384967F470454D46CCC650FCFF4B3D6929C9E5360491895FE180CC042167270001F96AA1",
-"00114EBF0002B083AC17C335B3F0D690D9B8D91B94FD39B9BFF51BBA74384967F470454DAAC7691C81D01CD78F92E40E3154ACF75FE180D10420F5BEAAAC768E7F",
-"00114EC00002326BDE0B38F3BA57885C21D4D91B94FD39B9BFF51BBA74384967F470454D4FB7A936625082F24A2F8139E7E2B8DF5FE180D704217D9EAAAC044E02",
-"00114EC100021C356D8F348D367B57ED6A86D91B94FD39B9BFF51BBA74384967F470454DD056DB57C763916CED98885C21A5D3D65FE180FA0421FB24555992ED57",
-"00114EC20002ADB5E46C45F43882EDF0CE70D91B94FD39B9BFF51BBA74384967F470454D84B16ED6A0A47647C5DC98497035BA485FE181290421DF0AAAAAC1742D",
-"00114EC3000238FA3F22212E94F545CC09E9D91B94FD39B9BFF51BBA74384967F470454DD10CA703D4532414FFC510AD092919015FE1812A042183510005CC08DB",
-"00114EC400027EFC1FD47D7A088109D8595BD91B94FD39B9BFF51BBA74384967F470454DD7DF0300A35E16E3413CE3A3D9981DE55FE1813A042225B05556E6B3C4",
-"00114EC50002F2A1C1E7EE07BA800025A4A9D91B94FD39B9BFF51BBA74384967F470454DD4CA80CF0E813A98881378AD9483F84F5FE1814A04227586555BDBE891",
-"00114EC6000200C05B788961D3FBDF135F59D91B94FD39B9BFF51BBA74384967F470454D5D643D3B34459F0D6B71F406636FB94A5FE181730422C68A0007A2031C",
-"00114EC7000228053376DFE4653AE0D5739BD91B94FD39B9BFF51BBA74384967F470454DB183A852FAA8DAA4B3CAF7C603D9280D5FE18187042280415557132A80",
-"00114EC800027CF5AAB346AE1F5F53EDEBA9D91B94FD39B9BFF51BBA74384967F470454D3218400EF9B96791658BE5E4CD57915C5FE181A20422BAB200073A652D",
-"00114EC90002C90CD6960FE0717075EE724ED91B94FD39B9BFF51BBA74384967F470454D6DF8B98282E8E37BE5AA16BD78D4B7A85FE182210422C97F5561B4542B",
-"00114ECA0002E7A15EE13D6A84D95EFC029F960FE0717075EE724ED91B94FD39B9BFF51BFED83A1349330C4AC49494E3725A615B5FE182570420B646555846923E",
-"00114ECB0002FA9C3EA1ED1D00B5A9F803CC960FE0717075EE724ED91B94FD39B9BFF51B5C160A5DC6B2A4141080D6CD8434E6795FE1825F0420422C5555C33BA2",
-"00114ECC0002120D97E66B566A8577E42B20960FE0717075EE724ED91B94FD39B9BFF51B8A8E64A0BD62CCEEACFC0B5E9B04FB4E5FE182B70420B3790008476231",
-"00114ECD00025052236907E91C47873A68C8960FE0717075EE724ED91B94FD39B9BFF51B99F6AA13B8A2AC4C57EB634C40EA5C1A5FE182E4041F925A55559E7B70",
-"00114ECE0002BAA53BFD15FD4614E64EDBD7960FE0717075EE724ED91B94FD39B9BFF51BDDC8D296F75348657F9DEB32D3722D305FE182E5041F4F05AAB07E99D6",
-"00114ECF0002B9120D30FF4DDB85ADE26201960FE0717075EE724ED91B94FD39B9BFF51B0CA7363B117DEF314D427FDF4CA86D1A5FE182F5041FDCC05555C84676",
-"00114ED000025A5C6231B2EF0FCE3A8FBD22960FE0717075EE724ED91B94FD39B9BFF51B72C05AA99EBE58FFF929EB60D098F4FD5FE182FB04202223AAAD4174C6",
-"00114ED100024C1C5A90CEF737FD71BDE3BC960FE0717075EE724ED91B94FD39B9BFF51B47DF168EC98BFF9F6211D384F15E3B3E5FE1830204209A6A555EBE77E8",
-"00114ED20002F2D135BBFE829A1D3FEB21D9960FE0717075EE724ED91B94FD39B9BFF51B5C34178E54D24E4D30DC1D4E1615C2785FE18374042110D85558F0D14A",
-"00114ED3000227A85D389675002255EA7B8A960FE0717075EE724ED91B94FD39B9BFF51BC49210226415DF88031A2F68F26303755FE1839F041F6AFBAAAAF3DC78",
-"00114ED40002C4FCD249EF98C6AFFC9BD910960FE0717075EE724ED91B94FD39B9BFF51B687DE0499A0D4E443C945B808F558D055FE183A1041F3103AAAD859BC3",
-"00114ED5000206B9A29B0222AE63A539B776960FE0717075EE724ED91B94FD39B9BFF51B565F79530A760E3B65FDA64A2F0CB90F5FE183AF041FB941555A6BE1B4",
-"00114ED600023B0C2042DC8522D225980E08960FE0717075EE724ED91B94FD39B9BFF51B22A42B096F58DDF495C2C01C68624DD65FE183C40420082255572F8E21",
-"00114ED70002DA6570ECBB2B36EA8B7326B2960FE0717075EE724ED91B94FD39B9BFF51B8A9DE9E206593A2B3B60DFDC3218C7CA5FE183CA042034AB55599AFBFC",
-"00114ED80002C42C6DA7534561B67A49FEC7960FE0717075EE724ED91B94FD39B9BFF51BACD4C4B6DC10E000092699204763175F5FE183D70420ADED55581FB666",
-"00114ED9000271FDE0D08D9DB061F520576E960FE0717075EE724ED91B94FD39B9BFF51B4334D126591298D1F7C1A576955D6EDE5FE18426042105F20004044C13",
-"00114EDA00023831D21372FBF8D1E0663941960FE0717075EE724ED91B94FD39B9BFF51B9888E1E217B8DFF5DABB93F0332A37575FE1845404200B920004CFF146",
-"00114EDB00029DF2CFD7386ECF39FFC448D7960FE0717075EE724ED91B94FD39B9BFF51B08919404BF531F94C5DEDB2B89531F665FE18462041FC0E3AAAF23CAA4",
-"00114EDC0002C443C8B919502202A11526D9960FE0717075EE724ED91B94FD39B9BFF51BF5064B7DA360AB2CD5DADF14D388BB115FE184D80420128755573722BE",
-"00114EDD000221F547035D27F095524AE009960FE0717075EE724ED91B94FD39B9BFF51B27B8E2CA183370529E82A6291C8A81C65FE184E4041E712F555B8FA9A4",
-"00114EDE0002CF0C38E74492F27BCEA2A6DF035D27F095524AE009960FE0717075EE724E202C11FE6965260CDBF9BC92902E4D665FE18518041EC732555AF499C5",
-"00114EDF000289DEEE326A6BD068E410D93A035D27F095524AE009960FE0717075EE724E6295E096CFD6DFB04BADBB83347A35FE5FE18528041E6349555F918E19",
-"00114EE00002CE5CF9B847134CFE0A3855D3035D27F095524AE009960FE0717075EE724ECB929772DF1AD9AE21D356ED17392B505FE1855A041EA4D0AAAB7D7123",
-"00114EE10002442D826DFC216592AFAA5CB1035D27F095524AE009960FE0717075EE724E2360F795BC244971D0AE662916D8DD175FE1858B041E4A30555A86CC9C",
-"00114EE200027FDCE07A4B9AF1709253651D035D27F095524AE009960FE0717075EE724EF9AE221CEBBB430F48E062F38E38D6745FE185A1041DF7DFAAABD5A0EA",
-"00114EE3000284AD8EDA0AFC27098604FBFC035D27F095524AE009960FE0717075EE724E3D4A80B43FBDEC0AA945A8C70B1BAE025FE185DC041E1A3E555D68642E",
-"00114EE400023550333581439931C6F1D6C2035D27F095524AE009960FE0717075EE724E2779FF9A8C920CB9B84FF89F3F3FA8135FE18607041D976BAAB2265DAC",
-"00114EE50002CC290929CB12A366D3251E92035D27F095524AE009960FE0717075EE724EBE587F3A6FD2DD46060D40B92373D79B5FE1861D041D62BBAAAC606891",
-"00114EE60002E8CDDF63A679CA3D1DF78C65035D27F095524AE009960FE0717075EE724E054E0E88B15D594AE4DEACCE021280145FE18622041D86C15559FD5ACA",
-"00114EE700029CA6F271B79FF18CB0BD9379035D27F095524AE009960FE0717075EE724E5B1BF7BDB112E94875730D7769B62FC45FE18667041DF3F4AAAE0F5508",
-"00114EE800022BCF77E34F5818EE9F408BE7035D27F095524AE009960FE0717075EE724E4610E4F8F9F6C08E92720D99CD0FAAFC5FE18671041D4A2A5555B2F5DF",
-"00114EE90002144EB0DCDF676111E034D20F035D27F095524AE009960FE0717075EE724EA6B878C3A88D24F09DEEF3B92332F0D65FE18672041DA338555BA89C0C",
-"00114EEA000241ABE63B7E5D0BE35CE28995035D27F095524AE009960FE0717075EE724E396E9FBF3214923AB53C426F37274AA35FE186A3041E22FB0001978FFA",
-"00114EEB0002D9E8AC13B9377BD92E01DFCE035D27F095524AE009960FE0717075EE724E151A1F5356EF343D1399A3B6864CD8AF5FE186BE041DCEBE0007665E0E",
-"00114EEC000233FD1CFD1094B74DC412E2E9035D27F095524AE009960FE0717075EE724E24B3292FECC04E14FAA9ECA9DB8307C35FE186E8041DDD3600018BE497",
-"00114EED0002215B607AD4663D77222AC13B035D27F095524AE009960FE0717075EE724EBDEFD016FDCF0D135BCB18ABE04B59455FE18744041DA7FF0001F8C03B",
-"00114EEE0002809D8B06B113C3CE909C1F42035D27F095524AE009960FE0717075EE724E68D7E8EC301C40E200BDB1F49DAE2C235FE1874A041CA36655558C28F5",
-"00114EEF0002D3294714261A1D5CC752FEE0035D27F095524AE009960FE0717075EE724E6250FD9E00FEAC4ADF2C16926439E2675FE1874B041D0A87AAAB583AE0",
-"00114EF00002C8D89E51C44C3E8B080A2EC2035D27F095524AE009960FE0717075EE724EE3FDFB7A566B7496DAEC9E48962057965FE1875D041D84F10003539536",
-"00114EF10002A19A11E7DF20267D4C52E24C035D27F095524AE009960FE0717075EE724ED1CA7FCE486B6D3AF00C1A2C291EEF795FE1876B041DB8F10002721220",
-"00114EF20002D8FCBEBFA3F3C71B15B18D79E7DF20267D4C52E24C035D27F095524AE00961D7CF78560525B60FED53B2C14D2E935FE18772041E0045AAAD0C0E75",
-"00114EF30002F518FDB733C265E3CBA677C4E7DF20267D4C52E24C035D27F095524AE0091C2793C2E0081F294EE7F9555995B3F65FE18779041E6816AAAF66337C",
-"00114EF40002E5CA0A0F3C2742695550457AE7DF20267D4C52E24C035D27F095524AE009DBE75BFA1E1A61686549B5C82DE680445FE1879C041ED52B555EF488C5",
-"00114EF5000250249E2BA40B1B8A97C42AEEE7DF20267D4C52E24C035D27F095524AE0090BA344147830737F28A41D81189D60C15FE187D9041EBD9F0006F7C0F9",
-"00114EF6000269ABB3A9CDB2473CAEAA7CB3E7DF20267D4C52E24C035D27F095524AE0098207E0C5E5E2F8E878B33364E87AC8E05FE187ED041E2A220000CD85E0",
-"00114EF70002C93E6FE2ACC362DA251DADABE7DF20267D4C52E24C035D27F095524AE0099DFAAE655A1687B2EFA0724A347EDFFB5FE18836041E5972555BE5BBE1",
-"00114EF8000247DCF485D38FE607D21B9991E7DF20267D4C52E24C035D27F095524AE009886773FF6A7FA2A0D4A6519AA0AA988A5FE1885D041D965C00032C0550",
-"00114EF900021C0196BC2A787BBC24DD407BE7DF20267D4C52E24C035D27F095524AE009FD0BE5379244E9262AC8C269BBD48C915FE1887F041D70EF5559B5078B",
-"00114EFA00024EBA520BA535EA25F977D7F8E7DF20267D4C52E24C035D27F095524AE0091E00AF1533FCFDD05EF4169DE6A9AA495FE188AA041D6079AAAAE588F0",
-"00114EFB0002AF4D7EFEDCB8AB38FDF164F5E7DF20267D4C52E24C035D27F095524AE0090F8D4D57814AC366BD06FE5511E1FE605FE188C1041D276E000323E94A",
-"00114EFC00029E99D875E5C25A7CD917E7DBE7DF20267D4C52E24C035D27F095524AE0090195DD0F41AE215E0BA3CB8682AC086D5FE18921041D46BCAAADB62672",
-"00114EFD0002F1E13E8BCB0FE6F134763F4FE7DF20267D4C52E24C035D27F095524AE0096FB03950D23F20D52DAFC64A45C577DA5FE1892A041C3011AAAE962B70",
-"00114EFE0002E0A340937A92F786FDE1474EE7DF20267D4C52E24C035D27F095524AE009D08E10EDF687162F09758FDE7BAABD205FE18935041C8880000005617E",
-"00114EFF0002B225CD22297BA97E37CD6926E7DF20267D4C52E24C035D27F095524AE00941C7F69ABBE7BD8F4F8D65793E2A45745FE18936041CD8D70000EDE823",
-"00114F000002BA006A532ACF931739C2DD46E7DF20267D4C52E24C035D27F095524AE009B3B8E05188DB9E418AF9680CC1D2D1FC5FE18943041D56775555E947CC",
-"00114F010002E8E6A00EBA91FA20F2684825E7DF20267D4C52E24C035D27F095524AE0095DE5E3368F9CE48022383EACE5C2C2D75FE189A6041D9F805557C5E7C4",
-"00114F0200027F0314C856D7DDFFAE66D266E7DF20267D4C52E24C035D27F095524AE00903BDEA082AD06BDAC5591BAA7C0418235FE189E8041C72C5555A909968",
-"00114F0300021A7AF1FF3EBB3C292B1015B3E7DF20267D4C52E24C035D27F095524AE0091EEE88FC6FA72BE6704D59D945BBEC005FE189F7041BE001AAAB3EFFCC",
-"00114F040002C27052A8E06DD8CE6EAA5231E7DF20267D4C52E24C035D27F095524AE00901B8B3FFB9BE259595FF5EF3B09B98E85FE189FA041C1ED9AAAB676548",
-"00114F0500024A9C40DFB81957FD4DD80144E7DF20267D4C52E24C035D27F095524AE009C31C0B39DED93A0C4D6D8657F34A24A85FE189FF041C9050AAACD1F684",
-"00114F0600029689737E37F78CE2B7D17FC7DFB81957FD4DD80144E7DF20267D4C52E24CF96895A5B22D9EE977AE5CB29E59828E5FE18A1E041CFC43AAAC3EA875",
-"00114F0700020368448EDA681D39F647390ADFB81957FD4DD80144E7DF20267D4C52E24C3E80649071D3CA6E8DA89AC270C757B65FE18A23041CF73C00015D3350",
-"00114F0800024367518E0ED18F804FFFAD03DFB81957FD4DD80144E7DF20267D4C52E24C4D440B7BC5522F4EF934333DE2E7098F5FE18A28041D661AAAAC98C4F5",
-"00114F090002AE6A51B3B67331C65E7B839CDFB81957FD4DD80144E7DF20267D4C52E24CE60DAB3B713B95CFA11CEE78392C5D675FE18A48041DD931000484076C",
-"00114F0A0002DC92EB31980DDFDE42835E59DFB81957FD4DD80144E7DF20267D4C52E24C213BEAED57F1D0F33189A7CBA66317B65FE18A8F041DCF8700012B0A70",
-"00114F0B0002B0C35CB53963B66420340339DFB81957FD4DD80144E7DF20267D4C52E24C0602E8FBEA507F693857E8AEC4861DB95FE18A93041D139D00024732E1",
-"00114F0C0002CB3A185134174277AAE34661DFB81957FD4DD80144E7DF20267D4C52E24C3C600471BF4F4F3060B35A6F31E63B4E5FE18A99041D89E5555E397F97",
-"00114F0D0002C88AD185F47469ECE34EB85CDFB81957FD4DD80144E7DF20267D4C52E24C228F34880833979504D19F3E5C5E7C185FE18AC9041DFA3B0003B83FC0",
-"00114F0E0002F976BBF2AAD438853678E6C1DFB81957FD4DD80144E7DF20267D4C52E24CE912A49A5DB1D4854F90EA7F342DDC5A5FE18AE9041DA1230001D690E2",
-"00114F0F0002FA179B08C4D022F8549E359ADFB81957FD4DD80144E7DF20267D4C52E24C07517640C95E5D38FAF12F0300B165295FE18AEE041D989D555AB6AAB0",
-"00114F1000021630D16B7847D930B69BDBCADFB81957FD4DD80144E7DF20267D4C52E24C4CCA05CFA6B564C32846BCA11ED2CE185FE18AFE041E0E9555589BDF64",
-"00114F1100021CBA0A174D88D011E8709D09DFB81957FD4DD80144E7DF20267D4C52E24C00CB5291A5BCFEAC366227F3763435BF5FE18B1E041E517BAAAEFBACF0",
-"00114F120002C9CF8F31A19C99FCD7F6D852DFB81957FD4DD80144E7DF20267D4C52E24CBFDB1503F1C3A07C7B61DCD244A1D7B05FE18B3F041E45E55559315C4F",
-"00114F130002403625C86AFAE7D89A444338DFB81957FD4DD80144E7DF20267D4C52E24CDC4654F9995657102B9395BF763BF6065FE18B4D041E377D0004762787",
-"00114F14000281F0CD25B9486B803E0B6D1FDFB81957FD4DD80144E7DF20267D4C52E24CE48F481DFEB3F107F9D73F038020A3035FE18B61041E8566AAAB84C938",
-"00114F15000211C4DB913B330E2BC02E64E2DFB81957FD4DD80144E7DF20267D4C52E24CFFC38192F9D5F213E1EC06F646BF20DD5FE18B64041EB1EB5556BE90EA",
-"00114F160002C1EB12B7894F52EDA91376A4DFB81957FD4DD80144E7DF20267D4C52E24C2832C0FD3D03357CC625CEDAC91AB57E5FE18B69041F3D62AAAB9B742A",
-"00114F1700029D6810B404B53038C77F6688DFB81957FD4DD80144E7DF20267D4C52E24CB8A03A208865857641118FB6FBC707305FE18B7D041FC48500029FB607",
-"00114F1800027452E53F010BC024642BC036DFB81957FD4DD80144E7DF20267D4C52E24C629607A942F1D7BB8B4ABF82397CDC105FE18B87041FFD0A000317A471",
-"00114F19000237058A6FAF8151B8487088F8DFB81957FD4DD80144E7DF20267D4C52E24CB0534771ADFB9704B7A6020DEFE6AA1F5FE18B9004206DD7000182F903",
-"00114F1A00026C0A43C29DCAF38093A79BB96FAF8151B8487088F8DFB81957FD4DD80144B5F8A98A1F378A9C645211A3F6C2A4565FE18BA30420E88FAAB31D5D82",
-"00114F1B00024C7F80286B60A1024F144D7B6FAF8151B8487088F8DFB81957FD4DD8014458D4A017DD8B37DB3782B8C1C33011FF5FE18BD00421285DAAB4AF34B5",
-"00114F1C0002BD6796001453D203FF2608176FAF8151B8487088F8DFB81957FD4DD8014417ACACB4E0964D0033CCD59324A6647D5FE18C2A0420CE50AAAC7E6D83",
-"00114F1D000283384274895A475A371BDC356FAF8151B8487088F8DFB81957FD4DD80144276802535E61D355ED5F8A925A7D05DF5FE18C2F041F76C3AAAC1494CC",
-"00114F1E00029F08C3D2167FE1D87F51CC1E6FAF8151B8487088F8DFB81957FD4DD80144F392CC74F3DCBAFD9358535980A7C4A85FE18C34042005A6AAAC21E90D",
-"00114F1F0002903390A0DD8EEE335DFD96226FAF8151B8487088F8DFB81957FD4DD80144129BD6EB946C3E4439909965023F0E615FE18C390420958D00052FD1DB",
-"00114F2000026F7C8EA7F5C3DB6B8D44DA386FAF8151B8487088F8DFB81957FD4DD80144A754CE72F6E4DE62C3746863A379E1115FE18C6304212BBA5558B9B545",
-"00114F2100022AA9426D89B54E0B05BA576B6FAF8151B8487088F8DFB81957FD4DD80144B9F80746ED66DF8B79F86D3E34D9D6265FE18C770420E3A5555B937182",
-"00114F2200024C933A1A9E95A409ACE486A46FAF8151B8487088F8DFB81957FD4DD80144FCBE4AEDC85314007D7E7249458DECBA5FE18C8B042120D6AAAAB4FB86",
-"00114F2300021908977B8C6FA6EFE5D229176FAF8151B8487088F8DFB81957FD4DD80144DF0BE85435D7244CE17620903C1E0A4A5FE18C9004215D660007494FD4",
-"00114F24000272FB392E7BC04C2D428279E96FAF8151B8487088F8DFB81957FD4DD80144C5D038E76766C6A3F60A1277297BBE7D5FE18CD70421FC33555BEF3A0B",
-"00114F250002E366FA8E81B21CFE32D2F5AE6FAF8151B8487088F8DFB81957FD4DD801440ED4F49E8B262CB25310C8D7754DF49C5FE18D000421003D0001326FD9",
-"00114F2600027913ABE398712D5A532E61AB6FAF8151B8487088F8DFB81957FD4DD80144C4978EE9F4541A693D67EC0D4CFF3E615FE18D040420C2B50002FAA29C",
-"00114F270002BB0BC83D353B65E3099FCEEB6FAF8151B8487088F8DFB81957FD4DD8014455AC364103DB37E801FA79202C73D2385FE18D0D042160CF555A734278",
-"00114F28000272926925D7C87FE4723BB3136FAF8151B8487088F8DFB81957FD4DD8014440743E326F9913A3BFC96B7DD0A0C93B5FE18D300421E5CB555564052F",
-"00114F2900026A63E1066BDA3E2E2561D2886FAF8151B8487088F8DFB81957FD4DD80144D0C94A03EE80A58F57313DF9285D67CE5FE18D7A0421C7AB5556017C4D",
-"00114F2A00023DEA085E9346BD6F57505E306FAF8151B8487088F8DFB81957FD4DD801441EBD0F61B42C27A455D8EDD5648544E15FE18D920420BE360000B14C6F",
-"00114F2B0002DD89B0C1E101392C250CD16D6FAF8151B8487088F8DFB81957FD4DD801440F8F43D8DB62DB28D4EFAF41952A7A535FE18D980420E5B300008243A2",
-"00114F2C0002504C9CA21867441AE500695B6FAF8151B8487088F8DFB81957FD4DD8014431E974F9A376F2FED804AD142319CA825FE18DE6042179BA0000F42C2F",
-"00114F2D00026A8463344B33DAE827BB8BAB6FAF8151B8487088F8DFB81957FD4DD801448BF0CC6A2B21D2EAE81D67E82442F43B5FE18E0004205AF3AAB0B6944E",
-"00114F2E000255F6B491D616B3FCE12B1439344B33DAE827BB8BAB6FAF8151B8487088F80B907843EE3E5CDF15ACEB428A04F3635FE18E26042071200006B69EF4",
-"00114F2F00020D698DB57A18C76346DEADEA344B33DAE827BB8BAB6FAF8151B8487088F812D77A38727DAD096923065DA0656C6F5FE18E38042042BBAAAD4E6990",
-"00114F30000205E01575D81EC9F576AAA8B8344B33DAE827BB8BAB6FAF8151B8487088F84505DD910D8CA9FFFFDD8A97D50EB9AD5FE18E4704208B8C555DB78BAF",
-"00114F310002BA0DEA685F01D1AAA360A589344B33DAE827BB8BAB6FAF8151B8487088F8EB7B1420BF2059E35CE28F89DF0C62D45FE18E7E0420E19F000BDB6685",
-"00114F3200026810566697A23D0C16657E08344B33DAE827BB8BAB6FAF8151B8487088F86E1BB08492CB6DB39677B13F82F144965FE18EDF04204E280000001ADE",
-"00114F330002D766C13F0CA8ABB9358A7F77344B33DAE827BB8BAB6FAF8151B8487088F8253040AE0ACDBDCA49F88E3A4C7640AD5FE18EE0041EE0CF5556A75A4A",
-"00114F3400026A7FCB2DB898B7327CBE5343344B33DAE827BB8BAB6FAF8151B8487088F8CB4DE72FF2DB9ACA2B7B41BF7BD014215FE18F01041F823BAAB0D1BED3",
-"00114F350002C1FB3BB2429424AD4A533D88344B33DAE827BB8BAB6FAF8151B8487088F8918FBE921BB61B9EEFC65F3E642129725FE18F26041F72A400019563AC",
-"00114F3600027C611D428E7CAA80EEA0B911344B33DAE827BB8BAB6FAF8151B8487088F85E4599FED635BF258CB5ABDBB211D46E5FE18F2B041F4F36555A2A59F5",
-"00114F37000227A9BB66191F5F909EE0A0AF344B33DAE827BB8BAB6FAF8151B8487088F85157B156B65031EC986C21529B40B2065FE18F3B041FD61B55612884A3",
-"00114F3800022E1B293B62F2770E633D52F8344B33DAE827BB8BAB6FAF8151B8487088F86DA571D92842655C127B90AAE87FA0655FE18F7204202447AAAB6CE48C",
-"00114F390002400534C43F883D66E96B976A344B33DAE827BB8BAB6FAF8151B8487088F82AC044F615E4D39C3C2DF200E95D68465FE18F74041F99850001672F14",
-"00114F3A000280996748C67D28F2AD2A7904344B33DAE827BB8BAB6FAF8151B8487088F820E7D31D803569785334892B455297D35FE18F7904203AB65559F31EFF",
-"00114F3B000219493D78286ED0BB46217350344B33DAE827BB8BAB6FAF8151B8487088F888E602BCEEDE626BA21C458ECBDB54E05FE18F860420CD065555E5C69D",
-"00114F3C0002F3B5EB1AA6DFF39E42748942344B33DAE827BB8BAB6FAF8151B8487088F88CE8EC8C4837E77B3B97E3E0C5190ADE5FE18FA0042134CCAAB0041765",
-"00114F3D0002EDF612416F2B7EC7E48BE78C344B33DAE827BB8BAB6FAF8151B8487088F8FE625507A0ECB2F1BD1232602DB8D4625FE18FAE04214EE8000698DDE3",
-"00114F3E00022A5C43D435B4AA3DBFB8C449344B33DAE827BB8BAB6FAF8151B8487088F88C529D7157E7D78CD3D1324711573DF25FE18FD70421B0BB0000D36DB6",
-"00114F3F00027F96A80A1C3DEE6E1A5C5664344B33DAE827BB8BAB6FAF8151B8487088F8A6F236056F26A88FEB94666D5D200A615FE18FDA04216BC30007FE840D",
-"00114F400002A1F5A0E064BDDFCE489B8973344B33DAE827BB8BAB6FAF8151B8487088F8E76A9B6915F4080B943FD06D773A22775FE19009042218F3AAAB41820A",
-"00114F4100026D4380271AA9E4581587D3AA344B33DAE827BB8BAB6FAF8151B8487088F88FC47EE7A7C2C689248EB47CA7145BE35FE190200421A7465559FD3C06",
-"00114F420002B76811D1ADC4D799FE1C396F271AA9E4581587D3AA344B33DAE827BB8BAB8CAD392CA0DE8B157304ADABDFC0D23E5FE190870421D6290000F019A8",
-"00114F430002CEBC104923DAFB6363A8F880271AA9E4581587D3AA344B33DAE827BB8BAB061221F18A25C435FAA689B0640A0C7F5FE1918004201FB9AAAFCB24CA",
-"00114F440002ABE2C29387210E7B863D5F80271AA9E4581587D3AA344B33DAE827BB8BABF2C53A77036EDB265429DAE45BCBA2E35FE1918F041D2065AAAAB82403",
-"00114F450002251F8F376FA34E7FC855FDB6271AA9E4581587D3AA344B33DAE827BB8BAB8EE0AF5B5FCADC10D44FEFE49599332A5FE19190041D6E2900068D6EE7",
-"00114F460002DA87B6E52B4351CEC6A133A6271AA9E4581587D3AA344B33DAE827BB8BABA6FAD7E1AF31D145A7769CBAEFF3C8335FE191B7041DF9E50008B8A8FC",
-"00114F4700028D9330FCEA5EAB78B8D93B51271AA9E4581587D3AA344B33DAE827BB8BABEE982F1BA9BAA9DCA99C67076E47F0935FE191E5041DCD17AAAF4D51AB",
-"00114F480002B57A745E04F9DB943C09E850271AA9E4581587D3AA344B33DAE827BB8BABB7EEF7EE40B5217D2F5D2C1E2089FCF55FE191F3041D7F26000503CD47",
-"00114F4900028AED92386553CAAC101A3E55271AA9E4581587D3AA344B33DAE827BB8BAB6A112DCEC39A62E65A2A4E4F4D5C60575FE19217041DCD0D555594CF47",
-"00114F4A0002AA56F8B086E19120C18DA2BB271AA9E4581587D3AA344B33DAE827BB8BABE43DAC93AE83CFF540358E8C7FDD1F345FE19232041DAFA9AAAE58B427",
-"00114F4B0002AA73069B24BD81B357E4E528271AA9E4581587D3AA344B33DAE827BB8BAB9EDBDEEEA0880B0C441E737672C1C0635FE1923C041DC00200019F6036",
-"00114F4C0002EC167127C088A6C1B73DB194271AA9E4581587D3AA344B33DAE827BB8BAB9E559426F4AE8F596B3A516913561AC55FE1924B041E210755607E9E86",
-"00114F4D000221A10FF8DEA4C00607AB27BB271AA9E4581587D3AA344B33DAE827BB8BAB60499C532C4D1CAE98CBE311C0BC772A5FE192A1041E6CDDAAB5900398",
-"00114F4E000209BE8C688964622101FFC9C9271AA9E4581587D3AA344B33DAE827BB8BAB08B8066E0580E1511F929837F2F293FA5FE192DA041D5A86AAAC250357",
-"00114F4F0002C52F2E206DEAC4DA60D044C0271AA9E4581587D3AA344B33DAE827BB8BABC790E565BE475462C11640275110E0EC5FE192DF041CDEC4AAB34FF85D",
-"00114F500002C9E364510005A74ED2C21A66271AA9E4581587D3AA344B33DAE827BB8BAB5BC51F5A2D7BD94C97A2DB54FCED9BE05FE1930B041D550CAAAC27A73F",
-"00114F510002FADCA3FC867B511E3D10F026271AA9E4581587D3AA344B33DAE827BB8BAB6CA286A25E9C6BDA581D86CF72BEE6EF5FE19363041D120DAAAAF32C5D",
-"00114F52000278CD21B1A83F73123A9BC373271AA9E4581587D3AA344B33DAE827BB8BAB91CE5B36D43CD01F8E060D72A18650565FE19365041C0BD4000329585C",
-"00114F5300025106926A329BC55ED97E29AA271AA9E4581587D3AA344B33DAE827BB8BAB5EF9F14781CE12A13B8FB42241C320B35FE19383041C8AD600038D3398",
-"00114F540002A2B2F6CF98CB0F4F55BC570A271AA9E4581587D3AA344B33DAE827BB8BAB3C8A1F919043993B10957FD9FAAC695D5FE193A2041C8B24555577DAE0",
-"00114F550002604229DA23A96C12575422B5271AA9E4581587D3AA344B33DAE827BB8BABD3AF12A6B0074241E56AF5C739FABE1B5FE193A3041C878CAAAC929AA7",
-"00114F56000205141BC3C9DB2C701027D9A3DA23A96C12575422B5271AA9E4581587D3AA6B082CB916CA8CBA8F747DCAF6002A9F5FE193BF041D0D3500081726AD",
-"00114F5700022E0BD582FD436C699AE2B2BBDA23A96C12575422B5271AA9E4581587D3AAE2AADD84612B1203ADC7BBD8C90034075FE193EB041D16CFAAADDDC15D",
-"00114F58000218035C2DDE24D7A413D0D495DA23A96C12575422B5271AA9E4581587D3AA9DE75AB81FBEC0AE6D14F6B5C6215F175FE19409041CD791AAADA2C5E6",
-"00114F590002E62A5A70DDC84888C02C45BDDA23A96C12575422B5271AA9E4581587D3AA5006DFD27831C472B81106276D1C6D505FE19427041CD88E5558EA69B8",
-"00114F5A00025A272EFAD3373AE9245E06FEDA23A96C12575422B5271AA9E4581587D3AAD7F9E5D836596D581FE7B73F822095135FE19431041CD7BCAAABA0FA30",
-"00114F5B0002197CD4DF39BBAAF231B5CA9BDA23A96C12575422B5271AA9E4581587D3AAB5D696348D8F10A98E773D521DDB99785FE19434041D35E355575FEABF",
-"00114F5C0002E21CA5B24C481044D22A47A4DA23A96C12575422B5271AA9E4581587D3AAB6490F348B330EA9004D930AD46B04B75FE1943B041DB501000455EAD9",
-"00114F5D00024C9A36932A5A6BA32DF9CEEDDA23A96C12575422B5271AA9E4581587D3AA30722BE7A7631BAFCC7136F4E3F822725FE1945E041E2587AAADB539ED",
-"00114F5E0002347128B7125865C05BCF0884DA23A96C12575422B5271AA9E4581587D3AA2F88C2D2AA8BB33A7B28F4EDBE1E92D95FE1947C041E0B655559C68DB6",
-"00114F5F0002739165900A68E19554CBD86DDA23A96C12575422B5271AA9E4581587D3AA7FBD081EBF19433AE0B9A4433C1049B45FE19488041E0B2A000829199B",
-"00114F6000024AF1EA22621A3157CEA96038DA23A96C12575422B5271AA9E4581587D3AA745A3B3256482B730142E51CA8F4DA885FE194D6041E666DAAAB5C51B3",
-"00114F610002B89CDF121F66516037D3FF19DA23A96C12575422B5271AA9E4581587D3AAFCE5B68F19F2B49935807A3DE801A6555FE194ED041D74E6555970BA74",
-"00114F620002112A454492920DFD1846DAE8DA23A96C12575422B5271AA9E4581587D3AA89C69287B1CC6362B760B57DAEDC580C5FE194F8041D9996000B989D28",
-"00114F6300025774186E823A3C1E4DB65B31DA23A96C12575422B5271AA9E4581587D3AAAC5EC15499C66825D154787F6C9D14C55FE19534041DF6F50007DED4B4",
-"00114F640002E5D9AA516BC2FD3EA6451D4BDA23A96C12575422B5271AA9E4581587D3AADAE012857E9D24B0D5F38CD0ED996D755FE19549041D659B555AAEA61A",
-"00114F650002D5DF7DE442AD9D1129DE7EDFDA23A96C12575422B5271AA9E4581587D3AAD3C0EB7B2B4FB542EC46A8DF99A1EECB5FE19558041D932FAAAF924885",
-"00114F6600021B9AB9D2F344F857F342A85BDA23A96C12575422B5271AA9E4581587D3AA4D848700FC82FB639320A1FB714EB7355FE1957E041DD8B3AAAAFE7681",
-"00114F670002DCF779C374C8930198E5B377DA23A96C12575422B5271AA9E4581587D3AAF631CAC0432B52846FBDBEADDBC654335FE1958D041DAEF05555995BFD",
-"00114F680002F85BABB657B9B09AC9367F84DA23A96C12575422B5271AA9E4581587D3AACCD2FC8A08E91BE1871360D39BEB48605FE1958F041DF90D000185569B",
-"00114F6900024CEADFC644F61BC48C9A6A3DDA23A96C12575422B5271AA9E4581587D3AAB17403B460E12069B9BBAAFAF4A86B075FE19594041E8640AAB31290E2",
-"00114F6A000210094A5492190F735FA14581C644F61BC48C9A6A3DDA23A96C12575422B53946622B59A58B610E70EF7E8E25D4995FE195C1041F0818AAAC7D0FE0",
-"00114F6B000268D06F1CB09823D43879AE29C644F61BC48C9A6A3DDA23A96C12575422B5D24F056B12BAEE50EF5552C454A1F5065FE195D4041EB7CD00009817C0",
-"00114F6C000269F6A3968EAC99E2475208EEC644F61BC48C9A6A3DDA23A96C12575422B5F934BEFCE77211F67DCD68BD81766E6D5FE195DA041EF333AAAFF16DE3",
-"00114F6D0002DC34D71A6A75A77D8728EF65C644F61BC48C9A6A3DDA23A96C12575422B56F360156C40D0695731846EBCBDBB4E65FE195FF041F744F0001645F90",
-"00114F6E0002314CD88F5C51DA3F6C309791C644F61BC48C9A6A3DDA23A96C12575422B57C7A7ADB9F477B6F4296B1D1D6A7430D5FE19604041F4D1BAAB4DCC03C",
-"00114F6F000264D23FAF3D460DC45DEEE004C644F61BC48C9A6A3DDA23A96C12575422B58F51038BF4A1D107E36E3D671E7761AB5FE1963D041FD4185559AFFB09",
-"00114F7000022DA0E00D15BF195637F56A7EC644F61BC48C9A6A3DDA23A96C12575422B597CF39D199FD560A2ADDB9304CCE940C5FE19661041F40710000BB26ED",
-"00114F710002BCDC4E908831879F8D6CAD4DC644F61BC48C9A6A3DDA23A96C12575422B569F7025533980F238AF828416EF9DF005FE19664041F232BAAAD188E6A",
-"00114F720002C839BEE5CBF665874B8A44B2C644F61BC48C9A6A3DDA23A96C12575422B5596D3BDF42B807B3330CC2865705D73C5FE1966B041FB4BE0000C88D6E",
-"00114F730002CEF634B6EC6461643F1173EEC644F61BC48C9A6A3DDA23A96C12575422B5748C15A6E23E676E62647536A7372DED5FE1966E042033C4AAABA06028",
-"00114F7400025C699E8975C7D94C5741C863C644F61BC48C9A6A3DDA23A96C12575422B5C80D17290B27B03C46ECFE890613F87D5FE1967D0420CFF7AAAE1F1D0B",
-"00114F750002B068EA2CB7248DD75C02E425C644F61BC48C9A6A3DDA23A96C12575422B54587E3D2C1C3A5418412BEB06ECF8DC05FE1968C04212878555CE5E247",
-"00114F760002AF382E7268B6ABE7AD877F5EC644F61BC48C9A6A3DDA23A96C12575422B5A709393B9C8BA7798D53937DA724AF255FE19711042182A40002123CFD",
-"00114F77000240FE83433D72A7804EF64D2FC644F61BC48C9A6A3DDA23A96C12575422B56182E159B3C142369E2942E426AC6BAA5FE19727041F3567AAB51E75C0",
-"00114F780002C6ADC68DB661C99F80C63040C644F61BC48C9A6A3DDA23A96C12575422B580B05267ACC2742F359DEEA8F035771A5FE19759041F674455569D67A0",
-"00114F790002A2AB45C9079799691F1FBAA2C644F61BC48C9A6A3DDA23A96C12575422B52A4F157A6FDDF03C99025B67A59EC3EC5FE1975D041EFD8755575ADE7C",
-"00114F7A0002681C2102C614803D127C139DC644F61BC48C9A6A3DDA23A96C12575422B5C94536722C2D05E12C1A0DCE606853E75FE19764041F8B26000140671B",
-"00114F7B00027B885CE86984BB423317FB34C644F61BC48C9A6A3DDA23A96C12575422B525083CD3CFF077300C2A5B298DF1F2B45FE1976804200A6D55563936D5",
-"00114F7C0002D22AA0140C81F62008D5AB5AC644F61BC48C9A6A3DDA23A96C12575422B5A1ED186C7515D04170D2115426FC067B5FE1976B04209E7A5556BCC58B",
-"00114F7D0002419D5F823D43AA1B7FA044F6C644F61BC48C9A6A3DDA23A96C12575422B5FF446D5B3950FBEED25AD5D8E6D53EA65FE1977204213E6A0001D90BB4",
-"00114F7E000214B1A97DC11BEEB127296EA8823D43AA1B7FA044F6C644F61BC48C9A6A3DD25BA9A43D27F4ED2C15F43AC17FA39D5FE197780421CB9C000317FB62",
-"00114F7F0002FE756B2271A90A10D7D672F3823D43AA1B7FA044F6C644F61BC48C9A6A3DD32A7E2FEA06CD6E7C7875D99827F73B5FE19795042263A1AAAC7795DF",
-"00114F800002898D3D2DA9E2E9C4E7B43EF8823D43AA1B7FA044F6C644F61BC48C9A6A3D13CF6EA6972F1C80F4828AB8CD444B685FE1979A0422684F00003FC3B2",
-"00114F8100022661C195C61D6FD4B7500489823D43AA1B7FA044F6C644F61BC48C9A6A3D33EC9CEE23BE875EE05847B5533ED6FA5FE197A904230969AAAAEEF038",
-"00114F8200027E158A5F3D9E5B3AC643A0F3823D43AA1B7FA044F6C644F61BC48C9A6A3D9C98C3302F966C26AFEAF296B7FF0A355FE197AC04236F78AAB5B682FC",
-"00114F830002C0AF31143A4907C4E3817501823D43AA1B7FA044F6C644F61BC48C9A6A3DCF33F4A5D4516CA7EB392B3F2499DA2E5FE197E704242D3A5555FCD545",
-"00114F8400028A355739D5960AB42BD1B1DE823D43AA1B7FA044F6C644F61BC48C9A6A3DFDEA21C374917EC3667CD49F796522E95FE197FF04236434555A0AE8C3",
-"00114F85000298FA72888996C0D68E5FB68D823D43AA1B7FA044F6C644F61BC48C9A6A3D819A9FF61B2DCD0097508B56B834622D5FE1983504238FB4AAB2DAA59C",
-"00114F86000240A62615C3D67254974C0D6B823D43AA1B7FA044F6C644F61BC48C9A6A3DB2CFF63892712F9F6B38AD2A46CD0C3F5FE1984C0422EF41AAAB69025D",
-"00114F8700025511F87BAEB207963BADBE2A823D43AA1B7FA044F6C644F61BC48C9A6A3D8BF38E32B19F5DA02CEA2ABE3F5283405FE19885042321455559B98728",
-"00114F880002CFD9B0D0AEE58CBADF3D4A24823D43AA1B7FA044F6C644F61BC48C9A6A3DF7CC07FC89FC378E53D0E3B119275F865FE19892042272680003260C88",
-"00114F890002E729DB4FA1F9D770F647F90C823D43AA1B7FA044F6C644F61BC48C9A6A3DB0969C0F0137E5D81EA15516B1A904355FE1989B0422E10FAAAC3726C2",
-"00114F8A0002F59E5BFD0C74ECDF20239ADC823D43AA1B7FA044F6C644F61BC48C9A6A3D9C73C6DCE0F5DD24E3BCC5744B6F6F655FE198A004236C7EAAB4DA101D",
-"00114F8B0002454B273AE322925F91D71436823D43AA1B7FA044F6C644F61BC48C9A6A3D8441BD2E30E455DF10EE0B107328AF045FE198E704241AA9AAAE71BB20",
-"00114F8C0002CEF8713A87423F009B06A4EF823D43AA1B7FA044F6C644F61BC48C9A6A3DEDC2C5C123E85F1BCBEA52B684AC88BE5FE1991C04230326AAB41B6D8E",
-"00114F8D0002835C3AAFF921BDA12376AB6F823D43AA1B7FA044F6C644F61BC48C9A6A3D018AEEC9B2C18B6E7D002022BE56F08C5FE19993042270EF555A1D57CE",
-"00114F8E0002F5C71DF750795E5348C34CD2823D43AA1B7FA044F6C644F61BC48C9A6A3D862C71A93234396128D275A35AB42C695FE199F704205922AAB083B287",
-"00114F8F0002B4E063B025C0F0C66C49D807823D43AA1B7FA044F6C644F61BC48C9A6A3DB1CF0B5797F08A33791ACE46BE7AE6795FE19A43041EE5BD5555947CA6",
-"00114F9000023340FDE457DC0D95F02EE5A8823D43AA1B7FA044F6C644F61BC48C9A6A3DDC74DC0A5BE61621413B7D47F53B35D05FE19A45041E049955601A6E90",
-"00114F9100023136B56DF8E50B6A9C08726B823D43AA1B7FA044F6C644F61BC48C9A6A3D97F1EDD1F2EDB8EA82B3BB0915BAA1515FE19A79041E8F32AAAAABC02B",
-"00114F920002A2999EAD5B7ADBA949DD31B36DF8E50B6A9C08726B823D43AA1B7FA044F6B4F4E6690F58219AD24BCAEEF2BFA7BA5FE19A79041E210F00027E589F",
-"00114F9300025B2D6C941E94936BCC27614C6DF8E50B6A9C08726B823D43AA1B7FA044F6252F2BDAEAB7EE3C2165BA7EA4F5132D5FE19A8D041EB860555B40A047",
-"00114F94000205EADB09AC0D2A6402BC82296DF8E50B6A9C08726B823D43AA1B7FA044F629638558FDFEFF7C8047C80CB85EC30B5FE19A9F041EEB790001905C31",
-"00114F950002B725047B97518C37889DD5156DF8E50B6A9C08726B823D43AA1B7FA044F65B3F20C3D8D3A55D976DE7BA0B756B965FE19AA6041F2ADE00019AB627",
-"00114F9600022BC4D0B29325B2AECF874F286DF8E50B6A9C08726B823D43AA1B7FA044F636D737C48721B15D5E79FC05FCCD6B8A5FE19AAB041FA441AAB426FC1C",
-"00114F97000268F8AD48E74BF22942BCF8266DF8E50B6A9C08726B823D43AA1B7FA044F67F69A3C69B60027B52B7A6AD7F1E62885FE19AE3042029D6AAAD9338A5",
-"00114F980002AB133CEFF7EC6EBE9D3A4F7D6DF8E50B6A9C08726B823D43AA1B7FA044F6F17756BF997AE5B345C7DF4B43ED78EB5FE19AF9041F9B745555DA3A4D",
-"00114F99000242C6C9D6C89F7D6CADB2B5CE6DF8E50B6A9C08726B823D43AA1B7FA044F63C670F2AF11EE6595F60CA440CBD636B5FE19AFB041FC8E0AAB3E9DDBC",
-"00114F9A0002CE008230CC8CD3162156E8156DF8E50B6A9C08726B823D43AA1B7FA044F6613AF330C2A1DA5D3564DEA0C320AD765FE19B2C042064D5000218E83A",
-"00114F9B00028558A5116D55530109526B196DF8E50B6A9C08726B823D43AA1B7FA044F6B3CF4E69B315D524D635D960DC226FB05FE19B49041FFA99555CB9B68B",
-"00114F9C00025738E0D488872AED781359A16DF8E50B6A9C08726B823D43AA1B7FA044F65071CEC0F042D2DA7284460E62A144C45FE19B5E0420029EAAAE571659",
-"00114F9D0002787B9370A5F1EF4A5E5C84826DF8E50B6A9C08726B823D43AA1B7FA044F60E1963EAC60350C0B2D18DC2554AC5A75FE19B7E042033FD5555AAF684",
-"00114F9E000202120A1B4B00ECEAFE22F8BA6DF8E50B6A9C08726B823D43AA1B7FA044F690AC9D054E87EBE559F43D6A2DD1AFFC5FE19B8004202A7A000381A2D6",
-"00114F9F0002705A74996B29154C8A8089AF6DF8E50B6A9C08726B823D43AA1B7FA044F6CF15CF082BB2431E29AC289A38D4D6A65FE19B9F0420CC99AAAFD6F2AB",
-"00114FA000026794A010898879800ACBE1F96DF8E50B6A9C08726B823D43AA1B7FA044F66D06748386E97C0E8D524F195DE739985FE19BC60420C6A7AAB011B7D3",
-"00114FA100020F1E4142D1BE30F542FD43AA6DF8E50B6A9C08726B823D43AA1B7FA044F6738A0FC5155E5EDFD200A34903790C265FE19BD50420935F55573F7BB6",
-"00114FA20002DC3C56CD00DBBDD5E8EC63F56DF8E50B6A9C08726B823D43AA1B7FA044F6A91B2F09720DC1134FEB06A3A717DCDD5FE19BF90420EC75555803319E",
-"00114FA30002F973D3F998B1828D6768ED676DF8E50B6A9C08726B823D43AA1B7FA044F65FF2A651F843E409782BCDBDF781FB4F5FE19C010420C82F0003A37560",
-"00114FA40002B13592858FB40264571AA62B6DF8E50B6A9C08726B823D43AA1B7FA044F65BDCF9E1F1DD3502DF2618A2E39A9C195FE19C0D04214CDC555B19F100",
-"00114FA500025DB7E9D4F44E2490F82EE13B6DF8E50B6A9C08726B823D43AA1B7FA044F63B90DB208C9FFE9C4F99DF02F5D13FF75FE19C310421B862AAABE899F9",
-"00114FA600028E4E23E368626BBD8AD791F4D4F44E2490F82EE13B6DF8E50B6A9C08726B8CFA3FA62D141AC73803323E6C78DBAF5FE19C350421936DAAABBABCF0",
-"00114FA70002F38D0BAD84284E82F2E978C3D4F44E2490F82EE13B6DF8E50B6A9C08726B3469D7DFD19C0F3822E22832C910386E5FE19C38042231B400062B7545",
-"00114FA80002EF2A4028E0BB62B2B177FEF1D4F44E2490F82EE13B6DF8E50B6A9C08726BF3342B63766823865987FC8BBA8122A45FE19CE90422D54C0008DA2768",
-"00114FA9000263050B6E108DC852F566DFDDD4F44E2490F82EE13B6DF8E50B6A9C08726B1034A7D2DD6B89D1D2E2DA975C5872215FE19D17041F6CD500068C8BF6",
-"00114FAA000231442F8A3C168535849F3E38D4F44E2490F82EE13B6DF8E50B6A9C08726BF8DF8ADAA1BD9872BEC11DFEA3C66CE55FE19D55041F2288AAB480D6BB",
-"00114FAB00029F25DB3C77BDDB8370512EBCD4F44E2490F82EE13B6DF8E50B6A9C08726B9FFEBF0B2DB97637856177AEEA89E6D05FE19D97041E7F0500050E659C",
-"00114FAC0002318FD508455998CCC4B1DA68D4F44E2490F82EE13B6DF8E50B6A9C08726B4C61F7B39C955D75B6ABCD4FDE32AD2D5FE19DBB041DCF7BAAAC72E432",
-"00114FAD0002D524808814DFD1BA7DD324D6D4F44E2490F82EE13B6DF8E50B6A9C08726B78A485E47CAAAA78911D9F8F2F53F8565FE19DC1041DB5B555559BB063",
-"00114FAE00025EBA44CA73FD6C69885585B8D4F44E2490F82EE13B6DF8E50B6A9C08726B8730CF347A252B74FE9E8CAD869221EC5FE19DD6041E2A51AAACD0AC28",
-"00114FAF000248480AD1B503220ECD575E98D4F44E2490F82EE13B6DF8E50B6A9C08726BE81A607F2C4606D203A00C56EB8698F05FE19DDD041E5648000285351D",
-"00114FB0000217A4056C6473DBCCA5F0DF40D4F44E2490F82EE13B6DF8E50B6A9C08726BD782DCEE728A6348631EB8A70358BA965FE19DE4041ECB4A0001FD91AC",
-"00114FB10002617AE6D5F544A8730F6146CBD4F44E2490F82EE13B6DF8E50B6A9C08726B73CCC39D7731415E9D35F13CD27E9CC85FE19DFF041F42E3AAAEF51A89",
-"00114FB20002CB4B2033E32DCA7AD15001EDD4F44E2490F82EE13B6DF8E50B6A9C08726BDF81C4903909FD96D3EE11B7126486C45FE19E21041F4F0955586018A0",
-"00114FB300023B6AE08879E43F9F0C4669D4D4F44E2490F82EE13B6DF8E50B6A9C08726B4D95E602BB190A853FECC595DB4A8A3F5FE19E29041F3896AAAF0A3F03",
-"00114FB40002BD571D6620354EF9A5AFD32FD4F44E2490F82EE13B6DF8E50B6A9C08726B6071438903818FC034C77F21031E80565FE19E4E041FAF6D55582A8AFC",
-"00114FB50002EC938ABD5BD7B73134E2DFE2D4F44E2490F82EE13B6DF8E50B6A9C08726B874E61B33F244037B07CA2BACB6073705FE19E6C041F87E3AAAFACEBBB",
-"00114FB600029CB3E858E970FD8A64A5EB7FD4F44E2490F82EE13B6DF8E50B6A9C08726BB02DADE48D3F490BD9110AB74B811E1C5FE19E7A041F8527AAAACA7E6D",
-"00114FB70002E0B9551A7782DE235FA93CB0D4F44E2490F82EE13B6DF8E50B6A9C08726BCDCFBE21E31D8C2AD378A6B21D2FE7255FE19E7B041FDC8BAAAED1E65F",
-"00114FB80002A8C0472ED6D683DCE519DAF8D4F44E2490F82EE13B6DF8E50B6A9C08726B9E25C026494CDDAF077C959CE0751DE45FE19E8D04207C71AAAD3D7D73",
-"00114FB90002E960E08265E21B81700A6971D4F44E2490F82EE13B6DF8E50B6A9C08726BE71184DF52E7A3D7234A2F70244FFEC55FE19EAB0420BE9EAAB0A447C2",
-"00114FBA00022C31B848A9678384986C380B8265E21B81700A6971D4F44E2490F82EE13B539669C02F120C5E0233713097641D1B5FE19EBC0420BEEC555646365B",
-"00114FBB0002CA3578FBBB9C4F842785057C8265E21B81700A6971D4F44E2490F82EE13B09067808279DEB995FF2DF6A015C64BE5FE19EC6042109E6AAACC0428C",
-"00114FBC0002CEB598CD155F44766D742CA08265E21B81700A6971D4F44E2490F82EE13B75397E8C62AD6A804767064E4AAEBB2E5FE19ED804217E185555CF12F1",
-"00114FBD00024D99BB1125EB12B086244A888265E21B81700A6971D4F44E2490F82EE13BCB549BF83C060281DFFC77E8A86C87BE5FE19EDA0421C485555A8EEBC5",
-"00114FBE00027525FCD01AF93D157BE413918265E21B81700A6971D4F44E2490F82EE13B01892CA58967089EB34AAB7646A8D9185FE19F11042270685557D6E5B9",
-"00114FBF00021398389D3E48C643BC58A88A8265E21B81700A6971D4F44E2490F82EE13BE51CAB7E7647B5F6A118486AAD18F8715FE19F370421D3C20006F4C216",
-"00114FC00002D88B744A697B30BCB7753CDE8265E21B81700A6971D4F44E2490F82EE13B3D0F93797DDFC6FFA7C2428C825D90C35FE19F4A0421A5FF555B2A27A8",
-"00114FC1000283E502EE29EBB1C45F61E3BD8265E21B81700A6971D4F44E2490F82EE13B571F1519D1000137DF3CB186924B0E705FE19F5C0421EA2C555965E279",
-"00114FC20002321D6AB80C00D486D09967B98265E21B81700A6971D4F44E2490F82EE13BEA83A178A82E1F1C489C13348084388C5FE19F6C042232C1AAAE5B9847",
-"00114FC3000219B670A25FBB437B52455BFA8265E21B81700A6971D4F44E2490F82EE13B37380221F1C70C180DE97A2F2D97E8825FE19FB5042289435558A9D0EE",
-"00114FC40002805AC4B02C6569A11BAC6D368265E21B81700A6971D4F44E2490F82EE13B32FA6A14C4CE354FF99A7612A4EDC16E5FE19FD504218215AAAC02A2FB",
-"00114FC5000273447E0FF14ED03BA63746E78265E21B81700A6971D4F44E2490F82EE13B459A0ACF9EF340A289DA5AADFBB1C2E15FE19FFA04217622AAAD26AA5F",
-"00114FC60002BF68794F7BDC206D76A0F1048265E21B81700A6971D4F44E2490F82EE13B58A948FC2F7630BFDF168FCEFDFA0BD25FE1A02204214D370002595789",
-"00114FC70002F07BB9BEFE898443E01D69898265E21B81700A6971D4F44E2490F82EE13B0C7EC9246253BB5197350E5973DF6DAE5FE1A0490421147A555784AFE6",
-"00114FC800020E0DB0829EA02D1099E6BDC68265E21B81700A6971D4F44E2490F82EE13B4600411AF5538E50AFF47B609546578A5FE1A0670420DFC9AAB1459416",
-"00114FC90002136A17CCC79A3A59D8973FD08265E21B81700A6971D4F44E2490F82EE13B2FF4D29A6FFBA0216F03B82C986618075FE1A08E0420E097555ADC614B",
-"00114FCA0002C973DE93ED0BDA8D49CA861E8265E21B81700A6971D4F44E2490F82EE13BC20DA01205A0F6E9EF7E74AE5B17D99D5FE1A0D50420AE7AAAAC1A0290",
-"00114FCB00026B3D003EC7DEA7BE9A6BF2078265E21B81700A6971D4F44E2490F82EE13B52197B86B0416B5FA1C25F63092F88CE5FE1A0EE041FCEFBAAAF7E7C43",
-"00114FCC0002CDE1817BBD124A674F6A58CB8265E21B81700A6971D4F44E2490F82EE13B7214F94F8217F3E4BCB49C7B222806A85FE1A113041FECC800060F5234",
-"00114FCD00026BB792DF9E61300313E27AB38265E21B81700A6971D4F44E2490F82EE13BE68DD2B7DA359DA3BD286967A52C304A5FE1A13A041FC90BAAAE12EA21",
-"00114FCE00023F4D3A222AAE2E7302708D1BDF9E61300313E27AB38265E21B81700A69713AE0764E0A00357EE46A4C592A3267315FE1A16D041F9BC8556190FFCB",
-"00114FCF0002F95DCACD958947DA8D4F7100DF9E61300313E27AB38265E21B81700A69713F5475DB0874A91D95D4AB4B577AB9515FE1A1A9041F2F950005878488",
-"00114FD000024148151851D82AF2A4B6D0D7DF9E61300313E27AB38265E21B81700A69713303CCABF36FB0EAC80EF279795506195FE1A1CE041E9BDBAAAABB6D28",
-"00114FD100028E7AE30C482CB8A956F9B6A4DF9E61300313E27AB38265E21B81700A6971B63A5B5F7A0D0CBBC35E470F1AA8610B5FE1A1E5041E7CDD0000C912FB",
-"00114FD2000223146D84CC3CA1FB03262DF8DF9E61300313E27AB38265E21B81700A69716EEF03F880AA689B41C475223C53C1755FE1A1E8041E9FA10002CCEA00",
-"00114FD30002E2832D6CA5116F879E3FD655DF9E61300313E27AB38265E21B81700A6971D1A719E8EC1EA449E2BB396466AC18CB5FE1A204041F280D5559C33632",
-"00114FD400022BF99748C96BA00BFF74A863DF9E61300313E27AB38265E21B81700A6971D4D9CB410CA44B32DE81A3F24A52C8EB5FE1A210041F301F0002D7B025",
-"00114FD5000291EF47A710CCF2687CDD1147DF9E61300313E27AB38265E21B81700A6971FD5F76C39CAE46B5F4643E50C07C40FD5FE1A22F041F8D1BAAAC7E80B1",
-"00114FD600029552F0172780ADAB7C516E65DF9E61300313E27AB38265E21B81700A6971350872CA08FA71324FD2CDD64E8D0CFB5FE1A24B041F88F85559A78D56",
-"00114FD70002B4CB45EC9C7D46B903B99CE9DF9E61300313E27AB38265E21B81700A6971D661AB331F73361230789E152BA73BF35FE1A279041F953A00008B3914",
-"00114FD800025AA6E1A31E111E5B827342AADF9E61300313E27AB38265E21B81700A6971AC585427E2965DC65BAB209D13B1833D5FE1A2C4041F444F5555A5B0CE",
-"00114FD90002496B627D6C866324901F4BCADF9E61300313E27AB38265E21B81700A6971C12C94777A536ECEE7B52016B7E1402A5FE1A2C6041E6626AAAC7CF8DF",
-"00114FDA0002F9BF88C660A05A649AB5F307DF9E61300313E27AB38265E21B81700A697161E5AAEF06A147579653D953855C87DF5FE1A32C041EF38055570E147A",
-"00114FDB0002B70D94FFB0AD05FAEF34AFEDDF9E61300313E27AB38265E21B81700A6971575DA7440406FCE78197562136E23A8D5FE1A332041D9395555E893530",
-"00114FDC0002F2993961F6C949988C9C97CFDF9E61300313E27AB38265E21B81700A69715DCE24400E0EE89B74837AB5293B4FF55FE1A361041E07E30002C20711",
-"00114FDD00028B53FCC0BB5DC7430487B5F1DF9E61300313E27AB38265E21B81700A6971464808C698D6559B54F19822371DEE0A5FE1A37E041DB6E3AAB19DA50B",
-"00114FDE00023FCC0A5D5813B92ECF5FEB1ADF9E61300313E27AB38265E21B81700A697155C98BC0A93173EB65A08650856955C45FE1A391041DBE3A555B77B382",
-"00114FDF00020221017E24382726707B18F5DF9E61300313E27AB38265E21B81700A69711D519CB90348AE584C922C578923D6E55FE1A3A6041DF36DAAAAEA1996",
-"00114FE00002C68B0EF0EAA50BF0DA47AAA7DF9E61300313E27AB38265E21B81700A69718344DD2DA1A9C394701DB6A3EBA3FADB5FE1A3E7041E1F795556F1D711",
-"00114FE1000295F46B16A2BD893BF5F60EEFDF9E61300313E27AB38265E21B81700A6971F6D0E14483C79C5886FBFADD2155628F5FE1A3EC041D7D220004F7949A",
-"00114FE20002C52C6D35FE7D9FFE00DE479516A2BD893BF5F60EEFDF9E61300313E27AB3D8B6D83E93B0E2835B401ABA1FE3FC605FE1A3FA041DF455AAAB4A361F",
-"00114FE30002BE90999834F141522F5BED4316A2BD893BF5F60EEFDF9E61300313E27AB34804D763A6DF7E76D77C342775C6AACF5FE1A3FE041E40F4AAAFA16CE1",
-"00114FE40002A650929A83CC0BEBA527BF8816A2BD893BF5F60EEFDF9E61300313E27AB392A3CBD4FEA5C3606AA65FD8219C803B5FE1A410041EBFEBAAAD7180BD",
-"00114FE5000261F7DF6EE73AA1AE2A0412E616A2BD893BF5F60EEFDF9E61300313E27AB30927054D5CD08D30418CA76A3B0E69245FE1A41F041EFC600004774C4A",
-"00114FE600025830F87C35063EB1122B3CC916A2BD893BF5F60EEFDF9E61300313E27AB38903C33B27C289594E7CE0C2556DFCD05FE1A45E041F49480002C4BCFA",
-"00114FE700028C71985F2A5694EA3FE032FF16A2BD893BF5F60EEFDF9E61300313E27AB31DF96A9DD449A599A317F39E02DEC77C5FE1A46E041EA1B155569E9C56",
-"00114FE8000248CDA13191E3EC79742E100416A2BD893BF5F60EEFDF9E61300313E27AB3A5A5CA798CB370386D39F253EB8F030A5FE1A473041EE72BAAAAC8DC7A",
-"00114FE900029DACB1B34B3970E674F2303416A2BD893BF5F60EEFDF9E61300313E27AB334191A9D739AD67F31AD44F5B04670BB5FE1A474041F675555571D5E77",
-"00114FEA00028F7A79B85DF4D8389C88BD7716A2BD893BF5F60EEFDF9E61300313E27AB3DADAB2BC705F78B74D0847F79E113D2E5FE1A490041FFF76000231115F",
-"00114FEB0002151112952C433C1E1F17D4E616A2BD893BF5F60EEFDF9E61300313E27AB308A855D26DD69C86C396103E7446E4EF5FE1A49704200919AAAEB8900A",
-"00114FEC00026CE99D6CDA04FF173F2F3B2216A2BD893BF5F60EEFDF9E61300313E27AB3227906E8F0AFF621B23DC758FE0E05DF5FE1A4A204208733AAABC57638",
-"00114FED000256ED5A2CF4A5123B0BC1CCD316A2BD893BF5F60EEFDF9E61300313E27AB3FDECE6BE444BBF0F18F11B925C83D1C65FE1A4A60420F3CD5556FEE5BD",
-"00114FEE000258AA36D4421835FA5D4FD61116A2BD893BF5F60EEFDF9E61300313E27AB347658AE51E373FCB1BDE80BB803E00475FE1A4C104218DAC00011F9168",
-"00114FEF00020295DD4B0F91CAF72351C22B16A2BD893BF5F60EEFDF9E61300313E27AB3C1C46F33C15C6922C440515061B8C99E5FE1A4DB04219FA3AAABB619CC",
-"00114FF000027043B2B7D5C8529F0EBF6FA116A2BD893BF5F60EEFDF9E61300313E27AB38960BC2E3B0FA7FCD441C29B3B1E4A215FE1A4ED0421B4DE000028DDFB",
-"00114FF10002A7D6DD1CF69FB37EA30F650B16A2BD893BF5F60EEFDF9E61300313E27AB3D183F9549E106857C3CE2095D4CC0F8B5FE1A4F40421FD0100022FAF51",
-"00114FF200021D820FC9D1B064AF98715C5E16A2BD893BF5F60EEFDF9E61300313E27AB386CA178543DCBF79A01ECD962B9C27F85FE1A4FA04228793000006D0A4",
-"00114FF30002DAA7AAE229BC28FDAE485AEA16A2BD893BF5F60EEFDF9E61300313E27AB3BB0C2C74249E6289B96A209A62B9EF565FE1A50304231DDEAAAC532994",
-"00114FF400021C0824DB754DC2213303CA5D16A2BD893BF5F60EEFDF9E61300313E27AB337A83474B53EA4FE1F950383575D45115FE1A5080423A5B0000417B71C",
-"00114FF50002D86F327BE7D448AD4F4EC52F16A2BD893BF5F60EEFDF9E61300313E27AB3C89FDC2E7E04D945853B68D2C894E73C5FE1A52904245240555AFAA8BC",
-"00114FF600022C6A10A00E8F77CD2914FB767BE7D448AD4F4EC52F16A2BD893BF5F60EEF1A7C959F94BFF35E94B264E5351443105FE1A5390424392A00020D5168",
-"00114FF70002A3CB4821355E415E08DEA1427BE7D448AD4F4EC52F16A2BD893BF5F60EEF74D72B1CC4DDAB894E11825ED60F33445FE1A5D504249D9FAAB0693667",
-"00114FF800023EF229565D91221F6A9C94B27BE7D448AD4F4EC52F16A2BD893BF5F60EEFDDA4E9E6D0F43A752F6FDBCAF308E6695FE1A5E5042169875555A90531",
-"00114FF90002EF202EF2BF2CDF2953AE90197BE7D448AD4F4EC52F16A2BD893BF5F60EEFD262891275DCF9AC0482CB15CCE2EC735FE1A5E70421C6C40004F3DBA4",
-"00114FFA00024B1009FD83866C1B9A14595C7BE7D448AD4F4EC52F16A2BD893BF5F60EEF38E71B21A95624CE7B360FB1D6A63A165FE1A5F80422740DAAAB14C556",
-"00114FFB000251812585C52D01828D7AC3617BE7D448AD4F4EC52F16A2BD893BF5F60EEF5596529AFDD31FA58E497111648982F35FE1A5FB0422C681AAADE1A074",
-"00114FFC000289AA47C0D9CF4BA41B4E7D987BE7D448AD4F4EC52F16A2BD893BF5F60EEF1D22812B6C3A6A34287EF40A0A2F877C5FE1A6050423747D555DA2B54E",
-"00114FFD000289726649A37154E970127D037BE7D448AD4F4EC52F16A2BD893BF5F60EEFE7A87E0838500FB61A2F0008BDD2C3AE5FE1A63E0423FA315555B6F9F2",
-"00114FFE000246A8F31CC923206ACBA8B4837BE7D448AD4F4EC52F16A2BD893BF5F60EEF087C6116BBBEBCBD73FCB4BE424D47DD5FE1A668042345CCAAAD133339",
-"00114FFF00025A53F04A57A137E23CA6C2027BE7D448AD4F4EC52F16A2BD893BF5F60EEF34477E3C9FE25FA0509E932D05A528FF5FE1A66F0422F8C3AAAEDBB8F0",
-"001150000002B0CF2D6B5DD0D98D25482F6C7BE7D448AD4F4EC52F16A2BD893BF5F60EEF6339785ED15C1FDD07A431B8120B06115FE1A691042390C6000524B9C3",
-"0011500100025D31AFCC2C7A3FBC312BF7F37BE7D448AD4F4EC52F16A2BD893BF5F60EEF24F2F0965F358E9F2731554B380FC87A5FE1A6B5042375655557F1E557",
-"0011500200028DAC610884830F2858E2B73D7BE7D448AD4F4EC52F16A2BD893BF5F60EEF757A5863A1BE0B6D3FF5B19D77FA68D05FE1A6BC04234E5C555944A28C",
-"001150030002C2A752865FF4AC13E66FD56B7BE7D448AD4F4EC52F16A2BD893BF5F60EEF977BDAEC99629E407C2587769AD9F00F5FE1A6C70423EA42AAB4718A4B",
-"00115004000299C23577FF35F38B707BACB17BE7D448AD4F4EC52F16A2BD893BF5F60EEF0401E50F2BEA35C4BECC37365690B2A85FE1A6F704246B5D00005CD8B4",
-"0011500500025D7A13F7F0775A1BB975AC997BE7D448AD4F4EC52F16A2BD893BF5F60EEF289F3CD62280FE73891EB86277F9130D5FE1A7440423EE245559F195DD",
-"001150060002D46B40E0E9898BD5BC9336A17BE7D448AD4F4EC52F16A2BD893BF5F60EEFA3E35015537828AB7236C4C7354DF91A5FE1A7A70422BD64AAAD582B25",
-"0011500700027E1A95C5726660948A21FC227BE7D448AD4F4EC52F16A2BD893BF5F60EEFFD8016CCD69527D2CEB335958400F0535FE1A806042120BF5555BC73FE",
-"0011500800023EF1FA1ABD08570F9562E2D67BE7D448AD4F4EC52F16A2BD893BF5F60EEF1C704F8E54F4151D46CE517BBB2940BD5FE1A819041FC09AAAAB8EBA32",
-"00115009000297411F04B13039EA502F5C0B7BE7D448AD4F4EC52F16A2BD893BF5F60EEF54D234E71C1856ECFFFA30F518A7E2025FE1A81C041FFFBF0002B38143",
-"0011500A00026DC0DF33C6710D5B4DF7CE4D04B13039EA502F5C0B7BE7D448AD4F4EC52F1BB9F8FB4248608FC1265784359C7D935FE1A8250420924DAAACF229B6",
-"0011500B0002F8113550B0EAB465463ED6D404B13039EA502F5C0B7BE7D448AD4F4EC52FCCB30F70F551956B179909932DA44F395FE1A898042108E9AAAB278DFA",
-"0011500C0002A732751BCC7F198594CB9F2804B13039EA502F5C0B7BE7D448AD4F4EC52F9920E54304116BB4FA78621FC02B2D2F5FE1A89A041F3DAD55559D73DD",
-"0011500D00023D2FC7247DD09C3A25B8434204B13039EA502F5C0B7BE7D448AD4F4EC52FF706D11A720C248D849723152F2DCCFF5FE1A8AE041FCC175559ABF9C1",
-"0011500E00026636A30C51179ACD32DE7FAF04B13039EA502F5C0B7BE7D448AD4F4EC52FEC93180E84F239E065B929C1AD8EA2645FE1A8D1041FFFBDAAABCC0663",
-"0011500F0002E8D74BCF78206FB2C7396E9A04B13039EA502F5C0B7BE7D448AD4F4EC52FA53FAEB24A186177DBDCA3A0824EC16D5FE1A974041FE328AAAF3A5130",
-"00115010000224A866E773013D750C9CFAFB04B13039EA502F5C0B7BE7D448AD4F4EC52F06FFC9072794DA04538F90B91A8B176A5FE1A995041D55E95557C115FA",
-"0011501100025BCA8F3D29EEC983796BBEF304B13039EA502F5C0B7BE7D448AD4F4EC52F0C9553CA9301004629A3DBA5B778974A5FE1A99D041D4EA40000BACC71",
-"0011501200028D15CC2393C1BDB7EF191B1804B13039EA502F5C0B7BE7D448AD4F4EC52F6950A54083C1F8C9B51328299C5C7EAD5FE1A9B9041DB4C0AAAB440788",
-"0011501300025CF473490FC28F3D02848FFD04B13039EA502F5C0B7BE7D448AD4F4EC52F23FE485F45AA4E8B1639896DD96115CF5FE1A9C5041DBE16AAAF2122A6",
-"001150140002912A6B7D8F89A268368A778004B13039EA502F5C0B7BE7D448AD4F4EC52F54CCF8C94C2264A294D474927B3D90405FE1A9E8041E1417AAAB8223CA",
-"00115015000247EF9849F30FC999F20A48DA04B13039EA502F5C0B7BE7D448AD4F4EC52FF7E90326B931BFEE74EAFBE61938A4665FE1AA0F041DFD550001836FBC",
-"001150160002C6746F7EFDEB87AFD493C52D04B13039EA502F5C0B7BE7D448AD4F4EC52FAF3EC4EB932F4D404ADDD045CBA3935A5FE1AA17041DD40E00001828AF",
-"0011501700023FB83D725D425432B47A9FB004B13039EA502F5C0B7BE7D448AD4F4EC52FA0DC9ACB8211D586A7E28D0A376599D75FE1AA4D041E3CFF555782ED66",
-"001150180002512CF9C46BF01F3C424EFA7804B13039EA502F5C0B7BE7D448AD4F4EC52F505BE28F5791641D80AFF52A00E8795C5FE1AA68041DCC370000BD9358",
-"001150190002B8EBB6BC12793807D9B6DE2104B13039EA502F5C0B7BE7D448AD4F4EC52F72A181E9F038DF25031E08719E0EF9D25FE1AA7A041DDB8FAAAAFADE0F",
-"0011501A0002285F731ABE44957B34FD676B04B13039EA502F5C0B7BE7D448AD4F4EC52F6927448925CCE57D415C5E13CB0BD7F85FE1AA9A041E14B3AAAAC476DE",
-"0011501B0002DAF0EEBB59A484A1F1180A0104B13039EA502F5C0B7BE7D448AD4F4EC52FB4462A1D20918911E4BA3A26865CA98C5FE1AAA3041E0C1E0000CCF224",
-"0011501C00025566EC33FA2DAE80FC38E01E04B13039EA502F5C0B7BE7D448AD4F4EC52FB949A5438A1B59721C72A50F9F7982BA5FE1AABD041E734F55566089D3",
-"0011501D00021EBF15F40BE8AFA0BEA5C46704B13039EA502F5C0B7BE7D448AD4F4EC52F2BC60CFE86715E9BB456D259B189035B5FE1AAD6041E87120002254DE2",
-"0011501E0002DE8F1673C54D493CB2DB78F3F40BE8AFA0BEA5C46704B13039EA502F5C0B94474E7B4EF26151EBBDE0346759C4B15FE1AADD041EA00D5556194486",
-"0011501F0002C18A8DEDF5C8E9085F7B1F7FF40BE8AFA0BEA5C46704B13039EA502F5C0B22D93789719B3360B7655C34C18258395FE1AAE0041F146A0001CDC8DE",
-"001150200002155B6E5719473DC4A462D188F40BE8AFA0BEA5C46704B13039EA502F5C0BD3CEA64D2F309047E4B88487322196FF5FE1AAF1041FA0D900004AB86F",
-"001150210002EFB8BB01A6B6E6469E1AE031F40BE8AFA0BEA5C46704B13039EA502F5C0BE99300398BC1E0F6693A3AA2615071BC5FE1AAF6041FE5D7AAAC3A7FB7",
-"0011502200027B2276E987DDC13E5B7C4990F40BE8AFA0BEA5C46704B13039EA502F5C0B05421D45881F1ECDA07C8FF55A576E7A5FE1AB0F04206FD0AAAC8DEED8",
-"001150230002520056CB363245F93B5216CEF40BE8AFA0BEA5C46704B13039EA502F5C0B84E4B1DAC159C24C22368CA1BFD42C2A5FE1AB3A04208950AAB4C3C6AF",
-"001150240002D841803DB12FC28B387748F5F40BE8AFA0BEA5C46704B13039EA502F5C0BDAFFBDD4C18884787BAEC00886E5AE215FE1AB6C0420410BAAB06CEF18",
-"001150250002ED27BA68CF1599D5653E66E6F40BE8AFA0BEA5C46704B13039EA502F5C0B0DADEF891CAC08F50A2ED9A78750D0775FE1AB7C041FD64755581405C4",
-"0011502600022DDD5579D6079626FEF402A2F40BE8AFA0BEA5C46704B13039EA502F5C0BC520C21673CC79574093A312B00693B85FE1AB9B04202448AAB22A9080",
-"00115027000253D1413CE7F5CF355DA94E96F40BE8AFA0BEA5C46704B13039EA502F5C0B3AC2AD1561ABD65CE1EC2573304E9EC65FE1ABD504201F3E0001EC4FD0",
-"001150280002C11063ED801511D80A3E5F02F40BE8AFA0BEA5C46704B13039EA502F5C0BC652932BE2110391B1A89D52EEFBA1525FE1AC19041F86FCAAAE49C90E",
-"001150290002F90E0DF95A6BB2367B7168ADF40BE8AFA0BEA5C46704B13039EA502F5C0BDE197D8E2807DB97D2EDFCDC7BD1283F5FE1AC23041EC55B5557768012",
-"0011502A0002468083FEF9F6424F8F14BE5BF40BE8AFA0BEA5C46704B13039EA502F5C0BD9A262E87956E82F8C7063E600C4EB205FE1AC38041F2D29AAAB4790A7",
-"0011502B0002BD2426B7F276034E66F5BC2FF40BE8AFA0BEA5C46704B13039EA502F5C0B0FBECDEED7DEB61CC011E590666664385FE1AC49041F5AE6555BF3EB2A",
-"0011502C0002324948A87154E43BC12A78AFF40BE8AFA0BEA5C46704B13039EA502F5C0B197611F0789A204C3F2931A75CB077915FE1AC84041F9F12AAAF5A7250",
-"0011502D0002F5EFB3FFAE8450B6F45D435AF40BE8AFA0BEA5C46704B13039EA502F5C0B57CC942ED563F8FFCE9D05973A3101A45FE1AC91041F07C9555635CFC4",
-"0011502E00021EC7FC0DED8054F8EA00EBD4F40BE8AFA0BEA5C46704B13039EA502F5C0BE6D26B48E918101270547D430221B9085FE1ACCA041F6177AAAB8267D5",
-"0011502F0002DD5B80586B4B496D65CF182DF40BE8AFA0BEA5C46704B13039EA502F5C0BA9C69A20FCC1CFA313B36B072765642C5FE1ACD6041ED422AAADF0489C",
-"0011503000028B897A91EB13416F2C6FE287F40BE8AFA0BEA5C46704B13039EA502F5C0B115E93D825AE65E40D0F572DD12583BE5FE1AD0B041F329A00067E41DA",
-"0011503100023545ED873B1AC1B729A4486AF40BE8AFA0BEA5C46704B13039EA502F5C0BC27A6624B428C2FA6204369882A1B7715FE1AD1C041EBC955556434DCC",
-"00115032000275311075873EED6DF2815B5F873B1AC1B729A4486AF40BE8AFA0BEA5C4673D47B24F50FD80FE98C8D5CA1F3C99A35FE1AD32041EFFE30005649563",
-"0011503300020A513C2913F0649D3CA8666F873B1AC1B729A4486AF40BE8AFA0BEA5C467CE4565593E40CE4DCD0910CEBA15CE995FE1AD68041F27F1AAAB7BEDD6",
-"0011503400023B968C2117424468F632C50E873B1AC1B729A4486AF40BE8AFA0BEA5C4675C6DAFC6AEB62E957089DAA5F2E4EBBE5FE1AD6B041EAC6F5561DFEB33",
-"001150350002971C400D7D83FEDC7A57A479873B1AC1B729A4486AF40BE8AFA0BEA5C467859B9A798108AB18327E73CA4031A1875FE1ADA3041F378055567A8230",
-"00115036000264B84405B62836CD2712CBE3873B1AC1B729A4486AF40BE8AFA0BEA5C467AA0B9E3CF5E81F51BBECBAFE0363266F5FE1ADBC041EB240AAAFE03EDA",
-"0011503700022405B269AC488C33A63D55DB873B1AC1B729A4486AF40BE8AFA0BEA5C467BEF92DF9F594310F05247808FF43658C5FE1AE32041ECE9400007F17CA",
-"0011503800027B1E952376B6AF6E106875B4873B1AC1B729A4486AF40BE8AFA0BEA5C467C22824B8870A4A180C94F3A7D1554AFD5FE1AE4A041D29EC555712B0A4",
-"001150390002D0C9268CCFC2961D503B7D3A873B1AC1B729A4486AF40BE8AFA0BEA5C46716992D515169D2081443351A7C6B6B8E5FE1AE72041D4A91AAB1E961C4",
-"0011503A0002045481511C7D882766029892873B1AC1B729A4486AF40BE8AFA0BEA5C467BCF2594100FC4FE9F49F9FE7D7D133E75FE1AE86041D1D6DAAAB65DEFA",
-"0011503B0002715337F68100B4DE0981FFF9873B1AC1B729A4486AF40BE8AFA0BEA5C46762EE5C26703934E505DA653BF4F89EFE5FE1AE88041D4C165557268454",
-"0011503C00020259E5C1423699FF7B50C969873B1AC1B729A4486AF40BE8AFA0BEA5C4670BB8BCE5C51DF1E2EE68CD5C7BC301BD5FE1AE8E041DCE0FAAAB829BF4",
-"0011503D00025B736FC2B4A715A7E9272030873B1AC1B729A4486AF40BE8AFA0BEA5C467B944AF0A11B63E73D013C4CF475052275FE1AE91041E3ED5555595574E",
-"0011503E00024A427331FFDF5BF6927148E3873B1AC1B729A4486AF40BE8AFA0BEA5C467F7528FEC330E6712BE3AACD3CAD723515FE1AECA041EC5E90000E94F9B",
-"0011503F0002B16A88AAC9681030082B92E7873B1AC1B729A4486AF40BE8AFA0BEA5C4679B2B9EBFECA31B65B3E2F8B5D7CF8CF05FE1AEE7041E3B4F555B105467",
-"001150400002B12F4F9B6571733CC335FFF8873B1AC1B729A4486AF40BE8AFA0BEA5C4675FCE3804700854BFBC7A516C11998EED5FE1AF10041E43065556B1F7CB",
-"001150410002DDC4EA4C1319F99B89370D1C873B1AC1B729A4486AF40BE8AFA0BEA5C467BAC9F0DCF97EA0B3B64E4F826CE295975FE1AF29041E0D1B000066CAC9",
-"00115042000231341F46E70E88CC6BFA5594873B1AC1B729A4486AF40BE8AFA0BEA5C4673F3C88EBB6F5F7AE5BA720F65F2604265FE1AF3B041E263EAAAD22E2B3",
-"001150430002A4E9414EA1BBBEC195C18E78873B1AC1B729A4486AF40BE8AFA0BEA5C467468E68C3C895729493C28D54CC2ECD7B5FE1AF5F041E619700000B2659",
-"001150440002781B1DEE55A8A8FBF27D6B45873B1AC1B729A4486AF40BE8AFA0BEA5C467CC32E77E43678D04E941B96AA6D7F6565FE1AF77041E445E0004C49AC5",
-"001150450002E11828872EFEC24266480FC3873B1AC1B729A4486AF40BE8AFA0BEA5C46788C7ECD49BBAF67E9E6120977F0A3EC85FE1AF84041E60C5AAAAEF1C60",
-"0011504600029EA623479A2359E4C7778B25872EFEC24266480FC3873B1AC1B729A4486AB18FFE6C3F63D76C5C5F12E9380752E95FE1AF8D041EB69B0001832386",
-"001150470002CA4986B8FCEFF96FDE0EE039872EFEC24266480FC3873B1AC1B729A4486ADA9BD8B739E29711DE29637F734F51305FE1AF9F041F22020003CC6222",
-"001150480002496C33CD74C8B0C491133316872EFEC24266480FC3873B1AC1B729A4486AEECB8152424A1D10A34C472BDAF6CB4B5FE1AFC1041F6126AAAC8045E7",
-"0011504900022EF7DCD2306B104E78A0F437872EFEC24266480FC3873B1AC1B729A4486ABFA181AB58F20404562C511934CDABB65FE1AFC6041F4C9300000E264B",
-"0011504A00026E2348FF29EB40FFE6D511D5872EFEC24266480FC3873B1AC1B729A4486AD7FBFBFB190AFB086AD082971BCB42D15FE1AFD6041FD2DB0000F3BECE",
-"0011504B000256FCB57ABE8A2C4ADB641613872EFEC24266480FC3873B1AC1B729A4486AD4999917447101240D6A3939E2D568A35FE1AFE104201C74000040CE95",
-"0011504C0002FC211A4A67BBD19E8153DF3D872EFEC24266480FC3873B1AC1B729A4486AB17F3861065A645DBA709B3F71269CD95FE1AFE304208698AAADFB9D1D",
-"0011504D0002E322BC9B64FF5EAB7BA6270F872EFEC24266480FC3873B1AC1B729A4486AACACE2E1D6F1BAE3079E06A6BB3AEF415FE1B0180421283E55606A964B",
-"0011504E0002F7D2C4841B44269A6EDFC0D2872EFEC24266480FC3873B1AC1B729A4486AD63C346E49253A026D80144654D8D0F55FE1B04B0420A40D5555721A2A",
-"0011504F0002CB9933DE5972657BD6A8A565872EFEC24266480FC3873B1AC1B729A4486A3D5EB035E2036898F67DF7B01EBD328C5FE1B04C042030840001A4AD03",
-"0011505000023546CE6727C86CC90921B090872EFEC24266480FC3873B1AC1B729A4486A86A880DA9CA830E037E519AF91E6E53B5FE1B0520420D6DBAAAB5A089C",
-"001150510002C55779E20C6E44762FBD0614872EFEC24266480FC3873B1AC1B729A4486A16581066622D4D9AE27D7459AF68DD6C5FE1B0540421630A0001E6ACEE",
-"001150520002B032E74F7D9A7F816298780A872EFEC24266480FC3873B1AC1B729A4486A1BC34EBE8D7292F2E22FFC3BA1DE105C5FE1B05A04220D6355556A1E00",
-"00115053000266453F994DA51BD577F7102C872EFEC24266480FC3873B1AC1B729A4486ACA112C557CBE560F78D105B4E8E97C5E5FE1B06B0422A344AAAC4146D5",
-"0011505400025AF2AA631D3E3A6521B00434872EFEC24266480FC3873B1AC1B729A4486ABA3B6009F8D9338C6D30EEA7A6A27AE25FE1B0880422F6910001513D57",
-"001150550002E846D6AF39A376B6478F6389872EFEC24266480FC3873B1AC1B729A4486A7B08B49B6E4934E1BE7E28DA313C5B905FE1B08D0422FDDE55574A079D",
-"001150560002B7ADC91840821A2ACC21B90E872EFEC24266480FC3873B1AC1B729A4486A939E842936D7525E7B5CD711433C4C1A5FE1B0A70423A643555701FF52",
-"0011505700027C9439506B691D0CC769B90B872EFEC24266480FC3873B1AC1B729A4486AB7E26E4D4B48BFA772082070B871CA3F5FE1B0AC0423C241555AA27B89",
-"0011505800025A642B3C029AB737C0E4E48D872EFEC24266480FC3873B1AC1B729A4486A853BCA4DFE879DB9E274BB30248847A05FE1B0BB042471E30000D7F1DA",
-"001150590002B0682EDB9BCE16BFC8CF25EA872EFEC24266480FC3873B1AC1B729A4486ABBC721B57B1853683D03FE74EF98E0215FE1B0CC0424DE2E000255FD82",
-"0011505A0002BA57EF453EEBBDA249108932DB9BCE16BFC8CF25EA872EFEC24266480FC372D8BCA0DA062F4DDD846CC1DB1187CF5FE1B0E804253CEC0006F5C3CD",
-"0011505B0002584EEAC932F63E82E621C8B0DB9BCE16BFC8CF25EA872EFEC24266480FC36A2F20F3E1987D9D54A6304F2A44438C5FE1B0FC04254D1EAAB2A1CCD9",
-"0011505C0002A8124D4E93B41AED2F8D5815DB9BCE16BFC8CF25EA872EFEC24266480FC3B864E676D9C99A87AB4D22A3D24F644C5FE1B12804258F5B00017667DC",
-"0011505D0002D31CD94D1C72C632C1790C30DB9BCE16BFC8CF25EA872EFEC24266480FC3830FDD8D010A60009E530C3D02EED8E15FE1B12D0425295F00067516DE",
-"0011505E0002798BE5E5427FB9ACAFF6299CDB9BCE16BFC8CF25EA872EFEC24266480FC325D7472F7EE9AF8AFEBC73EA9CB7350D5FE1B1540425E90EAAAC475F2B",
-"0011505F0002019E25ACC8C8C54402C0BAE4DB9BCE16BFC8CF25EA872EFEC24266480FC32A68AF4453F52DA4D733A3065D3E92E05FE1B1780425A56E555A286FEC",
-"001150600002B77AC9331335794A9C03C83DDB9BCE16BFC8CF25EA872EFEC24266480FC363873FFA5CF054FB26BD6C16106E037A5FE1B19C04257D1C555ABF42DC",
-"001150610002F553C059B9B0CAA4C6814F5DDB9BCE16BFC8CF25EA872EFEC24266480FC395871ABA6D0D60EA5EE782038920DD205FE1B1C304255450AAAF760D1B",
-"001150620002F67DDBE890DF8CC6BCCA7E11DB9BCE16BFC8CF25EA872EFEC24266480FC3D4CDB8B9AD1762B812A5EE7CA25B96885FE1B1D00425127B5557D4D3F1",
-"00115063000222F9A001F99BFDBE374F0813DB9BCE16BFC8CF25EA872EFEC24266480FC3C507F68C07DC6E979E52828213BC08CA5FE1B1D804259125555693993D",
-"00115064000206D695794E2D0D03A6DC30E7DB9BCE16BFC8CF25EA872EFEC24266480FC32CD3072FC550A282D2A2FBCFAA837A865FE1B1DC04263A1EAAAD400099",
-"0011506500025FAE50F7EFF0F362121F9ACCDB9BCE16BFC8CF25EA872EFEC24266480FC350137A4B33BE92069257679E441379405FE1B1E30427068D5555ABF41A",
-"001150660002006DF1602D23CF24063BE705DB9BCE16BFC8CF25EA872EFEC24266480FC3CB0E30A572B1B11AEB65511A5D9C14BC5FE1B1EC0427C218AAAAEFE887",
-"0011506700029C3AC40314B41B8ECCE68DEEDB9BCE16BFC8CF25EA872EFEC24266480FC3DA8CFEA3BCFE3CC11124F31E34DE5C265FE1B204042876440002B2D938",
-"0011506800025E5C6FAC89E2EB103C39B093DB9BCE16BFC8CF25EA872EFEC24266480FC3507328DF742C733887A345E0A2FEB7B25FE1B2130428AC765556DC4D62",
-"0011506900021D76C8A47E8A721BB2C1F570DB9BCE16BFC8CF25EA872EFEC24266480FC3FFF9F4C69068F4828D29AEB8160DED3E5FE1B2200429314600025C1463",
-"0011506A00023EE7525C89F589EF0220ADE7DB9BCE16BFC8CF25EA872EFEC24266480FC38DD2E3D3767DB10425F363F7ECE65A195FE1B2270429C81355562E8F08",
-"0011506B00023D8D66B21849C2E4155B3F95DB9BCE16BFC8CF25EA872EFEC24266480FC32B84D3991A37D3E6D984BDAD038DC6295FE1B239042A9917AAAC84F946",
-"0011506C0002449E74E26743342A932D8576DB9BCE16BFC8CF25EA872EFEC24266480FC3C6FBE42C1459F220C5F871AEA41726A25FE1B2B0042B04FA55573BBDCA",
-"0011506D0002C6F4C2814539E3C46549859DDB9BCE16BFC8CF25EA872EFEC24266480FC3F37EFD10B7E683358BCC3518C89FC18D5FE1B2CF0427E9640007047B5F",
-"0011506E0002F3D029E9CE4D7DE83B877A2B814539E3C46549859DDB9BCE16BFC8CF25EAA47660B62BD2D8A27CAAEC19B30530105FE1B3170427EDD500044A17EF",
-"0011506F00028763061347CAB557D511A88C814539E3C46549859DDB9BCE16BFC8CF25EACEAF288BBED86E6AAD00CCE5E4CBD3EC5FE1B3A50426A153555A70F73E",
-"0011507000021660641981E8A3B4F64CA30D814539E3C46549859DDB9BCE16BFC8CF25EA03B640263F26A10489352CA6FB34B32F5FE1B421042386305556F4B835",
-"001150710002985B5ED0516C58B9614D94A2814539E3C46549859DDB9BCE16BFC8CF25EA7E33403DA4160A1C56D978C1B33FDBF05FE1B4260421530355561DF78C",
-"001150720002308D04837C33AD451FBD4085814539E3C46549859DDB9BCE16BFC8CF25EAE145BC052BC02561A79C92D3653EAAF85FE1B44C0421EC16555C45E7E1",
-"001150730002FC981068D7DFD95AE49E7813814539E3C46549859DDB9BCE16BFC8CF25EA44E88E005B02ECF6318D0B8F3C0ED4E95FE1B47F0421BC5AAAAD986E60",
-"001150740002E9B76A53FCA7FDA8394C8C2C814539E3C46549859DDB9BCE16BFC8CF25EA7A58CC10FB100F308FE85EAA665BE7E05FE1B49E04213D33AAAB62DE54",
-"0011507500024091B62B0DA5B0F5924EF250814539E3C46549859DDB9BCE16BFC8CF25EAD867B2C23E117223C0AACF66F2F1AE125FE1B4A1042138D2AAB105F78F",
-"001150760002E613E591D93AE00CF62C1DF2814539E3C46549859DDB9BCE16BFC8CF25EA21E6B25C4BFEE2CE04D9B20F80BDA0965FE1B4B30421D5F6AAACDAA6BE",
-"001150770002ECC85DF126B294BFAC51F44E814539E3C46549859DDB9BCE16BFC8CF25EA5DCD71A8AFD7F473B97F54F0848F59D65FE1B4BD04221B9DAAB509F8F5",
-"001150780002086DE21BE9750D4FDBAD097E814539E3C46549859DDB9BCE16BFC8CF25EADC8071669843F08DCD385D9A12F759685FE1B4EF042294DAAAAD35DE93",
-"0011507900023864EBEEA8C86C916F89A868814539E3C46549859DDB9BCE16BFC8CF25EAC727C13EFAEF0A2B6B73C2E33B2C6B405FE1B52F04221AE8555DCBAF2B",
-"0011507A0002C00ACC5068D980AD95787EE4814539E3C46549859DDB9BCE16BFC8CF25EAE0A39434369134D57CE3950AE561EA745FE1B5D10421567C555E4340BB",
-"0011507B0002E596E86B86B33CF1C26D8383814539E3C46549859DDB9BCE16BFC8CF25EA388C7FD0C45FE01E2C63F4A229BB747B5FE1B665041EA9C6AAAAF2C3F4",
-"0011507C0002B8249F38EDE63BD905BB21C4814539E3C46549859DDB9BCE16BFC8CF25EA536151F92ECAD43A479700A1EE982A2E5FE1B67B041CA0080001FA578B",
-"0011507D000260D20B28528E74EB72A584E7814539E3C46549859DDB9BCE16BFC8CF25EA1D563735AF919D94BEB2ECF4EA1374165FE1B6A2041CC7B7AAAF60AAFD",
-"0011507E0002FC6299322AF176BC25C66923814539E3C46549859DDB9BCE16BFC8CF25EAD6F05AC80A0170D7D0E5A43C355A6F0E5FE1B6AF041CA39100003B48D9",
-"0011507F0002C53A1B6DBF43A1FD971A5047814539E3C46549859DDB9BCE16BFC8CF25EA8349CB70A733E8EE38D4A8317AF2D9C55FE1B6B1041CED20555CD9243D",
-"001150800002B6F83162A50F1962147C8C09814539E3C46549859DDB9BCE16BFC8CF25EAADA84EF61A672F38935ECB1996EB36E85FE1B6ED041D685DAAAACAEE41",
-"001150810002AD3D96D426DCD63068436A3A814539E3C46549859DDB9BCE16BFC8CF25EA67CDE28B044938D81AE9FB5AE1B429235FE1B704041CE6D5AAAFDF7E5F",
-"0011508200025AB193507215911B07B8391CD426DCD63068436A3A814539E3C46549859D0FE896C31A4D3E17358107C69F22D1605FE1B736041D07B2000104B368",
-"0011508300029EA993ABAE665B6DD6F634B1D426DCD63068436A3A814539E3C46549859DFFF37A589385EB1719FE6212CC7DB16A5FE1B74F041CB4D65557C61EEB",
-"0011508400020F1F99B86258F413A683A9B9D426DCD63068436A3A814539E3C46549859D8EC6407505CC50C43A9356F3C25DD4465FE1B781041CCD6855555C12A8",
-"001150850002744CE7CAF1DDD68DACB044D7D426DCD63068436A3A814539E3C46549859DF00F8C54C43FBB161E348B5B9C6099165FE1B782041C7B605557126702",
-"00115086000250F8F6DC072C328C9C940D5CD426DCD63068436A3A814539E3C46549859D690B3AD5C04E1255699232F692C0D93C5FE1B787041CF92DAAB355AF4C",
-"001150870002A090115806AF360DEA4A52CAD426DCD63068436A3A814539E3C46549859DB9D488A1EDE8A738DCED01E46F98E6D95FE1B7E1041D66D70006B1BF5F",
-"001150880002DA9409CCACA8422B87D4B582D426DCD63068436A3A814539E3C46549859DC7C0BCFE0FEBF1573E4936C37D9F4E3D5FE1B809041C65C05557C0F85C",
-"001150890002549455278893B6B05D044042D426DCD63068436A3A814539E3C46549859DBC1FC972A1D8537852594AE0948690CF5FE1B810041C3F69AAACE185B3",
-"0011508A000232774D0005C9F6290510A717D426DCD63068436A3A814539E3C46549859DC4F80519D5DC544685980A1E1D9AB2FC5FE1B817041CA18C5556CB3160",
-"0011508B000256CDA6A7AC2966B8575C721ED426DCD63068436A3A814539E3C46549859DECCE8B3DFA02072B242E4ABAE39BA2735FE1B826041D04845559393A2B",
-"0011508C0002CE95632245D6CEEBE35E2E1CD426DCD63068436A3A814539E3C46549859DA92747DB4F1BC478BECE8A99B74E6DC45FE1B848041D45975557860755",
-"0011508D0002CE44A840C6D134098CA21081D426DCD63068436A3A814539E3C46549859D0980F6D9F49F9B4D54A26F7EB3BC85CA5FE1B84F041D335D0002644C0C",
-"0011508E0002DAB3E4B537457E8800CCB22CD426DCD63068436A3A814539E3C46549859D040183E771258013F05324A0720A2F965FE1B89F041D9CB900015463AF",
-"0011508F00025E49443FD41842D1FA73D0ADD426DCD63068436A3A814539E3C46549859D6861BC1F951CCEA8541FB3211A653BF85FE1B8B8041CC21A5558E8E685",
-"00115090000237294043F7A506A2964E1824D426DCD63068436A3A814539E3C46549859D1B85565843E42F628D5DA66C35CB25905FE1B904041CDBBA000762ABA6",
-"0011509100023DEC1141E13739BC10DEC20AD426DCD63068436A3A814539E3C46549859DE2AFD43F0751AD9A6B02A173C15E1B815FE1B919041C1B245555BE5239",
-"00115092000278289BD56E14AC6969383B55D426DCD63068436A3A814539E3C46549859D9B303255E2E84AD708C0E5D6783675DB5FE1B92F041C44500006BA849E",
-"001150930002DED50453EAFA7F709BF4A984D426DCD63068436A3A814539E3C46549859DC32FB4EFDF54AD16560271EBEAA000035FE1B958041C65DBAAACCDC4FD",
-"00115094000229803BCC8B0164CD54889D32D426DCD63068436A3A814539E3C46549859D81C32A5EDE1962A1CFF71C18C9D7D6C15FE1B95F041C3A8355593888B5",
-"001150950002C814A8CE6367C94CD1EB2467D426DCD63068436A3A814539E3C46549859DF6477038133DE5EFE45DFF8824A3E4835FE1B96A041C9C190004298DA1",
-"001150960002382B8E646CE5BD92CFCE9559CE6367C94CD1EB2467D426DCD63068436A3A9AE15E4E99FA847954BF81ACF33E58AC5FE1B97F041CEF56555CAD46E0",
-"0011509700021BE430325A7281FEE901835CCE6367C94CD1EB2467D426DCD63068436A3AD680BAE14206FFB0DF9208DD99D6AFEF5FE1B993041D182F00046B8761",
-"00115098000226D4C71F7B1876FB430120AECE6367C94CD1EB2467D426DCD63068436A3A8B76CE948E655F5F835CC9F1BF76F8EB5FE1B9A1041D44E7AAAB69FFD2",
-"001150990002BDFC9FBD3C0A03D3E5297BB8CE6367C94CD1EB2467D426DCD63068436A3AE3DCCDB696878D92A71FE514D2D07BE45FE1B9A4041D8FA555563381D7",
-"0011509A0002FD142CB2512CAE814DA2D7E8CE6367C94CD1EB2467D426DCD63068436A3AFEE080643F548B76DFB9103416A30AE75FE1B9BD041E0C74555621711A",
-"0011509B0002F611681A9FF2449CA0C50A05CE6367C94CD1EB2467D426DCD63068436A3AA7730AE7BEE61EB16E94956EE3E47FB55FE1B9C0041E25090005F3FD4B",
-"0011509C0002F03AEBEA5A78F37A5B332FE0CE6367C94CD1EB2467D426DCD63068436A3A4251B6556A1A19572F8CD6BDC06994E55FE1B9E6041EA4485558E7B2B4",
-"0011509D00027F86694D0B135E6E13057A1CCE6367C94CD1EB2467D426DCD63068436A3A2441A4BB517ED6A022070B493722F6785FE1B9F0041E7DFA5556FBA2E2",
-"0011509E00029653036DA540C648529EF2E1CE6367C94CD1EB2467D426DCD63068436A3A1726677E107B59D3DFC78FE40C18D1105FE1BA12041EE1550005CE9FE8",
-"0011509F0002A43923DAF3181E790574D1B0CE6367C94CD1EB2467D426DCD63068436A3A06D763A69F700F070FEE43A4CEBDDB425FE1BA21041ECE7EAAAB07965B",
-"001150A00002840086EE0B68A210D1BBF394CE6367C94CD1EB2467D426DCD63068436A3A9C5792143E592A25B995B72F89E0C2FB5FE1BA23041F1C440009FE0BCF",
-"001150A10002A0B42B1C9D92C6BC698941A7CE6367C94CD1EB2467D426DCD63068436A3A0F7565BADC078EDB68BE60E2C9AA6CFA5FE1BA52041FADC0555D2A5CF0",
-"001150A200021FBCB195F55A2DCB88075D8DCE6367C94CD1EB2467D426DCD63068436A3A401717CEC7A2269D78B505958AB678705FE1BA68041F57CFAAAAEB5F73",
-"001150A3000233A35AEE7C4813B4B24EF990CE6367C94CD1EB2467D426DCD63068436A3A5377D24F587C2BCB1F31CEC2E57CF4BA5FE1BA6A041F82230000E52792",
-"001150A4000279428BEA5EBF2F9EADF9C69FCE6367C94CD1EB2467D426DCD63068436A3A1E42100DF9123C3D38D56B2035BD60F65FE1BA800420168C5559555E80",
-"001150A5000291EF4EAF26437F4CCA1713AFCE6367C94CD1EB2467D426DCD63068436A3A941F063CBF328A65BA5BF19A95B886B95FE1BAA10420413100091447DA",
-"001150A6000200266425F19DEDA3A1763AE1CE6367C94CD1EB2467D426DCD63068436A3A170E09D82F8CF2B16BC09B8DA964E7F75FE1BAD00420328C5559D63C41",
-"001150A700021A9EB13E8F18A9ACBEBF9B95CE6367C94CD1EB2467D426DCD63068436A3A41C29063864F4019849E52C6EE523F525FE1BADD041FDAAD00001C7E5D",
-"001150A8000201B36A70C620648D265675C6CE6367C94CD1EB2467D426DCD63068436A3A07B8695A02F1535432872A14854654175FE1BAE60420376A5556BA1C99",
-"001150A900029AD774BA9536175890E70788CE6367C94CD1EB2467D426DCD63068436A3A7B7C2C0CDFA3505EAC828B9CE8AF10185FE1BAEA0420AB05556018995D",
-"001150AA0002A6F43FFE3DA30909E847E9FABA9536175890E70788CE6367C94CD1EB246778775BDA0890F86D6FBE2D6F4008D6305FE1BBA704213EB500030B5154",
-"001150AB0002475E644A6BC8824F49C36148BA9536175890E70788CE6367C94CD1EB2467563578A7B638094E83AB24B2DBEFBFAE5FE1BBB0041E354EAAAC95A14D",
-"001150AC0002DEC09FA8994F9A085F06C6BDBA9536175890E70788CE6367C94CD1EB246724F28C5BCD5FF0F5828687AACB9C40615FE1BBB6041EA3AD0003E3B879",
-"001150AD000228D35EACD1975EB00BB7AB21BA9536175890E70788CE6367C94CD1EB2467100923F1C00F89C96A7EF7D6B9AE9A035FE1BBF9041F1AD3000160105E",
-"001150AE0002F1111B4844CA9A00F1291F6ABA9536175890E70788CE6367C94CD1EB2467EEAAC30136F3BBBAA70DBD80B09F82C15FE1BBFE041E6825AAB10979E7",
-"001150AF00026F4213FF911CCE851624EBF2BA9536175890E70788CE6367C94CD1EB2467298700078241BDC9B609689608B89B095FE1BC28041EE624555D2B091E",
-"001150B00002A52D1EA04207C74F83F0D4C0BA9536175890E70788CE6367C94CD1EB24678387FE2E3F431F3CF5D7E1FEA43064395FE1BC3E041EAD3D555734A4EA",
-"001150B100027989AB373CB30469B6B292E4BA9536175890E70788CE6367C94CD1EB2467E245FD02D916FED2424920B67C4C7B485FE1BC44041ED88055596ED43A",
-"001150B2000244EBD419748DAAD6440A0C65BA9536175890E70788CE6367C94CD1EB2467F96C4C31169711EAD4D780BC9C19121C5FE1BC65041F511EAAAD6A3214",
-"001150B30002542672792ABF5C1217F1ED21BA9536175890E70788CE6367C94CD1EB2467A34C19CB751F36BB999985DEE9CD299C5FE1BC8B041F41E6555BFCA3E2",
-"001150B400028B66A098BAE5B7730E5811AABA9536175890E70788CE6367C94CD1EB24676230497561F5775C2F566949134B58C55FE1BCB7041F1D70555CA53A34",
-"001150B50002C4C8433550FEF95666F0A599BA9536175890E70788CE6367C94CD1EB2467E7170EE2F4C01FBAAB45B9099F95BC3A5FE1BCEF041EDB6EAAAB5D6F8A",
-"001150B600024A249D7A44D013E04C0CCBAFBA9536175890E70788CE6367C94CD1EB2467D53E274346301A8D2A32350653DD09E05FE1BCF2041E60EF555769015F",
-"001150B7000243432A2E0CB128568F3881FCBA9536175890E70788CE6367C94CD1EB24672E507A888FE34C904F2F93F8F43B8D355FE1BCF8041EE8CE5556760A0B",
-"001150B800021E0320A7A533C06701925332BA9536175890E70788CE6367C94CD1EB2467FD46FA0C7C192E7A3F63B41E401CDA815FE1BCFC041F6305AAB0A16779",
-"001150B90002986894F1128DD0949749FC2EBA9536175890E70788CE6367C94CD1EB2467E7217529AF40314E5E5EE66214C851925FE1BD45041FEB4B00004A7F69",
-"001150BA00029D369D06643C93F5AB3DCA20BA9536175890E70788CE6367C94CD1EB2467E9FD8894795514783B984F9F9B33333B5FE1BD5A041F0ED00005111890",
-"001150BB0002E646501F889F992E5086318CBA9536175890E70788CE6367C94CD1EB24672D8A0EFF89A26080307AD014A9C9E2735FE1BD95041F400A00028290AB",
-"001150BC0002CB51F66B0A1EE3F9AD859A9ABA9536175890E70788CE6367C94CD1EB2467D83E6425D95FB842FC9B14D489525EA35FE1BD9C041EB0B9AAAD7E480E",
-"001150BD0002173DBAEE83785E5CB9398325BA9536175890E70788CE6367C94CD1EB2467D76F626533CEBFF0B935653BF7FA5C3E5FE1BDA5041F26C2AAAC348DDC",
-"001150BE0002B4FB1D6CC3769295A19AC5EDEE83785E5CB9398325BA9536175890E707887AC84AB464EF7D146600515B600163BF5FE1BDBF041F93515557080E6C",
-"001150BF0002A8D50A4D9051A56ACA6DEEE7EE83785E5CB9398325BA9536175890E707884A4BC0D92FBCA1D0E1196313DC9CA7E25FE1BDD2041FA7F5AAAED59E8B",
-"001150C0000261D0BD491F1BAF9EFAAD9240EE83785E5CB9398325BA9536175890E70788291DD0F229502B5FCC476E001949BB965FE1BDE2041FE353000115F99A",
-"001150C100028703028E06BA62094244F62EEE83785E5CB9398325BA9536175890E70788DB0C49476700FC37AAA4A1097EAB41985FE1BDE604202E510003BA02BE",
-"001150C2000208B83F35B3387984F019B570EE83785E5CB9398325BA9536175890E707881D2D12EDFE75CCC43833E8B3EC2BCE545FE1BE050420C0B7555F2F4A73",
-"001150C300022A33A6E0B471AC4556B8E4F5EE83785E5CB9398325BA9536175890E70788C9C36183F4E3231D750E6F7C0DCCA0EE5FE1BE9F0420B9B4000214E8EB",
-"001150C400022D10F06F0ED1B81C7AD66445EE83785E5CB9398325BA9536175890E7078836A4C9B934F3D58FFF3A4D5F472ED10B5FE1BEA5041E30AA5557275FAA",
-"001150C50002FEC1755ACC85EB262076F284EE83785E5CB9398325BA9536175890E7078877AD62D0436833B1AC4140D0AAB34D535FE1BEAB041EAC68555559985E",
-"001150C600024B6D432BEEE0C4D804722485EE83785E5CB9398325BA9536175890E7078826EEB907F773DF29A559884F2016D6AB5FE1BEAC041F24E055565BD5EF",
-"001150C70002D37F1A854A2FA0E68FC9031FEE83785E5CB9398325BA9536175890E707889B7220EF829F8957ADEFADA584DD45FC5FE1BEC3041FBDF5555778A051",
-"001150C80002D9CB827CA74ED124E166C19CEE83785E5CB9398325BA9536175890E707881CD7382A23C32F54EC1822A757547C335FE1BEDF041FE3E70002AAE6B0",
-"001150C90002DE3E430BF92D88D131B13DC8EE83785E5CB9398325BA9536175890E707880D2C01663250C6FAB226238383A7C1FD5FE1BEE7041FEFDA5557741047",
-"001150CA0002B4A2E30B6D1009F0388164C2EE83785E5CB9398325BA9536175890E70788CA6E6E6AB8DFD8EAB659EB2AC671DDE05FE1BEFA04206AA300027A9FF6",
-"001150CB00022081896574D8431CAB272AC2EE83785E5CB9398325BA9536175890E7078861F59AD4DDEE55C28E7B4186938FA0805FE1BF320420A842AAAD4EAD2C",
-"001150CC00027A7524F238057259A3CEAB00EE83785E5CB9398325BA9536175890E70788334EFCE62FF50A07E97A1FCE65A5A77D5FE1BF3A0420139C0000DB732C",
-"001150CD0002E152FA925E57C0A3B0B2A855EE83785E5CB9398325BA9536175890E7078866DC192BE752A2D89B44FD68A348FFA85FE1BF3D0420902BAAAB7BE0F7",
-"001150CE000220E2F9F6EF087363014E87F5EE83785E5CB9398325BA9536175890E70788FCF8CC72F94CE31661DA57D183E11BDE5FE1BF4C04212BAD555E06E729",
-"001150CF000218AFEE759B56C0875213C2D6EE83785E5CB9398325BA9536175890E70788BB105FA45B547DB65D5CC7C22375A8945FE1BF7A04218395AAB00F12B0",
-"001150D0000294106AC26EF37323E579B98FEE83785E5CB9398325BA9536175890E70788AE4EE22B1440DBAFEF1202AAF5257AE15FE1BF9F04211F60000C780FC5",
-"001150D100024C81E8FC55EAEBBC49AC5C96EE83785E5CB9398325BA9536175890E7078848C59285DB905880CA260750DAA7F8305FE1BFE20420ED6DAAAC0C9C31",
-"001150D2000249F42DB3F072DB37FA585CAFFC55EAEBBC49AC5C96EE83785E5CB9398325157E5E99F2532F8CE25194E9DC39D8F25FE1C002042016845559D6C225",
-"001150D30002D4473157C379D31CB92CBCB5FC55EAEBBC49AC5C96EE83785E5CB9398325FC6E886E99B1C961B2B3DCE0A5E9DF255FE1C00F0420096DAAACBD2D82",
-"001150D40002E250D640F70B826E2C756EC8FC55EAEBBC49AC5C96EE83785E5CB939832574213AB48C03400E67522FB4F1CDD9FA5FE1C01F042063A95555D60344",
-"001150D50002512A6DB4A4C1376639826533FC55EAEBBC49AC5C96EE83785E5CB939832548D9CBF67F33F74C8C7E2EE21B6FF5DE5FE1C0210420B050AAADB79A3B",
-"001150D60002C52A3A81C9CCF7016C8DC4E1FC55EAEBBC49AC5C96EE83785E5CB9398325B48DFFFF6D039166A3D7DE17D686DF2F5FE1C04004215B600003DEE2BB",
-"001150D700028ED73D1EAFED9BC564D01AD7FC55EAEBBC49AC5C96EE83785E5CB9398325169B63603D129079EA794FD7C4607AED5FE1C04C042154E65556E530FE",
-"001150D800025BDEE68E2DDEBE1CAC2FF3A7FC55EAEBBC49AC5C96EE83785E5CB939832524452CF864D4E36E13EC50F7986C66665FE1C0510421C58F5556FE6244",
-"001150D90002B012A5DCBB645F670539E603FC55EAEBBC49AC5C96EE83785E5CB9398325E5DC53144591E3B4209D4E5FE23F289F5FE1C08F042266DD0004521133",
-"001150DA000276A65EC1A186C68154B4D7A1FC55EAEBBC49AC5C96EE83785E5CB93983255108F6070C8B70C5A6DF7F707B00E6195FE1C09B04219D0755558C0CB3",
-"001150DB000297FEAA70E5EBC235DA709CAAFC55EAEBBC49AC5C96EE83785E5CB9398325CE5C7D86E06F06432A840ECF7F626E095FE1C0A60422140DAAAB60BDC2",
-"001150DC0002C17F30B54829ED89A358C5CCFC55EAEBBC49AC5C96EE83785E5CB93983257D9CE7514310143C9C46C9D3E82EA8EC5FE1C0A904229208AAAC19F96A",
-"001150DD000267F26334E6A229C3A6E0C754FC55EAEBBC49AC5C96EE83785E5CB9398325EBBF8C1AC1A870082823DA85FB4562545FE1C0C4042347ABAAAAEEB1FB",
-"001150DE00020685C3BC26506A2255F7C4A7FC55EAEBBC49AC5C96EE83785E5CB9398325073BBFA0D3FF09D507AC307C8E5059B35FE1C0C604235AD8555964CB11",
-"001150DF00024499FF7EF20B0969E13031D5FC55EAEBBC49AC5C96EE83785E5CB9398325A9B64B0D90F1482BB2A411A9BE5340BC5FE1C0D10424194900028CF570",
-"001150E000025A21EB5D566F3BA51B60CA13FC55EAEBBC49AC5C96EE83785E5CB93983254DA01A8733336C1D51C2FDCDE13C4DD85FE1C10B04249A32AAAAE8BB57",
-"001150E1000275C9C81DAA44A844AAE6C6A9FC55EAEBBC49AC5C96EE83785E5CB9398325552CE34B95B3C1AF20BF498A0764862C5FE1C10C0423CEA7AAAB187BF9",
-"001150E20002815009F51381A6917EB9C33CFC55EAEBBC49AC5C96EE83785E5CB93983255772E711689313C502292838F783882A5FE1C10E0424A00B5557FBB2D2",
-"001150E3000244AEB78876E3F6D9EF8C6BFDFC55EAEBBC49AC5C96EE83785E5CB9398325592A258D3A4631CB27CC50BF73419A1C5FE1C11E04256F7755587AAE34",
-"001150E400020E8976D233D1479520323A7DFC55EAEBBC49AC5C96EE83785E5CB9398325B341654B3BE857FBC739D1F97778D6B65FE1C13E0425DA480004D12764",
-"001150E500026926B50A417F3FACFEACF619FC55EAEBBC49AC5C96EE83785E5CB9398325283B7D65283CB0C975A8F4694A5366565FE1C14B0425C6A7000C697BF1",
-"001150E600027B90A43362C9596FF294E9CF0A417F3FACFEACF619FC55EAEBBC49AC5C96FC254A1EE39B2AF75A757369E623352E5FE1C18004264B9700008D1FC9",
-"001150E700025CBC24A930C2AC0CF50C893C0A417F3FACFEACF619FC55EAEBBC49AC5C96A0265F3E8D17A5E342661765491A50315FE1C1CC04259438555A5E84E8",
-"001150E80002BE1C57260D80941CDB2EC0520A417F3FACFEACF619FC55EAEBBC49AC5C96BFFB049FCA81AA7689F8FB0816104CE15FE1C1FF0424432E55591C633F",
-"001150E900028D56E2E07E5479E8276487E30A417F3FACFEACF619FC55EAEBBC49AC5C962F8C755734B8FE6152E77D5826673DC05FE1C2210423B25C0005CC98DF",
-"001150EA0002056AA05452F9C7A5837D7D1C0A417F3FACFEACF619FC55EAEBBC49AC5C961C11BDDAF2429626B4EE8A5C44D620615FE1C2310423995E5556FBA160",
-"001150EB0002A7D789E6D0CE8E009E9FBB010A417F3FACFEACF619FC55EAEBBC49AC5C96A7BF23AEF4C10EF6AB3047AB11E618355FE1C24F0423FA9AAAAAFE2DA3",
-"001150EC0002A297045EF2CAC5EAA62027790A417F3FACFEACF619FC55EAEBBC49AC5C96E160B346507E4389743AE962047A99BF5FE1C2670423F4FA0001F4F7EA",
-"001150ED000272D5B4583614746CFCF8C0A10A417F3FACFEACF619FC55EAEBBC49AC5C96C9DFA625FB6F4BECB0C8FF449CE4CD295FE1C26E04241C34AAAAE3D8BD",
-"001150EE000297C7D90AD7FD6055920C46570A417F3FACFEACF619FC55EAEBBC49AC5C9698F3F02C6226831379A47681C533328B5FE1C2700424BD930000C94E8D",
-"001150EF000221D6B7CE591303CBDBCF60F80A417F3FACFEACF619FC55EAEBBC49AC5C96C11E0744F9571D575F709564BD9BF0895FE1C273042588600000C2C73F",
-"001150F0000293A957E82898BC177633A1D70A417F3FACFEACF619FC55EAEBBC49AC5C96779F8159150DD565E90BE0E862E5D19D5FE1C2810426530EAAAC2645D9",
-"001150F10002659247F39A677C52F0D89D080A417F3FACFEACF619FC55EAEBBC49AC5C96274BA264768436DB77BFA6592A55E56F5FE1C29B0426CC6CAAACC34B12",
-"001150F20002A8E17C9E99AA1E188383E2080A417F3FACFEACF619FC55EAEBBC49AC5C967F197D66B6C50252BA76E9161DF88F645FE1C2DA0426EAE65557DC1081",
-"001150F300023783F860BDFCFDDE0FEC3F1A0A417F3FACFEACF619FC55EAEBBC49AC5C96E07B8CE28CEE79DD2CF671EE879CC9CC5FE1C2E10425E6205555AF0D56",
-"001150F40002DE84FFB865EDEE7BE7E3260A0A417F3FACFEACF619FC55EAEBBC49AC5C96ED9ED0E2A77D8F7CDD76DAD64905D5BA5FE1C36D042697650006EC1202",
-"001150F500026038D8A0B7DA6229141292790A417F3FACFEACF619FC55EAEBBC49AC5C96DC07C4DAF25C7E5BF59578C283A693765FE1C38004237E21AAAE11A8D7",
-"001150F6000253735C8E1F651B1A368104530A417F3FACFEACF619FC55EAEBBC49AC5C965CC4B55E2919709769A66EEBA6AD10515FE1C38E0423CE06AAAEFBC2F8",
-"001150F700028CEAF18454AE949DCA7501EF0A417F3FACFEACF619FC55EAEBBC49AC5C96F9667B1590A961094CE016107B93EF0A5FE1C3A204243740AAAB2DE9B7",
-"001150F80002D3E23319D9B64C197657EA710A417F3FACFEACF619FC55EAEBBC49AC5C9612305568889C924D6F7E123C02BB664B5FE1C3A404247796000056E549",
-"001150F90002DF5EE017FE8950D00B9E8A880A417F3FACFEACF619FC55EAEBBC49AC5C96B3C77512947A3790E4EB1B14F765D7D35FE1C3A604253A2F5558A7E457",
-"001150FA00026C15C75923C38F0ACE0927D517FE8950D00B9E8A880A417F3FACFEACF61937341BEE5D6CE262FD0961B7F76369DC5FE1C3E3042602FF0009131D0D",
-"001150FB0002B4E33419441D43833F35860117FE8950D00B9E8A880A417F3FACFEACF6191CDB8E9D2A2372C8883C6A333A0E2D485FE1C41004251E695555E09B9A",
-"001150FC00020435779C6A0CF9E3F6F5E0D717FE8950D00B9E8A880A417F3FACFEACF61943874CA6555271524A0E5FD4E455F7DF5FE1C4130424B72CAAB3505329",
-"001150FD0002EF44EBE5662A327B1B192AED17FE8950D00B9E8A880A417F3FACFEACF6192ABC00365DF1E116EC37A4738D26E76B5FE1C44C042575E655560B48F5",
-"001150FE0002D6813F32CCC7C90ED921978D17FE8950D00B9E8A880A417F3FACFEACF619F4345D0E8E5973702028E790300281885FE1C4A80424B6F75556F37FF2",
-"001150FF0002839D19B2BB60F75097301A0817FE8950D00B9E8A880A417F3FACFEACF6193284425F66FB580B089B361005100BD75FE1C4BD042321C1000063E2D7",
-"001151000002B04CC14ACECA23B42BED173417FE8950D00B9E8A880A417F3FACFEACF6196A177BB4FB12A1CE61D4FD9CC8105FAC5FE1C4D804236088AAADAB35A7",
-"0011510100020168B46D8B54736CED204CCF17FE8950D00B9E8A880A417F3FACFEACF619196219A7AFDED6F082E788609B672F005FE1C4FD042372BD555B84C69D",
-"0011510200021D8EA74C3F84937E04AAA3E517FE8950D00B9E8A880A417F3FACFEACF619FB6B11C7D2E237B8998EA73FF28EDA775FE1C50E042347A9AAAD205D66",
-"001151030002F302A448E934055223B7C22917FE8950D00B9E8A880A417F3FACFEACF619670F203A9888C035D5CC9FA286405FD15FE1C51B04239AE9AAAC54F6FF",
-"0011510400027C34F82F6480C0F2698686AF17FE8950D00B9E8A880A417F3FACFEACF6190E5C3E1210B3150AC5028D36870E90465FE1C53A04240984AAAD35DC43",
-"0011510500028FAB33CEBE34B65D582996A717FE8950D00B9E8A880A417F3FACFEACF6193043AB20B7ADCAA09109471493F4351D5FE1C54104240408000169CDF3",
-"001151060002A1EBA759E9ACA2A61904426A17FE8950D00B9E8A880A417F3FACFEACF6196970BFE4EEC5F66ADF9D0BE624FFD40A5FE1C57004249C7300037C5B1C",
-"001151070002AFCAD966D1B3C31F1FFA18B317FE8950D00B9E8A880A417F3FACFEACF61929B6331E926669A247833E93B56C04835FE1C57A04242A7F5557EF609B",
-"001151080002B8D6FDCBF2C9795BAB29D78617FE8950D00B9E8A880A417F3FACFEACF619B988A6E059FB0764A31DC8C17387DBB15FE1C58E0424B3875559B89E90",
-"0011510900024FC58FBE0CFE2218BA46697017FE8950D00B9E8A880A417F3FACFEACF619068AE70D67D78FDA914D1EB60ABFE0B45FE1C59A0424F770AAAC1A5864",
-"0011510A00020C5146E5E53CD3CE4F6CBC7517FE8950D00B9E8A880A417F3FACFEACF619811111BDCEB7052FC238792763CD7DEC5FE1C59F042574330000332A65",
-"0011510B0002000FAE4912DA992DB28E031317FE8950D00B9E8A880A417F3FACFEACF619F66D80CA7709FF1AC336B7105359F5005FE1C5A0042625075558011B77",
-"0011510C0002F630909EAAF4341A2089632917FE8950D00B9E8A880A417F3FACFEACF6197A46F30CD2E55B27301904D98859DCCD5FE1C5C20426FC155558FEC7D8",
-"0011510D0002B493A6CDF3A838C1F04A00AD17FE8950D00B9E8A880A417F3FACFEACF619F902E04B249009C31DC5521A15EB32DE5FE1C62A0426DD7DAAB2E6A068",
-"0011510E00020F97E92C7CB280AD3AAC7C2CCDF3A838C1F04A00AD17FE8950D00B9E8A887AF6C18FBFCB9D54E33FBC06EF2244C25FE1C6A10424D165000638B920",
-"0011510F0002E00413811F869D88ED0770AECDF3A838C1F04A00AD17FE8950D00B9E8A88CFAB442084F76330B2040D7E1D2693F25FE1C6B204229AC20000EF61AC",
-"001151100002AE4B6A8A2FBE4D529D5F8604CDF3A838C1F04A00AD17FE8950D00B9E8A8807EFE5F5773B6BCE295E954877C980D35FE1C6B50422EFD1AAAE37AF22",
-"001151110002727BD6CC28671E77E38C6581CDF3A838C1F04A00AD17FE8950D00B9E8A880E0BA71D00AFCC169B06EF68D52A05405FE1C6D4042396E00000C5C38F",
-"00115112000242D417360182E6303C2CB3B1CDF3A838C1F04A00AD17FE8950D00B9E8A8870FE8AD10E540582E0974A65929D758A5FE1C6D704238CCAAAAB807FE6",
-"00115113000272126761FD456AD13CA07EE7CDF3A838C1F04A00AD17FE8950D00B9E8A886EC162F97382BB7FA04528CB66EBD6DF5FE1C6DA04243A0AAAAD7EAD00",
-"001151140002225EFD135C4896CC0641DCB9CDF3A838C1F04A00AD17FE8950D00B9E8A88ECC317E61C933FD6A0408FD54A81F7165FE1C6F70424E957AAAB0343F0",
-"001151150002F7EC8E6F319473F4BBA867F8CDF3A838C1F04A00AD17FE8950D00B9E8A88685E9B7618421E9099360828CE23682A5FE1C7310424EE2055561EBAD0",
-"00115116000279D52F8E540C5C339258CA24CDF3A838C1F04A00AD17FE8950D00B9E8A882BDFA2BA9D9D59AD0FED8B7B1EA1E6CB5FE1C7340424370300072EF0FE",
-"0011511700023F76785E3F3A22D01C88D6E1CDF3A838C1F04A00AD17FE8950D00B9E8A8828DECA2D9A1AADC33C2E58FBA0A27D5A5FE1C75F0424E9F5AAAF4A9D65",
-"0011511800020D15083E6573E458DA856163CDF3A838C1F04A00AD17FE8950D00B9E8A886D3E5BC6B424E489FBABBF3E655816D45FE1C76C0424914B000287994E",
-"001151190002FD5BDA9E8FE18EEE8A85AD96CDF3A838C1F04A00AD17FE8950D00B9E8A8830519BF45224FA243F280334BB60E36A5FE1C773042501995558059295",
-"0011511A00029427F7137E547E9D27A8105ECDF3A838C1F04A00AD17FE8950D00B9E8A88E70FAABEAB8167DD1FAF9178420B4CCB5FE1C77C04259A4AAAAFD05D7F",
-"0011511B0002A40D8458D7E969F7541A70AECDF3A838C1F04A00AD17FE8950D00B9E8A88D9BCB688B17F5DF51D00F3FFAF333D045FE1C7A004262C1A555851CD8C",
-"0011511C0002FD576A31E447BE448176BDB7CDF3A838C1F04A00AD17FE8950D00B9E8A8842AAC63975767B66B96DEAFDD1EC87B25FE1C7A9042600ACAAAE3E27AC",
-"0011511D0002BEE7940A27AD29805DF9A073CDF3A838C1F04A00AD17FE8950D00B9E8A8879B4D533E19A6C31DEF0B840F58D95D25FE1C827042697D90008A8FAA1",
-"0011511E0002095EA756DEB55D42C6B41A92CDF3A838C1F04A00AD17FE8950D00B9E8A88A813A52ACB996551B4261CC1FC6A924C5FE1C85304240B4D5556076E1E",
-"0011511F0002A6483457DEC0462BDBA5859FCDF3A838C1F04A00AD17FE8950D00B9E8A885B4CFF6ABDC02A7279592438523B30705FE1C86C0423BAE555580D905A",
-"0011512000027F3805FCCA2A218F7A366209CDF3A838C1F04A00AD17FE8950D00B9E8A88A308D0513F0E92C9890E0207273DF1C75FE1C8770423D8AB000172ED60",
-"001151210002EFC5EEE86CD2C93FE2752FECCDF3A838C1F04A00AD17FE8950D00B9E8A88B70F4E7ABDEBBCAAFC8EDF1DA06883AF5FE1C89304245091AAAEAB22CD",
-"001151220002D0A5F845BFC91B4477EDA80DE86CD2C93FE2752FECCDF3A838C1F04A00AD42A549B87835C05935C1A2E49F9A7FB35FE1C91904245CE7AAAC04CB57",
-"00115123000234EB64371A2EFF697C3F8769E86CD2C93FE2752FECCDF3A838C1F04A00ADC422B370386B44D1362C9D8E2E0D17505FE1C9340421F2F7AAB013C6A4",
-"001151240002363519CB4155035C713A2722E86CD2C93FE2752FECCDF3A838C1F04A00ADD8DBCC7CD0B4692BEC426F8129A6282F5FE1C94304220AA2AAAEB34A00",
-"00115125000263D7EC0D4E947DA6F94FAA4CE86CD2C93FE2752FECCDF3A838C1F04A00ADFEDCC8033FD3BE24EEEB0372DDF5471A5FE1C95604226001555FB14D56",
-"0011512600026020A08D094821E69B238FB2E86CD2C93FE2752FECCDF3A838C1F04A00AD2EFB855DB658CBAF7F78E72BAFDC169E5FE1C98E0422A004000050CCAE",
-"001151270002E8BC2BFD14CE111EEC1C2175E86CD2C93FE2752FECCDF3A838C1F04A00ADE7A151174717A83B669436C8E7DAFE335FE1C9A404220CC90001C416B0",
-"00115128000284A188709C8553766C0A2C69E86CD2C93FE2752FECCDF3A838C1F04A00AD4CC65ABCE0AC012BE7A4AE109BD184E95FE1C9C10422348A555A47F115",
-"001151290002EF54DCE53D54E8846DECB42DE86CD2C93FE2752FECCDF3A838C1F04A00ADA27A8BE4F301D7F82882BFF662B40E0D5FE1C9CF04223AF5555FC29AEA",
-"0011512A00025DEB02E82CB10DFA7EA58C83E86CD2C93FE2752FECCDF3A838C1F04A00AD7AC08627F80FDDCADD76C7A5C6FCC7F85FE1CA00042296EAAAAB316FE5",
-"0011512B0002991EB2F6C8DDD51B7B9F08FCE86CD2C93FE2752FECCDF3A838C1F04A00AD3D6560C6882D030F65A0A9080D4D6B6A5FE1CA5304222C620005C3CC9D",
-"0011512C00026B2456D0277CA0639DF2B93FE86CD2C93FE2752FECCDF3A838C1F04A00ADE49CD688A47476492170416494C0DEB25FE1CA670421100C0001A112DB",
-"0011512D00029164BE88C36BD3940EF43578E86CD2C93FE2752FECCDF3A838C1F04A00ADA3D771E7981EB14A190A5E2843501BE05FE1CA8104214810AAAE21DC45",
-"0011512E000251F25BBBA149207AAC45254AE86CD2C93FE2752FECCDF3A838C1F04A00ADA0E6D81CA5D80F189A4FAA04FCFB19F65FE1CAC504215E97AAB042B1F2",
-"0011512F000253D0EB69794B5386E280334EE86CD2C93FE2752FECCDF3A838C1F04A00ADB81B9680B956854AD39C01FE8925E5EB5FE1CAD504209A5E5556A63428",
-"0011513000027FA8998FFEE52A4BFD54939EE86CD2C93FE2752FECCDF3A838C1F04A00ADD4C3672316251A33078BFA690F1F15D85FE1CAD90420E350AAB23B65D7",
-"0011513100024DE25E40548C7F7AF3484847E86CD2C93FE2752FECCDF3A838C1F04A00AD80C0708B702ED44028AC776198CAB9575FE1CB0404216CF8AAAE123D6B",
-"001151320002C9AED3EBFB0A94402E748D41E86CD2C93FE2752FECCDF3A838C1F04A00ADC47342F82C1F669023ED2DC3600C63DF5FE1CB2A04212921AAAAE3F7E7",
-"0011513300027EB79B25C8F80D6C450DC109E86CD2C93FE2752FECCDF3A838C1F04A00AD31AEC2AB887C3BA45CE88787CA610B345FE1CB2B0421018F555635F2B6",
-"001151340002D982D828ABC0A8CCC0887F8AE86CD2C93FE2752FECCDF3A838C1F04A00ADC7072F82478D81722448CF27B60036CA5FE1CB2E04219B4DAAB375DFBD",
-"001151350002571F8137657893AFE230564CE86CD2C93FE2752FECCDF3A838C1F04A00ADB3BF81CFF84583573561416D2778E3935FE1CB5C04222E2C5555AEB1F1",
-"0011513600026FEA67985A74F3BDBF995C5937657893AFE230564CE86CD2C93FE2752FEC20930A16506CD46166F1E45CE8144C7F5FE1CB5E0421D3450003BD1DBA",
-"001151370002CB6C9B4C8C29133B05D4734137657893AFE230564CE86CD2C93FE2752FEC545C8FDCF604944255454CC9D11F22B25FE1CB69042270575559F86DF7",
-"001151380002D38DAE726F030B7138580CE537657893AFE230564CE86CD2C93FE2752FECC9B3B220F9EC55A4DC4C281A06F1BA7F5FE1CB920422DD2D0001449B56",
-"0011513900029075BF20EF340623084898D537657893AFE230564CE86CD2C93FE2752FEC1616B6F2F9618AE62DD2591E6A9212615FE1CBF704229E725561D10D17",
-"0011513A0002E60327281CD7C642F5D1859237657893AFE230564CE86CD2C93FE2752FEC009ED02D6D409B66D98C4F287BC2CB625FE1CC2F04211E145555CF5851",
-"0011513B0002D1A54D6AC69315E8CBA0F82737657893AFE230564CE86CD2C93FE2752FECE1D03DE1E369AB0CC69DC3A31D5892345FE1CC3104209CFD5559A6F3FD",
-"0011513C00027E08A44A39BAE6001E291A3D37657893AFE230564CE86CD2C93FE2752FEC835AF23FD07B17044A25C185DC9AE9645FE1CC540421306EAAAB10E8E7",
-"0011513D0002275FDF16E76C869BAEEAD17737657893AFE230564CE86CD2C93FE2752FECBADFEA1019BE9EBA00D775F1252226125FE1CC560421173B55569F36B6",
-"0011513E0002E580CA1F69F2CB0087961E9037657893AFE230564CE86CD2C93FE2752FEC4EC99EE988819AC51142B31F6DD568A45FE1CC710421AB1200007270EA",
-"0011513F000224442C21DED968E6B1D90D5537657893AFE230564CE86CD2C93FE2752FECC151C6657ED339AA0A9CFED07B3D13A35FE1CC870421BBD2555B183940",
-"001151400002830BABF7A7741A30E661995B37657893AFE230564CE86CD2C93FE2752FEC9CB0A2014FC92F7250353758355EE7A65FE1CC970421E915AAB4CD8F36",
-"00115141000298C7C4AA258FB980A5A46A0137657893AFE230564CE86CD2C93FE2752FEC93A3D2CD7E0E3F7A38A922D70EAB2CBC5FE1CCC90422382CAAB027C664",
-"0011514200028B943D90197ACF392530AA4937657893AFE230564CE86CD2C93FE2752FECA0A9B9E5E197CB498D457A1F1552794C5FE1CCD80421C9D8AAAAC484B5",
-"0011514300023040ACB61CB248D4F55A1A2C37657893AFE230564CE86CD2C93FE2752FEC8D777E1CB6A02E00026DDAFCB8DEAAA45FE1CCDF04221F4900020E616E",
-"0011514400025A925FA96548C7AF06106B1937657893AFE230564CE86CD2C93FE2752FEC59F27344041C43423FFF23DF57522F5F5FE1CCED0422A14FAAAB40EE91",
-"0011514500021F0322D6F77FCEBAD6CB34EC37657893AFE230564CE86CD2C93FE2752FEC686AB79D428B2531728454A1CF52867D5FE1CD260422FAE9555BA968C5",
-"0011514600020DC03DF42CE595187D8CB04337657893AFE230564CE86CD2C93FE2752FECD8A87A5B2BF2588D19EFDFB33B82DFA15FE1CD630422611B0001075D17",
-"00115147000287E45F92623D4490860ACD5037657893AFE230564CE86CD2C93FE2752FEC6E696EBE5DDF37A6D8DE5590BA0995AA5FE1CD7D0421B882AAAF96DE71",
-"001151480002977BAFC07A107F2879FEE03337657893AFE230564CE86CD2C93FE2752FEC3CE751887BAEE4AFC74FF0D4C373901A5FE1CD8B0421D03DAAAD944A51",
-"00115149000284CFA64D4082FFDA5D7659D737657893AFE230564CE86CD2C93FE2752FECF6A27886BA9FE81378569E8FDA48D4235FE1CD9A042227A50000D980E8",
-"0011514A0002B0248A6483E8DE67A794AD724D4082FFDA5D7659D737657893AFE230564CC0FC8F99713633556323B1F2025378955FE1CDA404227BD3000291A847",
-"0011514B000250509EB15DC2C40108FDC0834D4082FFDA5D7659D737657893AFE230564CBFD0106835DBF7CCED83FA742F4A74C85FE1CDC10422EC4F5557B77938",
-"0011514C00021B6B88920E7060552A7664454D4082FFDA5D7659D737657893AFE230564C166D62EBED979517E3CDCF6E20ED71FB5FE1CDC80422EDF85555C58C08",
-"0011514D000229901A7F33C46CDD6123B45D4D4082FFDA5D7659D737657893AFE230564C32331B345DD676F291B540ED70AB447A5FE1CE17042375BAAAB005D6E4",
-"0011514E00024A04B35060EACC01C442C0E74D4082FFDA5D7659D737657893AFE230564C254362B9633BF0728BFB1C1CA13863705FE1CE26042256000001545249",
-"0011514F0002FF603B1F52B7F5A9064A42054D4082FFDA5D7659D737657893AFE230564CAA73762CA530C2DFC083C0DD05D613895FE1CE2A0422AFDCAAADD816F7",
-"0011515000021B7A4B72A63AFAF60CA531994D4082FFDA5D7659D737657893AFE230564C0A0A0C7C58E8F20B7A897AC5EEE167355FE1CE480423482F000609CDB3",
-"00115151000237317708750D1AFE7B1C1DE14D4082FFDA5D7659D737657893AFE230564C5F43AD02C404C43F365A5B19D25E70C35FE1CED304234766AAB4A85EC1",
-"0011515200021365EF5DA0C2EBE35C0A53E04D4082FFDA5D7659D737657893AFE230564CF9E328C52720AFDA96A5ABB7DB55C5035FE1CF050420E87EAAB1995261",
-"00115153000252B1CD45B6637C70BAB7BD5C4D4082FFDA5D7659D737657893AFE230564C3EF570A5A5A2CEDF9EB2B238136BC0E35FE1CF1804208879000076CA14",
-"001151540002F241721150EF42CDD6BEDC7E4D4082FFDA5D7659D737657893AFE230564C94813481078B7F3D6CE81FE51A3F1A435FE1CF1A0420C2C10002F195AE",
-"0011515500020F40D293244FDB5AC812E8844D4082FFDA5D7659D737657893AFE230564C3C9932C3CB48E355D59277A982834D355FE1CF39042155A6AAAD76EDE6",
-"001151560002E2EA8146A100CFA181C9F78C4D4082FFDA5D7659D737657893AFE230564CD6988D7B79AD1B1EA1236E5A6ED1EB985FE1CF4104214DF800008C2A41",
-"001151570002A910E075B0A8F08377FF587C4D4082FFDA5D7659D737657893AFE230564C2CE661CAAAB43E3D99A2DAE79B99D0B15FE1CF500421C2BA00000BE5E5",
-"001151580002563BAFFAB9BB7B1562F5ADDA4D4082FFDA5D7659D737657893AFE230564C35FF40E4FD1FA4B7C969D209C6016E6C5FE1CFB40422160F5559BF7E90",
-"00115159000214664DDE256C15BFA16B34264D4082FFDA5D7659D737657893AFE230564C9A3EAA07138AEC8591577AB59D57BEC85FE1CFC104209513AAAC880E37",
-"0011515A00022747F6010321746EAD06B4FD4D4082FFDA5D7659D737657893AFE230564C371BEE858B06FAF9DBC6CD0A8EEE63FD5FE1CFDD0420F265555A57015B",
-"0011515B00028BB92B8A04224EE6CC6066E54D4082FFDA5D7659D737657893AFE230564CB6BE8F3AAF20775730C012563BA6A4105FE1D0250420FD4CAAACAA86BD",
-"0011515C0002566598A706D7BCBFBD7475664D4082FFDA5D7659D737657893AFE230564CE3F04CA28AAE9827DC7175B4457592ED5FE1D0420420253E5557EA51A9",
-"0011515D000214A6DDF27B9087AE37C79C614D4082FFDA5D7659D737657893AFE230564CEE92B365236807547AA19C35529E1FD65FE1D06B04202DC75557C2106B",
-"0011515E00022CE19A63058E225565492FB9F27B9087AE37C79C614D4082FFDA5D7659D7ADD61BFCF7F5F2C9F389EEBCD18C03CA5FE1D09F041FF7A900004B3C49",
-"0011515F0002DC2472EDBBFD48609D43C6ACF27B9087AE37C79C614D4082FFDA5D7659D7555051906C435DF428FCD9357BEA615E5FE1D0A0041F8986555944BB19",
-"00115160000230E321DB60E4B43BF1099DBDF27B9087AE37C79C614D4082FFDA5D7659D7DE8F0C5D49B4B84D10FEC22D40DFF9C55FE1D0C1042019290003E17ACE",
-"00115161000242B475F038D58A58A5F053A1F27B9087AE37C79C614D4082FFDA5D7659D78FC701AC4AA5918F8FA4C164AE31A3565FE1D0E304200A18AAAEF785EE",
-"0011516200021A92B5817BE23B88A968A8A4F27B9087AE37C79C614D4082FFDA5D7659D7ADCF5CF6C383D53B77A31C0EC09A7E7C5FE1D106041FF45E55596E7B52",
-"00115163000270700D61BCFACDCFE5D1915EF27B9087AE37C79C614D4082FFDA5D7659D7B094ECC30336C8E27529C02F87ADD2BF5FE1D112041FD86900020F1AC8",
-"001151640002EEB9474A6DD939886F1C0F1EF27B9087AE37C79C614D4082FFDA5D7659D775DD4DFD82D7FAAE549A271660DAF02F5FE1D118042034825557A3C93D",
-"001151650002D4BD7D50AF1FF7A2100B3F04F27B9087AE37C79C614D4082FFDA5D7659D7D5720A1AEC5AC2B8AA5AA04EFB9F4DEC5FE1D14F0420B0B10001FC4EB8",
-"001151660002C481DC045D67DAEF11BD8992F27B9087AE37C79C614D4082FFDA5D7659D704DD5BE9546E9277A3334783476932575FE1D18B04202E08AAAB140738",
-"001151670002C6EC73B8718E1EE225D4D730F27B9087AE37C79C614D4082FFDA5D7659D701EE5E7BFFDD7550306402067D84601A5FE1D1D0041F99E60001685E71",
-"001151680002D92B42AE4FD48CA3169C605DF27B9087AE37C79C614D4082FFDA5D7659D7F4E79DC96BD67A6B18652AE8E01223135FE1D212041EE0825558A28CEA",
-"00115169000280147E60AD188EB88E71AFBFF27B9087AE37C79C614D4082FFDA5D7659D7ED7046AE8B221DDCC37D4D07DA5EEFAC5FE1D25B041E3C0FAAAD31E0E2",
-"0011516A0002E655A63679A0F3A25C00C51FF27B9087AE37C79C614D4082FFDA5D7659D728001F78F2088D867F5B5A18EBA201615FE1D262041D80A5AAAC25BA0B",
-"0011516B00024611CFE5442AA2485D9923BFF27B9087AE37C79C614D4082FFDA5D7659D7675C352E3BB8D4B3D915AF1E76C278525FE1D27E041DE5D9AAAC7E6575",
-"0011516C00020DAD6B5668FD167FFC159780F27B9087AE37C79C614D4082FFDA5D7659D73DDF8C00DE4E2F9998BAAC903F77023A5FE1D29A041DEEBB555CBB98D5",
-"0011516D000247D9C6D7DB3B7935ED164334F27B9087AE37C79C614D4082FFDA5D7659D7E3F7E265C315BFEEE2902582C8EF897E5FE1D2C4041DF7B7AAB1618AD2",
-"0011516E0002EA49ECCFD3284239AC0B3730F27B9087AE37C79C614D4082FFDA5D7659D79738EE9BAA4E6F0CDCDA892FDC35ACA65FE1D2ED041DC292AAAC2CDA0E",
-"0011516F0002651E292A669C69B5DFC68CD5F27B9087AE37C79C614D4082FFDA5D7659D7CA74141340C9E0858288E5BCC9211B965FE1D2F2041D92EFAAAB58D514",
-"00115170000254B6AF8152C77DB74F63AA04F27B9087AE37C79C614D4082FFDA5D7659D787470F687F2971C5576DC5EF517710095FE1D2F5041E02A0555CD565AD",
-"0011517100024C12FC9378EB44A0BE4DA697F27B9087AE37C79C614D4082FFDA5D7659D7176EE74BC7EE68C5075DCBAFC58AB5D25FE1D32C041E7BD45556C27224",
-"00115172000287DA9BFCE087019888D96CF69378EB44A0BE4DA697F27B9087AE37C79C613D27273270CB1D979FAB5F25085A46AF5FE1D331041E02710000B36871",
-"00115173000297BC0B1A44951AB90BD644BD9378EB44A0BE4DA697F27B9087AE37C79C611D06EFAC02D4C76CD9CB24BB5DDE9CE25FE1D36C041E724B00051D5F5E",
-"00115174000207DEE7A4E8E7C25E54C136269378EB44A0BE4DA697F27B9087AE37C79C61BC5218A1D7A80C7674E52255D7B613025FE1D390041DECC6555A97E1F7",
-"00115175000250A5AF716B04A49BA723DA119378EB44A0BE4DA697F27B9087AE37C79C61739AEA9F7597C29DE0623AD0020451CD5FE1D39F041DD462000161FC9D",
-"001151760002240D7BA87CD3D9C1363A966C9378EB44A0BE4DA697F27B9087AE37C79C61D8F382233490F6CFF7E25A8ED5FEC94B5FE1D3BB041E18F1AAADBC44F1",
-"00115177000210C3EB2CC2A8A4F838BD54AD9378EB44A0BE4DA697F27B9087AE37C79C6123A1F0E8A1E7E94F94ACE158FCC686C65FE1D3E0041E22F3555D2D8954",
-"001151780002DFFA1E6BAD584F2C781540749378EB44A0BE4DA697F27B9087AE37C79C618A6BD3F58D2AE2D9A10572169785BE9D5FE1D42D041E03BBAAABF7476F",
-"00115179000229689D82A80583450221AA959378EB44A0BE4DA697F27B9087AE37C79C61EF2AB40F435414B0E86DFC2E8086D8A15FE1D446041D3176AAAE3661EA",
-"0011517A0002A25A1AC69E0702EDE6958AF29378EB44A0BE4DA697F27B9087AE37C79C6197C8CF3EB060FEB612593D700E3A4BBE5FE1D450041D4740555F132961",
-"0011517B00023F6C3AD85DF0558FAC0B13259378EB44A0BE4DA697F27B9087AE37C79C61B9251BD98924EF84E3C6CFF87107109E5FE1D493041DA0DFAAAB9B74B8",
-"0011517C00029C093FB38B6AE7AC96F864609378EB44A0BE4DA697F27B9087AE37C79C616F202EB3B1CCC5363DD535CD9EFF88CD5FE1D497041CFBC4000034D4B7",
-"0011517D000243043FF63622C9DD0E0DB4B39378EB44A0BE4DA697F27B9087AE37C79C6125363F4ED8FD5BB12CDD110C42F418065FE1D4A2041D6F990003A6B90A",
-"0011517E00027F8507D732E53886411E7EA49378EB44A0BE4DA697F27B9087AE37C79C61AC8EF9C668D5007ABE261E531E3EE85F5FE1D4C3041DC4CF555C21FD49",
-"0011517F00024CBC8B2283142C436E0FD7B69378EB44A0BE4DA697F27B9087AE37C79C61B05A3DBA2110B8F91A14B20E8F23E1D55FE1D4D5041DB65F000132B0E4",
-"00115180000271899A9730484CC74B1BB58C9378EB44A0BE4DA697F27B9087AE37C79C61393B63E072603DE9C2E66E87B283DCC85FE1D4D9041DEC3C000131EBE8",
-"001151810002CED1BC8266273721AE3861FD9378EB44A0BE4DA697F27B9087AE37C79C6109C53DA5D4CE8487C033126E65F818DD5FE1D4DE041E66880002789F7A",
-"0011518200026E857328A230D2BCF2EB89A79378EB44A0BE4DA697F27B9087AE37C79C61DB3444EBDD0465D7D09A09F154D7CF3E5FE1D4E5041ED97000015FE524",
-"001151830002CF3898FD78800773D697A7329378EB44A0BE4DA697F27B9087AE37C79C617573AFD4B58542BD45345C060286B4E15FE1D4E9041F4BAD5555E1A370",
-"0011518400021365587A61C83817A2C311049378EB44A0BE4DA697F27B9087AE37C79C613A4D5B51868836DDB99404907668A46D5FE1D4EE041FD2805557B2518F",
-"001151850002FDDFC20B10E56E3CC3FA40CB9378EB44A0BE4DA697F27B9087AE37C79C6191A46CAE247F05C807F76A83543EB1D95FE1D4F9042059580004C24560",
-"001151860002D48184993AF6A1924F0BBF800B10E56E3CC3FA40CB9378EB44A0BE4DA6976A1825F9BBB9AC2598062BA87EE522625FE1D51B0420C211AAAFFFB07B",
-"001151870002846CDEF975CAF3CA3C3B895F0B10E56E3CC3FA40CB9378EB44A0BE4DA697770FB455B3884E9C98562E6D8DD29B3F5FE1D53E0420A527555B47DBEC",
-"001151880002918166626600E981D58EB0B10B10E56E3CC3FA40CB9378EB44A0BE4DA697EFE1F0D085262850433C7B04FD879C0F5FE1D57604208A83AAB0F5BE36",
-"0011518900026A354A20F2B454B23A3C16C20B10E56E3CC3FA40CB9378EB44A0BE4DA6970C893334FF04A54D2191B1E850CC51145FE1D5CC041FFE155557D5E761",
-"0011518A0002C300C3B4CFFF1DCD879E63E50B10E56E3CC3FA40CB9378EB44A0BE4DA6970FA4D4C754716AA5E57EAC525244CA1C5FE1D609041EDDDB555563B00D",
-"0011518B000271075D85F3B5D459E64049DB0B10E56E3CC3FA40CB9378EB44A0BE4DA697B48FB5235D97A591F36F1AD2A2C49D4E5FE1D630041E473300027F0230",
-"0011518C0002AA58885F07DA3D3951466E940B10E56E3CC3FA40CB9378EB44A0BE4DA697FDB974B9E41DB70C6D86013F9497AFD65FE1D638041E1E2B5556847CB4",
-"0011518D0002EA3E01D86DCEFDE3A4CFC7D40B10E56E3CC3FA40CB9378EB44A0BE4DA697F1090724C2353F280AFEB5F0490ACAC85FE1D64C041E89BB0005188743",
-"0011518E00028FDBF22E085C46020ABDBD420B10E56E3CC3FA40CB9378EB44A0BE4DA69751D3916CF3A557F8D944400B17D77FF45FE1D65A041EBB895556531B0B",
-"0011518F0002F75E776E7700EC5748AE37790B10E56E3CC3FA40CB9378EB44A0BE4DA697339CA425E8023131C951BA55D79E825D5FE1D65D041F0B3DAAAB2AD786",
-"001151900002548F7E369E17B2F15103A7A10B10E56E3CC3FA40CB9378EB44A0BE4DA697B12F2F4AA50E66C85D4F95BA9EB1698B5FE1D681041F9455555B703AC5",
-"001151910002D20BEBEC805593BCAB64A0F10B10E56E3CC3FA40CB9378EB44A0BE4DA697EAB7DBA1BA008981AD2D285DFE5AE7995FE1D696041F748F5558F0CC8A",
-"0011519200028D8B28B5C73FAFFC712DC10D0B10E56E3CC3FA40CB9378EB44A0BE4DA697C39166827CDFCF0D424428BEFE12A8B25FE1D6B7041FA524AAABDC7303",
-"001151930002103316A30B703D08872A94B50B10E56E3CC3FA40CB9378EB44A0BE4DA69781CA6232E1D06E16A1969EA4F0C049785FE1D6F1041F9356AAB0357475",
-"001151940002F7ABDDD4484F9CF210D17A510B10E56E3CC3FA40CB9378EB44A0BE4DA6971A15D9B02767D6D8EA9F8DB86A6092595FE1D736041F034E5556F4FF99",
-"001151950002BF277992988CF8A399A003B50B10E56E3CC3FA40CB9378EB44A0BE4DA697B37FAA3FA8E2C7F87168E6D76068D2565FE1D73B041E44370004DBF874",
-"001151960002A165DABA7570695591D68A720B10E56E3CC3FA40CB9378EB44A0BE4DA697D648126E1FAFDD5AED8E77537405C1FD5FE1D796041EC167000713845D",
-"001151970002F555DC20EE8B95F7BA36AA350B10E56E3CC3FA40CB9378EB44A0BE4DA697F18F0F049F01400A5965912EFD7CD7935FE1D7AA041D9932AAAB04DEB6",
-"001151980002BA3C759A8569F9500AEA8F720B10E56E3CC3FA40CB9378EB44A0BE4DA697D841D9B35FEE3D7EC8669B48788DEE7C5FE1D7AC041DCC9B555AD68CDE",
-"00115199000242F0AD73B55872095A43BFEF0B10E56E3CC3FA40CB9378EB44A0BE4DA6972D7379A36469E61FACA6CB6BBC1A22D45FE1D7C6041E548CAAAB99AFEC",
-"0011519A0002F03FD7ECAB7C9F0E45BF80E673B55872095A43BFEF0B10E56E3CC3FA40CB27D01C26AE0731CDF7B5894CFDF8D5325FE1D7CA041E667F00004B1503",
-"0011519B000211DAF1AADB43F74D2681056673B55872095A43BFEF0B10E56E3CC3FA40CBD05C7C4F03AC080EDF31F4E209C6373D5FE1D7DD041EEAA6555B097155",
-"0011519C00025779A0B9CB09D2B1AFEC4E4673B55872095A43BFEF0B10E56E3CC3FA40CB6F1DCA7E9553D219A95C53D8185FF9825FE1D804041F236A555950AE4B",
-"0011519D00028E4E05B34829EAC5CFFBA67873B55872095A43BFEF0B10E56E3CC3FA40CBCD0E2F6731EFF97036CF624F7DC7150F5FE1D810041EF44DAAAF62694F",
-"0011519E00027F9281BD120C8F4EA9C79FC673B55872095A43BFEF0B10E56E3CC3FA40CB5C974B8CCEE9B0EC4FE9A4841F3410AE5FE1D84D041F4EF355555B108C",
-"0011519F000236526DF8AF8A3F205EFB53BD73B55872095A43BFEF0B10E56E3CC3FA40CBB54E60E8D4563273335EA54EB3D03C845FE1D872041EAD9D55598E2FD8",
-"001151A00002F6508CC1D53EAF304C97C82673B55872095A43BFEF0B10E56E3CC3FA40CB3EDAE7A1F2AAD8988F15E3BAF84167F75FE1D8AE041E8DC85557B1008D",
-"001151A10002BF8DC9EAB0769774AC1CD59573B55872095A43BFEF0B10E56E3CC3FA40CBE08528A514AA802D98E513FFFBF7F17C5FE1D8E9041DFAB4000199754A",
-"001151A20002C38ED042AE1AD9BA8D80ED8473B55872095A43BFEF0B10E56E3CC3FA40CB11E5522FF37A8D5FB2E347886010B0E55FE1D95D041D7427000063EF72",
-"001151A3000224BBA52362362110C28FECD773B55872095A43BFEF0B10E56E3CC3FA40CBC11853B764453BBC7FF8B6B1C4ED19EC5FE1D95F041BF898AAAAE29DDC",
-"001151A4000203DD978D147818AEE74660BF73B55872095A43BFEF0B10E56E3CC3FA40CBCC8213D3832528E53A7649FF2A21EC915FE1D9A0041C745E000391795D",
-"001151A500025007B13AC7F7C06B97A49BB073B55872095A43BFEF0B10E56E3CC3FA40CB84744EEDE21BEBEA1691C24E61A8C8335FE1D9AA041BDE1FAAAB375F6A",
-"001151A60002DB12C9B508DD07F6C3629F3E73B55872095A43BFEF0B10E56E3CC3FA40CB4D8EBB164FCD0B3A983717DF2AF1AB065FE1D9BC041C33625555D89859",
-"001151A700021D7D734AE7CD74B1D0E7CF8473B55872095A43BFEF0B10E56E3CC3FA40CBCCAD6E545B7E7F361AA8CE2662A8CF405FE1D9C2041C6752AAB412DD4E",
-"001151A80002A0A11CCAF4EFB565CAE719D073B55872095A43BFEF0B10E56E3CC3FA40CB3CB5CE128F7FE994F2651B0C25A1D8535FE1DA0B041CD267555CCFF07C",
-"001151A900024B41DE191CCC5BFCFEA0FA8773B55872095A43BFEF0B10E56E3CC3FA40CB724A54D517E2F9417B61A7C05716915D5FE1DA20041C14C255596F453A",
-"001151AA000265CAEA58BA4FFFBA95BE2EFE73B55872095A43BFEF0B10E56E3CC3FA40CB71D3A34F175788196503089130D7EA2E5FE1DA2B041C3BBA00010559D0",
-"001151AB000265F9EFCAAE03B27FDC6EF5B373B55872095A43BFEF0B10E56E3CC3FA40CB8D5C1A152651BFF30FA6E117CF9E9C5C5FE1DA2F041C8D68AAAE3DE21C",
-"001151AC000285B799E404AAE57BDEC0A48773B55872095A43BFEF0B10E56E3CC3FA40CB4F35CE3F0C76308C442304E89A435BD35FE1DA4E041D02A100020C892F",
-"001151AD00023A5409C2DD1EB30F2AF851D273B55872095A43BFEF0B10E56E3CC3FA40CB1257ABBCDD623262B87C80D13575A6105FE1DA62041CFDBE00001971C5",
-"001151AE0002AAAB0D09108BE958BC6E7C2EC2DD1EB30F2AF851D273B55872095A43BFEF8003C8DA466B09DEBB19A23C76408CD55FE1DA69041D2CE75559E175F4",
-"001151AF00025BA716CF958FC6E8C0761781C2DD1EB30F2AF851D273B55872095A43BFEF4BA4C1D04C8BA06FBC09F89A35BE7B865FE1DA8A041D9A92AAAAFA59C9",
-"001151B0000262D8608B47B892094C097137C2DD1EB30F2AF851D273B55872095A43BFEF49C40745E2FF3055148C9A6AC24D26845FE1DAA3041D8B165558692BA4",
-"001151B100022B25ABB90670C035001C701AC2DD1EB30F2AF851D273B55872095A43BFEF59318EB3299A86996C03645A02709B805FE1DAC3041DA47F5555A47F52",
-"001151B200029E8285FC0A82FF6E7286F8FCC2DD1EB30F2AF851D273B55872095A43BFEF590A24AD2D82140C16D620DEE1F99B705FE1DAC8041D97FC555DC23FE8",
-"001151B3000263C70A31EADF5B961ADFF748C2DD1EB30F2AF851D273B55872095A43BFEFC603BB26229B1759A7F55BB4741A60FE5FE1DAF5041E143F5560ECD83C",
-"001151B4000288EA1ECDACB828AAA5A31B5BC2DD1EB30F2AF851D273B55872095A43BFEF2312096F9F11E1942BBE7C319CDE76ED5FE1DB28041DCA020005BC3541",
-"001151B500025947CAEBAD95BA918C0277F0C2DD1EB30F2AF851D273B55872095A43BFEFCF104522CEAA2CF6046B8F72D84858625FE1DB37041D6480AAAD7163E8",
-"001151B60002211FDA731E360339B7EE7AB3C2DD1EB30F2AF851D273B55872095A43BFEF376AEDAFF24403D5BF83E3B6732EA0165FE1DB55041DA8B600004DC357",
-"001151B70002F5BC93882071EC30BF9D2D30C2DD1EB30F2AF851D273B55872095A43BFEF6B72BA8194210D51B2DAF7E2A6D3240D5FE1DB56041DA76F555E040CFB",
-"001151B800020FCFB8778EA377BE59B35C26C2DD1EB30F2AF851D273B55872095A43BFEF0F55BF5F07DA2DE665094F7E4F6744EB5FE1DB83041E39480006F5AF01",
-"001151B9000241951D54DAB48C048AA83C5EC2DD1EB30F2AF851D273B55872095A43BFEF9298363494AABBB7DBAEE2158D23CFBB5FE1DB97041DEDEDAAAE93C14D",
-"001151BA0002D1BD2D0C06CA2F7AEBDA2F1AC2DD1EB30F2AF851D273B55872095A43BFEFC8EE2770B7393B0D4F96D34076C1A1555FE1DC33041E21595555D1FFBD",
-"001151BB00022B63E3F50E14AB01ED1B3B95C2DD1EB30F2AF851D273B55872095A43BFEF9A6CC3F303900CD08513FD70A17F422A5FE1DC35041BD347AAAEC93FDC",
-"001151BC00022B7C254F5FC5FEF0750143A2C2DD1EB30F2AF851D273B55872095A43BFEF570B0EE943E81648AF7FCBECE2FBF6245FE1DC61041C54DE00012FCBDF",
-"001151BD0002F79E92CDBA0D49B45F02B3FDC2DD1EB30F2AF851D273B55872095A43BFEFC10DEF7A039F807EFC8CA3F3C6AC2BFC5FE1DC69041C11D700076DF7F7",
-"001151BE0002E00C9E4AB9ABACDF533648BFC2DD1EB30F2AF851D273B55872095A43BFEFEAA405FBA1D7F25723F45A5C39C2AF955FE1DC95041C7638555962D30C",
-"001151BF00025A46A974C211F360A86BBA96C2DD1EB30F2AF851D273B55872095A43BFEFF1097D957AB4F82EFDB1B773F02EE2A25FE1DCA0041C363DAAABF7BD4D",
-"001151C000024776C1491B1E4A6ED61B1A5DC2DD1EB30F2AF851D273B55872095A43BFEF620E6A89307785D2DB957253F523415F5FE1DCA5041C8B4A0008175D88",
-"001151C10002941C18DA1B72F21EB404DF58C2DD1EB30F2AF851D273B55872095A43BFEFB310E49B35541BDEEBCEA33084CF13455FE1DCEA041CFF9FAAAFF86052",
-"001151C2000259ED1BD43E1756286E97C604DA1B72F21EB404DF58C2DD1EB30F2AF851D2D9EA3F64FBED80ACA5A4FDD6249EBDC45FE1DD0E041C49770007F8D054",
-"001151C30002FB6460E362EB18F81B8A021EDA1B72F21EB404DF58C2DD1EB30F2AF851D2A1846890845B412C7DF25E7C754A73B55FE1DD24041C2F49AAAF1A1A06",
-"001151C40002FA9239434D778860F8689111DA1B72F21EB404DF58C2DD1EB30F2AF851D29AACEDF480F479389D84CA13935E14645FE1DD39041C554255569DEC69",
-"001151C50002FD17B73821370FDE54C8E0FADA1B72F21EB404DF58C2DD1EB30F2AF851D2B030244F1CA380F13F6750BAE1A36C685FE1DD59041C7E30000127F1CB",
-"001151C6000208E59E6AB9CCF17B0A8BAA78DA1B72F21EB404DF58C2DD1EB30F2AF851D256FBE876BCBB3D3B4D7DCFEF646CEC9C5FE1DD70041C74A5AAB15E97C6",
-"001151C700022F5991F88FEE366D9797A4F4DA1B72F21EB404DF58C2DD1EB30F2AF851D2B04819F4141AA2B6C3DC48316318CF4C5FE1DD83041C952300003E3C91",
-"001151C80002855F576EC4A2FB85C0E9EC70DA1B72F21EB404DF58C2DD1EB30F2AF851D26DCBD60188BD10A0D78902AC9296C8785FE1DD87041CC9840004C6DA0E",
-"001151C90002FB7B4C812017C71EA307A474DA1B72F21EB404DF58C2DD1EB30F2AF851D2674D665E6235F61C47B8F2FFE8FA3E8F5FE1DDBD041D4765AAB2B6056E",
-"001151CA0002903869080A0C5E77C2236DDCDA1B72F21EB404DF58C2DD1EB30F2AF851D2502F1FAE919B870BF246CCBC3D9BA5B85FE1DDE7041CD1C8AAAE5E743E",
-"001151CB000253CEAB0AB4EDC6C80387D3CADA1B72F21EB404DF58C2DD1EB30F2AF851D204E47B509DEF7EB5F8981676BC5487A95FE1DDF2041C99540002F2B8B4",
-"001151CC0002836EF963D1E0F9D9CD5985F1DA1B72F21EB404DF58C2DD1EB30F2AF851D27C61A9FC405081AC6E02488E9A54648C5FE1DE14041CF244AAACFD1176",
-"001151CD00020CA471720C4712F4CBF1A3C6DA1B72F21EB404DF58C2DD1EB30F2AF851D2551CD4584D463523453FCD0911D738F55FE1DE1B041CDCD3AAAAD7274E",
-"001151CE0002BF159C27225A32C05A008CD6DA1B72F21EB404DF58C2DD1EB30F2AF851D23F3713195ED4F2AC9010C4039EE6C9B95FE1DE1C041D4A6100032B0BC9",
-"001151CF0002B129A3D6C1E8FDDCB8CBEF0ADA1B72F21EB404DF58C2DD1EB30F2AF851D2DFB9AFB53ADFEC929B737F2B3DF11FF05FE1DE25041DDB845555AA2C80",
-"001151D00002CCAA91BBF0B06CB8A8380F18DA1B72F21EB404DF58C2DD1EB30F2AF851D2AB39BBF0671D2B0F9BAAED23F4B164EB5FE1DEA0041E46DA555583AC8C",
-"001151D10002F081D1F736F5A5AA53ACCAABDA1B72F21EB404DF58C2DD1EB30F2AF851D24CE060175C8A7022767E79ABC833C92F5FE1DEAB041C7AA4AAAB530F4B",
-"001151D2000257317A3A8442A814440EF174DA1B72F21EB404DF58C2DD1EB30F2AF851D2BE852824337D980F7E34997861D4D34A5FE1DEB9041CD7EE55577384E4",
-"001151D30002A1BB9E678C89BEB291F7396ADA1B72F21EB404DF58C2DD1EB30F2AF851D294FEC21ECABB9E654F15E1CF6BC2F9335FE1DED5041D237C0000368B7F",
-"001151D4000242CEEE9F8EEA552AAC960314DA1B72F21EB404DF58C2DD1EB30F2AF851D2779621D5112E50AC02848DE633347D4B5FE1DED7041D2D98555829D7D2",
-"001151D50002E37AF44B2DB1D02D35B466F6DA1B72F21EB404DF58C2DD1EB30F2AF851D20DDF3FFB668321D112174B79BB876C895FE1DEF9041DBA14AAAF168E6E",
-"001151D60002E3FCE329278EAC1F498F5EC14B2DB1D02D35B466F6DA1B72F21EB404DF58BE1A9E3676D538D56C97C790924450E45FE1DF1B041DA35F5559F2C4A2",
-"001151D7000283429FC660363D21F665B4354B2DB1D02D35B466F6DA1B72F21EB404DF582B22BD9E66B8D13F5EC38A39D08F3A695FE1DF28041D90E10008081978",
-"001151D800022E181627023420F7B05405354B2DB1D02D35B466F6DA1B72F21EB404DF5818119251B1974229B715216F4A953B2B5FE1DF5F041DE611555BA03D71",
-"001151D90002E7DABDA5FE11584C31A7F9584B2DB1D02D35B466F6DA1B72F21EB404DF581E00F63BCD61A68420AD2D90FF52D1925FE1DF70041D66F355556CA37B",
-"001151DA00021A415422FB4E0208386F71AA4B2DB1D02D35B466F6DA1B72F21EB404DF58EAFB4D7C8A1AF2E8BF7F0A05514B35F85FE1DF78041DAA1B555736C736",
-"001151DB000281D6001B27CE3D00352266434B2DB1D02D35B466F6DA1B72F21EB404DF5896D8BAAC7CE3948B5E351ED8B4175F6B5FE1DF83041E1A6E000105C6C0",
-"001151DC000237BF431029A4A18CB2663D544B2DB1D02D35B466F6DA1B72F21EB404DF58D00BC76022C287374042C4A2B499D5465FE1DFA8041E7D2B0003AC30F1",
-"001151DD0002BED2C869BCC33C2380B3FAB44B2DB1D02D35B466F6DA1B72F21EB404DF5891E44E05A7170F1EACB63FBE6D62EEC15FE1DFB5041E549AAAAAFC6CBD",
-"001151DE00028F5200F79C2BD7259AF90CDC4B2DB1D02D35B466F6DA1B72F21EB404DF58AF4DD195546F2038B1472A8D8168E39C5FE1DFEF041EAFD0555581EDD3",
-"001151DF000234A982904AA1E2718800FBDA4B2DB1D02D35B466F6DA1B72F21EB404DF586707AF4050C041F2B330A4AC949E905C5FE1DFFE041E1B5EAAAD3722A1",
-"001151E000022392DD53E90D76480860968A4B2DB1D02D35B466F6DA1B72F21EB404DF580A234914B7C3F5B87271EA1D9AE289355FE1E023041E699E0003D545CC",
-"001151E10002A5D182F47CEB6328B1C34C134B2DB1D02D35B466F6DA1B72F21EB404DF58F4A19A185F67C87E0CB35A6D77BF29E35FE1E02E041E44ECAAADCFD6D6",
-"001151E200023F469141C6CF0294C36521444B2DB1D02D35B466F6DA1B72F21EB404DF58CC3BD2C042D83FFCE72D4396B7EF6B5E5FE1E040041EAB3B0002AE3A28",
-"001151E30002FFE18F4AE6044701A54BC0474B2DB1D02D35B466F6DA1B72F21EB404DF5872E0112906595CC4AB4523830DF9127E5FE1E097041EEB2CAAAADDEE21",
-"001151E40002BA9A028EEC77A94B7A8595474B2DB1D02D35B466F6DA1B72F21EB404DF5895D3FF2D44026409EB7E05CC9D9CD36C5FE1E099041DBEF5000715D48C",
-"001151E50002E87E398E9678E3D931AE59304B2DB1D02D35B466F6DA1B72F21EB404DF58E300873C93F82C6D24F5D765890A90415FE1E0C1041E540C5557ECA34E",
-"001151E6000274F33579317FEA09986AAAF14B2DB1D02D35B466F6DA1B72F21EB404DF585BD35017BF6C7B65FDF4B0963CDDA9255FE1E0DD041E1FC6AAACC9B0CC",
-"001151E70002357355A86BE40EC9BCB8FF654B2DB1D02D35B466F6DA1B72F21EB404DF583849E4816E186AE9BA264E780EC661D05FE1E0E3041E2C4A5555F2794F",
-"001151E8000213C0B24C954B8B8D331332714B2DB1D02D35B466F6DA1B72F21EB404DF5808568B3AD0DDEE3C8864B1FD5F799F7E5FE1E130041EAD415555EEF5B5",
-"001151E90002FBDB63AC6352DE6BA5FE75DC4B2DB1D02D35B466F6DA1B72F21EB404DF58A9ECF6B009DE6C8FD5144967485F7F825FE1E133041DB82F5555A36698",
-"001151EA00024170D8E2DD1E4B424E634FCEAC6352DE6BA5FE75DC4B2DB1D02D35B466F681F4A3543BC84E420F94DDDC6AF9D4D45FE1E154041E4751555BA14D40",
-"001151EB0002CFA51A2A73BB9B2C2DF6EF0EAC6352DE6BA5FE75DC4B2DB1D02D35B466F6A9F3FBF9DF7B08540EEE8029960CB6095FE1E17D041E3642AAAEEA3C1E",
-"001151EC00026DC7956687926E64A40EEED5AC6352DE6BA5FE75DC4B2DB1D02D35B466F6F1AC896F8024357EC26EEE3A99DA5CD25FE1E19F041DFD55AAAAF88B76",
-"001151ED000270A468967A06B37598863EB1AC6352DE6BA5FE75DC4B2DB1D02D35B466F6BE1D75234F8323089BD93860D68E94325FE1E1A0041DE85055560079F6",
-"001151EE0002DED11EC68E2305D0E8FE0AA7AC6352DE6BA5FE75DC4B2DB1D02D35B466F6123334A8036AA575D9B9304D4394B84A5FE1E1A3041E7E32AAAB9C9F02",
-"001151EF00025D5CF978B0348D147ADCFD6AAC6352DE6BA5FE75DC4B2DB1D02D35B466F6080849D018729F9E7FB0FDCBB62661E55FE1E1DC041F0E9DAAAAC4B80B",
-"001151F00002055E29690055CDD2A5011501AC6352DE6BA5FE75DC4B2DB1D02D35B466F6CF702784EC561D05ADDCD2AF0755D31E5FE1E210041E79F2AAAE003780",
-"001151F10002788A8619B5EB8C462E413F95AC6352DE6BA5FE75DC4B2DB1D02D35B466F67C867374ACABF6B521F8913DE95BEA405FE1E287041E09115555B136F3",
-"001151F2000229E298B83C10D66A345809B2AC6352DE6BA5FE75DC4B2DB1D02D35B466F6F9ABA7DD0AA60FBCD83AF1A5FC0D1C705FE1E289041C5714AAAD230998",
-"001151F300023693C60E5975A26A32B9141FAC6352DE6BA5FE75DC4B2DB1D02D35B466F61BE36CBD49F415331070D0597B9F62BA5FE1E29A041CE032AAADB6118B",
-"001151F40002A8D01576CD0CE723A7C48B10AC6352DE6BA5FE75DC4B2DB1D02D35B466F6B3EFCFF68389452E77B97F1ACB0EAD395FE1E2C3041D1F71AAAC6325EE",
-"001151F50002A3DEA60D8E282B3EF4681828AC6352DE6BA5FE75DC4B2DB1D02D35B466F6249E26ABF35E2047AC93A8E2E10C4BE55FE1E318041CE9700005773A3E",
-"001151F600027573876C528BD1B1004847BBAC6352DE6BA5FE75DC4B2DB1D02D35B466F6811E839630BEA791646BF8AE6F381A725FE1E33D041BEA8000006267A7",
-"001151F70002EE3ABCA622E92C6EE209D17EAC6352DE6BA5FE75DC4B2DB1D02D35B466F690B443F0196B5DB3B4B73FF66381ED755FE1E34E041BCD7B55566C479A",
-"001151F80002F91AE0138C4DC37782C73651AC6352DE6BA5FE75DC4B2DB1D02D35B466F6E39B24F00A6F7E4B86A22BDAA4875F295FE1E352041C072EAAADF0E413",
-"001151F9000286C4FB3D17B064B9DBEC4FB2AC6352DE6BA5FE75DC4B2DB1D02D35B466F67C94E40E490490921C2566957038321F5FE1E35C041C7D3D555D04ADF9",
-"001151FA000253AA27D19A99E587D410E440AC6352DE6BA5FE75DC4B2DB1D02D35B466F6B1DE6D29891847FF6A6396A34D248FF55FE1E386041CDCDE00054EC199",
-"001151FB00027464A792A31A4D3134C81B29AC6352DE6BA5FE75DC4B2DB1D02D35B466F62166AB603D238258BAD693B1FF2972C55FE1E395041C9FD0AAAB95490A",
-"001151FC0002F80263FD7C0CABB5D4126681AC6352DE6BA5FE75DC4B2DB1D02D35B466F6F34CF7E50E726C196774B4E2CA52BB5D5FE1E39F041CE9230003015EE7",
-"001151FD0002E72113B07AF642799A8352CDAC6352DE6BA5FE75DC4B2DB1D02D35B466F6E2CC854035E60147BB7F8C4B7D2D5DEC5FE1E3BD041D4C54555A2C556B",
-"001151FE000263E1188FDC4A2F9121D0298BB07AF642799A8352CDAC6352DE6BA5FE75DC56C360246B0277D9F09FA5940CFADFF55FE1E3CA041D4BD800039704F5",
-"001151FF0002B68F443555C10A0C07E97EECB07AF642799A8352CDAC6352DE6BA5FE75DCBBA956E03A0A5511F93D6F6C3F8431B25FE1E3DC041DA339AAAD2D0106",
-"0011520000022DF7B6AF9934B6E20F7ECF39B07AF642799A8352CDAC6352DE6BA5FE75DCB67918FB546EFD05A8C52129F2F93E075FE1E3E9041DE105555A7B2869",
-"001152010002C09D4772F37216B4DD90797AB07AF642799A8352CDAC6352DE6BA5FE75DC0F244100846FF272B08C318B16C55F065FE1E3FF041E39910000D879BD",
-"001152020002E83F0F1F4788588CAA18F20EB07AF642799A8352CDAC6352DE6BA5FE75DC14533DEC49D54AC03B248D288FE13C685FE1E418041E64D4AAB25543D8",
-"0011520300021063200AD961998BFD9B2DECB07AF642799A8352CDAC6352DE6BA5FE75DCCA52122EB7924E2D324D614853CF910A5FE1E442041E7E2E00001CA001",
-"0011520400028FDE26D4A92BC0AAC42874ACB07AF642799A8352CDAC6352DE6BA5FE75DCCCB74DC00FF4C7E9342945C92E4EA63F5FE1E459041E3DB0AAAD6DA121",
-"001152050002F700F5BD736077428886461EB07AF642799A8352CDAC6352DE6BA5FE75DC98CB7E8431E9E5732D24FE7838D38D135FE1E461041E62A1000039E2D5",
-"001152060002264B528DE228678AFA8C5F2BB07AF642799A8352CDAC6352DE6BA5FE75DC591A61A7B68D5A7D551641CEBDCECBE75FE1E462041ED900555B35ADBE",
-"00115207000217F557ACA8600CA1D5D0BCE2B07AF642799A8352CDAC6352DE6BA5FE75DC5343CF5B3667454A485FD50E32D444E65FE1E48D041F76BD00048FEDFE",
-"001152080002067133A8C3EBFA8B8947B7DFB07AF642799A8352CDAC6352DE6BA5FE75DC1EDEB49BF49CBBCC768370CBA4ACE82A5FE1E49A041F2BDCAAAC0DABEA",
-"001152090002C23CC8509D4615E28BA7B4E1B07AF642799A8352CDAC6352DE6BA5FE75DC59B97A33F7AE54332D58D9201B84047C5FE1E4A6041F8B425555A90856",
-"0011520A0002D9C95BC9AC87054810F562B3B07AF642799A8352CDAC6352DE6BA5FE75DC0478C7A8E48C30BB57E2EC993BEB78FC5FE1E4A8041FF3AE000238406E",
-"0011520B0002214197E11331486DD9552EA7B07AF642799A8352CDAC6352DE6BA5FE75DCE3D61A5E82C8E46E88AF3F8650DD33885FE1E4C404209B77AAAB402E66",
-"0011520C0002012CF254E0386D187D88AB32B07AF642799A8352CDAC6352DE6BA5FE75DCC6617FC7C0546EEB2C3A3724630D1D625FE1E5120420A6BD00009C55EB",
-"0011520D00026DBCBF8E87D5F03BB02DD7E5B07AF642799A8352CDAC6352DE6BA5FE75DC30EE188C1A605FE83A9ECCCCAF500F215FE1E514041F8642555563D160",
-"0011520E0002BB424FF389341EA374D5B717B07AF642799A8352CDAC6352DE6BA5FE75DC082CBE6BCEAE079A6F52640CF2E844415FE1E52C04202CFD000033B75B",
-"0011520F00027CA3B4FFEB5602C26B14751FB07AF642799A8352CDAC6352DE6BA5FE75DCCAA0B7F2F08FB2F44F121138E38D76BD5FE1E54204204F80AAAAF75039",
-"001152100002001E4C250F1A4E834AE51543B07AF642799A8352CDAC6352DE6BA5FE75DC50050E78F48A4EA8AE73F457B40BE2B75FE1E5A60420808700092C4E52",
-"001152110002E4420A930208EA3BB351AFECB07AF642799A8352CDAC6352DE6BA5FE75DC62327F9F1640C38412EBC4210C4AC4C75FE1E5D3041EEB66AAB1FE0EFC",
-"00115212000241B8151BE438FBE260774875930208EA3BB351AFECB07AF642799A8352CDEA57DA5DAE4CD5CF320B614D885C38D45FE1E5E7041E9E8100077AA06D",
-"0011521300023E1C1EBDD3CBA0D4542F406B930208EA3BB351AFECB07AF642799A8352CDDB0B732E9C32F30E19CE28257F8C378C5FE1E5FC041ED6BA0003465D06",
-"0011521400027B74DF7BB2A7B961A51C282F930208EA3BB351AFECB07AF642799A8352CDD163FD5B81D634EEB214D4786B63CFE45FE1E632041F077BAAB05E8AE4",
-"001152150002DA0391F2D5C3B40E76841D6A930208EA3BB351AFECB07AF642799A8352CDC49960F64A9BF3141D38219600DFB3B65FE1E642041E850D555A221C6F",
-"0011521600021EE641F6FF996928FDD984D1930208EA3BB351AFECB07AF642799A8352CDC277DC268EA4254A3437D6DBCAB482765FE1E663041ED1E155576F9D8A",
-"001152170002C5EAF8BF973431F498F526E0930208EA3BB351AFECB07AF642799A8352CDCC00A8254E4D9A0D92323BCCDCF507675FE1E67E041EC24EAAAC151CAD",
-"0011521800024235502D0CA44BD3D9DDEAD0930208EA3BB351AFECB07AF642799A8352CDB8267A90A54C508DDA20D4831A334AF85FE1E69E041ED229555B289F84",
-};
-
@@ -14,10 +14,12 @@
 #include <veriblock/config.hpp>
 
 extern const int testnetVBKstartHeight;
-extern const std::vector<std::string> testnetVBKblocks;
+//! Testnet VBK bootstrap blocks, decoded on first use from bootstrapsblocks.h
+const std::vector<altintegration::VbkBlock>& testnetVBKblocks();
 
 extern const int testnetBTCstartHeight;
-extern const std::vector<std::string> testnetBTCblocks;
+//! Testnet BTC bootstrap blocks, decoded on first use from bootstrapsblocks.h
+const std::vector<altintegration::BtcBlock>& testnetBTCblocks();
 
 struct AltChainParamsPHL : public altintegration::AltChainParams {
     ~AltChainParamsPHL() override = default;
@@ -22,11 +22,13 @@ void Transform(uint32_t* s, const unsigned char* chunk, size_t blocks);
 namespace sha256d64_sse41
 {
 void Transform_4way(unsigned char* out, const unsigned char* in);
+void TransformLanes_4way(uint32_t* const* s, const unsigned char* const* chunks);
 }
 
 namespace sha256d64_avx2
 {
 void Transform_8way(unsigned char* out, const unsigned char* in);
+void TransformLanes_8way(uint32_t* const* s, const unsigned char* const* chunks);
 }
 
 namespace sha256d64_shani
@@ -416,6 +418,7 @@ void TransformD64(unsigned char* out, const unsigned char* in)
 
 typedef void (*TransformType)(uint32_t*, const unsigned char*, size_t);
 typedef void (*TransformD64Type)(unsigned char*, const unsigned char*);
+typedef void (*TransformLanesType)(uint32_t* const*, const unsigned char* const*);
 
 template<TransformType tr>
 void TransformD64Wrapper(unsigned char* out, const unsigned char* in)
@@ -461,6 +464,8 @@ TransformD64Type TransformD64 = sha256::TransformD64;
 TransformD64Type TransformD64_2way = nullptr;
 TransformD64Type TransformD64_4way = nullptr;
 TransformD64Type TransformD64_8way = nullptr;
+TransformLanesType TransformLanes_4way = nullptr;
+TransformLanesType TransformLanes_8way = nullptr;
 
 bool SelfTest() {
     // Input state (equal to the initial SHA256 state)
@@ -544,9 +549,143 @@ bool SelfTest() {
         if (!std::equal(out, out + 256, result_d64)) return false;
     }
 
+    // Test TransformLanes_4way and TransformLanes_8way, if available. Lane i
+    // continues from the state after i blocks with the (i+1)th block.
+    uint32_t lane_states[8][8];
+    uint32_t* lane_state_ptrs[8];
+    const unsigned char* lane_chunks[8];
+    for (size_t i = 0; i < 8; ++i) {
+        lane_state_ptrs[i] = lane_states[i];
+        lane_chunks[i] = data + 1 + 64 * i;
+    }
+    if (TransformLanes_4way) {
+        for (size_t i = 0; i < 4; ++i) std::copy(result[i], result[i] + 8, lane_states[i]);
+        TransformLanes_4way(lane_state_ptrs, lane_chunks);
+        for (size_t i = 0; i < 4; ++i) {
+            if (!std::equal(lane_states[i], lane_states[i] + 8, result[i + 1])) return false;
+        }
+    }
+    if (TransformLanes_8way) {
+        for (size_t i = 0; i < 8; ++i) std::copy(result[i], result[i] + 8, lane_states[i]);
+        TransformLanes_8way(lane_state_ptrs, lane_chunks);
+        for (size_t i = 0; i < 8; ++i) {
+            if (!std::equal(lane_states[i], lane_states[i] + 8, result[i + 1])) return false;
+        }
+    }
+
     return true;
 }
 
+/** One message of SHA256DMany, hashed one 64-byte block at a time. */
+struct LaneMessage {
+    uint32_t s[8];
+    const unsigned char* data;
+    unsigned char* out;
+    //! Blocks read directly from data, the remaining ones come from tail
+    size_t full_blocks;
+    size_t block;
+    size_t blocks;
+    //! Set while computing the outer hash over the inner digest
+    bool outer;
+    //! Padded end of the message, or the padded inner digest
+    unsigned char tail[128];
+
+    void Start(const unsigned char* in, size_t len, unsigned char* digest)
+    {
+        sha256::Initialize(s);
+        data = in;
+        out = digest;
+        full_blocks = len / 64;
+        const size_t rem = len % 64;
+        const size_t tail_size = rem + 9 > 64 ? 128 : 64;
+        if (rem) memcpy(tail, in + full_blocks * 64, rem);
+        tail[rem] = 0x80;
+        memset(tail + rem + 1, 0, tail_size - rem - 9);
+        WriteBE64(tail + tail_size - 8, (uint64_t)len << 3);
+        block = 0;
+        blocks = full_blocks + tail_size / 64;
+        outer = false;
+    }
+
+    const unsigned char* Chunk() const
+    {
+        return block < full_blocks ? data + block * 64 : tail + (block - full_blocks) * 64;
+    }
+
+    /** Move to the next block after the current one was transformed. Returns false once the digest is written. */
+    bool Advance()
+    {
+        if (++block < blocks) return true;
+        if (outer) {
+            for (int i = 0; i < 8; ++i) {
+                WriteBE32(out + 4 * i, s[i]);
+            }
+            return false;
+        }
+        // the outer hash is a single block: the 32 byte inner digest, padding and a 256 bit length
+        for (int i = 0; i < 8; ++i) {
+            WriteBE32(tail + 4 * i, s[i]);
+        }
+        tail[32] = 0x80;
+        memset(tail + 33, 0, 29);
+        tail[62] = 0x01;
+        tail[63] = 0x00;
+        sha256::Initialize(s);
+        full_blocks = 0;
+        block = 0;
+        blocks = 1;
+        outer = true;
+        return true;
+    }
+};
+
+/** Hash the messages in lanes of the given width, refilling a lane from the queue as soon as its message is done. */
+void SHA256DManyLanes(TransformLanesType transform, const size_t width, unsigned char* out, const unsigned char* const* in, const size_t* lengths, size_t count)
+{
+    LaneMessage lanes[8];
+    bool active[8] = {false};
+    size_t num_active = 0;
+    size_t next = 0;
+
+    // idle lanes hash a dummy block into a scratch state
+    static const unsigned char dummy_chunk[64] = {0};
+    uint32_t dummy_state[8];
+    uint32_t* states[8];
+    const unsigned char* chunks[8];
+
+    while (true) {
+        for (size_t i = 0; i < width; ++i) {
+            if (!active[i] && next < count) {
+                lanes[i].Start(in[next], lengths[next], out + 32 * next);
+                active[i] = true;
+                ++num_active;
+                ++next;
+            }
+        }
+        // once the queue is drained, the vector kernel only pays off while most lanes are busy
+        if (num_active * 2 <= width) break;
+
+        for (size_t i = 0; i < width; ++i) {
+            states[i] = active[i] ? lanes[i].s : dummy_state;
+            chunks[i] = active[i] ? lanes[i].Chunk() : dummy_chunk;
+        }
+        transform(states, chunks);
+        for (size_t i = 0; i < width; ++i) {
+            if (active[i] && !lanes[i].Advance()) {
+                active[i] = false;
+                --num_active;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < width; ++i) {
+        if (!active[i]) continue;
+        do {
+            Transform(lanes[i].s, lanes[i].Chunk(), 1);
+        } while (lanes[i].Advance());
+    }
+}
+
 #if defined(USE_ASM) && (defined(__x86_64__) || defined(__amd64__) || defined(__i386__))
 /** Check whether the OS has enabled AVX registers. */
 bool AVXEnabled()
@@ -611,6 +750,7 @@ std::string SHA256AutoDetect()
 #endif
 #if defined(ENABLE_SSE41) && !defined(BUILD_PLACEH_INTERNAL)
         TransformD64_4way = sha256d64_sse41::Transform_4way;
+        TransformLanes_4way = sha256d64_sse41::TransformLanes_4way;
         ret += ",sse41(4way)";
 #endif
     }
@@ -618,6 +758,7 @@ std::string SHA256AutoDetect()
 #if defined(ENABLE_AVX2) && !defined(BUILD_PLACEH_INTERNAL)
     if (have_avx2 && have_avx && enabled_avx) {
         TransformD64_8way = sha256d64_avx2::Transform_8way;
+        TransformLanes_8way = sha256d64_avx2::TransformLanes_8way;
         ret += ",avx2(8way)";
     }
 #endif
@@ -717,3 +858,18 @@ void SHA256D64(unsigned char* out, const unsigned char* in, size_t blocks)
         --blocks;
     }
 }
+
+void SHA256DMany(unsigned char* out, const unsigned char* const* in, const size_t* lengths, size_t count)
+{
+    if (TransformLanes_8way) {
+        SHA256DManyLanes(TransformLanes_8way, 8, out, in, lengths, count);
+    } else if (TransformLanes_4way) {
+        SHA256DManyLanes(TransformLanes_4way, 4, out, in, lengths, count);
+    } else {
+        for (size_t i = 0; i < count; ++i) {
+            unsigned char inner[CSHA256::OUTPUT_SIZE];
+            CSHA256().Write(in[i], lengths[i]).Finalize(inner);
+            CSHA256().Write(inner, sizeof(inner)).Finalize(out + 32 * i);
+        }
+    }
+}
@@ -38,4 +38,13 @@ std::string SHA256AutoDetect();
  */
 void SHA256D64(unsigned char* output, const unsigned char* input, size_t blocks);
 
+/** Compute the double-SHA256's of many independent messages of any length,
+ *  spreading them over the lanes of the 4-way and 8-way kernels when available.
+ *  output:  pointer to a count*32 byte output buffer
+ *  inputs:  pointers to the messages
+ *  lengths: the size in bytes of each message
+ *  count:   the number of messages.
+ */
+void SHA256DMany(unsigned char* output, const unsigned char* const* inputs, const size_t* lengths, size_t count);
+
 #endif // PLACEH_CRYPTO_SHA256_H
@@ -14,7 +14,9 @@
 #include <addrman.h>
 #include <amount.h>
 #include <banman.h>
+#include <blockfilemap.h>
 #include <blockfilter.h>
+#include <blockreadahead.h>
 #include <chain.h>
 #include <chainparams.h>
 #include <compat/sanity.h>
@@ -81,7 +83,11 @@
 #endif
 
 #include <vbk/log.hpp>
+#include <vbk/p2p_sync.hpp>
+#include <vbk/pop_compaction.hpp>
+#include <vbk/pop_mempool_limit.hpp>
 #include <vbk/pop_service.hpp>
+#include <vbk/pop_snapshot.hpp>
 
 static bool fFeeEstimatesInitialized = false;
 static const bool DEFAULT_PROXYRANDOMIZE = true;
@@ -211,6 +217,8 @@ void Shutdown(NodeContext& node)
     // CScheduler/checkqueue threadGroup
     threadGroup.interrupt_all();
     threadGroup.join_all();
+    VeriBlock::StopPopSnapshotValidation();
+    StopBlockReadAhead();
     VeriBlock::StopPop();
 
     // After the threads that potentially access these pointers have been stopped,
@@ -382,17 +390,20 @@ void SetupServerArgs()
 #if HAVE_SYSTEM
     gArgs.AddArg("-blocknotify=<cmd>", "Execute command when the best block changes (%s in cmd is replaced by block hash)", ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
 #endif
+    gArgs.AddArg("-blockreadahead=<n>", strprintf("Read and deserialize up to <n> blocks ahead of the active tip in the background while connecting blocks. This is also the PoP payload prefetch depth: the ATVs, VTBs and VBK blocks of these blocks are kept in memory until they are connected (0 to disable both, max: %d, default: %d)", MAX_BLOCK_READAHEAD, DEFAULT_BLOCK_READAHEAD), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     gArgs.AddArg("-blockreconstructionextratxn=<n>", strprintf("Extra transactions to keep in memory for compact block reconstructions (default: %u)", DEFAULT_BLOCK_RECONSTRUCTION_EXTRA_TXN), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     gArgs.AddArg("-blocksonly", strprintf("Whether to reject transactions from network peers. Transactions from the wallet, RPC and relay whitelisted inbound peers are not affected. (default: %u)", DEFAULT_BLOCKSONLY), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     gArgs.AddArg("-conf=<file>", strprintf("Specify configuration file. Relative paths will be prefixed by datadir location. (default: %s)", PLACEH_CONF_FILENAME), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     gArgs.AddArg("-datadir=<dir>", "Specify data directory", ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     gArgs.AddArg("-dbbatchsize", strprintf("Maximum database write batch size in bytes (default: %u)", nDefaultDbBatchSize), ArgsManager::ALLOW_ANY | ArgsManager::DEBUG_ONLY, OptionsCategory::OPTIONS);
-    gArgs.AddArg("-dbcache=<n>", strprintf("Maximum database cache size <n> MiB (%d to %d, default: %d). In addition, unused mempool memory is shared for this cache (see -maxmempool).", nMinDbCache, nMaxDbCache, nDefaultDbCache), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
+    gArgs.AddArg("-dbcache=<n>", strprintf("Maximum database cache size <n> MiB (%d to %d, default: %d). In addition, unused mempool memory is shared for this cache (see -maxmempool). Memory used by the in-memory PoP block trees is counted against it.", nMinDbCache, nMaxDbCache, nDefaultDbCache), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     gArgs.AddArg("-debuglogfile=<file>", strprintf("Specify location of debug log file. Relative paths will be prefixed by a net-specific datadir location. (-nodebuglogfile to disable; default: %s)", DEFAULT_DEBUGLOGFILE), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     gArgs.AddArg("-feefilter", strprintf("Tell other nodes to filter invs to us by our mempool min fee (default: %u)", DEFAULT_FEEFILTER), ArgsManager::ALLOW_ANY | ArgsManager::DEBUG_ONLY, OptionsCategory::OPTIONS);
     gArgs.AddArg("-includeconf=<file>", "Specify additional configuration file, relative to the -datadir path (only useable from configuration file, not command line)", ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     gArgs.AddArg("-loadblock=<file>", "Imports blocks from external file on startup", ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
+    gArgs.AddArg("-maxmappedblockfiles=<n>", strprintf("Keep up to <n> block files memory-mapped to serve block reads from the page cache (0 to disable, default: %d)", DEFAULT_MAX_MAPPED_BLOCK_FILES), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     gArgs.AddArg("-maxmempool=<n>", strprintf("Keep the transaction memory pool below <n> megabytes (default: %u)", DEFAULT_MAX_MEMPOOL_SIZE), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
+    gArgs.AddArg("-maxpopmempool=<n>", strprintf("Keep the POP memory pool below <n> megabytes (default: %u)", VeriBlock::DEFAULT_MAX_POP_MEMPOOL_SIZE), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     gArgs.AddArg("-maxorphantx=<n>", strprintf("Keep at most <n> unconnectable transactions in memory (default: %u)", DEFAULT_MAX_ORPHAN_TRANSACTIONS), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     gArgs.AddArg("-mempoolexpiry=<n>", strprintf("Do not keep transactions in the mempool longer than <n> hours (default: %u)", DEFAULT_MEMPOOL_EXPIRY), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     gArgs.AddArg("-minimumchainwork=<hex>", strprintf("Minimum work assumed to exist on a valid chain in hex (default: %s, testnet: %s)", defaultChainParams->GetConsensus().nMinimumChainWork.GetHex(), testnetChainParams->GetConsensus().nMinimumChainWork.GetHex()), ArgsManager::ALLOW_ANY | ArgsManager::DEBUG_ONLY, OptionsCategory::OPTIONS);
@@ -433,6 +444,7 @@ void SetupServerArgs()
     gArgs.AddArg("-maxsendbuffer=<n>", strprintf("Maximum per-connection send buffer, <n>*1000 bytes (default: %u)", DEFAULT_MAXSENDBUFFER), ArgsManager::ALLOW_ANY, OptionsCategory::CONNECTION);
     gArgs.AddArg("-maxtimeadjustment", strprintf("Maximum allowed median peer time offset adjustment. Local perspective of time may be influenced by peers forward or backward by this amount. (default: %u seconds)", DEFAULT_MAX_TIME_ADJUSTMENT), ArgsManager::ALLOW_ANY, OptionsCategory::CONNECTION);
     gArgs.AddArg("-maxuploadtarget=<n>", strprintf("Tries to keep outbound traffic under the given target (in MiB per 24h), 0 = no limit (default: %d)", DEFAULT_MAX_UPLOAD_TARGET), ArgsManager::ALLOW_ANY, OptionsCategory::CONNECTION);
+    gArgs.AddArg("-poprelaybandwidth=<n>", strprintf("Serve PoP payloads to each peer at up to <n> kilobytes per second, PoP relay is always queued behind block relay, 0 = no limit (default: %d)", VeriBlock::p2p::DEFAULT_POP_RELAY_BANDWIDTH), ArgsManager::ALLOW_ANY, OptionsCategory::CONNECTION);
     gArgs.AddArg("-onion=<ip:port>", "Use separate SOCKS5 proxy to reach peers via Tor hidden services, set -noonion to disable (default: -proxy)", ArgsManager::ALLOW_ANY, OptionsCategory::CONNECTION);
     gArgs.AddArg("-onlynet=<net>", "Make outgoing connections only through network <net> (ipv4, ipv6 or onion). Incoming connections are not affected by this option. This option can be specified multiple times to allow multiple networks.", ArgsManager::ALLOW_ANY, OptionsCategory::CONNECTION);
     gArgs.AddArg("-peerbloomfilters", strprintf("Support filtering of blocks and transaction with bloom filters (default: %u)", DEFAULT_PEERBLOOMFILTERS), ArgsManager::ALLOW_ANY, OptionsCategory::CONNECTION);
@@ -473,10 +485,18 @@ void SetupServerArgs()
     gArgs.AddArg("-zmqpubhashtx=<address>", "Enable publish hash transaction in <address>", ArgsManager::ALLOW_ANY, OptionsCategory::ZMQ);
     gArgs.AddArg("-zmqpubrawblock=<address>", "Enable publish raw block in <address>", ArgsManager::ALLOW_ANY, OptionsCategory::ZMQ);
     gArgs.AddArg("-zmqpubrawtx=<address>", "Enable publish raw transaction in <address>", ArgsManager::ALLOW_ANY, OptionsCategory::ZMQ);
+    gArgs.AddArg("-zmqpubhashatv=<address>", "Enable publish hash of ATVs accepted to POP mempool in <address>", ArgsManager::ALLOW_ANY, OptionsCategory::ZMQ);
+    gArgs.AddArg("-zmqpubhashvtb=<address>", "Enable publish hash of VTBs accepted to POP mempool in <address>", ArgsManager::ALLOW_ANY, OptionsCategory::ZMQ);
+    gArgs.AddArg("-zmqpubrawvbkblock=<address>", "Enable publish raw VBK blocks accepted to POP mempool in <address>", ArgsManager::ALLOW_ANY, OptionsCategory::ZMQ);
+    gArgs.AddArg("-zmqpubhashpoptip=<address>", "Enable publish VBK and BTC tip hashes when they change in <address>", ArgsManager::ALLOW_ANY, OptionsCategory::ZMQ);
     gArgs.AddArg("-zmqpubhashblockhwm=<n>", strprintf("Set publish hash block outbound message high water mark (default: %d)", CZMQAbstractNotifier::DEFAULT_ZMQ_SNDHWM), ArgsManager::ALLOW_ANY, OptionsCategory::ZMQ);
     gArgs.AddArg("-zmqpubhashtxhwm=<n>", strprintf("Set publish hash transaction outbound message high water mark (default: %d)", CZMQAbstractNotifier::DEFAULT_ZMQ_SNDHWM), ArgsManager::ALLOW_ANY, OptionsCategory::ZMQ);
     gArgs.AddArg("-zmqpubrawblockhwm=<n>", strprintf("Set publish raw block outbound message high water mark (default: %d)", CZMQAbstractNotifier::DEFAULT_ZMQ_SNDHWM), ArgsManager::ALLOW_ANY, OptionsCategory::ZMQ);
     gArgs.AddArg("-zmqpubrawtxhwm=<n>", strprintf("Set publish raw transaction outbound message high water mark (default: %d)", CZMQAbstractNotifier::DEFAULT_ZMQ_SNDHWM), ArgsManager::ALLOW_ANY, OptionsCategory::ZMQ);
+    gArgs.AddArg("-zmqpubhashatvhwm=<n>", strprintf("Set publish hash ATV outbound message high water mark (default: %d)", CZMQAbstractNotifier::DEFAULT_ZMQ_SNDHWM), ArgsManager::ALLOW_ANY, OptionsCategory::ZMQ);
+    gArgs.AddArg("-zmqpubhashvtbhwm=<n>", strprintf("Set publish hash VTB outbound message high water mark (default: %d)", CZMQAbstractNotifier::DEFAULT_ZMQ_SNDHWM), ArgsManager::ALLOW_ANY, OptionsCategory::ZMQ);
+    gArgs.AddArg("-zmqpubrawvbkblockhwm=<n>", strprintf("Set publish raw VBK block outbound message high water mark (default: %d)", CZMQAbstractNotifier::DEFAULT_ZMQ_SNDHWM), ArgsManager::ALLOW_ANY, OptionsCategory::ZMQ);
+    gArgs.AddArg("-zmqpubhashpoptiphwm=<n>", strprintf("Set publish hash PoP tip outbound message high water mark (default: %d)", CZMQAbstractNotifier::DEFAULT_ZMQ_SNDHWM), ArgsManager::ALLOW_ANY, OptionsCategory::ZMQ);
 #else
     hidden_args.emplace_back("-zmqpubhashblock=<address>");
     hidden_args.emplace_back("-zmqpubhashtx=<address>");
@@ -486,6 +506,14 @@ void SetupServerArgs()
     hidden_args.emplace_back("-zmqpubhashtxhwm=<n>");
     hidden_args.emplace_back("-zmqpubrawblockhwm=<n>");
     hidden_args.emplace_back("-zmqpubrawtxhwm=<n>");
+    hidden_args.emplace_back("-zmqpubhashatv=<address>");
+    hidden_args.emplace_back("-zmqpubhashvtb=<address>");
+    hidden_args.emplace_back("-zmqpubrawvbkblock=<address>");
+    hidden_args.emplace_back("-zmqpubhashpoptip=<address>");
+    hidden_args.emplace_back("-zmqpubhashatvhwm=<n>");
+    hidden_args.emplace_back("-zmqpubhashvtbhwm=<n>");
+    hidden_args.emplace_back("-zmqpubrawvbkblockhwm=<n>");
+    hidden_args.emplace_back("-zmqpubhashpoptiphwm=<n>");
 #endif
 
     gArgs.AddArg("-checkblocks=<n>", strprintf("How many blocks to check at startup (default: %u, 0 = all)", DEFAULT_CHECKBLOCKS), ArgsManager::ALLOW_ANY | ArgsManager::DEBUG_ONLY, OptionsCategory::DEBUG_TEST);
@@ -1061,6 +1089,19 @@ bool AppInitParameterInteraction()
     int64_t nMempoolSizeMin = gArgs.GetArg("-limitdescendantsize", DEFAULT_DESCENDANT_SIZE_LIMIT) * 1000 * 40;
     if (nMempoolSizeMax < 0 || nMempoolSizeMax < nMempoolSizeMin)
         return InitError(strprintf(_("-maxmempool must be at least %d MB").translated, std::ceil(nMempoolSizeMin / 1000000.0)));
+    if (gArgs.GetArg("-maxpopmempool", VeriBlock::DEFAULT_MAX_POP_MEMPOOL_SIZE) < 1)
+        return InitError(_("-maxpopmempool must be at least 1 MB").translated);
+    const int64_t nBlockReadAhead = gArgs.GetArg("-blockreadahead", DEFAULT_BLOCK_READAHEAD);
+    if (nBlockReadAhead < 0 || nBlockReadAhead > MAX_BLOCK_READAHEAD)
+        return InitError(strprintf(_("-blockreadahead must be between 0 and %d").translated, MAX_BLOCK_READAHEAD));
+    const int64_t nMaxMappedBlockFiles = gArgs.GetArg("-maxmappedblockfiles", DEFAULT_MAX_MAPPED_BLOCK_FILES);
+    if (nMaxMappedBlockFiles < 0)
+        return InitError(_("-maxmappedblockfiles must not be negative").translated);
+    SetMaxMappedBlockFiles(nMaxMappedBlockFiles);
+    const int64_t popRelayBandwidth = gArgs.GetArg("-poprelaybandwidth", VeriBlock::p2p::DEFAULT_POP_RELAY_BANDWIDTH);
+    if (popRelayBandwidth < 0)
+        return InitError(_("-poprelaybandwidth must not be negative").translated);
+    VeriBlock::p2p::SetPopRelayBandwidth(popRelayBandwidth * 1000);
     // incremental relay fee sets the minimum feerate increase necessary for BIP 125 replacement in the mempool
     // and the amount the mempool min fee increases above the feerate of txs evicted due to mempool limiting.
     if (gArgs.IsArgSet("-incrementalrelayfee"))
@@ -1277,6 +1318,24 @@ bool AppInitMain(NodeContext& node)
         for (int i = 0; i < script_threads; ++i) {
             threadGroup.create_thread([i]() { return ThreadScriptCheck(i); });
         }
+        // Transactions and merkle roots of blocks are checked by as many threads as scripts
+        g_parallel_block_checks = true;
+        for (int i = 0; i < script_threads; ++i) {
+            threadGroup.create_thread([i]() { return ThreadBlockCheck(i); });
+        }
+        // The coins spent by a block are read by as many threads as scripts are checked, with the calling thread
+        g_parallel_coins_reads = true;
+        for (int i = 0; i < std::min(script_threads, MAX_COINS_READ_THREADS - 1); ++i) {
+            threadGroup.create_thread([i]() { return ThreadCoinsRead(i); });
+        }
+    }
+
+    // Blocks read by -reindex and -loadblock are deserialized by as many threads as scripts are checked
+    if (script_threads >= 1 && (gArgs.GetBoolArg("-reindex", false) || gArgs.IsArgSet("-loadblock"))) {
+        g_parallel_block_parse = true;
+        for (int i = 0; i < script_threads; ++i) {
+            threadGroup.create_thread([i]() { return ThreadBlockParse(i); });
+        }
     }
 
     // Start the lightweight task scheduler thread
@@ -1499,6 +1558,11 @@ bool AppInitMain(NodeContext& node)
                 pblocktree.reset();
                 pblocktree.reset(new CBlockTreeDB(nBlockTreeDBCache, false, fReset));
                 VeriBlock::SetPop(*pblocktree);
+#if ENABLE_ZMQ
+                if (g_zmq_notification_interface) {
+                    g_zmq_notification_interface->RegisterPopMempool(*VeriBlock::GetPop().mempool);
+                }
+#endif
 
                 if (fReset) {
                     pblocktree->WriteReindexing(true);
@@ -1741,6 +1805,8 @@ bool AppInitMain(NodeContext& node)
         vImportFiles.push_back(strFile);
     }
 
+    StartBlockReadAhead(gArgs.GetArg("-blockreadahead", DEFAULT_BLOCK_READAHEAD));
+
     threadGroup.create_thread(std::bind(&ThreadImport, vImportFiles));
 
     // Wait for genesis block to be processed
@@ -1864,5 +1930,10 @@ bool AppInitMain(NodeContext& node)
         LogPrintf("PHL tree best height = %d\n", pop.altTree->btc().getBestChain().tip()->getHeight());
     }
 
+    // Drop stale PoP forks that can no longer become active
+    scheduler.scheduleEvery([] {
+        VeriBlock::CompactPopTrees();
+    }, VeriBlock::POP_COMPACTION_INTERVAL * 1000);
+
     return true;
 }
@@ -718,11 +718,17 @@ CNetMessage V1TransportDeserializer::GetMessage(const CMessageHeader::MessageSta
 
 size_t CConnman::SocketSendData(CNode *pnode) const EXCLUSIVE_LOCKS_REQUIRED(pnode->cs_vSend)
 {
-    auto it = pnode->vSendMsg.begin();
     size_t nSentSize = 0;
 
-    while (it != pnode->vSendMsg.end()) {
-        const auto &data = *it;
+    while (true) {
+        if (pnode->vSendMsg.empty()) {
+            if (pnode->vSendMsgLowPriority.empty())
+                break;
+            // everything queued ahead of it is on the wire, release the next low priority message
+            pnode->vSendMsg.push_back(std::move(pnode->vSendMsgLowPriority.front()));
+            pnode->vSendMsgLowPriority.pop_front();
+        }
+        const auto &data = pnode->vSendMsg.front();
         assert(data.size() > pnode->nSendOffset);
         int nBytes = 0;
         {
@@ -740,7 +746,7 @@ size_t CConnman::SocketSendData(CNode *pnode) const EXCLUSIVE_LOCKS_REQUIRED(pno
                 pnode->nSendOffset = 0;
                 pnode->nSendSize -= data.size();
                 pnode->fPauseSend = pnode->nSendSize > nSendBufferMaxSize;
-                it++;
+                pnode->vSendMsg.pop_front();
             } else {
                 // could not send full message; stop sending more
                 break;
@@ -760,11 +766,11 @@ size_t CConnman::SocketSendData(CNode *pnode) const EXCLUSIVE_LOCKS_REQUIRED(pno
         }
     }
 
-    if (it == pnode->vSendMsg.end()) {
+    if (pnode->vSendMsg.empty()) {
+        assert(pnode->vSendMsgLowPriority.empty());
         assert(pnode->nSendOffset == 0);
         assert(pnode->nSendSize == 0);
     }
-    pnode->vSendMsg.erase(pnode->vSendMsg.begin(), it);
     return nSentSize;
 }
 
@@ -2715,7 +2721,7 @@ bool CConnman::NodeFullyConnected(const CNode* pnode)
     return pnode && pnode->fSuccessfullyConnected && !pnode->fDisconnect;
 }
 
-void CConnman::PushMessage(CNode* pnode, CSerializedNetMsg&& msg)
+void CConnman::PushMessage(CNode* pnode, CSerializedNetMsg&& msg, bool fLowPriority)
 {
     size_t nMessageSize = msg.data.size();
     size_t nTotalSize = nMessageSize + CMessageHeader::HEADER_SIZE;
@@ -2740,6 +2746,12 @@ void CConnman::PushMessage(CNode* pnode, CSerializedNetMsg&& msg)
 
         if (pnode->nSendSize > nSendBufferMaxSize)
             pnode->fPauseSend = true;
+        if (fLowPriority && !optimisticSend) {
+            // keep header and payload together, regular messages may be queued in between later
+            serializedHeader.insert(serializedHeader.end(), msg.data.begin(), msg.data.end());
+            pnode->vSendMsgLowPriority.push_back(std::move(serializedHeader));
+            return;
+        }
         pnode->vSendMsg.push_back(std::move(serializedHeader));
         if (nMessageSize)
             pnode->vSendMsg.push_back(std::move(msg.data));
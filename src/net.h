@@ -207,7 +207,13 @@ public:
 
     bool ForNode(NodeId id, std::function<bool(CNode* pnode)> func);
 
-    void PushMessage(CNode* pnode, CSerializedNetMsg&& msg);
+    /**
+     * Queue a message for sending. Low priority messages wait until every
+     * message queued before them has been written to the socket, so that
+     * regular messages (blocks, compact blocks, headers) pushed later overtake
+     * them.
+     */
+    void PushMessage(CNode* pnode, CSerializedNetMsg&& msg, bool fLowPriority = false);
 
     template<typename Callable>
     void ForEachNode(Callable&& func)
@@ -709,10 +715,12 @@ public:
     // socket
     std::atomic<ServiceFlags> nServices{NODE_NONE};
     SOCKET hSocket GUARDED_BY(cs_hSocket);
-    size_t nSendSize{0}; // total size of all vSendMsg entries
+    size_t nSendSize{0}; // total size of all vSendMsg and vSendMsgLowPriority entries
     size_t nSendOffset{0}; // offset inside the first vSendMsg already sent
     uint64_t nSendBytes GUARDED_BY(cs_vSend){0};
     std::deque<std::vector<unsigned char>> vSendMsg GUARDED_BY(cs_vSend);
+    // whole low priority messages (header and payload), moved to vSendMsg one at a time once it drains
+    std::deque<std::vector<unsigned char>> vSendMsgLowPriority GUARDED_BY(cs_vSend);
     CCriticalSection cs_vSend;
     CCriticalSection cs_hSocket;
     CCriticalSection cs_vRecv;
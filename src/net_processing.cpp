@@ -1480,7 +1480,11 @@ void static ProcessGetBlockData(CNode* pfrom, const CChainParams& chainparams, c
             if (!ReadRawBlockFromDisk(block_data, pindex, chainparams.MessageStart())) {
                 assert(!"cannot load block from disk");
             }
-            connman->PushMessage(pfrom, msgMaker.Make(NetMsgType::BLOCK, MakeSpan(block_data)));
+            // The bytes read are the message payload, hand them over without another copy
+            CSerializedNetMsg msg;
+            msg.command = NetMsgType::BLOCK;
+            msg.data = std::move(block_data);
+            connman->PushMessage(pfrom, std::move(msg));
             // Don't set pblock as we've sent the block
         } else {
             // Send block from disk
@@ -3987,8 +3991,9 @@ bool PeerLogicValidation::SendMessages(CNode* pto)
         if (!vInv.empty())
             connman->PushMessage(pto, msgMaker.Make(NetMsgType::INV, vInv));
 
-        // VeriBlock offer Pop Data
+        // VeriBlock serve requested Pop Data as the relay budget allows, then offer Pop Data
         {
+            VeriBlock::p2p::sendPopData(pto, connman);
             VeriBlock::p2p::offerPopData<altintegration::ATV>(pto, connman, msgMaker);
             VeriBlock::p2p::offerPopData<altintegration::VTB>(pto, connman, msgMaker);
             VeriBlock::p2p::offerPopData<altintegration::VbkBlock>(pto, connman, msgMaker);
@@ -8,11 +8,68 @@
 #include "logging.h"
 #include <arith_uint256.h>
 #include <chain.h>
+#include <crypto/common.h>
 #include <primitives/block.h>
 #include <uint256.h>
 #include "chainparams.h"
 
-unsigned int static DarkGravityWave(const CBlockIndex* pindexLast, const CBlockHeader *pblock, const Consensus::Params& params) {
+namespace {
+
+/**
+ * 256-bit accumulator for the DGW target average. Wraps around exactly like
+ * arith_uint256, but multiplies and divides by 32-bit factors word by word
+ * instead of going through arith_uint256's bit by bit long division.
+ */
+class DgwTargetAverage
+{
+public:
+    explicit DgwTargetAverage(const arith_uint256& value)
+    {
+        const uint256 le = ArithToUint256(value);
+        for (int i = 0; i < WIDTH; i++)
+            pn[i] = ReadLE32(le.begin() + 4 * i);
+    }
+
+    arith_uint256 get() const
+    {
+        uint256 le;
+        for (int i = 0; i < WIDTH; i++)
+            WriteLE32(le.begin() + 4 * i, pn[i]);
+        return UintToArith256(le);
+    }
+
+    //! (*this * nCount + target) / (nCount + 1), as in the original DGW formula
+    void add(const DgwTargetAverage& target, uint32_t nCount)
+    {
+        uint64_t carry = 0;
+        for (int i = 0; i < WIDTH; i++) {
+            uint64_t n = carry + (uint64_t)pn[i] * nCount;
+            pn[i] = n & 0xffffffff;
+            carry = n >> 32;
+        }
+        carry = 0;
+        for (int i = 0; i < WIDTH; i++) {
+            uint64_t n = carry + pn[i] + target.pn[i];
+            pn[i] = n & 0xffffffff;
+            carry = n >> 32;
+        }
+        const uint64_t nDivisor = (uint64_t)nCount + 1;
+        uint64_t rem = 0;
+        for (int i = WIDTH - 1; i >= 0; i--) {
+            uint64_t n = (rem << 32) | pn[i];
+            pn[i] = n / nDivisor;
+            rem = n % nDivisor;
+        }
+    }
+
+private:
+    static constexpr int WIDTH = 256 / 32;
+    uint32_t pn[WIDTH];
+};
+
+} // namespace
+
+unsigned int DarkGravityWave(const CBlockIndex* pindexLast, const CBlockHeader *pblock, const Consensus::Params& params) {
     /* current difficulty formula, dash - DarkGravity v3, written by Evan Duffield - evan@dash.org */
     assert(pindexLast != nullptr);
 
@@ -42,15 +99,12 @@ unsigned int static DarkGravityWave(const CBlockIndex* pindexLast, const CBlockH
     }
 
     const CBlockIndex *pindex = pindexLast;
-    arith_uint256 bnPastTargetAvg;
+    DgwTargetAverage bnPastTargetAvg(arith_uint256().SetCompact(pindex->nBits));
 
     for (unsigned int nCountBlocks = 1; nCountBlocks <= nPastBlocks; nCountBlocks++) {
-        arith_uint256 bnTarget = arith_uint256().SetCompact(pindex->nBits);
-        if (nCountBlocks == 1) {
-            bnPastTargetAvg = bnTarget;
-        } else {
+        if (nCountBlocks != 1) {
             // NOTE: that's not an average really...
-            bnPastTargetAvg = (bnPastTargetAvg * nCountBlocks + bnTarget) / (nCountBlocks + 1);
+            bnPastTargetAvg.add(DgwTargetAverage(arith_uint256().SetCompact(pindex->nBits)), nCountBlocks);
         }
 
         if(nCountBlocks != nPastBlocks) {
@@ -59,7 +113,7 @@ unsigned int static DarkGravityWave(const CBlockIndex* pindexLast, const CBlockH
         }
     }
 
-    arith_uint256 bnNew(bnPastTargetAvg);
+    arith_uint256 bnNew(bnPastTargetAvg.get());
 
     int64_t nActualTimespan = pindexLast->GetBlockTime() - pindex->GetBlockTime();
     // NOTE: is this accurate? nActualTimespan counts it for (nPastBlocks - 1) blocks only...
@@ -119,19 +173,25 @@ unsigned int GetNextWorkRequiredBTC(const CBlockIndex* pindexLast, const CBlockH
 
 unsigned int GetNextWorkRequired(const CBlockIndex* pindexLast, const CBlockHeader* pblock, const Consensus::Params& params)
 {
-    auto dgw = DarkGravityWave(pindexLast, pblock, params);
-    auto btc = GetNextWorkRequiredBTC(pindexLast, pblock, params);
+    const bool fDGW = Params().IsDGWActive(pindexLast->nHeight + 1);
+    const unsigned int nBits = fDGW ? DarkGravityWave(pindexLast, pblock, params) : GetNextWorkRequiredBTC(pindexLast, pblock, params);
+    if (!LogAcceptCategory(BCLog::NET)) {
+        return nBits;
+    }
+
+    // the inactive algorithm is only evaluated for the comparison below
+    auto dgw = fDGW ? nBits : DarkGravityWave(pindexLast, pblock, params);
+    auto btc = fDGW ? GetNextWorkRequiredBTC(pindexLast, pblock, params) : nBits;
     int64_t nPrevBlockTime = (pindexLast->pprev ? pindexLast->pprev->GetBlockTime() : pindexLast->GetBlockTime());
 
-    if (Params().IsDGWActive(pindexLast->nHeight + 1)) {
+    if (fDGW) {
         LogPrint(BCLog::NET, "Block %s - version: %s: found next work required using DGW: [%s] (BTC would have been [%s]\t(%+d)\t(%0.3f%%)\t(%s sec))\n",
             pindexLast->nHeight + 1, pblock->nVersion, dgw, btc, btc - dgw, (float)(btc - dgw) * 100.0 / (float)dgw, pindexLast->GetBlockTime() - nPrevBlockTime);
-        return dgw;
     } else {
         LogPrint(BCLog::NET, "Block %s - version: %s: found next work required using BTC: [%s] (DGW would have been [%s]\t(%+d)\t(%0.3f%%)\t(%s sec))\n",
             pindexLast->nHeight + 1, pblock->nVersion, btc, dgw, dgw - btc, (float)(dgw - btc) * 100.0 / (float)btc, pindexLast->GetBlockTime() - nPrevBlockTime);
-        return btc;
     }
+    return nBits;
 }
 
 unsigned int CalculateNextWorkRequired(const CBlockIndex* pindexLast, int64_t nFirstBlockTime, const Consensus::Params& params)
@@ -99,12 +99,25 @@ public:
     template <typename Stream, typename Operation>
     inline void SerializationOp(Stream& s, Operation ser_action) {
         READWRITEAS(CBlockHeader, *this);
-        READWRITE(vtx);
+        SerializeTransactions(s, ser_action);
         if (this->nVersion & VeriBlock::POP_BLOCK_VERSION_BIT) {
             READWRITE(popData);
         }
     }
 
+    template <typename Stream>
+    inline void SerializeTransactions(Stream& s, CSerActionSerialize ser_action) {
+        READWRITE(vtx);
+    }
+
+    /** Hash all transactions together once they are read, see MakeTransactionRefs. */
+    template <typename Stream>
+    inline void SerializeTransactions(Stream& s, CSerActionUnserialize ser_action) {
+        std::vector<CMutableTransaction> txs;
+        READWRITE(txs);
+        vtx = MakeTransactionRefs(std::move(txs));
+    }
+
     void SetNull()
     {
         CBlockHeader::SetNull();
@@ -5,7 +5,9 @@
 
 #include <primitives/transaction.h>
 
+#include <crypto/sha256.h>
 #include <hash.h>
+#include <streams.h>
 #include <tinyformat.h>
 #include <util/strencodings.h>
 
@@ -79,6 +81,49 @@ uint256 CTransaction::ComputeWitnessHash() const
 CTransaction::CTransaction() : vin(), vout(), nVersion(CTransaction::CURRENT_VERSION), nLockTime(0), hash{}, m_witness_hash{} {}
 CTransaction::CTransaction(const CMutableTransaction& tx) : vin(tx.vin), vout(tx.vout), nVersion(tx.nVersion), nLockTime(tx.nLockTime), hash{ComputeHash()}, m_witness_hash{ComputeWitnessHash()} {}
 CTransaction::CTransaction(CMutableTransaction&& tx) : vin(std::move(tx.vin)), vout(std::move(tx.vout)), nVersion(tx.nVersion), nLockTime(tx.nLockTime), hash{ComputeHash()}, m_witness_hash{ComputeWitnessHash()} {}
+CTransaction::CTransaction(CMutableTransaction&& tx, const uint256& hashIn, const uint256& witnessHashIn) : vin(std::move(tx.vin)), vout(std::move(tx.vout)), nVersion(tx.nVersion), nLockTime(tx.nLockTime), hash{hashIn}, m_witness_hash{witnessHashIn} {}
+
+std::vector<CTransactionRef> MakeTransactionRefs(std::vector<CMutableTransaction>&& txs)
+{
+    static_assert(sizeof(uint256) == CSHA256::OUTPUT_SIZE, "hashes are written directly into uint256s");
+    if (txs.empty()) return {};
+
+    // Serialize everything that has to be hashed into one buffer: the encoding
+    // without witness of every transaction, plus the full encoding of those
+    // that have a witness. Transactions without witness share the txid.
+    std::vector<unsigned char> buffer;
+    std::vector<size_t> offsets{0};
+    //! index of the message of the txid and of the wtxid of each transaction
+    std::vector<std::pair<size_t, size_t>> tx_messages(txs.size());
+    offsets.reserve(2 * txs.size() + 1);
+    for (size_t i = 0; i < txs.size(); i++) {
+        CVectorWriter(SER_GETHASH, SERIALIZE_TRANSACTION_NO_WITNESS, buffer, buffer.size(), txs[i]);
+        offsets.push_back(buffer.size());
+        tx_messages[i].first = tx_messages[i].second = offsets.size() - 2;
+        if (txs[i].HasWitness()) {
+            CVectorWriter(SER_GETHASH, 0, buffer, buffer.size(), txs[i]);
+            offsets.push_back(buffer.size());
+            tx_messages[i].second = offsets.size() - 2;
+        }
+    }
+
+    const size_t messages = offsets.size() - 1;
+    std::vector<const unsigned char*> inputs(messages);
+    std::vector<size_t> lengths(messages);
+    for (size_t i = 0; i < messages; i++) {
+        inputs[i] = buffer.data() + offsets[i];
+        lengths[i] = offsets[i + 1] - offsets[i];
+    }
+    std::vector<uint256> hashes(messages);
+    SHA256DMany(hashes.data()->begin(), inputs.data(), lengths.data(), messages);
+
+    std::vector<CTransactionRef> ret;
+    ret.reserve(txs.size());
+    for (size_t i = 0; i < txs.size(); i++) {
+        ret.emplace_back(new CTransaction(std::move(txs[i]), hashes[tx_messages[i].first], hashes[tx_messages[i].second]));
+    }
+    return ret;
+}
 
 CAmount CTransaction::GetValueOut() const
 {
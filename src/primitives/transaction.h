@@ -297,6 +297,10 @@ private:
     uint256 ComputeHash() const;
     uint256 ComputeWitnessHash() const;
 
+    /** Take over tx with hashes that were already computed for it, see MakeTransactionRefs. */
+    CTransaction(CMutableTransaction&& tx, const uint256& hashIn, const uint256& witnessHashIn);
+    friend std::vector<std::shared_ptr<const CTransaction>> MakeTransactionRefs(std::vector<CMutableTransaction>&& txs);
+
 public:
     /** Construct a CTransaction that qualifies as IsNull() */
     CTransaction();
@@ -409,4 +413,11 @@ typedef std::shared_ptr<const CTransaction> CTransactionRef;
 static inline CTransactionRef MakeTransactionRef() { return std::make_shared<const CTransaction>(); }
 template <typename Tx> static inline CTransactionRef MakeTransactionRef(Tx&& txIn) { return std::make_shared<const CTransaction>(std::forward<Tx>(txIn)); }
 
+/**
+ * Convert many transactions at once, e.g. all transactions of a block. The
+ * txids and wtxids are computed together with SHA256DMany instead of one
+ * transaction after the other.
+ */
+std::vector<CTransactionRef> MakeTransactionRefs(std::vector<CMutableTransaction>&& txs);
+
 #endif // PLACEH_PRIMITIVES_TRANSACTION_H
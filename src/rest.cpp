@@ -20,6 +20,8 @@
 #include <util/check.h>
 #include <util/strencodings.h>
 #include <validation.h>
+#include <vbk/adaptors/univalue_json.hpp>
+#include <vbk/pop_service.hpp>
 #include <version.h>
 
 #include <boost/algorithm/string.hpp>
@@ -27,6 +29,7 @@
 #include <univalue.h>
 
 static const size_t MAX_GETUTXOS_OUTPOINTS = 15; //allow a max of 15 outpoints to be queried at once
+static const long MAX_POP_HEADERS_RESULTS = 2000; //allow a max of 2000 VBK headers to be queried at once
 
 enum class RetFormat {
     UNDEF,
@@ -646,6 +649,222 @@ static bool rest_blockhash_by_height(HTTPRequest* req,
     }
 }
 
+static void WritePopBytes(HTTPRequest* req, RetFormat rf, const std::vector<uint8_t>& bytes)
+{
+    if (rf == RetFormat::BINARY) {
+        req->WriteHeader("Content-Type", "application/octet-stream");
+        req->WriteReply(HTTP_OK, std::string(bytes.begin(), bytes.end()));
+    } else {
+        req->WriteHeader("Content-Type", "text/plain");
+        req->WriteReply(HTTP_OK, HexStr(bytes) + "\n");
+    }
+}
+
+static void WritePopJSON(HTTPRequest* req, const UniValue& json)
+{
+    req->WriteHeader("Content-Type", "application/json");
+    req->WriteReply(HTTP_OK, json.write() + "\n");
+}
+
+template <typename Id>
+static bool ParsePopId(const std::string& str, Id& id)
+{
+    if (str.size() != 2 * Id().size() || !IsHex(str)) {
+        return false;
+    }
+    id = Id::fromHex(str);
+    return true;
+}
+
+/**
+ * Serve an ATV or VTB from the POP mempool or, if it is not there, from the
+ * payloads store. Binary output is the payload's VBK encoding.
+ */
+template <typename T>
+static bool rest_pop_payload(HTTPRequest* req, const std::string& strURIPart, char dbPrefix)
+{
+    if (!CheckWarmup(req))
+        return false;
+    std::string idStr;
+    const RetFormat rf = ParseDataFormat(idStr, strURIPart);
+
+    typename T::id_t id;
+    if (!ParsePopId(idStr, id))
+        return RESTERR(req, HTTP_BAD_REQUEST, "Invalid id: " + SanitizeString(idStr));
+
+    std::vector<T> payloads;
+    {
+        LOCK(cs_main);
+        altintegration::ValidationState state;
+        if (!VeriBlock::GetPayloadsProvider().getPayloads<T>(dbPrefix, {id}, payloads, state))
+            return RESTERR(req, HTTP_NOT_FOUND, idStr + " not found");
+    }
+
+    switch (rf) {
+    case RetFormat::BINARY:
+    case RetFormat::HEX: {
+        WritePopBytes(req, rf, payloads[0].toVbkEncoding());
+        return true;
+    }
+    case RetFormat::JSON: {
+        WritePopJSON(req, altintegration::ToJSON<UniValue>(payloads[0]));
+        return true;
+    }
+    default: {
+        return RESTERR(req, HTTP_NOT_FOUND, "output format not found (available: " + AvailableDataFormatsString() + ")");
+    }
+    }
+}
+
+static bool rest_pop_atv(HTTPRequest* req, const std::string& strURIPart)
+{
+    return rest_pop_payload<altintegration::ATV>(req, strURIPart, VeriBlock::DB_ATV_PREFIX);
+}
+
+static bool rest_pop_vtb(HTTPRequest* req, const std::string& strURIPart)
+{
+    return rest_pop_payload<altintegration::VTB>(req, strURIPart, VeriBlock::DB_VTB_PREFIX);
+}
+
+static bool rest_pop_vbkheaders(HTTPRequest* req, const std::string& strURIPart)
+{
+    if (!CheckWarmup(req))
+        return false;
+    std::string param;
+    const RetFormat rf = ParseDataFormat(param, strURIPart);
+    std::vector<std::string> path;
+    boost::split(path, param, boost::is_any_of("/"));
+
+    if (path.size() != 2)
+        return RESTERR(req, HTTP_BAD_REQUEST, "No header count specified. Use /rest/pop/vbkheaders/<hash>/<count>.<ext>.");
+
+    altintegration::VbkBlock::hash_t hash;
+    if (!ParsePopId(path[0], hash))
+        return RESTERR(req, HTTP_BAD_REQUEST, "Invalid hash: " + SanitizeString(path[0]));
+
+    long count = strtol(path[1].c_str(), nullptr, 10);
+    if (count < 1 || count > MAX_POP_HEADERS_RESULTS)
+        return RESTERR(req, HTTP_BAD_REQUEST, "Header count out of range: " + SanitizeString(path[1]));
+
+    // copy the headers, the tree may change once cs_main is released
+    std::vector<altintegration::VbkBlock> headers;
+    headers.reserve(count);
+    {
+        LOCK(cs_main);
+        auto& tree = VeriBlock::GetPop().altTree->vbk();
+        const auto& best = tree.getBestChain();
+        const auto* index = tree.getBlockIndex(hash);
+        while (index != nullptr && best.contains(index)) {
+            headers.push_back(index->getHeader());
+            if (headers.size() == (unsigned long)count)
+                break;
+            index = best[index->getHeight() + 1];
+        }
+    }
+
+    switch (rf) {
+    case RetFormat::BINARY:
+    case RetFormat::HEX: {
+        std::vector<uint8_t> bytes;
+        for (const auto& header : headers) {
+            auto raw = header.toRaw();
+            bytes.insert(bytes.end(), raw.begin(), raw.end());
+        }
+        WritePopBytes(req, rf, bytes);
+        return true;
+    }
+    case RetFormat::JSON: {
+        UniValue jsonHeaders(UniValue::VARR);
+        for (const auto& header : headers) {
+            jsonHeaders.push_back(altintegration::ToJSON<UniValue>(header));
+        }
+        WritePopJSON(req, jsonHeaders);
+        return true;
+    }
+    default: {
+        return RESTERR(req, HTTP_NOT_FOUND, "output format not found (available: " + AvailableDataFormatsString() + ")");
+    }
+    }
+}
+
+template <typename Id>
+static UniValue PopMempoolIdsToJSON(const std::vector<Id>& ids)
+{
+    UniValue out(UniValue::VARR);
+    for (const auto& id : ids) {
+        out.push_back(id.toHex());
+    }
+    return out;
+}
+
+template <typename Id>
+static std::vector<std::vector<uint8_t>> PopMempoolIdsToBytes(const std::vector<Id>& ids)
+{
+    std::vector<std::vector<uint8_t>> out;
+    out.reserve(ids.size());
+    for (const auto& id : ids) {
+        out.push_back(id.asVector());
+    }
+    return out;
+}
+
+static bool rest_pop_mempool(HTTPRequest* req, const std::string& strURIPart)
+{
+    if (!CheckWarmup(req))
+        return false;
+    std::string param;
+    const RetFormat rf = ParseDataFormat(param, strURIPart);
+
+    // /rest/pop/mempool[/<count>[/<cursor>]].<ext>
+    std::vector<std::string> path;
+    if (!param.empty()) {
+        if (param[0] != '/')
+            return RESTERR(req, HTTP_NOT_FOUND, "Use /rest/pop/mempool/<count>/<cursor>.<ext>");
+        const std::string parts = param.substr(1);
+        boost::split(path, parts, boost::is_any_of("/"));
+    }
+    if (path.size() > 2)
+        return RESTERR(req, HTTP_BAD_REQUEST, "Use /rest/pop/mempool/<count>/<cursor>.<ext>");
+
+    long count = VeriBlock::DEFAULT_POP_MEMPOOL_PAGE_SIZE;
+    if (!path.empty()) {
+        count = strtol(path[0].c_str(), nullptr, 10);
+        if (count < 1 || count > VeriBlock::MAX_POP_MEMPOOL_PAGE_SIZE)
+            return RESTERR(req, HTTP_BAD_REQUEST, "Count out of range: " + SanitizeString(path[0]));
+    }
+    const std::string cursor = path.size() == 2 ? path[1] : "";
+
+    VeriBlock::PopMempoolPage page;
+    {
+        LOCK(cs_main);
+        std::string error;
+        if (!VeriBlock::getPopMempoolPage(cursor, count, page, error))
+            return RESTERR(req, HTTP_BAD_REQUEST, SanitizeString(error));
+    }
+
+    switch (rf) {
+    case RetFormat::BINARY:
+    case RetFormat::HEX: {
+        CDataStream ssPage(SER_NETWORK, PROTOCOL_VERSION);
+        ssPage << PopMempoolIdsToBytes(page.vbkblocks) << PopMempoolIdsToBytes(page.vtbs) << PopMempoolIdsToBytes(page.atvs) << page.next;
+        WritePopBytes(req, rf, std::vector<uint8_t>(ssPage.begin(), ssPage.end()));
+        return true;
+    }
+    case RetFormat::JSON: {
+        UniValue result(UniValue::VOBJ);
+        result.pushKV("vbkblocks", PopMempoolIdsToJSON(page.vbkblocks));
+        result.pushKV("vtbs", PopMempoolIdsToJSON(page.vtbs));
+        result.pushKV("atvs", PopMempoolIdsToJSON(page.atvs));
+        result.pushKV("cursor", page.next.empty() ? UniValue(UniValue::VNULL) : UniValue(page.next));
+        WritePopJSON(req, result);
+        return true;
+    }
+    default: {
+        return RESTERR(req, HTTP_NOT_FOUND, "output format not found (available: " + AvailableDataFormatsString() + ")");
+    }
+    }
+}
+
 static const struct {
     const char* prefix;
     bool (*handler)(HTTPRequest* req, const std::string& strReq);
@@ -659,6 +878,10 @@ static const struct {
       {"/rest/headers/", rest_headers},
       {"/rest/getutxos", rest_getutxos},
       {"/rest/blockhashbyheight/", rest_blockhash_by_height},
+      {"/rest/pop/atv/", rest_pop_atv},
+      {"/rest/pop/vtb/", rest_pop_vtb},
+      {"/rest/pop/vbkheaders/", rest_pop_vbkheaders},
+      {"/rest/pop/mempool", rest_pop_mempool},
 };
 
 void StartREST()
@@ -46,6 +46,7 @@
 
 #include <vbk/adaptors/univalue_json.hpp>
 #include <vbk/pop_common.hpp>
+#include <vbk/pop_mempool_limit.hpp>
 
 struct CUpdatedBlock
 {
@@ -868,7 +869,10 @@ static UniValue getblock(const JSONRPCRequest& request)
             "  \"chainwork\" : \"xxxx\",  (string) Expected number of hashes required to produce the chain up to this block (in hex)\n"
             "  \"nTx\" : n,             (numeric) The number of transactions in the block.\n"
             "  \"previousblockhash\" : \"hash\",  (string) The hash of the previous block\n"
-            "  \"nextblockhash\" : \"hash\"       (string) The hash of the next block\n"
+            "  \"nextblockhash\" : \"hash\",      (string) The hash of the next block\n"
+            "  \"pop\" : {              (json object) PoP state of the block and the ids of its VBK blocks, VTBs and ATVs\n"
+            "     ...\n"
+            "  }\n"
             "}\n"
                     },
                     RPCResult{"for verbosity = 2",
@@ -877,6 +881,9 @@ static UniValue getblock(const JSONRPCRequest& request)
             "  \"tx\" : [               (array of Objects) The transactions in the format of the getrawtransaction RPC. Different from verbosity = 1 \"tx\" result.\n"
             "         ,...\n"
             "  ],\n"
+            "  \"pop\" : {              (json object) Same as verbosity = 1, but with full VBK blocks, VTBs and ATVs instead of their ids\n"
+            "     ...\n"
+            "  }\n"
             "  ,...                     Same output as verbosity = 1.\n"
             "}\n"
                     },
@@ -924,12 +931,16 @@ static UniValue getblock(const JSONRPCRequest& request)
 
     {
         auto& pop = VeriBlock::GetPop();
-        LOCK(cs_main);
-        auto index = pop.altTree->getBlockIndex(block.GetHash().asVector());
-        VBK_ASSERT(index);
         UniValue obj(UniValue::VOBJ);
+        {
+            LOCK(cs_main);
+            auto index = pop.altTree->getBlockIndex(block.GetHash().asVector());
+            VBK_ASSERT(index);
+            obj.pushKV("state", altintegration::ToJSON<UniValue>(*index));
+        }
 
-        obj.pushKV("state", altintegration::ToJSON<UniValue>(*index));
+        // popData is a copy read from disk, so it is converted without holding cs_main.
+        // Full payloads are only included with verbosity 2, otherwise only their ids.
         obj.pushKV("data", altintegration::ToJSON<UniValue>(block.popData, verbosity >= 2));
         json.pushKV("pop", obj);
     }
@@ -1432,6 +1443,20 @@ static UniValue getchaintips(const JSONRPCRequest& request)
 
 UniValue MempoolInfoToJSON(const CTxMemPool& pool)
 {
+    // POP mempool is guarded by cs_main, which must not be taken after pool.cs
+    VeriBlock::PopMempoolUsage popUsage;
+    {
+        LOCK(cs_main);
+        popUsage = VeriBlock::GetPopMempoolUsage();
+    }
+    UniValue pop(UniValue::VOBJ);
+    pop.pushKV("vbkblocks", (uint64_t)popUsage.vbkblocks);
+    pop.pushKV("vtbs", (uint64_t)popUsage.vtbs);
+    pop.pushKV("atvs", (uint64_t)popUsage.atvs);
+    pop.pushKV("inflight", (uint64_t)popUsage.inflight);
+    pop.pushKV("usage", (uint64_t)popUsage.usage);
+    pop.pushKV("maxpopmempool", (uint64_t)VeriBlock::GetMaxPopMempoolSize());
+
     // Make sure this call is atomic in the pool.
     LOCK(pool.cs);
     UniValue ret(UniValue::VOBJ);
@@ -1443,6 +1468,7 @@ UniValue MempoolInfoToJSON(const CTxMemPool& pool)
     ret.pushKV("maxmempool", (int64_t) maxmempool);
     ret.pushKV("mempoolminfee", ValueFromAmount(std::max(pool.GetMinFee(maxmempool), ::minRelayTxFee).GetFeePerK()));
     ret.pushKV("minrelaytxfee", ValueFromAmount(::minRelayTxFee.GetFeePerK()));
+    ret.pushKV("pop", pop);
 
     return ret;
 }
@@ -1461,6 +1487,14 @@ static UniValue getmempoolinfo(const JSONRPCRequest& request)
             "  \"maxmempool\": xxxxx,         (numeric) Maximum memory usage for the mempool\n"
             "  \"mempoolminfee\": xxxxx       (numeric) Minimum fee rate in " + CURRENCY_UNIT + "/kB for tx to be accepted. Is the maximum of minrelaytxfee and minimum mempool fee\n"
             "  \"minrelaytxfee\": xxxxx       (numeric) Current minimum relay fee for transactions\n"
+            "  \"pop\": {                     (json object) POP mempool\n"
+            "    \"vbkblocks\": xxxxx,          (numeric) Current VBK block count\n"
+            "    \"vtbs\": xxxxx,               (numeric) Current VTB count\n"
+            "    \"atvs\": xxxxx,               (numeric) Current ATV count\n"
+            "    \"inflight\": xxxxx,           (numeric) Payloads waiting for missing VBK blocks\n"
+            "    \"usage\": xxxxx,              (numeric) Estimated memory usage for the POP mempool\n"
+            "    \"maxpopmempool\": xxxxx       (numeric) Maximum memory usage for the POP mempool\n"
+            "  }\n"
             "}\n"
                 },
                 RPCExamples{
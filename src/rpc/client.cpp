@@ -34,6 +34,9 @@ static const CRPCConvertParam vRPCConvertParams[] =
     { "getrawatv", 1, "verbose"},
     { "getrawvtb", 1, "verbose"},
     { "getrawvbkblock", 1, "verbose"},
+    { "getpopstats", 0, "reset"},
+    { "getrawpopmempool", 0, "verbose"},
+    { "getrawpopmempool", 2, "count"},
     // VBK
     { "setmocktime", 0, "timestamp" },
     { "utxoupdatepsbt", 1, "descriptors" },
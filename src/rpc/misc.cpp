@@ -16,6 +16,9 @@
 #include <util/strencodings.h>
 #include <util/system.h>
 #include <util/validation.h>
+#include <validation.h>
+#include <vbk/pop_mempool_limit.hpp>
+#include <vbk/pop_service.hpp>
 
 #include <stdint.h>
 #include <tuple>
@@ -400,6 +403,31 @@ static std::string RPCMallocInfo()
 }
 #endif
 
+static UniValue PopTreeMemoryInfo(const VeriBlock::PopTreeMemoryUsage& usage)
+{
+    UniValue obj(UniValue::VOBJ);
+    obj.pushKV("blocks", (uint64_t)usage.blocks);
+    obj.pushKV("usage", (uint64_t)usage.usage);
+    return obj;
+}
+
+static UniValue RPCPopMemoryInfo()
+{
+    LOCK(cs_main);
+    auto trees = VeriBlock::getPopTreesMemoryUsage();
+    UniValue obj(UniValue::VOBJ);
+    obj.pushKV("alt", PopTreeMemoryInfo(trees.alt));
+    obj.pushKV("vbk", PopTreeMemoryInfo(trees.vbk));
+    obj.pushKV("btc", PopTreeMemoryInfo(trees.btc));
+    UniValue payloads(UniValue::VOBJ);
+    payloads.pushKV("ids", (uint64_t)trees.payloads.ids);
+    payloads.pushKV("usage", (uint64_t)trees.payloads.usage);
+    obj.pushKV("payloads", payloads);
+    obj.pushKV("trees", (uint64_t)trees.total());
+    obj.pushKV("mempool", (uint64_t)VeriBlock::GetPopMempoolUsage().usage);
+    return obj;
+}
+
 static UniValue getmemoryinfo(const JSONRPCRequest& request)
 {
     /* Please, avoid using the word "pool" here in the RPC interface or help,
@@ -422,6 +450,20 @@ static UniValue getmemoryinfo(const JSONRPCRequest& request)
             "    \"locked\": xxxxxx,       (numeric) Amount of bytes that succeeded locking. If this number is smaller than total, locking pages failed at some point and key data could be swapped to disk.\n"
             "    \"chunks_used\": xxxxx,   (numeric) Number allocated chunks\n"
             "    \"chunks_free\": xxxxx,   (numeric) Number unused chunks\n"
+            "  },\n"
+            "  \"pop\": {                  (json object) Estimated memory usage of PoP state\n"
+            "    \"alt\": {                (json object) ALT block tree\n"
+            "      \"blocks\": xxxxx,      (numeric) Number of block indexes in memory\n"
+            "      \"usage\": xxxxx        (numeric) Number of bytes used\n"
+            "    },\n"
+            "    \"vbk\": {...},           (json object) VBK block tree, same as alt\n"
+            "    \"btc\": {...},           (json object) BTC block tree, same as alt\n"
+            "    \"payloads\": {           (json object) Payload ids of ALT blocks and the payloads index\n"
+            "      \"ids\": xxxxx,         (numeric) Number of payload ids\n"
+            "      \"usage\": xxxxx        (numeric) Number of bytes used\n"
+            "    },\n"
+            "    \"trees\": xxxxx,         (numeric) Number of bytes used by all trees and payload ids, counted against -dbcache\n"
+            "    \"mempool\": xxxxx        (numeric) Number of bytes used by POP mempool, limited by -maxpopmempool\n"
             "  }\n"
             "}\n"
                     },
@@ -439,6 +481,7 @@ static UniValue getmemoryinfo(const JSONRPCRequest& request)
     if (mode == "stats") {
         UniValue obj(UniValue::VOBJ);
         obj.pushKV("locked", RPCLockedMemoryInfo());
+        obj.pushKV("pop", RPCPopMemoryInfo());
         return obj;
     } else if (mode == "mallocinfo") {
 #ifdef HAVE_MALLOC_INFO
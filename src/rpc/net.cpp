@@ -22,6 +22,7 @@
 #include <util/strencodings.h>
 #include <util/system.h>
 #include <validation.h>
+#include <vbk/p2p_sync.hpp>
 #include <version.h>
 #include <warnings.h>
 
@@ -394,6 +395,16 @@ static UniValue getnettotals(const JSONRPCRequest& request)
             "    \"serve_historical_blocks\": true|false,  (boolean) True if serving historical blocks\n"
             "    \"bytes_left_in_cycle\": t,               (numeric) Bytes left in current time cycle\n"
             "    \"time_left_in_cycle\": t                 (numeric) Seconds left in current time cycle\n"
+            "  },\n"
+            "  \"pop\":                 (json object) Bytes queued for PoP relay since startup, per payload type\n"
+            "  {\n"
+            "    \"atv\":                (json object) Same fields for \"vtb\" and \"vbkblock\"\n"
+            "    {\n"
+            "      \"payload\": n,       (numeric) Bytes of payloads served to peers\n"
+            "      \"offer\": n,         (numeric) Bytes of payload offers\n"
+            "      \"request\": n        (numeric) Bytes of payload requests\n"
+            "    },\n"
+            "    ...\n"
             "  }\n"
             "}\n"
                 },
@@ -418,6 +429,20 @@ static UniValue getnettotals(const JSONRPCRequest& request)
     outboundLimit.pushKV("bytes_left_in_cycle", g_rpc_node->connman->GetOutboundTargetBytesLeft());
     outboundLimit.pushKV("time_left_in_cycle", g_rpc_node->connman->GetMaxOutboundTimeLeftInCycle());
     obj.pushKV("uploadtarget", outboundLimit);
+
+    const auto popStats = VeriBlock::p2p::GetPopRelayStats();
+    auto popTraffic = [](const VeriBlock::p2p::PopRelayTraffic& traffic) {
+        UniValue o(UniValue::VOBJ);
+        o.pushKV("payload", traffic.payload);
+        o.pushKV("offer", traffic.offer);
+        o.pushKV("request", traffic.request);
+        return o;
+    };
+    UniValue pop(UniValue::VOBJ);
+    pop.pushKV("atv", popTraffic(popStats.atv));
+    pop.pushKV("vtb", popTraffic(popStats.vtb));
+    pop.pushKV("vbkblock", popTraffic(popStats.vbkblock));
+    obj.pushKV("pop", pop);
     return obj;
 }
 
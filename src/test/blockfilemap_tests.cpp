@@ -0,0 +1,115 @@
+// Copyright (c) 2019-2020 Xenios SEZC
+// https://www.veriblock.org
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <blockfilemap.h>
+#include <chainparams.h>
+#include <clientversion.h>
+#include <streams.h>
+#include <util/system.h>
+#include <validation.h>
+#include <version.h>
+
+#include <test/util/setup_common.h>
+
+#include <boost/test/unit_test.hpp>
+
+#ifndef WIN32
+
+static void AppendToFile(const fs::path& path, const std::vector<unsigned char>& data)
+{
+    FILE* file = fsbridge::fopen(path, "ab");
+    BOOST_REQUIRE(file != nullptr);
+    BOOST_REQUIRE_EQUAL(fwrite(data.data(), 1, data.size(), file), data.size());
+    fclose(file);
+}
+
+BOOST_FIXTURE_TEST_SUITE(blockfilemap_tests, BasicTestingSetup)
+
+BOOST_AUTO_TEST_CASE(maps_and_remaps_grown_files)
+{
+    const fs::path path = GetDataDir() / "blk_map_test.dat";
+    AppendToFile(path, {1, 2, 3, 4});
+
+    BlockFileMapCache cache(2);
+    auto file = cache.Get(path, 4);
+    BOOST_REQUIRE(file);
+    BOOST_CHECK_EQUAL(file->size(), 4U);
+    BOOST_CHECK_EQUAL(file->data()[3], 4);
+    BOOST_CHECK(!cache.Get(path, 5));
+
+    AppendToFile(path, {5, 6});
+    auto grown = cache.Get(path, 6);
+    BOOST_REQUIRE(grown);
+    BOOST_CHECK_EQUAL(grown->size(), 6U);
+    BOOST_CHECK_EQUAL(grown->data()[5], 6);
+    // the old mapping stays readable while referenced
+    BOOST_CHECK_EQUAL(file->data()[0], 1);
+
+    cache.SetMaxFiles(0);
+    BOOST_CHECK(!cache.Get(path, 1));
+}
+
+BOOST_AUTO_TEST_CASE(evicts_least_recently_used)
+{
+    BlockFileMapCache cache(1);
+    const fs::path a = GetDataDir() / "blk_map_a.dat";
+    const fs::path b = GetDataDir() / "blk_map_b.dat";
+    AppendToFile(a, {1});
+    AppendToFile(b, {2});
+
+    auto fileA = cache.Get(a, 1);
+    BOOST_REQUIRE(fileA);
+    BOOST_REQUIRE(cache.Get(b, 1));
+    BOOST_CHECK(cache.Get(a, 1) != fileA);
+    BOOST_CHECK_EQUAL(fileA->data()[0], 1);
+
+    auto fileA2 = cache.Get(a, 1);
+    cache.Invalidate(a);
+    BOOST_CHECK(cache.Get(a, 1) != fileA2);
+}
+
+BOOST_AUTO_TEST_CASE(span_reader_deserializes_mapped_data)
+{
+    const fs::path path = GetDataDir() / "blk_map_reader.dat";
+    CDataStream stream(SER_DISK, CLIENT_VERSION);
+    stream << uint32_t{0xdeadbeef} << std::string("block");
+    AppendToFile(path, std::vector<unsigned char>(stream.begin(), stream.end()));
+
+    BlockFileMapCache cache(1);
+    auto file = cache.Get(path, stream.size());
+    BOOST_REQUIRE(file);
+
+    SpanReader reader(SER_DISK, CLIENT_VERSION, file->data());
+    uint32_t n;
+    std::string str;
+    reader >> n >> str;
+    BOOST_CHECK_EQUAL(n, 0xdeadbeef);
+    BOOST_CHECK_EQUAL(str, "block");
+    BOOST_CHECK(reader.empty());
+    BOOST_CHECK_THROW(reader >> n, std::ios_base::failure);
+}
+
+BOOST_FIXTURE_TEST_CASE(raw_block_reads_match_serialization, TestChain100Setup)
+{
+    const CBlockIndex* tip = WITH_LOCK(cs_main, return ::ChainActive().Tip());
+    CBlock block;
+    BOOST_REQUIRE(ReadBlockFromDisk(block, tip, Params().GetConsensus()));
+    CDataStream expected(SER_NETWORK, PROTOCOL_VERSION);
+    expected << block;
+
+    std::vector<uint8_t> mapped;
+    BOOST_REQUIRE(ReadRawBlockFromDisk(mapped, tip, Params().MessageStart()));
+    BOOST_CHECK(mapped == std::vector<uint8_t>(expected.begin(), expected.end()));
+
+    SetMaxMappedBlockFiles(0);
+    std::vector<uint8_t> read;
+    BOOST_CHECK(ReadRawBlockFromDisk(read, tip, Params().MessageStart()));
+    SetMaxMappedBlockFiles(DEFAULT_MAX_MAPPED_BLOCK_FILES);
+    BOOST_CHECK(read == mapped);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // WIN32
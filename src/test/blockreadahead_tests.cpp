@@ -0,0 +1,79 @@
+// Copyright (c) 2019-2020 Xenios SEZC
+// https://www.veriblock.org
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <blockreadahead.h>
+#include <chainparams.h>
+#include <consensus/validation.h>
+#include <primitives/block.h>
+#include <util/time.h>
+#include <validation.h>
+
+#include <test/util/setup_common.h>
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_FIXTURE_TEST_SUITE(blockreadahead_tests, TestChain100Setup)
+
+BOOST_AUTO_TEST_CASE(blocks_ahead_are_read_in_background)
+{
+    CBlockIndex* fork = WITH_LOCK(cs_main, return ChainActive()[90]);
+    CBlockIndex* tip = WITH_LOCK(cs_main, return ChainActive().Tip());
+
+    // disabled read-ahead does not count lookups
+    ResetBlockReadAheadStats();
+    BOOST_CHECK(TakeReadAheadBlock(fork->GetAncestor(91)) == nullptr);
+    BOOST_CHECK_EQUAL(GetBlockReadAheadStats().misses, 0U);
+
+    StartBlockReadAhead(4);
+    BOOST_CHECK_EQUAL(GetBlockReadAheadDepth(), 4);
+    {
+        LOCK(cs_main);
+        ScheduleBlockReadAhead(fork, tip);
+    }
+    for (int i = 0; i < 100 && GetBlockReadAheadStats().cached_blocks < 4; ++i) {
+        MilliSleep(50);
+    }
+    BOOST_CHECK_EQUAL(GetBlockReadAheadStats().cached_blocks, 4U);
+
+    const CBlockIndex* next = tip->GetAncestor(91);
+    auto block = TakeReadAheadBlock(next);
+    BOOST_REQUIRE(block != nullptr);
+    BOOST_CHECK(block->GetHash() == next->GetBlockHash());
+    // taken blocks are gone, blocks beyond the depth were never queued
+    BOOST_CHECK(TakeReadAheadBlock(next) == nullptr);
+    BOOST_CHECK(TakeReadAheadBlock(tip->GetAncestor(95)) == nullptr);
+
+    // blocks that are no longer ahead of the fork point are dropped
+    {
+        LOCK(cs_main);
+        ScheduleBlockReadAhead(tip, tip);
+    }
+    BOOST_CHECK_EQUAL(GetBlockReadAheadStats().cached_blocks, 0U);
+
+    auto stats = GetBlockReadAheadStats();
+    BOOST_CHECK_EQUAL(stats.blocks, 4U);
+    BOOST_CHECK_EQUAL(stats.hits, 1U);
+    BOOST_CHECK_EQUAL(stats.misses, 2U);
+
+    // every block connected from disk goes through the read-ahead cache
+    ResetBlockReadAheadStats();
+    BlockValidationState state;
+    CBlockIndex* first = tip->GetAncestor(96);
+    BOOST_REQUIRE(InvalidateBlock(state, Params(), first));
+    {
+        LOCK(cs_main);
+        ResetBlockFailureFlags(first);
+    }
+    BOOST_REQUIRE(ActivateBestChain(state, Params()));
+    BOOST_CHECK(WITH_LOCK(cs_main, return ChainActive().Tip()) == tip);
+    stats = GetBlockReadAheadStats();
+    BOOST_CHECK_EQUAL(stats.hits + stats.misses, 5U);
+
+    StopBlockReadAhead();
+    ResetBlockReadAheadStats();
+    BOOST_CHECK_EQUAL(GetBlockReadAheadDepth(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -750,4 +750,37 @@ BOOST_AUTO_TEST_CASE(sha256d64)
     }
 }
 
+BOOST_AUTO_TEST_CASE(sha256dmany)
+{
+    // lengths around the one and two block padding boundaries, plus a few long messages
+    std::vector<std::vector<unsigned char>> messages;
+    for (size_t len = 0; len <= 130; ++len) {
+        messages.push_back(std::vector<unsigned char>(len));
+    }
+    for (int i = 0; i < 20; ++i) {
+        messages.push_back(std::vector<unsigned char>(InsecureRandRange(2000)));
+    }
+    for (auto& message : messages) {
+        for (auto& c : message) {
+            c = InsecureRandBits(8);
+        }
+    }
+
+    // every count, so that each lane width ends with partially filled lanes
+    for (size_t count = 0; count <= messages.size(); count += 1 + count / 16) {
+        std::vector<const unsigned char*> inputs;
+        std::vector<size_t> lengths;
+        for (size_t i = 0; i < count; ++i) {
+            inputs.push_back(messages[i].data());
+            lengths.push_back(messages[i].size());
+        }
+        std::vector<unsigned char> out1(32 * count), out2(32 * count);
+        for (size_t i = 0; i < count; ++i) {
+            CHash256().Write(inputs[i], lengths[i]).Finalize(out1.data() + 32 * i);
+        }
+        SHA256DMany(out2.data(), inputs.data(), lengths.data(), count);
+        BOOST_CHECK(out1 == out2);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,66 @@
+// Copyright (c) 2019-2020 Xenios SEZC
+// https://www.veriblock.org
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <coins.h>
+#include <memusage.h>
+#include <support/allocators/pool.h>
+
+#include <test/util/setup_common.h>
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_FIXTURE_TEST_SUITE(pool_tests, BasicTestingSetup)
+
+BOOST_AUTO_TEST_CASE(pool_resource_reuses_freed_blocks)
+{
+    PoolResource<16, 8> resource(64);
+    BOOST_CHECK_EQUAL(resource.ChunkSizeBytes(), 64U);
+    BOOST_CHECK_EQUAL(resource.NumAllocatedChunks(), 0U);
+
+    void* a = resource.Allocate(8, 8);
+    void* b = resource.Allocate(8, 8);
+    BOOST_CHECK(a != b);
+    BOOST_CHECK_EQUAL(resource.NumAllocatedChunks(), 1U);
+
+    // a freed block is handed out again for the same rounded size
+    resource.Deallocate(a, 8, 8);
+    BOOST_CHECK_EQUAL(resource.Allocate(7, 8), a);
+
+    // blocks larger than the maximum do not come from the chunks
+    void* large = resource.Allocate(17, 8);
+    resource.Deallocate(large, 17, 8);
+    BOOST_CHECK_EQUAL(resource.NumAllocatedChunks(), 1U);
+
+    // 64 - 2 * 8 bytes are left in the first chunk
+    for (int i = 0; i < 3; i++) {
+        resource.Allocate(16, 8);
+    }
+    BOOST_CHECK_EQUAL(resource.NumAllocatedChunks(), 1U);
+    resource.Allocate(16, 8);
+    BOOST_CHECK_EQUAL(resource.NumAllocatedChunks(), 2U);
+
+    resource.Deallocate(b, 8, 8);
+}
+
+BOOST_AUTO_TEST_CASE(coins_cache_memory_usage)
+{
+    CCoinsView base;
+    CCoinsViewCache cache(&base);
+    for (int i = 0; i < 100000; i++) {
+        cache.AddCoin(COutPoint(InsecureRand256(), 0), Coin(CTxOut(1, CScript() << OP_TRUE), 1, false), false);
+    }
+
+    // less than a malloc per entry would take
+    const size_t malloc_usage = memusage::MallocUsage(sizeof(memusage::unordered_node<CCoinsMap::value_type>)) * cache.GetCacheSize();
+    BOOST_CHECK_LT(cache.DynamicMemoryUsage(), malloc_usage);
+
+    // flushing gives the pool back
+    cache.SetBestBlock(InsecureRand256());
+    cache.Flush();
+    BOOST_CHECK_EQUAL(cache.GetCacheSize(), 0U);
+    BOOST_CHECK_LT(cache.DynamicMemoryUsage(), 1000U);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -116,6 +116,66 @@ BOOST_AUTO_TEST_CASE(CheckProofOfWork_test_zero_target)
     BOOST_CHECK(!CheckProofOfWork(hash, nBits, consensus));
 }
 
+//! DGW averaging done with plain arith_uint256 operations, DarkGravityWave must match it bit for bit
+static unsigned int ReferenceDarkGravityWave(const CBlockIndex* pindexLast, const Consensus::Params& params)
+{
+    const arith_uint256 bnPowLimit = UintToArith256(params.powLimit);
+    const int64_t nPastBlocks = 180;
+    const CBlockIndex* pindex = pindexLast;
+    arith_uint256 bnPastTargetAvg;
+    for (unsigned int nCountBlocks = 1; nCountBlocks <= nPastBlocks; nCountBlocks++) {
+        arith_uint256 bnTarget = arith_uint256().SetCompact(pindex->nBits);
+        if (nCountBlocks == 1) {
+            bnPastTargetAvg = bnTarget;
+        } else {
+            bnPastTargetAvg = (bnPastTargetAvg * nCountBlocks + bnTarget) / (nCountBlocks + 1);
+        }
+        if (nCountBlocks != nPastBlocks) {
+            pindex = pindex->pprev;
+        }
+    }
+
+    arith_uint256 bnNew(bnPastTargetAvg);
+    int64_t nActualTimespan = pindexLast->GetBlockTime() - pindex->GetBlockTime();
+    int64_t nTargetTimespan = nPastBlocks * params.nPowTargetSpacing;
+    if (nActualTimespan < nTargetTimespan / 3)
+        nActualTimespan = nTargetTimespan / 3;
+    if (nActualTimespan > nTargetTimespan * 3)
+        nActualTimespan = nTargetTimespan * 3;
+    bnNew *= nActualTimespan;
+    bnNew /= nTargetTimespan;
+    if (bnNew > bnPowLimit) {
+        bnNew = bnPowLimit;
+    }
+    return bnNew.GetCompact();
+}
+
+BOOST_AUTO_TEST_CASE(dark_gravity_wave_matches_reference)
+{
+    const auto chainParams = CreateChainParams(CBaseChainParams::MAIN);
+    const auto& consensus = chainParams->GetConsensus();
+    const arith_uint256 bnPowLimit = UintToArith256(consensus.powLimit);
+
+    std::vector<CBlockIndex> blocks(1000);
+    for (size_t i = 0; i < blocks.size(); i++) {
+        blocks[i].pprev = i ? &blocks[i - 1] : nullptr;
+        blocks[i].nHeight = i;
+        blocks[i].nTime = i ? blocks[i - 1].nTime + InsecureRandRange(4 * consensus.nPowTargetSpacing) : 1269211443;
+        // mostly random targets, with runs at the limit where the unnormalized average wraps around
+        arith_uint256 target = UintToArith256(InsecureRand256()) >> InsecureRandRange(32);
+        if (target > bnPowLimit || (i / 100) % 2 == 1) {
+            target = bnPowLimit;
+        }
+        blocks[i].nBits = target.GetCompact();
+    }
+
+    CBlockHeader header;
+    for (size_t i = 180; i < blocks.size(); i++) {
+        header.nTime = blocks[i].nTime + consensus.nPowTargetSpacing;
+        BOOST_CHECK_EQUAL(DarkGravityWave(&blocks[i], &header, consensus), ReferenceDarkGravityWave(&blocks[i], consensus));
+    }
+}
+
 BOOST_AUTO_TEST_CASE(GetBlockProofEquivalentTime_test)
 {
     const auto chainParams = CreateChainParams(CBaseChainParams::MAIN);
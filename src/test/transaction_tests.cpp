@@ -833,4 +833,34 @@ BOOST_AUTO_TEST_CASE(test_IsStandard)
     BOOST_CHECK_EQUAL(reason, "bare-multisig");
 }
 
+BOOST_AUTO_TEST_CASE(make_transaction_refs)
+{
+    std::vector<CMutableTransaction> txs(50);
+    for (auto& tx : txs) {
+        tx.vin.resize(1 + InsecureRandRange(3));
+        for (auto& in : tx.vin) {
+            in.prevout = COutPoint(InsecureRand256(), InsecureRand32());
+            in.scriptSig = CScript() << std::vector<unsigned char>(InsecureRandRange(150), 1);
+            if (InsecureRandBool()) {
+                in.scriptWitness.stack.push_back(std::vector<unsigned char>(InsecureRandRange(100), 2));
+            }
+        }
+        tx.vout.resize(1 + InsecureRandRange(3));
+        for (auto& out : tx.vout) {
+            out.nValue = InsecureRandRange(MAX_MONEY);
+            out.scriptPubKey = CScript() << OP_TRUE;
+        }
+    }
+
+    std::vector<CTransaction> expected(txs.begin(), txs.end());
+    std::vector<CTransactionRef> refs = MakeTransactionRefs(std::move(txs));
+    BOOST_REQUIRE_EQUAL(refs.size(), expected.size());
+    for (size_t i = 0; i < refs.size(); ++i) {
+        BOOST_CHECK_EQUAL(refs[i]->GetHash(), expected[i].GetHash());
+        BOOST_CHECK_EQUAL(refs[i]->GetWitnessHash(), expected[i].GetWitnessHash());
+        BOOST_CHECK_EQUAL(refs[i]->HasWitness(), expected[i].HasWitness());
+        BOOST_CHECK_EQUAL(refs[i]->vin.size(), expected[i].vin.size());
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,133 @@
+// Copyright (c) 2019-2020 Xenios SEZC
+// https://www.veriblock.org
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <arith_uint256.h>
+#include <chainparams.h>
+#include <coins.h>
+#include <pow.h>
+#include <random.h>
+#include <txdb.h>
+#include <util/system.h>
+
+#include <test/util/setup_common.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <map>
+
+BOOST_FIXTURE_TEST_SUITE(txdb_tests, RegTestingSetup)
+
+BOOST_AUTO_TEST_CASE(LoadBlockIndexGuts_loads_every_entry)
+{
+    const auto& consensus = Params().GetConsensus();
+    const uint32_t nBits = UintToArith256(consensus.powLimit).GetCompact();
+
+    // enough entries to land in every key range
+    const size_t nBlocks = 1000;
+    std::vector<uint256> hashes(nBlocks);
+    std::vector<CBlockIndex> blocks(nBlocks);
+    std::vector<const CBlockIndex*> written;
+    for (size_t i = 0; i < nBlocks; i++) {
+        CBlockHeader header;
+        header.nVersion = 1;
+        header.hashPrevBlock = i ? hashes[i - 1] : uint256();
+        header.nTime = 1296688602 + i;
+        header.nBits = nBits;
+        while (!CheckProofOfWork(header.GetHash(), header.nBits, consensus)) {
+            ++header.nNonce;
+        }
+        hashes[i] = header.GetHash();
+
+        blocks[i] = CBlockIndex(header);
+        blocks[i].phashBlock = &hashes[i];
+        blocks[i].pprev = i ? &blocks[i - 1] : nullptr;
+        blocks[i].nHeight = i;
+        blocks[i].nTx = 1;
+        written.push_back(&blocks[i]);
+    }
+
+    CBlockTreeDB db(1 << 20, true);
+    BOOST_REQUIRE(db.WriteBatchSync({}, 0, written));
+
+    std::map<uint256, std::unique_ptr<CBlockIndex>> index;
+    auto insert = [&](const uint256& hash) -> CBlockIndex* {
+        if (hash.IsNull()) return nullptr;
+        auto& pindex = index[hash];
+        if (!pindex) {
+            pindex.reset(new CBlockIndex());
+        }
+        return pindex.get();
+    };
+    BOOST_REQUIRE(db.LoadBlockIndexGuts(consensus, insert));
+
+    BOOST_CHECK_EQUAL(index.size(), nBlocks);
+    for (size_t i = 0; i < nBlocks; i++) {
+        auto it = index.find(hashes[i]);
+        BOOST_REQUIRE(it != index.end());
+        const CBlockIndex& loaded = *it->second;
+        BOOST_CHECK_EQUAL(loaded.nHeight, (int)i);
+        BOOST_CHECK_EQUAL(loaded.nNonce, blocks[i].nNonce);
+        BOOST_CHECK_EQUAL(loaded.nTime, blocks[i].nTime);
+        if (i > 0) {
+            BOOST_CHECK(loaded.pprev == index[hashes[i - 1]].get());
+        } else {
+            BOOST_CHECK(loaded.pprev == nullptr);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(CCoinsViewDB_GetCoins_matches_GetCoin)
+{
+    CCoinsViewDB db(GetDataDir() / "coins_get_test", 1 << 20, true, false);
+
+    // enough outpoints to be read by several threads
+    std::vector<COutPoint> outpoints;
+    {
+        CCoinsViewCache cache(&db);
+        for (int i = 0; i < 1000; i++) {
+            COutPoint outpoint(InsecureRand256(), InsecureRandBits(2));
+            cache.AddCoin(outpoint, Coin(CTxOut(i + 1, CScript() << OP_TRUE), i, false), false);
+            outpoints.push_back(outpoint);
+        }
+        cache.SetBestBlock(InsecureRand256());
+        BOOST_REQUIRE(cache.Flush());
+    }
+    const size_t nMissing = 100;
+    for (size_t i = 0; i < nMissing; i++) {
+        outpoints.push_back(COutPoint(InsecureRand256(), 0));
+    }
+    Shuffle(outpoints.begin(), outpoints.end(), g_insecure_rand_ctx);
+
+    std::vector<Coin> coins;
+    BOOST_CHECK_EQUAL(db.GetCoins(outpoints, coins), outpoints.size());
+    BOOST_REQUIRE_EQUAL(coins.size(), outpoints.size());
+    size_t nFound = 0;
+    for (size_t i = 0; i < outpoints.size(); i++) {
+        Coin coin;
+        const bool found = db.GetCoin(outpoints[i], coin);
+        BOOST_CHECK_EQUAL(found, !coins[i].IsSpent());
+        if (found) {
+            BOOST_CHECK(coin.out == coins[i].out);
+            BOOST_CHECK_EQUAL(coin.nHeight, coins[i].nHeight);
+            nFound++;
+        }
+    }
+    BOOST_CHECK_EQUAL(nFound, outpoints.size() - nMissing);
+
+    // a cache only requests the outpoints it does not hold, and does not
+    // cache the ones its base does not have
+    CCoinsViewCache cache(&db);
+    const size_t nAccessed = std::find_if(outpoints.begin(), outpoints.end(), [&](const COutPoint& outpoint) { return db.HaveCoin(outpoint); }) - outpoints.begin();
+    BOOST_REQUIRE(!cache.AccessCoin(outpoints[nAccessed]).IsSpent());
+    BOOST_CHECK_EQUAL(cache.Prefetch(outpoints), outpoints.size() - 1);
+    BOOST_CHECK_EQUAL(cache.GetCacheSize(), outpoints.size() - nMissing);
+    BOOST_CHECK_EQUAL(cache.Prefetch(outpoints), nMissing);
+    for (size_t i = 0; i < outpoints.size(); i++) {
+        BOOST_CHECK_EQUAL(cache.HaveCoinInCache(outpoints[i]), !coins[i].IsSpent());
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
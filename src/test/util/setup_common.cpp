@@ -136,6 +136,14 @@ TestingSetup::TestingSetup(const std::string& chainName) : BasicTestingSetup(cha
         threadGroup.create_thread([i]() { return ThreadScriptCheck(i); });
     }
     g_parallel_script_checks = true;
+    for (int i = 0; i < script_check_threads; ++i) {
+        threadGroup.create_thread([i]() { return ThreadBlockCheck(i); });
+    }
+    g_parallel_block_checks = true;
+    for (int i = 0; i < script_check_threads; ++i) {
+        threadGroup.create_thread([i]() { return ThreadCoinsRead(i); });
+    }
+    g_parallel_coins_reads = true;
 
     m_node.mempool = &::mempool;
     m_node.mempool->setSanityCheck(1.0);
@@ -5,7 +5,14 @@
 // file COPYING or http://www.opensource.org/licenses/mit-license.php.
 
 #include <chainparams.h>
+#include <clientversion.h>
+#include <consensus/consensus.h>
+#include <consensus/validation.h>
+#include <miner.h>
 #include <net.h>
+#include <pow.h>
+#include <streams.h>
+#include <util/system.h>
 #include <validation.h>
 
 #include <test/util/setup_common.h>
@@ -13,6 +20,8 @@
 #include <boost/signals2/signal.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include <limits>
+
 BOOST_FIXTURE_TEST_SUITE(validation_tests, TestingSetup)
 
 static void TestBlockSubsidyHalvings(const Consensus::Params& consensusParams)
@@ -79,4 +88,168 @@ BOOST_AUTO_TEST_CASE(test_combiner_all)
     Test.disconnect(&ReturnTrue);
     BOOST_CHECK(Test());
 }
+
+static CBlock BlockWithTransactions(size_t nTxs)
+{
+    CBlock block;
+    CMutableTransaction coinbase;
+    coinbase.vin.resize(1);
+    coinbase.vin[0].scriptSig = CScript() << 1 << OP_0;
+    coinbase.vout.emplace_back(1, CScript() << OP_TRUE);
+    block.vtx.push_back(MakeTransactionRef(coinbase));
+    for (size_t i = 1; i < nTxs; i++) {
+        CMutableTransaction tx;
+        tx.vin.emplace_back(COutPoint(InsecureRand256(), 0));
+        tx.vout.emplace_back(1, CScript() << OP_TRUE);
+        block.vtx.push_back(MakeTransactionRef(tx));
+    }
+    return block;
+}
+
+BOOST_AUTO_TEST_CASE(checkblock_reports_first_invalid_transaction)
+{
+    const auto& consensus = Params().GetConsensus();
+    // several ranges of transactions, checked on the block check workers
+    const size_t nTxs = 10 * BLOCK_CHECK_TXS_PER_RANGE;
+
+    CBlock valid = BlockWithTransactions(nTxs);
+    BlockValidationState state;
+    BOOST_CHECK(CheckBlock(valid, state, consensus, false));
+
+    CBlock block = BlockWithTransactions(nTxs);
+    CMutableTransaction duplicate(*block.vtx[3 * BLOCK_CHECK_TXS_PER_RANGE + 1]);
+    duplicate.vin.push_back(duplicate.vin[0]);
+    block.vtx[3 * BLOCK_CHECK_TXS_PER_RANGE + 1] = MakeTransactionRef(duplicate);
+    CMutableTransaction negative(*block.vtx[7 * BLOCK_CHECK_TXS_PER_RANGE]);
+    negative.vout[0].nValue = -1;
+    block.vtx[7 * BLOCK_CHECK_TXS_PER_RANGE] = MakeTransactionRef(negative);
+
+    state = BlockValidationState();
+    BOOST_CHECK(!CheckBlock(block, state, consensus, false));
+    BOOST_CHECK_EQUAL(state.GetRejectReason(), "bad-txns-inputs-duplicate");
+    BOOST_CHECK(state.GetDebugMessage().find(duplicate.GetHash().ToString()) != std::string::npos);
+}
+
+//! A block on top of the active tip that is not processed
+static CBlock UnprocessedChildOfTip(unsigned int nExtraNonce)
+{
+    LOCK(cs_main);
+    std::unique_ptr<CBlockTemplate> pblocktemplate = BlockAssembler(Params()).CreateNewBlock(CScript() << OP_TRUE);
+    CBlock block = pblocktemplate->block;
+    block.vtx.resize(1);
+    IncrementExtraNonce(&block, ChainActive().Tip(), nExtraNonce);
+    while (!CheckProofOfWork(block.GetHash(), block.nBits, Params().GetConsensus())) ++block.nNonce;
+    return block;
+}
+
+//! Append a block file record: message start, size and serialized block
+static void AppendBlockRecord(std::vector<unsigned char>& data, const std::vector<unsigned char>& raw, unsigned int nSize)
+{
+    CVectorWriter writer(SER_DISK, CLIENT_VERSION, data, data.size());
+    writer.write((const char*)Params().MessageStart(), CMessageHeader::MESSAGE_START_SIZE);
+    writer << nSize;
+    writer.write((const char*)raw.data(), raw.size());
+}
+
+static std::vector<unsigned char> SerializeBlock(const CBlock& block)
+{
+    std::vector<unsigned char> raw;
+    CVectorWriter(SER_DISK, CLIENT_VERSION, raw, 0) << block;
+    return raw;
+}
+
+//! Append a record that does not deserialize, whose size covers the block after it
+static void AppendCorruptRecord(std::vector<unsigned char>& data, const CBlock& covered)
+{
+    std::vector<unsigned char> record;
+    AppendBlockRecord(record, SerializeBlock(covered), ::GetSerializeSize(covered, CLIENT_VERSION));
+    const std::vector<unsigned char> corrupt(100, 0xff);
+    AppendBlockRecord(data, corrupt, corrupt.size() + record.size());
+    data.insert(data.end(), record.begin(), record.end());
+}
+
+static bool LoadBlockFile(const std::vector<unsigned char>& data, const std::string& name)
+{
+    FILE* file = fsbridge::fopen(GetDataDir() / name, "wb+");
+    BOOST_REQUIRE(file != nullptr);
+    BOOST_REQUIRE_EQUAL(fwrite(data.data(), 1, data.size(), file), data.size());
+    rewind(file);
+    return LoadExternalBlockFile(Params(), file);
+}
+
+static bool HaveBlockData(const CBlock& block)
+{
+    LOCK(cs_main);
+    const CBlockIndex* pindex = LookupBlockIndex(block.GetHash());
+    return pindex && (pindex->nStatus & BLOCK_HAVE_DATA);
+}
+
+BOOST_FIXTURE_TEST_CASE(loadexternalblockfile_rescans_after_corrupt_block, TestChain100Setup)
+{
+    // the scan resumes right after the corrupt header and finds the block
+    // inside it, also when the batch already read up to the end of the file
+    const CBlock a = UnprocessedChildOfTip(1);
+    const CBlock b = UnprocessedChildOfTip(2);
+    std::vector<unsigned char> data;
+    AppendBlockRecord(data, SerializeBlock(a), ::GetSerializeSize(a, CLIENT_VERSION));
+    AppendCorruptRecord(data, b);
+    BOOST_CHECK(LoadBlockFile(data, "blk_corrupt_end.dat"));
+    BOOST_CHECK(HaveBlockData(a));
+    BOOST_CHECK(HaveBlockData(b));
+
+    // and when the blocks after it take more than the read buffer of
+    // LoadExternalBlockFile: large blocks of unknown parents here
+    const CBlock c = UnprocessedChildOfTip(3);
+    const CBlock d = UnprocessedChildOfTip(4);
+    const CBlock e = UnprocessedChildOfTip(5);
+    data.clear();
+    AppendBlockRecord(data, SerializeBlock(c), ::GetSerializeSize(c, CLIENT_VERSION));
+    AppendCorruptRecord(data, d);
+    const std::vector<unsigned char> script(MAX_BLOCK_SERIALIZED_SIZE - 100 * 1000, OP_NOP);
+    for (int i = 0; i < 3; i++) {
+        CBlock large;
+        large.hashPrevBlock = InsecureRand256();
+        CMutableTransaction tx;
+        tx.vout.emplace_back(0, CScript(script.begin(), script.end()));
+        large.vtx.push_back(MakeTransactionRef(tx));
+        AppendBlockRecord(data, SerializeBlock(large), ::GetSerializeSize(large, CLIENT_VERSION));
+    }
+    AppendBlockRecord(data, SerializeBlock(e), ::GetSerializeSize(e, CLIENT_VERSION));
+    BOOST_CHECK(LoadBlockFile(data, "blk_corrupt_large.dat"));
+    BOOST_CHECK(HaveBlockData(c));
+    BOOST_CHECK(HaveBlockData(d));
+    BOOST_CHECK(HaveBlockData(e));
+}
+
+BOOST_AUTO_TEST_CASE(coins_cache_space_leaves_room_after_pop_trees)
+{
+    const int64_t nTotalSpace = 450 * 1024 * 1024;
+    const int64_t nMinSpace = nTotalSpace * MIN_COINS_CACHE_SPACE_PERCENT / 100;
+
+    // small trees are subtracted from the coins cache space
+    BOOST_CHECK_EQUAL(GetCoinsCacheSpace(nTotalSpace, 0), nTotalSpace);
+    BOOST_CHECK_EQUAL(GetCoinsCacheSpace(nTotalSpace, 10 * 1024 * 1024), nTotalSpace - 10 * 1024 * 1024);
+    BOOST_CHECK_EQUAL(GetCoinsCacheSpace(nTotalSpace, nTotalSpace - nMinSpace), nMinSpace);
+
+    // trees using most or more of the budget never leave the coins cache less than the minimum
+    BOOST_CHECK_EQUAL(GetCoinsCacheSpace(nTotalSpace, nTotalSpace - nMinSpace + 1), nMinSpace);
+    BOOST_CHECK_EQUAL(GetCoinsCacheSpace(nTotalSpace, nTotalSpace), nMinSpace);
+    BOOST_CHECK_EQUAL(GetCoinsCacheSpace(nTotalSpace, 4 * nTotalSpace), nMinSpace);
+    BOOST_CHECK_GT(GetCoinsCacheSpace(nTotalSpace, std::numeric_limits<int64_t>::max() / 2), 0);
+}
+
+BOOST_FIXTURE_TEST_CASE(verifydb_checks_blocks_in_batches, TestChain100Setup)
+{
+    // more blocks than the batches of all worker threads together
+    BOOST_REQUIRE_GT(WITH_LOCK(cs_main, return ChainActive().Height()), 4 * MAX_VERIFYDB_THREADS);
+    const CBlockIndex* tip = WITH_LOCK(cs_main, return ChainActive().Tip());
+    for (int level = 0; level <= 4; ++level) {
+        BOOST_CHECK(CVerifyDB().VerifyDB(Params(), &::ChainstateActive().CoinsTip(), level, 0));
+        BOOST_CHECK(WITH_LOCK(cs_main, return ChainActive().Tip()) == tip);
+        BOOST_CHECK(WITH_LOCK(cs_main, return ::ChainstateActive().CoinsTip().GetBestBlock()) == tip->GetBlockHash());
+    }
+    // a shallow check stops before the first batch is used up
+    BOOST_CHECK(CVerifyDB().VerifyDB(Params(), &::ChainstateActive().CoinsTip(), 4, 3));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -5,17 +5,26 @@
 
 #include <txdb.h>
 
+#include <checkqueue.h>
 #include <pow.h>
 #include <random.h>
 #include <shutdown.h>
 #include <ui_interface.h>
 #include <uint256.h>
 #include <util/system.h>
+#include <util/threadnames.h>
 #include <util/translation.h>
 #include <util/vector.h>
 
 #include <stdint.h>
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <numeric>
+#include <thread>
+
 #include <boost/thread.hpp>
 #include <vbk/adaptors/block_batch_adaptor.hpp>
 #include <vbk/pop_service.hpp>
@@ -53,6 +62,35 @@ struct CoinEntry {
     }
 };
 
+/** Reads one range of the keys of a CCoinsViewDB::GetCoins call */
+class CCoinsReadCheck
+{
+private:
+    std::function<void()> m_read;
+
+public:
+    CCoinsReadCheck() = default;
+    explicit CCoinsReadCheck(std::function<void()> read) : m_read(std::move(read)) {}
+
+    bool operator()()
+    {
+        m_read();
+        return true;
+    }
+
+    void swap(CCoinsReadCheck& check) { m_read.swap(check.m_read); }
+};
+
+}
+
+bool g_parallel_coins_reads{false};
+
+static CCheckQueue<CCoinsReadCheck> coinsreadqueue(1);
+
+void ThreadCoinsRead(int worker_num)
+{
+    util::ThreadRename(strprintf("coinsread.%i", worker_num));
+    coinsreadqueue.Thread();
 }
 
 CCoinsViewDB::CCoinsViewDB(fs::path ldb_path, size_t nCacheSize, bool fMemory, bool fWipe) : db(ldb_path, nCacheSize, fMemory, fWipe, true)
@@ -67,6 +105,54 @@ bool CCoinsViewDB::HaveCoin(const COutPoint &outpoint) const {
     return db.Exists(CoinEntry(&outpoint));
 }
 
+size_t CCoinsViewDB::GetCoins(const std::vector<COutPoint>& outpoints, std::vector<Coin>& coins) const {
+    coins.assign(outpoints.size(), Coin());
+
+    // Reading in key order keeps neighbouring lookups within the same leveldb
+    // blocks, and every thread reads a contiguous part of the sorted keys.
+    std::vector<size_t> order(outpoints.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return outpoints[a] < outpoints[b]; });
+
+    const size_t nRanges = !g_parallel_coins_reads ? 1 : std::max<size_t>(1, std::min<size_t>({(size_t)GetNumCores(), (size_t)MAX_COINS_READ_THREADS, outpoints.size() / MIN_COINS_PER_READ_THREAD}));
+    std::vector<std::exception_ptr> vErrors(nRanges);
+
+    auto readRange = [&](size_t nRange) {
+        try {
+            const size_t nBegin = order.size() * nRange / nRanges;
+            const size_t nEnd = order.size() * (nRange + 1) / nRanges;
+            for (size_t k = nBegin; k < nEnd; k++) {
+                const size_t i = order[k];
+                if (!db.Read(CoinEntry(&outpoints[i]), coins[i])) {
+                    coins[i].Clear();
+                }
+            }
+        } catch (...) {
+            vErrors[nRange] = std::current_exception();
+        }
+    };
+
+    if (nRanges == 1) {
+        readRange(0);
+    } else {
+        // the ranges are read by the coins read threads started at init, helped by this thread
+        std::vector<CCoinsReadCheck> vChecks;
+        for (size_t i = 0; i < nRanges; i++) {
+            vChecks.emplace_back(std::bind(readRange, i));
+        }
+        CCheckQueueControl<CCoinsReadCheck> control(&coinsreadqueue);
+        control.Add(vChecks);
+        control.Wait();
+    }
+
+    for (const std::exception_ptr& error : vErrors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+    return outpoints.size();
+}
+
 uint256 CCoinsViewDB::GetBestBlock() const {
     uint256 hashBestChain;
     if (!db.Read(DB_BEST_BLOCK, hashBestChain))
@@ -253,47 +339,113 @@ bool CBlockTreeDB::ReadFlag(const std::string &name, bool &fValue) {
     return true;
 }
 
+namespace {
+
+struct LoadedBlockIndex {
+    uint256 hash;
+    CDiskBlockIndex diskindex;
+};
+
+} // namespace
+
 bool CBlockTreeDB::LoadBlockIndexGuts(const Consensus::Params& consensusParams, std::function<CBlockIndex*(const uint256&)> insertBlockIndex)
 {
-    std::unique_ptr<CDBIterator> pcursor(NewIterator());
+    const int64_t nStart = GetTimeMillis();
+    const int nThreads = std::max(1, std::min(GetNumCores(), MAX_BLOCK_INDEX_LOAD_THREADS));
+
+    // Block hashes are uniformly distributed, so splitting the key range by
+    // the first byte of the hash gives every thread a similar share. Each
+    // thread deserializes its entries, recomputes their hashes and checks
+    // their proof of work; m_block_index is only touched by this thread.
+    std::vector<std::vector<LoadedBlockIndex>> vLoaded(nThreads);
+    std::vector<std::string> vErrors(nThreads);
+    std::atomic<bool> fAbort{false};
+
+    auto loadRange = [&](int nRange) {
+        const int nBegin = 256 * nRange / nThreads;
+        const int nEnd = 256 * (nRange + 1) / nThreads;
+        uint256 start;
+        *start.begin() = nBegin;
+
+        std::unique_ptr<CDBIterator> pcursor(NewIterator());
+        pcursor->Seek(std::make_pair(DB_BLOCK_INDEX, start));
+        while (pcursor->Valid()) {
+            if (fAbort || ShutdownRequested()) {
+                fAbort = true;
+                return;
+            }
+            std::pair<char, uint256> key;
+            if (!pcursor->GetKey(key) || key.first != DB_BLOCK_INDEX || *key.second.begin() >= nEnd) {
+                break;
+            }
+            LoadedBlockIndex loaded;
+            if (!pcursor->GetValue(loaded.diskindex)) {
+                vErrors[nRange] = "failed to read value";
+                fAbort = true;
+                return;
+            }
+            loaded.hash = loaded.diskindex.GetBlockHash();
+            if (!CheckProofOfWork(loaded.hash, loaded.diskindex.nBits, consensusParams)) {
+                vErrors[nRange] = strprintf("CheckProofOfWork failed: %s", loaded.diskindex.ToString());
+                fAbort = true;
+                return;
+            }
+            vLoaded[nRange].push_back(std::move(loaded));
+            pcursor->Next();
+        }
+    };
 
-    pcursor->Seek(std::make_pair(DB_BLOCK_INDEX, uint256()));
+    boost::this_thread::interruption_point();
+    std::vector<std::thread> threads;
+    for (int i = 1; i < nThreads; i++) {
+        threads.emplace_back(loadRange, i);
+    }
+    loadRange(0);
+
+    // Load m_block_index, range by range as the threads finish
+    size_t nEntries = 0;
+    int64_t nInsertTime = 0;
+    for (int i = 0; i < nThreads; i++) {
+        if (i > 0) {
+            threads[i - 1].join();
+        }
+        if (fAbort) {
+            continue;
+        }
 
-    // Load m_block_index
-    while (pcursor->Valid()) {
-        boost::this_thread::interruption_point();
-        if (ShutdownRequested()) return false;
-        std::pair<char, uint256> key;
-        if (pcursor->GetKey(key) && key.first == DB_BLOCK_INDEX) {
-            CDiskBlockIndex diskindex;
-            if (pcursor->GetValue(diskindex)) {
-                // Construct block index object
-                CBlockIndex* pindexNew = insertBlockIndex(diskindex.GetBlockHash());
-                pindexNew->pprev          = insertBlockIndex(diskindex.hashPrev);
-                pindexNew->nHeight        = diskindex.nHeight;
-                pindexNew->nFile          = diskindex.nFile;
-                pindexNew->nDataPos       = diskindex.nDataPos;
-                pindexNew->nUndoPos       = diskindex.nUndoPos;
-                pindexNew->nVersion       = diskindex.nVersion;
-                pindexNew->hashMerkleRoot = diskindex.hashMerkleRoot;
-                pindexNew->nTime          = diskindex.nTime;
-                pindexNew->nBits          = diskindex.nBits;
-                pindexNew->nNonce         = diskindex.nNonce;
-                pindexNew->nStatus        = diskindex.nStatus;
-                pindexNew->nTx            = diskindex.nTx;
-
-                if (!CheckProofOfWork(pindexNew->GetBlockHash(), pindexNew->nBits, consensusParams))
-                    return error("%s: CheckProofOfWork failed: %s", __func__, pindexNew->ToString());
-
-                pcursor->Next();
-            } else {
-                return error("%s: failed to read value", __func__);
-            }
-        } else {
-            break;
+        const int64_t nInsertStart = GetTimeMillis();
+        for (const LoadedBlockIndex& loaded : vLoaded[i]) {
+            const CDiskBlockIndex& diskindex = loaded.diskindex;
+            // Construct block index object
+            CBlockIndex* pindexNew = insertBlockIndex(loaded.hash);
+            pindexNew->pprev          = insertBlockIndex(diskindex.hashPrev);
+            pindexNew->nHeight        = diskindex.nHeight;
+            pindexNew->nFile          = diskindex.nFile;
+            pindexNew->nDataPos       = diskindex.nDataPos;
+            pindexNew->nUndoPos       = diskindex.nUndoPos;
+            pindexNew->nVersion       = diskindex.nVersion;
+            pindexNew->hashMerkleRoot = diskindex.hashMerkleRoot;
+            pindexNew->nTime          = diskindex.nTime;
+            pindexNew->nBits          = diskindex.nBits;
+            pindexNew->nNonce         = diskindex.nNonce;
+            pindexNew->nStatus        = diskindex.nStatus;
+            pindexNew->nTx            = diskindex.nTx;
+        }
+        nEntries += vLoaded[i].size();
+        std::vector<LoadedBlockIndex>().swap(vLoaded[i]);
+        nInsertTime += GetTimeMillis() - nInsertStart;
+    }
+
+    for (const std::string& strError : vErrors) {
+        if (!strError.empty()) {
+            return error("%s: %s", __func__, strError);
         }
     }
+    if (fAbort) {
+        return false;
+    }
 
+    LogPrintf("%s: loaded %u block index entries in %dms (%d threads, %dms inserting)\n", __func__, nEntries, GetTimeMillis() - nStart, nThreads, nInsertTime);
     return true;
 }
 
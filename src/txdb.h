@@ -40,6 +40,18 @@ static const int64_t nMaxTxIndexCache = 1024;
 static const int64_t max_filter_index_cache = 1024;
 //! Max memory allocated to coin DB specific cache (MiB)
 static const int64_t nMaxCoinsDBCache = 8;
+//! Max threads reading and checking block index entries at startup
+static const int MAX_BLOCK_INDEX_LOAD_THREADS = 8;
+//! Max threads reading coins of one CCoinsViewDB::GetCoins call
+static const int MAX_COINS_READ_THREADS = 8;
+//! Min coins read by each thread of a CCoinsViewDB::GetCoins call
+static const size_t MIN_COINS_PER_READ_THREAD = 64;
+
+/** Whether there are dedicated threads reading the coins of CCoinsViewDB::GetCoins. */
+extern bool g_parallel_coins_reads;
+
+/** Run an instance of the coins read thread */
+void ThreadCoinsRead(int worker_num);
 
 /** CCoinsView backed by the coin database (chainstate/) */
 class CCoinsViewDB final : public CCoinsView
@@ -54,6 +66,8 @@ public:
 
     bool GetCoin(const COutPoint &outpoint, Coin &coin) const override;
     bool HaveCoin(const COutPoint &outpoint) const override;
+    //! Reads the coins in key order, split across the calling thread and the coins read threads
+    size_t GetCoins(const std::vector<COutPoint>& outpoints, std::vector<Coin>& coins) const override;
     uint256 GetBestBlock() const override;
     std::vector<uint256> GetHeadBlocks() const override;
     bool BatchWrite(CCoinsMap &mapCoins, const uint256 &hashBlock) override;
@@ -8,6 +8,8 @@
 #include <validation.h>
 
 #include <arith_uint256.h>
+#include <blockfilemap.h>
+#include <blockreadahead.h>
 #include <chain.h>
 #include <chainparams.h>
 #include <checkqueue.h>
@@ -16,6 +18,7 @@
 #include <consensus/tx_check.h>
 #include <consensus/tx_verify.h>
 #include <consensus/validation.h>
+#include <crypto/common.h>
 #include <cuckoocache.h>
 #include <flatfile.h>
 #include <functional>
@@ -53,7 +56,10 @@
 #include <vbk/pop_service.hpp>
 #include <vbk/util.hpp>
 
+#include <atomic>
+#include <condition_variable>
 #include <string>
+#include <thread>
 
 #include <vbk/merkle.hpp>
 #include <boost/algorithm/string/replace.hpp>
@@ -120,6 +126,8 @@ Mutex g_best_block_mutex;
 std::condition_variable g_best_block_cv;
 uint256 g_best_block;
 bool g_parallel_script_checks{false};
+bool g_parallel_block_parse{false};
+bool g_parallel_block_checks{false};
 std::atomic_bool fImporting(false);
 std::atomic_bool fReindex(false);
 bool fHavePruned = false;
@@ -1121,18 +1129,72 @@ static bool WriteBlockToDisk(const CBlock& block, FlatFilePos& pos, const CMessa
     return true;
 }
 
+static BlockFileMapCache g_block_file_maps(DEFAULT_MAX_MAPPED_BLOCK_FILES);
+
+void SetMaxMappedBlockFiles(size_t nMaxFiles)
+{
+    g_block_file_maps.SetMaxFiles(nMaxFiles);
+}
+
+/**
+ * Map the block file holding the block at pos. On success `data` covers the
+ * block together with the network magic and size stored in front of it.
+ * Returns nullptr if the file cannot be mapped or the stored size is out of
+ * range, the caller then reads the block through stdio.
+ */
+static std::shared_ptr<const MappedBlockFile> MapBlockData(const FlatFilePos& pos, Span<const unsigned char>& data)
+{
+    if (pos.nPos < 8)
+        return nullptr;
+    const fs::path path = GetBlockPosFilename(pos);
+    std::shared_ptr<const MappedBlockFile> file = g_block_file_maps.Get(path, pos.nPos);
+    if (!file)
+        return nullptr;
+
+    const uint32_t nSize = ReadLE32(file->data().data() + pos.nPos - 4);
+    if (nSize > MAX_SIZE)
+        return nullptr;
+    const size_t nEnd = (size_t)pos.nPos + nSize;
+    if (file->size() < nEnd) {
+        file = g_block_file_maps.Get(path, nEnd);
+        if (!file)
+            return nullptr;
+    }
+
+    data = file->data().subspan(pos.nPos - 8, (size_t)nSize + 8);
+    return file;
+}
+
+/**
+ * Deserialize the block at pos straight out of its memory-mapped block file.
+ * Returns false without touching the block if the file cannot be mapped.
+ */
+static bool ReadBlockFromMappedFile(CBlock& block, const FlatFilePos& pos)
+{
+    Span<const unsigned char> data;
+    std::shared_ptr<const MappedBlockFile> file = MapBlockData(pos, data);
+    if (!file)
+        return false;
+
+    SpanReader reader(SER_DISK, CLIENT_VERSION, data.subspan(8));
+    reader >> block;
+    return true;
+}
+
 bool ReadBlockFromDisk(CBlock& block, const FlatFilePos& pos, const Consensus::Params& consensusParams)
 {
     block.SetNull();
 
-    // Open history file to read
-    CAutoFile filein(OpenBlockFile(pos, true), SER_DISK, CLIENT_VERSION);
-    if (filein.IsNull())
-        return error("ReadBlockFromDisk: OpenBlockFile failed for %s", pos.ToString());
-
-    // Read block
     try {
-        filein >> block;
+        if (!ReadBlockFromMappedFile(block, pos)) {
+            // Open history file to read
+            CAutoFile filein(OpenBlockFile(pos, true), SER_DISK, CLIENT_VERSION);
+            if (filein.IsNull())
+                return error("ReadBlockFromDisk: OpenBlockFile failed for %s", pos.ToString());
+
+            // Read block
+            filein >> block;
+        }
     } catch (const std::exception& e) {
         return error("%s: Deserialize or I/O error - %s at %s", __func__, e.what(), pos.ToString());
     }
@@ -1162,6 +1224,17 @@ bool ReadBlockFromDisk(CBlock& block, const CBlockIndex* pindex, const Consensus
 
 bool ReadRawBlockFromDisk(std::vector<uint8_t>& block, const FlatFilePos& pos, const CMessageHeader::MessageStartChars& message_start)
 {
+    Span<const unsigned char> data;
+    if (std::shared_ptr<const MappedBlockFile> file = MapBlockData(pos, data)) {
+        if (memcmp(data.data(), message_start, CMessageHeader::MESSAGE_START_SIZE)) {
+            return error("%s: Block magic mismatch for %s: %s versus expected %s", __func__, pos.ToString(),
+                HexStr(data.begin(), data.begin() + CMessageHeader::MESSAGE_START_SIZE),
+                HexStr(message_start, message_start + CMessageHeader::MESSAGE_START_SIZE));
+        }
+        block.assign(data.begin() + 8, data.end());
+        return true;
+    }
+
     FlatFilePos hpos = pos;
     hpos.nPos -= 8; // Seek back 8 bytes for meta header
     CAutoFile filein(OpenBlockFile(hpos, true), SER_DISK, CLIENT_VERSION);
@@ -1581,9 +1654,9 @@ static bool UndoWriteToDisk(const CBlockUndo& blockundo, FlatFilePos& pos, const
     return true;
 }
 
-bool UndoReadFromDisk(CBlockUndo& blockundo, const CBlockIndex* pindex)
+//! Read the undo data at pos, of the block whose parent is hashPrev
+static bool UndoReadFromDisk(CBlockUndo& blockundo, const FlatFilePos& pos, const uint256& hashPrev)
 {
-    FlatFilePos pos = pindex->GetUndoPos();
     if (pos.IsNull()) {
         return error("%s: no undo data available", __func__);
     }
@@ -1597,7 +1670,7 @@ bool UndoReadFromDisk(CBlockUndo& blockundo, const CBlockIndex* pindex)
     uint256 hashChecksum;
     CHashVerifier<CAutoFile> verifier(&filein); // We need a CHashVerifier as reserializing may lose data
     try {
-        verifier << pindex->pprev->GetBlockHash();
+        verifier << hashPrev;
         verifier >> blockundo;
         filein >> hashChecksum;
     } catch (const std::exception& e) {
@@ -1611,6 +1684,11 @@ bool UndoReadFromDisk(CBlockUndo& blockundo, const CBlockIndex* pindex)
     return true;
 }
 
+bool UndoReadFromDisk(CBlockUndo& blockundo, const CBlockIndex* pindex)
+{
+    return UndoReadFromDisk(blockundo, pindex->GetUndoPos(), pindex->pprev->GetBlockHash());
+}
+
 /** Abort with a message */
 static bool AbortNode(const std::string& strMessage, const std::string& userMessage = "", unsigned int prefix = 0)
 {
@@ -1735,6 +1813,11 @@ void static FlushBlockFile(bool fFinalize = false)
     FlatFilePos block_pos_old(nLastBlockFile, vinfoBlockFile[nLastBlockFile].nSize);
     FlatFilePos undo_pos_old(nLastBlockFile, vinfoBlockFile[nLastBlockFile].nUndoSize);
 
+    if (fFinalize) {
+        // finalizing truncates the preallocated tail of the file
+        g_block_file_maps.Invalidate(GetBlockPosFilename(block_pos_old));
+    }
+
     bool status = true;
     status &= BlockFileSeq().Flush(block_pos_old, fFinalize);
     status &= UndoFileSeq().Flush(undo_pos_old, fFinalize);
@@ -1875,6 +1958,9 @@ static unsigned int GetBlockScriptFlags(const CBlockIndex* pindex, const Consens
 
 static int64_t nTimeCheck = 0;
 static int64_t nTimeForks = 0;
+static int64_t nTimePrefetch = 0;
+static uint64_t nPrefetchInputs = 0;
+static uint64_t nPrefetchLookups = 0;
 static int64_t nTimeVerify = 0;
 static int64_t nTimeConnect = 0;
 static int64_t nTimeIndex = 0;
@@ -2070,6 +2156,38 @@ bool CChainState::ConnectBlock(const CBlock& block, BlockValidationState& state,
     nTimeForks += nTime2 - nTime1;
     LogPrint(BCLog::BENCH, "    - Fork checks: %.2fms [%.2fs (%.2fms/blk)]\n", MILLI * (nTime2 - nTime1), nTimeForks * MICRO, nTimeForks * MILLI / nBlocksTotal);
 
+    // Load the coins spent by this block before the sequential input checks,
+    // so that the ones missing from the cache are read from the database in
+    // one batch instead of one lookup at a time. Outputs created earlier in
+    // the same block are skipped, they are not in the database yet.
+    {
+        std::vector<uint256> vBlockTxids;
+        vBlockTxids.reserve(block.vtx.size());
+        for (const auto& tx : block.vtx) {
+            vBlockTxids.push_back(tx->GetHash());
+        }
+        std::sort(vBlockTxids.begin(), vBlockTxids.end());
+
+        std::vector<COutPoint> vPrevouts;
+        for (const auto& tx : block.vtx) {
+            if (tx->IsCoinBase()) continue;
+            for (const CTxIn& txin : tx->vin) {
+                if (!std::binary_search(vBlockTxids.begin(), vBlockTxids.end(), txin.prevout.hash)) {
+                    vPrevouts.push_back(txin.prevout);
+                }
+            }
+        }
+        const size_t nLookups = view.Prefetch(vPrevouts);
+        nPrefetchInputs += vPrevouts.size();
+        nPrefetchLookups += nLookups;
+
+        int64_t nTimePrefetched = GetTimeMicros();
+        nTimePrefetch += nTimePrefetched - nTime2;
+        LogPrint(BCLog::BENCH, "    - Prefetch %u txins: %.2fms (%u read from the database) [%.2fs (%.2fms/blk), %.1f%% cache hits]\n", vPrevouts.size(), MILLI * (nTimePrefetched - nTime2), nLookups,
+            nTimePrefetch * MICRO, nTimePrefetch * MILLI / nBlocksTotal, nPrefetchInputs == 0 ? 100.0 : 100.0 * (nPrefetchInputs - nPrefetchLookups) / nPrefetchInputs);
+        nTime2 = nTimePrefetched;
+    }
+
     CBlockUndo blockundo;
 
     CCheckQueueControl<CScriptCheck> control(fScriptChecks && g_parallel_script_checks ? &scriptcheckqueue : nullptr);
@@ -2195,6 +2313,12 @@ bool CChainState::ConnectBlock(const CBlock& block, BlockValidationState& state,
     return true;
 }
 
+int64_t GetCoinsCacheSpace(int64_t nTotalSpace, int64_t nPopTreesUsage)
+{
+    const int64_t nMinSpace = nTotalSpace * MIN_COINS_CACHE_SPACE_PERCENT / 100;
+    return std::max(nTotalSpace - nPopTreesUsage, nMinSpace);
+}
+
 bool CChainState::FlushStateToDisk(
     const CChainParams& chainparams,
     BlockValidationState& state,
@@ -2247,6 +2371,15 @@ bool CChainState::FlushStateToDisk(
             int64_t nMempoolSizeMax = gArgs.GetArg("-maxmempool", DEFAULT_MAX_MEMPOOL_SIZE) * 1000000;
             int64_t cacheSize = CoinsTip().DynamicMemoryUsage();
             int64_t nTotalSpace = nCoinCacheUsage + std::max<int64_t>(nMempoolSizeMax - nMempoolUsage, 0);
+            // The in-memory PoP trees can not be flushed, but share the -dbcache budget with the coins cache.
+            int64_t nPopTreesUsage = VeriBlock::getPopTreesMemoryUsage().total();
+            int64_t nCoinsSpace = GetCoinsCacheSpace(nTotalSpace, nPopTreesUsage);
+            static bool fWarnedPopTreesUsage = false;
+            if (nCoinsSpace > nTotalSpace - nPopTreesUsage && !fWarnedPopTreesUsage) {
+                LogPrintf("Warning: PoP trees use %.1f MiB of the %.1f MiB cache size. Consider increasing -dbcache\n", nPopTreesUsage * (1.0 / 1024 / 1024), nTotalSpace * (1.0 / 1024 / 1024));
+                fWarnedPopTreesUsage = true;
+            }
+            nTotalSpace = nCoinsSpace;
             // The cache is large and we're within 10% and 10 MiB of the limit, but we have time now (not in the middle of a block processing).
             bool fCacheLarge = mode == FlushStateMode::PERIODIC && cacheSize > std::max((9 * nTotalSpace) / 10, nTotalSpace - MAX_BLOCK_COINSDB_USAGE * 1024 * 1024);
             // The cache is over the limit, we have to write now.
@@ -2569,11 +2702,17 @@ bool CChainState::ConnectTip(BlockValidationState& state, const CChainParams& ch
     // Read block from disk.
     int64_t nTime1 = GetTimeMicros();
     std::shared_ptr<const CBlock> pthisBlock;
+    bool fReadAhead = false;
     if (!pblock) {
-        std::shared_ptr<CBlock> pblockNew = std::make_shared<CBlock>();
-        if (!ReadBlockFromDisk(*pblockNew, pindexNew, chainparams.GetConsensus()))
-            return AbortNode(state, "Failed to read block");
-        pthisBlock = pblockNew;
+        // usually read in the background while the previous block was connected
+        pthisBlock = TakeReadAheadBlock(pindexNew);
+        fReadAhead = pthisBlock != nullptr;
+        if (!pthisBlock) {
+            std::shared_ptr<CBlock> pblockNew = std::make_shared<CBlock>();
+            if (!ReadBlockFromDisk(*pblockNew, pindexNew, chainparams.GetConsensus()))
+                return AbortNode(state, "Failed to read block");
+            pthisBlock = pblockNew;
+        }
     } else {
         pthisBlock = pblock;
     }
@@ -2582,7 +2721,7 @@ bool CChainState::ConnectTip(BlockValidationState& state, const CChainParams& ch
     int64_t nTime2 = GetTimeMicros();
     nTimeReadFromDisk += nTime2 - nTime1;
     int64_t nTime3;
-    LogPrint(BCLog::BENCH, "  - Load block from disk: %.2fms [%.2fs]\n", (nTime2 - nTime1) * MILLI, nTimeReadFromDisk * MICRO);
+    LogPrint(BCLog::BENCH, "  - Load block from disk: %.2fms [%.2fs]%s\n", (nTime2 - nTime1) * MILLI, nTimeReadFromDisk * MICRO, fReadAhead ? " (read ahead)" : "");
     {
         CCoinsViewCache view(&CoinsTip());
         bool rv = ConnectBlock(blockConnecting, state, pindexNew, view, chainparams);
@@ -2760,6 +2899,10 @@ bool CChainState::ActivateBestChainStep(BlockValidationState& state, const CChai
         fBlocksDisconnected = true;
     }
 
+    // Read the blocks ahead in the background while the next ones are connected.
+    // VeriBlock: this also fills the PoP payload cache.
+    ScheduleBlockReadAhead(pindexFork, pindexMostWork);
+
     // Build list of new blocks to connect.
     std::vector<CBlockIndex*> vpindexToConnect;
     bool fContinue = true;
@@ -3375,6 +3518,55 @@ static bool CheckBlockHeader(const CBlockHeader& block, BlockValidationState& st
     return true;
 }
 
+namespace {
+
+/**
+ * Closure running one part of the checks of a block on the block check
+ * workers. Every part records its own result, so that all parts run and the
+ * caller can report the first failure in block order.
+ */
+class CBlockCheck
+{
+private:
+    std::function<void()> m_check;
+
+public:
+    CBlockCheck() = default;
+    explicit CBlockCheck(std::function<void()> check) : m_check(std::move(check)) {}
+
+    bool operator()()
+    {
+        m_check();
+        return true;
+    }
+
+    void swap(CBlockCheck& check) { m_check.swap(check.m_check); }
+};
+
+} // namespace
+
+static CCheckQueue<CBlockCheck> blockcheckqueue(4);
+
+void ThreadBlockCheck(int worker_num)
+{
+    util::ThreadRename(strprintf("blkcheck.%i", worker_num));
+    blockcheckqueue.Thread();
+}
+
+//! Run the checks on the block check workers, helped by the calling thread, or on the calling thread alone
+static void RunBlockChecks(std::vector<CBlockCheck>& vChecks)
+{
+    if (g_parallel_block_checks && vChecks.size() > 1) {
+        CCheckQueueControl<CBlockCheck> control(&blockcheckqueue);
+        control.Add(vChecks);
+        control.Wait();
+        return;
+    }
+    for (CBlockCheck& check : vChecks) {
+        check();
+    }
+}
+
 bool CheckBlock(const CBlock& block, BlockValidationState& state, const Consensus::Params& consensusParams, bool fCheckPOW)
 {
     // These are checks that are independent of context.
@@ -3416,19 +3608,39 @@ bool CheckBlock(const CBlock& block, BlockValidationState& state, const Consensu
 
     // Check transactions
     // Must check for duplicate inputs (see CVE-2018-17144)
-    for (const auto& tx : block.vtx) {
-        TxValidationState tx_state;
-        if (!CheckTransaction(*tx, tx_state)) {
+    // The transactions are checked and their sigops counted in ranges on the
+    // block check workers.
+    const size_t nRanges = (block.vtx.size() + BLOCK_CHECK_TXS_PER_RANGE - 1) / BLOCK_CHECK_TXS_PER_RANGE;
+    std::vector<size_t> vFailedTx(nRanges, block.vtx.size());
+    std::vector<TxValidationState> vTxStates(nRanges);
+    std::vector<unsigned int> vSigOps(nRanges, 0);
+    std::vector<CBlockCheck> vChecks;
+    vChecks.reserve(nRanges);
+    for (size_t r = 0; r < nRanges; r++) {
+        vChecks.emplace_back([&block, &vFailedTx, &vTxStates, &vSigOps, r] {
+            const size_t nEnd = std::min(block.vtx.size(), (r + 1) * BLOCK_CHECK_TXS_PER_RANGE);
+            for (size_t i = r * BLOCK_CHECK_TXS_PER_RANGE; i < nEnd; i++) {
+                if (!CheckTransaction(*block.vtx[i], vTxStates[r])) {
+                    vFailedTx[r] = i;
+                    return;
+                }
+                vSigOps[r] += GetLegacySigOpCount(*block.vtx[i]);
+            }
+        });
+    }
+    RunBlockChecks(vChecks);
+
+    unsigned int nSigOps = 0;
+    for (size_t r = 0; r < nRanges; r++) {
+        if (vFailedTx[r] != block.vtx.size()) {
+            const TxValidationState& tx_state = vTxStates[r];
             // CheckBlock() does context-free validation checks. The only
             // possible failures are consensus failures.
             assert(tx_state.GetResult() == TxValidationResult::TX_CONSENSUS);
             return state.Invalid(BlockValidationResult::BLOCK_CONSENSUS, tx_state.GetRejectReason(),
-                strprintf("Transaction check failed (tx hash %s) %s", tx->GetHash().ToString(), tx_state.GetDebugMessage()));
+                strprintf("Transaction check failed (tx hash %s) %s", block.vtx[vFailedTx[r]]->GetHash().ToString(), tx_state.GetDebugMessage()));
         }
-    }
-    unsigned int nSigOps = 0;
-    for (const auto& tx : block.vtx) {
-        nSigOps += GetLegacySigOpCount(*tx);
+        nSigOps += vSigOps[r];
     }
     if (nSigOps * WITNESS_SCALE_FACTOR > MAX_BLOCK_SIGOPS_COST)
         return state.Invalid(BlockValidationResult::BLOCK_CONSENSUS, "bad-blk-sigops", "out-of-bounds SigOpCount");
@@ -3579,7 +3791,29 @@ bool ContextualCheckBlock(const CBlock& block, BlockValidationState& state, cons
     }
 
     // VeriBlock: merkle tree verification is moved from CheckBlock here, because it requires correct CBlockIndex
-    if (fCheckMerkleRoot && !VeriBlock::VerifyTopLevelMerkleRoot(block, state, pindexPrev)) {
+    // The top level merkle root and the witness merkle root, which is only
+    // compared further down, are computed on the block check workers.
+    const int commitpos = nHeight >= consensusParams.SegwitHeight ? GetWitnessCommitmentIndex(block) : -1;
+    bool fMerkleRootValid = true;
+    uint256 hashWitness;
+    {
+        std::vector<CBlockCheck> vChecks;
+        if (fCheckMerkleRoot) {
+            vChecks.emplace_back([&block, &state, pindexPrev, &fMerkleRootValid] {
+                fMerkleRootValid = VeriBlock::VerifyTopLevelMerkleRoot(block, state, pindexPrev);
+            });
+        }
+        if (commitpos != -1) {
+            vChecks.emplace_back([&block, &hashWitness] {
+                // The malleation check is ignored; as the transaction tree itself
+                // already does not permit it, it is impossible to trigger in the
+                // witness tree.
+                hashWitness = BlockWitnessMerkleRoot(block, nullptr);
+            });
+        }
+        RunBlockChecks(vChecks);
+    }
+    if (!fMerkleRootValid) {
         // state is already set with error message
         return false;
     }
@@ -3612,13 +3846,7 @@ bool ContextualCheckBlock(const CBlock& block, BlockValidationState& state, cons
     //   multiple, the last one is used.
     bool fHaveWitness = false;
     if (nHeight >= consensusParams.SegwitHeight) {
-        int commitpos = GetWitnessCommitmentIndex(block);
         if (commitpos != -1) {
-            bool malleated = false;
-            uint256 hashWitness = BlockWitnessMerkleRoot(block, &malleated);
-            // The malleation check is ignored; as the transaction tree itself
-            // already does not permit it, it is impossible to trigger in the
-            // witness tree.
             if (block.vtx[0]->vin[0].scriptWitness.stack.size() != 1 || block.vtx[0]->vin[0].scriptWitness.stack[0].size() != 32) {
                 return state.Invalid(BlockValidationResult::BLOCK_MUTATED, "bad-witness-nonce-size", strprintf("%s : invalid witness reserved value size", __func__));
             }
@@ -3652,7 +3880,7 @@ bool ContextualCheckBlock(const CBlock& block, BlockValidationState& state, cons
     return true;
 }
 
-bool BlockManager::AcceptBlockHeader(const CBlockHeader& block, BlockValidationState& state, const CChainParams& chainparams, CBlockIndex** ppindex)
+bool BlockManager::AcceptBlockHeader(const CBlockHeader& block, BlockValidationState& state, const CChainParams& chainparams, CBlockIndex** ppindex, std::vector<CBlockIndex*>* pvPopHeaders)
 {
     AssertLockHeld(cs_main);
     // Check for duplicate
@@ -3735,29 +3963,69 @@ bool BlockManager::AcceptBlockHeader(const CBlockHeader& block, BlockValidationS
     if (ppindex)
         *ppindex = pindex;
 
+    if (pvPopHeaders) {
+        pvPopHeaders->push_back(pindex);
+        return true;
+    }
+
     if (!VeriBlock::acceptBlock(*pindex, state)) {
         return error("%s: ALT tree could not accept block ALT:%d:%s, reason: %s", __func__, pindex->nHeight, pindex->GetBlockHash().ToString(), state.ToString());
     }
     return true;
 }
 
+/** VeriBlock: accept a run of new headers into the ALT tree, headers it rejects are marked invalid. */
+static bool AcceptPopHeaders(const std::vector<CBlockIndex*>& vpindex, BlockValidationState& state) EXCLUSIVE_LOCKS_REQUIRED(cs_main)
+{
+    std::vector<CBlockIndex*> failed;
+    if (VeriBlock::acceptBlocks(vpindex, failed, state)) {
+        return true;
+    }
+
+    // failed headers are in height order, children of a rejected header are rejected as well
+    for (CBlockIndex* pindex : failed) {
+        if (pindex->pprev && (pindex->pprev->nStatus & BLOCK_FAILED_MASK)) {
+            pindex->nStatus |= BLOCK_FAILED_CHILD;
+        } else {
+            pindex->nStatus |= BLOCK_FAILED_VALID;
+            g_blockman.m_failed_blocks.insert(pindex);
+        }
+        setDirtyBlockIndex.insert(pindex);
+    }
+    return error("%s: ALT tree could not accept block ALT:%d:%s, reason: %s", __func__, failed.front()->nHeight, failed.front()->GetBlockHash().ToString(), state.ToString());
+}
+
 // Exposed wrapper for AcceptBlockHeader
 bool ProcessNewBlockHeaders(const std::vector<CBlockHeader>& headers, BlockValidationState& state, const CChainParams& chainparams, const CBlockIndex** ppindex)
 {
     {
         LOCK(cs_main);
+        // VeriBlock: new headers are added to the ALT tree in one batch, reusing the hashes of their block index
+        std::vector<CBlockIndex*> vpindexPop;
+        vpindexPop.reserve(headers.size());
+        bool accepted = true;
         for (const CBlockHeader& header : headers) {
             CBlockIndex* pindex = nullptr; // Use a temp pindex instead of ppindex to avoid a const_cast
-            bool accepted = g_blockman.AcceptBlockHeader(header, state, chainparams, &pindex);
+            accepted = g_blockman.AcceptBlockHeader(header, state, chainparams, &pindex, &vpindexPop);
             ::ChainstateActive().CheckBlockIndex(chainparams.GetConsensus());
 
             if (!accepted) {
-                return false;
+                break;
             }
             if (ppindex) {
                 *ppindex = pindex;
             }
         }
+
+        // headers accepted before a rejected one are kept, like before
+        BlockValidationState popState;
+        if (!AcceptPopHeaders(vpindexPop, popState) && accepted) {
+            state = popState;
+            accepted = false;
+        }
+        if (!accepted) {
+            return false;
+        }
     }
     if (NotifyHeaderTip()) {
         if (::ChainstateActive().IsInitialBlockDownload() && ppindex && *ppindex) {
@@ -4014,6 +4282,7 @@ void UnlinkPrunedFiles(const std::set<int>& setFilesToPrune)
 {
     for (std::set<int>::iterator it = setFilesToPrune.begin(); it != setFilesToPrune.end(); ++it) {
         FlatFilePos pos(*it, 0);
+        g_block_file_maps.Invalidate(BlockFileSeq().FileName(pos));
         fs::remove(BlockFileSeq().FileName(pos));
         fs::remove(UndoFileSeq().FileName(pos));
         LogPrintf("Prune: %s deleted blk/rev (%05u)\n", __func__, *it);
@@ -4355,6 +4624,219 @@ CVerifyDB::~CVerifyDB()
     uiInterface.ShowProgress("", 100, false);
 }
 
+namespace {
+
+class VerifyDBBatch;
+
+/**
+ * Worker threads of one CVerifyDB::VerifyDB run. They are started once and
+ * check the blocks of one batch at a time, the caller starts the next batch
+ * after it waited for the previous one.
+ */
+class VerifyDBWorkers
+{
+public:
+    explicit VerifyDBWorkers(int nThreads)
+    {
+        for (int i = 0; i < nThreads; ++i) {
+            m_threads.emplace_back([this] { Run(); });
+        }
+    }
+
+    ~VerifyDBWorkers()
+    {
+        {
+            LOCK(m_mutex);
+            m_interrupt = true;
+        }
+        m_cv.notify_all();
+        for (std::thread& thread : m_threads) {
+            thread.join();
+        }
+    }
+
+    VerifyDBWorkers(const VerifyDBWorkers&) = delete;
+    VerifyDBWorkers& operator=(const VerifyDBWorkers&) = delete;
+
+    //! Hand batch to the workers
+    void Start(VerifyDBBatch& batch);
+    //! Check the rest of batch on the calling thread, and wait until no worker is on it anymore
+    void Finish(VerifyDBBatch& batch);
+
+private:
+    void Run();
+
+    Mutex m_mutex;
+    std::condition_variable m_cv;
+    std::condition_variable m_done_cv;
+    //! the batch being checked, nullptr once it is finished
+    VerifyDBBatch* m_batch GUARDED_BY(m_mutex) = nullptr;
+    //! incremented for every batch, so that a worker picks each batch up once
+    uint64_t m_generation GUARDED_BY(m_mutex) = 0;
+    //! workers checking blocks of m_batch
+    int m_running GUARDED_BY(m_mutex) = 0;
+    bool m_interrupt GUARDED_BY(m_mutex) = false;
+    std::vector<std::thread> m_threads;
+};
+
+/**
+ * Reads a batch of blocks and runs the level 0-2 checks of CVerifyDB on them
+ * on the worker threads, so that the caller can disconnect or connect the
+ * previous batch meanwhile. Block and undo positions are taken in the
+ * constructor, under cs_main, the workers do not touch the block index.
+ */
+class VerifyDBBatch
+{
+public:
+    VerifyDBBatch(std::vector<const CBlockIndex*> indexes, const CChainParams& chainparams, int nCheckLevel, bool fKeepBlocks, VerifyDBWorkers& workers) EXCLUSIVE_LOCKS_REQUIRED(cs_main)
+        : m_indexes(std::move(indexes)), m_blocks(m_indexes.size()), m_errors(m_indexes.size()),
+          m_chainparams(chainparams), m_check_level(nCheckLevel), m_keep_blocks(fKeepBlocks), m_workers(workers)
+    {
+        AssertLockHeld(cs_main);
+        for (const CBlockIndex* pindex : m_indexes) {
+            m_hashes.push_back(pindex->GetBlockHash());
+            m_heights.push_back(pindex->nHeight);
+            m_positions.push_back(pindex->GetBlockPos());
+            m_undo_positions.push_back(pindex->GetUndoPos());
+            m_prev_hashes.push_back(pindex->pprev->GetBlockHash());
+        }
+        m_workers.Start(*this);
+    }
+
+    ~VerifyDBBatch()
+    {
+        m_interrupt = true;
+        Wait();
+    }
+
+    VerifyDBBatch(const VerifyDBBatch&) = delete;
+    VerifyDBBatch& operator=(const VerifyDBBatch&) = delete;
+
+    //! Wait until every block of the batch is checked, helping the workers
+    void Wait()
+    {
+        if (!m_finished) {
+            m_workers.Finish(*this);
+            m_finished = true;
+        }
+    }
+
+    //! Check blocks until none is left, called by the workers and by Wait
+    void Work()
+    {
+        for (size_t i = m_next++; i < m_indexes.size() && !m_interrupt; i = m_next++) {
+            try {
+                Check(i);
+            } catch (const std::exception& e) {
+                m_errors[i] = strprintf("VerifyDB(): *** %s at %d, hash=%s", e.what(), m_heights[i], m_hashes[i].ToString());
+            }
+        }
+    }
+
+    size_t size() const { return m_indexes.size(); }
+    const CBlockIndex* index(size_t i) const { return m_indexes[i]; }
+    //! The block, if the batch keeps blocks and it passed the checks
+    const std::shared_ptr<const CBlock>& block(size_t i) const { return m_blocks[i]; }
+    //! Why the block failed, empty if it passed
+    const std::string& failure(size_t i) const { return m_errors[i]; }
+
+private:
+    void Check(size_t i)
+    {
+        const int nHeight = m_heights[i];
+        const uint256& hash = m_hashes[i];
+        std::shared_ptr<CBlock> block = std::make_shared<CBlock>();
+        // check level 0: read from disk
+        if (!ReadBlockFromDisk(*block, m_positions[i], m_chainparams.GetConsensus()) || block->GetHash() != hash) {
+            m_errors[i] = strprintf("VerifyDB(): *** ReadBlockFromDisk failed at %d, hash=%s", nHeight, hash.ToString());
+            return;
+        }
+        // check level 1: verify block validity
+        BlockValidationState state;
+        if (m_check_level >= 1 && !CheckBlock(*block, state, m_chainparams.GetConsensus())) {
+            m_errors[i] = strprintf("VerifyDB: *** found bad block at %d, hash=%s (%s)\n",
+                nHeight, hash.ToString(), FormatStateMessage(state));
+            return;
+        }
+        // check level 2: verify undo validity
+        if (m_check_level >= 2) {
+            CBlockUndo undo;
+            if (!m_undo_positions[i].IsNull()) {
+                if (!UndoReadFromDisk(undo, m_undo_positions[i], m_prev_hashes[i])) {
+                    m_errors[i] = strprintf("VerifyDB(): *** found bad undo data at %d, hash=%s\n", nHeight, hash.ToString());
+                    return;
+                }
+            }
+        }
+        if (m_keep_blocks) {
+            m_blocks[i] = std::move(block);
+        }
+    }
+
+    const std::vector<const CBlockIndex*> m_indexes;
+    std::vector<uint256> m_hashes;
+    std::vector<int> m_heights;
+    std::vector<FlatFilePos> m_positions;
+    std::vector<FlatFilePos> m_undo_positions;
+    std::vector<uint256> m_prev_hashes;
+    std::vector<std::shared_ptr<const CBlock>> m_blocks;
+    std::vector<std::string> m_errors;
+    const CChainParams& m_chainparams;
+    const int m_check_level;
+    const bool m_keep_blocks;
+    VerifyDBWorkers& m_workers;
+    std::atomic<size_t> m_next{0};
+    std::atomic<bool> m_interrupt{false};
+    bool m_finished = false;
+};
+
+void VerifyDBWorkers::Start(VerifyDBBatch& batch)
+{
+    {
+        LOCK(m_mutex);
+        assert(m_batch == nullptr);
+        m_batch = &batch;
+        ++m_generation;
+    }
+    m_cv.notify_all();
+}
+
+void VerifyDBWorkers::Finish(VerifyDBBatch& batch)
+{
+    batch.Work();
+    WAIT_LOCK(m_mutex, lock);
+    // every block is taken, the batch is done once the workers on it are
+    m_done_cv.wait(lock, [this] { return m_running == 0; });
+    // workers that wake up later find nothing to do
+    m_batch = nullptr;
+}
+
+void VerifyDBWorkers::Run()
+{
+    uint64_t generation = 0;
+    while (true) {
+        VerifyDBBatch* batch;
+        {
+            WAIT_LOCK(m_mutex, lock);
+            m_cv.wait(lock, [&] { return m_interrupt || (m_batch != nullptr && m_generation != generation); });
+            if (m_interrupt) {
+                return;
+            }
+            generation = m_generation;
+            batch = m_batch;
+            ++m_running;
+        }
+        batch->Work();
+        {
+            LOCK(m_mutex);
+            --m_running;
+        }
+        m_done_cv.notify_all();
+    }
+}
+
+} // namespace
+
 bool CVerifyDB::VerifyDB(const CChainParams& chainparams, CCoinsView* coinsview, int nCheckLevel, int nCheckDepth)
 {
     LOCK(cs_main);
@@ -4372,6 +4854,29 @@ bool CVerifyDB::VerifyDB(const CChainParams& chainparams, CCoinsView* coinsview,
     int nGoodTransactions = 0;
     BlockValidationState state;
     int reportDone = 0;
+
+    // Blocks are read and checked in batches on worker threads, one batch
+    // ahead of the one that is disconnected at level 3. Two batches of blocks
+    // are kept in memory at most.
+    const int nThreads = std::max(1, std::min(GetNumCores(), MAX_VERIFYDB_THREADS));
+    const size_t nBatchSize = 2 * nThreads;
+    VerifyDBWorkers workers(nThreads);
+    const CBlockIndex* pindexBatch = ::ChainActive().Tip();
+    auto NextBatch = [&]() EXCLUSIVE_LOCKS_REQUIRED(cs_main) {
+        std::vector<const CBlockIndex*> indexes;
+        for (; pindexBatch && pindexBatch->pprev && indexes.size() < nBatchSize; pindexBatch = pindexBatch->pprev) {
+            // the same limits as below, the loop below logs them
+            if (pindexBatch->nHeight <= ::ChainActive().Height() - nCheckDepth) break;
+            if (fPruneMode && !(pindexBatch->nStatus & BLOCK_HAVE_DATA)) break;
+            indexes.push_back(pindexBatch);
+        }
+        return MakeUnique<VerifyDBBatch>(std::move(indexes), chainparams, nCheckLevel, nCheckLevel >= 3, workers);
+    };
+    std::unique_ptr<VerifyDBBatch> batch = NextBatch();
+    std::unique_ptr<VerifyDBBatch> batchAhead;
+    size_t nBatchPos = 0;
+    int64_t nStart = GetTimeMicros();
+
     LogPrintf("[0%%]..."); /* Continued */
     for (pindex = ::ChainActive().Tip(); pindex && pindex->pprev; pindex = pindex->pprev) {
         boost::this_thread::interruption_point();
@@ -4389,25 +4894,23 @@ bool CVerifyDB::VerifyDB(const CChainParams& chainparams, CCoinsView* coinsview,
             LogPrintf("VerifyDB(): block verification stopping at height %d (pruning, no data)\n", pindex->nHeight);
             break;
         }
-        CBlock block;
-        // check level 0: read from disk
-        if (!ReadBlockFromDisk(block, pindex, chainparams.GetConsensus()))
-            return error("VerifyDB(): *** ReadBlockFromDisk failed at %d, hash=%s", pindex->nHeight, pindex->GetBlockHash().ToString());
-        // check level 1: verify block validity
-        if (nCheckLevel >= 1 && !CheckBlock(block, state, chainparams.GetConsensus()))
-            return error("%s: *** found bad block at %d, hash=%s (%s)\n", __func__,
-                pindex->nHeight, pindex->GetBlockHash().ToString(), FormatStateMessage(state));
-        // check level 2: verify undo validity
-        if (nCheckLevel >= 2 && pindex) {
-            CBlockUndo undo;
-            if (!pindex->GetUndoPos().IsNull()) {
-                if (!UndoReadFromDisk(undo, pindex)) {
-                    return error("VerifyDB(): *** found bad undo data at %d, hash=%s\n", pindex->nHeight, pindex->GetBlockHash().ToString());
-                }
-            }
+        if (nBatchPos == batch->size()) {
+            batch = batchAhead ? std::move(batchAhead) : NextBatch();
+            nBatchPos = 0;
+        }
+        if (nBatchPos == 0) {
+            // levels 0-2 of this batch are done, start on the next one
+            batch->Wait();
+            batchAhead = NextBatch();
         }
+        assert(batch->index(nBatchPos) == pindex);
+        // check levels 0-2: read from disk, verify block and undo validity
+        if (!batch->failure(nBatchPos).empty())
+            return error("%s", batch->failure(nBatchPos));
+        const std::shared_ptr<const CBlock> pblock = batch->block(nBatchPos++);
         // check level 3: check for inconsistencies during memory-only disconnect of tip blocks
         if (nCheckLevel >= 3 && (coins.DynamicMemoryUsage() + ::ChainstateActive().CoinsTip().DynamicMemoryUsage()) <= nCoinCacheUsage) {
+            const CBlock& block = *pblock;
             assert(coins.GetBestBlock() == pindex->GetBlockHash());
             DisconnectResult res = ::ChainstateActive().DisconnectBlock(block, pindex, coins);
             if (res == DISCONNECT_FAILED) {
@@ -4423,14 +4926,29 @@ bool CVerifyDB::VerifyDB(const CChainParams& chainparams, CCoinsView* coinsview,
         if (ShutdownRequested())
             return true;
     }
+    batch.reset();
+    batchAhead.reset();
     if (pindexFailure)
         return error("VerifyDB(): *** coin database inconsistencies found (last %i blocks, %i good transactions before that)\n", ::ChainActive().Height() - pindexFailure->nHeight + 1, nGoodTransactions);
 
     // store block count as we move pindex at check level >= 4
     int block_count = ::ChainActive().Height() - pindex->nHeight;
+    int64_t nTimeDisconnect = GetTimeMicros();
 
     // check level 4: try reconnecting blocks
     if (nCheckLevel >= 4) {
+        // read the blocks to reconnect ahead on the worker threads, level 0 only
+        pindexBatch = pindex;
+        auto NextConnectBatch = [&]() EXCLUSIVE_LOCKS_REQUIRED(cs_main) {
+            std::vector<const CBlockIndex*> indexes;
+            while (pindexBatch != ::ChainActive().Tip() && indexes.size() < nBatchSize) {
+                pindexBatch = ::ChainActive().Next(pindexBatch);
+                indexes.push_back(pindexBatch);
+            }
+            return MakeUnique<VerifyDBBatch>(std::move(indexes), chainparams, 0, true, workers);
+        };
+        batch = NextConnectBatch();
+        nBatchPos = 0;
         while (pindex != ::ChainActive().Tip()) {
             boost::this_thread::interruption_point();
             const int percentageDone = std::max(1, std::min(99, 100 - (int)(((double)(::ChainActive().Height() - pindex->nHeight)) / (double)nCheckDepth * 50)));
@@ -4441,16 +4959,28 @@ bool CVerifyDB::VerifyDB(const CChainParams& chainparams, CCoinsView* coinsview,
             }
             uiInterface.ShowProgress(_("Verifying blocks...").translated, percentageDone, false);
             pindex = ::ChainActive().Next(pindex);
-            CBlock block;
-            if (!ReadBlockFromDisk(block, pindex, chainparams.GetConsensus()))
-                return error("VerifyDB(): *** ReadBlockFromDisk failed at %d, hash=%s", pindex->nHeight, pindex->GetBlockHash().ToString());
-            if (!::ChainstateActive().ConnectBlock(block, state, pindex, coins, chainparams))
+            if (nBatchPos == batch->size()) {
+                batch = batchAhead ? std::move(batchAhead) : NextConnectBatch();
+                nBatchPos = 0;
+            }
+            if (nBatchPos == 0) {
+                batch->Wait();
+                batchAhead = NextConnectBatch();
+            }
+            assert(batch->index(nBatchPos) == pindex);
+            if (!batch->failure(nBatchPos).empty())
+                return error("%s", batch->failure(nBatchPos));
+            const std::shared_ptr<const CBlock> pblock = batch->block(nBatchPos++);
+            if (!::ChainstateActive().ConnectBlock(*pblock, state, pindex, coins, chainparams))
                 return error("VerifyDB(): *** found unconnectable block at %d, hash=%s (%s)", pindex->nHeight, pindex->GetBlockHash().ToString(), FormatStateMessage(state));
         }
     }
+    int64_t nTimeConnect = GetTimeMicros();
 
     LogPrintf("[DONE].\n");
     LogPrintf("No coin database inconsistencies in last %i blocks (%i transactions)\n", block_count, nGoodTransactions);
+    LogPrint(BCLog::BENCH, "VerifyDB: checked and disconnected in %.2fms, reconnected in %.2fms, %d threads\n",
+        (nTimeDisconnect - nStart) * MILLI, (nTimeConnect - nTimeDisconnect) * MILLI, nThreads);
 
     return true;
 }
@@ -4779,6 +5309,61 @@ bool LoadGenesisBlock(const CChainParams& chainparams)
     return ::ChainstateActive().LoadGenesisBlock(chainparams);
 }
 
+namespace {
+
+/** A serialized block found in an external block file. */
+struct ExternalBlockFrame {
+    //! position of the serialized block in the block file
+    FlatFilePos pos;
+    //! where to resume scanning when the block can not be deserialized
+    uint64_t nRewindOnError{0};
+    std::vector<unsigned char> raw;
+    //! set by CBlockParseCheck, null if deserialization failed
+    std::shared_ptr<CBlock> block;
+    uint256 hash;
+};
+
+/**
+ * Closure deserializing one block of an external block file, including its
+ * PopData, so that LoadExternalBlockFile can decode blocks on the parse
+ * worker threads. Errors are reported through an empty ExternalBlockFrame::block.
+ */
+class CBlockParseCheck
+{
+private:
+    ExternalBlockFrame* m_frame{nullptr};
+
+public:
+    CBlockParseCheck() = default;
+    explicit CBlockParseCheck(ExternalBlockFrame& frame) : m_frame(&frame) {}
+
+    bool operator()()
+    {
+        try {
+            VectorReader stream(SER_DISK, CLIENT_VERSION, m_frame->raw, 0);
+            auto pblock = std::make_shared<CBlock>();
+            stream >> *pblock;
+            m_frame->hash = pblock->GetHash();
+            m_frame->block = std::move(pblock);
+        } catch (const std::exception& e) {
+            m_frame->block.reset();
+        }
+        return true;
+    }
+
+    void swap(CBlockParseCheck& check) { std::swap(m_frame, check.m_frame); }
+};
+
+} // namespace
+
+static CCheckQueue<CBlockParseCheck> blockparsequeue(8);
+
+void ThreadBlockParse(int worker_num)
+{
+    util::ThreadRename(strprintf("blkparse.%i", worker_num));
+    blockparsequeue.Thread();
+}
+
 bool LoadExternalBlockFile(const CChainParams& chainparams, FILE* fileIn, FlatFilePos* dbp)
 {
     // Map of disk positions for blocks with unknown parent (only used for reindex)
@@ -4786,116 +5371,188 @@ bool LoadExternalBlockFile(const CChainParams& chainparams, FILE* fileIn, FlatFi
     int64_t nStart = GetTimeMillis();
 
     int nLoaded = 0;
+    uint64_t nBytesParsed = 0;
     try {
         // This takes over fileIn and calls fclose() on it in the CBufferedFile destructor
         CBufferedFile blkdat(fileIn, 2 * MAX_BLOCK_SERIALIZED_SIZE, MAX_BLOCK_SERIALIZED_SIZE + 8, SER_DISK, CLIENT_VERSION);
         uint64_t nRewind = blkdat.GetPos();
-        while (!blkdat.eof()) {
+        std::vector<ExternalBlockFrame> frames;
+        bool fStop = false;
+        while (!fStop && !blkdat.eof()) {
             boost::this_thread::interruption_point();
 
-            blkdat.SetPos(nRewind);
-            nRewind++;         // start one byte further next time, in case of failure
-            blkdat.SetLimit(); // remove former limit
-            unsigned int nSize = 0;
-            try {
-                // locate a header
-                unsigned char buf[CMessageHeader::MESSAGE_START_SIZE];
-                blkdat.FindByte(chainparams.MessageStart()[0]);
-                nRewind = blkdat.GetPos() + 1;
-                blkdat >> buf;
-                if (memcmp(buf, chainparams.MessageStart(), CMessageHeader::MESSAGE_START_SIZE))
-                    continue;
-                // read size
-                blkdat >> nSize;
-                if (nSize < 80 || nSize > MAX_BLOCK_SERIALIZED_SIZE)
-                    continue;
-            } catch (const std::exception&) {
-                // no valid block header found; don't complain
-                break;
-            }
-            try {
-                // read block
-                uint64_t nBlockPos = blkdat.GetPos();
-                if (dbp)
-                    dbp->nPos = nBlockPos;
-                blkdat.SetLimit(nBlockPos + nSize);
-                blkdat.SetPos(nBlockPos);
-                std::shared_ptr<CBlock> pblock = std::make_shared<CBlock>();
-                CBlock& block = *pblock;
-                blkdat >> block;
-                nRewind = blkdat.GetPos();
-
-                uint256 hash = block.GetHash();
-                {
-                    LOCK(cs_main);
-                    // detect out of order blocks, and store them for later
-                    if (hash != chainparams.GetConsensus().hashGenesisBlock && !LookupBlockIndex(block.hashPrevBlock)) {
-                        LogPrint(BCLog::REINDEX, "%s: Out of order block %s, parent %s not known\n", __func__, hash.ToString(),
-                            block.hashPrevBlock.ToString());
-                        if (dbp)
-                            mapBlocksUnknownParent.insert(std::make_pair(block.hashPrevBlock, *dbp));
-                        continue;
+            // Copy a batch of serialized blocks out of the file. A batch only
+            // holds blocks that directly follow each other and spans at most
+            // MAX_BLOCK_SERIALIZED_SIZE bytes, which keeps the header of every
+            // block in it within the rewind window of blkdat: a block that
+            // fails to deserialize is scanned again from right after its header.
+            frames.clear();
+            while (frames.size() < EXTERNAL_BLOCK_PARSE_BATCH && !blkdat.eof()) {
+                blkdat.SetPos(nRewind);
+                nRewind++;         // start one byte further next time, in case of failure
+                blkdat.SetLimit(); // remove former limit
+                unsigned int nSize = 0;
+                try {
+                    // locate a header, right after the previous block once the batch has one
+                    unsigned char buf[CMessageHeader::MESSAGE_START_SIZE];
+                    if (frames.empty()) {
+                        blkdat.FindByte(chainparams.MessageStart()[0]);
+                    }
+                    nRewind = blkdat.GetPos() + 1;
+                    blkdat >> buf;
+                    bool fHeader = memcmp(buf, chainparams.MessageStart(), CMessageHeader::MESSAGE_START_SIZE) == 0;
+                    if (fHeader) {
+                        // read size
+                        blkdat >> nSize;
+                        fHeader = nSize >= 80 && nSize <= MAX_BLOCK_SERIALIZED_SIZE;
                     }
+                    if (!fHeader) {
+                        if (frames.empty())
+                            continue;
+                        // the next batch scans from here
+                        nRewind--;
+                        break;
+                    }
+                } catch (const std::exception&) {
+                    // no valid block header found; don't complain
+                    fStop = true;
+                    break;
+                }
+                uint64_t nBlockPos = blkdat.GetPos();
+                if (!frames.empty() && nBlockPos + nSize - frames.front().nRewindOnError > MAX_BLOCK_SERIALIZED_SIZE) {
+                    // leave this block to the next batch, starting at its header
+                    nRewind--;
+                    break;
+                }
+                try {
+                    // read block
+                    ExternalBlockFrame frame;
+                    frame.nRewindOnError = nRewind;
+                    frame.pos = FlatFilePos(dbp ? dbp->nFile : -1, nBlockPos);
+                    blkdat.SetLimit(nBlockPos + nSize);
+                    blkdat.SetPos(nBlockPos);
+                    frame.raw.resize(nSize);
+                    blkdat.read((char*)frame.raw.data(), nSize);
+                    nRewind = blkdat.GetPos();
+                    frames.push_back(std::move(frame));
+                } catch (const std::exception& e) {
+                    LogPrintf("%s: Deserialize or I/O error - %s\n", __func__, e.what());
+                }
+            }
 
-                    // process in case the block isn't known yet
-                    CBlockIndex* pindex = LookupBlockIndex(hash);
-                    if (!pindex || (pindex->nStatus & BLOCK_HAVE_DATA) == 0) {
-                        BlockValidationState state;
-                        if (::ChainstateActive().AcceptBlock(pblock, state, chainparams, nullptr, true, dbp, nullptr)) {
-                            nLoaded++;
+            // Deserialize the batch on the parse workers, the calling thread helps
+            std::vector<CBlockParseCheck> vChecks;
+            vChecks.reserve(frames.size());
+            for (auto& frame : frames) {
+                vChecks.emplace_back(frame);
+            }
+            if (g_parallel_block_parse) {
+                CCheckQueueControl<CBlockParseCheck> control(&blockparsequeue);
+                control.Add(vChecks);
+                control.Wait();
+            } else {
+                for (auto& check : vChecks) {
+                    check();
+                }
+            }
+
+            // Accept the blocks in file order
+            for (auto& frame : frames) {
+                if (!frame.block) {
+                    LogPrintf("%s: Deserialize or I/O error - failed to deserialize block at position %u\n", __func__, frame.pos.nPos);
+                    // scan again from right after the broken header, like a failed read
+                    // does, even if the batch already reached the end of the file
+                    nRewind = frame.nRewindOnError;
+                    blkdat.SetPos(nRewind);
+                    fStop = false;
+                    break;
+                }
+                nBytesParsed += frame.raw.size();
+                FlatFilePos* blockPos = nullptr;
+                if (dbp) {
+                    dbp->nPos = frame.pos.nPos;
+                    blockPos = &frame.pos;
+                }
+
+                try {
+                    std::shared_ptr<CBlock> pblock = frame.block;
+                    const uint256& hash = frame.hash;
+                    {
+                        LOCK(cs_main);
+                        // detect out of order blocks, and store them for later
+                        if (hash != chainparams.GetConsensus().hashGenesisBlock && !LookupBlockIndex(pblock->hashPrevBlock)) {
+                            LogPrint(BCLog::REINDEX, "%s: Out of order block %s, parent %s not known\n", __func__, hash.ToString(),
+                                pblock->hashPrevBlock.ToString());
+                            if (dbp)
+                                mapBlocksUnknownParent.insert(std::make_pair(pblock->hashPrevBlock, frame.pos));
+                            continue;
                         }
-                        if (state.IsError()) {
-                            break;
+
+                        // process in case the block isn't known yet
+                        CBlockIndex* pindex = LookupBlockIndex(hash);
+                        if (!pindex || (pindex->nStatus & BLOCK_HAVE_DATA) == 0) {
+                            BlockValidationState state;
+                            if (::ChainstateActive().AcceptBlock(pblock, state, chainparams, nullptr, true, blockPos, nullptr)) {
+                                nLoaded++;
+                            }
+                            if (state.IsError()) {
+                                fStop = true;
+                                break;
+                            }
+                        } else if (hash != chainparams.GetConsensus().hashGenesisBlock && pindex->nHeight % 1000 == 0) {
+                            LogPrint(BCLog::REINDEX, "Block Import: already had block %s at height %d\n", hash.ToString(), pindex->nHeight);
                         }
-                    } else if (hash != chainparams.GetConsensus().hashGenesisBlock && pindex->nHeight % 1000 == 0) {
-                        LogPrint(BCLog::REINDEX, "Block Import: already had block %s at height %d\n", hash.ToString(), pindex->nHeight);
                     }
-                }
 
-                // Activate the genesis block so normal node progress can continue
-                if (hash == chainparams.GetConsensus().hashGenesisBlock) {
-                    BlockValidationState state;
-                    if (!ActivateBestChain(state, chainparams)) {
-                        break;
+                    // Activate the genesis block so normal node progress can continue
+                    if (hash == chainparams.GetConsensus().hashGenesisBlock) {
+                        BlockValidationState state;
+                        if (!ActivateBestChain(state, chainparams)) {
+                            fStop = true;
+                            break;
+                        }
                     }
-                }
 
-                NotifyHeaderTip();
-
-                // Recursively process earlier encountered successors of this block
-                std::deque<uint256> queue;
-                queue.push_back(hash);
-                while (!queue.empty()) {
-                    uint256 head = queue.front();
-                    queue.pop_front();
-                    std::pair<std::multimap<uint256, FlatFilePos>::iterator, std::multimap<uint256, FlatFilePos>::iterator> range = mapBlocksUnknownParent.equal_range(head);
-                    while (range.first != range.second) {
-                        std::multimap<uint256, FlatFilePos>::iterator it = range.first;
-                        std::shared_ptr<CBlock> pblockrecursive = std::make_shared<CBlock>();
-                        if (ReadBlockFromDisk(*pblockrecursive, it->second, chainparams.GetConsensus())) {
-                            LogPrint(BCLog::REINDEX, "%s: Processing out of order child %s of %s\n", __func__, pblockrecursive->GetHash().ToString(),
-                                head.ToString());
-                            LOCK(cs_main);
-                            BlockValidationState dummy;
-                            if (::ChainstateActive().AcceptBlock(pblockrecursive, dummy, chainparams, nullptr, true, &it->second, nullptr)) {
-                                nLoaded++;
-                                queue.push_back(pblockrecursive->GetHash());
+                    NotifyHeaderTip();
+
+                    // Recursively process earlier encountered successors of this block
+                    std::deque<uint256> queue;
+                    queue.push_back(hash);
+                    while (!queue.empty()) {
+                        uint256 head = queue.front();
+                        queue.pop_front();
+                        std::pair<std::multimap<uint256, FlatFilePos>::iterator, std::multimap<uint256, FlatFilePos>::iterator> range = mapBlocksUnknownParent.equal_range(head);
+                        while (range.first != range.second) {
+                            std::multimap<uint256, FlatFilePos>::iterator it = range.first;
+                            std::shared_ptr<CBlock> pblockrecursive = std::make_shared<CBlock>();
+                            if (ReadBlockFromDisk(*pblockrecursive, it->second, chainparams.GetConsensus())) {
+                                LogPrint(BCLog::REINDEX, "%s: Processing out of order child %s of %s\n", __func__, pblockrecursive->GetHash().ToString(),
+                                    head.ToString());
+                                LOCK(cs_main);
+                                BlockValidationState dummy;
+                                if (::ChainstateActive().AcceptBlock(pblockrecursive, dummy, chainparams, nullptr, true, &it->second, nullptr)) {
+                                    nLoaded++;
+                                    queue.push_back(pblockrecursive->GetHash());
+                                }
                             }
+                            range.first++;
+                            mapBlocksUnknownParent.erase(it);
+                            NotifyHeaderTip();
                         }
-                        range.first++;
-                        mapBlocksUnknownParent.erase(it);
-                        NotifyHeaderTip();
                     }
+                } catch (const std::exception& e) {
+                    LogPrintf("%s: Deserialize or I/O error - %s\n", __func__, e.what());
                 }
-            } catch (const std::exception& e) {
-                LogPrintf("%s: Deserialize or I/O error - %s\n", __func__, e.what());
             }
         }
     } catch (const std::runtime_error& e) {
         AbortNode(std::string("System error: ") + e.what());
     }
-    if (nLoaded > 0)
-        LogPrintf("Loaded %i blocks from external file in %dms\n", nLoaded, GetTimeMillis() - nStart);
+    if (nLoaded > 0) {
+        int64_t nElapsed = std::max<int64_t>(GetTimeMillis() - nStart, 1);
+        LogPrintf("Loaded %i blocks from external file in %dms (%.1f blocks/s, %.2f MB/s)\n", nLoaded, nElapsed,
+            nLoaded * 1000.0 / nElapsed, nBytesParsed / 1000.0 / nElapsed);
+    }
     return nLoaded > 0;
 }
 
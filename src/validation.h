@@ -82,6 +82,12 @@ static const unsigned int UNDOFILE_CHUNK_SIZE = 0x100000; // 1 MiB
 static const int MAX_SCRIPTCHECK_THREADS = 15;
 /** -par default (number of script-checking threads, 0 = auto) */
 static const int DEFAULT_SCRIPTCHECK_THREADS = 0;
+/** Maximum number of blocks LoadExternalBlockFile reads ahead and deserializes in parallel */
+static const size_t EXTERNAL_BLOCK_PARSE_BATCH = 64;
+/** Number of transactions CheckBlock hands to a block check worker at once */
+static const size_t BLOCK_CHECK_TXS_PER_RANGE = 32;
+/** Maximum number of threads reading and checking blocks in CVerifyDB */
+static const int MAX_VERIFYDB_THREADS = 8;
 /** Number of blocks that can be requested at any given time from a single peer. */
 static const int MAX_BLOCKS_IN_TRANSIT_PER_PEER = 16;
 /** Timeout in seconds during which a peer must stall block download progress before being disconnected. */
@@ -103,6 +109,8 @@ static const unsigned int BLOCK_DOWNLOAD_WINDOW = 1024;
 static const unsigned int DATABASE_WRITE_INTERVAL = 60 * 60;
 /** Time to wait (in seconds) between flushing chainstate to disk. */
 static const unsigned int DATABASE_FLUSH_INTERVAL = 24 * 60 * 60;
+/** Share of the coins cache space (in percent) that is always left to the coins cache, however large the PoP trees grow */
+static const int MIN_COINS_CACHE_SPACE_PERCENT = 50;
 /** Block download timeout base, expressed in millionths of the block interval (i.e. 10 min) */
 static const int64_t BLOCK_DOWNLOAD_TIMEOUT_BASE = 1000000;
 /** Additional block download timeout per parallel downloading peer (i.e. 5 min) */
@@ -151,6 +159,10 @@ extern std::atomic_bool fReindex;
  * False indicates all script checking is done on the main threadMessageHandler thread.
  */
 extern bool g_parallel_script_checks;
+/** Whether there are dedicated threads deserializing blocks read by LoadExternalBlockFile. */
+extern bool g_parallel_block_parse;
+/** Whether there are dedicated threads running the context-free checks of CheckBlock and the merkle roots of ContextualCheckBlock. */
+extern bool g_parallel_block_checks;
 extern bool fRequireStandard;
 extern bool fCheckBlockIndex;
 extern bool fCheckpointsEnabled;
@@ -244,6 +256,10 @@ bool LoadBlockIndex(const CChainParams& chainparams) EXCLUSIVE_LOCKS_REQUIRED(cs
 void UnloadBlockIndex();
 /** Run an instance of the script checking thread */
 void ThreadScriptCheck(int worker_num);
+/** Run an instance of the block parsing thread used by LoadExternalBlockFile */
+void ThreadBlockParse(int worker_num);
+/** Run an instance of the block checking thread used by CheckBlock and ContextualCheckBlock */
+void ThreadBlockCheck(int worker_num);
 /** Retrieve a transaction (from memory pool, or from disk, if possible) */
 bool GetTransaction(const uint256& hash, CTransactionRef& tx, const Consensus::Params& params, uint256& hashBlock, const CBlockIndex* const blockIndex = nullptr);
 /**
@@ -363,6 +379,8 @@ void InitScriptExecutionCache();
 
 
 /** Functions for disk access for blocks */
+/** Number of block files kept memory-mapped for ReadBlockFromDisk, 0 reads every block through stdio */
+void SetMaxMappedBlockFiles(size_t nMaxFiles);
 bool ReadBlockFromDisk(CBlock& block, const FlatFilePos& pos, const Consensus::Params& consensusParams);
 bool ReadBlockFromDisk(CBlock& block, const CBlockIndex* pindex, const Consensus::Params& consensusParams);
 bool ReadRawBlockFromDisk(std::vector<uint8_t>& block, const FlatFilePos& pos, const CMessageHeader::MessageStartChars& message_start);
@@ -419,6 +437,15 @@ enum DisconnectResult
 
 class ConnectTrace;
 
+/**
+ * Space of nTotalSpace left to the coins cache after the in-memory PoP trees.
+ * The trees can not be flushed, so flushing the coins cache more often does
+ * not free their memory: the result never drops below
+ * MIN_COINS_CACHE_SPACE_PERCENT of nTotalSpace, so large trees do not force a
+ * flush after every block.
+ */
+int64_t GetCoinsCacheSpace(int64_t nTotalSpace, int64_t nPopTreesUsage);
+
 /** @see CChainState::FlushStateToDisk */
 enum class FlushStateMode {
     NONE,
@@ -493,12 +520,16 @@ public:
     /**
      * If a block header hasn't already been seen, call CheckBlockHeader on it, ensure
      * that it doesn't descend from an invalid block, and then add it to m_block_index.
+     *
+     * VeriBlock: if pvPopHeaders is set, the header is appended to it instead of
+     * being accepted into the ALT tree, see VeriBlock::acceptBlocks.
      */
     bool AcceptBlockHeader(
         const CBlockHeader& block,
         BlockValidationState& state,
         const CChainParams& chainparams,
-        CBlockIndex** ppindex) EXCLUSIVE_LOCKS_REQUIRED(cs_main);
+        CBlockIndex** ppindex,
+        std::vector<CBlockIndex*>* pvPopHeaders = nullptr) EXCLUSIVE_LOCKS_REQUIRED(cs_main);
 };
 
 /**
@@ -8,6 +8,7 @@
 
 #include <dbwrapper.h>
 #include <vbk/pop_common.hpp>
+#include <vbk/pop_prefetch.hpp>
 #include <veriblock/storage/payloads_provider.hpp>
 
 namespace VeriBlock {
@@ -52,7 +53,7 @@ struct PayloadsProvider : public altintegration::PayloadsProvider {
             const auto* memval = mempool.get<pop_t>(ids[i]);
             if (memval != nullptr) {
                 value = *memval;
-            } else {
+            } else if (!GetPrefetchedPayload(ids[i], value)) {
                 if (!db_.Read(std::make_pair(dbPrefix, ids[i]), value)) {
                     return state.Invalid(pop_t::name() + "-read-error", i);
                 }
@@ -62,6 +63,29 @@ struct PayloadsProvider : public altintegration::PayloadsProvider {
         return true;
     }
 
+    //! Iterates over all stored payloads of type pop_t. Iteration stops when f returns false.
+    template <typename pop_t, typename F>
+    void forEach(char dbPrefix, F f)
+    {
+        using id_t = typename pop_t::id_t;
+        std::unique_ptr<CDBIterator> iter(db_.NewIterator());
+        iter->Seek(std::make_pair(dbPrefix, id_t()));
+        while (iter->Valid()) {
+            std::pair<char, id_t> key;
+            if (!iter->GetKey(key) || key.first != dbPrefix) {
+                break;
+            }
+            pop_t value;
+            if (!iter->GetValue(value)) {
+                break;
+            }
+            if (!f(value)) {
+                break;
+            }
+            iter->Next();
+        }
+    }
+
     bool getATVs(const std::vector<altintegration::ATV::id_t>& ids,
         std::vector<altintegration::ATV>& out,
         altintegration::ValidationState& state) override
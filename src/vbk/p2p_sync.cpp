@@ -5,15 +5,128 @@
 
 #include "vbk/p2p_sync.hpp"
 #include "validation.h"
+#include <vbk/pop_mempool_limit.hpp>
+#include <vbk/pop_stats.hpp>
+#include <util/time.h>
 #include <veriblock/entities/atv.hpp>
 #include <veriblock/entities/vbkblock.hpp>
 #include <veriblock/entities/vtb.hpp>
 
+#include <algorithm>
+#include <atomic>
+
 namespace VeriBlock {
 namespace p2p {
 
 static std::map<NodeId, std::shared_ptr<PopDataNodeState>> mapPopDataNodeState;
 
+static std::atomic<int64_t> g_relay_bandwidth{DEFAULT_POP_RELAY_BANDWIDTH * 1000};
+
+struct PopRelayCounters {
+    std::atomic<uint64_t> payload{0};
+    std::atomic<uint64_t> offer{0};
+    std::atomic<uint64_t> request{0};
+
+    PopRelayTraffic get() const
+    {
+        PopRelayTraffic traffic;
+        traffic.payload = payload;
+        traffic.offer = offer;
+        traffic.request = request;
+        return traffic;
+    }
+};
+
+static PopRelayCounters g_atv_sent;
+static PopRelayCounters g_vtb_sent;
+static PopRelayCounters g_vbk_blocks_sent;
+
+template <typename T>
+static PopRelayCounters& getSentCounters();
+
+template <>
+PopRelayCounters& getSentCounters<altintegration::ATV>()
+{
+    return g_atv_sent;
+}
+
+template <>
+PopRelayCounters& getSentCounters<altintegration::VTB>()
+{
+    return g_vtb_sent;
+}
+
+template <>
+PopRelayCounters& getSentCounters<altintegration::VbkBlock>()
+{
+    return g_vbk_blocks_sent;
+}
+
+void SetPopRelayBandwidth(int64_t bytesPerSecond)
+{
+    g_relay_bandwidth = std::max<int64_t>(bytesPerSecond, 0);
+}
+
+int64_t GetPopRelayBandwidth()
+{
+    return g_relay_bandwidth;
+}
+
+bool PopRelayBudget::consume(size_t bytes, int64_t nowMicros)
+{
+    const int64_t rate = g_relay_bandwidth;
+    if (rate == 0) {
+        return true;
+    }
+
+    const double capacity = (double)rate;
+    if (!initialized_) {
+        initialized_ = true;
+        tokens_ = capacity;
+    } else if (nowMicros > lastRefill_) {
+        tokens_ = std::min(capacity, tokens_ + (double)(nowMicros - lastRefill_) * rate / 1000000);
+    }
+    lastRefill_ = std::max(lastRefill_, nowMicros);
+
+    if (tokens_ <= 0) {
+        return false;
+    }
+    tokens_ -= (double)bytes;
+    return true;
+}
+
+PopRelayStats GetPopRelayStats()
+{
+    PopRelayStats stats;
+    stats.atv = g_atv_sent.get();
+    stats.vtb = g_vtb_sent.get();
+    stats.vbkblock = g_vbk_blocks_sent.get();
+    return stats;
+}
+
+template <typename pop_t>
+void pushPopMessage(CNode* node, CConnman* connman, PopRelayMsg kind, CSerializedNetMsg&& msg)
+{
+    const uint64_t size = msg.data.size() + CMessageHeader::HEADER_SIZE;
+    auto& counters = getSentCounters<pop_t>();
+    switch (kind) {
+    case PopRelayMsg::PAYLOAD:
+        counters.payload += size;
+        break;
+    case PopRelayMsg::OFFER:
+        counters.offer += size;
+        break;
+    case PopRelayMsg::REQUEST:
+        counters.request += size;
+        break;
+    }
+    connman->PushMessage(node, std::move(msg), /* fLowPriority */ true);
+}
+
+template void pushPopMessage<altintegration::ATV>(CNode*, CConnman*, PopRelayMsg, CSerializedNetMsg&&);
+template void pushPopMessage<altintegration::VTB>(CNode*, CConnman*, PopRelayMsg, CSerializedNetMsg&&);
+template void pushPopMessage<altintegration::VbkBlock>(CNode*, CConnman*, PopRelayMsg, CSerializedNetMsg&&);
+
 template <>
 std::map<altintegration::ATV::id_t, PopP2PState>& PopDataNodeState::getMap<altintegration::ATV>()
 {
@@ -32,6 +145,24 @@ std::map<altintegration::VbkBlock::id_t, PopP2PState>& PopDataNodeState::getMap<
     return vbk_blocks_state;
 }
 
+template <>
+std::deque<altintegration::ATV::id_t>& PopDataNodeState::getPending<altintegration::ATV>()
+{
+    return atv_pending;
+}
+
+template <>
+std::deque<altintegration::VTB::id_t>& PopDataNodeState::getPending<altintegration::VTB>()
+{
+    return vtb_pending;
+}
+
+template <>
+std::deque<altintegration::VbkBlock::id_t>& PopDataNodeState::getPending<altintegration::VbkBlock>()
+{
+    return vbk_blocks_pending;
+}
+
 PopDataNodeState& getPopDataNodeState(const NodeId& id) EXCLUSIVE_LOCKS_REQUIRED(cs_main)
 {
     AssertLockHeld(cs_main);
@@ -53,6 +184,7 @@ template <typename pop_t>
 bool processGetPopData(CNode* node, CConnman* connman, CDataStream& vRecv, altintegration::MemPool& pop_mempool) EXCLUSIVE_LOCKS_REQUIRED(cs_main)
 {
     AssertLockHeld(cs_main);
+    PopStageTimer timer(PopStage::P2P_PROCESS);
     std::vector<std::vector<uint8_t>> requested_data;
     vRecv >> requested_data;
 
@@ -62,9 +194,10 @@ bool processGetPopData(CNode* node, CConnman* connman, CDataStream& vRecv, altin
         return false;
     }
 
-    auto& pop_state_map = getPopDataNodeState(node->GetId()).getMap<pop_t>();
+    auto& node_state = getPopDataNodeState(node->GetId());
+    auto& pop_state_map = node_state.getMap<pop_t>();
+    auto& pending = node_state.getPending<pop_t>();
 
-    const CNetMsgMaker msgMaker(PROTOCOL_VERSION);
     for (const auto& data_hash : requested_data) {
         PopP2PState& pop_state = pop_state_map[data_hash];
         uint32_t ddosPreventionCounter = pop_state.known_pop_data++;
@@ -75,19 +208,67 @@ bool processGetPopData(CNode* node, CConnman* connman, CDataStream& vRecv, altin
             return false;
         }
 
-        const auto* data = pop_mempool.get<pop_t>(data_hash);
-        if (data != nullptr) {
-            connman->PushMessage(node, msgMaker.Make(pop_t::name(), *data));
+        if (pending.size() >= MAX_POP_DATA_SENDING_AMOUNT) {
+            LogPrint(BCLog::NET, "peer %d has too many pending %s requests, dropping the rest\n", node->GetId(), pop_t::name());
+            break;
+        }
+
+        if (pop_mempool.get<pop_t>(data_hash) != nullptr) {
+            pending.push_back(data_hash);
         }
     }
 
+    sendPopData(node, connman);
     return true;
 }
 
+//! Returns false if the relay budget ran out before the queue was drained
+template <typename pop_t>
+bool sendPendingPopData(CNode* node, CConnman* connman, PopDataNodeState& node_state, altintegration::MemPool& pop_mempool, int64_t nowMicros) EXCLUSIVE_LOCKS_REQUIRED(cs_main)
+{
+    AssertLockHeld(cs_main);
+    auto& pending = node_state.getPending<pop_t>();
+    const CNetMsgMaker msgMaker(PROTOCOL_VERSION);
+    while (!pending.empty()) {
+        // the payload may have left the mempool while it was waiting
+        const auto* data = pop_mempool.get<pop_t>(pending.front());
+        if (data == nullptr) {
+            pending.pop_front();
+            continue;
+        }
+
+        CSerializedNetMsg msg = msgMaker.Make(pop_t::name(), *data);
+        if (!node_state.relay_budget.consume(msg.data.size() + CMessageHeader::HEADER_SIZE, nowMicros)) {
+            return false;
+        }
+        pushPopMessage<pop_t>(node, connman, PopRelayMsg::PAYLOAD, std::move(msg));
+        pending.pop_front();
+    }
+    return true;
+}
+
+void sendPopData(CNode* node, CConnman* connman) EXCLUSIVE_LOCKS_REQUIRED(cs_main)
+{
+    AssertLockHeld(cs_main);
+    auto& node_state = getPopDataNodeState(node->GetId());
+    auto& pop_mempool = *VeriBlock::GetPop().mempool;
+    const int64_t now = GetTime<std::chrono::microseconds>().count();
+
+    // VBK blocks first, VTBs and ATVs refer to them
+    if (!sendPendingPopData<altintegration::VbkBlock>(node, connman, node_state, pop_mempool, now)) {
+        return;
+    }
+    if (!sendPendingPopData<altintegration::VTB>(node, connman, node_state, pop_mempool, now)) {
+        return;
+    }
+    sendPendingPopData<altintegration::ATV>(node, connman, node_state, pop_mempool, now);
+}
+
 template <typename pop_t>
 bool processOfferPopData(CNode* node, CConnman* connman, CDataStream& vRecv, altintegration::MemPool& pop_mempool) EXCLUSIVE_LOCKS_REQUIRED(cs_main)
 {
     AssertLockHeld(cs_main);
+    PopStageTimer timer(PopStage::P2P_PROCESS);
     LogPrint(BCLog::NET, "received offered pop data: %s, bytes size: %d\n", pop_t::name(), vRecv.size());
 
     // do not process 'offers' during initial block download
@@ -123,7 +304,7 @@ bool processOfferPopData(CNode* node, CConnman* connman, CDataStream& vRecv, alt
     }
 
     if (!requested_data.empty()) {
-        connman->PushMessage(node, msgMaker.Make(get_prefix + pop_t::name(), requested_data));
+        pushPopMessage<pop_t>(node, connman, PopRelayMsg::REQUEST, msgMaker.Make(get_prefix + pop_t::name(), requested_data));
     }
 
     return true;
@@ -133,6 +314,7 @@ template <typename pop_t>
 bool processPopData(CNode* node, CDataStream& vRecv, altintegration::MemPool& pop_mempool) EXCLUSIVE_LOCKS_REQUIRED(cs_main)
 {
     AssertLockHeld(cs_main);
+    PopStageTimer timer(PopStage::P2P_PROCESS);
     LogPrint(BCLog::NET, "received pop data: %s, bytes size: %d\n", pop_t::name(), vRecv.size());
     pop_t data;
     vRecv >> data;
@@ -155,13 +337,17 @@ bool processPopData(CNode* node, CDataStream& vRecv, altintegration::MemPool& po
     }
 
     altintegration::ValidationState state;
-    auto result = pop_mempool.submit(data, state);
+    auto result = [&]() {
+        PopStageTimer submitTimer(PopStage::MEMPOOL_SUBMIT);
+        return pop_mempool.submit(data, state);
+    }();
     if (!result && result.status == altintegration::MemPool::FAILED_STATELESS) {
         LogPrint(BCLog::NET, "peer %d sent statelessly invalid pop data: %s\n", node->GetId(), state.toString());
         Misbehaving(node->GetId(), 20, strprintf("statelessly invalid pop data getdata, reason: %s", state.toString()));
         return false;
     }
 
+    LimitPopMempool(data);
     return true;
 }
 
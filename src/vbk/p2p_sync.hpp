@@ -7,12 +7,14 @@
 #define BITCOIN_SRC_VBK_P2P_SYNC_HPP
 
 #include <chainparams.h>
+#include <deque>
 #include <map>
 #include <net_processing.h>
 #include <netmessagemaker.h>
 #include <node/context.h>
 #include <rpc/blockchain.h>
 #include <vbk/pop_common.hpp>
+#include <vbk/pop_stats.hpp>
 #include <veriblock/mempool.hpp>
 
 namespace VeriBlock {
@@ -25,6 +27,30 @@ struct PopP2PState {
     uint32_t requested_pop_data{0};
 };
 
+//! Default per-peer budget for serving PoP payloads, in kilobytes per second
+static const int64_t DEFAULT_POP_RELAY_BANDWIDTH = 256;
+
+//! Set the per-peer PoP payload relay budget in bytes per second, 0 disables the limit
+void SetPopRelayBandwidth(int64_t bytesPerSecond);
+int64_t GetPopRelayBandwidth();
+
+/**
+ * Token bucket limiting the PoP payloads served to one peer. It refills at
+ * the configured bandwidth and holds at most one second worth of tokens.
+ */
+class PopRelayBudget
+{
+public:
+    //! Take `bytes` from the budget. A positive balance may be overdrawn by
+    //! one message, so payloads larger than the bucket still get through.
+    bool consume(size_t bytes, int64_t nowMicros);
+
+private:
+    bool initialized_{false};
+    double tokens_{0};
+    int64_t lastRefill_{0};
+};
+
 // The state of the Node that stores already known Pop Data
 struct PopDataNodeState {
     // we use map to store DDoS prevention counter as a value in the map
@@ -32,10 +58,48 @@ struct PopDataNodeState {
     std::map<altintegration::VTB::id_t, PopP2PState> vtb_state{};
     std::map<altintegration::VbkBlock::id_t, PopP2PState> vbk_blocks_state{};
 
+    // requested payloads waiting for the relay budget
+    std::deque<altintegration::ATV::id_t> atv_pending{};
+    std::deque<altintegration::VTB::id_t> vtb_pending{};
+    std::deque<altintegration::VbkBlock::id_t> vbk_blocks_pending{};
+
+    PopRelayBudget relay_budget{};
+
     template <typename T>
     std::map<typename T::id_t, PopP2PState>& getMap();
+
+    template <typename T>
+    std::deque<typename T::id_t>& getPending();
 };
 
+//! Bytes sent for one PoP payload type
+struct PopRelayTraffic {
+    uint64_t payload = 0;
+    uint64_t offer = 0;
+    uint64_t request = 0;
+};
+
+struct PopRelayStats {
+    PopRelayTraffic atv;
+    PopRelayTraffic vtb;
+    PopRelayTraffic vbkblock;
+};
+
+PopRelayStats GetPopRelayStats();
+
+enum class PopRelayMsg {
+    PAYLOAD,
+    OFFER,
+    REQUEST,
+};
+
+//! Send a PoP relay message behind regular block relay traffic and account its bytes
+template <typename pop_t>
+void pushPopMessage(CNode* node, CConnman* connman, PopRelayMsg kind, CSerializedNetMsg&& msg);
+
+//! Serve requested payloads queued for `node` as far as its relay budget allows
+void sendPopData(CNode* node, CConnman* connman);
+
 PopDataNodeState& getPopDataNodeState(const NodeId& id);
 
 void erasePopDataNodeState(const NodeId& id);
@@ -58,6 +122,7 @@ const static uint32_t MAX_POP_MESSAGE_SENDING_COUNT = 30;
 template <typename pop_t>
 void offerPopDataToAllNodes(const pop_t& p)
 {
+    PopStageTimer timer(PopStage::P2P_OFFER);
     std::vector<std::vector<uint8_t>> p_id = {p.getId().asVector()};
     CConnman* connman = g_rpc_node->connman.get();
     const CNetMsgMaker msgMaker(PROTOCOL_VERSION);
@@ -68,7 +133,7 @@ void offerPopDataToAllNodes(const pop_t& p)
         PopP2PState& pop_state = pop_state_map[p_id[0]];
         if (pop_state.offered_pop_data == 0) {
             ++pop_state.offered_pop_data;
-            connman->PushMessage(node, msgMaker.Make(offer_prefix + pop_t::name(), p_id));
+            pushPopMessage<pop_t>(node, connman, PopRelayMsg::OFFER, msgMaker.Make(offer_prefix + pop_t::name(), p_id));
         }
     });
 }
@@ -78,6 +143,7 @@ template <typename PopDataType>
 void offerPopData(CNode* node, CConnman* connman, const CNetMsgMaker& msgMaker) EXCLUSIVE_LOCKS_REQUIRED(cs_main)
 {
     AssertLockHeld(cs_main);
+    PopStageTimer timer(PopStage::P2P_OFFER);
     auto& pop_state_map = getPopDataNodeState(node->GetId()).getMap<PopDataType>();
     auto& pop_mempool = *VeriBlock::GetPop().mempool;
     std::vector<std::vector<uint8_t>> hashes;
@@ -91,7 +157,7 @@ void offerPopData(CNode* node, CConnman* connman, const CNetMsgMaker& msgMaker)
             }
 
             if (hashes.size() == MAX_POP_DATA_SENDING_AMOUNT) {
-                connman->PushMessage(node, msgMaker.Make(offer_prefix + PopDataType::name(), hashes));
+                pushPopMessage<PopDataType>(node, connman, PopRelayMsg::OFFER, msgMaker.Make(offer_prefix + PopDataType::name(), hashes));
                 hashes.clear();
             }
         }
@@ -101,7 +167,7 @@ void offerPopData(CNode* node, CConnman* connman, const CNetMsgMaker& msgMaker)
     addhashes(pop_mempool.getInFlightMap<PopDataType>());
 
     if (!hashes.empty()) {
-        connman->PushMessage(node, msgMaker.Make(offer_prefix + PopDataType::name(), hashes));
+        pushPopMessage<PopDataType>(node, connman, PopRelayMsg::OFFER, msgMaker.Make(offer_prefix + PopDataType::name(), hashes));
     }
 }
 
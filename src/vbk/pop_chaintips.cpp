@@ -0,0 +1,211 @@
+// Copyright (c) 2019-2020 Xenios SEZC
+// https://www.veriblock.org
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <sync.h>
+#include <validation.h>
+
+#include <atomic>
+#include <map>
+
+#include "pop_chaintips.hpp"
+#include <vbk/pop_common.hpp>
+
+namespace VeriBlock {
+
+namespace {
+
+//! Set when the PoP trees may have changed since the views were built
+std::atomic<bool> g_dirty{true};
+std::atomic<uint64_t> g_rebuilds{0};
+std::atomic<uint64_t> g_fork_lookups{0};
+
+template <typename Tree>
+class ChainTipsView
+{
+public:
+    using index_t = typename Tree::index_t;
+    using hash_t = typename Tree::block_t::hash_t;
+
+    void update(Tree& tree) EXCLUSIVE_LOCKS_REQUIRED(cs_main)
+    {
+        AssertLockHeld(cs_main);
+        const auto& best = tree.getBestChain();
+
+        auto tips = std::make_shared<PopChainTips>();
+        std::map<hash_t, Entry> entries;
+        for (const index_t* block : tree.getTips()) {
+            const hash_t hash = block->getHash();
+            auto it = entries_.find(hash);
+            Entry entry;
+            if (it != entries_.end() && isValid(best, it->second.fork)) {
+                entry = it->second;
+            } else {
+                entry.fork = findFork(best, block);
+                ++g_fork_lookups;
+            }
+            // with the same fork point the tip is active iff it was before, the rest of the status follows the flags
+            if (!entry.tip || entry.tip->branchlen != block->getHeight() - entry.fork.height || entry.tip->statusflags != (uint64_t)block->getStatus()) {
+                entry.tip = makeTip(best, *block, entry.fork);
+            }
+            tips->push_back(entry.tip);
+            entries.emplace(hash, std::move(entry));
+        }
+        entries_.swap(entries);
+
+        LOCK(cs_snapshot_);
+        snapshot_ = std::move(tips);
+    }
+
+    void reset() EXCLUSIVE_LOCKS_REQUIRED(cs_main)
+    {
+        AssertLockHeld(cs_main);
+        entries_.clear();
+        LOCK(cs_snapshot_);
+        snapshot_ = std::make_shared<PopChainTips>();
+    }
+
+    std::shared_ptr<const PopChainTips> get()
+    {
+        LOCK(cs_snapshot_);
+        return snapshot_;
+    }
+
+private:
+    struct Fork {
+        //! last block of the best chain that is an ancestor of the tip
+        int height = 0;
+        hash_t hash;
+        //! first block of the branch after the fork point, unset for the active tip
+        bool hasBranch = false;
+        hash_t branchRoot;
+    };
+
+    struct Entry {
+        Fork fork;
+        std::shared_ptr<const PopChainTip> tip;
+    };
+
+    template <typename Chain>
+    static Fork findFork(const Chain& best, const index_t* block)
+    {
+        auto* forkBlock = best.findFork(block);
+        assert(forkBlock && "should have found this fork! state corruption.");
+
+        Fork fork;
+        fork.height = forkBlock->getHeight();
+        fork.hash = forkBlock->getHash();
+        if (forkBlock != block) {
+            fork.hasBranch = true;
+            fork.branchRoot = block->getAncestor(fork.height + 1)->getHash();
+        }
+        return fork;
+    }
+
+    //! A cached fork point stays valid while the best chain still contains it and does not continue into the branch.
+    template <typename Chain>
+    static bool isValid(const Chain& best, const Fork& fork)
+    {
+        const index_t* forkBlock = best[fork.height];
+        if (forkBlock == nullptr || forkBlock->getHash() != fork.hash) {
+            return false;
+        }
+        if (!fork.hasBranch) {
+            return true;
+        }
+        const index_t* next = best[fork.height + 1];
+        return next == nullptr || next->getHash() != fork.branchRoot;
+    }
+
+    template <typename Chain>
+    static std::shared_ptr<const PopChainTip> makeTip(const Chain& best, const index_t& block, const Fork& fork)
+    {
+        auto ptr = std::make_shared<PopChainTip>();
+        PopChainTip& tip = *ptr;
+        tip.height = block.getHeight();
+        tip.hash = block.getHash().toHex();
+        tip.branchlen = block.getHeight() - fork.height;
+        tip.statusflags = (uint64_t)block.getStatus();
+
+        if (best.contains(&block)) {
+            // This block is part of the currently active chain.
+            tip.status = "active";
+        } else if (block.hasFlags(altintegration::BLOCK_FAILED_MASK)) {
+            // This block or one of its ancestors is invalid.
+            tip.status = "invalid";
+        } else if (!block.isConnected()) {
+            // This block cannot be connected because full block data for it or one of its parents is missing.
+            tip.status = "headers-only";
+        } else if (block.isValid(altintegration::BLOCK_CAN_BE_APPLIED)) {
+            // This block is fully validated, but no longer part of the active chain. It was probably the active block once, but was reorganized.
+            tip.status = "valid-fork";
+        } else {
+            // The headers for this block are valid, but it has not been validated. It was probably never part of the best chain.
+            tip.status = "valid-headers";
+        }
+        return ptr;
+    }
+
+    std::map<hash_t, Entry> entries_ GUARDED_BY(cs_main);
+
+    Mutex cs_snapshot_;
+    std::shared_ptr<const PopChainTips> snapshot_ GUARDED_BY(cs_snapshot_) = std::make_shared<PopChainTips>();
+};
+
+ChainTipsView<altintegration::VbkBlockTree> g_vbk_tips;
+ChainTipsView<altintegration::VbkBlockTree::BtcTree> g_btc_tips;
+
+} // namespace
+
+void MarkPopChainTipsDirty()
+{
+    g_dirty = true;
+}
+
+bool UpdatePopChainTips()
+{
+    if (!g_dirty) {
+        return false;
+    }
+    LOCK(cs_main);
+    // trees change under cs_main, so a flag cleared here covers every change before the rebuild
+    if (!g_dirty.exchange(false)) {
+        return false;
+    }
+    auto& tree = *GetPop().altTree;
+    g_vbk_tips.update(tree.vbk());
+    g_btc_tips.update(tree.btc());
+    ++g_rebuilds;
+    return true;
+}
+
+void ResetPopChainTips()
+{
+    LOCK(cs_main);
+    g_vbk_tips.reset();
+    g_btc_tips.reset();
+    g_dirty = true;
+}
+
+std::shared_ptr<const PopChainTips> GetVbkChainTips()
+{
+    UpdatePopChainTips();
+    return g_vbk_tips.get();
+}
+
+std::shared_ptr<const PopChainTips> GetBtcChainTips()
+{
+    UpdatePopChainTips();
+    return g_btc_tips.get();
+}
+
+PopChainTipsStats GetPopChainTipsStats()
+{
+    PopChainTipsStats stats;
+    stats.rebuilds = g_rebuilds;
+    stats.fork_lookups = g_fork_lookups;
+    return stats;
+}
+
+} // namespace VeriBlock
@@ -0,0 +1,66 @@
+// Copyright (c) 2019-2020 Xenios SEZC
+// https://www.veriblock.org
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef BITCOIN_SRC_VBK_POP_CHAINTIPS_HPP
+#define BITCOIN_SRC_VBK_POP_CHAINTIPS_HPP
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace VeriBlock {
+
+struct PopChainTip {
+    int height = 0;
+    std::string hash;
+    //! zero for the active tip
+    int branchlen = 0;
+    uint64_t statusflags = 0;
+    //! active, valid-fork, valid-headers, headers-only or invalid
+    std::string status;
+};
+
+//! Tip entries are shared between snapshots while the tip does not change
+using PopChainTips = std::vector<std::shared_ptr<const PopChainTip>>;
+
+struct PopChainTipsStats {
+    //! rebuilds of the VBK and BTC views
+    uint64_t rebuilds = 0;
+    //! fork points looked up in the trees, reused fork points are not counted
+    uint64_t fork_lookups = 0;
+};
+
+/**
+ * Mark the VBK and BTC chain tips views stale. Only sets a flag, so it is
+ * cheap enough for consensus code to call whenever the PoP trees may have
+ * changed; the views are rebuilt when they are read next.
+ */
+void MarkPopChainTipsDirty();
+
+/**
+ * Rebuild the VBK and BTC chain tips views if they were marked stale since
+ * the last rebuild. Fork points and tip entries are cached per tip and only
+ * recomputed for new tips, for tips whose fork point moved and for tips whose
+ * status changed.
+ *
+ * @return true if the views were rebuilt
+ */
+bool UpdatePopChainTips();
+
+//! Drop the cached fork points and views, used when the PoP trees are recreated.
+void ResetPopChainTips();
+
+//! VBK tree tips. Takes cs_main to rebuild the views only if they are stale.
+std::shared_ptr<const PopChainTips> GetVbkChainTips();
+
+//! BTC tree tips. Takes cs_main to rebuild the views only if they are stale.
+std::shared_ptr<const PopChainTips> GetBtcChainTips();
+
+PopChainTipsStats GetPopChainTipsStats();
+
+} // namespace VeriBlock
+
+#endif //BITCOIN_SRC_VBK_POP_CHAINTIPS_HPP
@@ -0,0 +1,228 @@
+// Copyright (c) 2019-2020 Xenios SEZC
+// https://www.veriblock.org
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <dbwrapper.h>
+#include <logging.h>
+#include <txdb.h>
+#include <validation.h>
+#include <vbk/adaptors/block_batch_adaptor.hpp>
+#include <vbk/adaptors/payloads_provider.hpp>
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <vector>
+
+#include "pop_compaction.hpp"
+#include <vbk/pop_chaintips.hpp>
+#include <vbk/pop_common.hpp>
+#include <vbk/pop_service.hpp>
+
+namespace VeriBlock {
+
+namespace {
+
+//! VBK and BTC blocks that VTBs depend on: the containing VBK block, and the BTC block of proof with its context
+struct VtbReferences {
+    std::set<altintegration::VbkBlock::hash_t> vbk;
+    std::set<altintegration::BtcBlock::hash_t> btc;
+
+    void add(const altintegration::VTB& vtb)
+    {
+        vbk.insert(vtb.containingBlock.getHash());
+        btc.insert(vtb.transaction.blockOfProof.getHash());
+        for (const auto& block : vtb.transaction.blockOfProofContext) {
+            btc.insert(block.getHash());
+        }
+    }
+};
+
+//! References of the VTBs stored with ALT blocks, on any ALT fork, and of the VTBs in the POP mempool
+struct PopReferences {
+    //! stored VTBs are never erased, forks they reference stay referenced
+    VtbReferences stored;
+    //! mempool VTBs may be evicted
+    VtbReferences pending;
+};
+
+PopReferences collectVtbReferences() EXCLUSIVE_LOCKS_REQUIRED(cs_main)
+{
+    PopReferences refs;
+    GetPayloadsProvider().forEach<altintegration::VTB>(DB_VTB_PREFIX, [&](const altintegration::VTB& vtb) {
+        refs.stored.add(vtb);
+        return true;
+    });
+    auto& mp = *GetPop().mempool;
+    for (const auto& el : mp.getMap<altintegration::VTB>()) {
+        refs.pending.add(*el.second);
+    }
+    for (const auto& el : mp.getInFlightMap<altintegration::VTB>()) {
+        refs.pending.add(*el.second);
+    }
+    return refs;
+}
+
+//! Whether a stored payload depends on the block
+bool isReferencedByStored(const altintegration::BlockIndex<altintegration::VbkBlock>& index, const PopReferences& refs) EXCLUSIVE_LOCKS_REQUIRED(cs_main)
+{
+    if (refs.stored.vbk.count(index.getHash())) {
+        return true;
+    }
+    auto id = index.getHeader().getId();
+    return !GetPop().altTree->getPayloadsIndex().getContainingAltBlocks(id.asVector()).empty();
+}
+
+bool isReferencedByStored(const altintegration::BlockIndex<altintegration::BtcBlock>& index, const PopReferences& refs)
+{
+    return refs.stored.btc.count(index.getHash()) > 0;
+}
+
+bool isReferencedByPending(const altintegration::BlockIndex<altintegration::VbkBlock>& index, const PopReferences& refs)
+{
+    return refs.pending.vbk.count(index.getHash()) > 0;
+}
+
+bool isReferencedByPending(const altintegration::BlockIndex<altintegration::BtcBlock>& index, const PopReferences& refs)
+{
+    return refs.pending.btc.count(index.getHash()) > 0;
+}
+
+/**
+ * First blocks of the stale forks that stored VTBs or ALT payloads depend
+ * on. Such forks can never be pruned, remembering them keeps them from
+ * making every later run read all stored VTBs again.
+ */
+std::set<altintegration::VbkBlock::hash_t> g_referenced_vbk_forks GUARDED_BY(cs_main);
+std::set<altintegration::BtcBlock::hash_t> g_referenced_btc_forks GUARDED_BY(cs_main);
+
+//! All blocks of every stale fork, by the first block of the fork
+template <typename Tree>
+using StaleForks = std::map<typename Tree::index_t*, std::set<typename Tree::index_t*>>;
+
+/**
+ * Find stale forks of `tree` whose fork point is more than `depth` blocks
+ * below the best tip, leaving out the forks in `referenced`
+ */
+template <typename Tree>
+StaleForks<Tree> findStaleForks(Tree& tree, int depth, const std::set<typename Tree::hash_t>& referenced) EXCLUSIVE_LOCKS_REQUIRED(cs_main)
+{
+    using index_t = typename Tree::index_t;
+
+    StaleForks<Tree> forks;
+    auto& best = tree.getBestChain();
+    auto* tip = best.tip();
+    if (tip == nullptr) {
+        return forks;
+    }
+
+    for (index_t* forkTip : tree.getTips()) {
+        if (best.contains(forkTip)) {
+            continue;
+        }
+        auto* forkPoint = best.findFork(forkTip);
+        if (forkPoint == nullptr || tip->getHeight() - forkPoint->getHeight() <= depth) {
+            continue;
+        }
+
+        auto* root = forkTip->getAncestor(forkPoint->getHeight() + 1);
+        assert(root != nullptr);
+        if (referenced.count(root->getHash())) {
+            continue;
+        }
+        auto& blocks = forks[root];
+        for (auto* b = forkTip; b != forkPoint; b = b->pprev) {
+            blocks.insert(b);
+        }
+    }
+    return forks;
+}
+
+/**
+ * Remove the stale forks of `tree` deeper than `depth` that no payload
+ * depends on, and erase them from the database. Forks that stored payloads
+ * depend on are added to `referenced`.
+ *
+ * @return number of removed blocks
+ */
+template <typename Tree>
+size_t pruneStaleForks(Tree& tree, int depth, const PopReferences& refs, std::set<typename Tree::hash_t>& referenced, char dbPrefix, CDBBatch& batch) EXCLUSIVE_LOCKS_REQUIRED(cs_main)
+{
+    using index_t = typename Tree::index_t;
+    using hash_t = typename Tree::hash_t;
+
+    size_t removed = 0;
+    for (const auto& fork : findStaleForks(tree, depth, referenced)) {
+        const auto& blocks = fork.second;
+        if (std::any_of(blocks.begin(), blocks.end(), [&](const index_t* b) { return isReferencedByStored(*b, refs); })) {
+            referenced.insert(fork.first->getHash());
+            continue;
+        }
+        if (std::any_of(blocks.begin(), blocks.end(), [&](const index_t* b) { return isReferencedByPending(*b, refs); })) {
+            // checked again on the next run, the mempool VTBs may be gone by then
+            continue;
+        }
+
+        std::vector<hash_t> hashes;
+        hashes.reserve(blocks.size());
+        for (const index_t* b : blocks) {
+            hashes.push_back(b->getHash());
+        }
+        tree.removeSubtree(*fork.first);
+        for (const auto& hash : hashes) {
+            batch.Erase(std::make_pair(dbPrefix, hash));
+        }
+        removed += hashes.size();
+    }
+    return removed;
+}
+
+} // namespace
+
+int GetPopCompactionVbkDepth()
+{
+    return static_cast<int>(GetPop().config->vbk.params->getEndorsementSettlementInterval());
+}
+
+int GetPopCompactionBtcDepth()
+{
+    return static_cast<int>(GetPop().config->btc.params->getDifficultyAdjustmentInterval());
+}
+
+PopCompactionStats CompactPopTrees(int vbkDepth, int btcDepth)
+{
+    PopCompactionStats stats;
+    LOCK(cs_main);
+    if (::ChainstateActive().IsInitialBlockDownload() || !pblocktree) {
+        return stats;
+    }
+
+    auto& tree = *GetPop().altTree;
+    if (findStaleForks(tree.vbk(), vbkDepth, g_referenced_vbk_forks).empty() && findStaleForks(tree.btc(), btcDepth, g_referenced_btc_forks).empty()) {
+        return stats;
+    }
+
+    // reading the stored VTBs is only worth it once there is something to prune
+    const PopReferences refs = collectVtbReferences();
+    stats.read_vtbs = true;
+    CDBBatch batch(*pblocktree);
+    stats.vbk_blocks = pruneStaleForks(tree.vbk(), vbkDepth, refs, g_referenced_vbk_forks, DB_VBK_BLOCK, batch);
+    stats.btc_blocks = pruneStaleForks(tree.btc(), btcDepth, refs, g_referenced_btc_forks, DB_BTC_BLOCK, batch);
+
+    if (stats.vbk_blocks + stats.btc_blocks > 0) {
+        if (!pblocktree->WriteBatch(batch)) {
+            LogPrintf("%s: failed to erase pruned PoP blocks from database\n", __func__);
+        }
+        LogPrint(BCLog::POP, "Pruned %d VBK and %d BTC blocks of stale forks\n", stats.vbk_blocks, stats.btc_blocks);
+        MarkPopChainTipsDirty();
+    }
+    return stats;
+}
+
+PopCompactionStats CompactPopTrees()
+{
+    return CompactPopTrees(GetPopCompactionVbkDepth(), GetPopCompactionBtcDepth());
+}
+
+} // namespace VeriBlock
@@ -0,0 +1,53 @@
+// Copyright (c) 2019-2020 Xenios SEZC
+// https://www.veriblock.org
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef BITCOIN_SRC_VBK_POP_COMPACTION_HPP
+#define BITCOIN_SRC_VBK_POP_COMPACTION_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace VeriBlock {
+
+//! Run compaction every 10 minutes
+static const int64_t POP_COMPACTION_INTERVAL = 10 * 60;
+
+struct PopCompactionStats {
+    size_t vbk_blocks = 0;
+    size_t btc_blocks = 0;
+    //! whether the stored VTBs were read to find the blocks they depend on
+    bool read_vtbs = false;
+};
+
+/**
+ * Depth below the best VBK tip past which stale VBK forks are pruned: the VBK
+ * endorsement settlement interval, older VBK blocks can not get endorsements
+ * that count in VBK fork resolution.
+ */
+int GetPopCompactionVbkDepth();
+
+/**
+ * Depth below the best BTC tip past which stale BTC forks are pruned: one BTC
+ * difficulty adjustment interval, the history the BTC tree needs anyway.
+ */
+int GetPopCompactionBtcDepth();
+
+/**
+ * Remove stale forks of the VBK and BTC trees that can no longer become
+ * active, and erase them from the block tree database. Forks are kept if
+ * they contain VBK blocks referenced by ALT block payloads, or VBK or BTC
+ * blocks a stored or pending VTB depends on, so that ALT reorgs and reloads
+ * that an unpruned node accepts still succeed. The ALT tree is not
+ * compacted, every ALT index belongs to a CBlockIndex. Forks that stored
+ * payloads depend on are remembered and not looked at again.
+ *
+ * Does nothing during initial block download.
+ */
+PopCompactionStats CompactPopTrees(int vbkDepth, int btcDepth);
+PopCompactionStats CompactPopTrees();
+
+} // namespace VeriBlock
+
+#endif //BITCOIN_SRC_VBK_POP_COMPACTION_HPP
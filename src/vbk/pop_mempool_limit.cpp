@@ -0,0 +1,342 @@
+// Copyright (c) 2019-2020 Xenios SEZC
+// https://www.veriblock.org
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <logging.h>
+#include <memusage.h>
+#include <serialize.h>
+#include <util/system.h>
+#include <util/time.h>
+#include <validation.h>
+#include <version.h>
+
+#include <algorithm>
+#include <cassert>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include "pop_mempool_limit.hpp"
+#include <vbk/pop_common.hpp>
+
+namespace VeriBlock {
+
+namespace {
+
+struct TrackedEntry {
+    //! time (in seconds) when the payload was submitted
+    int64_t first_seen;
+    size_t usage;
+};
+
+//! Payloads of type T in the PoP mempool with their submission time and estimated usage
+template <typename T>
+struct Tracked {
+    std::map<typename T::id_t, TrackedEntry> entries;
+    size_t usage = 0;
+};
+
+template <typename T>
+Tracked<T>& tracked() EXCLUSIVE_LOCKS_REQUIRED(cs_main)
+{
+    static Tracked<T> t;
+    return t;
+}
+
+template <typename T>
+size_t entryUsage(const T& payload)
+{
+    // decoded payload plus its serialized data, shared_ptr control block and hash map node
+    return memusage::MallocUsage(sizeof(T)) + ::GetSerializeSize(payload, PROTOCOL_VERSION) +
+           memusage::MallocUsage(2 * sizeof(long)) +
+           memusage::MallocUsage(sizeof(std::pair<const typename T::id_t, std::shared_ptr<T>>) + sizeof(void*));
+}
+
+template <typename T>
+std::shared_ptr<T> findInMempool(altintegration::MemPool& mp, const typename T::id_t& id, bool* inflight = nullptr)
+{
+    const auto& map = mp.getMap<T>();
+    auto it = map.find(id);
+    if (it != map.end()) {
+        if (inflight) *inflight = false;
+        return it->second;
+    }
+    const auto& inflightMap = mp.getInFlightMap<T>();
+    auto jt = inflightMap.find(id);
+    if (jt != inflightMap.end()) {
+        if (inflight) *inflight = true;
+        return jt->second;
+    }
+    return nullptr;
+}
+
+//! Start tracking a submitted payload, if the mempool accepted it
+template <typename T>
+void track(altintegration::MemPool& mp, const T& payload, int64_t now) EXCLUSIVE_LOCKS_REQUIRED(cs_main)
+{
+    auto& t = tracked<T>();
+    auto id = payload.getId();
+    if (t.entries.count(id) || !findInMempool<T>(mp, id)) {
+        return;
+    }
+    size_t bytes = entryUsage(payload);
+    t.entries.emplace(id, TrackedEntry{now, bytes});
+    t.usage += bytes;
+}
+
+template <typename T>
+void untrack(const typename T::id_t& id) EXCLUSIVE_LOCKS_REQUIRED(cs_main)
+{
+    auto& t = tracked<T>();
+    auto it = t.entries.find(id);
+    if (it == t.entries.end()) {
+        return;
+    }
+    t.usage -= it->second.usage;
+    t.entries.erase(it);
+}
+
+/**
+ * Bring the tracked payloads of type T in line with the mempool: forget the
+ * ones it dropped on its own and track the ones it holds without a
+ * submission, as seen now. Only untracked payloads are serialized. Without
+ * `force` this is skipped while the counts agree.
+ */
+template <typename T>
+void sync(altintegration::MemPool& mp, int64_t now, bool force) EXCLUSIVE_LOCKS_REQUIRED(cs_main)
+{
+    auto& t = tracked<T>();
+    const auto& map = mp.getMap<T>();
+    const auto& inflightMap = mp.getInFlightMap<T>();
+    if (!force && t.entries.size() == map.size() + inflightMap.size()) {
+        return;
+    }
+
+    Tracked<T> synced;
+    auto add = [&](const std::unordered_map<typename T::id_t, std::shared_ptr<T>>& m) {
+        for (const auto& el : m) {
+            auto it = t.entries.find(el.first);
+            TrackedEntry entry = it != t.entries.end() ? it->second : TrackedEntry{now, entryUsage(*el.second)};
+            synced.usage += entry.usage;
+            synced.entries.emplace(el.first, entry);
+        }
+    };
+    add(map);
+    add(inflightMap);
+    std::swap(t, synced);
+}
+
+void syncAll(bool force) EXCLUSIVE_LOCKS_REQUIRED(cs_main)
+{
+    AssertLockHeld(cs_main);
+    auto& mp = *GetPop().mempool;
+    int64_t now = GetTime();
+    sync<altintegration::VbkBlock>(mp, now, force);
+    sync<altintegration::VTB>(mp, now, force);
+    sync<altintegration::ATV>(mp, now, force);
+}
+
+template <typename T>
+size_t& countOf(PopMempoolUsage& usage);
+template <>
+size_t& countOf<altintegration::ATV>(PopMempoolUsage& usage) { return usage.atvs; }
+template <>
+size_t& countOf<altintegration::VTB>(PopMempoolUsage& usage) { return usage.vtbs; }
+template <>
+size_t& countOf<altintegration::VbkBlock>(PopMempoolUsage& usage) { return usage.vbkblocks; }
+
+template <typename T>
+void addUsage(altintegration::MemPool& mp, PopMempoolUsage& usage) EXCLUSIVE_LOCKS_REQUIRED(cs_main)
+{
+    const auto& t = tracked<T>();
+    countOf<T>(usage) += t.entries.size();
+    usage.inflight += mp.getInFlightMap<T>().size();
+    usage.usage += t.usage;
+}
+
+PopMempoolUsage trackedUsage() EXCLUSIVE_LOCKS_REQUIRED(cs_main)
+{
+    auto& mp = *GetPop().mempool;
+    PopMempoolUsage usage;
+    addUsage<altintegration::VbkBlock>(mp, usage);
+    addUsage<altintegration::VTB>(mp, usage);
+    addUsage<altintegration::ATV>(mp, usage);
+    return usage;
+}
+
+struct EvictionCandidate {
+    bool inflight;
+    int64_t first_seen;
+    size_t usage;
+    // only one of the payloads is set
+    std::shared_ptr<altintegration::ATV> atv;
+    std::shared_ptr<altintegration::VTB> vtb;
+    std::shared_ptr<altintegration::VbkBlock> vbkblock;
+};
+
+void setPayload(EvictionCandidate& c, const std::shared_ptr<altintegration::ATV>& p) { c.atv = p; }
+void setPayload(EvictionCandidate& c, const std::shared_ptr<altintegration::VTB>& p) { c.vtb = p; }
+void setPayload(EvictionCandidate& c, const std::shared_ptr<altintegration::VbkBlock>& p) { c.vbkblock = p; }
+
+template <typename T>
+void addCandidates(altintegration::MemPool& mp, std::vector<EvictionCandidate>& candidates) EXCLUSIVE_LOCKS_REQUIRED(cs_main)
+{
+    for (const auto& el : tracked<T>().entries) {
+        bool inflight = false;
+        auto payload = findInMempool<T>(mp, el.first, &inflight);
+        assert(payload);
+        EvictionCandidate c{inflight, el.second.first_seen, el.second.usage, nullptr, nullptr, nullptr};
+        setPayload(c, payload);
+        candidates.push_back(std::move(c));
+    }
+}
+
+//! Trim the mempool if the tracked payloads take it above `limit`
+void trimIfNeeded(size_t limit) EXCLUSIVE_LOCKS_REQUIRED(cs_main)
+{
+    syncAll(false);
+    if (trackedUsage().usage > limit) {
+        TrimPopMempool(limit);
+    }
+}
+
+} // namespace
+
+size_t GetMaxPopMempoolSize()
+{
+    return gArgs.GetArg("-maxpopmempool", DEFAULT_MAX_POP_MEMPOOL_SIZE) * 1000000;
+}
+
+size_t PopMempoolEntryUsage(const altintegration::ATV& atv)
+{
+    return entryUsage(atv);
+}
+
+size_t PopMempoolEntryUsage(const altintegration::VTB& vtb)
+{
+    return entryUsage(vtb);
+}
+
+size_t PopMempoolEntryUsage(const altintegration::VbkBlock& block)
+{
+    return entryUsage(block);
+}
+
+void LimitPopMempool(const altintegration::ATV& atv)
+{
+    AssertLockHeld(cs_main);
+    track(*GetPop().mempool, atv, GetTime());
+    trimIfNeeded(GetMaxPopMempoolSize());
+}
+
+void LimitPopMempool(const altintegration::VTB& vtb)
+{
+    AssertLockHeld(cs_main);
+    track(*GetPop().mempool, vtb, GetTime());
+    trimIfNeeded(GetMaxPopMempoolSize());
+}
+
+void LimitPopMempool(const altintegration::VbkBlock& block)
+{
+    AssertLockHeld(cs_main);
+    track(*GetPop().mempool, block, GetTime());
+    trimIfNeeded(GetMaxPopMempoolSize());
+}
+
+void LimitPopMempool(const altintegration::PopData& popData)
+{
+    AssertLockHeld(cs_main);
+    auto& mp = *GetPop().mempool;
+    int64_t now = GetTime();
+    for (const auto& b : popData.context) {
+        track(mp, b, now);
+    }
+    for (const auto& vtb : popData.vtbs) {
+        track(mp, vtb, now);
+    }
+    for (const auto& atv : popData.atvs) {
+        track(mp, atv, now);
+    }
+    trimIfNeeded(GetMaxPopMempoolSize());
+}
+
+void UntrackPopMempoolPayloads(const altintegration::PopData& popData)
+{
+    AssertLockHeld(cs_main);
+    for (const auto& b : popData.context) {
+        untrack<altintegration::VbkBlock>(b.getId());
+    }
+    for (const auto& vtb : popData.vtbs) {
+        untrack<altintegration::VTB>(vtb.getId());
+    }
+    for (const auto& atv : popData.atvs) {
+        untrack<altintegration::ATV>(atv.getId());
+    }
+    // the mempool may have dropped payloads that depended on the removed ones
+    syncAll(false);
+}
+
+PopMempoolUsage TrimPopMempool(size_t limit)
+{
+    AssertLockHeld(cs_main);
+    syncAll(true);
+    PopMempoolUsage usage = trackedUsage();
+    if (usage.usage <= limit) {
+        return usage;
+    }
+
+    auto& mp = *GetPop().mempool;
+    std::vector<EvictionCandidate> candidates;
+    addCandidates<altintegration::VbkBlock>(mp, candidates);
+    addCandidates<altintegration::VTB>(mp, candidates);
+    addCandidates<altintegration::ATV>(mp, candidates);
+
+    // least connected (in-flight) first, then oldest first
+    std::sort(candidates.begin(), candidates.end(), [](const EvictionCandidate& a, const EvictionCandidate& b) {
+        if (a.inflight != b.inflight) {
+            return a.inflight;
+        }
+        return a.first_seen < b.first_seen;
+    });
+
+    const size_t target = limit / 100 * POP_MEMPOOL_TRIM_TARGET_PERCENT;
+    size_t remaining = usage.usage;
+    altintegration::PopData evicted;
+    for (const auto& c : candidates) {
+        if (remaining <= target) {
+            break;
+        }
+        remaining -= c.usage;
+        if (c.atv) {
+            evicted.atvs.push_back(*c.atv);
+        } else if (c.vtb) {
+            evicted.vtbs.push_back(*c.vtb);
+        } else {
+            evicted.context.push_back(*c.vbkblock);
+        }
+    }
+
+    mp.removeAll(evicted);
+    UntrackPopMempoolPayloads(evicted);
+    LogPrint(BCLog::POP, "Evicted %d VBK blocks, %d VTBs and %d ATVs from POP mempool (usage %u > limit %u)\n",
+        evicted.context.size(), evicted.vtbs.size(), evicted.atvs.size(), usage.usage, limit);
+
+    return trackedUsage();
+}
+
+PopMempoolUsage GetPopMempoolUsage()
+{
+    syncAll(false);
+    return trackedUsage();
+}
+
+void ResetPopMempoolUsage()
+{
+    LOCK(cs_main);
+    tracked<altintegration::ATV>() = Tracked<altintegration::ATV>();
+    tracked<altintegration::VTB>() = Tracked<altintegration::VTB>();
+    tracked<altintegration::VbkBlock>() = Tracked<altintegration::VbkBlock>();
+}
+
+} // namespace VeriBlock
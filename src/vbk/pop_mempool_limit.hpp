@@ -0,0 +1,78 @@
+// Copyright (c) 2019-2020 Xenios SEZC
+// https://www.veriblock.org
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef BITCOIN_SRC_VBK_POP_MEMPOOL_LIMIT_HPP
+#define BITCOIN_SRC_VBK_POP_MEMPOOL_LIMIT_HPP
+
+#include <veriblock/entities/atv.hpp>
+#include <veriblock/entities/popdata.hpp>
+#include <veriblock/entities/vbkblock.hpp>
+#include <veriblock/entities/vtb.hpp>
+
+#include <cstddef>
+
+namespace VeriBlock {
+
+//! Default for -maxpopmempool, maximum megabytes of PoP mempool memory usage
+static const unsigned int DEFAULT_MAX_POP_MEMPOOL_SIZE = 100;
+
+//! When the limit is exceeded, payloads are evicted until usage is below this percentage of it
+static const unsigned int POP_MEMPOOL_TRIM_TARGET_PERCENT = 90;
+
+struct PopMempoolUsage {
+    size_t atvs = 0;
+    size_t vtbs = 0;
+    size_t vbkblocks = 0;
+    //! payloads waiting for missing VBK context (in-flight)
+    size_t inflight = 0;
+    //! estimated memory usage in bytes
+    size_t usage = 0;
+};
+
+//! -maxpopmempool in bytes
+size_t GetMaxPopMempoolSize();
+
+//! Estimated memory used by a payload stored in the PoP mempool
+size_t PopMempoolEntryUsage(const altintegration::ATV& atv);
+size_t PopMempoolEntryUsage(const altintegration::VTB& vtb);
+size_t PopMempoolEntryUsage(const altintegration::VbkBlock& block);
+
+/**
+ * Account for payloads submitted to the PoP mempool and trim it if they took
+ * it above -maxpopmempool. Must be called after every submission: it records
+ * the submission time that eviction goes by, and computes the usage of each
+ * payload once.
+ *
+ * Payloads the mempool drops or gains on its own are picked up when the
+ * tracked counts no longer match the mempool, without recomputing the usage
+ * of the payloads that are still tracked.
+ */
+void LimitPopMempool(const altintegration::ATV& atv);
+void LimitPopMempool(const altintegration::VTB& vtb);
+void LimitPopMempool(const altintegration::VbkBlock& block);
+void LimitPopMempool(const altintegration::PopData& popData);
+
+//! Stop tracking payloads removed from the PoP mempool, must be called after removing them
+void UntrackPopMempoolPayloads(const altintegration::PopData& popData);
+
+/**
+ * Evict payloads while PoP mempool usage is above `limit`, down to
+ * POP_MEMPOOL_TRIM_TARGET_PERCENT of it. In-flight payloads that do not
+ * connect to known VBK blocks are evicted first, then the rest; the earliest
+ * submitted first within each group.
+ *
+ * @return usage after trimming
+ */
+PopMempoolUsage TrimPopMempool(size_t limit);
+
+//! Current PoP mempool usage, from the tracked payloads
+PopMempoolUsage GetPopMempoolUsage();
+
+//! Forget tracked usage, called when the PoP mempool is recreated
+void ResetPopMempoolUsage();
+
+} // namespace VeriBlock
+
+#endif //BITCOIN_SRC_VBK_POP_MEMPOOL_LIMIT_HPP
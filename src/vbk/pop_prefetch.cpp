@@ -0,0 +1,159 @@
+// Copyright (c) 2019-2020 Xenios SEZC
+// https://www.veriblock.org
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <blockreadahead.h>
+#include <sync.h>
+#include <uint256.h>
+
+#include <atomic>
+#include <map>
+#include <vector>
+
+#include "pop_prefetch.hpp"
+
+namespace VeriBlock {
+
+namespace {
+
+struct PrefetchedBlock {
+    explicit PrefetchedBlock(int h) : height(h) {}
+
+    int height;
+    std::vector<altintegration::ATV::id_t> atvs;
+    std::vector<altintegration::VTB::id_t> vtbs;
+    std::vector<altintegration::VbkBlock::id_t> vbkblocks;
+};
+
+Mutex g_prefetch_mutex;
+//! blocks whose payloads are cached
+std::map<uint256, PrefetchedBlock> g_blocks GUARDED_BY(g_prefetch_mutex);
+std::map<altintegration::ATV::id_t, altintegration::ATV> g_atvs GUARDED_BY(g_prefetch_mutex);
+std::map<altintegration::VTB::id_t, altintegration::VTB> g_vtbs GUARDED_BY(g_prefetch_mutex);
+std::map<altintegration::VbkBlock::id_t, altintegration::VbkBlock> g_vbkblocks GUARDED_BY(g_prefetch_mutex);
+
+std::atomic<uint64_t> g_added_blocks{0};
+std::atomic<uint64_t> g_hits{0};
+std::atomic<uint64_t> g_misses{0};
+
+template <typename T>
+void addPayloads(const std::vector<T>& payloads, std::map<typename T::id_t, T>& cache, std::vector<typename T::id_t>& ids) EXCLUSIVE_LOCKS_REQUIRED(g_prefetch_mutex)
+{
+    for (const auto& payload : payloads) {
+        auto id = payload.getId();
+        cache.emplace(id, payload);
+        ids.push_back(id);
+    }
+}
+
+template <typename T>
+void removePayloads(std::map<typename T::id_t, T>& cache, const std::vector<typename T::id_t>& ids) EXCLUSIVE_LOCKS_REQUIRED(g_prefetch_mutex)
+{
+    for (const auto& id : ids) {
+        cache.erase(id);
+    }
+}
+
+template <typename T>
+bool findPayload(const std::map<typename T::id_t, T>& cache, const typename T::id_t& id, T& out) EXCLUSIVE_LOCKS_REQUIRED(g_prefetch_mutex)
+{
+    auto it = cache.find(id);
+    if (it == cache.end()) {
+        ++g_misses;
+        return false;
+    }
+    out = it->second;
+    ++g_hits;
+    return true;
+}
+
+} // namespace
+
+void AddPrefetchedPayloads(const uint256& hash, int height, const altintegration::PopData& popData)
+{
+    if (popData.empty()) {
+        return;
+    }
+
+    LOCK(g_prefetch_mutex);
+    // stale forks are only evicted once the tip passes them, keep the cache bounded meanwhile
+    if (g_blocks.size() >= 2 * (size_t)GetBlockReadAheadDepth()) {
+        return;
+    }
+    auto inserted = g_blocks.emplace(hash, PrefetchedBlock(height));
+    if (!inserted.second) {
+        return;
+    }
+    auto& block = inserted.first->second;
+    addPayloads(popData.atvs, g_atvs, block.atvs);
+    addPayloads(popData.vtbs, g_vtbs, block.vtbs);
+    addPayloads(popData.context, g_vbkblocks, block.vbkblocks);
+    ++g_added_blocks;
+}
+
+void EvictPrefetchedPayloads(int height)
+{
+    LOCK(g_prefetch_mutex);
+    for (auto it = g_blocks.begin(); it != g_blocks.end();) {
+        if (it->second.height > height) {
+            ++it;
+            continue;
+        }
+        removePayloads(g_atvs, it->second.atvs);
+        removePayloads(g_vtbs, it->second.vtbs);
+        removePayloads(g_vbkblocks, it->second.vbkblocks);
+        it = g_blocks.erase(it);
+    }
+}
+
+void ClearPrefetchedPayloads()
+{
+    LOCK(g_prefetch_mutex);
+    g_blocks.clear();
+    g_atvs.clear();
+    g_vtbs.clear();
+    g_vbkblocks.clear();
+}
+
+bool GetPrefetchedPayload(const altintegration::ATV::id_t& id, altintegration::ATV& out)
+{
+    if (GetBlockReadAheadDepth() == 0) return false;
+    LOCK(g_prefetch_mutex);
+    return findPayload(g_atvs, id, out);
+}
+
+bool GetPrefetchedPayload(const altintegration::VTB::id_t& id, altintegration::VTB& out)
+{
+    if (GetBlockReadAheadDepth() == 0) return false;
+    LOCK(g_prefetch_mutex);
+    return findPayload(g_vtbs, id, out);
+}
+
+bool GetPrefetchedPayload(const altintegration::VbkBlock::id_t& id, altintegration::VbkBlock& out)
+{
+    if (GetBlockReadAheadDepth() == 0) return false;
+    LOCK(g_prefetch_mutex);
+    return findPayload(g_vbkblocks, id, out);
+}
+
+PopPrefetchStats GetPopPrefetchStats()
+{
+    PopPrefetchStats stats;
+    stats.blocks = g_added_blocks;
+    stats.hits = g_hits;
+    stats.misses = g_misses;
+
+    LOCK(g_prefetch_mutex);
+    stats.cached_blocks = g_blocks.size();
+    return stats;
+}
+
+void ResetPopPrefetchStats()
+{
+    g_added_blocks = 0;
+    g_hits = 0;
+    g_misses = 0;
+}
+
+} // namespace VeriBlock
@@ -0,0 +1,51 @@
+// Copyright (c) 2019-2020 Xenios SEZC
+// https://www.veriblock.org
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef BITCOIN_SRC_VBK_POP_PREFETCH_HPP
+#define BITCOIN_SRC_VBK_POP_PREFETCH_HPP
+
+#include <vbk/pop_common.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+class uint256;
+
+namespace VeriBlock {
+
+struct PopPrefetchStats {
+    //! read-ahead blocks whose payloads were added to the cache
+    uint64_t blocks = 0;
+    //! payload lookups served from the prefetch cache
+    uint64_t hits = 0;
+    //! payload lookups that fell through to the payloads database
+    uint64_t misses = 0;
+    //! blocks currently held in the prefetch cache
+    size_t cached_blocks = 0;
+};
+
+/**
+ * Keep the decoded ATVs, VTBs and VBK blocks of a block the read-ahead thread
+ * has read, so that setState does not wait for the payloads database. There
+ * is no separate read pipeline, the cache is filled from -blockreadahead and
+ * is enabled while the read-ahead thread runs.
+ */
+void AddPrefetchedPayloads(const uint256& hash, int height, const altintegration::PopData& popData);
+
+//! Drop the payloads of cached blocks at or below `height`, the active chain has passed them
+void EvictPrefetchedPayloads(int height);
+void ClearPrefetchedPayloads();
+
+//! Look up a prefetched payload, counts a hit or a miss while prefetching is enabled
+bool GetPrefetchedPayload(const altintegration::ATV::id_t& id, altintegration::ATV& out);
+bool GetPrefetchedPayload(const altintegration::VTB::id_t& id, altintegration::VTB& out);
+bool GetPrefetchedPayload(const altintegration::VbkBlock::id_t& id, altintegration::VbkBlock& out);
+
+PopPrefetchStats GetPopPrefetchStats();
+void ResetPopPrefetchStats();
+
+} // namespace VeriBlock
+
+#endif //BITCOIN_SRC_VBK_POP_PREFETCH_HPP
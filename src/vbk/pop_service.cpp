@@ -7,7 +7,9 @@
 #include <chainparams.h>
 #include <consensus/validation.h>
 #include <dbwrapper.h>
+#include <memusage.h>
 #include <shutdown.h>
+#include <tinyformat.h>
 #include <validation.h>
 #include <vbk/adaptors/block_batch_adaptor.hpp>
 #include <vbk/adaptors/payloads_provider.hpp>
@@ -17,20 +19,37 @@
 #include <boost/thread/interruption.hpp>
 #endif //WIN32
 
+#include <algorithm>
+#include <set>
+
 #include "pop_service.hpp"
 #include <vbk/p2p_sync.hpp>
+#include <vbk/pop_chaintips.hpp>
 #include <vbk/pop_common.hpp>
+#include <vbk/pop_mempool_limit.hpp>
+#include <vbk/pop_stats.hpp>
 
 namespace VeriBlock {
 
 static std::shared_ptr<PayloadsProvider> payloads = nullptr;
 static std::vector<altintegration::PopData> disconnected_popdata;
 
+//! Payload ids of the ALT tree by type, kept up to date by addAllBlockPayloads
+struct PopPayloadIdCounts {
+    size_t atvs = 0;
+    size_t vtbs = 0;
+    size_t vbkblocks = 0;
+};
+static PopPayloadIdCounts payloadIdCounts GUARDED_BY(cs_main);
+
 void SetPop(CDBWrapper& db)
 {
     payloads = std::make_shared<PayloadsProvider>(db);
     std::shared_ptr<altintegration::PayloadsProvider> dbrepo = payloads;
     SetPop(dbrepo);
+    ResetPopMempoolUsage();
+    ResetPopChainTips();
+    WITH_LOCK(cs_main, payloadIdCounts = PopPayloadIdCounts());
 
     auto& app = GetPop();
     app.mempool->onAccepted<altintegration::ATV>(VeriBlock::p2p::offerPopDataToAllNodes<altintegration::ATV>);
@@ -80,6 +99,7 @@ CBlockIndex* compareTipToBlock(CBlockIndex* candidate)
 bool acceptBlock(const CBlockIndex& indexNew, BlockValidationState& state)
 {
     AssertLockHeld(cs_main);
+    PopStageTimer timer(PopStage::ACCEPT_BLOCK_HEADER);
     auto containing = VeriBlock::blockToAltBlock(indexNew);
     altintegration::ValidationState instate;
     if (!GetPop().altTree->acceptBlockHeader(containing, instate)) {
@@ -90,6 +110,35 @@ bool acceptBlock(const CBlockIndex& indexNew, BlockValidationState& state)
     return true;
 }
 
+bool acceptBlocks(const std::vector<CBlockIndex*>& indexes, std::vector<CBlockIndex*>& failed, BlockValidationState& state)
+{
+    AssertLockHeld(cs_main);
+    if (indexes.empty()) {
+        return true;
+    }
+
+    auto& tree = *GetPop().altTree;
+    bool ret = true;
+    for (CBlockIndex* index : indexes) {
+        altintegration::ValidationState instate;
+        bool accepted;
+        {
+            // one sample per header, like acceptBlock
+            PopStageTimer timer(PopStage::ACCEPT_BLOCK_HEADER);
+            accepted = tree.acceptBlockHeader(blockToAltBlock(*index), instate);
+        }
+        if (!accepted) {
+            LogPrintf("ERROR: alt tree cannot accept block %s\n", instate.toString());
+            if (ret) {
+                state.Invalid(BlockValidationResult::BLOCK_CACHED_INVALID, instate.GetPath());
+                ret = false;
+            }
+            failed.push_back(index);
+        }
+    }
+    return ret;
+}
+
 bool checkPopDataSize(const altintegration::PopData& popData, altintegration::ValidationState& state)
 {
     uint32_t nPopDataSize = ::GetSerializeSize(popData, CLIENT_VERSION);
@@ -109,6 +158,7 @@ bool popdataStatelessValidation(const altintegration::PopData& popData, altinteg
 bool addAllBlockPayloads(const CBlock& block, BlockValidationState& state) EXCLUSIVE_LOCKS_REQUIRED(cs_main)
 {
     AssertLockHeld(cs_main);
+    PopStageTimer timer(PopStage::ADD_BLOCK_PAYLOADS);
     auto bootstrapBlockHeight = GetPop().config->alt->getBootstrapBlock().height;
     auto hash = block.GetHash();
     auto* index = LookupBlockIndex(hash);
@@ -129,6 +179,10 @@ bool addAllBlockPayloads(const CBlock& block, BlockValidationState& state) EXCLU
     provider.write(block.popData);
 
     GetPop().altTree->acceptBlock(block.GetHash().asVector(), block.popData);
+    MarkPopChainTipsDirty();
+    payloadIdCounts.atvs += block.popData.atvs.size();
+    payloadIdCounts.vtbs += block.popData.vtbs.size();
+    payloadIdCounts.vbkblocks += block.popData.context.size();
 
     return true;
 }
@@ -136,7 +190,10 @@ bool addAllBlockPayloads(const CBlock& block, BlockValidationState& state) EXCLU
 bool setState(const uint256& block, altintegration::ValidationState& state) EXCLUSIVE_LOCKS_REQUIRED(cs_main)
 {
     AssertLockHeld(cs_main);
-    return GetPop().altTree->setState(block.asVector(), state);
+    PopStageTimer timer(PopStage::SET_STATE);
+    bool ret = GetPop().altTree->setState(block.asVector(), state);
+    MarkPopChainTipsDirty();
+    return ret;
 }
 
 altintegration::PopData getPopData() EXCLUSIVE_LOCKS_REQUIRED(cs_main)
@@ -198,6 +255,7 @@ void addPopPayoutsIntoCoinbaseTx(CMutableTransaction& coinbaseTx, const CBlockIn
 bool checkCoinbaseTxWithPopRewards(const CTransaction& tx, const CAmount& nFees, const CBlockIndex& pindexPrev, const Consensus::Params& consensusParams, BlockValidationState& state) EXCLUSIVE_LOCKS_REQUIRED(cs_main)
 {
     AssertLockHeld(cs_main);
+    PopStageTimer timer(PopStage::CHECK_COINBASE_REWARDS);
     PoPRewards rewards = getPopRewards(pindexPrev, consensusParams);
     CAmount nTotalPopReward = 0;
 
@@ -358,6 +416,8 @@ bool loadTrees(CDBIterator& iter)
     if (!LoadTree(iter, DB_ALT_BLOCK, BlockBatchAdaptor::alttip(), *pop.altTree, state)) {
         return error("%s: failed to load ALT tree %s", __func__, state.toString());
     }
+    ResetPopChainTips();
+    WITH_LOCK(cs_main, recountPopPayloadIds());
     return true;
 }
 
@@ -365,12 +425,127 @@ void removePayloadsFromMempool(const altintegration::PopData& popData) EXCLUSIVE
 {
     AssertLockHeld(cs_main);
     GetPop().mempool->removeAll(popData);
+    UntrackPopMempoolPayloads(popData);
+}
+
+//! Payload types in the order they are paginated
+static const std::vector<std::string> POP_MEMPOOL_PAGE_TYPES = {"vbkblock", "vtb", "atv"};
+
+/**
+ * Append up to `left` ids of type T greater than `after` (all ids if `after`
+ * is empty) to `out`, in ascending order, and update `left` and `last`.
+ *
+ * @return true if there are more entries of type T after the last appended one
+ * @throws std::exception if `after` is not a valid id
+ */
+template <typename T>
+static bool appendPopMempoolPage(altintegration::MemPool& mp, const std::string& type, const std::string& after, size_t& left, std::vector<typename T::id_t>& out, std::string& last)
+{
+    using id_t = typename T::id_t;
+    id_t cursor;
+    if (!after.empty()) {
+        cursor = id_t::fromHex(after);
+    }
+
+    // select left + 1 smallest ids to know if there is a next page
+    std::set<id_t> page;
+    for (const auto& el : mp.getMap<T>()) {
+        if (!after.empty() && !(cursor < el.first)) {
+            continue;
+        }
+        if (page.size() == left + 1) {
+            if (!(el.first < *page.rbegin())) {
+                continue;
+            }
+            page.erase(std::prev(page.end()));
+        }
+        page.insert(el.first);
+    }
+
+    bool hasMore = page.size() > left;
+    for (const auto& id : page) {
+        if (left == 0) {
+            break;
+        }
+        out.push_back(id);
+        last = type + ":" + id.toHex();
+        --left;
+    }
+    return hasMore;
+}
+
+bool getPopMempoolPage(const std::string& cursor, size_t count, PopMempoolPage& page, std::string& error) EXCLUSIVE_LOCKS_REQUIRED(cs_main)
+{
+    AssertLockHeld(cs_main);
+    size_t typeIndex = 0;
+    std::string after;
+    if (!cursor.empty()) {
+        auto sep = cursor.find(':');
+        auto it = std::find(POP_MEMPOOL_PAGE_TYPES.begin(), POP_MEMPOOL_PAGE_TYPES.end(), cursor.substr(0, sep));
+        if (sep == std::string::npos || it == POP_MEMPOOL_PAGE_TYPES.end()) {
+            error = "Bad cursor, expected \"<vbkblock|vtb|atv>:<id>\"";
+            return false;
+        }
+        typeIndex = it - POP_MEMPOOL_PAGE_TYPES.begin();
+        after = cursor.substr(sep + 1);
+    }
+
+    auto& mp = *GetPop().mempool;
+    auto hasEntries = [&mp](size_t type) {
+        switch (type) {
+        case 0:
+            return !mp.getMap<altintegration::VbkBlock>().empty();
+        case 1:
+            return !mp.getMap<altintegration::VTB>().empty();
+        default:
+            return !mp.getMap<altintegration::ATV>().empty();
+        }
+    };
+
+    page = PopMempoolPage();
+    size_t left = count;
+    std::string last;
+    try {
+        for (; typeIndex < POP_MEMPOOL_PAGE_TYPES.size(); ++typeIndex, after.clear()) {
+            if (left == 0) {
+                // page is full, continue after the last returned entry
+                if (hasEntries(typeIndex)) {
+                    page.next = last;
+                    break;
+                }
+                continue;
+            }
+
+            const std::string& type = POP_MEMPOOL_PAGE_TYPES[typeIndex];
+            bool hasMore = false;
+            switch (typeIndex) {
+            case 0:
+                hasMore = appendPopMempoolPage<altintegration::VbkBlock>(mp, type, after, left, page.vbkblocks, last);
+                break;
+            case 1:
+                hasMore = appendPopMempoolPage<altintegration::VTB>(mp, type, after, left, page.vtbs, last);
+                break;
+            default:
+                hasMore = appendPopMempoolPage<altintegration::ATV>(mp, type, after, left, page.atvs, last);
+                break;
+            }
+            if (hasMore) {
+                page.next = last;
+                break;
+            }
+        }
+    } catch (const std::exception& e) {
+        error = strprintf("Bad cursor: %s", e.what());
+        return false;
+    }
+    return true;
 }
 
 int compareForks(const CBlockIndex& leftForkTip, const CBlockIndex& rightForkTip) EXCLUSIVE_LOCKS_REQUIRED(cs_main)
 {
     auto& pop = GetPop();
     AssertLockHeld(cs_main);
+    PopStageTimer timer(PopStage::COMPARE_FORKS);
     if (&leftForkTip == &rightForkTip) {
         return 0;
     }
@@ -383,10 +558,13 @@ int compareForks(const CBlockIndex& leftForkTip, const CBlockIndex& rightForkTip
         if (!pop.altTree->setState(right.hash, state)) {
             throw std::logic_error("both chains are invalid");
         }
+        MarkPopChainTipsDirty();
         return -1;
     }
 
-    return pop.altTree->comparePopScore(left.hash, right.hash);
+    int result = pop.altTree->comparePopScore(left.hash, right.hash);
+    MarkPopChainTipsDirty();
+    return result;
 }
 
 CAmount getCoinbaseSubsidy(const CAmount& subsidy)
@@ -399,6 +577,7 @@ void updatePopMempoolForReorg() EXCLUSIVE_LOCKS_REQUIRED(cs_main)
     auto& pop = GetPop();
     for (const auto& popData : disconnected_popdata) {
         pop.mempool->submitAll(popData);
+        LimitPopMempool(popData);
     }
     disconnected_popdata.clear();
 }
@@ -408,4 +587,57 @@ void addDisconnectedPopdata(const altintegration::PopData& popData) EXCLUSIVE_LO
     disconnected_popdata.push_back(popData);
 }
 
+template <typename Tree>
+static PopTreeMemoryUsage getTreeMemoryUsage(Tree& tree, size_t headerUsage)
+{
+    const auto& blocks = tree.getBlocks();
+    using map_t = typename std::decay<decltype(blocks)>::type;
+    using index_t = typename std::pointer_traits<typename map_t::mapped_type>::element_type;
+
+    PopTreeMemoryUsage usage;
+    usage.blocks = blocks.size();
+    usage.usage = memusage::DynamicUsage(blocks) + blocks.size() * (memusage::MallocUsage(sizeof(index_t)) + headerUsage);
+    return usage;
+}
+
+//! Memory of one payload id: its entry in the ALT block index, and its payloads index entry with one containing ALT block
+template <typename pop_t>
+static size_t getPayloadIdMemoryUsage()
+{
+    using bytes_t = std::vector<uint8_t>;
+    using entry_t = std::pair<const bytes_t, std::set<bytes_t>>;
+    const size_t idSize = sizeof(typename pop_t::id_t);
+    return idSize +
+           memusage::MallocUsage(sizeof(memusage::unordered_node<entry_t>)) + sizeof(void*) + memusage::MallocUsage(idSize) +
+           memusage::MallocUsage(sizeof(memusage::stl_tree_node<bytes_t>)) + memusage::MallocUsage(sizeof(uint256));
+}
+
+void recountPopPayloadIds() EXCLUSIVE_LOCKS_REQUIRED(cs_main)
+{
+    AssertLockHeld(cs_main);
+    payloadIdCounts = PopPayloadIdCounts();
+    for (const auto& it : GetPop().altTree->getBlocks()) {
+        const auto& index = *it.second;
+        payloadIdCounts.atvs += index.getPayloadIds<altintegration::ATV>().size();
+        payloadIdCounts.vtbs += index.getPayloadIds<altintegration::VTB>().size();
+        payloadIdCounts.vbkblocks += index.getPayloadIds<altintegration::VbkBlock>().size();
+    }
+}
+
+PopTreesMemoryUsage getPopTreesMemoryUsage() EXCLUSIVE_LOCKS_REQUIRED(cs_main)
+{
+    AssertLockHeld(cs_main);
+    auto& tree = *GetPop().altTree;
+    PopTreesMemoryUsage usage;
+    // ALT headers keep the block hash and previous block hash on the heap
+    usage.alt = getTreeMemoryUsage(tree, 2 * memusage::MallocUsage(sizeof(uint256)));
+    usage.vbk = getTreeMemoryUsage(tree.vbk(), 0);
+    usage.btc = getTreeMemoryUsage(tree.btc(), 0);
+    usage.payloads.ids = payloadIdCounts.atvs + payloadIdCounts.vtbs + payloadIdCounts.vbkblocks;
+    usage.payloads.usage = payloadIdCounts.atvs * getPayloadIdMemoryUsage<altintegration::ATV>() +
+                           payloadIdCounts.vtbs * getPayloadIdMemoryUsage<altintegration::VTB>() +
+                           payloadIdCounts.vbkblocks * getPayloadIdMemoryUsage<altintegration::VbkBlock>();
+    return usage;
+}
+
 } // namespace VeriBlock
@@ -26,12 +26,49 @@ namespace VeriBlock {
 using BlockBytes = std::vector<uint8_t>;
 using PoPRewards = std::map<CScript, CAmount>;
 
+struct PopTreeMemoryUsage {
+    size_t blocks = 0;
+    //! estimated memory usage of block indexes and the tree's block map, in bytes
+    size_t usage = 0;
+};
+
+struct PopPayloadsMemoryUsage {
+    //! payload ids referenced by ALT blocks
+    size_t ids = 0;
+    //! estimated memory usage of the ids in the ALT block indexes and of the payloads index, in bytes
+    size_t usage = 0;
+};
+
+struct PopTreesMemoryUsage {
+    PopTreeMemoryUsage alt;
+    PopTreeMemoryUsage vbk;
+    PopTreeMemoryUsage btc;
+    PopPayloadsMemoryUsage payloads;
+
+    size_t total() const { return alt.usage + vbk.usage + btc.usage + payloads.usage; }
+};
+
+//! Default and maximum number of entries in one page of the POP mempool
+static const int DEFAULT_POP_MEMPOOL_PAGE_SIZE = 1000;
+static const int MAX_POP_MEMPOOL_PAGE_SIZE = 10000;
+
+//! Ids of a page of POP mempool entries, ordered by type (VBK blocks, VTBs, ATVs) and id
+struct PopMempoolPage {
+    std::vector<altintegration::VbkBlock::id_t> vbkblocks;
+    std::vector<altintegration::VTB::id_t> vtbs;
+    std::vector<altintegration::ATV::id_t> atvs;
+    //! "<vbkblock|vtb|atv>:<id>" cursor to pass to get the next page, empty if there are no more entries
+    std::string next;
+};
+
 void SetPop(CDBWrapper& db);
 
 PayloadsProvider& GetPayloadsProvider();
 
 CBlockIndex* compareTipToBlock(CBlockIndex* candidate);
 bool acceptBlock(const CBlockIndex& indexNew, BlockValidationState& state);
+//! Accept a run of new headers into the ALT tree. Rejected headers are appended to `failed`, the first rejection is reported in `state`.
+bool acceptBlocks(const std::vector<CBlockIndex*>& indexes, std::vector<CBlockIndex*>& failed, BlockValidationState& state);
 bool checkPopDataSize(const altintegration::PopData& popData, altintegration::ValidationState& state);
 bool popdataStatelessValidation(const altintegration::PopData& popData, altintegration::ValidationState& state);
 bool addAllBlockPayloads(const CBlock& block, BlockValidationState& state);
@@ -52,6 +89,15 @@ bool loadTrees(CDBIterator& iter);
 
 void removePayloadsFromMempool(const altintegration::PopData& popData);
 
+/**
+ * Get up to `count` ids of POP mempool entries after `cursor` (from the
+ * start if it is empty). Only `count` ids are kept in memory, regardless of
+ * the mempool size.
+ *
+ * @return false and set `error` if the cursor is malformed
+ */
+bool getPopMempoolPage(const std::string& cursor, size_t count, PopMempoolPage& page, std::string& error);
+
 int compareForks(const CBlockIndex& left, const CBlockIndex& right);
 
 CAmount getCoinbaseSubsidy(const CAmount& subsidy);
@@ -60,6 +106,12 @@ void updatePopMempoolForReorg();
 
 void addDisconnectedPopdata(const altintegration::PopData& popData);
 
+//! Estimated memory used by the in-memory ALT, VBK and BTC trees and the payloads index. Cheap, does not iterate over blocks.
+PopTreesMemoryUsage getPopTreesMemoryUsage();
+
+//! Count the payload ids of the ALT tree again, after it was replaced or loaded
+void recountPopPayloadIds();
+
 } // namespace VeriBlock
 
 #endif //BITCOIN_SRC_VBK_POP_SERVICE_HPP
@@ -0,0 +1,477 @@
+// Copyright (c) 2019-2020 Xenios SEZC
+// https://www.veriblock.org
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <chain.h>
+#include <hash.h>
+#include <shutdown.h>
+#include <streams.h>
+#include <txdb.h>
+#include <ui_interface.h>
+#include <util/system.h>
+#include <util/translation.h>
+#include <validation.h>
+#include <vbk/adaptors/block_batch_adaptor.hpp>
+#include <vbk/adaptors/payloads_provider.hpp>
+#include <veriblock/storage/util.hpp>
+
+#include <atomic>
+#include <thread>
+
+#include "pop_snapshot.hpp"
+#include <vbk/pop_chaintips.hpp>
+#include <vbk/pop_service.hpp>
+
+namespace VeriBlock {
+
+namespace {
+
+std::thread g_validation_thread;
+std::atomic<bool> g_validation_interrupt{false};
+std::atomic<bool> g_validation_running{false};
+
+//! Writes serialized data to a file and hashes everything written, so that
+//! the checksum can be appended without reading the file back.
+class HashedFileWriter
+{
+public:
+    explicit HashedFileWriter(CAutoFile& file) : file_(file), hasher_(file.GetType(), file.GetVersion()) {}
+
+    int GetType() const { return file_.GetType(); }
+    int GetVersion() const { return file_.GetVersion(); }
+
+    void write(const char* pch, size_t size)
+    {
+        file_.write(pch, size);
+        hasher_.write(pch, size);
+    }
+
+    template <typename T>
+    HashedFileWriter& operator<<(const T& obj)
+    {
+        ::Serialize(*this, obj);
+        return *this;
+    }
+
+    uint256 GetHash() { return hasher_.GetHash(); }
+
+private:
+    CAutoFile& file_;
+    CHashWriter hasher_;
+};
+
+using HashedFileReader = CHashVerifier<CAutoFile>;
+
+template <typename Tree>
+void DumpTree(HashedFileWriter& writer, Tree& tree)
+{
+    const auto* tip = tree.getBestChain().tip();
+    assert(tip && "tree is not bootstrapped");
+    writer << tip->getHash();
+    for (const auto& it : tree.getBlocks()) {
+        writer << *it.second;
+    }
+}
+
+//! Position in `file`
+int64_t FilePos(CAutoFile& file)
+{
+    long pos = ftell(file.Get());
+    if (pos < 0) {
+        throw std::ios_base::failure("failed to get position in file");
+    }
+    return pos;
+}
+
+void SeekFile(CAutoFile& file, int64_t pos)
+{
+    if (fseek(file.Get(), pos, SEEK_SET) != 0) {
+        throw std::ios_base::failure("failed to seek in file");
+    }
+}
+
+//! Bytes left in `file` after the current position
+uint64_t RemainingBytes(CAutoFile& file)
+{
+    int64_t pos = FilePos(file);
+    if (fseek(file.Get(), 0, SEEK_END) != 0) {
+        throw std::ios_base::failure("failed to seek in file");
+    }
+    int64_t end = FilePos(file);
+    SeekFile(file, pos);
+    return end - pos;
+}
+
+template <typename Tree>
+void ReadTree(HashedFileReader& reader, CAutoFile& file, uint64_t count, typename Tree::hash_t& tip, std::vector<typename Tree::index_t>& out)
+{
+    reader >> tip;
+    // every block takes at least one byte, the count is not trusted any further
+    if (count > RemainingBytes(file)) {
+        throw std::ios_base::failure(strprintf("%d blocks do not fit in the rest of the file", count));
+    }
+    out.clear();
+    for (uint64_t i = 0; i < count; ++i) {
+        out.emplace_back();
+        reader >> out.back();
+    }
+
+    // blocks must be loaded in order of their height
+    std::sort(out.begin(), out.end(), [](const typename Tree::index_t& a, const typename Tree::index_t& b) {
+        return a.getHeight() < b.getHeight();
+    });
+}
+
+template <typename pop_t>
+uint64_t DumpPayloads(HashedFileWriter& writer, PayloadsProvider& provider, char dbPrefix)
+{
+    uint64_t total = 0;
+    std::vector<pop_t> chunk;
+    chunk.reserve(POP_SNAPSHOT_CHUNK_SIZE);
+
+    auto flush = [&]() {
+        WriteCompactSize(writer, chunk.size());
+        for (const auto& p : chunk) {
+            writer << p;
+        }
+        total += chunk.size();
+        chunk.clear();
+    };
+
+    provider.forEach<pop_t>(dbPrefix, [&](const pop_t& p) {
+        chunk.push_back(p);
+        if (chunk.size() == POP_SNAPSHOT_CHUNK_SIZE) {
+            flush();
+        }
+        return true;
+    });
+
+    if (!chunk.empty()) {
+        flush();
+    }
+
+    // empty chunk terminates the sequence
+    flush();
+    return total;
+}
+
+void AddPayload(altintegration::PopData& popData, const altintegration::VbkBlock& p) { popData.context.push_back(p); }
+void AddPayload(altintegration::PopData& popData, const altintegration::VTB& p) { popData.vtbs.push_back(p); }
+void AddPayload(altintegration::PopData& popData, const altintegration::ATV& p) { popData.atvs.push_back(p); }
+
+//! Read a sequence of payload chunks and write them to `provider`
+template <typename pop_t>
+uint64_t ReadPayloads(HashedFileReader& reader, PayloadsProvider& provider)
+{
+    uint64_t total = 0;
+    while (true) {
+        uint64_t size = ReadCompactSize(reader);
+        if (size == 0) {
+            break;
+        }
+        if (size > POP_SNAPSHOT_CHUNK_SIZE) {
+            throw std::ios_base::failure(strprintf("%s chunk is too large: %d", pop_t::name(), size));
+        }
+
+        altintegration::PopData chunk;
+        for (uint64_t i = 0; i < size; ++i) {
+            pop_t p;
+            reader >> p;
+            AddPayload(chunk, p);
+        }
+
+        provider.write(chunk);
+        total += size;
+    }
+    return total;
+}
+
+template <typename pop_t>
+void CopyPayloads(PayloadsProvider& from, PayloadsProvider& to, char dbPrefix)
+{
+    altintegration::PopData chunk;
+    size_t size = 0;
+    from.forEach<pop_t>(dbPrefix, [&](const pop_t& p) {
+        AddPayload(chunk, p);
+        if (++size == POP_SNAPSHOT_CHUNK_SIZE) {
+            to.write(chunk);
+            chunk = altintegration::PopData{};
+            size = 0;
+        }
+        return true;
+    });
+    if (size > 0) {
+        to.write(chunk);
+    }
+}
+
+using AltTree = std::remove_reference<decltype(*GetPop().altTree)>::type;
+using VbkTree = altintegration::VbkBlockTree;
+using BtcTree = altintegration::VbkBlockTree::BtcTree;
+
+bool LoadTrees(altintegration::PopContext& pop,
+    std::vector<BtcTree::index_t>& btcblocks, const BtcTree::hash_t& btctip,
+    std::vector<VbkTree::index_t>& vbkblocks, const VbkTree::hash_t& vbktip,
+    std::vector<AltTree::index_t>& altblocks, const AltTree::hash_t& alttip,
+    std::string& error)
+{
+    altintegration::ValidationState state;
+    if (!altintegration::LoadTree(pop.altTree->btc(), btcblocks, btctip, state)) {
+        error = strprintf("failed to load BTC tree: %s", state.toString());
+        return false;
+    }
+    if (!altintegration::LoadTree(pop.altTree->vbk(), vbkblocks, vbktip, state)) {
+        error = strprintf("failed to load VBK tree: %s", state.toString());
+        return false;
+    }
+    if (!altintegration::LoadTree(*pop.altTree, altblocks, alttip, state)) {
+        error = strprintf("failed to load ALT tree: %s", state.toString());
+        return false;
+    }
+    return true;
+}
+
+//! A snapshot can only be applied to PoP state at the bootstrap block, on top of a known base block
+bool CanLoadPopState(const PopSnapshotMetadata& metadata, std::string& error) EXCLUSIVE_LOCKS_REQUIRED(cs_main)
+{
+    AssertLockHeld(cs_main);
+    auto& pop = GetPop();
+    auto* tip = pop.altTree->getBestChain().tip();
+    assert(tip && "alt tree is not bootstrapped");
+    if (tip->getHeight() != pop.config->alt->getBootstrapBlock().height) {
+        error = "PoP state has already advanced past the bootstrap block";
+        return false;
+    }
+
+    const CBlockIndex* base = LookupBlockIndex(metadata.m_base_blockhash);
+    if (!base || base->nHeight != metadata.m_base_height) {
+        error = strprintf("snapshot base block %s is not known, sync headers first", metadata.m_base_blockhash.GetHex());
+        return false;
+    }
+    return true;
+}
+
+template <typename pop_t>
+bool ValidatePayloads(PayloadsProvider& provider, char dbPrefix, uint64_t& validated)
+{
+    altintegration::PopData chunk;
+    size_t size = 0;
+    bool valid = true;
+
+    auto check = [&]() {
+        altintegration::ValidationState state;
+        if (!popdataStatelessValidation(chunk, state)) {
+            LogPrintf("ERROR: PoP snapshot contains invalid %s: %s\n", pop_t::name(), state.toString());
+            valid = false;
+        }
+        validated += size;
+        chunk = altintegration::PopData{};
+        size = 0;
+    };
+
+    provider.forEach<pop_t>(dbPrefix, [&](const pop_t& p) {
+        if (g_validation_interrupt || ShutdownRequested()) {
+            return false;
+        }
+        AddPayload(chunk, p);
+        if (++size == POP_SNAPSHOT_CHUNK_SIZE) {
+            check();
+        }
+        return valid;
+    });
+
+    if (valid && size > 0 && !g_validation_interrupt) {
+        check();
+    }
+
+    return valid;
+}
+
+void ThreadValidatePopSnapshot()
+{
+    const int64_t start = GetTimeMillis();
+    auto& provider = GetPayloadsProvider();
+    uint64_t validated = 0;
+
+    bool valid = ValidatePayloads<altintegration::VbkBlock>(provider, DB_VBK_PREFIX, validated) &&
+                 ValidatePayloads<altintegration::VTB>(provider, DB_VTB_PREFIX, validated) &&
+                 ValidatePayloads<altintegration::ATV>(provider, DB_ATV_PREFIX, validated);
+
+    g_validation_running = false;
+
+    if (g_validation_interrupt) {
+        LogPrintf("PoP snapshot validation interrupted after %d payloads\n", validated);
+        return;
+    }
+
+    if (!valid) {
+        uiInterface.ThreadSafeMessageBox(
+            _("PoP state snapshot contains invalid payloads. Please restart with -reindex.").translated,
+            "", CClientUIInterface::MSG_ERROR);
+        StartShutdown();
+        return;
+    }
+
+    LogPrintf("PoP snapshot validation finished: %d payloads in %dms\n", validated, GetTimeMillis() - start);
+}
+
+} // namespace
+
+bool DumpPopState(CAutoFile& file, PopSnapshotMetadata& metadata, PopSnapshotStats& stats, std::string& error)
+{
+    HashedFileWriter writer(file);
+    auto& pop = GetPop();
+
+    try {
+        // trees are only modified under cs_main, so hold it for as long as
+        // the block indexes are written
+        LOCK(cs_main);
+        auto* tip = pop.altTree->getBestChain().tip();
+        assert(tip && "alt tree is not bootstrapped");
+
+        metadata = PopSnapshotMetadata(uint256(tip->getHash()), tip->getHeight(),
+            pop.altTree->btc().getBlocks().size(),
+            pop.altTree->vbk().getBlocks().size(),
+            pop.altTree->getBlocks().size());
+        writer << metadata;
+
+        DumpTree(writer, pop.altTree->btc());
+        DumpTree(writer, pop.altTree->vbk());
+        DumpTree(writer, *pop.altTree);
+    } catch (const std::exception& e) {
+        error = strprintf("failed to write PoP trees: %s", e.what());
+        return false;
+    }
+
+    try {
+        // payloads are written before blocks are accepted, so the database
+        // iterator always sees a superset of the payloads referenced above
+        auto& provider = GetPayloadsProvider();
+        stats.vbkblocks = DumpPayloads<altintegration::VbkBlock>(writer, provider, DB_VBK_PREFIX);
+        stats.vtbs = DumpPayloads<altintegration::VTB>(writer, provider, DB_VTB_PREFIX);
+        stats.atvs = DumpPayloads<altintegration::ATV>(writer, provider, DB_ATV_PREFIX);
+
+        file << writer.GetHash();
+    } catch (const std::exception& e) {
+        error = strprintf("failed to write PoP payloads: %s", e.what());
+        return false;
+    }
+
+    return true;
+}
+
+bool LoadPopState(CAutoFile& file, CBlockTreeDB& db, PopSnapshotMetadata& metadata, PopSnapshotStats& stats, std::string& error)
+{
+    BtcTree::hash_t btctip;
+    VbkTree::hash_t vbktip;
+    AltTree::hash_t alttip;
+    std::vector<BtcTree::index_t> btcblocks;
+    std::vector<VbkTree::index_t> vbkblocks;
+    std::vector<AltTree::index_t> altblocks;
+
+    // payloads are kept in memory until the trees are known to load, so
+    // that a bad snapshot leaves nothing behind in the payloads database
+    CDBWrapper scratchDb(GetDataDir() / "popsnapshot", 1 << 20, true, true);
+    auto scratch = std::make_shared<PayloadsProvider>(scratchDb);
+
+    try {
+        HashedFileReader reader(&file);
+        reader >> metadata;
+        if (metadata.m_magic != POP_SNAPSHOT_MAGIC) {
+            error = "not a PoP state snapshot";
+            return false;
+        }
+        if (metadata.m_version != POP_SNAPSHOT_VERSION) {
+            error = strprintf("unsupported PoP state snapshot version %d", metadata.m_version);
+            return false;
+        }
+
+        if (!WITH_LOCK(cs_main, return CanLoadPopState(metadata, error))) {
+            return false;
+        }
+
+        ReadTree<BtcTree>(reader, file, metadata.m_btc_blocks_count, btctip, btcblocks);
+        ReadTree<VbkTree>(reader, file, metadata.m_vbk_blocks_count, vbktip, vbkblocks);
+        ReadTree<AltTree>(reader, file, metadata.m_alt_blocks_count, alttip, altblocks);
+
+        stats.vbkblocks = ReadPayloads<altintegration::VbkBlock>(reader, *scratch);
+        stats.vtbs = ReadPayloads<altintegration::VTB>(reader, *scratch);
+        stats.atvs = ReadPayloads<altintegration::ATV>(reader, *scratch);
+
+        uint256 checksum;
+        file >> checksum;
+        if (checksum != reader.GetHash()) {
+            error = "PoP state snapshot checksum mismatch";
+            return false;
+        }
+    } catch (const std::exception& e) {
+        error = strprintf("failed to read PoP state snapshot: %s", e.what());
+        return false;
+    }
+
+    {
+        LOCK(cs_main);
+        // checked again, the PoP state may have advanced while the file was read
+        if (!CanLoadPopState(metadata, error)) {
+            return false;
+        }
+
+        // the trees are first loaded into a fresh context on top of the
+        // buffered payloads, the live trees are only touched once all three
+        // of them are known to load
+        auto& pop = GetPop();
+        {
+            std::shared_ptr<altintegration::PayloadsProvider> dbrepo = scratch;
+            auto fresh = altintegration::PopContext::create(pop.config, dbrepo);
+            if (!LoadTrees(*fresh, btcblocks, btctip, vbkblocks, vbktip, altblocks, alttip, error)) {
+                return false;
+            }
+        }
+
+        auto& provider = GetPayloadsProvider();
+        CopyPayloads<altintegration::VbkBlock>(*scratch, provider, DB_VBK_PREFIX);
+        CopyPayloads<altintegration::VTB>(*scratch, provider, DB_VTB_PREFIX);
+        CopyPayloads<altintegration::ATV>(*scratch, provider, DB_ATV_PREFIX);
+        if (!LoadTrees(pop, btcblocks, btctip, vbkblocks, vbktip, altblocks, alttip, error)) {
+            return false;
+        }
+        recountPopPayloadIds();
+
+        CDBBatch batch(db);
+        auto adaptor = BlockBatchAdaptor(batch);
+        saveTrees(adaptor);
+        if (!db.WriteBatch(batch, true)) {
+            error = "failed to write PoP trees to the block tree database";
+            return false;
+        }
+
+        ResetPopChainTips();
+
+        LogPrintf("Loaded PoP state snapshot at %s (height %d): %d BTC, %d VBK, %d ALT blocks\n",
+            metadata.m_base_blockhash.GetHex(), metadata.m_base_height,
+            btcblocks.size(), vbkblocks.size(), altblocks.size());
+    }
+
+    StopPopSnapshotValidation();
+    g_validation_interrupt = false;
+    g_validation_running = true;
+    g_validation_thread = std::thread(&TraceThread<std::function<void()>>, "popsnapshot", std::function<void()>(ThreadValidatePopSnapshot));
+
+    return true;
+}
+
+bool IsPopSnapshotValidationRunning()
+{
+    return g_validation_running;
+}
+
+void StopPopSnapshotValidation()
+{
+    g_validation_interrupt = true;
+    if (g_validation_thread.joinable()) {
+        g_validation_thread.join();
+    }
+}
+
+} // namespace VeriBlock
@@ -0,0 +1,105 @@
+// Copyright (c) 2019-2020 Xenios SEZC
+// https://www.veriblock.org
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef BITCOIN_SRC_VBK_POP_SNAPSHOT_HPP
+#define BITCOIN_SRC_VBK_POP_SNAPSHOT_HPP
+
+#include <serialize.h>
+#include <uint256.h>
+
+#include <string>
+
+class CAutoFile;
+class CBlockTreeDB;
+
+namespace VeriBlock {
+
+//! Magic bytes at the beginning of every PoP state snapshot file.
+static constexpr uint32_t POP_SNAPSHOT_MAGIC = 0x504f5053; // "POPS"
+static constexpr uint32_t POP_SNAPSHOT_VERSION = 1;
+
+//! Payloads are streamed in chunks of at most this many records.
+static constexpr uint32_t POP_SNAPSHOT_CHUNK_SIZE = 1000;
+
+//! Metadata describing a serialized version of the BTC/VBK/ALT block trees
+//! and the payloads they reference, from which the PoP state can be
+//! bootstrapped without replaying every ATV and VTB since genesis.
+//!
+//! Snapshot layout:
+//!   metadata
+//!   BTC tip hash, BTC block indexes
+//!   VBK tip hash, VBK block indexes
+//!   ALT tip hash, ALT block indexes
+//!   VBK block, VTB and ATV payloads, each as a sequence of chunks
+//!   terminated by an empty chunk
+//!   double-SHA256 checksum of everything above
+class PopSnapshotMetadata
+{
+public:
+    uint32_t m_magic = POP_SNAPSHOT_MAGIC;
+    uint32_t m_version = POP_SNAPSHOT_VERSION;
+
+    //! The hash of the ALT block which is the tip of the ALT tree stored in this snapshot.
+    uint256 m_base_blockhash;
+    int32_t m_base_height = 0;
+
+    uint64_t m_btc_blocks_count = 0;
+    uint64_t m_vbk_blocks_count = 0;
+    uint64_t m_alt_blocks_count = 0;
+
+    PopSnapshotMetadata() {}
+    PopSnapshotMetadata(
+        const uint256& base_blockhash,
+        int32_t base_height,
+        uint64_t btc_blocks_count,
+        uint64_t vbk_blocks_count,
+        uint64_t alt_blocks_count) : m_base_blockhash(base_blockhash),
+                                     m_base_height(base_height),
+                                     m_btc_blocks_count(btc_blocks_count),
+                                     m_vbk_blocks_count(vbk_blocks_count),
+                                     m_alt_blocks_count(alt_blocks_count) {}
+
+    ADD_SERIALIZE_METHODS;
+
+    template <typename Stream, typename Operation>
+    inline void SerializationOp(Stream& s, Operation ser_action)
+    {
+        READWRITE(m_magic);
+        READWRITE(m_version);
+        READWRITE(m_base_blockhash);
+        READWRITE(m_base_height);
+        READWRITE(m_btc_blocks_count);
+        READWRITE(m_vbk_blocks_count);
+        READWRITE(m_alt_blocks_count);
+    }
+};
+
+//! Number of payloads of each type written to or read from a snapshot.
+struct PopSnapshotStats {
+    uint64_t vbkblocks = 0;
+    uint64_t vtbs = 0;
+    uint64_t atvs = 0;
+};
+
+//! Write current PoP state to file. Returns false and sets error on failure.
+bool DumpPopState(CAutoFile& file, PopSnapshotMetadata& metadata, PopSnapshotStats& stats, std::string& error);
+
+//! Read PoP state from file, persist it in the block tree database and
+//! bootstrap the in-memory trees from it. Only allowed while PoP state
+//! has not advanced past the bootstrap block, which is checked before the
+//! file is read. Nothing is written unless the checksum matches and all
+//! three trees load. Once loaded, the payloads are statelessly re-validated
+//! in the background.
+bool LoadPopState(CAutoFile& file, CBlockTreeDB& db, PopSnapshotMetadata& metadata, PopSnapshotStats& stats, std::string& error);
+
+//! Returns true while background validation of a loaded snapshot is running.
+bool IsPopSnapshotValidationRunning();
+
+//! Interrupt and join the background snapshot validation thread.
+void StopPopSnapshotValidation();
+
+} // namespace VeriBlock
+
+#endif //BITCOIN_SRC_VBK_POP_SNAPSHOT_HPP
@@ -0,0 +1,99 @@
+// Copyright (c) 2019-2020 Xenios SEZC
+// https://www.veriblock.org
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <logging.h>
+
+#include <algorithm>
+#include <cassert>
+#include <atomic>
+
+#include "pop_stats.hpp"
+
+namespace VeriBlock {
+
+namespace {
+
+struct AtomicStageStats {
+    std::atomic<uint64_t> count{0};
+    std::atomic<int64_t> total_us{0};
+    std::atomic<int64_t> max_us{0};
+    std::array<std::atomic<uint64_t>, POP_STATS_BUCKETS_US.size() + 1> histogram{};
+};
+
+std::array<AtomicStageStats, (size_t)PopStage::COUNT> g_pop_stats;
+
+} // namespace
+
+std::string PopStageToString(PopStage stage)
+{
+    switch (stage) {
+    case PopStage::ACCEPT_BLOCK_HEADER:
+        return "acceptblockheader";
+    case PopStage::ADD_BLOCK_PAYLOADS:
+        return "addblockpayloads";
+    case PopStage::SET_STATE:
+        return "setstate";
+    case PopStage::CHECK_COINBASE_REWARDS:
+        return "checkcoinbaserewards";
+    case PopStage::COMPARE_FORKS:
+        return "compareforks";
+    case PopStage::MEMPOOL_SUBMIT:
+        return "mempoolsubmit";
+    case PopStage::P2P_PROCESS:
+        return "p2pprocess";
+    case PopStage::P2P_OFFER:
+        return "p2poffer";
+    case PopStage::COUNT:
+        break;
+    }
+    assert(false);
+}
+
+size_t GetPopStatsBucket(int64_t elapsed_us)
+{
+    auto it = std::lower_bound(POP_STATS_BUCKETS_US.begin(), POP_STATS_BUCKETS_US.end(), elapsed_us);
+    return it - POP_STATS_BUCKETS_US.begin();
+}
+
+void RecordPopStage(PopStage stage, int64_t elapsed_us)
+{
+    auto& stats = g_pop_stats[(size_t)stage];
+    uint64_t count = ++stats.count;
+    int64_t total = stats.total_us += elapsed_us;
+    int64_t max = stats.max_us.load();
+    while (elapsed_us > max && !stats.max_us.compare_exchange_weak(max, elapsed_us)) {
+    }
+    ++stats.histogram[GetPopStatsBucket(elapsed_us)];
+
+    LogPrint(BCLog::POP, "- %s: %.2fms [%.2fs (%.2fms/call)]\n", PopStageToString(stage),
+        0.001 * elapsed_us, 0.000001 * total, 0.001 * total / count);
+}
+
+PopStageStats GetPopStageStats(PopStage stage)
+{
+    const auto& stats = g_pop_stats[(size_t)stage];
+    PopStageStats out;
+    out.count = stats.count;
+    out.total_us = stats.total_us;
+    out.max_us = stats.max_us;
+    for (size_t i = 0; i < out.histogram.size(); ++i) {
+        out.histogram[i] = stats.histogram[i];
+    }
+    return out;
+}
+
+void ResetPopStats()
+{
+    for (auto& stats : g_pop_stats) {
+        stats.count = 0;
+        stats.total_us = 0;
+        stats.max_us = 0;
+        for (auto& bucket : stats.histogram) {
+            bucket = 0;
+        }
+    }
+}
+
+} // namespace VeriBlock
@@ -0,0 +1,73 @@
+// Copyright (c) 2019-2020 Xenios SEZC
+// https://www.veriblock.org
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef BITCOIN_SRC_VBK_POP_STATS_HPP
+#define BITCOIN_SRC_VBK_POP_STATS_HPP
+
+#include <util/time.h>
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+namespace VeriBlock {
+
+//! Stages of PoP processing in validation, PoP mempool and p2p relay
+enum class PopStage : size_t {
+    ACCEPT_BLOCK_HEADER = 0,
+    ADD_BLOCK_PAYLOADS,
+    SET_STATE,
+    CHECK_COINBASE_REWARDS,
+    COMPARE_FORKS,
+    MEMPOOL_SUBMIT,
+    P2P_PROCESS,
+    P2P_OFFER,
+
+    // must be last
+    COUNT
+};
+
+std::string PopStageToString(PopStage stage);
+
+//! Upper bounds (inclusive) of latency histogram buckets, in microseconds.
+//! Samples above the last bound go into an extra overflow bucket.
+static constexpr std::array<int64_t, 7> POP_STATS_BUCKETS_US = {10, 100, 1000, 10000, 100000, 1000000, 10000000};
+
+struct PopStageStats {
+    uint64_t count = 0;
+    int64_t total_us = 0;
+    int64_t max_us = 0;
+    std::array<uint64_t, POP_STATS_BUCKETS_US.size() + 1> histogram{};
+};
+
+//! Returns the histogram bucket for given latency
+size_t GetPopStatsBucket(int64_t elapsed_us);
+
+//! Add a sample to the cumulative counters of `stage`. With -debug=pop the sample is also logged.
+void RecordPopStage(PopStage stage, int64_t elapsed_us);
+
+PopStageStats GetPopStageStats(PopStage stage);
+
+void ResetPopStats();
+
+//! RAII-style object that records time spent in scope into the stats of a PoP stage.
+class PopStageTimer
+{
+public:
+    explicit PopStageTimer(PopStage stage) : m_stage(stage), m_start(GetTimeMicros()) {}
+
+    ~PopStageTimer()
+    {
+        RecordPopStage(m_stage, GetTimeMicros() - m_start);
+    }
+
+private:
+    const PopStage m_stage;
+    const int64_t m_start;
+};
+
+} // namespace VeriBlock
+
+#endif //BITCOIN_SRC_VBK_POP_STATS_HPP
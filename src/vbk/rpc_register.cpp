@@ -3,10 +3,14 @@
 // Distributed under the MIT software license, see the accompanying
 // file COPYING or http://www.opensource.org/licenses/mit-license.php.
 
+#include <blockreadahead.h>
 #include <chainparams.h>
 #include <consensus/merkle.h>
+#include <fs.h>
 #include <rpc/server.h>
 #include <rpc/util.h>
+#include <streams.h>
+#include <txdb.h>
 #include <util/validation.h>
 #include <validation.h>
 #include <vbk/entity/context_info_container.hpp>
@@ -20,7 +24,12 @@
 
 #include "rpc_register.hpp"
 #include <vbk/merkle.hpp>
+#include <vbk/pop_chaintips.hpp>
+#include <vbk/pop_mempool_limit.hpp>
+#include <vbk/pop_prefetch.hpp>
 #include <vbk/pop_service.hpp>
+#include <vbk/pop_snapshot.hpp>
+#include <vbk/pop_stats.hpp>
 #include <veriblock/mempool_result.hpp>
 
 namespace VeriBlock {
@@ -204,7 +213,11 @@ UniValue submitpop(const JSONRPCRequest& request)
         auto& pop_mempool = *VeriBlock::GetPop().mempool;
 
         // TODO: this will eventually be gone
-        altintegration::MempoolResult result = pop_mempool.submitAll(popData);
+        altintegration::MempoolResult result = [&]() {
+            VeriBlock::PopStageTimer timer(VeriBlock::PopStage::MEMPOOL_SUBMIT);
+            return pop_mempool.submitAll(popData);
+        }();
+        LimitPopMempool(popData);
         if (!result.context.empty()) {
             for (auto& it : result.context) {
                 logSubmitResult<altintegration::VbkBlock>(it.first.toHex(), it.second);
@@ -275,7 +288,11 @@ UniValue submitpopIt(const JSONRPCRequest& request)
     LOCK(cs_main);
     auto& mp = *VeriBlock::GetPop().mempool;
     auto idhex = data.getId().toHex();
-    mp.submit<Pop>(data, state);
+    {
+        VeriBlock::PopStageTimer timer(VeriBlock::PopStage::MEMPOOL_SUBMIT);
+        mp.submit<Pop>(data, state);
+    }
+    LimitPopMempool(data);
     logSubmitResult<Pop>(idhex, state);
     return altintegration::ToJSON<UniValue>(state);
 }
@@ -454,22 +471,76 @@ UniValue getbtcblockhash(const JSONRPCRequest& request)
 // getpoprawmempool
 namespace {
 
+//! Ids (or payloads if verbose) of a POP mempool page
+template <typename T>
+UniValue popMempoolPageToJSON(altintegration::MemPool& mp, const std::vector<typename T::id_t>& ids, bool verbose)
+{
+    UniValue out(UniValue::VARR);
+    for (const auto& id : ids) {
+        if (verbose) {
+            const auto* data = mp.get<T>(id);
+            assert(data);
+            out.push_back(altintegration::ToJSON<UniValue>(*data));
+        } else {
+            out.push_back(id.toHex());
+        }
+    }
+    return out;
+}
+
 UniValue getrawpopmempool(const JSONRPCRequest& request)
 {
     auto cmdname = "getrawpopmempool";
     RPCHelpMan{
         cmdname,
-        "\nReturns the list of VBK blocks, ATVs and VTBs stored in POP mempool.\n",
-        {},
-        RPCResult{"TODO"},
+        "\nReturns the VBK blocks, VTBs and ATVs stored in POP mempool, ordered by type and id.\n"
+        "At most 'count' entries are returned. If there are more, 'cursor' is set and can be\n"
+        "passed to the next call to continue after the last returned entry.\n",
+        {
+            {"verbose", RPCArg::Type::BOOL, /* default */ "false", "True to return payloads as json objects, false to return ids only"},
+            {"cursor", RPCArg::Type::STR, /* default */ "", "Continue after this \"<type>:<id>\" cursor, as returned by a previous call"},
+            {"count", RPCArg::Type::NUM, /* default */ strprintf("%d", VeriBlock::DEFAULT_POP_MEMPOOL_PAGE_SIZE), strprintf("Maximum number of entries to return (at most %d)", VeriBlock::MAX_POP_MEMPOOL_PAGE_SIZE)},
+        },
+        RPCResult{
+            "{\n"
+            "  \"vbkblocks\" : [ ... ],  (json array) ids (or objects if verbose) of VBK blocks\n"
+            "  \"vtbs\" : [ ... ],       (json array) ids (or objects if verbose) of VTBs\n"
+            "  \"atvs\" : [ ... ],       (json array) ids (or objects if verbose) of ATVs\n"
+            "  \"cursor\" : \"str\"        (string) cursor of the next page, null if there are no more entries\n"
+            "}\n"},
         RPCExamples{
             HelpExampleCli(cmdname, "") +
+            HelpExampleCli(cmdname, "false \"vtb:<id>\" 100") +
             HelpExampleRpc(cmdname, "")},
     }
         .Check(request);
 
-    auto& mp = *VeriBlock::GetPop().mempool;
-    return altintegration::ToJSON<UniValue>(mp);
+    bool verbose = !request.params[0].isNull() && request.params[0].get_bool();
+    std::string cursor = request.params[1].isNull() ? "" : request.params[1].get_str();
+
+    int count = VeriBlock::DEFAULT_POP_MEMPOOL_PAGE_SIZE;
+    if (!request.params[2].isNull()) {
+        count = request.params[2].get_int();
+        if (count <= 0 || count > VeriBlock::MAX_POP_MEMPOOL_PAGE_SIZE) {
+            throw JSONRPCError(RPC_INVALID_PARAMETER, strprintf("count must be between 1 and %d", VeriBlock::MAX_POP_MEMPOOL_PAGE_SIZE));
+        }
+    }
+
+    UniValue result(UniValue::VOBJ);
+    {
+        LOCK(cs_main);
+        VeriBlock::PopMempoolPage page;
+        std::string error;
+        if (!VeriBlock::getPopMempoolPage(cursor, count, page, error)) {
+            throw JSONRPCError(RPC_INVALID_PARAMETER, error);
+        }
+        auto& mp = *VeriBlock::GetPop().mempool;
+        result.pushKV("vbkblocks", popMempoolPageToJSON<altintegration::VbkBlock>(mp, page.vbkblocks, verbose));
+        result.pushKV("vtbs", popMempoolPageToJSON<altintegration::VTB>(mp, page.vtbs, verbose));
+        result.pushKV("atvs", popMempoolPageToJSON<altintegration::ATV>(mp, page.atvs, verbose));
+        result.pushKV("cursor", page.next.empty() ? UniValue(UniValue::VNULL) : UniValue(page.next));
+    }
+    return result;
 }
 
 } // namespace
@@ -712,49 +783,18 @@ void check_getchaintips(const JSONRPCRequest& request, std::string chain)
         .Check(request);
 }
 
-template <typename BlockTreeT>
-UniValue getchaintips(const JSONRPCRequest& req, const std::string& chainname, BlockTreeT& tree)
+UniValue getchaintips(const JSONRPCRequest& req, const std::string& chainname, const VeriBlock::PopChainTips& tips)
 {
     check_getchaintips(req, chainname);
-    LOCK(cs_main);
-    const auto& tips = tree.getTips();
-
-    using index_t = typename BlockTreeT::index_t;
 
     UniValue res(UniValue::VARR);
-    for (const index_t* block : tips) {
+    for (const auto& tip : tips) {
         UniValue obj(UniValue::VOBJ);
-        obj.pushKV("height", block->getHeight());
-        obj.pushKV("hash", block->getHash().toHex());
-        obj.pushKV("statusflags", (uint64_t)block->getStatus());
-
-        auto* forkBlock = tree.getBestChain().findFork(block);
-        assert(forkBlock && "should have found this fork! state corruption.");
-        const int branchLen = block->getHeight() - forkBlock->getHeight();
-        obj.pushKV("branchlen", branchLen);
-
-        std::string status;
-        if (tree.getBestChain().contains(block)) {
-            // This block is part of the currently active chain.
-            status = "active";
-        } else if (block->hasFlags(altintegration::BLOCK_FAILED_MASK)) {
-            // This block or one of its ancestors is invalid.
-            status = "invalid";
-        } else if (!block->isConnected()) {
-            // This block cannot be connected because full block data for it or one of its parents is missing.
-            status = "headers-only";
-        } else if (block->isValid(altintegration::BLOCK_CAN_BE_APPLIED)) {
-            // This block is fully validated, but no longer part of the active chain. It was probably the active block once, but was reorganized.
-            status = "valid-fork";
-        } else if (block->isConnected()) {
-            // The headers for this block are valid, but it has not been validated. It was probably never part of the best chain.
-            status = "valid-headers";
-        } else {
-            // No clue.
-            status = "unknown";
-        }
-        obj.pushKV("status", status);
-
+        obj.pushKV("height", tip->height);
+        obj.pushKV("hash", tip->hash);
+        obj.pushKV("statusflags", tip->statusflags);
+        obj.pushKV("branchlen", tip->branchlen);
+        obj.pushKV("status", tip->status);
         res.push_back(obj);
     }
 
@@ -763,12 +803,230 @@ UniValue getchaintips(const JSONRPCRequest& req, const std::string& chainname, B
 
 UniValue getbtcchaintips(const JSONRPCRequest& req)
 {
-    return getchaintips(req, "btc", btc());
+    return getchaintips(req, "btc", *VeriBlock::GetBtcChainTips());
 }
 
 UniValue getvbkchaintips(const JSONRPCRequest& req)
 {
-    return getchaintips(req, "vbk", vbk());
+    return getchaintips(req, "vbk", *VeriBlock::GetVbkChainTips());
+}
+
+} // namespace
+
+// dumppopstate
+// loadpopstate
+namespace {
+
+UniValue dumppopstate(const JSONRPCRequest& request)
+{
+    RPCHelpMan{
+        "dumppopstate",
+        "\nWrite the serialized BTC, VBK and ALT block trees and all known PoP payloads to disk.\n"
+        "The snapshot can be loaded on a fresh node with loadpopstate.\n",
+        {
+            {"path",
+                RPCArg::Type::STR,
+                RPCArg::Optional::NO,
+                /* default_val */ "",
+                "path to the output file. If relative, will be prefixed by datadir."},
+        },
+        RPCResult{
+            "{\n"
+            "  \"base_hash\": \"...\",   (string) the hash of the ALT tip of the snapshot\n"
+            "  \"base_height\": n,     (numeric) the height of the ALT tip of the snapshot\n"
+            "  \"btc_blocks\": n,      (numeric) the number of BTC blocks written\n"
+            "  \"vbk_blocks\": n,      (numeric) the number of VBK blocks written\n"
+            "  \"alt_blocks\": n,      (numeric) the number of ALT blocks written\n"
+            "  \"vbkblocks\": n,       (numeric) the number of VBK block payloads written\n"
+            "  \"vtbs\": n,            (numeric) the number of VTBs written\n"
+            "  \"atvs\": n,            (numeric) the number of ATVs written\n"
+            "  \"path\": \"...\"         (string) the absolute path that the snapshot was written to\n"
+            "}\n"},
+        RPCExamples{
+            HelpExampleCli("dumppopstate", "popstate.dat") + HelpExampleRpc("dumppopstate", "\"popstate.dat\"")},
+    }
+        .Check(request);
+
+    fs::path path = fs::absolute(request.params[0].get_str(), GetDataDir());
+    // Write to a temporary path and then move into `path` on completion
+    // to avoid confusion due to an interruption.
+    fs::path temppath = fs::absolute(request.params[0].get_str() + ".incomplete", GetDataDir());
+
+    if (fs::exists(path)) {
+        throw JSONRPCError(
+            RPC_INVALID_PARAMETER,
+            path.string() + " already exists. If you are sure this is what you want, "
+                            "move it out of the way first");
+    }
+
+    CAutoFile afile{fsbridge::fopen(temppath, "wb"), SER_DISK, CLIENT_VERSION};
+    if (afile.IsNull()) {
+        throw JSONRPCError(RPC_MISC_ERROR, "Unable to open " + temppath.string());
+    }
+
+    VeriBlock::PopSnapshotMetadata metadata;
+    VeriBlock::PopSnapshotStats stats;
+    std::string error;
+    if (!VeriBlock::DumpPopState(afile, metadata, stats, error)) {
+        afile.fclose();
+        fs::remove(temppath);
+        throw JSONRPCError(RPC_MISC_ERROR, error);
+    }
+
+    afile.fclose();
+    fs::rename(temppath, path);
+
+    UniValue result(UniValue::VOBJ);
+    result.pushKV("base_hash", metadata.m_base_blockhash.GetHex());
+    result.pushKV("base_height", metadata.m_base_height);
+    result.pushKV("btc_blocks", metadata.m_btc_blocks_count);
+    result.pushKV("vbk_blocks", metadata.m_vbk_blocks_count);
+    result.pushKV("alt_blocks", metadata.m_alt_blocks_count);
+    result.pushKV("vbkblocks", stats.vbkblocks);
+    result.pushKV("vtbs", stats.vtbs);
+    result.pushKV("atvs", stats.atvs);
+    result.pushKV("path", path.string());
+    return result;
+}
+
+UniValue loadpopstate(const JSONRPCRequest& request)
+{
+    RPCHelpMan{
+        "loadpopstate",
+        "\nBootstrap the BTC, VBK and ALT block trees from a snapshot written by dumppopstate.\n"
+        "Only allowed while PoP state has not advanced past the bootstrap block, and once\n"
+        "headers up to the snapshot base are known. Payloads are re-validated in the background.\n",
+        {
+            {"path",
+                RPCArg::Type::STR,
+                RPCArg::Optional::NO,
+                /* default_val */ "",
+                "path to the snapshot file. If relative, will be prefixed by datadir."},
+        },
+        RPCResult{
+            "{\n"
+            "  \"base_hash\": \"...\",   (string) the hash of the ALT tip of the snapshot\n"
+            "  \"base_height\": n,     (numeric) the height of the ALT tip of the snapshot\n"
+            "  \"btc_blocks\": n,      (numeric) the number of BTC blocks loaded\n"
+            "  \"vbk_blocks\": n,      (numeric) the number of VBK blocks loaded\n"
+            "  \"alt_blocks\": n,      (numeric) the number of ALT blocks loaded\n"
+            "  \"vbkblocks\": n,       (numeric) the number of VBK block payloads loaded\n"
+            "  \"vtbs\": n,            (numeric) the number of VTBs loaded\n"
+            "  \"atvs\": n             (numeric) the number of ATVs loaded\n"
+            "}\n"},
+        RPCExamples{
+            HelpExampleCli("loadpopstate", "popstate.dat") + HelpExampleRpc("loadpopstate", "\"popstate.dat\"")},
+    }
+        .Check(request);
+
+    fs::path path = fs::absolute(request.params[0].get_str(), GetDataDir());
+    CAutoFile afile{fsbridge::fopen(path, "rb"), SER_DISK, CLIENT_VERSION};
+    if (afile.IsNull()) {
+        throw JSONRPCError(RPC_INVALID_PARAMETER, "Unable to open " + path.string());
+    }
+
+    VeriBlock::PopSnapshotMetadata metadata;
+    VeriBlock::PopSnapshotStats stats;
+    std::string error;
+    if (!VeriBlock::LoadPopState(afile, *pblocktree, metadata, stats, error)) {
+        throw JSONRPCError(RPC_MISC_ERROR, error);
+    }
+
+    UniValue result(UniValue::VOBJ);
+    result.pushKV("base_hash", metadata.m_base_blockhash.GetHex());
+    result.pushKV("base_height", metadata.m_base_height);
+    result.pushKV("btc_blocks", metadata.m_btc_blocks_count);
+    result.pushKV("vbk_blocks", metadata.m_vbk_blocks_count);
+    result.pushKV("alt_blocks", metadata.m_alt_blocks_count);
+    result.pushKV("vbkblocks", stats.vbkblocks);
+    result.pushKV("vtbs", stats.vtbs);
+    result.pushKV("atvs", stats.atvs);
+    return result;
+}
+
+} // namespace
+
+// getpopstats
+namespace {
+
+UniValue getpopstats(const JSONRPCRequest& request)
+{
+    RPCHelpMan{
+        "getpopstats",
+        "\nReturns cumulative counters and latency histograms of PoP processing stages in validation, POP mempool and p2p relay.\n"
+        "Each sample is also logged when started with -debug=pop.\n",
+        {
+            {"reset", RPCArg::Type::BOOL, /* default */ "false", "Reset all counters after reading them"},
+        },
+        RPCResult{
+            "{\n"
+            "  \"stage\" : {             (json object) stage name\n"
+            "    \"count\" : n,          (numeric) number of samples\n"
+            "    \"total_ms\" : x.xxx,   (numeric) total time spent in the stage\n"
+            "    \"avg_ms\" : x.xxx,     (numeric) average time per sample\n"
+            "    \"max_ms\" : x.xxx,     (numeric) slowest sample\n"
+            "    \"histogram\" : {       (json object) number of samples per latency bucket\n"
+            "      \"le_10us\" : n,\n"
+            "      ...\n"
+            "      \"inf\" : n\n"
+            "    }\n"
+            "  },\n"
+            "  ...\n"
+            "  \"prefetch\" : {          (json object) PoP payload prefetching ahead of block connection\n"
+            "    \"depth\" : n,          (numeric) -blockreadahead depth the cache is filled from, 0 if disabled\n"
+            "    \"blocks\" : n,         (numeric) number of read-ahead blocks whose payloads were cached\n"
+            "    \"cached_blocks\" : n,  (numeric) number of blocks currently held in the prefetch cache\n"
+            "    \"hits\" : n,           (numeric) payload lookups served from the prefetch cache\n"
+            "    \"misses\" : n,         (numeric) payload lookups that read the payloads database\n"
+            "    \"hitrate\" : x.xxx     (numeric) hits / (hits + misses)\n"
+            "  }\n"
+            "}\n"},
+        RPCExamples{
+            HelpExampleCli("getpopstats", "") +
+            HelpExampleCli("getpopstats", "true") +
+            HelpExampleRpc("getpopstats", "")},
+    }
+        .Check(request);
+
+    static const std::array<std::string, POP_STATS_BUCKETS_US.size() + 1> bucketNames = {
+        "le_10us", "le_100us", "le_1ms", "le_10ms", "le_100ms", "le_1s", "le_10s", "inf"};
+
+    UniValue result(UniValue::VOBJ);
+    for (size_t i = 0; i < (size_t)PopStage::COUNT; ++i) {
+        auto stage = (PopStage)i;
+        auto stats = GetPopStageStats(stage);
+
+        UniValue histogram(UniValue::VOBJ);
+        for (size_t b = 0; b < stats.histogram.size(); ++b) {
+            histogram.pushKV(bucketNames[b], stats.histogram[b]);
+        }
+
+        UniValue obj(UniValue::VOBJ);
+        obj.pushKV("count", stats.count);
+        obj.pushKV("total_ms", 0.001 * stats.total_us);
+        obj.pushKV("avg_ms", stats.count == 0 ? 0.0 : 0.001 * stats.total_us / stats.count);
+        obj.pushKV("max_ms", 0.001 * stats.max_us);
+        obj.pushKV("histogram", histogram);
+        result.pushKV(PopStageToString(stage), obj);
+    }
+
+    auto prefetch = GetPopPrefetchStats();
+    UniValue prefetchObj(UniValue::VOBJ);
+    prefetchObj.pushKV("depth", GetBlockReadAheadDepth());
+    prefetchObj.pushKV("blocks", prefetch.blocks);
+    prefetchObj.pushKV("cached_blocks", (uint64_t)prefetch.cached_blocks);
+    prefetchObj.pushKV("hits", prefetch.hits);
+    prefetchObj.pushKV("misses", prefetch.misses);
+    const uint64_t lookups = prefetch.hits + prefetch.misses;
+    prefetchObj.pushKV("hitrate", lookups == 0 ? 0.0 : (double)prefetch.hits / lookups);
+    result.pushKV("prefetch", prefetchObj);
+
+    if (!request.params[0].isNull() && request.params[0].get_bool()) {
+        ResetPopStats();
+        ResetPopPrefetchStats();
+    }
+
+    return result;
 }
 
 } // namespace
@@ -790,7 +1048,10 @@ const CRPCCommand commands[] = {
     {"pop_mining", "getrawatv", &getrawatv, {"id"}},
     {"pop_mining", "getrawvtb", &getrawvtb, {"id"}},
     {"pop_mining", "getrawvbkblock", &getrawvbkblock, {"id"}},
-    {"pop_mining", "getrawpopmempool", &getrawpopmempool, {}}};
+    {"pop_mining", "getrawpopmempool", &getrawpopmempool, {"verbose", "cursor", "count"}},
+    {"pop_mining", "dumppopstate", &dumppopstate, {"path"}},
+    {"pop_mining", "loadpopstate", &loadpopstate, {"path"}},
+    {"pop_mining", "getpopstats", &getpopstats, {"reset"}}};
 
 void RegisterPOPMiningRPCCommands(CRPCTable& t)
 {
@@ -6,11 +6,13 @@
 #include <boost/test/unit_test.hpp>
 #include <chainparams.h>
 #include <consensus/validation.h>
+#include <pow.h>
 #include <test/util/setup_common.h>
 #include <validation.h>
 #include <vbk/pop_service.hpp>
 #include <vbk/test/util/consts.hpp>
 #include <vbk/test/util/e2e_fixture.hpp>
+#include <vbk/util.hpp>
 
 #include <string>
 
@@ -159,4 +161,38 @@ BOOST_FIXTURE_TEST_CASE(BlockPoPVersion_test, E2eFixture)
     auto block = CreateAndProcessBlock({}, ChainActive().Tip()->GetBlockHash(), cbKey);
 }
 
+BOOST_FIXTURE_TEST_CASE(ProcessNewBlockHeaders_adds_headers_to_alt_tree, E2eFixture)
+{
+    const auto& consensus = Params().GetConsensus();
+    const CBlockIndex* tip = ChainActive().Tip();
+
+    std::vector<CBlockHeader> headers(10);
+    uint256 prevHash = tip->GetBlockHash();
+    uint32_t nTime = tip->nTime;
+    for (auto& header : headers) {
+        header.nVersion = tip->nVersion;
+        header.hashPrevBlock = prevHash;
+        header.nTime = ++nTime;
+        header.nBits = tip->nBits;
+        while (!CheckProofOfWork(header.GetHash(), header.nBits, consensus)) {
+            ++header.nNonce;
+        }
+        prevHash = header.GetHash();
+    }
+
+    BlockValidationState state;
+    BOOST_CHECK(ProcessNewBlockHeaders(headers, state, Params()));
+
+    LOCK(cs_main);
+    for (const auto& header : headers) {
+        auto* index = LookupBlockIndex(header.GetHash());
+        BOOST_REQUIRE(index);
+        BOOST_CHECK(VeriBlock::blockToAltBlock(*index).hash == header.GetHash().asVector());
+
+        auto* altindex = pop->altTree->getBlockIndex(header.GetHash().asVector());
+        BOOST_REQUIRE(altindex);
+        BOOST_CHECK_EQUAL(altindex->getHeight(), index->nHeight);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
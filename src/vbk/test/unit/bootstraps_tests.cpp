@@ -0,0 +1,51 @@
+// Copyright (c) 2019-2020 Xenios SEZC
+// https://www.veriblock.org
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <boost/test/unit_test.hpp>
+
+#include <bootstraps.h>
+#include <bootstrapsblocks.h>
+#include <test/util/setup_common.h>
+#include <util/strencodings.h>
+
+BOOST_FIXTURE_TEST_SUITE(bootstraps_tests, BasicTestingSetup)
+
+template <size_t HeaderSize, typename Block, size_t N>
+static void checkDecodedBlocks(const std::vector<Block>& blocks, const unsigned char (&raw)[N])
+{
+    BOOST_REQUIRE_EQUAL(blocks.size(), N / HeaderSize);
+    for (size_t i = 0; i < blocks.size(); ++i) {
+        std::vector<uint8_t> expected(raw + i * HeaderSize, raw + (i + 1) * HeaderSize);
+        BOOST_CHECK(blocks[i].toRaw() == expected);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(testnet_btc_blocks_match)
+{
+    const auto& blocks = testnetBTCblocks();
+    checkDecodedBlocks<BTC_BOOTSTRAP_HEADER_SIZE>(blocks, testnetBTCblocksRaw);
+
+    // first and last lines of contrib/bootstraps/testnet_btc.txt
+    BOOST_CHECK_EQUAL(HexStr(blocks.front().toRaw()), "00000020a95b9bc374c5a20ca7f238a16714c0dc9aa656e59d1d77333a00000000000000076a611abde3ecd82428b3eac4445eda3306fe4e52d12ed4f0aa48e9ca5cd524857ad65f51d9461944ee2da8");
+    BOOST_CHECK_EQUAL(HexStr(blocks.back().toRaw()), "00e0ff3f6b6eaaa9e38bc0ccafb1f171a27de268546613d8af347cb10a00000000000000dae11c4e9566912e2dda5e9090aee17fc66aafc4523cce02ff0c72453e1caac32ce7e15f57e53019eaf088b6");
+}
+
+BOOST_AUTO_TEST_CASE(testnet_vbk_blocks_match)
+{
+    const auto& blocks = testnetVBKblocks();
+    checkDecodedBlocks<VBK_BOOTSTRAP_HEADER_SIZE>(blocks, testnetVBKblocksRaw);
+
+    // first and last lines of contrib/bootstraps/testnet_vbk.txt
+    BOOST_CHECK_EQUAL(HexStr(blocks.front().toRaw()), "00114a390002d35cc8d2af793ffa03d142788e46c2e8a85a663690ea99759301000002a4f2f3547be0f9567a19ee22b99e0d8abe5fe0f85b04211e74aaab428281");
+    BOOST_CHECK_EQUAL(HexStr(blocks.back().toRaw()), "0011521800024235502d0ca44bd3d9ddead0930208ea3bb351afecb07af642799a8352cdb8267a90a54c508dda20d4831a334af85fe1e69e041ed229555b289f84");
+}
+
+BOOST_AUTO_TEST_CASE(testnet_blocks_are_decoded_once)
+{
+    BOOST_CHECK(&testnetBTCblocks() == &testnetBTCblocks());
+    BOOST_CHECK(&testnetVBKblocks() == &testnetVBKblocks());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,120 @@
+// Copyright (c) 2019-2020 Xenios SEZC
+// https://www.veriblock.org
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <boost/test/unit_test.hpp>
+
+#include <validation.h>
+#include <vbk/pop_chaintips.hpp>
+#include <vbk/test/util/e2e_fixture.hpp>
+
+#include <map>
+
+using BtcIndex = altintegration::BlockIndex<BtcBlock>;
+
+//! Tips of `tips` by hash
+static std::map<std::string, std::shared_ptr<const VeriBlock::PopChainTip>> tipsByHash(const VeriBlock::PopChainTips& tips)
+{
+    std::map<std::string, std::shared_ptr<const VeriBlock::PopChainTip>> byHash;
+    for (const auto& tip : tips) {
+        byHash[tip->hash] = tip;
+    }
+    return byHash;
+}
+
+template <typename Tree>
+static void checkChainTips(Tree& tree, const VeriBlock::PopChainTips& tips)
+{
+    const auto& best = tree.getBestChain();
+    BOOST_CHECK_EQUAL(tips.size(), tree.getTips().size());
+
+    auto byHash = tipsByHash(tips);
+    for (const auto* block : tree.getTips()) {
+        auto it = byHash.find(block->getHash().toHex());
+        BOOST_REQUIRE(it != byHash.end());
+        auto* fork = best.findFork(block);
+        BOOST_REQUIRE(fork);
+        BOOST_CHECK_EQUAL(it->second->height, block->getHeight());
+        BOOST_CHECK_EQUAL(it->second->branchlen, block->getHeight() - fork->getHeight());
+        BOOST_CHECK_EQUAL(it->second->status == "active", best.contains(block));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(pop_chaintips_tests)
+
+BOOST_FIXTURE_TEST_CASE(ChainTipsFollowTrees, E2eFixture)
+{
+    for (int i = 0; i < 3; ++i) {
+        auto* tip = ChainActive().Tip();
+        endorseAltBlockAndMine(tip->GetBlockHash(), 1);
+
+        // connecting the block changes the trees several times, the views are rebuilt once when read
+        const auto before = VeriBlock::GetPopChainTipsStats();
+        LOCK(cs_main);
+        checkChainTips(pop->altTree->vbk(), *VeriBlock::GetVbkChainTips());
+        checkChainTips(pop->altTree->btc(), *VeriBlock::GetBtcChainTips());
+        BOOST_CHECK_EQUAL(VeriBlock::GetPopChainTipsStats().rebuilds, before.rebuilds + 1);
+    }
+
+    // without tree changes the views are not rebuilt
+    const auto before = VeriBlock::GetPopChainTipsStats();
+    auto vbkTips = VeriBlock::GetVbkChainTips();
+    BOOST_CHECK(!VeriBlock::UpdatePopChainTips());
+    BOOST_CHECK(VeriBlock::GetVbkChainTips() == vbkTips);
+    BOOST_CHECK_EQUAL(VeriBlock::GetPopChainTipsStats().rebuilds, before.rebuilds);
+}
+
+BOOST_FIXTURE_TEST_CASE(StaleForkReusesCachedForkPoint, E2eFixture)
+{
+    endorseAltBlockAndMine(ChainActive().Tip()->GetBlockHash(), 1);
+    const BtcIndex* forkPoint = popminer.btc().getBestChain().tip();
+
+    // a stale fork of 2 blocks next to a best chain of 3 blocks
+    const BtcIndex* staleTip = popminer.mineBtcBlocks(*forkPoint, 2);
+    const BtcIndex* bestTip = popminer.mineBtcBlocks(*forkPoint, 3);
+    const std::string staleHash = staleTip->getHash().toHex();
+    auto acceptChain = [&](const BtcIndex* tip) EXCLUSIVE_LOCKS_REQUIRED(cs_main) {
+        std::vector<BtcBlock> headers;
+        for (const auto* b = tip; b != forkPoint; b = b->pprev) {
+            headers.insert(headers.begin(), b->getHeader());
+        }
+        for (const auto& header : headers) {
+            BOOST_REQUIRE(pop->altTree->btc().acceptBlockHeader(header, state));
+        }
+    };
+    {
+        LOCK(cs_main);
+        acceptChain(staleTip);
+        acceptChain(bestTip);
+        VeriBlock::MarkPopChainTipsDirty();
+    }
+
+    auto tips = VeriBlock::GetBtcChainTips();
+    auto stale = tipsByHash(*tips).at(staleHash);
+    BOOST_CHECK_EQUAL(stale->branchlen, 2);
+    BOOST_CHECK(stale->status != "active");
+    {
+        LOCK(cs_main);
+        checkChainTips(pop->altTree->btc(), *tips);
+    }
+
+    // extending the best chain needs a fork lookup for the new tip only, the stale tip entry is reused as is
+    const BtcIndex* next = popminer.mineBtcBlocks(*bestTip, 1);
+    const auto before = VeriBlock::GetPopChainTipsStats();
+    {
+        LOCK(cs_main);
+        BOOST_REQUIRE(pop->altTree->btc().acceptBlockHeader(next->getHeader(), state));
+        VeriBlock::MarkPopChainTipsDirty();
+    }
+    tips = VeriBlock::GetBtcChainTips();
+    const auto after = VeriBlock::GetPopChainTipsStats();
+    BOOST_CHECK_EQUAL(after.rebuilds, before.rebuilds + 1);
+    BOOST_CHECK_EQUAL(after.fork_lookups, before.fork_lookups + 1);
+    BOOST_CHECK(tipsByHash(*tips).at(staleHash) == stale);
+
+    LOCK(cs_main);
+    checkChainTips(pop->altTree->btc(), *tips);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
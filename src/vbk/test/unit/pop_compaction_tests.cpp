@@ -0,0 +1,122 @@
+// Copyright (c) 2019-2020 Xenios SEZC
+// https://www.veriblock.org
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <boost/test/unit_test.hpp>
+
+#include <txdb.h>
+#include <util/time.h>
+#include <validation.h>
+#include <vbk/adaptors/block_batch_adaptor.hpp>
+#include <vbk/pop_compaction.hpp>
+#include <vbk/test/util/e2e_fixture.hpp>
+
+using BtcIndex = altintegration::BlockIndex<BtcBlock>;
+
+//! Headers of `tip` and its ancestors above `from`, lowest first
+static std::vector<BtcBlock> btcHeaders(const BtcIndex* tip, const BtcIndex* from)
+{
+    std::vector<BtcBlock> headers;
+    for (const auto* b = tip; b != from; b = b->pprev) {
+        headers.insert(headers.begin(), b->getHeader());
+    }
+    return headers;
+}
+
+static bool hasBtcBlockRow(const BtcBlock& block)
+{
+    return pblocktree->Exists(std::make_pair(VeriBlock::DB_BTC_BLOCK, block.getHash()));
+}
+
+BOOST_AUTO_TEST_SUITE(pop_compaction_tests)
+
+BOOST_FIXTURE_TEST_CASE(ActiveChainIsNotPruned, E2eFixture)
+{
+    for (int i = 0; i < 3; ++i) {
+        auto* tip = ChainActive().Tip();
+        endorseAltBlockAndMine(tip->GetBlockHash(), 1);
+    }
+
+    size_t vbkBlocks, btcBlocks;
+    {
+        LOCK(cs_main);
+        vbkBlocks = pop->altTree->vbk().getBlocks().size();
+        btcBlocks = pop->altTree->btc().getBlocks().size();
+    }
+
+    // even with zero depth, blocks of the best chains are kept
+    auto stats = VeriBlock::CompactPopTrees(0, 0);
+    BOOST_CHECK_EQUAL(stats.vbk_blocks, 0);
+    BOOST_CHECK_EQUAL(stats.btc_blocks, 0);
+
+    LOCK(cs_main);
+    BOOST_CHECK_EQUAL(pop->altTree->vbk().getBlocks().size(), vbkBlocks);
+    BOOST_CHECK_EQUAL(pop->altTree->btc().getBlocks().size(), btcBlocks);
+}
+
+BOOST_FIXTURE_TEST_CASE(StaleBtcForkIsPrunedUnlessReferenced, E2eFixture)
+{
+    // compaction does nothing during initial block download
+    SetMockTime(ChainActive().Tip()->GetBlockTime());
+    BOOST_REQUIRE(!ChainstateActive().IsInitialBlockDownload());
+
+    const BtcIndex* forkPoint = popminer.btc().getBestChain().tip();
+
+    // a VTB whose block of proof is the only block of one fork
+    endorseAltBlockAndMine(ChainActive().Tip()->GetBlockHash(), 1);
+    std::vector<BtcBlock> referenced;
+    {
+        LOCK(cs_main);
+        const auto* blockOfProof = pop->altTree->btc().getBestChain().tip();
+        BOOST_REQUIRE(blockOfProof->pprev->getHash() == forkPoint->getHash());
+        referenced.push_back(blockOfProof->getHeader());
+    }
+
+    // a second fork nothing refers to, and a longer best chain
+    auto stale = btcHeaders(popminer.mineBtcBlocks(*forkPoint, 2), forkPoint);
+    auto best = btcHeaders(popminer.mineBtcBlocks(*forkPoint, 4), forkPoint);
+    {
+        LOCK(cs_main);
+        auto& btc = pop->altTree->btc();
+        for (const auto* headers : {&stale, &best}) {
+            for (const auto& header : *headers) {
+                BOOST_REQUIRE(btc.acceptBlockHeader(header, state));
+            }
+        }
+        BOOST_REQUIRE(btc.getBestChain().tip()->getHash() == best.back().getHash());
+    }
+    ChainstateActive().ForceFlushStateToDisk();
+    BOOST_CHECK(hasBtcBlockRow(stale.front()));
+
+    // both forks are 4 blocks deep
+    auto stats = VeriBlock::CompactPopTrees(VeriBlock::GetPopCompactionVbkDepth(), 4);
+    BOOST_CHECK_EQUAL(stats.btc_blocks, 0);
+    BOOST_CHECK(!stats.read_vtbs);
+
+    stats = VeriBlock::CompactPopTrees(VeriBlock::GetPopCompactionVbkDepth(), 3);
+    BOOST_CHECK_EQUAL(stats.btc_blocks, stale.size());
+    BOOST_CHECK(stats.read_vtbs);
+
+    // the referenced fork is remembered, the next run does not read the stored VTBs again
+    stats = VeriBlock::CompactPopTrees(VeriBlock::GetPopCompactionVbkDepth(), 3);
+    BOOST_CHECK_EQUAL(stats.btc_blocks, 0);
+    BOOST_CHECK(!stats.read_vtbs);
+    {
+        LOCK(cs_main);
+        auto& btc = pop->altTree->btc();
+        for (const auto& header : stale) {
+            BOOST_CHECK(btc.getBlockIndex(header.getHash()) == nullptr);
+            BOOST_CHECK(!hasBtcBlockRow(header));
+        }
+        BOOST_CHECK(btc.getBlockIndex(referenced.front().getHash()) != nullptr);
+        BOOST_CHECK(hasBtcBlockRow(referenced.front()));
+        for (const auto& header : best) {
+            BOOST_CHECK(btc.getBlockIndex(header.getHash()) != nullptr);
+        }
+    }
+
+    SetMockTime(0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
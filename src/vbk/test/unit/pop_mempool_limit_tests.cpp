@@ -0,0 +1,143 @@
+// Copyright (c) 2019-2020 Xenios SEZC
+// https://www.veriblock.org
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+
+#include <util/time.h>
+#include <validation.h>
+#include <vbk/pop_mempool_limit.hpp>
+#include <vbk/pop_service.hpp>
+#include <vbk/test/util/e2e_fixture.hpp>
+
+BOOST_AUTO_TEST_SUITE(pop_mempool_limit_tests)
+
+BOOST_FIXTURE_TEST_CASE(TrimEvictsDownToTarget, E2eFixture)
+{
+    std::vector<altintegration::VTB> vtbs;
+    for (int i = 0; i < 10; ++i) {
+        vtbs.push_back(endorseVbkTip());
+    }
+
+    LOCK(cs_main);
+    auto& mp = *pop->mempool;
+    for (const auto& vtb : vtbs) {
+        altintegration::ValidationState state;
+        mp.submit(vtb.containingBlock, state);
+        mp.submit(vtb, state);
+    }
+
+    auto before = VeriBlock::GetPopMempoolUsage();
+    BOOST_REQUIRE_GT(before.vtbs, 0);
+    BOOST_CHECK_GT(before.usage, 0);
+
+    // within the limit nothing is evicted
+    auto same = VeriBlock::TrimPopMempool(before.usage);
+    BOOST_CHECK_EQUAL(same.usage, before.usage);
+    BOOST_CHECK_EQUAL(same.vtbs, before.vtbs);
+
+    const size_t limit = before.usage / 2;
+    auto after = VeriBlock::TrimPopMempool(limit);
+    BOOST_CHECK_LE(after.usage, limit);
+    BOOST_CHECK_LT(after.vtbs + after.vbkblocks, before.vtbs + before.vbkblocks);
+    BOOST_CHECK_EQUAL(after.usage, VeriBlock::GetPopMempoolUsage().usage);
+}
+
+BOOST_FIXTURE_TEST_CASE(TrimEvictsEarliestSubmittedFirst, E2eFixture)
+{
+    std::vector<altintegration::VTB> vtbs;
+    for (int i = 0; i < 4; ++i) {
+        vtbs.push_back(endorseVbkTip());
+    }
+
+    LOCK(cs_main);
+    auto& mp = *pop->mempool;
+    const int64_t now = GetTime();
+    int64_t time = now;
+    for (const auto& vtb : vtbs) {
+        SetMockTime(++time);
+        altintegration::ValidationState state;
+        mp.submit(vtb.containingBlock, state);
+        VeriBlock::LimitPopMempool(vtb.containingBlock);
+        SetMockTime(++time);
+        mp.submit(vtb, state);
+        VeriBlock::LimitPopMempool(vtb);
+    }
+
+    // reading the usage later does not change the submission times
+    SetMockTime(now + 1000);
+    auto before = VeriBlock::GetPopMempoolUsage();
+    BOOST_REQUIRE_EQUAL(before.vtbs, vtbs.size());
+    BOOST_REQUIRE_EQUAL(before.vbkblocks, vtbs.size());
+
+    // expected eviction order: in-flight first, then by submission time
+    struct Submitted {
+        bool inflight;
+        int64_t time;
+        bool isVtb;
+        size_t index;
+    };
+    std::vector<Submitted> order;
+    for (size_t i = 0; i < vtbs.size(); ++i) {
+        bool blockInflight = mp.getInFlightMap<altintegration::VbkBlock>().count(vtbs[i].containingBlock.getId()) > 0;
+        bool vtbInflight = mp.getInFlightMap<altintegration::VTB>().count(vtbs[i].getId()) > 0;
+        order.push_back({blockInflight, now + 1 + 2 * (int64_t)i, false, i});
+        order.push_back({vtbInflight, now + 2 + 2 * (int64_t)i, true, i});
+    }
+    std::sort(order.begin(), order.end(), [](const Submitted& a, const Submitted& b) {
+        if (a.inflight != b.inflight) {
+            return a.inflight;
+        }
+        return a.time < b.time;
+    });
+    auto inMempool = [&](const Submitted& s) {
+        if (s.isVtb) {
+            const auto id = vtbs[s.index].getId();
+            return mp.getMap<altintegration::VTB>().count(id) + mp.getInFlightMap<altintegration::VTB>().count(id) > 0;
+        }
+        const auto id = vtbs[s.index].containingBlock.getId();
+        return mp.getMap<altintegration::VbkBlock>().count(id) + mp.getInFlightMap<altintegration::VbkBlock>().count(id) > 0;
+    };
+
+    // just above the limit, only the first payloads in eviction order go
+    auto after = VeriBlock::TrimPopMempool(before.usage - 1);
+    BOOST_CHECK_LT(after.usage, before.usage);
+    BOOST_CHECK(!inMempool(order.front()));
+    BOOST_CHECK(inMempool(order.back()));
+
+    SetMockTime(0);
+}
+
+BOOST_FIXTURE_TEST_CASE(UsageFollowsRemovedPayloads, E2eFixture)
+{
+    auto vtb = endorseVbkTip();
+
+    LOCK(cs_main);
+    auto& mp = *pop->mempool;
+    altintegration::PopData popData;
+    popData.context.push_back(vtb.containingBlock);
+    popData.vtbs.push_back(vtb);
+    mp.submitAll(popData);
+    VeriBlock::LimitPopMempool(popData);
+
+    auto before = VeriBlock::GetPopMempoolUsage();
+    BOOST_CHECK_EQUAL(before.vtbs, 1);
+    BOOST_CHECK_EQUAL(before.usage, VeriBlock::PopMempoolEntryUsage(vtb) + VeriBlock::PopMempoolEntryUsage(vtb.containingBlock));
+
+    VeriBlock::removePayloadsFromMempool(popData);
+    auto after = VeriBlock::GetPopMempoolUsage();
+    BOOST_CHECK_EQUAL(after.vtbs, 0);
+    BOOST_CHECK_EQUAL(after.vbkblocks, 0);
+    BOOST_CHECK_EQUAL(after.usage, 0);
+}
+
+BOOST_FIXTURE_TEST_CASE(EntryUsageGrowsWithPayloadSize, E2eFixture)
+{
+    auto vtb = endorseVbkTip();
+    BOOST_CHECK_GT(VeriBlock::PopMempoolEntryUsage(vtb), VeriBlock::PopMempoolEntryUsage(vtb.containingBlock));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,75 @@
+// Copyright (c) 2019-2020 Xenios SEZC
+// https://www.veriblock.org
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <boost/test/unit_test.hpp>
+
+#include <blockreadahead.h>
+#include <chainparams.h>
+#include <util/time.h>
+#include <validation.h>
+#include <vbk/pop_prefetch.hpp>
+#include <vbk/test/util/e2e_fixture.hpp>
+
+BOOST_AUTO_TEST_SUITE(pop_prefetch_tests)
+
+BOOST_FIXTURE_TEST_CASE(PayloadsOfBlocksAheadArePrefetched, E2eFixture)
+{
+    CBlockIndex* fork = ChainActive().Tip();
+    for (int i = 0; i < 3; ++i) {
+        auto* tip = ChainActive().Tip();
+        endorseAltBlockAndMine(tip->GetBlockHash(), 1);
+    }
+    CBlockIndex* tip = ChainActive().Tip();
+
+    CBlock next;
+    BOOST_REQUIRE(ReadBlockFromDisk(next, ChainActive()[fork->nHeight + 1], Params().GetConsensus()));
+    BOOST_REQUIRE(!next.popData.atvs.empty());
+    const auto atvid = next.popData.atvs[0].getId();
+
+    // without read-ahead lookups are not counted
+    VeriBlock::ResetPopPrefetchStats();
+    ResetBlockReadAheadStats();
+    altintegration::ATV atv;
+    BOOST_CHECK(!VeriBlock::GetPrefetchedPayload(atvid, atv));
+    BOOST_CHECK_EQUAL(VeriBlock::GetPopPrefetchStats().misses, 0);
+
+    // the payloads are cached from the blocks the read-ahead thread reads
+    StartBlockReadAhead(8);
+    {
+        LOCK(cs_main);
+        ScheduleBlockReadAhead(fork, tip);
+    }
+
+    for (int i = 0; i < 100 && VeriBlock::GetPopPrefetchStats().cached_blocks < 3; ++i) {
+        MilliSleep(50);
+    }
+    BOOST_CHECK_EQUAL(VeriBlock::GetPopPrefetchStats().cached_blocks, 3);
+    BOOST_CHECK_EQUAL(VeriBlock::GetPopPrefetchStats().blocks, 3);
+    BOOST_CHECK(VeriBlock::GetPrefetchedPayload(atvid, atv));
+    BOOST_CHECK(atv.getId() == atvid);
+
+    // taking the block for ConnectTip does not read it again and keeps its payloads
+    BOOST_CHECK(TakeReadAheadBlock(ChainActive()[fork->nHeight + 1]) != nullptr);
+    BOOST_CHECK_EQUAL(GetBlockReadAheadStats().blocks, 3);
+    BOOST_CHECK(VeriBlock::GetPrefetchedPayload(atvid, atv));
+
+    // blocks at or below the new fork point are dropped
+    {
+        LOCK(cs_main);
+        ScheduleBlockReadAhead(tip, tip);
+    }
+    BOOST_CHECK_EQUAL(VeriBlock::GetPopPrefetchStats().cached_blocks, 0);
+    BOOST_CHECK(!VeriBlock::GetPrefetchedPayload(atvid, atv));
+
+    auto stats = VeriBlock::GetPopPrefetchStats();
+    BOOST_CHECK_EQUAL(stats.hits, 2);
+    BOOST_CHECK_EQUAL(stats.misses, 1);
+
+    StopBlockReadAhead();
+    ResetBlockReadAheadStats();
+    VeriBlock::ResetPopPrefetchStats();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
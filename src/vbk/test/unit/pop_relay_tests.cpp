@@ -0,0 +1,87 @@
+// Copyright (c) 2019-2020 Xenios SEZC
+// https://www.veriblock.org
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <boost/test/unit_test.hpp>
+
+#include <net.h>
+#include <netmessagemaker.h>
+#include <test/util/setup_common.h>
+#include <vbk/p2p_sync.hpp>
+
+using VeriBlock::p2p::PopRelayBudget;
+
+struct PopRelayFixture : public BasicTestingSetup {
+    ~PopRelayFixture()
+    {
+        VeriBlock::p2p::SetPopRelayBandwidth(VeriBlock::p2p::DEFAULT_POP_RELAY_BANDWIDTH * 1000);
+    }
+};
+
+BOOST_FIXTURE_TEST_SUITE(pop_relay_tests, PopRelayFixture)
+
+BOOST_AUTO_TEST_CASE(budget_refills_at_configured_rate)
+{
+    VeriBlock::p2p::SetPopRelayBandwidth(1000);
+    PopRelayBudget budget;
+    const int64_t start = 1000000;
+
+    // starts full, the last message may overdraw it
+    BOOST_CHECK(budget.consume(600, start));
+    BOOST_CHECK(budget.consume(600, start));
+    BOOST_CHECK(!budget.consume(1, start));
+
+    // 200 bytes owed, 0.1s refills 100
+    BOOST_CHECK(!budget.consume(1, start + 100000));
+    BOOST_CHECK(budget.consume(1, start + 300000));
+
+    // never holds more than one second worth of tokens
+    BOOST_CHECK(budget.consume(1000, start + 100000000));
+    BOOST_CHECK(!budget.consume(1, start + 100000000));
+}
+
+BOOST_AUTO_TEST_CASE(budget_unlimited_when_disabled)
+{
+    VeriBlock::p2p::SetPopRelayBandwidth(0);
+    PopRelayBudget budget;
+    for (int i = 0; i < 100; ++i) {
+        BOOST_CHECK(budget.consume(1000000, 0));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(low_priority_messages_queue_behind_regular_messages)
+{
+    CConnman connman(0x1337, 0x1337);
+    CAddress addr(CService(), NODE_NONE);
+    CNode node(0, NODE_NETWORK, 0, INVALID_SOCKET, addr, 0, 0, CAddress(), "", /*fInboundIn=*/false);
+    const CNetMsgMaker msgMaker(PROTOCOL_VERSION);
+    const uint64_t nonce = 1;
+
+    // nothing queued, a low priority message goes straight to the send queue
+    connman.PushMessage(&node, msgMaker.Make(NetMsgType::PING, nonce), true);
+    {
+        LOCK(node.cs_vSend);
+        BOOST_CHECK_EQUAL(node.vSendMsg.size(), 2U);
+        BOOST_CHECK(node.vSendMsgLowPriority.empty());
+    }
+
+    // the socket is not writable, so the next low priority message waits
+    connman.PushMessage(&node, msgMaker.Make(NetMsgType::PING, nonce), true);
+    connman.PushMessage(&node, msgMaker.Make(NetMsgType::PONG, nonce));
+    {
+        LOCK(node.cs_vSend);
+        BOOST_CHECK_EQUAL(node.vSendMsg.size(), 4U);
+        BOOST_REQUIRE_EQUAL(node.vSendMsgLowPriority.size(), 1U);
+
+        size_t queued = 0;
+        for (const auto& data : node.vSendMsg) {
+            queued += data.size();
+        }
+        queued += node.vSendMsgLowPriority.front().size();
+        BOOST_CHECK_EQUAL(node.nSendSize, queued);
+        BOOST_CHECK_EQUAL(node.vSendMsgLowPriority.front().size(), CMessageHeader::HEADER_SIZE + sizeof(nonce));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
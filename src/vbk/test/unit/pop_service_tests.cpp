@@ -11,6 +11,7 @@
 #include <test/util/setup_common.h>
 #include <validation.h>
 #include <vbk/pop_service.hpp>
+#include <vbk/test/util/e2e_fixture.hpp>
 
 using ::testing::Return;
 
@@ -181,4 +182,20 @@ BOOST_FIXTURE_TEST_CASE(blockPopValidation_test_wrong_addPayloads, PopServiceFix
     //
     //    testing::Mock::VerifyAndClearExpectations(&pop_service_impl_mock);
 }
+BOOST_FIXTURE_TEST_CASE(PopTreesMemoryUsageCountsPayloadIds, E2eFixture)
+{
+    const auto before = WITH_LOCK(cs_main, return VeriBlock::getPopTreesMemoryUsage());
+    endorseAltBlockAndMine(ChainActive().Tip()->GetBlockHash(), 1);
+
+    LOCK(cs_main);
+    const auto after = VeriBlock::getPopTreesMemoryUsage();
+    BOOST_CHECK_GT(after.payloads.ids, before.payloads.ids);
+    BOOST_CHECK_GT(after.payloads.usage, before.payloads.usage);
+    BOOST_CHECK_EQUAL(after.total(), after.alt.usage + after.vbk.usage + after.btc.usage + after.payloads.usage);
+
+    // the running count matches the ids held by the ALT tree
+    VeriBlock::recountPopPayloadIds();
+    BOOST_CHECK_EQUAL(VeriBlock::getPopTreesMemoryUsage().payloads.ids, after.payloads.ids);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,219 @@
+// Copyright (c) 2019-2020 Xenios SEZC
+// https://www.veriblock.org
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <boost/test/unit_test.hpp>
+
+#include <chain.h>
+#include <dbwrapper.h>
+#include <fs.h>
+#include <hash.h>
+#include <streams.h>
+#include <txdb.h>
+#include <validation.h>
+#include <vbk/adaptors/payloads_provider.hpp>
+#include <vbk/pop_service.hpp>
+#include <vbk/pop_snapshot.hpp>
+#include <vbk/test/util/e2e_fixture.hpp>
+
+#include <fstream>
+#include <iterator>
+#include <limits>
+
+BOOST_AUTO_TEST_SUITE(pop_snapshot_tests)
+
+BOOST_FIXTURE_TEST_CASE(DumpAndVerifySnapshot, E2eFixture)
+{
+    for (int i = 0; i < 3; ++i) {
+        auto* tip = ChainActive().Tip();
+        CBlock block = endorseAltBlockAndMine(tip->GetBlockHash(), 1);
+        BOOST_REQUIRE(ChainActive().Tip()->GetBlockHash() == block.GetHash());
+    }
+
+    fs::path path = GetDataDir() / "popstate.dat";
+    VeriBlock::PopSnapshotMetadata metadata;
+    VeriBlock::PopSnapshotStats stats;
+    std::string error;
+    {
+        CAutoFile file(fsbridge::fopen(path, "wb"), SER_DISK, CLIENT_VERSION);
+        BOOST_REQUIRE(VeriBlock::DumpPopState(file, metadata, stats, error));
+    }
+
+    BOOST_CHECK(metadata.m_base_blockhash == ChainActive().Tip()->GetBlockHash());
+    BOOST_CHECK_EQUAL(metadata.m_base_height, ChainActive().Height());
+    BOOST_CHECK_EQUAL(metadata.m_alt_blocks_count, pop->altTree->getBlocks().size());
+    BOOST_CHECK_EQUAL(metadata.m_vbk_blocks_count, pop->altTree->vbk().getBlocks().size());
+    BOOST_CHECK_EQUAL(metadata.m_btc_blocks_count, pop->altTree->btc().getBlocks().size());
+    BOOST_CHECK(stats.atvs >= 3);
+    BOOST_CHECK(stats.vtbs >= 3);
+
+    // the snapshot can not be applied to a node that is already past the
+    // bootstrap block, which is checked before the payloads are read
+    {
+        CAutoFile file(fsbridge::fopen(path, "rb"), SER_DISK, CLIENT_VERSION);
+        VeriBlock::PopSnapshotMetadata loaded;
+        VeriBlock::PopSnapshotStats loadedStats;
+        BOOST_CHECK(!VeriBlock::LoadPopState(file, *pblocktree, loaded, loadedStats, error));
+        BOOST_CHECK_EQUAL(error, "PoP state has already advanced past the bootstrap block");
+        BOOST_CHECK(loaded.m_base_blockhash == metadata.m_base_blockhash);
+        BOOST_CHECK_EQUAL(loadedStats.atvs, 0);
+        BOOST_CHECK_EQUAL(loadedStats.vtbs, 0);
+        BOOST_CHECK_EQUAL(loadedStats.vbkblocks, 0);
+    }
+}
+
+template <typename pop_t>
+static uint64_t countPayloads(char dbPrefix)
+{
+    uint64_t count = 0;
+    VeriBlock::GetPayloadsProvider().forEach<pop_t>(dbPrefix, [&](const pop_t&) {
+        ++count;
+        return true;
+    });
+    return count;
+}
+
+template <typename block_t>
+static void skipTree(CAutoFile& file, uint64_t count)
+{
+    typename block_t::hash_t tip;
+    file >> tip;
+    for (uint64_t i = 0; i < count; ++i) {
+        altintegration::BlockIndex<block_t> index;
+        file >> index;
+    }
+}
+
+static bool loadSnapshot(const fs::path& path, VeriBlock::PopSnapshotStats& stats, std::string& error)
+{
+    CAutoFile file(fsbridge::fopen(path, "rb"), SER_DISK, CLIENT_VERSION);
+    VeriBlock::PopSnapshotMetadata metadata;
+    return VeriBlock::LoadPopState(file, *pblocktree, metadata, stats, error);
+}
+
+BOOST_FIXTURE_TEST_CASE(DumpAndLoadSnapshot, E2eFixture)
+{
+    for (int i = 0; i < 3; ++i) {
+        auto* tip = ChainActive().Tip();
+        endorseAltBlockAndMine(tip->GetBlockHash(), 1);
+    }
+
+    fs::path path = GetDataDir() / "popstate.dat";
+    VeriBlock::PopSnapshotMetadata metadata;
+    VeriBlock::PopSnapshotStats stats;
+    std::string error;
+    {
+        CAutoFile file(fsbridge::fopen(path, "wb"), SER_DISK, CLIENT_VERSION);
+        BOOST_REQUIRE(VeriBlock::DumpPopState(file, metadata, stats, error));
+    }
+    const auto altTip = pop->altTree->getBestChain().tip()->getHash();
+    const auto vbkTip = pop->altTree->vbk().getBestChain().tip()->getHash();
+    const auto btcTip = pop->altTree->btc().getBestChain().tip()->getHash();
+
+    // a copy with a corrupted checksum
+    fs::path corrupted = GetDataDir() / "popstate_corrupted.dat";
+    fs::copy_file(path, corrupted);
+    {
+        std::fstream f(corrupted.string(), std::ios::in | std::ios::out | std::ios::binary);
+        f.seekg(-1, std::ios::end);
+        char c = 0;
+        f.read(&c, 1);
+        c ^= 0x01;
+        f.seekp(-1, std::ios::end);
+        f.write(&c, 1);
+    }
+
+    // a file that claims more blocks than it holds
+    fs::path truncated = GetDataDir() / "popstate_truncated.dat";
+    {
+        CAutoFile file(fsbridge::fopen(truncated, "wb"), SER_DISK, CLIENT_VERSION);
+        VeriBlock::PopSnapshotMetadata huge = metadata;
+        huge.m_btc_blocks_count = std::numeric_limits<uint64_t>::max();
+        file << huge << btcTip;
+    }
+
+    // a copy with a valid checksum, whose ALT tip is not one of its blocks
+    fs::path badtip = GetDataDir() / "popstate_badtip.dat";
+    {
+        long tipEnd = 0;
+        {
+            CAutoFile file(fsbridge::fopen(path, "rb"), SER_DISK, CLIENT_VERSION);
+            VeriBlock::PopSnapshotMetadata m;
+            file >> m;
+            skipTree<altintegration::BtcBlock>(file, m.m_btc_blocks_count);
+            skipTree<altintegration::VbkBlock>(file, m.m_vbk_blocks_count);
+            altintegration::AltBlock::hash_t tip;
+            file >> tip;
+            tipEnd = ftell(file.Get());
+        }
+        std::ifstream in(path.string(), std::ios::binary);
+        std::vector<char> data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        data.resize(data.size() - sizeof(uint256));
+        data[tipEnd - 1] ^= 0x01;
+        uint256 checksum = Hash(data.begin(), data.end());
+        std::ofstream out(badtip.string(), std::ios::binary);
+        out.write(data.data(), data.size());
+        out.write((const char*)checksum.begin(), checksum.size());
+    }
+
+    // a node at the bootstrap block, with an empty payloads database
+    CDBWrapper payloadsDb(GetDataDir() / "popload", 1 << 20, true, true);
+    VeriBlock::SetPop(payloadsDb);
+    pop = &VeriBlock::GetPop();
+    BOOST_REQUIRE(pop->altTree->getBestChain().tip()->getHash() != altTip);
+
+    VeriBlock::PopSnapshotStats loaded;
+    BOOST_CHECK(!loadSnapshot(truncated, loaded, error));
+    BOOST_CHECK(error.find("blocks do not fit in the rest of the file") != std::string::npos);
+
+    // nothing is written before the checksum is verified
+    BOOST_CHECK(!loadSnapshot(corrupted, loaded, error));
+    BOOST_CHECK_EQUAL(error, "PoP state snapshot checksum mismatch");
+    BOOST_CHECK_EQUAL(countPayloads<altintegration::ATV>(VeriBlock::DB_ATV_PREFIX), 0);
+    BOOST_CHECK_EQUAL(countPayloads<altintegration::VTB>(VeriBlock::DB_VTB_PREFIX), 0);
+    BOOST_CHECK_EQUAL(countPayloads<altintegration::VbkBlock>(VeriBlock::DB_VBK_PREFIX), 0);
+
+    // nor before all three trees are known to load
+    const auto bootstrapBtcBlocks = pop->altTree->btc().getBlocks().size();
+    const auto bootstrapVbkBlocks = pop->altTree->vbk().getBlocks().size();
+    const auto bootstrapAltBlocks = pop->altTree->getBlocks().size();
+    BOOST_CHECK(!loadSnapshot(badtip, loaded, error));
+    BOOST_CHECK(error.find("failed to load ALT tree") != std::string::npos);
+    BOOST_CHECK_EQUAL(countPayloads<altintegration::ATV>(VeriBlock::DB_ATV_PREFIX), 0);
+    BOOST_CHECK_EQUAL(countPayloads<altintegration::VTB>(VeriBlock::DB_VTB_PREFIX), 0);
+    BOOST_CHECK_EQUAL(countPayloads<altintegration::VbkBlock>(VeriBlock::DB_VBK_PREFIX), 0);
+    {
+        LOCK(cs_main);
+        BOOST_CHECK_EQUAL(pop->altTree->btc().getBlocks().size(), bootstrapBtcBlocks);
+        BOOST_CHECK_EQUAL(pop->altTree->vbk().getBlocks().size(), bootstrapVbkBlocks);
+        BOOST_CHECK_EQUAL(pop->altTree->getBlocks().size(), bootstrapAltBlocks);
+    }
+
+    BOOST_REQUIRE_MESSAGE(loadSnapshot(path, loaded, error), error);
+    VeriBlock::StopPopSnapshotValidation();
+    BOOST_CHECK_EQUAL(loaded.atvs, stats.atvs);
+    BOOST_CHECK_EQUAL(loaded.vtbs, stats.vtbs);
+    BOOST_CHECK_EQUAL(loaded.vbkblocks, stats.vbkblocks);
+    BOOST_CHECK_EQUAL(countPayloads<altintegration::ATV>(VeriBlock::DB_ATV_PREFIX), stats.atvs);
+    BOOST_CHECK_EQUAL(countPayloads<altintegration::VTB>(VeriBlock::DB_VTB_PREFIX), stats.vtbs);
+    BOOST_CHECK_EQUAL(countPayloads<altintegration::VbkBlock>(VeriBlock::DB_VBK_PREFIX), stats.vbkblocks);
+    {
+        LOCK(cs_main);
+        BOOST_CHECK(pop->altTree->getBestChain().tip()->getHash() == altTip);
+        BOOST_CHECK(pop->altTree->vbk().getBestChain().tip()->getHash() == vbkTip);
+        BOOST_CHECK(pop->altTree->btc().getBestChain().tip()->getHash() == btcTip);
+        BOOST_CHECK_EQUAL(pop->altTree->getBlocks().size(), metadata.m_alt_blocks_count);
+        BOOST_CHECK_EQUAL(pop->altTree->vbk().getBlocks().size(), metadata.m_vbk_blocks_count);
+        BOOST_CHECK_EQUAL(pop->altTree->btc().getBlocks().size(), metadata.m_btc_blocks_count);
+    }
+
+    // a loaded node is past the bootstrap block
+    BOOST_CHECK(!loadSnapshot(path, loaded, error));
+    BOOST_CHECK_EQUAL(error, "PoP state has already advanced past the bootstrap block");
+
+    // the payloads provider must not outlive its database
+    VeriBlock::SetPop(*pblocktree);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
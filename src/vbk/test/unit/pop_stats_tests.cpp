@@ -0,0 +1,60 @@
+// Copyright (c) 2019-2020 Xenios SEZC
+// https://www.veriblock.org
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <boost/test/unit_test.hpp>
+
+#include <test/util/setup_common.h>
+#include <vbk/pop_stats.hpp>
+
+using VeriBlock::PopStage;
+
+BOOST_FIXTURE_TEST_SUITE(pop_stats_tests, BasicTestingSetup)
+
+BOOST_AUTO_TEST_CASE(buckets_are_inclusive)
+{
+    BOOST_CHECK_EQUAL(VeriBlock::GetPopStatsBucket(0), 0);
+    BOOST_CHECK_EQUAL(VeriBlock::GetPopStatsBucket(10), 0);
+    BOOST_CHECK_EQUAL(VeriBlock::GetPopStatsBucket(11), 1);
+    BOOST_CHECK_EQUAL(VeriBlock::GetPopStatsBucket(1000000), 5);
+    BOOST_CHECK_EQUAL(VeriBlock::GetPopStatsBucket(10000000), 6);
+    BOOST_CHECK_EQUAL(VeriBlock::GetPopStatsBucket(10000001), 7);
+}
+
+BOOST_AUTO_TEST_CASE(record_and_reset)
+{
+    VeriBlock::ResetPopStats();
+    VeriBlock::RecordPopStage(PopStage::SET_STATE, 5);
+    VeriBlock::RecordPopStage(PopStage::SET_STATE, 2000);
+    VeriBlock::RecordPopStage(PopStage::SET_STATE, 300);
+
+    auto stats = VeriBlock::GetPopStageStats(PopStage::SET_STATE);
+    BOOST_CHECK_EQUAL(stats.count, 3);
+    BOOST_CHECK_EQUAL(stats.total_us, 2305);
+    BOOST_CHECK_EQUAL(stats.max_us, 2000);
+    BOOST_CHECK_EQUAL(stats.histogram[0], 1);
+    BOOST_CHECK_EQUAL(stats.histogram[2], 1);
+    BOOST_CHECK_EQUAL(stats.histogram[3], 1);
+
+    // other stages are not affected
+    BOOST_CHECK_EQUAL(VeriBlock::GetPopStageStats(PopStage::COMPARE_FORKS).count, 0);
+
+    VeriBlock::ResetPopStats();
+    stats = VeriBlock::GetPopStageStats(PopStage::SET_STATE);
+    BOOST_CHECK_EQUAL(stats.count, 0);
+    BOOST_CHECK_EQUAL(stats.max_us, 0);
+    BOOST_CHECK_EQUAL(stats.histogram[3], 0);
+}
+
+BOOST_AUTO_TEST_CASE(timer_records_on_scope_exit)
+{
+    VeriBlock::ResetPopStats();
+    {
+        VeriBlock::PopStageTimer timer(PopStage::MEMPOOL_SUBMIT);
+        BOOST_CHECK_EQUAL(VeriBlock::GetPopStageStats(PopStage::MEMPOOL_SUBMIT).count, 0);
+    }
+    BOOST_CHECK_EQUAL(VeriBlock::GetPopStageStats(PopStage::MEMPOOL_SUBMIT).count, 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -10,6 +10,7 @@
 #include <fstream>
 #include <rpc/request.h>
 #include <rpc/server.h>
+#include <set>
 #include <test/util/setup_common.h>
 #include <thread>
 #include <univalue.h>
@@ -102,4 +103,55 @@ BOOST_FIXTURE_TEST_CASE(submitpop_test, E2eFixture)
     BOOST_CHECK_EQUAL(result["vbkblocks"].size(), vbk_blocks.size());
 }
 
+BOOST_FIXTURE_TEST_CASE(getrawpopmempool_pagination_test, E2eFixture)
+{
+    std::vector<VTB> vtbs;
+    std::generate_n(std::back_inserter(vtbs), 10, [&]() {
+        return endorseVbkTip();
+    });
+
+    std::set<std::string> expectedVbkBlocks, expectedVtbs;
+    {
+        LOCK(cs_main);
+        auto& mp = *VeriBlock::GetPop().mempool;
+        for (const auto& vtb : vtbs) {
+            altintegration::ValidationState state;
+            mp.submit(vtb.containingBlock, state);
+            mp.submit(vtb, state);
+        }
+        for (const auto& el : mp.getMap<altintegration::VbkBlock>()) {
+            expectedVbkBlocks.insert(el.first.toHex());
+        }
+        for (const auto& el : mp.getMap<VTB>()) {
+            expectedVtbs.insert(el.first.toHex());
+        }
+    }
+    BOOST_REQUIRE(!expectedVtbs.empty());
+
+    std::set<std::string> vbkblocks, vtbids;
+    std::string cursor;
+    size_t pages = 0;
+    do {
+        UniValue result;
+        BOOST_REQUIRE_NO_THROW(result = CallRPC("getrawpopmempool false " + cursor + " 3"));
+        BOOST_CHECK_LE(result["vbkblocks"].size() + result["vtbs"].size() + result["atvs"].size(), 3);
+        for (const auto& id : result["vbkblocks"].getValues()) {
+            BOOST_CHECK(vbkblocks.insert(id.get_str()).second);
+        }
+        for (const auto& id : result["vtbs"].getValues()) {
+            BOOST_CHECK(vtbids.insert(id.get_str()).second);
+        }
+        cursor = result["cursor"].isNull() ? "" : result["cursor"].get_str();
+        ++pages;
+    } while (!cursor.empty());
+
+    BOOST_CHECK(vbkblocks == expectedVbkBlocks);
+    BOOST_CHECK(vtbids == expectedVtbs);
+    BOOST_CHECK_EQUAL(pages, (vbkblocks.size() + vtbids.size() + 2) / 3);
+
+    BOOST_CHECK_THROW(CallRPC("getrawpopmempool false tx:00"), std::runtime_error);
+    BOOST_CHECK_THROW(CallRPC("getrawpopmempool false vtb"), std::runtime_error);
+    BOOST_CHECK_THROW(CallRPC("getrawpopmempool false  0"), std::runtime_error);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -15,6 +15,7 @@
 #include <test/util/setup_common.h>
 #include <validation.h>
 #include <vbk/log.hpp>
+#include <vbk/test/util/endorsements.hpp>
 #include <vbk/util.hpp>
 #include <veriblock/alt-util.hpp>
 #include <veriblock/mempool.hpp>
@@ -92,9 +93,7 @@ struct E2eFixture : public TestChain100Setup {
             BOOST_CHECK(endorsed != nullptr);
         }
 
-        auto publicationdata = createPublicationData(endorsed, payoutInfo);
-        auto vbktx = popminer.createVbkTxEndorsingAltBlock(publicationdata);
-        auto atv = popminer.applyATV(vbktx, state);
+        auto atv = VeriBlock::endorseAltBlock(popminer, *endorsed, payoutInfo, state);
         BOOST_CHECK(state.IsValid());
         return atv;
     }
@@ -167,36 +166,12 @@ struct E2eFixture : public TestChain100Setup {
 
     VTB endorseVbkBlock(int height)
     {
-        auto vbkbest = popminer.vbk().getBestChain();
-        auto endorsed = vbkbest[height];
-        if (!endorsed) {
-            throw std::logic_error("can not find VBK block at height " + std::to_string(height));
-        }
-
-        auto btctx = popminer.createBtcTxEndorsingVbkBlock(endorsed->getHeader());
-        auto* btccontaining = popminer.mineBtcBlocks(1);
-        auto vbktx = popminer.createVbkPopTxEndorsingVbkBlock(btccontaining->getHeader(), btctx, endorsed->getHeader(), getLastKnownBTCblock());
-        auto* vbkcontaining = popminer.mineVbkBlocks(1);
-
-        auto vtbs = popminer.vbkPayloads[vbkcontaining->getHash()];
-        BOOST_CHECK(vtbs.size() == 1);
-        return vtbs[0];
+        return VeriBlock::endorseVbkBlock(popminer, height, getLastKnownBTCblock());
     }
 
     PublicationData createPublicationData(CBlockIndex* endorsed, const std::vector<uint8_t>& payoutInfo)
     {
-        PublicationData p;
-
-        auto& config = *VeriBlock::GetPop().config;
-        p.identifier = config.alt->getIdentifier();
-        p.payoutInfo = payoutInfo;
-
-        // serialize block header
-        CDataStream stream(SER_NETWORK, PROTOCOL_VERSION);
-        stream << endorsed->GetBlockHeader();
-        p.header = std::vector<uint8_t>{stream.begin(), stream.end()};
-
-        return p;
+        return VeriBlock::createPublicationData(*endorsed, payoutInfo);
     }
 
     PublicationData createPublicationData(CBlockIndex* endorsed)
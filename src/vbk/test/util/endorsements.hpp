@@ -0,0 +1,68 @@
+// Copyright (c) 2019-2020 Xenios SEZC
+// https://www.veriblock.org
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef BITCOIN_SRC_VBK_TEST_UTIL_ENDORSEMENTS_HPP
+#define BITCOIN_SRC_VBK_TEST_UTIL_ENDORSEMENTS_HPP
+
+#include <chain.h>
+#include <streams.h>
+#include <vbk/pop_common.hpp>
+#include <version.h>
+#include <veriblock/mock_miner.hpp>
+
+#include <stdexcept>
+
+// Helpers to create PoP payloads with altintegration::MockMiner. They do not
+// depend on the unit test framework, so they are shared by tests and benches.
+namespace VeriBlock {
+
+inline altintegration::PublicationData createPublicationData(const CBlockIndex& endorsed, const std::vector<uint8_t>& payoutInfo)
+{
+    altintegration::PublicationData p;
+
+    auto& config = *GetPop().config;
+    p.identifier = config.alt->getIdentifier();
+    p.payoutInfo = payoutInfo;
+
+    // serialize block header
+    CDataStream stream(SER_NETWORK, PROTOCOL_VERSION);
+    stream << endorsed.GetBlockHeader();
+    p.header = std::vector<uint8_t>{stream.begin(), stream.end()};
+
+    return p;
+}
+
+//! Create an ATV endorsing ALT block `endorsed`
+inline altintegration::ATV endorseAltBlock(altintegration::MockMiner& popminer, const CBlockIndex& endorsed, const std::vector<uint8_t>& payoutInfo, altintegration::ValidationState& state)
+{
+    auto publicationdata = createPublicationData(endorsed, payoutInfo);
+    auto vbktx = popminer.createVbkTxEndorsingAltBlock(publicationdata);
+    return popminer.applyATV(vbktx, state);
+}
+
+//! Create a VTB endorsing VBK block at `height` of the miner's best VBK chain
+inline altintegration::VTB endorseVbkBlock(altintegration::MockMiner& popminer, int height, const altintegration::BtcBlock::hash_t& lastKnownBtcBlock)
+{
+    auto vbkbest = popminer.vbk().getBestChain();
+    auto endorsed = vbkbest[height];
+    if (!endorsed) {
+        throw std::logic_error("can not find VBK block at height " + std::to_string(height));
+    }
+
+    auto btctx = popminer.createBtcTxEndorsingVbkBlock(endorsed->getHeader());
+    auto* btccontaining = popminer.mineBtcBlocks(1);
+    auto vbktx = popminer.createVbkPopTxEndorsingVbkBlock(btccontaining->getHeader(), btctx, endorsed->getHeader(), lastKnownBtcBlock);
+    auto* vbkcontaining = popminer.mineVbkBlocks(1);
+
+    auto vtbs = popminer.vbkPayloads[vbkcontaining->getHash()];
+    if (vtbs.size() != 1) {
+        throw std::logic_error("expected exactly one VTB in VBK block " + vbkcontaining->getHash().toHex());
+    }
+    return vtbs[0];
+}
+
+} // namespace VeriBlock
+
+#endif //BITCOIN_SRC_VBK_TEST_UTIL_ENDORSEMENTS_HPP
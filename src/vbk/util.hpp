@@ -58,9 +58,17 @@ inline altintegration::AltBlock blockToAltBlock(int nHeight, const CBlockHeader&
     return alt;
 }
 
+//! Uses the hashes stored in the block index, the header is not hashed again
 inline altintegration::AltBlock blockToAltBlock(const CBlockIndex& index)
 {
-    return blockToAltBlock(index.nHeight, index.GetBlockHeader());
+    altintegration::AltBlock alt;
+    alt.height = index.nHeight;
+    alt.timestamp = index.nTime;
+    const uint256 prev = index.pprev ? index.pprev->GetBlockHash() : uint256();
+    alt.previousBlock = std::vector<uint8_t>(prev.begin(), prev.end());
+    const uint256& hash = *index.phashBlock;
+    alt.hash = std::vector<uint8_t>(hash.begin(), hash.end());
+    return alt;
 }
 
 //PopData weight
@@ -20,3 +20,23 @@ bool CZMQAbstractNotifier::NotifyTransaction(const CTransaction &/*transaction*/
 {
     return true;
 }
+
+bool CZMQAbstractNotifier::NotifyATV(const altintegration::ATV &/*atv*/)
+{
+    return true;
+}
+
+bool CZMQAbstractNotifier::NotifyVTB(const altintegration::VTB &/*vtb*/)
+{
+    return true;
+}
+
+bool CZMQAbstractNotifier::NotifyVbkBlock(const altintegration::VbkBlock &/*block*/)
+{
+    return true;
+}
+
+bool CZMQAbstractNotifier::NotifyPopTip(const altintegration::VbkBlock::hash_t &/*vbkTip*/, const altintegration::BtcBlock::hash_t &/*btcTip*/)
+{
+    return true;
+}
@@ -7,6 +7,11 @@
 
 #include <zmq/zmqconfig.h>
 
+#include <veriblock/entities/atv.hpp>
+#include <veriblock/entities/btcblock.hpp>
+#include <veriblock/entities/vbkblock.hpp>
+#include <veriblock/entities/vtb.hpp>
+
 class CBlockIndex;
 class CZMQAbstractNotifier;
 
@@ -43,6 +48,12 @@ public:
     virtual bool NotifyBlock(const CBlockIndex *pindex);
     virtual bool NotifyTransaction(const CTransaction &transaction);
 
+    // PoP notifications
+    virtual bool NotifyATV(const altintegration::ATV &atv);
+    virtual bool NotifyVTB(const altintegration::VTB &vtb);
+    virtual bool NotifyVbkBlock(const altintegration::VbkBlock &block);
+    virtual bool NotifyPopTip(const altintegration::VbkBlock::hash_t &vbkTip, const altintegration::BtcBlock::hash_t &btcTip);
+
 protected:
     void *psocket;
     std::string type;
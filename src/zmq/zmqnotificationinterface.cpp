@@ -7,12 +7,28 @@
 
 #include <validation.h>
 #include <util/system.h>
+#include <vbk/pop_common.hpp>
 
 void zmqError(const char *str)
 {
     LogPrint(BCLog::ZMQ, "zmq: Error: %s, errno=%s\n", str, zmq_strerror(errno));
 }
 
+// Calls func for every notifier, shutting down and removing the ones that fail
+template <typename Function>
+static void TryForEachAndRemoveFailed(std::list<CZMQAbstractNotifier*>& notifiers, const Function& func)
+{
+    for (auto i = notifiers.begin(); i != notifiers.end(); ) {
+        CZMQAbstractNotifier *notifier = *i;
+        if (func(notifier)) {
+            ++i;
+        } else {
+            notifier->Shutdown();
+            i = notifiers.erase(i);
+        }
+    }
+}
+
 CZMQNotificationInterface::CZMQNotificationInterface() : pcontext(nullptr)
 {
 }
@@ -46,6 +62,10 @@ CZMQNotificationInterface* CZMQNotificationInterface::Create()
     factories["pubhashtx"] = CZMQAbstractNotifier::Create<CZMQPublishHashTransactionNotifier>;
     factories["pubrawblock"] = CZMQAbstractNotifier::Create<CZMQPublishRawBlockNotifier>;
     factories["pubrawtx"] = CZMQAbstractNotifier::Create<CZMQPublishRawTransactionNotifier>;
+    factories["pubhashatv"] = CZMQAbstractNotifier::Create<CZMQPublishHashATVNotifier>;
+    factories["pubhashvtb"] = CZMQAbstractNotifier::Create<CZMQPublishHashVTBNotifier>;
+    factories["pubrawvbkblock"] = CZMQAbstractNotifier::Create<CZMQPublishRawVbkBlockNotifier>;
+    factories["pubhashpoptip"] = CZMQAbstractNotifier::Create<CZMQPublishHashPopTipNotifier>;
 
     for (const auto& entry : factories)
     {
@@ -154,6 +174,57 @@ void CZMQNotificationInterface::UpdatedBlockTip(const CBlockIndex *pindexNew, co
             i = notifiers.erase(i);
         }
     }
+
+    // payloads of the new tip may have moved the BTC/VBK tips
+    altintegration::VbkBlock::hash_t vbkTip;
+    altintegration::BtcBlock::hash_t btcTip;
+    {
+        LOCK(cs_main);
+        auto& tree = *VeriBlock::GetPop().altTree;
+        auto* vbkIndex = tree.vbk().getBestChain().tip();
+        auto* btcIndex = tree.btc().getBestChain().tip();
+        if (!vbkIndex || !btcIndex) {
+            // trees are not bootstrapped
+            return;
+        }
+        vbkTip = vbkIndex->getHash();
+        btcTip = btcIndex->getHash();
+    }
+
+    if (vbkTip == lastVbkTip && btcTip == lastBtcTip) {
+        return;
+    }
+    lastVbkTip = vbkTip;
+    lastBtcTip = btcTip;
+
+    TryForEachAndRemoveFailed(notifiers, [&](CZMQAbstractNotifier* notifier) {
+        return notifier->NotifyPopTip(vbkTip, btcTip);
+    });
+}
+
+void CZMQNotificationInterface::RegisterPopMempool(altintegration::MemPool& mempool)
+{
+    mempool.onAccepted<altintegration::ATV>([this](const altintegration::ATV& atv) {
+        CallFunctionInValidationInterfaceQueue([this, atv] {
+            TryForEachAndRemoveFailed(notifiers, [&](CZMQAbstractNotifier* notifier) {
+                return notifier->NotifyATV(atv);
+            });
+        });
+    });
+    mempool.onAccepted<altintegration::VTB>([this](const altintegration::VTB& vtb) {
+        CallFunctionInValidationInterfaceQueue([this, vtb] {
+            TryForEachAndRemoveFailed(notifiers, [&](CZMQAbstractNotifier* notifier) {
+                return notifier->NotifyVTB(vtb);
+            });
+        });
+    });
+    mempool.onAccepted<altintegration::VbkBlock>([this](const altintegration::VbkBlock& block) {
+        CallFunctionInValidationInterfaceQueue([this, block] {
+            TryForEachAndRemoveFailed(notifiers, [&](CZMQAbstractNotifier* notifier) {
+                return notifier->NotifyVbkBlock(block);
+            });
+        });
+    });
 }
 
 void CZMQNotificationInterface::TransactionAddedToMempool(const CTransactionRef& ptx)
@@ -8,6 +8,10 @@
 #include <validationinterface.h>
 #include <list>
 
+#include <veriblock/entities/btcblock.hpp>
+#include <veriblock/entities/vbkblock.hpp>
+#include <veriblock/mempool.hpp>
+
 class CBlockIndex;
 class CZMQAbstractNotifier;
 
@@ -20,6 +24,10 @@ public:
 
     static CZMQNotificationInterface* Create();
 
+    // Publish payloads accepted to the given PoP mempool. Notifications are
+    // sent from the validation interface queue, like all other notifications.
+    void RegisterPopMempool(altintegration::MemPool& mempool);
+
 protected:
     bool Initialize();
     void Shutdown();
@@ -35,6 +43,10 @@ private:
 
     void *pcontext;
     std::list<CZMQAbstractNotifier*> notifiers;
+
+    // last published PoP tips
+    altintegration::VbkBlock::hash_t lastVbkTip;
+    altintegration::BtcBlock::hash_t lastBtcTip;
 };
 
 extern CZMQNotificationInterface* g_zmq_notification_interface;
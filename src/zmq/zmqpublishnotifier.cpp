@@ -16,6 +16,10 @@ static const char *MSG_HASHBLOCK = "hashblock";
 static const char *MSG_HASHTX    = "hashtx";
 static const char *MSG_RAWBLOCK  = "rawblock";
 static const char *MSG_RAWTX     = "rawtx";
+static const char *MSG_HASHATV   = "hashatv";
+static const char *MSG_HASHVTB   = "hashvtb";
+static const char *MSG_RAWVBKBLOCK = "rawvbkblock";
+static const char *MSG_HASHPOPTIP  = "hashpoptip";
 
 // Internal function to send multipart message
 static int zmq_send_multipart(void *sock, const void* data, size_t size, ...)
@@ -206,3 +210,33 @@ bool CZMQPublishRawTransactionNotifier::NotifyTransaction(const CTransaction &tr
     ss << transaction;
     return SendMessage(MSG_RAWTX, &(*ss.begin()), ss.size());
 }
+
+bool CZMQPublishHashATVNotifier::NotifyATV(const altintegration::ATV &atv)
+{
+    auto id = atv.getId();
+    LogPrint(BCLog::ZMQ, "zmq: Publish hashatv %s\n", id.toHex());
+    return SendMessage(MSG_HASHATV, id.data(), id.size());
+}
+
+bool CZMQPublishHashVTBNotifier::NotifyVTB(const altintegration::VTB &vtb)
+{
+    auto id = vtb.getId();
+    LogPrint(BCLog::ZMQ, "zmq: Publish hashvtb %s\n", id.toHex());
+    return SendMessage(MSG_HASHVTB, id.data(), id.size());
+}
+
+bool CZMQPublishRawVbkBlockNotifier::NotifyVbkBlock(const altintegration::VbkBlock &block)
+{
+    LogPrint(BCLog::ZMQ, "zmq: Publish rawvbkblock %s\n", block.getHash().toHex());
+    std::vector<uint8_t> raw = block.toRaw();
+    return SendMessage(MSG_RAWVBKBLOCK, raw.data(), raw.size());
+}
+
+bool CZMQPublishHashPopTipNotifier::NotifyPopTip(const altintegration::VbkBlock::hash_t &vbkTip, const altintegration::BtcBlock::hash_t &btcTip)
+{
+    LogPrint(BCLog::ZMQ, "zmq: Publish hashpoptip vbk=%s btc=%s\n", vbkTip.toHex(), btcTip.toHex());
+    /* VBK tip hash followed by BTC tip hash, in the byte order of getvbkbestblockhash/getbtcbestblockhash */
+    std::vector<uint8_t> data(vbkTip.begin(), vbkTip.end());
+    data.insert(data.end(), btcTip.begin(), btcTip.end());
+    return SendMessage(MSG_HASHPOPTIP, data.data(), data.size());
+}
@@ -52,4 +52,28 @@ public:
     bool NotifyTransaction(const CTransaction &transaction) override;
 };
 
+class CZMQPublishHashATVNotifier : public CZMQAbstractPublishNotifier
+{
+public:
+    bool NotifyATV(const altintegration::ATV &atv) override;
+};
+
+class CZMQPublishHashVTBNotifier : public CZMQAbstractPublishNotifier
+{
+public:
+    bool NotifyVTB(const altintegration::VTB &vtb) override;
+};
+
+class CZMQPublishRawVbkBlockNotifier : public CZMQAbstractPublishNotifier
+{
+public:
+    bool NotifyVbkBlock(const altintegration::VbkBlock &block) override;
+};
+
+class CZMQPublishHashPopTipNotifier : public CZMQAbstractPublishNotifier
+{
+public:
+    bool NotifyPopTip(const altintegration::VbkBlock::hash_t &vbkTip, const altintegration::BtcBlock::hash_t &btcTip) override;
+};
+
 #endif // PLACEH_ZMQ_ZMQPUBLISHNOTIFIER_H
@@ -22,7 +22,8 @@ from test_framework.util import (
     hex_str_to_bytes,
 )
 
-from test_framework.messages import BLOCK_HEADER_SIZE
+from test_framework.messages import BLOCK_HEADER_SIZE, deser_string, deser_string_vector
+from test_framework.pop import endorse_block, get_pop_mempool, mine_vbk_blocks
 
 class ReqType(Enum):
     JSON = 1
@@ -325,5 +326,111 @@ class RESTTest (PlaceholdersTestFramework):
         json_obj = self.test_rest_request("/chaininfo")
         assert_equal(json_obj['bestblockhash'], bb_hash)
 
+        self.log.info("Test the /pop/mempool URI")
+        self.test_pop_mempool()
+
+        self.log.info("Test the /pop/atv, /pop/vtb and /pop/vbkheaders URIs")
+        self.test_pop_payloads()
+
+    def test_pop_mempool(self):
+        json_obj = self.test_rest_request("/pop/mempool")
+        assert_equal(json_obj, {'vbkblocks': [], 'vtbs': [], 'atvs': [], 'cursor': None})
+
+        # out of range counts and malformed cursors are rejected
+        self.test_rest_request("/pop/mempool/0", status=400, ret_type=RetType.OBJ)
+        self.test_rest_request("/pop/mempool/10001", status=400, ret_type=RetType.OBJ)
+        self.test_rest_request("/pop/mempool/2/foo", status=400, ret_type=RetType.OBJ)
+        self.test_rest_request("/pop/mempool/2/vtb:zz", status=400, ret_type=RetType.OBJ)
+
+        try:
+            from pypopminer import MockMiner
+        except ImportError:
+            self.log.info("pypopminer module not available, skipping POP mempool pages")
+            return
+        apm = MockMiner()
+        mine_vbk_blocks(self.nodes[0], apm, 5)
+        expected = get_pop_mempool(self.nodes[0])
+        assert_equal(len(expected['vbkblocks']), 5)
+
+        # follow pages of 2 ids, all formats return the same ids and cursor
+        ids = []
+        cursor = None
+        while True:
+            uri = "/pop/mempool/2" + ("/" + cursor if cursor else "")
+            json_obj = self.test_rest_request(uri)
+            bin_obj = self.test_rest_request(uri, req_type=ReqType.BIN, ret_type=RetType.BYTES)
+            hex_obj = self.test_rest_request(uri, req_type=ReqType.HEX, ret_type=RetType.BYTES)
+            assert_equal(binascii.hexlify(bin_obj), hex_obj.rstrip())
+
+            f = BytesIO(bin_obj)
+            for key in ('vbkblocks', 'vtbs', 'atvs'):
+                assert_equal([bytes(i).hex() for i in deser_string_vector(f)], json_obj[key])
+            assert_equal(deser_string(f).decode(), json_obj['cursor'] or '')
+
+            page = json_obj['vbkblocks'] + json_obj['vtbs'] + json_obj['atvs']
+            assert 0 < len(page) <= 2
+            ids += page
+            cursor = json_obj['cursor']
+            if cursor is None:
+                break
+        assert_equal(ids, expected['vbkblocks'] + expected['vtbs'] + expected['atvs'])
+
+    def check_pop_vbkheaders(self, uri):
+        json_obj = self.test_rest_request(uri)
+        bin_obj = self.test_rest_request(uri, req_type=ReqType.BIN, ret_type=RetType.BYTES)
+        hex_obj = self.test_rest_request(uri, req_type=ReqType.HEX, ret_type=RetType.BYTES)
+        assert_equal(len(bin_obj), 65 * len(json_obj))
+        assert_equal(binascii.hexlify(bin_obj), hex_obj.rstrip())
+        return json_obj
+
+    def test_pop_payloads(self):
+        node = self.nodes[0]
+
+        # unknown ids are not found, malformed ids are rejected
+        self.test_rest_request("/pop/atv/" + "00" * 32, status=404, ret_type=RetType.OBJ)
+        self.test_rest_request("/pop/vtb/" + "00" * 32, status=404, ret_type=RetType.OBJ)
+        self.test_rest_request("/pop/atv/zz", status=400, ret_type=RetType.OBJ)
+        self.test_rest_request("/pop/vtb/00", status=400, ret_type=RetType.OBJ)
+
+        # missing, out of range and malformed header counts are rejected
+        vbk_tip = node.getvbkbestblockhash()
+        self.test_rest_request("/pop/vbkheaders/" + vbk_tip, status=400, ret_type=RetType.OBJ)
+        for count in ("0", "2001", "foo"):
+            self.test_rest_request("/pop/vbkheaders/{}/{}".format(vbk_tip, count), status=400, ret_type=RetType.OBJ)
+        self.test_rest_request("/pop/vbkheaders/zz/1", status=400, ret_type=RetType.OBJ)
+
+        # headers stop at the tip, an unknown hash returns none
+        json_obj = self.check_pop_vbkheaders("/pop/vbkheaders/{}/10".format(vbk_tip))
+        assert_equal([h['hash'] for h in json_obj], [vbk_tip])
+        assert_equal(self.check_pop_vbkheaders("/pop/vbkheaders/{}/10".format("00" * 24)), [])
+
+        try:
+            from pypopminer import MockMiner
+        except ImportError:
+            self.log.info("pypopminer module not available, skipping POP payloads")
+            return
+        apm = MockMiner()
+        addr = node.getnewaddress()
+        atv_id = endorse_block(node, apm, node.getblockcount(), addr, vtbs=1)
+        vtb_id = get_pop_mempool(node)['vtbs'][0]
+
+        # payloads are served the same way as getrawatv and getrawvtb serve them
+        for name, payload_id, getraw in (("atv", atv_id, node.getrawatv), ("vtb", vtb_id, node.getrawvtb)):
+            uri = "/pop/{}/{}".format(name, payload_id)
+            assert_equal(self.test_rest_request(uri), getraw(payload_id, True)[name])
+            bin_obj = self.test_rest_request(uri, req_type=ReqType.BIN, ret_type=RetType.BYTES)
+            hex_obj = self.test_rest_request(uri, req_type=ReqType.HEX, ret_type=RetType.BYTES)
+            assert_equal(bin_obj.hex(), getraw(payload_id))
+            assert_equal(binascii.hexlify(bin_obj), hex_obj.rstrip())
+
+        # mining the payloads extends the VBK chain
+        node.generate(nblocks=1)
+        tip_height = node.getvbkblock(node.getvbkbestblockhash())['height']
+        hashes = [node.getvbkblockhash(h) for h in range(tip_height - 2, tip_height + 1)]
+        json_obj = self.check_pop_vbkheaders("/pop/vbkheaders/{}/10".format(hashes[0]))
+        assert_equal([h['hash'] for h in json_obj], hashes)
+        json_obj = self.check_pop_vbkheaders("/pop/vbkheaders/{}/2".format(hashes[0]))
+        assert_equal([h['hash'] for h in json_obj], hashes[:2])
+
 if __name__ == '__main__':
     RESTTest().main()
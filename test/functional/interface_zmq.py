@@ -8,6 +8,7 @@ import struct
 from test_framework.address import ADDRESS_BCRT1_UNSPENDABLE
 from test_framework.test_framework import PlaceholdersTestFramework
 from test_framework.messages import CTransaction, hash256
+from test_framework.pop import endorse_block, get_pop_mempool
 from test_framework.util import assert_equal, connect_nodes
 from io import BytesIO
 from time import sleep
@@ -48,6 +49,7 @@ class ZMQTest (PlaceholdersTestFramework):
         try:
             self.test_basic()
             self.test_reorg()
+            self.test_pop()
         finally:
             # Destroy the ZMQ context.
             self.log.debug("Destroying ZMQ context")
@@ -152,5 +154,81 @@ class ZMQTest (PlaceholdersTestFramework):
         # Should receive nodes[1] tip
         assert_equal(self.nodes[1].getbestblockhash(), hashblock.receive().hex())
 
+    def test_pop(self):
+        try:
+            from pypopminer import MockMiner
+        except ImportError:
+            self.log.info("pypopminer module not available, skipping PoP notifications")
+            return
+        if not self.is_wallet_compiled():
+            self.log.info("Wallet is not compiled, skipping PoP notifications")
+            return
+
+        import zmq
+        address = 'tcp://127.0.0.1:28334'
+        # one socket per topic, the order of PoP notifications across topics is not defined
+        subs = []
+        for topic in [b"hashatv", b"hashvtb", b"rawvbkblock", b"hashpoptip"]:
+            socket = self.ctx.socket(zmq.SUB)
+            socket.set(zmq.RCVTIMEO, 60000)
+            subs.append(ZMQSubscriber(socket, topic))
+        hashatv, hashvtb, rawvbkblock, hashpoptip = subs
+
+        node = self.nodes[0]
+        self.restart_node(0, ["-zmqpub%s=%s" % (sub.topic.decode(), address) for sub in subs])
+        for sub in subs:
+            sub.socket.connect(address)
+        # Relax so that the subscriber is ready before publishing zmq messages
+        sleep(0.2)
+
+        def check_pop_tip():
+            # VBK tip hash (24 bytes) followed by BTC tip hash (32 bytes), in RPC byte order
+            body = hashpoptip.receive()
+            assert_equal(len(body), 24 + 32)
+            assert_equal(body[:24].hex(), node.getvbkbestblockhash())
+            assert_equal(body[24:].hex(), node.getbtcbestblockhash())
+
+        self.log.info("Should receive the PoP tips after the first connected block")
+        node.generatetoaddress(1, ADDRESS_BCRT1_UNSPENDABLE)
+        check_pop_tip()
+
+        self.log.info("Should receive the payloads accepted to the POP mempool")
+        apm = MockMiner()
+        addr = node.getnewaddress()
+        atv_id = endorse_block(node, apm, node.getblockcount(), addr, vtbs=1)
+        mempool = get_pop_mempool(node)
+
+        body = hashatv.receive()
+        assert_equal(len(body), 32)
+        assert_equal(body.hex(), atv_id)
+        assert_equal(node.getrawatv(body.hex()), node.getrawatv(atv_id))
+
+        assert_equal(len(mempool['vtbs']), 1)
+        body = hashvtb.receive()
+        assert_equal(len(body), 32)
+        assert_equal(body.hex(), mempool['vtbs'][0])
+
+        # raw headers, getrawvbkblock returns them with the VBK encoding length prefix
+        expected = sorted(node.getrawvbkblock(id)[-65 * 2:] for id in mempool['vbkblocks'])
+        received = []
+        for _ in expected:
+            body = rawvbkblock.receive()
+            assert_equal(len(body), 65)
+            received.append(body.hex())
+        assert_equal(sorted(received), expected)
+
+        self.log.info("Should receive the new PoP tips once the payloads are mined")
+        vbk_tip = node.getvbkbestblockhash()
+        node.generatetoaddress(1, ADDRESS_BCRT1_UNSPENDABLE)
+        assert vbk_tip != node.getvbkbestblockhash()
+        check_pop_tip()
+
+        assert_equal(node.getzmqnotifications(), [
+            {"type": "pubhashatv", "address": address, "hwm": 1000},
+            {"type": "pubhashpoptip", "address": address, "hwm": 1000},
+            {"type": "pubhashvtb", "address": address, "hwm": 1000},
+            {"type": "pubrawvbkblock", "address": address, "hwm": 1000},
+        ])
+
 if __name__ == '__main__':
     ZMQTest().main()
@@ -209,6 +209,21 @@ def assert_pop_state_equal(nodes):
     is_same(lambda x: x.getblock(x.getbestblockhash()), "ALT tips")
 
 
+def get_pop_mempool(node):
+    """
+    Return ids of all VBK blocks, VTBs and ATVs in node's POP mempool, following getrawpopmempool pages
+    """
+    result = {'vbkblocks': [], 'vtbs': [], 'atvs': []}
+    cursor = ""
+    while True:
+        page = node.getrawpopmempool(False, cursor)
+        for key in result:
+            result[key] += page[key]
+        cursor = page['cursor']
+        if cursor is None:
+            return result
+
+
 def sync_pop_mempools(rpc_connections, *, wait=1, timeout=60, flush_scheduler=True):
     """
     Wait until everybody has the same POP data in their POP mempools
@@ -219,7 +234,7 @@ def sync_pop_mempools(rpc_connections, *, wait=1, timeout=60, flush_scheduler=Tr
 
     stop_time = time.time() + timeout
     while time.time() <= stop_time:
-        mpooldata = [r.getrawpopmempool() for r in rpc_connections]
+        mpooldata = [get_pop_mempool(r) for r in rpc_connections]
         atvs = [set(data['atvs']) for data in mpooldata]
         vtbs = [set(data['vtbs']) for data in mpooldata]
         vbkblocks = [set(data['vbkblocks']) for data in mpooldata]